@@ -45,11 +45,58 @@
 #define EXIP_REALLOC d_realloc
 #define EXIP_MFREE d_free
 
+#define MEM_ARENA_USE OFF
+
 #define HASH_TABLE_USE OFF
 #define INITIAL_HASH_TABLE_SIZE 53
 #define MAX_HASH_TABLE_SIZE 3000
+#define OPEN_HASH_TABLE_USE OFF
+
+/** @def STRING_TABLE_INDEX_USE
+ * 		Whether to index the URI, local-name, prefix and value cross tables with hash
+ * 		tables for the string lookups of the encoder
+ * 	@def STRING_TABLE_INDEX_THRESHOLD
+ * 		The number of entries at which the index of a table is built
+ */
+#define STRING_TABLE_INDEX_USE OFF
+#define STRING_TABLE_INDEX_THRESHOLD 16
+
+/** @def PRODUCTION_INDEX_USE
+ * 		Whether the encoder finds the first-level productions of the schema-informed
+ * 		grammar rules through a hash index built when the schema is loaded
+ * 	@def PRODUCTION_INDEX_THRESHOLD
+ * 		The number of productions from which a grammar rule is indexed
+ */
+#define PRODUCTION_INDEX_USE OFF
+#define PRODUCTION_INDEX_THRESHOLD 8
+
+/** @def PACKED_GRAMMAR_USE
+ * 		Whether the grammar productions use the compact layout, with the type and qname
+ * 		indices stored in the EXIP_PROD_TYPE_INDEX, EXIP_PROD_URI_INDEX and EXIP_PROD_LN_INDEX
+ * 		types (uint16_t by default): 12 instead of 32 bytes per production on 64-bit platforms
+ */
+#define PACKED_GRAMMAR_USE OFF
+
+#define BINARY_ZERO_COPY_USE OFF
+
+#define COMPRESSION_USE OFF
+
+#define COMPRESSION_THREAD_USE OFF
+
+#define SCHEMA_REGISTRY_THREAD_USE OFF
+
 #define DYN_ARRAY_USE ON
 
+/**
+ * Whether the stream reader and writer access the EXI buffer one 64-bit word at a time
+ * instead of byte by byte. Turn OFF on 8/16-bit targets where 64-bit shifts are expensive. */
+#define STREAM_WORD_IO_USE OFF
+
+/**
+ * Whether the strings are UTF-8 encoded (UTF8_stringManipulate.c) instead of
+ * ASCII (ASCII_stringManipulate.c). String.length is the number of characters in both cases. */
+#define STRING_UTF8_USE OFF
+
 
 // Some types in procTypes.h
 #define EXIP_UNSIGNED_INTEGER uint32_t
@@ -13,6 +13,11 @@ WARNING = -Wpacked -Wall
 # Add aditional CFLAGS if any 
 ADDITIONAL_CFLAGS = 
 
+# Libraries the applications are linked with in addition to exip
+# zlib is required when COMPRESSION_USE is ON in exipConfig.h,
+# pthread when COMPRESSION_THREAD_USE is ON and for the unit tests
+ADDITIONAL_LIBS = -lz -lpthread
+
 # Whether to include the grammar generation module in the build
 INCLUDE_GRAMMAR_GENERATION = true
 
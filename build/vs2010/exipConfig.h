@@ -73,6 +73,32 @@
 #define EXIP_REALLOC realloc
 #define EXIP_MFREE free
 
+/** @def MEM_ARENA_USE
+ * 		Whether the managed memory of a stream (memManagedAllocate()) is carved out of
+ * 		geometrically growing chunks instead of being allocated one block at a time
+ * 	@def MEM_ARENA_CHUNK_SIZE
+ * 		The size in bytes of the first chunk; each following chunk is twice as big
+ * 	@def MEM_ARENA_MAX_CHUNK_SIZE
+ * 		The size in bytes at which the chunks stop growing
+ */
+#define MEM_ARENA_USE ON
+#define MEM_ARENA_CHUNK_SIZE 4096
+#define MEM_ARENA_MAX_CHUNK_SIZE 1048576
+
+/** @def GRAMMAR_STACK_MAX_DEPTH
+ * 		The maximum element nesting depth of the documents. With 0 the grammar stack is
+ * 		allocated on the heap and grows as needed; otherwise it is an array of that many
+ * 		nodes in the EXIStream and no heap memory is used for it
+ */
+#define GRAMMAR_STACK_MAX_DEPTH 0
+
+/** @def PACKED_GRAMMAR_USE
+ * 		Whether the grammar productions use the compact layout, with the type and qname
+ * 		indices stored in the EXIP_PROD_TYPE_INDEX, EXIP_PROD_URI_INDEX and EXIP_PROD_LN_INDEX
+ * 		types (uint16_t by default): 12 instead of 32 bytes per production on 64-bit platforms
+ */
+#define PACKED_GRAMMAR_USE OFF
+
 //Use MSVS equivalent for strtoll
 #define EXIP_STRTOLL _strtoi64
 
@@ -82,14 +108,69 @@
  * 		The initial capacity of the hash tables
  * 	@def MAX_HASH_TABLE_SIZE
  * 		The maximum capacity of the hash tables
+ * 	@def OPEN_HASH_TABLE_USE
+ * 		Whether the hash tables use open addressing (openHashtable.c) instead of
+ * 		chaining (hashtable.c). The open addressing tables do not allocate memory per entry.
  */
 #define HASH_TABLE_USE ON
 #define INITIAL_HASH_TABLE_SIZE 6151
 #define MAX_HASH_TABLE_SIZE 32000
+#define OPEN_HASH_TABLE_USE ON
+
+/** @def STRING_TABLE_INDEX_USE
+ * 		Whether to index the URI, local-name, prefix and value cross tables with hash
+ * 		tables for the string lookups of the encoder
+ * 	@def STRING_TABLE_INDEX_THRESHOLD
+ * 		The number of entries at which the index of a table is built
+ */
+#define STRING_TABLE_INDEX_USE ON
+#define STRING_TABLE_INDEX_THRESHOLD 16
+
+/** @def PRODUCTION_INDEX_USE
+ * 		Whether the encoder finds the first-level productions of the schema-informed
+ * 		grammar rules through a hash index built when the schema is loaded
+ * 	@def PRODUCTION_INDEX_THRESHOLD
+ * 		The number of productions from which a grammar rule is indexed
+ */
+#define PRODUCTION_INDEX_USE ON
+#define PRODUCTION_INDEX_THRESHOLD 8
+
+/**
+ * Whether the decoded binary values (base64Binary and hexBinary) are passed to the
+ * ContentHandler straight from the input buffer when they are byte-aligned, or from
+ * a buffer reused for the whole stream otherwise, instead of a new allocation per value. */
+#define BINARY_ZERO_COPY_USE ON
+
+/** @def COMPRESSION_USE
+ * 		Whether the compression and pre-compression alignment options are supported:
+ * 		the EXI body is split into blocks of structure and value channels and, for
+ * 		compression, the channels are DEFLATE-compressed with zlib (link with -lz)
+ * 		The zlib library is not part of the project files, hence OFF by default
+ * 	@def COMPRESSION_LEVEL
+ * 		The zlib compression level (0-9) of the DEFLATE streams; -1 for the zlib default
+ */
+#define COMPRESSION_USE OFF
+#define COMPRESSION_LEVEL -1
+
+/** Inflating on a separate thread needs POSIX threads */
+#define COMPRESSION_THREAD_USE OFF
+
+/** Locking the schema registry needs POSIX threads */
+#define SCHEMA_REGISTRY_THREAD_USE OFF
 
 /** Whether to use dynamic arrays */
 #define DYN_ARRAY_USE ON
 
+/**
+ * Whether the stream reader and writer access the EXI buffer one 64-bit word at a time
+ * instead of byte by byte. Turn OFF on 8/16-bit targets where 64-bit shifts are expensive. */
+#define STREAM_WORD_IO_USE ON
+
+/**
+ * Whether the strings are UTF-8 encoded (UTF8_stringManipulate.c) instead of
+ * ASCII (ASCII_stringManipulate.c). String.length is the number of characters in both cases. */
+#define STRING_UTF8_USE OFF
+
 // NOTE: The GR_VOID_NON_TERMINAL should be set to the maximum 24 bit unsigned value in case the
 // SMALL_INDEX_MAX is 32 bits or bigger
 #define GR_VOID_NON_TERMINAL 0xFFFFFF
@@ -21,6 +21,97 @@
 
 #include "contentHandler.h"
 
+/**
+ * @name The kinds of the events decoded by parseNextBatch()
+ */
+/**@{*/
+#define EXI_EVENT_END_DOCUMENT    0
+#define EXI_EVENT_START_ELEMENT   1
+#define EXI_EVENT_END_ELEMENT     2
+#define EXI_EVENT_ATTRIBUTE       3
+#define EXI_EVENT_NAMESPACE       4
+#define EXI_EVENT_SELF_CONTAINED  5
+#define EXI_EVENT_INT             6
+#define EXI_EVENT_BOOLEAN         7
+#define EXI_EVENT_STRING          8
+#define EXI_EVENT_FLOAT           9
+#define EXI_EVENT_BINARY         10
+#define EXI_EVENT_DATE_TIME      11
+#define EXI_EVENT_DECIMAL        12
+#define EXI_EVENT_LIST           13
+/** The value of xsi:type */
+#define EXI_EVENT_QNAME          14
+/**@}*/
+
+/** The value of an xsi:type attribute: EXI_EVENT_QNAME */
+struct EXIQNameValue
+{
+	String uri;
+	String localName;
+	/** Empty when hasPrefix is FALSE */
+	String prefix;
+	boolean hasPrefix;
+};
+
+typedef struct EXIQNameValue EXIQNameValue;
+
+/** A namespace declaration: EXI_EVENT_NAMESPACE */
+struct EXINamespace
+{
+	String ns;
+	String prefix;
+	boolean isLocal;
+};
+
+typedef struct EXINamespace EXINamespace;
+
+/**
+ * An event decoded by parseNextBatch(): the arguments of the
+ * corresponding ContentHandler callback. The record is kept small: the URI and
+ * the local name of an element or attribute are given by qnameId (@see getQNameStrings())
+ * and the rare events whose arguments do not fit are pointers to them.
+ * The strings and the pointed arguments stay valid until the next call to
+ * parseNextBatch(), resetParser() or destroyParser().
+ */
+struct EXIEvent
+{
+	/** One of EXI_EVENT_* */
+	unsigned char kind;
+	/** The element of EXI_EVENT_START_ELEMENT and EXI_EVENT_END_ELEMENT, the attribute of
+	 * EXI_EVENT_ATTRIBUTE and the element or attribute of a value (including a list
+	 * and its items); {URI_MAX, LN_MAX} for the other events */
+	QNameID qnameId;
+	union
+	{
+		/** EXI_EVENT_START_ELEMENT and EXI_EVENT_ATTRIBUTE: prefix.str is NULL without a prefix */
+		String prefix;
+		const EXIQNameValue* qname;
+		const EXINamespace* ns;
+		Integer intVal;
+		boolean boolVal;
+		String strVal;
+		Float floatVal;
+		struct
+		{
+			const char* val;
+			Index nbytes;
+		} binary;
+		const EXIPDateTime* dtVal;
+		Decimal decVal;
+		/** Followed by the itemCount events of the items */
+		struct
+		{
+			EXITypeClass exiType;
+			unsigned int itemCount;
+		} list;
+	} data;
+};
+
+typedef struct EXIEvent EXIEvent;
+
+/** The state of parseNextBatch(); allocated by its first call */
+typedef struct eventBatch EventBatch;
+
 /**
  * Parses an EXI document.
  */
@@ -31,6 +122,17 @@ struct Parser
 	/** Function pointers for document events. */
 	ContentHandler handler;
 	void* app_data;
+	/** NULL until parseNextBatch() is used */
+	EventBatch* batch;
+	/** The registry of the schemas bound by parseHeader(); NULL by default,
+	 * set by the application after initParser() */
+	SchemaRegistry* registry;
+	/** Called with the app_data of the stream once the parser no longer reads its
+	 * input stream, which the application can then close; NULL by default, set by
+	 * the application after initParser(). It is called by destroyParser() and
+	 * resetParser() or, with COMPRESSION_THREAD_USE, by the inflate thread when its
+	 * read in progress returns after them (@see resetParser()) */
+	void (*inputReleased)(void* app_data);
 };
 
 typedef struct Parser Parser;
@@ -43,6 +145,9 @@ struct EXIParser
 	errorCode (*parseNext)(Parser* parser);
 	errorCode (*pushEXIData)(char* inBuf, unsigned int bufSize, unsigned int* bytesRead, Parser* parser);
 	void (*destroyParser)(Parser* parser);
+	errorCode (*resetParser)(Parser* parser, BinaryBuffer buffer, void* app_data);
+	errorCode (*parseNextBatch)(Parser* parser, EXIEvent* events, Index size, Index* count);
+	errorCode (*getQNameStrings)(Parser* parser, QNameID qnameId, String* uri, String* localName);
 };
 
 typedef struct EXIParser EXIParser;
@@ -64,10 +169,15 @@ errorCode initParser(Parser* parser, BinaryBuffer buffer, void* app_data);
 
 /**
  * @brief Parse the header on the EXI stream contained in the parser object
+ * When parser->registry is set, the schema is bound as by setSchema() unless the
+ * schemaId option is absent: the schema of parser.strm.header.opts.schemaID is
+ * acquired from the registry when it is set. setSchema() is then called by the
+ * application only when parser.strm.header.opts.schemaIDMode == SCHEMA_ID_ABSENT
  * @param[in] parser the parser object
  * @param[in] outOfBandOpts TRUE if there are out-of-band options set in parser->strm.header
  * FALSE otherwise
- * @return Error handling code
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when the schemaId
+ * is not in the registry
  */
 errorCode parseHeader(Parser* parser, boolean outOfBandOpts);
 
@@ -79,7 +189,10 @@ errorCode parseHeader(Parser* parser, boolean outOfBandOpts);
  * if parser.strm.header.opts.schemaIDMode == SCHEMA_ID_ABSENT and schema == NULL then
  * schema-less mode, schema != NULL schema enabled;
  * if parser.strm.header.opts.schemaIDMode == SCHEMA_ID_SET and schema == NULL is an error
- * parser.strm.header.opts.schemaID contains the identifier of the schema if any
+ * parser.strm.header.opts.schemaID contains the identifier of the schema if any.
+ * The schema is not modified by the parsing: the string table entries and the built-in
+ * grammars of the stream are kept in the parser object, so one schema object can be used
+ * by parsers and serializers running concurrently on different threads
  *
  * @return Error handling code
  */
@@ -97,6 +210,45 @@ errorCode setSchema(Parser* parser, EXIPSchema* schema);
  */
 errorCode parseNext(Parser* parser);
 
+/**
+ * @brief Decodes the next events of the EXI stream into an array instead of
+ * invoking the callbacks of parser->handler
+ *
+ * Decodes up to size events into events. The events of a production (e.g. an
+ * attribute and its value, or a list and its items) that do not fit in the array are
+ * kept in the parser and are the first events of the next call. The strings of the
+ * events (including the binary values) are copied by the parser and stay valid until
+ * the next call. A stream is parsed either with parseNext() or with parseNextBatch().
+ * The startDocument callback of parser->handler is still invoked by parseHeader().
+ *
+ * @param[in, out] parser the parser object
+ * @param[out] events the array receiving the events
+ * @param[in] size the number of entries of events; at least 1
+ * @param[out] count the number of events stored in events
+ *
+ * @return Error handling code; EXIP_OK when the array is full, EXIP_PARSING_COMPLETE when
+ * the last stored event is the end of the document and EXIP_BUFFER_END_REACHED when the
+ * content of the buffer is parsed (the events of the completed productions are stored),
+ * in which case pushEXIData() is used before calling parseNextBatch() again
+ */
+errorCode parseNextBatch(Parser* parser, EXIEvent* events, Index size, Index* count);
+
+/**
+ * @brief Returns the URI and the local name of a qname in the string tables of the
+ * stream, e.g. the qnameId of an EXIEvent
+ *
+ * The strings are views into the string tables that stay valid until resetParser()
+ * or destroyParser().
+ *
+ * @param[in] parser the parser object
+ * @param[in] qnameId the ids of the URI and of the local name
+ * @param[out] uri the URI
+ * @param[out] localName the local name
+ * @return Error handling code - EXIP_OUT_OF_BOUND_BUFFER when qnameId is not in the
+ * string tables (e.g. {URI_MAX, LN_MAX})
+ */
+errorCode getQNameStrings(Parser* parser, QNameID qnameId, String* uri, String* localName);
+
 /**
  * @brief Pushes more data to the parsing buffer to parse
  *
@@ -107,7 +259,8 @@ errorCode parseNext(Parser* parser);
  * schema mode without any deviations. Otherwise the grammars and
  * the string tables needs also to be backuped and then restored
  * in case of EXIP_BUFFER_END_REACHED which is very complicated
- * procedure.
+ * procedure. Not supported with the compression and pre-compression
+ * alignments (see checkNonBlockingOptions()).
  *
  * @warning Padding bits to fill a byte when in bit-packed mode
  * should not be used as they will be interpreted as if being part
@@ -120,14 +273,36 @@ errorCode parseNext(Parser* parser);
  * to the Parser internal binary buffer.
  * @param[in, out] parser the parser object
  *
- * @return Error handling code
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION with the compression
+ * and pre-compression alignments
  */
 errorCode pushEXIData(char* inBuf, unsigned int bufSize, unsigned int* bytesRead, Parser* parser);
 
 /**
  * @brief Free any memroy allocated by parser object
+ * parser->inputReleased is called once the input stream is no longer read
+ * (@see resetParser())
  * @param[in] parser the parser object
  */
 void destroyParser(Parser* parser);
 
+/**
+ * @brief Prepares a parser object for parsing the next EXI stream
+ *
+ * Equivalent to destroyParser() followed by initParser() except that the
+ * memory managed by the parser is kept for reuse when MEM_ARENA_USE is ON.
+ * The content handler callbacks, inputReleased and the registry are preserved. With
+ * COMPRESSION_THREAD_USE the inflate thread of the previous stream does not read its input
+ * stream once resetParser() (and destroyParser()) returns. A read already in progress is not
+ * waited for: the input stream must stay valid until it returns, and the octets it reads are
+ * dropped. parser->inputReleased is then called by the inflate thread when the read returns,
+ * so that the application knows when it can close the input stream.
+ *
+ * @param[in, out] parser the parser object
+ * @param[in] buffer an input buffer holding (part of) the representation of EXI stream
+ * @param[in] app_data Application data to be passed to the content handler callbacks
+ * @return Error handling code
+ */
+errorCode resetParser(Parser* parser, BinaryBuffer buffer, void* app_data);
+
 #endif /* EXIPARSER_H_ */
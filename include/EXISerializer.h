@@ -29,6 +29,8 @@ struct EXISerializer
 	errorCode (*startElement)(EXIStream* strm, QName qname, EXITypeClass* valueType);
 	errorCode (*endElement)(EXIStream* strm);
 	errorCode (*attribute)(EXIStream* strm, QName qname, boolean isSchemaType, EXITypeClass* valueType);
+	errorCode (*startElementH)(EXIStream* strm, const QNameHandle* handle, EXITypeClass* valueType);
+	errorCode (*attributeH)(EXIStream* strm, const QNameHandle* handle, boolean isSchemaType, EXITypeClass* valueType);
 
 	// For handling the data
 	errorCode (*intData)(EXIStream* strm, Integer int_val);
@@ -40,6 +42,12 @@ struct EXISerializer
 	errorCode (*decimalData)(EXIStream* strm, Decimal dec_val);
 	errorCode (*listData)(EXIStream* strm, unsigned int itemCount);
 	errorCode (*qnameData)(EXIStream* strm, QName qname); // xsi:type value only
+	errorCode (*stringDataBegin)(EXIStream* strm, Index length);
+	errorCode (*stringDataChunk)(EXIStream* strm, const String chunk);
+	errorCode (*stringDataEnd)(EXIStream* strm);
+	errorCode (*binaryDataBegin)(EXIStream* strm, Index nbytes);
+	errorCode (*binaryDataChunk)(EXIStream* strm, const char* chunk, Index size);
+	errorCode (*binaryDataEnd)(EXIStream* strm);
 
 	// Miscellaneous
 	errorCode (*processingInstruction)(EXIStream* strm); // TODO: define the parameters!
@@ -52,8 +60,10 @@ struct EXISerializer
 	// EXIP specific
 	void (*initHeader)(EXIStream* strm);
 	errorCode (*initStream)(EXIStream* strm, BinaryBuffer buffer, EXIPSchema* schema);
+	errorCode (*initStreamSchemaId)(EXIStream* strm, BinaryBuffer buffer, SchemaRegistry* registry, const String* schemaId);
 	errorCode (*closeEXIStream)(EXIStream* strm);
 	errorCode (*flushEXIData)(EXIStream* strm, char* outBuf, unsigned int bufSize, unsigned int* bytesFlush);
+	errorCode (*resolveQNameHandle)(const EXIPSchema* schema, QName qname, QNameHandle* handle);
 };
 
 typedef struct EXISerializer EXISerializer;
@@ -122,6 +132,29 @@ errorCode endElement(EXIStream* strm);
  */
 errorCode attribute(EXIStream* strm, QName qname, boolean isSchemaType, EXITypeClass* valueType);
 
+/**
+ * @brief startElement() with a qname resolved by resolveQNameHandle(): the production
+ * and the string table entries of the qname are found without comparing strings.
+ * Falls back to startElement() when the qname is not in the string tables of the schema
+ * or the handle is resolved against another schema than the one of the stream
+ * @param[in, out] strm EXI stream object
+ * @param[in] handle the resolved qualified name of the element
+ * @param[out] valueType as for startElement()
+ * @return Error handling code
+ */
+errorCode startElementH(EXIStream* strm, const QNameHandle* handle, EXITypeClass* valueType);
+
+/**
+ * @brief attribute() with a qname resolved by resolveQNameHandle(). Falls back to attribute()
+ * as startElementH() falls back to startElement()
+ * @param[in, out] strm EXI stream object
+ * @param[in] handle the resolved qualified name of the attribute
+ * @param[in] isSchemaType as for attribute()
+ * @param[out] valueType as for attribute()
+ * @return Error handling code
+ */
+errorCode attributeH(EXIStream* strm, const QNameHandle* handle, boolean isSchemaType, EXITypeClass* valueType);
+
 // For handling the data
 
 /**
@@ -153,6 +186,38 @@ errorCode booleanData(EXIStream* strm, boolean bool_val);
  */
 errorCode stringData(EXIStream* strm, const String str_val);
 
+/**
+ * @brief Starts encoding a string value for element or attribute in chunks
+ * The characters of the value are then passed with stringDataChunk() and the value
+ * is completed with stringDataEnd(). Only the values that do not enter the value
+ * partitions can be serialized this way, i.e. when length is 0, length is bigger than
+ * the valueMaxLength option or the valuePartitionCapacity option is 0.
+ *
+ * @param[in, out] strm EXI stream object
+ * @param[in] length the number of characters in the whole value
+ * @return Error handling code; EXIP_INVALID_EXIP_CONFIGURATION when the value would
+ * enter the value partitions
+ */
+errorCode stringDataBegin(EXIStream* strm, Index length);
+
+/**
+ * @brief Encodes the next characters of a string value started with stringDataBegin()
+ *
+ * @param[in, out] strm EXI stream object
+ * @param[in] chunk the next characters of the value
+ * @return Error handling code
+ */
+errorCode stringDataChunk(EXIStream* strm, const String chunk);
+
+/**
+ * @brief Completes a string value started with stringDataBegin()
+ *
+ * @param[in, out] strm EXI stream object
+ * @return Error handling code; EXIP_INCONSISTENT_PROC_STATE when fewer characters
+ * than announced were passed
+ */
+errorCode stringDataEnd(EXIStream* strm);
+
 /**
  * @brief Encodes float data for element or attribute
  *
@@ -174,6 +239,37 @@ errorCode floatData(EXIStream* strm, Float float_val);
  */
 errorCode binaryData(EXIStream* strm, const char* binary_val, Index nbytes);
 
+/**
+ * @brief Starts encoding binary data for element or attribute in chunks
+ * The octets of the value are then passed with binaryDataChunk() and the value
+ * is completed with binaryDataEnd(), so that a large value never has to be in memory as a whole.
+ *
+ * @param[in, out] strm EXI stream object
+ * @param[in] nbytes number of bytes in the whole value
+ * @return Error handling code
+ * @note Use in schema mode only!
+ */
+errorCode binaryDataBegin(EXIStream* strm, Index nbytes);
+
+/**
+ * @brief Encodes the next octets of a binary value started with binaryDataBegin()
+ *
+ * @param[in, out] strm EXI stream object
+ * @param[in] chunk the next octets of the value
+ * @param[in] size number of bytes in chunk
+ * @return Error handling code
+ */
+errorCode binaryDataChunk(EXIStream* strm, const char* chunk, Index size);
+
+/**
+ * @brief Completes a binary value started with binaryDataBegin()
+ *
+ * @param[in, out] strm EXI stream object
+ * @return Error handling code; EXIP_INCONSISTENT_PROC_STATE when fewer octets
+ * than announced were passed
+ */
+errorCode binaryDataEnd(EXIStream* strm);
+
 /**
  * @brief Encodes dateTime data for element or attribute
  *
@@ -262,13 +358,29 @@ void initHeader(EXIStream* strm);
  *
  * @param[in, out] strm EXI stream
  * @param[in, out] buffer output buffer for storing the encoded EXI stream
- * @param[in] schema a compiled schema information to be used for schema enabled processing, NULL if no schema is available
+ * @param[in] schema a compiled schema information to be used for schema enabled processing, NULL if no schema is available.
+ * The schema is not modified by the stream and can be shared by streams processed concurrently
  * @return Error handling code
  */
 errorCode initStream(EXIStream* strm, BinaryBuffer buffer, EXIPSchema *schema);
 
+/**
+ * @brief initStream() with the schema of a schemaId acquired from a schema registry
+ * (see schemaRegistry.h). The header includes the options, with the schemaId option
+ * set to schemaId (strm->header.opts.schemaIDMode == SCHEMA_ID_SET), and the schema
+ * is released by closeEXIStream()
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in, out] buffer output buffer for storing the encoded EXI stream
+ * @param[in, out] registry the registry of the schema
+ * @param[in] schemaId the schemaId of the schema
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when schemaId is not in the registry
+ */
+errorCode initStreamSchemaId(EXIStream* strm, BinaryBuffer buffer, SchemaRegistry* registry, const String* schemaId);
+
 /**
  * @brief Destroy an EXI stream object releasing all the allocated memory for it
+ * and the schema acquired by initStreamSchemaId()
  *
  * @param[in, out] strm EXI stream object
  * @return Error handling code
@@ -299,16 +411,32 @@ errorCode closeEXIStream(EXIStream* strm);
  * This non-blocking buffer flushing works only in EXI
  * schema mode without any deviations. Otherwise the grammars and
  * the string tables needs also to be backuped before each call of
- * serialize.*() and then restored in case of EXIP_BUFFER_END_REACHED
+ * serialize.*() and then restored in case of EXIP_BUFFER_END_REACHED.
+ * Not supported with the compression and pre-compression alignments
+ * (see checkNonBlockingOptions()); use an output stream instead.
  *
  * @param[in, out] strm EXI stream object
  * @param[out] outBuf the next EXI stream chunk to be parsed
  * @param[in] bufSize the size in bytes of the inBuf
  * @param[out] bytesFlush bytes written to the outBuf
- * @return Error handling code
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION with the compression
+ * and pre-compression alignments
  */
 errorCode flushEXIData(EXIStream* strm, char* outBuf, unsigned int bufSize, unsigned int* bytesFlush);
 
+/**
+ * @brief Resolves the qname of an element or attribute against the string tables of a schema
+ * once, for any number of startElementH() and attributeH() calls on the streams using that schema.
+ * The schema is not modified. A qname that is not in the schema gets a handle as well;
+ * startElementH() and attributeH() then take the path of startElement() and attribute()
+ *
+ * @param[in] schema the schema of the streams; NULL for schema-less streams
+ * @param[in] qname the qname; its strings must outlive the handle
+ * @param[out] handle the resolved qname
+ * @return Error handling code
+ */
+errorCode resolveQNameHandle(const EXIPSchema* schema, QName qname, QNameHandle* handle);
+
 /****  END: Serializer API implementation  ****/
 
 
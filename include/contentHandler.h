@@ -45,6 +45,20 @@ struct ContentHandler
 	errorCode (*listData)(EXITypeClass exiType, unsigned int itemCount, void* app_data);
 	errorCode (*qnameData)(const QName qname, void* app_data); // xsi:type value only
 
+	// For handling very large data in pieces. When binaryDataChunk is set, all binary values are
+	// delivered with binaryDataBegin/binaryDataChunk/binaryDataEnd instead of binaryData.
+	// When stringDataChunk is set, the same holds for the string values and stringData; only the
+	// values that do not enter the value partitions (longer than valueMaxLength or
+	// valuePartitionCapacity == 0) are decoded piece by piece, the others are delivered in one chunk.
+	// Not supported by the non-blocking parsing with pushEXIData(). With the compression and
+	// pre-compression alignments every value is delivered in one chunk.
+	errorCode (*binaryDataBegin)(Index nbytes, void* app_data);
+	errorCode (*binaryDataChunk)(const char* chunk, Index size, void* app_data);
+	errorCode (*binaryDataEnd)(void* app_data);
+	errorCode (*stringDataBegin)(Index length, void* app_data);
+	errorCode (*stringDataChunk)(const String chunk, void* app_data);
+	errorCode (*stringDataEnd)(void* app_data);
+
 	// Miscellaneous
 	errorCode (*processingInstruction)(void* app_data); // TODO: define the parameters!
 	errorCode (*namespaceDeclaration)(const String ns, const String prefix, boolean isLocalElementNS, void* app_data);
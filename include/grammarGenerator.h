@@ -81,6 +81,25 @@ errorCode loadSchemaHandler(String* namespace, String* schemaLocation, BinaryBuf
 errorCode generateSchemaInformedGrammars(BinaryBuffer* buffers, unsigned int bufCount, SchemaFormat schemaFormat, EXIOptions* opt, EXIPSchema* schema,
 		errorCode (*loadSchemaHandler) (String* namespace, String* schemaLocation, BinaryBuffer** buffers, unsigned int* bufCount, SchemaFormat* schemaFormat, EXIOptions** opt));
 
+/**
+ * @brief Registers XML schema definitions in a schema registry (see schemaRegistry.h):
+ * the schema of schemaId is generated by generateSchemaInformedGrammars() when it is
+ * first acquired and freed by destroySchema() when the registry unloads it
+ *
+ * @param[in, out] registry the registry
+ * @param[in] schemaId the schemaId of the schema; copied by the registry
+ * @param[in] buffers an array of input buffers, each holding a whole schema file; the
+ * bufContent bytes of the buffers are copied (their ioStrm are not used)
+ * @param[in] bufCount the number of buffers in the array
+ * @param[in] schemaFormat as in generateSchemaInformedGrammars()
+ * @param[in] opt as in generateSchemaInformedGrammars(); copied
+ * @param[in] loadSchemaHandler as in generateSchemaInformedGrammars(); called on the generation
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when schemaId is empty or already registered
+ */
+errorCode registerSchemaDefinitions(SchemaRegistry* registry, const String* schemaId, BinaryBuffer* buffers, unsigned int bufCount,
+		SchemaFormat schemaFormat, EXIOptions* opt,
+		errorCode (*loadSchemaHandler) (String* namespace, String* schemaLocation, BinaryBuffer** buffers, unsigned int* bufCount, SchemaFormat* schemaFormat, EXIOptions** opt));
+
 /**
  * @brief Frees all the memory allocated by an EXIPSchema object
  * @param[in] schema the schema containing the EXI grammars to be freed
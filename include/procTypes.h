@@ -286,12 +286,123 @@ typedef EXIP_SMALL_INDEX SmallIndex;
 /**
  * Defines the encoding used for characters.
  * It is dependent on the implementation of the stringManipulate.h functions
- * The default is ASCII characters (ASCII_stringManipulate.c)
+ * The default is ASCII characters (ASCII_stringManipulate.c). When STRING_UTF8_USE
+ * is ON the characters are UTF-8 encoded (UTF8_stringManipulate.c)
  */
 #ifndef CHAR_TYPE
 # define CHAR_TYPE char
 #endif
 
+#ifndef STRING_UTF8_USE
+# define STRING_UTF8_USE OFF
+#endif
+
+#ifndef STRING_TABLE_INDEX_USE
+# define STRING_TABLE_INDEX_USE OFF
+#endif
+
+#ifndef OPEN_HASH_TABLE_USE
+# define OPEN_HASH_TABLE_USE OFF
+#endif
+
+#ifndef PRODUCTION_INDEX_USE
+# define PRODUCTION_INDEX_USE OFF
+#endif
+
+/**
+ * The number of productions at which the first-level productions
+ * of a schema-informed grammar rule are looked up in the production index
+ */
+#ifndef PRODUCTION_INDEX_THRESHOLD
+# define PRODUCTION_INDEX_THRESHOLD 8
+#endif
+
+#ifndef BINARY_ZERO_COPY_USE
+# define BINARY_ZERO_COPY_USE OFF
+#endif
+
+/**
+ * The number of octets or characters in the pieces of the binary and string values
+ * delivered through the chunked ContentHandler callbacks
+ */
+#ifndef VALUE_CHUNK_SIZE
+# define VALUE_CHUNK_SIZE 1024
+#endif
+
+#ifndef MEM_ARENA_USE
+# define MEM_ARENA_USE OFF
+#endif
+
+#ifndef COMPRESSION_USE
+# define COMPRESSION_USE OFF
+#endif
+
+/**
+ * The zlib compression level of the DEFLATE streams when the
+ * compression option is set (Z_DEFAULT_COMPRESSION)
+ */
+#ifndef COMPRESSION_LEVEL
+# define COMPRESSION_LEVEL -1
+#endif
+
+#ifndef COMPRESSION_THREAD_USE
+# define COMPRESSION_THREAD_USE OFF
+#endif
+
+/**
+ * The number of DEFLATE streams the inflate thread
+ * decompresses ahead of the parser when COMPRESSION_THREAD_USE is ON
+ */
+#ifndef COMPRESSION_THREAD_QUEUE_SIZE
+# define COMPRESSION_THREAD_QUEUE_SIZE 4
+#endif
+
+#ifndef SCHEMA_REGISTRY_THREAD_USE
+# define SCHEMA_REGISTRY_THREAD_USE OFF
+#endif
+
+#ifndef MEM_ARENA_CHUNK_SIZE
+# define MEM_ARENA_CHUNK_SIZE 4096
+#endif
+
+/**
+ * The maximum element nesting depth of the documents. 0 for no limit: the grammar
+ * stack of a stream is then allocated on the heap and grown as needed; otherwise it
+ * is an array of GRAMMAR_STACK_MAX_DEPTH nodes in the EXIStream (no heap use) and
+ * a deeper document is rejected with EXIP_OUT_OF_BOUND_BUFFER
+ */
+#ifndef GRAMMAR_STACK_MAX_DEPTH
+# define GRAMMAR_STACK_MAX_DEPTH 0
+#endif
+
+/**
+ * Whether the grammar productions and rules use the compact layout:
+ * the type and qname indices of the productions are stored in the
+ * EXIP_PROD_TYPE_INDEX, EXIP_PROD_URI_INDEX and EXIP_PROD_LN_INDEX
+ * unsigned types and the production counts of the rules in uint32_t.
+ * A schema or a built-in grammar whose indices do not fit these types
+ * is rejected with EXIP_OUT_OF_BOUND_BUFFER
+ */
+#ifndef PACKED_GRAMMAR_USE
+# define PACKED_GRAMMAR_USE OFF
+#endif
+
+#ifndef EXIP_PROD_TYPE_INDEX
+# define EXIP_PROD_TYPE_INDEX uint16_t
+#endif
+
+#ifndef EXIP_PROD_URI_INDEX
+# define EXIP_PROD_URI_INDEX uint16_t
+#endif
+
+#ifndef EXIP_PROD_LN_INDEX
+# define EXIP_PROD_LN_INDEX uint16_t
+#endif
+
+#ifndef MEM_ARENA_MAX_CHUNK_SIZE
+# define MEM_ARENA_MAX_CHUNK_SIZE 1048576
+#endif
+
 typedef CHAR_TYPE CharType;
 
 
@@ -306,6 +417,7 @@ typedef CHAR_TYPE CharType;
 struct StringType
 {
 	CharType* str;
+	/** The number of UCS characters; the number of CharType units when they are ASCII */
 	Index length;
 };
 
@@ -351,6 +463,25 @@ typedef struct QNameID QNameID;
  */
 /**@{*/
 
+#if MEM_ARENA_USE
+/** A chunk of arena memory. The allocations are carved out of the
+ * bytes following the (alignment padded) header */
+struct arenaChunk {
+	struct arenaChunk* nextChunk;
+	/** The number of bytes available for allocations */
+	size_t size;
+};
+
+/** A list of arena chunks.
+ * Pass to initAllocList() before use. */
+struct allocList {
+	struct arenaChunk* firstChunk;
+	/** The chunk from which the allocations are currently made */
+	struct arenaChunk* currChunk;
+	/** The number of bytes of the currChunk already allocated */
+	size_t used;
+};
+#else
 /** @note Should not be bigger than SMALL_INDEX_MAX - 1 */
 #define ALLOCATION_ARRAY_SIZE 100
 
@@ -368,6 +499,7 @@ struct allocList {
 	/** The next allocation slot in the allocation array of the lastBlock */
 	SmallIndex currAllocSlot;
 };
+#endif
 
 typedef struct allocList AllocList;
 
@@ -392,8 +524,6 @@ struct dynArray {
 	/**
 	 * The initial size of the dynamic array (in number of entries), 
 	 * also the chunk of number of entries to be added each expansion time.
-	 * This field holds the initial size of the url and local name
-	 * partitions in the EXIPSchema object.
 	 */
 	Index chunkEntries;
 
@@ -581,6 +711,61 @@ typedef enum EXITypeClass EXITypeClass;
 #define GET_PROD_NON_TERM(content) (content & PROD_CONTENT_MASK)
 #define SET_PROD_NON_TERM(content, nt) (content = (content & ~PROD_CONTENT_MASK) | (nt & PROD_CONTENT_MASK))
 
+#if PACKED_GRAMMAR_USE
+typedef EXIP_PROD_TYPE_INDEX ProdTypeIndex;
+typedef EXIP_PROD_URI_INDEX ProdUriIndex;
+typedef EXIP_PROD_LN_INDEX ProdLnIndex;
+typedef uint32_t ProdCount;
+
+/** The position of a qname in the string tables, as stored in a Production */
+struct ProdQNameID {
+	ProdUriIndex uriId;
+	ProdLnIndex lnId;
+};
+
+typedef struct ProdQNameID ProdQNameID;
+
+/** The all-ones values of the compact production indices stand for INDEX_MAX, URI_MAX and LN_MAX */
+# define PROD_TYPE_ID_MAX ((ProdTypeIndex) ~((ProdTypeIndex) 0))
+# define PROD_URI_ID_MAX ((ProdUriIndex) ~((ProdUriIndex) 0))
+# define PROD_LN_ID_MAX ((ProdLnIndex) ~((ProdLnIndex) 0))
+
+# define GET_PROD_TYPE_ID(prod) ((prod)->typeId == PROD_TYPE_ID_MAX ? INDEX_MAX : (Index) (prod)->typeId)
+# define GET_PROD_URI_ID(prod) ((prod)->qnameId.uriId == PROD_URI_ID_MAX ? URI_MAX : (SmallIndex) (prod)->qnameId.uriId)
+# define GET_PROD_LN_ID(prod) ((prod)->qnameId.lnId == PROD_LN_ID_MAX ? LN_MAX : (Index) (prod)->qnameId.lnId)
+# define SET_PROD_TYPE_ID(prod, id) ((prod)->typeId = (ProdTypeIndex) (id))
+# define SET_PROD_URI_ID(prod, id) ((prod)->qnameId.uriId = (ProdUriIndex) (id))
+# define SET_PROD_LN_ID(prod, id) ((prod)->qnameId.lnId = (ProdLnIndex) (id))
+
+/** Whether the type and qname indices can be stored in a compact production */
+# define PROD_IDS_FIT(typeId, qnameID) (((typeId) == INDEX_MAX || (typeId) < PROD_TYPE_ID_MAX) && \
+		((qnameID).uriId == URI_MAX || (qnameID).uriId < PROD_URI_ID_MAX) && \
+		((qnameID).lnId == LN_MAX || (qnameID).lnId < PROD_LN_ID_MAX))
+#else
+typedef Index ProdTypeIndex;
+typedef SmallIndex ProdUriIndex;
+typedef Index ProdLnIndex;
+typedef Index ProdCount;
+typedef QNameID ProdQNameID;
+
+# define PROD_TYPE_ID_MAX INDEX_MAX
+# define PROD_URI_ID_MAX URI_MAX
+# define PROD_LN_ID_MAX LN_MAX
+
+# define GET_PROD_TYPE_ID(prod) ((prod)->typeId)
+# define GET_PROD_URI_ID(prod) ((prod)->qnameId.uriId)
+# define GET_PROD_LN_ID(prod) ((prod)->qnameId.lnId)
+# define SET_PROD_TYPE_ID(prod, id) ((prod)->typeId = (id))
+# define SET_PROD_URI_ID(prod, id) ((prod)->qnameId.uriId = (id))
+# define SET_PROD_LN_ID(prod, id) ((prod)->qnameId.lnId = (id))
+
+# define PROD_IDS_FIT(typeId, qnameID) TRUE
+#endif
+
+/** Stores the qname of the production prod in the QNameID qnameID */
+#define GET_PROD_QNAME_ID(prod, qnameID) ((qnameID).uriId = GET_PROD_URI_ID(prod), (qnameID).lnId = GET_PROD_LN_ID(prod))
+#define SET_PROD_QNAME_ID(prod, qnameID) (SET_PROD_URI_ID(prod, (qnameID).uriId), SET_PROD_LN_ID(prod, (qnameID).lnId))
+
 /** Specifies the right-hand side for a production rule.
  * The left-hand side is implicitly defined by the
  * parent grammar rule. */
@@ -601,14 +786,16 @@ struct Production
 	 *   Processes the content of the SE(qname) event.</li>
 	 *   <li> Otherwise: INDEX_MAX </li>
 	 * </ul>
+	 * Use GET_PROD_TYPE_ID(), SET_PROD_TYPE_ID()
 	 */
-	Index typeId;
+	ProdTypeIndex typeId;
 	
 	/**
 	 * Identifies the terminal portion, the element/attribute for SE(qname), 
      * SE(uri:*), AT(qname) or AT(uri:*).
+	 * Use GET_PROD_URI_ID(), GET_PROD_LN_ID(), GET_PROD_QNAME_ID(), SET_PROD_QNAME_ID()
 	 */
-	QNameID qnameId;
+	ProdQNameID qnameId;
 };
 
 typedef struct Production Production;
@@ -652,7 +839,7 @@ struct GrammarRule
     Production* production;
 
     /** The number of productions */
-    Index pCount;
+    ProdCount pCount;
 
     /** Meta information for the grammar rule:
      * - most significant 15 bits contain the number of AT(qname)[schema-typed value]  productions
@@ -660,6 +847,11 @@ struct GrammarRule
      * in case of Schema grammar OR (2) whether the rule contain AT(xsi:type) production in
      * case of Build-in element grammar */
     uint16_t meta;
+
+    /** The number of bits of the first part of the event codes plus one:
+     * [0] when the rule has no second level productions, [1] when it has.
+     * 0 if not set (static grammars generated without it), see setRuleCodeBits() */
+    unsigned char codeBits[2];
 };
 
 typedef struct GrammarRule GrammarRule;
@@ -685,15 +877,19 @@ typedef struct GrammarRule GrammarRule;
 		Production* production;
 
 		/** The number of productions */
-		Index pCount;
+		ProdCount pCount;
 
 		/** Meta information for the grammar rule:
 		 * - most significant 10 bits contain the number of AT(qname)[schema-typed value]  productions
 		 * - least significant 5 bits contain the number of bits for productions event codes */
 		uint16_t meta;
 
+		/** As in GrammarRule; both entries count the second level productions,
+		 * which a built-in element grammar always has */
+		unsigned char codeBits[2];
+
 	   /** Additional field */
-	   Index prodDim; // The size of the productions Dynamic production array /allocated space for Productions in it/
+	   ProdCount prodDim; // The size of the productions Dynamic production array /allocated space for Productions in it/
 	};
 	typedef struct DynGrammarRule DynGrammarRule;
 #endif
@@ -767,7 +963,7 @@ struct EXIGrammar
 typedef struct EXIGrammar EXIGrammar;
 
 /**
- * Used for the processing grammar stack. */
+ * A node of the processing grammar stack. */
 struct GrammarStackNode
 {
 	EXIGrammar* grammar;
@@ -779,11 +975,119 @@ struct GrammarStackNode
 	SmallIndex currNonTermID;
 	/** The qname of the current element being parsed/serialized */
 	QNameID currQNameID;
-	struct GrammarStackNode* nextInStack;
+	/** Whether the rules of the grammar have second level productions with the options
+	 * of the stream: SECOND_LEVEL_FIRST_RULE and SECOND_LEVEL_OTHER_RULES flags
+	 * set by pushGrammar() */
+	unsigned char secondLevel;
 };
 
 typedef struct GrammarStackNode EXIGrammarStack;
 
+/**
+ * The processing grammar stack: the nodes of the open elements
+ * in a contiguous array, from the document grammar up */
+struct GrammarStack
+{
+#if GRAMMAR_STACK_MAX_DEPTH
+	EXIGrammarStack node[GRAMMAR_STACK_MAX_DEPTH];
+#else
+	/** Allocated by the first push; kept until the stream is destroyed */
+	EXIGrammarStack* node;
+	/** The number of allocated nodes */
+	Index size;
+#endif
+	/** The number of nodes in the stack */
+	Index depth;
+};
+
+typedef struct GrammarStack GrammarStack;
+
+/** The number of the events of the second level state machines in bodyDecode.c and bodyEncode.c */
+#define EVENT_CODE_STATE_COUNT 11
+
+/** The event code part of an event that has no production in an EventCodeLayout */
+#define EVENT_CODE_NONE 0xFF
+
+/**
+ * The second (or third) level productions of a grammar rule with the options
+ * of a stream. The events are numbered by their position in the event code
+ * order of the EXI specification (the states of the state machines)
+ */
+struct EventCodeLayout
+{
+	/** The number of productions */
+	unsigned char count;
+	/** The number of bits of the event code part: getBitsNumber(count - 1) */
+	unsigned char bits;
+	/** From the event code part to the event; EVENT_CODE_NONE from count on */
+	unsigned char state[EVENT_CODE_STATE_COUNT];
+	/** From the event to the event code part; EVENT_CODE_NONE if the event has no production */
+	unsigned char code[EVENT_CODE_STATE_COUNT];
+};
+
+typedef struct EventCodeLayout EventCodeLayout;
+
+/**
+ * The layouts of the second and third level productions of the grammar rules
+ * with the options of a stream, set by setEventCodeTables() once the options
+ * are known. See grammars.h for the events of each layout.
+ */
+struct EventCodeTables
+{
+	/** Built-in element grammars: [0] StartTagContent, [1] ElementContent */
+	EventCodeLayout builtIn[2];
+	/** Schema-informed grammars in non-strict mode, indexed with EVENT_CODE_SCHEMA_LAYOUT() */
+	EventCodeLayout schema[8];
+	/** The first rule of the schema-informed grammars in strict mode, indexed with EVENT_CODE_STRICT_LAYOUT() */
+	EventCodeLayout strict[4];
+	/** Document grammar: [0] DocContent, [1] the other rules and the third level CM/PI of DocContent */
+	EventCodeLayout document[2];
+};
+
+typedef struct EventCodeTables EventCodeTables;
+
+#if PRODUCTION_INDEX_USE
+/**
+ * A slot of the production index: the first part of the event code of the first production
+ * of an event class (with a given qname for AT and SE) in a schema-informed grammar rule
+ */
+struct ProductionIndexSlot
+{
+	/** The grammar rule, see PRODUCTION_INDEX_RULE_KEY(); 0 marks an empty slot */
+	size_t ruleKey;
+	/** {URI_MAX, LN_MAX} for the events other than AT and SE */
+	QNameID qnameId;
+	EventTypeClass eventClass;
+	/** The first part of the event code */
+	Index code;
+};
+
+typedef struct ProductionIndexSlot ProductionIndexSlot;
+
+/**
+ * Open-addressing hash from (grammar rule, event class, qname) to the first part of the event code.
+ * Built by createProductionIndex() (createRuleArrayIndex() for schema images) once the grammars of a schema are generated, for the rules
+ * with at least PRODUCTION_INDEX_THRESHOLD productions, and read-only from then on.
+ * The size is 0 when the schema has no index (static schemas, schema-less streams).
+ */
+struct ProductionIndex
+{
+	ProductionIndexSlot* slot;
+	/** The number of slots - a power of two */
+	Index size;
+	/** The number of used slots */
+	Index count;
+	/** The rules are keyed by their position from ruleBase when the rules of the
+	 * schema are in one array (schema images), by their address when it is NULL */
+	const GrammarRule* ruleBase;
+};
+
+typedef struct ProductionIndex ProductionIndex;
+
+/** The key of a grammar rule in a production index: never 0 */
+#define PRODUCTION_INDEX_RULE_KEY(index, rule) (((size_t) (rule) - (size_t) (index)->ruleBase)/sizeof(GrammarRule) + 1)
+#endif
+
 /**@}*/ // End Grammar Types
 
 
@@ -826,6 +1130,26 @@ struct ValueTable {
 
 typedef struct ValueTable ValueTable;
 
+#if STRING_TABLE_INDEX_USE
+/**
+ * Open-addressing hash index over the strings of a URI, local-name, prefix or value cross table.
+ * Built on demand once the table has STRING_TABLE_INDEX_THRESHOLD entries.
+ */
+struct NameIndex {
+	/** The entry ID + 1 of the string in each slot; 0 marks an empty slot */
+	Index* slot;
+	/** The number of slots - a power of two */
+	Index size;
+	/** The number of table entries in the index */
+	Index count;
+	/** TRUE for the indexes built by createSchemaNameIndexes(): read by the streams
+	 * of the schema and never written to */
+	boolean shared;
+};
+
+typedef struct NameIndex NameIndex;
+#endif
+
 #if VALUE_CROSSTABLE_USE
 	struct VxEntry {
 		Index globalId;
@@ -839,6 +1163,9 @@ typedef struct ValueTable ValueTable;
 	#endif
 		VxEntry* vx;
 		Index count;
+	#if STRING_TABLE_INDEX_USE
+		struct NameIndex* index;
+	#endif
 	};
 
 	typedef struct VxTable VxTable;
@@ -850,6 +1177,9 @@ struct PfxTable {
 #endif
 	String* pfx;
 	Index count;
+#if STRING_TABLE_INDEX_USE
+	NameIndex* index;
+#endif
 };
 
 typedef struct PfxTable PfxTable;
@@ -879,6 +1209,9 @@ struct LnTable {
 #endif
 	LnEntry* ln;
 	Index count;
+#if STRING_TABLE_INDEX_USE
+	NameIndex* index;
+#endif
 };
 
 typedef struct LnTable LnTable;
@@ -897,6 +1230,9 @@ struct UriTable {
 #endif
 	UriEntry* uri;
 	SmallIndex count;
+#if STRING_TABLE_INDEX_USE
+	NameIndex* index;
+#endif
 };
 
 typedef struct UriTable UriTable;
@@ -1110,10 +1446,42 @@ struct EXIPSchema
 	Index staticGrCount;
 
 	EnumTable enumTable;
+
+#if PRODUCTION_INDEX_USE
+	/**
+	 * The first-level event codes of the productions of the large grammar rules
+	 * used by the serializer. Must stay the last member: the static schemas
+	 * generated by exipg leave it zero-initialized
+	 */
+	ProductionIndex prodIndex;
+#endif
 };
 
 typedef struct EXIPSchema EXIPSchema;
 
+/**
+ * The qname of an element or attribute resolved against the string tables of a schema
+ * by resolveQNameHandle(), for startElementH() and attributeH(). Opaque to the applications.
+ * The strings of the qname are not copied and must outlive the handle.
+ */
+struct QNameHandle
+{
+	QName qname;
+	/** The schema the qname is resolved against */
+	const EXIPSchema* schema;
+	/** {URI_MAX, LN_MAX} when the qname is not in the string tables of the schema */
+	QNameID qnameId;
+	/** The global element grammar of the qname in schema->grammarTable; INDEX_MAX if none */
+	Index elemGrammar;
+};
+
+typedef struct QNameHandle QNameHandle;
+
+typedef struct blockChannels BlockChannels;
+
+/** A registry of the schemas identified by schemaId (see schemaRegistry.h) */
+typedef struct schemaRegistry SchemaRegistry;
+
 struct StreamContext
 {
 	/**
@@ -1138,6 +1506,9 @@ struct StreamContext
 
 	/** Value type of the expected attribute */
 	Index attrTypeId;
+
+	/** The characters or octets still expected of a value serialized in chunks */
+	Index valueRemaining;
 };
 
 typedef struct StreamContext StreamContext;
@@ -1304,10 +1675,20 @@ struct EXIStream
 	ValueTable valueTable;
 
 	/**
-	 * The grammar stack used during processing
+	 * The top of the grammar stack used during processing; NULL when the stack is empty
 	 */
 	EXIGrammarStack* gStack;
 
+	/**
+	 * The nodes of the grammar stack
+	 */
+	GrammarStack grammarStack;
+
+	/**
+	 * The second and third level event codes with the options of the stream
+	 */
+	EventCodeTables eventCodes;
+
 	/**
 	 * Stores the information of all the allocated memory for that stream,
 	 * except the global sting values that are stored in the ValueTable
@@ -1316,9 +1697,51 @@ struct EXIStream
 
 	/**
 	 * Schema information for that stream.
-	 * It contains the string tables and possibly schema-informed EXI grammars.
+	 * It contains the initial string tables and possibly schema-informed EXI grammars.
+	 * The schema is not modified by the stream and can be shared by streams
+	 * processed concurrently.
 	 */
 	EXIPSchema* schema;
+
+	/**
+	 * The string tables of the stream: the entries of the schema string tables
+	 * and the ones added by the stream. The local-name and prefix partitions of a
+	 * URI are shared with the schema until the stream changes them (see sTables.h)
+	 */
+	UriTable uriTable;
+
+#if BUILD_IN_GRAMMARS_USE
+	/**
+	 * The built-in element grammars created by the stream. Their indexes in
+	 * LnEntry.elemGrammar follow the indexes of the schema grammarTable
+	 */
+	SchemaGrammarTable builtInGrammars;
+#endif
+
+#if BINARY_ZERO_COPY_USE
+	/**
+	 * Reusable buffer for the decoded binary values that can not be
+	 * delivered straight from the input buffer (see decodeBinary())
+	 */
+	char* binaryScratch;
+	/** The allocated size in bytes of the binaryScratch */
+	Index binaryScratchSize;
+#endif
+
+#if COMPRESSION_USE
+	/**
+	 * The structure and value channels of the current block when the alignment
+	 * is compression or pre-compression (see bodyChannels.h), NULL otherwise
+	 */
+	BlockChannels* channels;
+#endif
+
+	/**
+	 * The registry the schema is acquired from by parseHeader() or
+	 * initStreamSchemaId(); the schema is released when the stream is closed.
+	 * NULL when the schema is given by the application
+	 */
+	SchemaRegistry* registry;
 };
 
 typedef struct EXIStream EXIStream;
@@ -1341,6 +1764,16 @@ void makeDefaultOpts(EXIOptions* opts);
  */
 errorCode checkOptionValues(EXIOptions* opts);
 
+/**
+ * @brief Check if the EXI options allow the non-blocking parsing and serialization
+ * with pushEXIData() and flushEXIData()
+ *
+ * @param[in] opts EXI options structure
+ * @returns EXIP_OK if they do; EXIP_INVALID_EXIP_CONFIGURATION with the compression and
+ * pre-compression alignments, whose blocks are read and written with buffer.ioStrm.readWriteToStream
+ */
+errorCode checkNonBlockingOptions(EXIOptions* opts);
+
 errorCode pushOnStack(GenericStack** stack, void* item);
 
 void popFromStack(GenericStack** stack, void** item);
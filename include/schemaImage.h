@@ -0,0 +1,81 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file schemaImage.h
+ * @brief Binary images of EXIPSchema objects that are used in place
+ *
+ * A schema image is a relocatable and versioned copy of an EXIPSchema (string tables,
+ * grammars, simple types and enumerations) where the pointers are replaced by offsets
+ * from the start of the image. exipg writes it with the -exip output format.
+ * The productions, the strings and the simple types are used in place, so
+ * an image mapped read-only with mmap() (MapViewOfFile() on Windows)
+ * is shared by all the processes that load it.
+ *
+ * An image is bound to the build of EXIP that wrote it: the byte order, the
+ * sizes of Index, SmallIndex, CharType, UnsignedInteger and Production, and the
+ * PACKED_GRAMMAR_USE and STRING_UTF8_USE switches must be the same when it is loaded.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#ifndef SCHEMAIMAGE_H_
+#define SCHEMAIMAGE_H_
+
+#include "errorHandle.h"
+#include "procTypes.h"
+
+/** The version of the schema image format */
+#define SCHEMA_IMAGE_VERSION 2
+
+/** The alignment in bytes of a schema image in memory and of its sections */
+#define SCHEMA_IMAGE_ALIGN 8
+
+/**
+ * @brief Writes the image of a schema
+ * The image does not depend on the addresses of the schema in memory nor on the padding of its
+ * structures: the images of a schema are identical. With PRODUCTION_INDEX_USE the image contains
+ * the production index of the schema.
+ *
+ * @param[in] schema the schema
+ * @param[out] image the image; NULL to get the size of the image only
+ * @param[in, out] size the size of the image buffer in bytes; the size of the image on return
+ * @return Error handling code - EXIP_OUT_OF_BOUND_BUFFER when the image buffer is too small or the
+ * image is bigger than 4GB; EXIP_NOT_IMPLEMENTED_YET for enumerations of other than string and
+ * unsigned integer values
+ */
+errorCode writeSchemaImage(EXIPSchema* schema, void* image, size_t* size);
+
+/**
+ * @brief Creates a schema from its image without copying the productions, the strings and the simple types
+ * The string and grammar tables are rebuilt with pointers into the image - the image must be
+ * aligned on SCHEMA_IMAGE_ALIGN bytes and stay unchanged until unloadSchemaImage() is called.
+ * With PRODUCTION_INDEX_USE the production index stored in the image by writeSchemaImage()
+ * is used in place too; it is created when the image has none. With STRING_TABLE_INDEX_USE
+ * the indexes of the string tables are built, see createSchemaNameIndexes().
+ * The grammar, type and string table indexes of the productions and local names are checked
+ * against the tables of the image.
+ *
+ * @param[in] image the image written by writeSchemaImage()
+ * @param[in] size the size of the image in bytes
+ * @param[out] schema the schema
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when the image is not a schema
+ * image of this version and configuration of EXIP or an index in it is out of range;
+ * EXIP_OUT_OF_BOUND_BUFFER when it is truncated
+ */
+errorCode loadSchemaImage(const void* image, size_t size, EXIPSchema* schema);
+
+/**
+ * @brief Frees the memory allocated by loadSchemaImage(). destroySchema() must not be
+ * used for the schemas loaded from images
+ * @param[in, out] schema the schema loaded from an image
+ */
+void unloadSchemaImage(EXIPSchema* schema);
+
+#endif /* SCHEMAIMAGE_H_ */
@@ -0,0 +1,123 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file schemaRegistry.h
+ * @brief A registry of the schemas identified by the schemaId option of the EXI header
+ *
+ * The schemas are registered with a source that creates them on the first
+ * acquireSchema() of their schemaId: an image written by writeSchemaImage(), the XML
+ * schema definitions given to registerSchemaDefinitions() (grammarGenerator.h) or
+ * any SchemaSource of the application. A loaded schema is shared by all the streams that
+ * acquire it and kept after they release it, until the memory of the loaded schemas that
+ * are not in use exceeds the memory budget of the registry: the least recently
+ * released ones are then unloaded.
+ *
+ * A parser with a registry binds the schema of the schemaId in the header
+ * in parseHeader() (see Parser.registry) and initStreamSchemaId() serializes a stream
+ * with the schema of a schemaId. Both release the schema when the stream is closed.
+ * With SCHEMA_REGISTRY_THREAD_USE the registry can be used from several threads.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#ifndef SCHEMAREGISTRY_H_
+#define SCHEMAREGISTRY_H_
+
+#include "errorHandle.h"
+#include "procTypes.h"
+
+/**
+ * Creates the schema of a schemaId when acquireSchema() needs it
+ */
+struct SchemaSource
+{
+	/** Creates the schema; the errors are returned by acquireSchema() */
+	errorCode (*load)(void* data, EXIPSchema* schema);
+	/** Frees the schema created by load */
+	void (*unload)(void* data, EXIPSchema* schema);
+	/** Frees data when the registry is destroyed; NULL if nothing to free */
+	void (*destroy)(void* data);
+	/** The data passed to the functions */
+	void* data;
+};
+
+typedef struct SchemaSource SchemaSource;
+
+/**
+ * @brief Creates an empty schema registry
+ * @param[in] memBudget the memory in bytes kept for the loaded schemas that are not in use;
+ * 0 to unload the schemas as soon as they are released
+ * @param[out] registry the registry
+ * @return Error handling code
+ */
+errorCode createSchemaRegistry(size_t memBudget, SchemaRegistry** registry);
+
+/**
+ * @brief Registers the source of the schema of a schemaId
+ * The schema is created by the source on the first acquireSchema() of schemaId.
+ * When the registration fails, source.destroy is called.
+ *
+ * @param[in, out] registry the registry
+ * @param[in] schemaId the schemaId of the schema; copied by the registry
+ * @param[in] source the source of the schema
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when schemaId is empty or already registered
+ */
+errorCode registerSchemaSource(SchemaRegistry* registry, const String* schemaId, SchemaSource source);
+
+/**
+ * @brief Registers the image of the schema of a schemaId, loaded with loadSchemaImage()
+ *
+ * @param[in, out] registry the registry
+ * @param[in] schemaId the schemaId of the schema; copied by the registry
+ * @param[in] image the image written by writeSchemaImage(); not copied: it must stay
+ * unchanged until the registry is destroyed
+ * @param[in] size the size of the image in bytes
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when schemaId is empty or already registered
+ */
+errorCode registerSchemaImage(SchemaRegistry* registry, const String* schemaId, const void* image, size_t size);
+
+/**
+ * @brief Gets the schema of a schemaId, loading it if needed
+ * The schema stays loaded until releaseSchema() is called as many times as acquireSchema().
+ * The source loads the schema without the lock of the registry: only the acquirers of the
+ * same schemaId wait for the end of the load.
+ *
+ * @param[in, out] registry the registry
+ * @param[in] schemaId the schemaId
+ * @param[out] schema the schema
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION when schemaId is not registered;
+ * the error of the source when it can not create the schema
+ */
+errorCode acquireSchema(SchemaRegistry* registry, const String* schemaId, EXIPSchema** schema);
+
+/**
+ * @brief Releases a schema returned by acquireSchema()
+ * @param[in, out] registry the registry
+ * @param[in] schema the schema
+ */
+void releaseSchema(SchemaRegistry* registry, EXIPSchema* schema);
+
+/**
+ * @brief The estimated memory of the loaded schemas (in use or not), in bytes
+ * @param[in] registry the registry
+ * @return the memory of the string tables, grammars, simple types and enumerations of the schemas
+ */
+size_t getSchemaRegistryMemory(SchemaRegistry* registry);
+
+/**
+ * @brief Frees the registry and unloads its schemas. The schemas must be released
+ * (the streams using them closed) before
+ * @param[in, out] registry the registry
+ * @return Error handling code - EXIP_INVALID_EXIP_CONFIGURATION, and nothing is freed,
+ * when a schema is still acquired or being loaded
+ */
+errorCode destroySchemaRegistry(SchemaRegistry* registry);
+
+#endif /* SCHEMAREGISTRY_H_ */
@@ -21,6 +21,14 @@
  **/
 uint32_t djbHash(String str);
 
+/**
+ * Word-at-a-time string hash
+ * Mixes the octets of the string 8 at a time with a rotate, xor and multiply step
+ * and folds the result so that its low bits depend on all octets.
+ * Faster than djbHash for all but the shortest strings.
+ **/
+uint32_t wordHash(String str);
+
 struct hashtable;
 
 /* Example of use:
@@ -8,6 +8,37 @@
 #include "hashtable.h"
 
 /*****************************************************************************/
+#if OPEN_HASH_TABLE_USE
+
+/* An entry of the open addressing table (openHashtable.c) */
+struct entry
+{
+    String key;
+    Index value;
+};
+
+/* The probe state of a slot, kept apart from the entries so that the probes
+ * only touch this compact array */
+struct slot
+{
+    uint32_t hash;
+    /* The probe distance + 1 of the entry from its home slot; 0 for an empty slot */
+    uint32_t dist;
+};
+
+struct hashtable {
+    unsigned int tablelength; /* a power of two */
+    struct slot *slots;
+    struct entry *table;
+    unsigned int entrycount;
+    unsigned int loadlimit;
+    unsigned int minlength;
+    uint32_t (*hashfn) (String key);
+    boolean (*eqfn) (const String str1, const String str2);
+};
+
+#else
+
 struct entry
 {
     String key;
@@ -26,6 +57,8 @@ struct hashtable {
     boolean (*eqfn) (const String str1, const String str2);
 };
 
+#endif /* OPEN_HASH_TABLE_USE */
+
 /*****************************************************************************/
 
 // uint32_t hash(struct hashtable *h, void *k, unsigned int len);
@@ -35,6 +35,7 @@ errorCode initAllocList(AllocList* list);
 /**
  * @brief Allocate a memory block with size size and store a copy of
  * the pointer in a linked list for freeing it at the end.
+ * When MEM_ARENA_USE is ON the block is carved out of the chunks of the list instead.
  *
  * @param[in, out] list A list storing the memory allocations
  * @param[in] size the size of the memory block to be allocated
@@ -46,12 +47,23 @@ void* memManagedAllocate(AllocList* list, size_t size);
  * @brief Frees all the managed memory for a particular EXI stream.
  * It should be called after an error in the processing occur or at the
  * end of the parsing/serializing if the processing is successful.
- * Frees the memory in the allocation list and the hashtables used.
+ * Frees the memory in the allocation list, the hashtables and the grammar stack.
  *
  * @param[in, out] strm EXI stream for which the allocations were made
  */
 void freeAllMem(EXIStream* strm);
 
+/**
+ * @brief Frees the memory for a particular EXI stream like freeAllMem() but
+ * keeps the allocation list for reuse by the next stream (see resetAllocList()).
+ * The buffer for the binary values (BINARY_ZERO_COPY_USE) and the nodes of
+ * the grammar stack are kept as well.
+ *
+ * @param[in, out] strm EXI stream for which the allocations were made
+ * @return Error handling code
+ */
+errorCode resetAllMem(EXIStream* strm);
+
 /**
  * @brief Frees a particular Allocation list
  *
@@ -60,4 +72,14 @@ void freeAllMem(EXIStream* strm);
  */
 void freeAllocList(AllocList* list);
 
+/**
+ * @brief Discards all the allocations in a particular Allocation list.
+ * When MEM_ARENA_USE is ON the chunks are kept and the next allocations
+ * reuse them; otherwise this is freeAllocList() followed by initAllocList().
+ *
+ * @param[in, out] list Allocation list to be reset
+ * @return Error handling code
+ */
+errorCode resetAllocList(AllocList* list);
+
 #endif /* MEMMANAGEMENT_H_ */
@@ -18,6 +18,8 @@
 #include "stringManipulate.h"
 #include "memManagement.h"
 
+#if STRING_UTF8_USE == OFF
+
 #define PARSING_STRING_MAX_LENGTH 100
 
 errorCode allocateStringMemory(CharType** str, Index UCSchars)
@@ -278,3 +280,5 @@ void printString(const String* inStr)
 }
 
 #endif /* EXIP_DEBUG */
+
+#endif /* STRING_UTF8_USE */
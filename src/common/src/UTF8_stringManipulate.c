@@ -0,0 +1,447 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file UTF8_stringManipulate.c
+ * @brief String manipulation functions used for UCS <-> UTF-8 transformations
+ * Used instead of ASCII_stringManipulate.c when STRING_UTF8_USE is ON.
+ * String.str holds UTF-8 octets while String.length is the number of
+ * UCS characters. The number of octets is not stored: it is found by a scan that
+ * checks 16 (SSE2) or 8 octets at a time for the ASCII-only case and counts the
+ * characters of the rest 8 octets at a time.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "stringManipulate.h"
+#include "memManagement.h"
+
+#if STRING_UTF8_USE
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define UTF8_SSE2_USE ON
+#else
+# define UTF8_SSE2_USE OFF
+#endif
+
+#define PARSING_STRING_MAX_LENGTH 100
+
+/** The maximum number of octets of a UTF-8 encoded character */
+#define UTF8_MAX_OCTETS 4
+
+/** The number of octets of a UTF-8 character given its first octet */
+#define UTF8_SEQUENCE_LENGTH(c) ((c) < 0x80 ? 1 : ((c) < 0xE0 ? 2 : ((c) < 0xF0 ? 3 : 4)))
+
+/**
+ * @brief Returns the number of leading ASCII octets in str
+ * @param[in] str UTF-8 octets
+ * @param[in] max the maximum number of octets to check
+ * @return the length of the ASCII prefix
+ */
+static Index asciiPrefix(const CharType* str, Index max)
+{
+	const unsigned char* s = (const unsigned char*) str;
+	Index i = 0;
+
+#if UTF8_SSE2_USE
+	while(i + 16 <= max && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (s + i))) == 0)
+		i += 16;
+#else
+	while(i + sizeof(uint64_t) <= max)
+	{
+		uint64_t word;
+
+		memcpy(&word, s + i, sizeof(uint64_t));
+		if((word & 0x8080808080808080ULL) != 0)
+			break;
+		i += sizeof(uint64_t);
+	}
+#endif
+	while(i < max && s[i] < 0x80)
+		i++;
+
+	return i;
+}
+
+/**
+ * @brief Returns the number of UTF-8 octets of a string
+ * After the ASCII prefix the characters are counted 8 octets at a time: every
+ * octet that is not a continuation octet (10xxxxxx) starts a character.
+ *
+ * @param[in] str the string
+ * @return the number of octets of the str->length characters
+ */
+static Index utf8Length(const String* str)
+{
+	const unsigned char* s = (const unsigned char*) str->str;
+	Index octets;
+	Index chars;
+	uint64_t word;
+
+	octets = asciiPrefix(str->str, str->length);
+	chars = octets;
+
+	// With more than 8 characters left the whole word belongs to the string
+	while(str->length - chars > 8)
+	{
+		memcpy(&word, s + octets, sizeof(uint64_t));
+		word = word & ~(word << 1) & 0x8080808080808080ULL;
+		chars += 8 - (Index) (((word >> 7) * 0x0101010101010101ULL) >> 56);
+		octets += 8;
+	}
+
+	if(chars < str->length)
+	{
+		// Skip the rest of a character split by the last word
+		while((s[octets] & 0xC0) == 0x80)
+			octets++;
+
+		while(chars < str->length)
+		{
+			octets += UTF8_SEQUENCE_LENGTH(s[octets]);
+			chars++;
+		}
+	}
+
+	return octets;
+}
+
+errorCode allocateStringMemory(CharType** str, Index UCSchars)
+{
+	*str = EXIP_MALLOC(sizeof(CharType)*UCSchars*UTF8_MAX_OCTETS);
+	if((*str) == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	return EXIP_OK;
+}
+
+errorCode allocateStringMemoryManaged(CharType** str, Index UCSchars, AllocList* memList)
+{
+	(*str) = (CharType*) memManagedAllocate(memList, sizeof(CharType)*UCSchars*UTF8_MAX_OCTETS);
+	if((*str) == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	return EXIP_OK;
+}
+
+/**
+ * The memory of str is expected to be allocated with allocateStringMemory()
+ * i.e. UTF8_MAX_OCTETS octets per character
+ */
+errorCode writeCharToString(String* str, uint32_t code_point, Index* writerPosition)
+{
+	unsigned char* s = (unsigned char*) str->str + *writerPosition;
+
+	if(code_point < 0x80)
+	{
+		if(*writerPosition + 1 > str->length*UTF8_MAX_OCTETS)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+		s[0] = (unsigned char) code_point;
+		*writerPosition += 1;
+	}
+	else if(code_point < 0x800)
+	{
+		if(*writerPosition + 2 > str->length*UTF8_MAX_OCTETS)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+		s[0] = (unsigned char) (0xC0 | (code_point >> 6));
+		s[1] = (unsigned char) (0x80 | (code_point & 0x3F));
+		*writerPosition += 2;
+	}
+	else if(code_point < 0x10000)
+	{
+		if(*writerPosition + 3 > str->length*UTF8_MAX_OCTETS)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+		s[0] = (unsigned char) (0xE0 | (code_point >> 12));
+		s[1] = (unsigned char) (0x80 | ((code_point >> 6) & 0x3F));
+		s[2] = (unsigned char) (0x80 | (code_point & 0x3F));
+		*writerPosition += 3;
+	}
+	else if(code_point < 0x110000)
+	{
+		if(*writerPosition + 4 > str->length*UTF8_MAX_OCTETS)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+		s[0] = (unsigned char) (0xF0 | (code_point >> 18));
+		s[1] = (unsigned char) (0x80 | ((code_point >> 12) & 0x3F));
+		s[2] = (unsigned char) (0x80 | ((code_point >> 6) & 0x3F));
+		s[3] = (unsigned char) (0x80 | (code_point & 0x3F));
+		*writerPosition += 4;
+	}
+	else
+		return EXIP_INVALID_STRING_OPERATION;
+
+	return EXIP_OK;
+}
+
+void getEmptyString(String* emptyStr)
+{
+	emptyStr->length = 0;
+	emptyStr->str = NULL;
+}
+
+boolean isStringEmpty(const String* str)
+{
+	if(str == NULL || str->length == 0)
+		return 1;
+	return 0;
+}
+
+errorCode asciiToString(const char* inStr, String* outStr, AllocList* memList, boolean clone)
+{
+	outStr->length = strlen(inStr);
+	if(outStr->length > 0)  // If == 0 -> empty string
+	{
+		if(clone == FALSE)
+		{
+			outStr->str = (CharType*) inStr;
+			return EXIP_OK;
+		}
+		else
+		{
+			outStr->str = (CharType*) memManagedAllocate(memList, sizeof(CharType)*(outStr->length));
+			if(outStr->str == NULL)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+			memcpy(outStr->str, inStr, outStr->length);
+			return EXIP_OK;
+		}
+	}
+	else
+		outStr->str = NULL;
+	return EXIP_OK;
+}
+
+boolean stringEqual(const String str1, const String str2)
+{
+	Index octets;
+
+	if(str1.length != str2.length)
+		return 0;
+	else if(str1.length == 0)
+		return 1;
+
+	octets = utf8Length(&str1);
+	if(octets != utf8Length(&str2))
+		return 0;
+
+	return memcmp(str1.str, str2.str, octets) == 0;
+}
+
+/**
+ * An ASCII string has as many octets as characters so the first
+ * str1.length octets of str1 decide the equality
+ */
+boolean stringEqualToAscii(const String str1, const char* str2)
+{
+	if(str1.length != strlen(str2))
+		return 0;
+	else if(str1.length == 0)
+		return 1;
+
+	return memcmp(str1.str, str2, str1.length) == 0;
+}
+
+/**
+ * The UTF-8 octet order is the same as the UCS code point order
+ */
+int stringCompare(const String str1, const String str2)
+{
+	/* Check for NULL string pointers */
+	if(str1.str == NULL)
+	{
+		if(str2.str == NULL)
+			return 0;
+		return -1;
+	}
+	else if(str2.str == NULL)
+		return 1;
+	else // None of the strings is NULL
+	{
+		Index octets1 = utf8Length(&str1);
+		Index octets2 = utf8Length(&str2);
+		int diff;
+
+		diff = memcmp(str1.str, str2.str, octets1 < octets2 ? octets1 : octets2);
+		if(diff)
+			return diff;
+
+		/* The strings have the same characters and might differ only in length*/
+		return str1.length - str2.length;
+	}
+}
+
+uint32_t readCharFromString(const String* str, Index* readerPosition)
+{
+	const unsigned char* s = (const unsigned char*) str->str + *readerPosition;
+	uint32_t code_point;
+
+	if(s[0] < 0x80)
+	{
+		*readerPosition += 1;
+		return (uint32_t) s[0];
+	}
+	else if(s[0] < 0xE0)
+	{
+		code_point = ((uint32_t) (s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+		*readerPosition += 2;
+	}
+	else if(s[0] < 0xF0)
+	{
+		code_point = ((uint32_t) (s[0] & 0x0F) << 12) | ((uint32_t) (s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+		*readerPosition += 3;
+	}
+	else
+	{
+		code_point = ((uint32_t) (s[0] & 0x07) << 18) | ((uint32_t) (s[1] & 0x3F) << 12) |
+				((uint32_t) (s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+		*readerPosition += 4;
+	}
+
+	return code_point;
+}
+
+errorCode cloneString(const String* src, String* newStr)
+{
+	Index octets;
+
+	if(newStr == NULL)
+		return EXIP_NULL_POINTER_REF;
+	octets = utf8Length(src);
+	newStr->str = EXIP_MALLOC(sizeof(CharType)*octets);
+	if(newStr->str == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	newStr->length = src->length;
+	memcpy(newStr->str, src->str, octets);
+	return EXIP_OK;
+}
+
+errorCode cloneStringManaged(const String* src, String* newStr, AllocList* memList)
+{
+	Index octets;
+
+	if(newStr == NULL)
+		return EXIP_NULL_POINTER_REF;
+	octets = utf8Length(src);
+	newStr->str = memManagedAllocate(memList, sizeof(CharType)*octets);
+	if(newStr->str == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	newStr->length = src->length;
+	memcpy(newStr->str, src->str, octets);
+	return EXIP_OK;
+}
+
+/**
+ * sCh must be an ASCII character. The index returned is the index of the character,
+ * which is also its octet offset in src->str only when all the preceding characters are ASCII
+ */
+Index getIndexOfChar(const String* src, CharType sCh)
+{
+	const unsigned char* s = (const unsigned char*) src->str;
+	Index octet = 0;
+	Index i;
+
+	for(i = 0; i < src->length; i++)
+	{
+		if(s[octet] == (unsigned char) sCh)
+			return i;
+		octet += UTF8_SEQUENCE_LENGTH(s[octet]);
+	}
+	return INDEX_MAX;
+}
+
+errorCode stringToInteger(const String* src, int* number)
+{
+	char buff[PARSING_STRING_MAX_LENGTH];
+	long result;
+	char *endPointer;
+
+	// Digits are ASCII: any other character makes strtol() fail
+	if(src->length == 0 || src->length >= PARSING_STRING_MAX_LENGTH)
+		return EXIP_INVALID_STRING_OPERATION;
+
+	memcpy(buff, src->str, src->length);
+	buff[src->length] = '\0';
+
+	result = strtol(buff, &endPointer, 10);
+
+	if(result == LONG_MAX || result == LONG_MIN || *src->str == *endPointer)
+		return EXIP_INVALID_STRING_OPERATION;
+
+	if(result >= INT_MAX || result <= INT_MIN)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	*number = (int) result;
+
+	return EXIP_OK;
+}
+
+errorCode stringToInt64(const String* src, int64_t* number)
+{
+	char buff[PARSING_STRING_MAX_LENGTH];
+	long long result;
+	char *endPointer;
+
+	if(src->length == 0 || src->length >= PARSING_STRING_MAX_LENGTH)
+		return EXIP_INVALID_STRING_OPERATION;
+
+	memcpy(buff, src->str, src->length);
+	buff[src->length] = '\0';
+
+	result = EXIP_STRTOLL(buff, &endPointer, 10);
+
+	if(result == LLONG_MAX || result == LLONG_MIN || *src->str == *endPointer)
+		return EXIP_INVALID_STRING_OPERATION;
+
+	if(result >= LLONG_MAX || result <= LLONG_MIN)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	*number = (int64_t) result;
+
+	return EXIP_OK;
+}
+
+#if EXIP_IMPLICIT_DATA_TYPE_CONVERSION
+
+errorCode integerToString(Integer number, String* outStr)
+{
+	return EXIP_NOT_IMPLEMENTED_YET;
+}
+
+errorCode booleanToString(boolean b, String* outStr)
+{
+	return EXIP_NOT_IMPLEMENTED_YET;
+}
+
+errorCode floatToString(Float f, String* outStr)
+{
+	return EXIP_NOT_IMPLEMENTED_YET;
+}
+
+errorCode decimalToString(Decimal d, String* outStr)
+{
+	return EXIP_NOT_IMPLEMENTED_YET;
+}
+
+errorCode dateTimeToString(EXIPDateTime dt, String* outStr)
+{
+	return EXIP_NOT_IMPLEMENTED_YET;
+}
+
+#endif /* EXIP_IMPLICIT_DATA_TYPE_CONVERSION */
+
+#if EXIP_DEBUG == ON
+
+void printString(const String* inStr)
+{
+	if(inStr->length == 0)
+		return;
+
+	DEBUG_OUTPUT(("%.*s", (int) utf8Length(inStr), inStr->str));
+}
+
+#endif /* EXIP_DEBUG */
+
+#endif /* STRING_UTF8_USE */
@@ -20,6 +20,9 @@ void initContentHandler(ContentHandler* handler)
 {
 	handler->attribute = NULL;
 	handler->binaryData = NULL;
+	handler->binaryDataBegin = NULL;
+	handler->binaryDataChunk = NULL;
+	handler->binaryDataEnd = NULL;
 	handler->booleanData = NULL;
 	handler->dateTimeData = NULL;
 	handler->decimalData = NULL;
@@ -37,5 +40,8 @@ void initContentHandler(ContentHandler* handler)
 	handler->startDocument = NULL;
 	handler->startElement = NULL;
 	handler->stringData = NULL;
+	handler->stringDataBegin = NULL;
+	handler->stringDataChunk = NULL;
+	handler->stringDataEnd = NULL;
 	handler->warning = NULL;
 }
@@ -25,6 +25,9 @@ static const uint32_t primes[] = {
 const unsigned int prime_table_length = sizeof(primes)/sizeof(primes[0]);
 const float max_load_factor = 0.65F;
 
+/** An odd 64-bit constant with well distributed bits (2^64 divided by the golden ratio) */
+#define WORD_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+
 uint32_t djbHash(String str)
 {
 	char* tmp = (char*) str.str;
@@ -39,6 +42,35 @@ uint32_t djbHash(String str)
 	return hash;
 }
 
+uint32_t wordHash(String str)
+{
+	const unsigned char* tmp = (const unsigned char*) str.str;
+	size_t len = sizeof(CharType)*str.length;
+	uint64_t hash = len;
+	uint64_t word;
+
+	for(; len >= sizeof(word); tmp += sizeof(word), len -= sizeof(word))
+	{
+		memcpy(&word, tmp, sizeof(word));
+		hash = (((hash << 5) | (hash >> 59)) ^ word) * WORD_HASH_MULTIPLIER;
+	}
+
+	if(len > 0)
+	{
+		word = 0;
+		for(; len > 0; tmp++, len--)
+			word = (word << 8) | *tmp;
+		hash = (((hash << 5) | (hash >> 59)) ^ word) * WORD_HASH_MULTIPLIER;
+	}
+
+	// The table index is taken from the low bits: fold the well-mixed high bits into them
+	hash ^= hash >> 32;
+	hash *= WORD_HASH_MULTIPLIER;
+	return (uint32_t) (hash >> 32);
+}
+
+#if OPEN_HASH_TABLE_USE == OFF
+
 /*****************************************************************************/
 
 struct hashtable * create_hashtable(unsigned int minsize,
@@ -240,6 +272,8 @@ void hashtable_destroy(struct hashtable *h)
     EXIP_MFREE(h);
 }
 
+#endif /* OPEN_HASH_TABLE_USE == OFF */
+
 /*
  * Copyright (c) 2002, Christopher Clark
  * All rights reserved.
@@ -20,6 +20,75 @@
 #include "sTables.h"
 #include "grammars.h"
 
+#if MEM_ARENA_USE
+/** The strictest alignment of the types stored in the managed memory */
+union arenaAlign {
+	long l;
+	double d;
+	void* p;
+	uint64_t u;
+};
+
+#define ARENA_ALIGNMENT sizeof(union arenaAlign)
+#define ARENA_ALIGN_UP(n) (((n) + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT)
+#define ARENA_CHUNK_HEADER_SIZE ARENA_ALIGN_UP(sizeof(struct arenaChunk))
+#define ARENA_CHUNK_DATA(chunk) ((unsigned char*) (chunk) + ARENA_CHUNK_HEADER_SIZE)
+
+errorCode initAllocList(AllocList* list)
+{
+	// The first chunk is allocated on the first memManagedAllocate()
+	list->firstChunk = NULL;
+	list->currChunk = NULL;
+	list->used = 0;
+
+	return EXIP_OK;
+}
+
+void* memManagedAllocate(AllocList* list, size_t size)
+{
+	void* ptr;
+
+	size = ARENA_ALIGN_UP(size);
+
+	if(list->currChunk == NULL || list->currChunk->size - list->used < size)
+	{
+		struct arenaChunk* nextChunk = list->currChunk == NULL ? list->firstChunk : list->currChunk->nextChunk;
+
+		// The chunks kept by resetAllocList() are reused when big enough;
+		// otherwise a new chunk, twice the size of the current one, is put in front of them
+		if(nextChunk == NULL || nextChunk->size < size)
+		{
+			struct arenaChunk* newChunk;
+			size_t chunkSize = list->currChunk == NULL ? MEM_ARENA_CHUNK_SIZE : 2*list->currChunk->size;
+
+			if(chunkSize > MEM_ARENA_MAX_CHUNK_SIZE)
+				chunkSize = MEM_ARENA_MAX_CHUNK_SIZE;
+			if(chunkSize < size)
+				chunkSize = size;
+
+			newChunk = EXIP_MALLOC(ARENA_CHUNK_HEADER_SIZE + chunkSize);
+			if(newChunk == NULL)
+				return NULL;
+
+			newChunk->size = chunkSize;
+			newChunk->nextChunk = nextChunk;
+			if(list->currChunk == NULL)
+				list->firstChunk = newChunk;
+			else
+				list->currChunk->nextChunk = newChunk;
+			nextChunk = newChunk;
+		}
+
+		list->currChunk = nextChunk;
+		list->used = 0;
+	}
+
+	ptr = ARENA_CHUNK_DATA(list->currChunk) + list->used;
+	list->used += size;
+
+	return ptr;
+}
+#else
 errorCode initAllocList(AllocList* list)
 {
 	list->firstBlock = EXIP_MALLOC(sizeof(struct allocBlock));
@@ -54,53 +123,41 @@ void* memManagedAllocate(AllocList* list, size_t size)
 	}
 	return ptr;
 }
+#endif
 
-void freeAllMem(EXIStream* strm)
+/**
+ * Frees everything allocated for the stream except the memory in its allocation list */
+static void freeStreamMem(EXIStream* strm)
 {
 	Index i;
 
 	if(strm->schema != NULL) // can be, in case of error during EXIStream initialization
 	{
 #if BUILD_IN_GRAMMARS_USE
+		if(strm->builtInGrammars.grammar != NULL)
 		{
 		Index g;
 		DynGrammarRule* tmp_rule;
 		// Explicitly free the memory for any build-in grammars
-		for(g = strm->schema->staticGrCount; g < strm->schema->grammarTable.count; g++)
+		for(g = 0; g < strm->builtInGrammars.count; g++)
 		{
-			for(i = 0; i < strm->schema->grammarTable.grammar[g].count; i++)
+			for(i = 0; i < strm->builtInGrammars.grammar[g].count; i++)
 			{
-				tmp_rule = &((DynGrammarRule*) strm->schema->grammarTable.grammar[g].rule)[i];
+				tmp_rule = &((DynGrammarRule*) strm->builtInGrammars.grammar[g].rule)[i];
 				if(tmp_rule->production != NULL)
 					EXIP_MFREE(tmp_rule->production);
 			}
-			EXIP_MFREE(strm->schema->grammarTable.grammar[g].rule);
+			EXIP_MFREE(strm->builtInGrammars.grammar[g].rule);
 		}
 
-		strm->schema->grammarTable.count = strm->schema->staticGrCount;
+		destroyDynArray(&strm->builtInGrammars.dynArray);
+		strm->builtInGrammars.grammar = NULL;
+		strm->builtInGrammars.count = 0;
 		}
-#else
-		assert(strm->schema->grammarTable.count == strm->schema->staticGrCount);
 #endif
 
-#if VALUE_CROSSTABLE_USE
-		// Freeing the value cross tables
-		{
-		Index j;
-		for(i = 0; i < strm->schema->uriTable.count; i++)
-		{
-			for(j = 0; j < strm->schema->uriTable.uri[i].lnTable.count; j++)
-			{
-				if(GET_LN_URI_IDS(strm->schema->uriTable, i, j).vxTable != NULL)
-				{
-					assert(GET_LN_URI_IDS(strm->schema->uriTable, i, j).vxTable->vx);
-					destroyDynArray(&GET_LN_URI_IDS(strm->schema->uriTable, i, j).vxTable->dynArray);
-					GET_LN_URI_IDS(strm->schema->uriTable, i, j).vxTable = NULL;
-				}
-			}
-		}
-		}
-#endif
+		// The string tables of the stream; the ones of the schema are not modified by the stream
+		destroyStreamUriTable(strm);
 
 		// In case a default schema was used for this stream
 		if(strm->schema->staticGrCount <= SIMPLE_TYPE_COUNT)
@@ -112,31 +169,21 @@ void freeAllMem(EXIStream* strm)
 			{
 				destroyDynArray(&strm->schema->uriTable.uri[i].pfxTable.dynArray);
 				destroyDynArray(&strm->schema->uriTable.uri[i].lnTable.dynArray);
+#if STRING_TABLE_INDEX_USE
+				destroyNameIndex(&strm->schema->uriTable.uri[i].pfxTable.index);
+				destroyNameIndex(&strm->schema->uriTable.uri[i].lnTable.index);
+#endif
 			}
 
 			destroyDynArray(&strm->schema->uriTable.dynArray);
+#if STRING_TABLE_INDEX_USE
+			destroyNameIndex(&strm->schema->uriTable.index);
+#endif
 			destroyDynArray(&strm->schema->grammarTable.dynArray);
 			if(strm->schema->simpleTypeTable.sType != NULL)
 				destroyDynArray(&strm->schema->simpleTypeTable.dynArray);
 			freeAllocList(&strm->schema->memList);
 		}
-		else
-		{
-			// Possible additions of string table entries must be removed
-			for(i = 0; i < strm->schema->uriTable.dynArray.chunkEntries; i++)
-			{
-				strm->schema->uriTable.uri[i].pfxTable.count = strm->schema->uriTable.uri[i].pfxTable.dynArray.chunkEntries;
-				strm->schema->uriTable.uri[i].lnTable.count = strm->schema->uriTable.uri[i].lnTable.dynArray.chunkEntries;
-			}
-
-			for(i = strm->schema->uriTable.dynArray.chunkEntries; i < strm->schema->uriTable.count; i++)
-			{
-				destroyDynArray(&strm->schema->uriTable.uri[i].pfxTable.dynArray);
-				destroyDynArray(&strm->schema->uriTable.uri[i].lnTable.dynArray);
-			}
-
-			strm->schema->uriTable.count = strm->schema->uriTable.dynArray.chunkEntries;
-		}
 	}
 
 	// Hash tables are freed separately
@@ -157,10 +204,57 @@ void freeAllMem(EXIStream* strm)
 
 		destroyDynArray(&strm->valueTable.dynArray);
 	}
+}
 
+void freeAllMem(EXIStream* strm)
+{
+	freeStreamMem(strm);
 	freeAllocList(&(strm->memList));
+	destroyGrammarStack(strm);
+
+#if BINARY_ZERO_COPY_USE
+	if(strm->binaryScratch != NULL)
+	{
+		EXIP_MFREE(strm->binaryScratch);
+		strm->binaryScratch = NULL;
+		strm->binaryScratchSize = 0;
+	}
+#endif
 }
 
+errorCode resetAllMem(EXIStream* strm)
+{
+	freeStreamMem(strm);
+	return resetAllocList(&(strm->memList));
+}
+
+#if MEM_ARENA_USE
+void freeAllocList(AllocList* list)
+{
+	struct arenaChunk* chunk = list->firstChunk;
+	struct arenaChunk* rmChunk;
+
+	while(chunk != NULL)
+	{
+		rmChunk = chunk;
+		chunk = chunk->nextChunk;
+		EXIP_MFREE(rmChunk);
+	}
+
+	list->firstChunk = NULL;
+	list->currChunk = NULL;
+	list->used = 0;
+}
+
+errorCode resetAllocList(AllocList* list)
+{
+	// Keep the chunks; the allocations start over from the first one
+	list->currChunk = NULL;
+	list->used = 0;
+
+	return EXIP_OK;
+}
+#else
 void freeAllocList(AllocList* list)
 {
 	struct allocBlock* tmpBlock = list->firstBlock;
@@ -183,3 +277,10 @@ void freeAllocList(AllocList* list)
 		EXIP_MFREE(rmBl);
 	}
 }
+
+errorCode resetAllocList(AllocList* list)
+{
+	freeAllocList(list);
+	return initAllocList(list);
+}
+#endif
@@ -0,0 +1,251 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file openHashtable.c
+ * @brief Open addressing implementation of the hashtable.h interface
+ * Used instead of the chained hash table in hashtable.c when OPEN_HASH_TABLE_USE is ON.
+ * The entries are stored in a power-of-two array and placed with Robin Hood
+ * linear probing: an entry being inserted takes the slot of any entry that is closer
+ * to its home slot. This bounds the probe sequences and lets the searches stop early
+ * on a miss. The hash values and probe distances are kept in a separate compact
+ * array so that the probes touch an entry only when its hash value matches.
+ * Removal shifts the following entries of the cluster one slot back, so no
+ * tombstones are left behind. Inserting and removing do not allocate memory
+ * unless the table is resized: it grows at 80% load and is compacted when it is
+ * less than 1/8 full and larger than its initial size.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "hashtable.h"
+#include "hashtable_private.h"
+#include "procTypes.h"
+
+#if OPEN_HASH_TABLE_USE
+
+/** The smallest number of slots of a table */
+#define OPEN_HASH_TABLE_MIN_LENGTH 16
+
+/** The number of entries at which a table of tablelength slots is grown (80% load) */
+#define LOAD_LIMIT(tablelength) ((tablelength) - (tablelength)/5)
+
+/**
+ * @brief Places the entry e with hash value hash in the table, taking over the slots
+ * of closer-to-home entries. The table must have at least one empty slot.
+ */
+static void placeEntry(struct hashtable *h, struct entry e, uint32_t hash)
+{
+	unsigned int mask = h->tablelength - 1;
+	unsigned int index = hash & mask;
+	struct slot s;
+	struct slot tmpSlot;
+	struct entry tmp;
+
+	s.hash = hash;
+	s.dist = 1;
+	while(h->slots[index].dist != 0)
+	{
+		if(h->slots[index].dist < s.dist)
+		{
+			tmpSlot = h->slots[index];
+			h->slots[index] = s;
+			s = tmpSlot;
+			tmp = h->table[index];
+			h->table[index] = e;
+			e = tmp;
+		}
+		index = (index + 1) & mask;
+		s.dist++;
+	}
+	h->slots[index] = s;
+	h->table[index] = e;
+}
+
+/**
+ * @brief Allocates the arrays of a table with length slots
+ * @return EXIP_OK or EXIP_MEMORY_ALLOCATION_ERROR, in which case h is unchanged
+ */
+static errorCode allocateTable(struct hashtable *h, unsigned int length)
+{
+	struct slot *slots;
+	struct entry *table;
+
+	slots = (struct slot *) EXIP_MALLOC(sizeof(struct slot) * length);
+	if(slots == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	table = (struct entry *) EXIP_MALLOC(sizeof(struct entry) * length);
+	if(table == NULL)
+	{
+		EXIP_MFREE(slots);
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	}
+	memset(slots, 0, sizeof(struct slot) * length);
+
+	h->slots = slots;
+	h->table = table;
+	h->tablelength = length;
+	h->loadlimit = LOAD_LIMIT(length);
+
+	return EXIP_OK;
+}
+
+/**
+ * @brief Moves all entries to new arrays of newlength slots
+ * @return EXIP_OK or EXIP_MEMORY_ALLOCATION_ERROR, in which case the table is unchanged
+ */
+static errorCode resizeTable(struct hashtable *h, unsigned int newlength)
+{
+	errorCode tmp_err_code;
+	struct slot *oldslots = h->slots;
+	struct entry *oldtable = h->table;
+	unsigned int oldlength = h->tablelength;
+	unsigned int i;
+
+	TRY(allocateTable(h, newlength));
+
+	for(i = 0; i < oldlength; i++)
+	{
+		if(oldslots[i].dist != 0)
+			placeEntry(h, oldtable[i], oldslots[i].hash);
+	}
+	EXIP_MFREE(oldslots);
+	EXIP_MFREE(oldtable);
+
+	return EXIP_OK;
+}
+
+/**
+ * @return the slot of the entry with that key and hash value or tablelength if not found
+ */
+static unsigned int findEntry(struct hashtable *h, String key, uint32_t hashvalue)
+{
+	unsigned int mask = h->tablelength - 1;
+	unsigned int index = hashvalue & mask;
+	unsigned int dist = 1;
+
+	// An entry further than its own distance from home would have taken this slot
+	while(h->slots[index].dist >= dist)
+	{
+		if(h->slots[index].hash == hashvalue && h->eqfn(key, h->table[index].key))
+			return index;
+		index = (index + 1) & mask;
+		dist++;
+	}
+
+	return h->tablelength;
+}
+
+struct hashtable * create_hashtable(unsigned int minsize,
+						uint32_t (*hashfn) (String key),
+						boolean (*eqfn) (const String str1, const String str2))
+{
+	struct hashtable *h;
+	unsigned int size = OPEN_HASH_TABLE_MIN_LENGTH;
+
+	/* Check requested hashtable isn't too large */
+	if(minsize > MAX_HASH_TABLE_SIZE)
+		return NULL;
+	while(size < minsize)
+		size = size << 1;
+
+	h = (struct hashtable *) EXIP_MALLOC(sizeof(struct hashtable));
+	if(h == NULL)
+		return NULL;
+	if(allocateTable(h, size) != EXIP_OK)
+	{
+		EXIP_MFREE(h);
+		return NULL;
+	}
+	h->minlength = size;
+	h->entrycount = 0;
+	h->hashfn = hashfn;
+	h->eqfn = eqfn;
+
+	return h;
+}
+
+unsigned int hashtable_count(struct hashtable *h)
+{
+	return h->entrycount;
+}
+
+errorCode hashtable_insert(struct hashtable *h, String key, Index value)
+{
+	struct entry e;
+
+	if(h->entrycount + 1 > h->loadlimit)
+	{
+		/* Past MAX_HASH_TABLE_SIZE the table is only grown when it is full. If growing
+		 * fails, the entry still fits as long as there is an empty slot. */
+		if(h->tablelength < MAX_HASH_TABLE_SIZE || h->entrycount + 1 == h->tablelength)
+		{
+			if(resizeTable(h, h->tablelength << 1) != EXIP_OK && h->entrycount + 1 == h->tablelength)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+		}
+	}
+
+	e.key = key;
+	e.value = value;
+	placeEntry(h, e, h->hashfn(key));
+	h->entrycount++;
+
+	return EXIP_OK;
+}
+
+Index hashtable_search(struct hashtable *h, String key)
+{
+	unsigned int index = findEntry(h, key, h->hashfn(key));
+
+	if(index == h->tablelength)
+		return INDEX_MAX;
+
+	return h->table[index].value;
+}
+
+Index hashtable_remove(struct hashtable *h, String key)
+{
+	unsigned int mask = h->tablelength - 1;
+	unsigned int index = findEntry(h, key, h->hashfn(key));
+	unsigned int next;
+	Index value;
+
+	if(index == h->tablelength)
+		return INDEX_MAX;
+
+	value = h->table[index].value;
+
+	// Backward shift: move the rest of the cluster one slot closer to home
+	next = (index + 1) & mask;
+	while(h->slots[next].dist > 1)
+	{
+		h->slots[index].hash = h->slots[next].hash;
+		h->slots[index].dist = h->slots[next].dist - 1;
+		h->table[index] = h->table[next];
+		index = next;
+		next = (next + 1) & mask;
+	}
+	h->slots[index].dist = 0;
+	h->entrycount--;
+
+	// Compact the table. If there is no memory for the smaller array the table stays as it is
+	if(h->tablelength > h->minlength && h->entrycount < h->tablelength/8)
+		resizeTable(h, h->tablelength >> 1);
+
+	return value;
+}
+
+void hashtable_destroy(struct hashtable *h)
+{
+	EXIP_MFREE(h->slots);
+	EXIP_MFREE(h->table);
+	EXIP_MFREE(h);
+}
+
+#endif /* OPEN_HASH_TABLE_USE */
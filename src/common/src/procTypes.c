@@ -67,6 +67,14 @@ errorCode checkOptionValues(EXIOptions* opts)
 		return EXIP_HEADER_OPTIONS_MISMATCH;
 	}
 
+#if !COMPRESSION_USE
+	if(WITH_COMPRESSION(opts->enumOpt) || GET_ALIGNMENT(opts->enumOpt) == PRE_COMPRESSION)
+	{
+		DEBUG_MSG(ERROR, DEBUG_COMMON, ("\n>The compression and pre-compression alignments require COMPRESSION_USE"));
+		return EXIP_NOT_IMPLEMENTED_YET;
+	}
+#endif
+
 	if(opts->drMap != NULL && (IS_PRESERVED(opts->preserve, PRESERVE_LEXVALUES)))
 	{
 		DEBUG_MSG(WARNING, DEBUG_COMMON, ("\n>The datatypeRepresentationMap option specified but has no effect"));
@@ -75,6 +83,19 @@ errorCode checkOptionValues(EXIOptions* opts)
 	return EXIP_OK;
 }
 
+errorCode checkNonBlockingOptions(EXIOptions* opts)
+{
+	/** The blocks of the compression and pre-compression alignments are read and written
+	 * as a whole: a block can not be suspended when the buffer is empty or full */
+	if(WITH_COMPRESSION(opts->enumOpt) || GET_ALIGNMENT(opts->enumOpt) == PRE_COMPRESSION)
+	{
+		DEBUG_MSG(ERROR, DEBUG_COMMON, ("\n>pushEXIData() and flushEXIData() are not supported with the compression and pre-compression alignments: use buffer.ioStrm.readWriteToStream"));
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+	}
+
+	return EXIP_OK;
+}
+
 errorCode pushOnStack(GenericStack** stack, void* item)
 {
 	struct stackNode* node = (struct stackNode*)EXIP_MALLOC(sizeof(struct stackNode));
@@ -0,0 +1,420 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bodyChannels.h
+ * @brief The EXI body organized in blocks and channels when the alignment
+ * is compression or pre-compression (EXI 1.0, section 9)
+ *
+ * Each block holds blockSize values. The structure channel carries the event codes
+ * and the content of the events except the values (including the values of
+ * xsi:type and xsi:nil). The values are grouped in one value channel per element
+ * or attribute qname, in the order of the first occurrence of the qname in the block.
+ * With compression, a block with up to CHANNEL_SMALL_VALUE_COUNT values is a single
+ * DEFLATE stream; otherwise the structure channel is a stream, all value channels
+ * with up to CHANNEL_SMALL_VALUE_COUNT values together are the next stream and each
+ * of the remaining value channels is a stream of its own.
+ *
+ * The serializer keeps the octets of the channels of the current block in memory.
+ * The parser decodes the structure channel of a block first, recording the events,
+ * then the value channels, and delivers the recorded events one per parseNext() call.
+ * With COMPRESSION_THREAD_USE the DEFLATE streams are inflated on a separate thread,
+ * up to COMPRESSION_THREAD_QUEUE_SIZE streams ahead of the decoding. The DEFLATE
+ * streams are not length-prefixed, so they are found by inflating them in order:
+ * a single thread inflates while the thread of the parser decodes. That thread
+ * only inflates the streams the parser knows it will decode: the remaining streams
+ * of the current block and the structure stream of the next one. It does not read
+ * the input stream of the application past the stream of the end of the document.
+ * destroyParser() and resetParser() stop it; they do not wait for a read of the
+ * input stream in progress: the thread then frees its data when the read returns.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#ifndef BODYCHANNELS_H_
+#define BODYCHANNELS_H_
+
+#include "procTypes.h"
+#include "errorHandle.h"
+
+#if COMPRESSION_USE
+
+#include "contentHandler.h"
+#include "compressedIO.h"
+
+#if COMPRESSION_THREAD_USE
+# include <pthread.h>
+#endif
+
+/** A value channel with more values than this is a DEFLATE stream of its own */
+#define CHANNEL_SMALL_VALUE_COUNT 100
+
+/** The size of the buffer the serializer encodes the events and values into */
+#define CHANNEL_WINDOW_SIZE 256
+
+/**
+ * @name The kinds of the events recorded by the parser: the EXI_EVENT_* kinds and RECORD_VALUE
+ */
+/**@{*/
+#define RECORD_END_DOCUMENT   0
+#define RECORD_START_ELEMENT  1
+#define RECORD_END_ELEMENT    2
+#define RECORD_ATTRIBUTE      3
+#define RECORD_NAMESPACE      4
+#define RECORD_SELF_CONTAINED 5
+#define RECORD_INT            6
+#define RECORD_BOOLEAN        7
+#define RECORD_STRING         8
+#define RECORD_FLOAT          9
+#define RECORD_BINARY        10
+#define RECORD_DATE_TIME     11
+#define RECORD_DECIMAL       12
+#define RECORD_LIST          13
+#define RECORD_QNAME         14
+/** The position of a value in the structure channel; the value itself is in a value channel */
+#define RECORD_VALUE         15
+/**@}*/
+
+/**
+ * An event (or a value) recorded by the parser. The strings are
+ * either in the string tables or in BlockChannels.blockMem
+ */
+struct eventRecord
+{
+	unsigned char kind;
+	union
+	{
+		struct
+		{
+			String uri;
+			String localName;
+			String prefix;
+			boolean hasPrefix;
+		} qname;
+		struct
+		{
+			String ns;
+			String prefix;
+			boolean isLocal;
+		} ns;
+		Integer intVal;
+		boolean boolVal;
+		String strVal;
+		Float floatVal;
+		struct
+		{
+			char* val;
+			Index nbytes;
+		} binary;
+		EXIPDateTime dtVal;
+		Decimal decVal;
+		struct
+		{
+			EXITypeClass exiType;
+			unsigned int itemCount;
+		} list;
+		struct
+		{
+			Index typeId;
+			QNameID qnameId;
+			/** The next value of the same channel, INDEX_MAX if none */
+			Index next;
+			/** The records of the value in BlockChannels.values */
+			Index first;
+			Index count;
+		} value;
+	} data;
+};
+
+typedef struct eventRecord EventRecord;
+
+struct eventRecords
+{
+	DynArray dynArray;
+	EventRecord* record;
+	Index count;
+};
+
+/**
+ * A string value of a value channel that is encoded when the
+ * block is written, so that the string tables are updated in the order
+ * of the values in the EXI stream
+ */
+struct deferredString
+{
+	/** The position of the value in the octets of the channel */
+	Index offset;
+	String value;
+	QNameID qnameId;
+	Index typeId;
+	/** The next deferred string of the same channel, INDEX_MAX if none */
+	Index next;
+};
+
+typedef struct deferredString DeferredString;
+
+/**
+ * A value channel of the current block
+ */
+struct valueChannel
+{
+	QNameID qnameId;
+	/** The number of values in the channel */
+	Index valueCount;
+	/** Serializer: the encoded values except the deferred strings */
+	OctetBuffer data;
+	/** Serializer: the first and the last deferred strings;
+	 * parser: the first and the last RECORD_VALUE records. INDEX_MAX if none */
+	Index first;
+	Index last;
+};
+
+typedef struct valueChannel ValueChannel;
+
+#if COMPRESSION_THREAD_USE
+/**
+ * The DEFLATE streams inflated by the inflate thread ahead of the parser:
+ * a ring of COMPRESSION_THREAD_QUEUE_SIZE slots guarded by lock
+ */
+struct inflateQueue
+{
+	OctetBuffer slot[COMPRESSION_THREAD_QUEUE_SIZE];
+
+	/** The slot of the next (or, when holding, the current) stream of the parser */
+	Index head;
+
+	/** The number of inflated streams in the ring, including the one of the parser */
+	Index count;
+
+	/** TRUE while the parser decodes from slot[head] */
+	boolean holding;
+
+	/** Set by the parser to end the inflate thread */
+	boolean stop;
+
+	/** The error that ended the inflate thread; EXIP_OK while it runs.
+	 * EXIP_BUFFER_END_REACHED after the last stream of the input */
+	errorCode workerErr;
+
+	/** The number of streams the parser will decode, announced as the
+	 * structure channels are decoded; the thread does not inflate more */
+	Index announced;
+
+	/** The number of streams inflated by the thread */
+	Index inflated;
+
+	/** TRUE while the thread is in the read of the input stream of the application */
+	boolean reading;
+
+	/** Set by the parser when it is destroyed during a read of the thread:
+	 * the thread frees the BlockChannels when the read returns */
+	boolean orphan;
+
+	/** Called by the thread with released_data once the read of an orphan
+	 * returns; may be NULL */
+	void (*inputReleased)(void* app_data);
+	void* released_data;
+
+	/** The input buffer of the thread, replacing the one of the application
+	 * when the input is read from a stream; NULL otherwise */
+	char* input;
+
+	/** The input stream of the application */
+	IOStream appStrm;
+
+	/** TRUE once the thread, lock and cond are created */
+	boolean started;
+
+	pthread_t worker;
+	pthread_mutex_t lock;
+	/** Signaled when a stream is inflated or announced, a slot is freed or the thread ends */
+	pthread_cond_t cond;
+};
+#endif
+
+struct blockChannels
+{
+	/** The EXI stream of the application after the header */
+	CompressedIO cio;
+
+	/** The value channels of the current block in the order of their first value */
+	struct
+	{
+		DynArray dynArray;
+		ValueChannel* channel;
+		Index count;
+	} channels;
+
+	/** The number of entries of channels.channel with an initialized OctetBuffer */
+	Index channelsInit;
+
+	/** Open addressing hash from the qname of a channel to its index in channels */
+	Index* channelHash;
+	Index channelHashSize;
+
+	/** The number of values in the current block */
+	Index valueCount;
+
+	/** The strings of the current block */
+	AllocList blockMem;
+
+	/** The channel the encoded octets go to: index in channels or INDEX_MAX for the structure channel */
+	Index current;
+
+	/* Serializer */
+
+	/** The structure channel of the current block */
+	OctetBuffer structure;
+
+	/** The buffer of the EXIStream while the block is assembled; CHANNEL_WINDOW_SIZE + 1 octets */
+	char* window;
+
+	struct
+	{
+		DynArray dynArray;
+		DeferredString* str;
+		Index count;
+	} strings;
+
+	/** TRUE while the block is written to cio */
+	boolean flushing;
+
+	/* Parser */
+
+	/** The events of the current block; the values are RECORD_VALUE placeholders */
+	struct eventRecords events;
+
+	/** The values of the current block */
+	struct eventRecords values;
+
+	/** Where the recording handler stores the callbacks: events or values */
+	struct eventRecords* recording;
+
+	/** TRUE while the structure channel is decoded */
+	boolean deferValues;
+
+	/** TRUE when the ED event is in the current block */
+	boolean documentEnd;
+
+	/** The next event of the current block to deliver */
+	Index replayIndx;
+
+#if COMPRESSION_THREAD_USE
+	/** The inflated DEFLATE streams (compression only) */
+	struct inflateQueue queue;
+#else
+	/** The current inflated DEFLATE stream (compression only) */
+	OctetBuffer inflated;
+#endif
+};
+
+/**
+ * @brief Organizes the rest of the EXI body in blocks and channels. Invoked after
+ * the header is encoded/decoded when the alignment is compression or pre-compression.
+ * The serializer encodes into an internal buffer from then on.
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] encode TRUE for the serializer, FALSE for the parser
+ * @return Error handling code
+ */
+errorCode initBlockChannels(EXIStream* strm, boolean encode);
+
+/**
+ * @brief Frees the memory of strm->channels (if any) and sets it to NULL
+ *
+ * @param[in, out] strm EXI stream
+ */
+void destroyBlockChannels(EXIStream* strm);
+
+/**
+ * @brief Frees strm->channels as destroyBlockChannels() and calls inputReleased(app_data)
+ * once the input stream of the parser is no longer read: before returning or, with
+ * COMPRESSION_THREAD_USE, from the inflate thread when its read in progress returns
+ *
+ * @param[in, out] strm EXI stream of the parser
+ * @param[in] inputReleased called when the input stream is released; may be NULL
+ * @param[in] app_data passed to inputReleased
+ */
+void releaseBlockChannels(EXIStream* strm, void (*inputReleased)(void* app_data), void* app_data);
+
+/**
+ * @brief Directs the encoding of the next value to the value channel of qnameID.
+ * The values of xsi:type and xsi:nil stay in the structure channel.
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] qnameID the qname of the element or attribute of the value
+ * @return Error handling code
+ */
+errorCode enterValueChannel(EXIStream* strm, QNameID qnameID);
+
+/**
+ * @brief Directs the encoding back to the structure channel once the value
+ * (all the items of a list) is encoded. Writes the block when it has blockSize values.
+ *
+ * @param[in, out] strm EXI stream
+ * @return Error handling code
+ */
+errorCode leaveValueChannel(EXIStream* strm);
+
+/**
+ * @brief Stores a copy of a string value of a value channel to be encoded when the block is written
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] strng the string value
+ * @param[in] qnameID the qname of the element or attribute of the value
+ * @param[in] typeId the type of the value
+ * @return Error handling code
+ */
+errorCode deferStringData(EXIStream* strm, String strng, QNameID qnameID, Index typeId);
+
+/**
+ * @brief Writes the last block, points strm->buffer back to the buffer of the application
+ * and destroys the channels. Invoked after the ED event is encoded.
+ *
+ * @param[in, out] strm EXI stream
+ * @return Error handling code
+ */
+errorCode closeBlockChannels(EXIStream* strm);
+
+/**
+ * @brief Records a value placeholder in the structure channel and counts the value
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] typeId the type of the value
+ * @param[in] qnameID the qname of the element or attribute of the value
+ * @return Error handling code
+ */
+errorCode deferValueItem(EXIStream* strm, Index typeId, QNameID qnameID);
+
+/**
+ * @brief The parseNext() of the streams with channels: delivers the next recorded
+ * event of the current block, decoding the next block when needed
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] handler application content handler; NULL to store the events in the EventSink app_data
+ * @param[in] app_data Application data to be passed to the content handler callbacks
+ * @return Error handling code; EXIP_PARSING_COMPLETE after the ED event
+ */
+errorCode parseNextFromChannels(EXIStream* strm, ContentHandler* handler, void* app_data);
+
+/** TRUE when the string values are deferred by encodeStringData() */
+#define IS_STRING_DEFERRED(strm) ((strm)->channels != NULL && !(strm)->channels->flushing && (strm)->channels->current != INDEX_MAX)
+
+/** TRUE when the values are deferred by decodeValueItem() */
+#define IS_VALUE_DEFERRED(strm, qnameID) ((strm)->channels != NULL && (strm)->channels->deferValues && \
+		!((qnameID).uriId == XML_SCHEMA_INSTANCE_ID && ((qnameID).lnId == XML_SCHEMA_INSTANCE_TYPE_ID || (qnameID).lnId == XML_SCHEMA_INSTANCE_NIL_ID)))
+
+#else
+
+# define enterValueChannel(strm, qnameID) EXIP_OK
+# define leaveValueChannel(strm) EXIP_OK
+
+#endif /* COMPRESSION_USE */
+
+#endif /* BODYCHANNELS_H_ */
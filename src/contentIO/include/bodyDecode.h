@@ -18,6 +18,47 @@
 #define BODYDECODE_H_
 
 #include "contentHandler.h"
+#include "EXIParser.h"
+
+/**
+ * The events of parseNextBatch(). The decoding functions given a NULL handler
+ * store the events they decode in the EventSink passed as app_data instead of
+ * invoking callbacks. The strings of the events are views into the string tables,
+ * the schema or the input buffer while these keep them unchanged until the next call;
+ * the others are decoded (or copied) into mem.
+ */
+struct eventSink
+{
+	/** The array of the application, its size and the number of events stored in it */
+	EXIEvent* event;
+	Index size;
+	Index count;
+
+	/** The events that did not fit in the array */
+	struct
+	{
+		DynArray dynArray;
+		EXIEvent* event;
+		Index count;
+	} pending;
+
+	/** The memory of the strings and binary values that are not views and of
+	 * the arguments the events point to */
+	AllocList* mem;
+};
+
+typedef struct eventSink EventSink;
+
+/**
+ * @brief Stores an event in the array of the sink or, when it is full, in the pending events
+ *
+ * @param[in, out] sink the events
+ * @param[in] kind one of EXI_EVENT_*
+ * @param[in] qnameId the element or attribute of the event; {URI_MAX, LN_MAX} if none
+ * @param[out] ev the event; its data is set by the caller
+ * @return Error handling code
+ */
+errorCode addSinkEvent(EventSink* sink, unsigned char kind, QNameID qnameId, EXIEvent** ev);
 
 /**
  * @brief Process the next grammar production in the Current Grammar
@@ -25,7 +66,7 @@
  * Returns the terminal symbol of the production i.e. the EXI Event Type;
  * @param[in] strm EXI stream of bits
  * @param[out] nonTermID_out unique identifier of right-hand side Non-terminal
- * @param[in] handler content handler callbacks
+ * @param[in] handler content handler callbacks; NULL to store the events in the EventSink app_data
  * @param[in] app_data Application data to be passed to the content handler callbacks
  * @return Error handling code
  */
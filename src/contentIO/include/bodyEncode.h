@@ -32,6 +32,21 @@
  */
 errorCode encodeProduction(EXIStream* strm, EventTypeClass eventClass, boolean isSchemaType, QName* qname, EXITypeClass chTypeClass, Production* prodHit);
 
+/**
+ * @brief encodeProduction() with the qname of the SE or AT event already resolved to its QNameID
+ * in the string tables of the stream
+ * @param[in, out] strm EXI stream
+ * @param[in] eventClass event class type to be looked up
+ * @param[in] isSchemaType determine if the data type should be encoded as non-schema type
+ * @param[in] qname element or attribute QName in case of SE or AT events; NULL otherwise
+ * @param[in] qnameID the QNameID of qname; a URI or local name that is not in the string tables
+ * has the ID it gets once added. {URI_MAX, LN_MAX} for the events other than SE and AT
+ * @param[in] chTypeClass the type of the "value" content of CH EXI events; if not CH event then VALUE_TYPE_NONE_CLASS
+ * @param[out] prodHit the matched grammar production
+ * @return Error handling code
+ */
+errorCode encodeProductionID(EXIStream* strm, EventTypeClass eventClass, boolean isSchemaType, QName* qname, QNameID qnameID, EXITypeClass chTypeClass, Production* prodHit);
+
 /**
  * @brief Encodes String value into EXI stream
  * @param[in, out] strm EXI stream
@@ -54,6 +69,17 @@ errorCode encodeStringData(EXIStream* strm, String strng, QNameID qnameID, Index
  */
 errorCode encodeQName(EXIStream* strm, QName qname, EventType eventT, QNameID* qnameID);
 
+/**
+ * @brief Encodes a QName that is in the URI and local-name string tables of the stream
+ * without looking it up
+ * @param[in, out] strm EXI stream
+ * @param[in] qname qname to be written; only the prefix is used
+ * @param[in] eventT (EVENT_SE_ALL or EVENT_AT_ALL) used for error checking purposes as in encodeQName()
+ * @param[in] qnameID the QName ID
+ * @return Error handling code
+ */
+errorCode encodeQNameID(EXIStream* strm, QName* qname, EventType eventT, QNameID qnameID);
+
 /**
  * @brief Encodes URI into EXI stream
  * @param[in, out] strm EXI stream
@@ -23,6 +23,49 @@
 #include "sTables.h"
 #include "grammars.h"
 #include "initSchemaInstance.h"
+#include "bodyChannels.h"
+#include "dynamicArray.h"
+#include "stringManipulate.h"
+#include "schemaRegistry.h"
+
+/** The number of entries the arrays of EventBatch grow with */
+#define BATCH_CHUNK_ENTRIES 16
+
+/**
+ * The state of parseNextBatch()
+ */
+struct eventBatch
+{
+	/** The events of the current call; the decoder stores them with a NULL handler */
+	EventSink sink;
+
+	/** The next pending event to store */
+	Index pendingIndx;
+
+	/** The strings and binary values that are not views. The events decoded by a call
+	 * use mem[current]; the other list keeps those of the events of the previous call,
+	 * some of which are pending */
+	AllocList mem[2];
+	unsigned char current;
+
+	/** TRUE once the end of the document is decoded */
+	boolean complete;
+
+#if COMPRESSION_USE
+	/** With channels the events are replayed after the decoding: the elements
+	 * of the events delivered so far */
+	struct
+	{
+		DynArray dynArray;
+		QNameID* qnameId;
+		Index count;
+	} elements;
+
+	/** The attribute of the next valueCount values */
+	QNameID attr;
+	Index valueCount;
+#endif
+};
 
 /**
  * The handler to be used by the applications to parse EXI streams
@@ -32,13 +75,73 @@ const EXIParser parse ={initParser,
 						setSchema,
 						parseNext,
 						pushEXIData,
-						destroyParser};
+						destroyParser,
+						resetParser,
+						parseNextBatch,
+						getQNameStrings};
+
+static void initParserState(Parser* parser, BinaryBuffer buffer, void* app_data);
+static errorCode bindRegistrySchema(Parser* parser);
+static void releaseRegistrySchema(SchemaRegistry* registry, EXIPSchema* schema);
+static errorCode endProduction(EXIStream* strm, SmallIndex nonTermID);
+static errorCode createEventBatch(Parser* parser);
+static void destroyEventBatch(Parser* parser);
+static void releaseInput(Parser* parser);
+#if COMPRESSION_USE
+static void setChannelQNameIDs(EventBatch* batch, Index first, Index firstPending);
+#endif
 
 errorCode initParser(Parser* parser, BinaryBuffer buffer, void* app_data)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	TRY(initAllocList(&parser->strm.memList));
 
+	initGrammarStack(&parser->strm);
+	initParserState(parser, buffer, app_data);
+#if BINARY_ZERO_COPY_USE
+	parser->strm.binaryScratch = NULL;
+	parser->strm.binaryScratchSize = 0;
+#endif
+	initContentHandler(&parser->handler);
+	parser->batch = NULL;
+	parser->registry = NULL;
+	parser->inputReleased = NULL;
+
+	return EXIP_OK;
+}
+
+errorCode resetParser(Parser* parser, BinaryBuffer buffer, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	SchemaRegistry* registry = parser->strm.registry;
+	EXIPSchema* schema = parser->strm.schema;
+
+	releaseInput(parser);
+	tmp_err_code = resetAllMem(&parser->strm);
+	releaseRegistrySchema(registry, schema);
+	if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	initParserState(parser, buffer, app_data);
+
+	if(parser->batch != NULL)
+	{
+		parser->batch->sink.pending.count = 0;
+		parser->batch->pendingIndx = 0;
+		parser->batch->complete = FALSE;
+		TRY(resetAllocList(&parser->batch->mem[0]));
+		TRY(resetAllocList(&parser->batch->mem[1]));
+#if COMPRESSION_USE
+		parser->batch->elements.count = 0;
+		parser->batch->valueCount = 0;
+#endif
+	}
+
+	return EXIP_OK;
+}
+
+static void initParserState(Parser* parser, BinaryBuffer buffer, void* app_data)
+{
 	parser->strm.buffer = buffer;
 	parser->strm.context.bitPointer = 0;
 	parser->strm.context.bufferIndx = 0;
@@ -48,19 +151,26 @@ errorCode initParser(Parser* parser, BinaryBuffer buffer, void* app_data)
 	parser->strm.context.isNilType = FALSE;
 	parser->strm.context.attrTypeId = INDEX_MAX;
 	parser->strm.gStack = NULL;
+	parser->strm.grammarStack.depth = 0;
 	parser->strm.valueTable.value = NULL;
 	parser->strm.valueTable.count = 0;
 	parser->app_data = app_data;
 	parser->strm.schema = NULL;
+	parser->strm.registry = NULL;
+	parser->strm.uriTable.uri = NULL;
+	parser->strm.uriTable.count = 0;
+#if BUILD_IN_GRAMMARS_USE
+	parser->strm.builtInGrammars.grammar = NULL;
+	parser->strm.builtInGrammars.count = 0;
+#endif
     makeDefaultOpts(&parser->strm.header.opts);
 
-	initContentHandler(&parser->handler);
-
 #if HASH_TABLE_USE
 	parser->strm.valueTable.hashTbl = NULL;
 #endif
-
-	return EXIP_OK;
+#if COMPRESSION_USE
+	parser->strm.channels = NULL;
+#endif
 }
 
 errorCode parseHeader(Parser* parser, boolean outOfBandOpts)
@@ -69,11 +179,24 @@ errorCode parseHeader(Parser* parser, boolean outOfBandOpts)
 
 	TRY(decodeHeader(&parser->strm, outOfBandOpts));
 
+#if COMPRESSION_USE
+	if(WITH_COMPRESSION(parser->strm.header.opts.enumOpt) ||
+			GET_ALIGNMENT(parser->strm.header.opts.enumOpt) == PRE_COMPRESSION)
+	{
+		TRY(initBlockChannels(&parser->strm, FALSE));
+	}
+#endif
+
 	if(parser->strm.header.opts.valuePartitionCapacity > 0)
 	{
 		TRY(createValueTable(&parser->strm.valueTable));
 	}
 
+	if(parser->registry != NULL && parser->strm.header.opts.schemaIDMode != SCHEMA_ID_ABSENT)
+	{
+		TRY(bindRegistrySchema(parser));
+	}
+
 	// The parsing of the header is successful
 	// TODO: Consider removing the startDocument all together instead of invoking it always here?
 	if(parser->handler.startDocument != NULL)
@@ -171,20 +294,63 @@ errorCode setSchema(Parser* parser, EXIPSchema* schema)
 		}
 	}
 
+	TRY(createStreamUriTable(&parser->strm));
+	setEventCodeTables(&parser->strm);
+
 	{
 		QNameID emptyQNameID = {URI_MAX, LN_MAX};
-		TRY(pushGrammar(&parser->strm.gStack, emptyQNameID, &parser->strm.schema->docGrammar));
+		TRY(pushGrammar(&parser->strm, emptyQNameID, &parser->strm.schema->docGrammar));
 	}
 
 	return EXIP_OK;
 }
 
+/**
+ * setSchema() with the schema of the schemaId of the header acquired from parser->registry.
+ * The schema is released when the stream is closed or, if not bound, right away
+ */
+static errorCode bindRegistrySchema(Parser* parser)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIPSchema* schema = NULL;
+
+	if(parser->strm.header.opts.schemaIDMode == SCHEMA_ID_SET)
+	{
+		TRY(acquireSchema(parser->registry, &parser->strm.header.opts.schemaID, &schema));
+	}
+
+	tmp_err_code = setSchema(parser, schema);
+	if(schema != NULL)
+	{
+		if(parser->strm.schema == schema)
+			parser->strm.registry = parser->registry;
+		else
+			releaseSchema(parser->registry, schema);
+	}
+
+	return tmp_err_code;
+}
+
+/**
+ * Releases the schema of a stream after its memory is freed
+ */
+static void releaseRegistrySchema(SchemaRegistry* registry, EXIPSchema* schema)
+{
+	if(registry != NULL)
+		releaseSchema(registry, schema);
+}
+
 errorCode parseNext(Parser* parser)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	SmallIndex tmpNonTermID = GR_VOID_NON_TERMINAL;
 	StreamContext savedContext = parser->strm.context;
 
+#if COMPRESSION_USE
+	if(parser->strm.channels != NULL)
+		return parseNextFromChannels(&parser->strm, &parser->handler, parser->app_data);
+#endif
+
 	tmp_err_code = processNextProduction(&parser->strm, &tmpNonTermID, &parser->handler, parser->app_data);
 	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
 		parser->strm.context = savedContext;
@@ -195,26 +361,146 @@ errorCode parseNext(Parser* parser)
 		return tmp_err_code;
 	}
 
-	if(tmpNonTermID == GR_VOID_NON_TERMINAL)
+	return endProduction(&parser->strm, tmpNonTermID);
+}
+
+/**
+ * Sets the non-terminal of the current grammar after a production,
+ * popping the grammar when its end is reached
+ *
+ * @return EXIP_PARSING_COMPLETE when the grammar stack is empty
+ */
+static errorCode endProduction(EXIStream* strm, SmallIndex nonTermID)
+{
+	if(nonTermID == GR_VOID_NON_TERMINAL)
 	{
-		popGrammar(&(parser->strm.gStack));
-		if(parser->strm.gStack == NULL) // There is no more grammars in the stack
+		popGrammar(strm);
+		if(strm->gStack == NULL) // There is no more grammars in the stack
 		{
 			return EXIP_PARSING_COMPLETE; // The stream is parsed
 		}
 	}
 	else
 	{
-		parser->strm.gStack->currNonTermID = tmpNonTermID;
+		strm->gStack->currNonTermID = nonTermID;
+	}
+
+	return EXIP_OK;
+}
+
+errorCode parseNextBatch(Parser* parser, EXIEvent* events, Index size, Index* count)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventBatch* batch;
+	SmallIndex tmpNonTermID;
+	StreamContext savedContext;
+	Index first;
+	Index firstPending;
+
+	*count = 0;
+	if(size == 0)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	if(parser->batch == NULL)
+	{
+		TRY(createEventBatch(parser));
+	}
+
+	batch = parser->batch;
+	batch->sink.event = events;
+	batch->sink.size = size;
+	batch->sink.count = 0;
+
+	// The events kept by the previous call come first. Their strings stay
+	// in the memory of the previous call
+	while(batch->pendingIndx < batch->sink.pending.count && batch->sink.count < size)
+	{
+		events[batch->sink.count] = batch->sink.pending.event[batch->pendingIndx];
+		batch->sink.count += 1;
+		batch->pendingIndx += 1;
+	}
+
+	*count = batch->sink.count;
+	if(batch->pendingIndx < batch->sink.pending.count)
+		return EXIP_OK;
+
+	batch->sink.pending.count = 0;
+	batch->pendingIndx = 0;
+
+	// The memory of the call before the previous one is reused
+	batch->current ^= 1;
+	TRY(resetAllocList(&batch->mem[batch->current]));
+	batch->sink.mem = &batch->mem[batch->current];
+
+	while(!batch->complete && batch->sink.count < size)
+	{
+		first = batch->sink.count;
+		firstPending = batch->sink.pending.count;
+
+#if COMPRESSION_USE
+		if(parser->strm.channels != NULL)
+		{
+			tmp_err_code = parseNextFromChannels(&parser->strm, NULL, &batch->sink);
+			if(tmp_err_code != EXIP_OK && tmp_err_code != EXIP_PARSING_COMPLETE)
+				return tmp_err_code;
+			setChannelQNameIDs(batch, first, firstPending);
+		}
+		else
+#endif
+		{
+			savedContext = parser->strm.context;
+			tmpNonTermID = GR_VOID_NON_TERMINAL;
+
+			tmp_err_code = processNextProduction(&parser->strm, &tmpNonTermID, NULL, &batch->sink);
+			if(tmp_err_code != EXIP_OK)
+			{
+				// The events of an incomplete production are dropped; the production
+				// is decoded again by the next call
+				batch->sink.count = first;
+				batch->sink.pending.count = firstPending;
+				*count = first;
+				if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+					parser->strm.context = savedContext;
+				return tmp_err_code;
+			}
+
+			tmp_err_code = endProduction(&parser->strm, tmpNonTermID);
+		}
+
+		if(tmp_err_code == EXIP_PARSING_COMPLETE)
+			batch->complete = TRUE;
+		else if(tmp_err_code != EXIP_OK)
+			return tmp_err_code;
 	}
 
+	*count = batch->sink.count;
+	if(batch->complete && batch->sink.pending.count == 0)
+		return EXIP_PARSING_COMPLETE;
+
+	return EXIP_OK;
+}
+
+errorCode getQNameStrings(Parser* parser, QNameID qnameId, String* uri, String* localName)
+{
+	UriTable* uriTable = &parser->strm.uriTable;
+
+	if(qnameId.uriId >= uriTable->count || qnameId.lnId >= uriTable->uri[qnameId.uriId].lnTable.count)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	*uri = uriTable->uri[qnameId.uriId].uriStr;
+	*localName = uriTable->uri[qnameId.uriId].lnTable.ln[qnameId.lnId].lnStr;
+
 	return EXIP_OK;
 }
 
 errorCode pushEXIData(char* inBuf, unsigned int bufSize, unsigned int* bytesRead, Parser* parser)
 {
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	Index bytesCopied = parser->strm.buffer.bufContent - parser->strm.context.bufferIndx;
 
+	*bytesRead = 0;
+	TRY(checkNonBlockingOptions(&parser->strm.header.opts));
+
 	*bytesRead = parser->strm.buffer.bufLen - bytesCopied;
 	if(*bytesRead > bufSize)
 		*bytesRead = bufSize;
@@ -239,10 +525,127 @@ errorCode pushEXIData(char* inBuf, unsigned int bufSize, unsigned int* bytesRead
 
 void destroyParser(Parser* parser)
 {
-	while(parser->strm.gStack != NULL)
+	releaseInput(parser);
+	destroyEventBatch(parser);
+	freeAllMem(&parser->strm);
+	releaseRegistrySchema(parser->strm.registry, parser->strm.schema);
+	parser->strm.registry = NULL;
+}
+
+/**
+ * Ends the reading of the input stream of the parser: parser->inputReleased is
+ * called now or, with COMPRESSION_THREAD_USE, when the read of the inflate thread returns
+ */
+static void releaseInput(Parser* parser)
+{
+#if COMPRESSION_USE
+	releaseBlockChannels(&parser->strm, parser->inputReleased, parser->app_data);
+#else
+	if(parser->inputReleased != NULL)
+		parser->inputReleased(parser->app_data);
+#endif
+}
+
+static errorCode createEventBatch(Parser* parser)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventBatch* batch;
+
+	batch = (EventBatch*) EXIP_MALLOC(sizeof(EventBatch));
+	if(batch == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	batch->sink.event = NULL;
+	batch->sink.size = 0;
+	batch->sink.count = 0;
+	batch->sink.mem = NULL;
+	batch->pendingIndx = 0;
+	batch->current = 0;
+	batch->complete = FALSE;
+
+	TRY_CATCH(createDynArray(&batch->sink.pending.dynArray, sizeof(EXIEvent), BATCH_CHUNK_ENTRIES), EXIP_MFREE(batch));
+	TRY_CATCH(initAllocList(&batch->mem[0]), destroyDynArray(&batch->sink.pending.dynArray); EXIP_MFREE(batch));
+	TRY_CATCH(initAllocList(&batch->mem[1]), freeAllocList(&batch->mem[0]); destroyDynArray(&batch->sink.pending.dynArray); EXIP_MFREE(batch));
+#if COMPRESSION_USE
+	TRY_CATCH(createDynArray(&batch->elements.dynArray, sizeof(QNameID), BATCH_CHUNK_ENTRIES),
+			freeAllocList(&batch->mem[1]); freeAllocList(&batch->mem[0]); destroyDynArray(&batch->sink.pending.dynArray); EXIP_MFREE(batch));
+	batch->valueCount = 0;
+#endif
+
+	parser->batch = batch;
+
+	return EXIP_OK;
+}
+
+static void destroyEventBatch(Parser* parser)
+{
+	if(parser->batch == NULL)
+		return;
+
+	destroyDynArray(&parser->batch->sink.pending.dynArray);
+	freeAllocList(&parser->batch->mem[0]);
+	freeAllocList(&parser->batch->mem[1]);
+#if COMPRESSION_USE
+	destroyDynArray(&parser->batch->elements.dynArray);
+#endif
+	EXIP_MFREE(parser->batch);
+	parser->batch = NULL;
+}
+
+#if COMPRESSION_USE
+/**
+ * Sets the qnameId of the events stored by the delivery of a recorded event:
+ * from first in the array and from firstPending in the pending events.
+ * The ids of the elements and attributes are set by the delivery; those of
+ * the end elements and of the values follow from them
+ */
+static void setChannelQNameIDs(EventBatch* batch, Index first, Index firstPending)
+{
+	EXIEvent* ev;
+	Index end = batch->sink.count + batch->sink.pending.count - firstPending;
+	Index i;
+	Index elemIndx;
+	QNameID* elem;
+
+	for(i = first; i < end; i++)
 	{
-		popGrammar(&parser->strm.gStack);
-	}
+		if(i < batch->sink.count)
+			ev = &batch->sink.event[i];
+		else
+			ev = &batch->sink.pending.event[firstPending + i - batch->sink.count];
 
-	freeAllMem(&parser->strm);
+		switch(ev->kind)
+		{
+			case EXI_EVENT_START_ELEMENT:
+			case EXI_EVENT_ATTRIBUTE:
+				if(ev->kind == EXI_EVENT_ATTRIBUTE)
+				{
+					batch->attr = ev->qnameId;
+					batch->valueCount = 1;
+				}
+				else if(addEmptyDynEntry(&batch->elements.dynArray, (void**) &elem, &elemIndx) == EXIP_OK)
+					*elem = ev->qnameId;
+			break;
+			case EXI_EVENT_END_ELEMENT:
+				if(batch->elements.count > 0)
+				{
+					batch->elements.count -= 1;
+					ev->qnameId = batch->elements.qnameId[batch->elements.count];
+				}
+			break;
+			default:
+				if(ev->kind < EXI_EVENT_INT)
+					break;
+				if(batch->valueCount > 0)
+				{
+					ev->qnameId = batch->attr;
+					batch->valueCount -= 1;
+					if(ev->kind == EXI_EVENT_LIST)
+						batch->valueCount += ev->data.list.itemCount;
+				}
+				else if(batch->elements.count > 0)
+					ev->qnameId = batch->elements.qnameId[batch->elements.count - 1];
+		}
+	}
 }
+#endif
@@ -24,9 +24,12 @@
 #include "hashtable.h"
 #include "stringManipulate.h"
 #include "streamEncode.h"
+#include "streamWrite.h"
 #include "initSchemaInstance.h"
 #include "ioUtil.h"
 #include "streamEncode.h"
+#include "bodyChannels.h"
+#include "schemaRegistry.h"
 
 /**
  * The handler to be used by the applications to serialize EXI streams
@@ -36,6 +39,8 @@ const EXISerializer serialize ={startDocument,
 								startElement,
 								endElement,
 								attribute,
+								startElementH,
+								attributeH,
 								intData,
 								booleanData,
 								stringData,
@@ -45,14 +50,27 @@ const EXISerializer serialize ={startDocument,
 								decimalData,
 								listData,
 								qnameData,
+								stringDataBegin,
+								stringDataChunk,
+								stringDataEnd,
+								binaryDataBegin,
+								binaryDataChunk,
+								binaryDataEnd,
 								processingInstruction,
 								namespaceDeclaration,
 								encodeHeader,
 								selfContained,
 								initHeader,
 								initStream,
+								initStreamSchemaId,
 								closeEXIStream,
-								flushEXIData};
+								flushEXIData,
+								resolveQNameHandle};
+
+static errorCode encodeStartElement(EXIStream* strm, QName qname, const QNameHandle* handle, EXITypeClass* valueType);
+static errorCode encodeAttribute(EXIStream* strm, QName qname, const QNameHandle* handle, boolean isSchemaType, EXITypeClass* valueType);
+static errorCode encodeStringValueEvent(EXIStream* strm, QNameID* qnameID, Index* typeId);
+static errorCode encodeBinaryValueEvent(EXIStream* strm, QNameID* qnameID);
 
 #if EXI_PROFILE_DEFAULT
 
@@ -89,10 +107,25 @@ errorCode initStream(EXIStream* strm, BinaryBuffer buffer, EXIPSchema* schema)
 	strm->context.expectATData = FALSE;
 	strm->context.isNilType = FALSE;
 	strm->context.attrTypeId = INDEX_MAX;
-	strm->gStack = NULL;
+	strm->context.valueRemaining = 0;
+	initGrammarStack(strm);
 	strm->valueTable.value = NULL;
 	strm->valueTable.count = 0;
 	strm->schema = NULL;
+	strm->registry = NULL;
+	strm->uriTable.uri = NULL;
+	strm->uriTable.count = 0;
+#if BUILD_IN_GRAMMARS_USE
+	strm->builtInGrammars.grammar = NULL;
+	strm->builtInGrammars.count = 0;
+#endif
+#if BINARY_ZERO_COPY_USE
+	strm->binaryScratch = NULL;
+	strm->binaryScratchSize = 0;
+#endif
+#if COMPRESSION_USE
+	strm->channels = NULL;
+#endif
 
 	if(strm->header.opts.valuePartitionCapacity > 0)
 	{
@@ -189,9 +222,12 @@ errorCode initStream(EXIStream* strm, BinaryBuffer buffer, EXIPSchema* schema)
 		}
 	}
 
+	TRY(createStreamUriTable(strm));
+	setEventCodeTables(strm);
+
 	{
 		QNameID emptyQNameID = {URI_MAX, LN_MAX};
-		TRY(pushGrammar(&strm->gStack, emptyQNameID, &strm->schema->docGrammar));
+		TRY(pushGrammar(strm, emptyQNameID, &strm->schema->docGrammar));
 	}
 	// #DOCUMENT#
 	// Hashtable for fast look-up of global values in the table.
@@ -204,7 +240,7 @@ errorCode initStream(EXIStream* strm, BinaryBuffer buffer, EXIPSchema* schema)
 	if(strm->header.opts.valuePartitionCapacity > DEFAULT_VALUE_ENTRIES_NUMBER &&
 			strm->header.opts.valueMaxLength > 0)
 	{
-		strm->valueTable.hashTbl = create_hashtable(INITIAL_HASH_TABLE_SIZE, djbHash, stringEqual);
+		strm->valueTable.hashTbl = create_hashtable(INITIAL_HASH_TABLE_SIZE, wordHash, stringEqual);
 		if(strm->valueTable.hashTbl == NULL)
 			return EXIP_HASH_TABLE_ERROR;
 	}
@@ -227,7 +263,7 @@ errorCode startDocument(EXIStream* strm)
 errorCode endDocument(EXIStream* strm)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+	Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">End doc serialization\n"));
 
 	if(strm->gStack->grammar == NULL)
@@ -235,16 +271,39 @@ errorCode endDocument(EXIStream* strm)
 
 	tmp_err_code = encodeProduction(strm, EVENT_ED_CLASS, TRUE, NULL, VALUE_TYPE_NONE_CLASS, &prodHit);
 
+#if COMPRESSION_USE
+	// Write the last block to the buffer of the application
+	if(tmp_err_code == EXIP_OK && strm->channels != NULL)
+		tmp_err_code = closeBlockChannels(strm);
+#endif
+
 	// Store the size of the encoded stream contained in the BinaryBuffer in the BinaryBuffer.bufContent
 	strm->buffer.bufContent = strm->context.bufferIndx + (strm->context.bitPointer > 0);
 
 	return tmp_err_code;
 }
 
+/** TRUE when the qname of the handle can be encoded by its IDs in the stream */
+#define IS_HANDLE_RESOLVED(strm, handle) ((handle)->qnameId.uriId != URI_MAX && (handle)->schema == (strm)->schema)
+
 errorCode startElement(EXIStream* strm, QName qname, EXITypeClass* valueType)
+{
+	return encodeStartElement(strm, qname, NULL, valueType);
+}
+
+errorCode startElementH(EXIStream* strm, const QNameHandle* handle, EXITypeClass* valueType)
+{
+	return encodeStartElement(strm, handle->qname, IS_HANDLE_RESOLVED(strm, handle) ? handle : NULL, valueType);
+}
+
+/**
+ * @brief The SE event of startElement() and startElementH()
+ * @param[in] handle the resolved qname; NULL when the qname is looked up in the string tables
+ */
+static errorCode encodeStartElement(EXIStream* strm, QName qname, const QNameHandle* handle, EXITypeClass* valueType)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+	Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start element serialization\n"));
 
@@ -262,44 +321,56 @@ errorCode startElement(EXIStream* strm, QName qname, EXITypeClass* valueType)
 
 	*valueType = VALUE_TYPE_NONE_CLASS;
 
-	TRY(encodeProduction(strm, EVENT_SE_CLASS, TRUE, &qname, VALUE_TYPE_NONE_CLASS, &prodHit));
+	if(handle != NULL)
+	{
+		TRY(encodeProductionID(strm, EVENT_SE_CLASS, TRUE, &qname, handle->qnameId, VALUE_TYPE_NONE_CLASS, &prodHit));
+	}
+	else
+	{
+		TRY(encodeProduction(strm, EVENT_SE_CLASS, TRUE, &qname, VALUE_TYPE_NONE_CLASS, &prodHit));
+	}
 
 	if(GET_PROD_EXI_EVENT(prodHit.content) == EVENT_SE_ALL)
 	{
 		EXIGrammar* elemGrammar = NULL;
 		QNameID tmpQid;
 
-		TRY(encodeQName(strm, qname, EVENT_SE_ALL, &tmpQid));
+		if(handle != NULL)
+		{
+			tmpQid = handle->qnameId;
+			TRY(encodeQNameID(strm, &qname, EVENT_SE_ALL, tmpQid));
+		}
+		else
+		{
+			TRY(encodeQName(strm, qname, EVENT_SE_ALL, &tmpQid));
+		}
 
 		// New element grammar is pushed on the stack
 #if EXI_PROFILE_DEFAULT
-		if(GET_LN_URI_QNAME(strm->schema->uriTable, tmpQid).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+		if(GET_LN_URI_QNAME(strm->uriTable, tmpQid).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 			elemGrammar = NULL;
 		else
 #endif
-		elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, tmpQid);
+		if(handle != NULL && handle->elemGrammar != INDEX_MAX)
+			elemGrammar = &strm->schema->grammarTable.grammar[handle->elemGrammar];
+		else
+			elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, tmpQid);
 
 		if(elemGrammar != NULL) // The grammar is found
 		{
-			TRY(pushGrammar(&(strm->gStack), tmpQid, elemGrammar));
+			TRY(pushGrammar(strm, tmpQid, elemGrammar));
 		}
 		else
 		{
 #if BUILD_IN_GRAMMARS_USE
-			EXIGrammar newElementGrammar;
-			Index dynArrIndx;
-			TRY(createBuiltInElementGrammar(&newElementGrammar, strm));
-
-			TRY(addDynEntry(&strm->schema->grammarTable.dynArray, &newElementGrammar, &dynArrIndx));
-
-			GET_LN_URI_QNAME(strm->schema->uriTable, tmpQid).elemGrammar = dynArrIndx;
-			TRY(pushGrammar(&(strm->gStack), tmpQid, &strm->schema->grammarTable.grammar[dynArrIndx]));
+			TRY(addBuiltInElementGrammar(strm, tmpQid, &elemGrammar));
+			TRY(pushGrammar(strm, tmpQid, elemGrammar));
 #elif EXI_PROFILE_DEFAULT
 			// Leave the grammar NULL - if the next event is valid AT(xsi:type)
 			// then its value will be the next grammar.
 			// If the next event is not valid AT(xsi:type) - then the event
 			// AT(xsi:type="anyType") will be inserted beforehand
-			TRY(pushGrammar(&(strm->gStack), tmpQid, elemGrammar));
+			TRY(pushGrammar(strm, tmpQid, elemGrammar));
 
 			return EXIP_OK;
 #else
@@ -312,21 +383,23 @@ errorCode startElement(EXIStream* strm, QName qname, EXITypeClass* valueType)
 	else if(GET_PROD_EXI_EVENT(prodHit.content) == EVENT_SE_QNAME)
 	{
 		EXIGrammar* elemGrammar = NULL;
+		QNameID tmpQid;
 
-		TRY(encodePfxQName(strm, &qname, EVENT_SE_QNAME, prodHit.qnameId.uriId));
+		GET_PROD_QNAME_ID(&prodHit, tmpQid);
+		TRY(encodePfxQName(strm, &qname, EVENT_SE_QNAME, tmpQid.uriId));
 
 		// New element grammar is pushed on the stack
 		if(IS_BUILT_IN_ELEM(strm->gStack->grammar->props))  // If the current grammar is build-in Element grammar ...
 		{
-			elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, prodHit.qnameId);
+			elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, tmpQid);
 		}
 		else
 		{
-			elemGrammar = &strm->schema->grammarTable.grammar[prodHit.typeId];
+			elemGrammar = &strm->schema->grammarTable.grammar[GET_PROD_TYPE_ID(&prodHit)];
 		}
 
 		if(elemGrammar != NULL) // The grammar is found
-			TRY(pushGrammar(&(strm->gStack), prodHit.qnameId, elemGrammar));
+			TRY(pushGrammar(strm, tmpQid, elemGrammar));
 		else
 			return EXIP_INCONSISTENT_PROC_STATE;  // The event require the presence of Element Grammar previously created
 	}
@@ -341,10 +414,10 @@ errorCode startElement(EXIStream* strm, QName qname, EXITypeClass* valueType)
 		if(GET_PROD_EXI_EVENT(currentRule->production[currentRule->pCount-1].content) == EVENT_CH)
 		{
 			// This must be simple type grammar
-			if(currentRule->production[currentRule->pCount-1].typeId == INDEX_MAX)
+			if(GET_PROD_TYPE_ID(&currentRule->production[currentRule->pCount-1]) == INDEX_MAX)
 				*valueType = VALUE_TYPE_UNTYPED_CLASS;
 			else
-				*valueType = GET_VALUE_TYPE_CLASS(GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[currentRule->production[currentRule->pCount-1].typeId].content));
+				*valueType = GET_VALUE_TYPE_CLASS(GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[GET_PROD_TYPE_ID(&currentRule->production[currentRule->pCount-1])].content));
 		}
 	}
 
@@ -354,7 +427,7 @@ errorCode startElement(EXIStream* strm, QName qname, EXITypeClass* valueType)
 errorCode endElement(EXIStream* strm)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+	Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">End element serialization\n"));
 
@@ -373,7 +446,7 @@ errorCode endElement(EXIStream* strm)
 	TRY(encodeProduction(strm, EVENT_EE_CLASS, TRUE, NULL, VALUE_TYPE_NONE_CLASS, &prodHit));
 
 	if(strm->gStack->currNonTermID == GR_VOID_NON_TERMINAL)
-		popGrammar(&(strm->gStack));
+		popGrammar(strm);
 	else
 		return EXIP_INCONSISTENT_PROC_STATE;
 
@@ -381,9 +454,23 @@ errorCode endElement(EXIStream* strm)
 }
 
 errorCode attribute(EXIStream* strm, QName qname, boolean isSchemaType, EXITypeClass* valueType)
+{
+	return encodeAttribute(strm, qname, NULL, isSchemaType, valueType);
+}
+
+errorCode attributeH(EXIStream* strm, const QNameHandle* handle, boolean isSchemaType, EXITypeClass* valueType)
+{
+	return encodeAttribute(strm, handle->qname, IS_HANDLE_RESOLVED(strm, handle) ? handle : NULL, isSchemaType, valueType);
+}
+
+/**
+ * @brief The AT event of attribute() and attributeH()
+ * @param[in] handle the resolved qname; NULL when the qname is looked up in the string tables
+ */
+static errorCode encodeAttribute(EXIStream* strm, QName qname, const QNameHandle* handle, boolean isSchemaType, EXITypeClass* valueType)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+	Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start attribute serialization\n"));
 
@@ -445,16 +532,31 @@ errorCode attribute(EXIStream* strm, QName qname, boolean isSchemaType, EXITypeC
 	}
 #endif
 
-	TRY(encodeProduction(strm, EVENT_AT_CLASS, isSchemaType, &qname, VALUE_TYPE_NONE_CLASS, &prodHit));
+	if(handle != NULL)
+	{
+		TRY(encodeProductionID(strm, EVENT_AT_CLASS, isSchemaType, &qname, handle->qnameId, VALUE_TYPE_NONE_CLASS, &prodHit));
+	}
+	else
+	{
+		TRY(encodeProduction(strm, EVENT_AT_CLASS, isSchemaType, &qname, VALUE_TYPE_NONE_CLASS, &prodHit));
+	}
 
-	if(prodHit.typeId == INDEX_MAX)
+	if(GET_PROD_TYPE_ID(&prodHit) == INDEX_MAX)
 		*valueType = VALUE_TYPE_NONE_CLASS;
 	else
-		*valueType = GET_VALUE_TYPE_CLASS(GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[prodHit.typeId].content));
+		*valueType = GET_VALUE_TYPE_CLASS(GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[GET_PROD_TYPE_ID(&prodHit)].content));
 
 	if(GET_PROD_EXI_EVENT(prodHit.content) == EVENT_AT_ALL)
 	{
-		TRY(encodeQName(strm, qname, EVENT_AT_ALL, &strm->context.currAttr));
+		if(handle != NULL)
+		{
+			strm->context.currAttr = handle->qnameId;
+			TRY(encodeQNameID(strm, &qname, EVENT_AT_ALL, handle->qnameId));
+		}
+		else
+		{
+			TRY(encodeQName(strm, qname, EVENT_AT_ALL, &strm->context.currAttr));
+		}
 
 		if(IS_SCHEMA(strm->gStack->grammar->props) && strm->context.currAttr.uriId == XML_SCHEMA_INSTANCE_ID &&
 				(strm->context.currAttr.uriId == XML_SCHEMA_INSTANCE_TYPE_ID || strm->context.currAttr.uriId == XML_SCHEMA_INSTANCE_NIL_ID))
@@ -465,22 +567,22 @@ errorCode attribute(EXIStream* strm, QName qname, boolean isSchemaType, EXITypeC
 	}
 	else if(GET_PROD_EXI_EVENT(prodHit.content) == EVENT_AT_QNAME)
 	{
-		strm->context.currAttr.uriId = prodHit.qnameId.uriId;
-		strm->context.currAttr.lnId = prodHit.qnameId.lnId;
+		GET_PROD_QNAME_ID(&prodHit, strm->context.currAttr);
 
-		TRY(encodePfxQName(strm, &qname, EVENT_AT_QNAME, prodHit.qnameId.uriId));
+		TRY(encodePfxQName(strm, &qname, EVENT_AT_QNAME, strm->context.currAttr.uriId));
 	}
 	else
 		return EXIP_NOT_IMPLEMENTED_YET;
 
 	strm->context.expectATData = TRUE;
-	strm->context.attrTypeId = prodHit.typeId;
+	strm->context.attrTypeId = GET_PROD_TYPE_ID(&prodHit);
 
 	return EXIP_OK;
 }
 
 errorCode intData(EXIStream* strm, Integer int_val)
 {
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	Index intTypeId;
 	QNameID qnameID;
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start integer data serialization\n"));
@@ -496,8 +598,7 @@ errorCode intData(EXIStream* strm, Integer int_val)
 	}
 	else
 	{
-		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		// TODO: passing the type class is not enough:
 		// we need to check if the int value (int_val) fits in the
@@ -505,10 +606,13 @@ errorCode intData(EXIStream* strm, Integer int_val)
 		// If it does not fit we need to again use untyped second level production
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_INTEGER_CLASS, &prodHit));
 		qnameID = strm->gStack->currQNameID;
-		intTypeId = prodHit.typeId;
+		intTypeId = GET_PROD_TYPE_ID(&prodHit);
 	}
 
-	return encodeIntData(strm, int_val, qnameID, intTypeId);
+	TRY(enterValueChannel(strm, qnameID));
+	TRY(encodeIntData(strm, int_val, qnameID, intTypeId));
+
+	return leaveValueChannel(strm);
 }
 
 errorCode booleanData(EXIStream* strm, boolean bool_val)
@@ -537,10 +641,10 @@ errorCode booleanData(EXIStream* strm, boolean bool_val)
 	}
 	else
 	{
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_BOOLEAN_CLASS, &prodHit));
-		booleanTypeId = prodHit.typeId;
+		booleanTypeId = GET_PROD_TYPE_ID(&prodHit);
 		qnameID = strm->gStack->currQNameID;
 	}
 
@@ -549,6 +653,8 @@ errorCode booleanData(EXIStream* strm, boolean bool_val)
 	else
 		exiType = VALUE_TYPE_NONE;
 
+	TRY(enterValueChannel(strm, qnameID));
+
 	if(exiType == VALUE_TYPE_BOOLEAN)
 	{
 		TRY(encodeBoolean(strm, bool_val));
@@ -582,7 +688,7 @@ errorCode booleanData(EXIStream* strm, boolean bool_val)
 		strm->gStack->currNonTermID = GR_START_TAG_CONTENT;
 	}
 
-	return EXIP_OK;
+	return leaveValueChannel(strm);
 }
 
 errorCode stringData(EXIStream* strm, const String str_val)
@@ -590,10 +696,74 @@ errorCode stringData(EXIStream* strm, const String str_val)
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	QNameID qnameID;
 	Index typeId;
-	EXIType exiType;
 
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start string data serialization\n"));
 
+	TRY(encodeStringValueEvent(strm, &qnameID, &typeId));
+	TRY(enterValueChannel(strm, qnameID));
+	TRY(encodeStringData(strm, str_val, qnameID, typeId));
+
+	return leaveValueChannel(strm);
+}
+
+errorCode stringDataBegin(EXIStream* strm, Index length)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	QNameID qnameID;
+	Index typeId;
+
+	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start chunked string data serialization\n"));
+
+	if(length > 0 && length <= strm->header.opts.valueMaxLength && strm->header.opts.valuePartitionCapacity > 0)
+	{
+		// The value partitions are searched and updated with the whole value
+		DEBUG_MSG(ERROR, DEBUG_CONTENT_IO, ("\n>Only values that do not enter the value partitions can be serialized in chunks\n"));
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+	}
+
+	TRY(encodeStringValueEvent(strm, &qnameID, &typeId));
+
+	if(typeId != INDEX_MAX && HAS_TYPE_FACET(strm->schema->simpleTypeTable.sType[typeId].content, TYPE_FACET_ENUMERATION))
+	{
+		DEBUG_MSG(ERROR, DEBUG_CONTENT_IO, ("\n>Enumeration values can not be serialized in chunks\n"));
+		return EXIP_INVALID_EXI_INPUT;
+	}
+
+	// "local" value partition and global value partition table miss
+	TRY(enterValueChannel(strm, qnameID));
+	TRY(encodeUnsignedInteger(strm, (UnsignedInteger)(length + 2)));
+	strm->context.valueRemaining = length;
+
+	return EXIP_OK;
+}
+
+errorCode stringDataChunk(EXIStream* strm, const String chunk)
+{
+	if(chunk.length > strm->context.valueRemaining)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	strm->context.valueRemaining -= chunk.length;
+
+	return encodeStringOnly(strm, &chunk);
+}
+
+errorCode stringDataEnd(EXIStream* strm)
+{
+	if(strm->context.valueRemaining != 0)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	return leaveValueChannel(strm);
+}
+
+/**
+ * Encodes the event of a string value (if not an attribute value) and returns
+ * the qname and the type of the value
+ */
+static errorCode encodeStringValueEvent(EXIStream* strm, QNameID* qnameID, Index* typeId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIType exiType;
+
 	if(strm->gStack->grammar == NULL)
 #if EXI_PROFILE_DEFAULT
 	{
@@ -609,27 +779,27 @@ errorCode stringData(EXIStream* strm, const String str_val)
 	if(strm->context.expectATData > 0) // Value for an attribute
 	{
 		strm->context.expectATData -= 1;
-		qnameID = strm->context.currAttr;
-		typeId = strm->context.attrTypeId;
+		*qnameID = strm->context.currAttr;
+		*typeId = strm->context.attrTypeId;
 	}
 	else
 	{
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_STRING_CLASS, &prodHit));
 
-		qnameID = strm->gStack->currQNameID;
-		typeId = prodHit.typeId;
+		*qnameID = strm->gStack->currQNameID;
+		*typeId = GET_PROD_TYPE_ID(&prodHit);
 	}
 
-	if(typeId != INDEX_MAX)
-		exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[typeId].content);
+	if(*typeId != INDEX_MAX)
+		exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[*typeId].content);
 	else
 		exiType = VALUE_TYPE_NONE;
 
 	if(exiType == VALUE_TYPE_STRING || exiType == VALUE_TYPE_UNTYPED || exiType == VALUE_TYPE_NONE)
 	{
-		return encodeStringData(strm, str_val, qnameID, typeId);
+		return EXIP_OK;
 	}
 	else
 	{
@@ -658,11 +828,11 @@ errorCode floatData(EXIStream* strm, Float float_val)
 	else
 	{
 		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_FLOAT_CLASS, &prodHit));
 		qnameID = strm->gStack->currQNameID;
-		typeId = prodHit.typeId;
+		typeId = GET_PROD_TYPE_ID(&prodHit);
 	}
 
 	if(typeId != INDEX_MAX)
@@ -670,9 +840,11 @@ errorCode floatData(EXIStream* strm, Float float_val)
 	else
 		exiType = VALUE_TYPE_NONE;
 
+	TRY(enterValueChannel(strm, qnameID));
+
 	if(exiType == VALUE_TYPE_FLOAT)
 	{
-		return encodeFloatValue(strm, float_val);
+		TRY(encodeFloatValue(strm, float_val));
 	}
 	else if(exiType == VALUE_TYPE_STRING || exiType == VALUE_TYPE_UNTYPED || exiType == VALUE_TYPE_NONE)
 	{
@@ -696,14 +868,62 @@ errorCode floatData(EXIStream* strm, Float float_val)
 		return EXIP_INCONSISTENT_PROC_STATE;
 	}
 
-	return EXIP_OK;
+	return leaveValueChannel(strm);
 }
 
 errorCode binaryData(EXIStream* strm, const char* binary_val, Index nbytes)
 {
-	Index typeId;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	QNameID qnameID;
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start binary data serialization\n"));
 
+	TRY(encodeBinaryValueEvent(strm, &qnameID));
+	TRY(enterValueChannel(strm, qnameID));
+	TRY(encodeBinary(strm, (char *)binary_val, nbytes));
+
+	return leaveValueChannel(strm);
+}
+
+errorCode binaryDataBegin(EXIStream* strm, Index nbytes)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	QNameID qnameID;
+	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start chunked binary data serialization\n"));
+
+	TRY(encodeBinaryValueEvent(strm, &qnameID));
+	TRY(enterValueChannel(strm, qnameID));
+	TRY(encodeUnsignedInteger(strm, (UnsignedInteger) nbytes));
+	strm->context.valueRemaining = nbytes;
+
+	return EXIP_OK;
+}
+
+errorCode binaryDataChunk(EXIStream* strm, const char* chunk, Index size)
+{
+	if(size > strm->context.valueRemaining)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	strm->context.valueRemaining -= size;
+
+	return writeOctets(strm, chunk, size);
+}
+
+errorCode binaryDataEnd(EXIStream* strm)
+{
+	if(strm->context.valueRemaining != 0)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	return leaveValueChannel(strm);
+}
+
+/**
+ * Encodes the event of a binary value (if not an attribute value) and returns
+ * the qname of the value
+ */
+static errorCode encodeBinaryValueEvent(EXIStream* strm, QNameID* qnameID)
+{
+	Index typeId;
+
 	if(strm->gStack->grammar == NULL)
 		return EXIP_INCONSISTENT_PROC_STATE;
 
@@ -711,14 +931,16 @@ errorCode binaryData(EXIStream* strm, const char* binary_val, Index nbytes)
 	{
 		strm->context.expectATData -= 1;
 		typeId = strm->context.attrTypeId;
+		*qnameID = strm->context.currAttr;
 	}
 	else
 	{
 		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_BINARY_CLASS, &prodHit));
-		typeId = prodHit.typeId;
+		typeId = GET_PROD_TYPE_ID(&prodHit);
+		*qnameID = strm->gStack->currQNameID;
 	}
 
 	if(typeId == INDEX_MAX || GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[typeId].content) != VALUE_TYPE_BINARY)
@@ -728,7 +950,7 @@ errorCode binaryData(EXIStream* strm, const char* binary_val, Index nbytes)
 		return EXIP_INCONSISTENT_PROC_STATE;
 	}
 
-	return encodeBinary(strm, (char *)binary_val, nbytes);
+	return EXIP_OK;
 }
 
 errorCode dateTimeData(EXIStream* strm, EXIPDateTime dt_val)
@@ -751,14 +973,14 @@ errorCode dateTimeData(EXIStream* strm, EXIPDateTime dt_val)
 	else
 	{
 		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		// TODO: passing the type class is not enough:
 		// we need to check if the dt_val value fits in the
 		// production value content description.
 		// If it does not fit we need to again use untyped second level production
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_DATE_TIME_CLASS, &prodHit));
-		typeId = prodHit.typeId;
+		typeId = GET_PROD_TYPE_ID(&prodHit);
 		qnameID = strm->gStack->currQNameID;
 	}
 
@@ -767,9 +989,11 @@ errorCode dateTimeData(EXIStream* strm, EXIPDateTime dt_val)
 	else
 		exiType = VALUE_TYPE_NONE;
 
+	TRY(enterValueChannel(strm, qnameID));
+
 	if(GET_EVENT_CLASS(exiType) == VALUE_TYPE_DATE_TIME_CLASS)
 	{
-		return encodeDateTimeValue(strm, exiType, dt_val);
+		TRY(encodeDateTimeValue(strm, exiType, dt_val));
 	}
 	else if(exiType == VALUE_TYPE_STRING || exiType == VALUE_TYPE_UNTYPED || exiType == VALUE_TYPE_NONE)
 	{
@@ -793,7 +1017,7 @@ errorCode dateTimeData(EXIStream* strm, EXIPDateTime dt_val)
 		return EXIP_INCONSISTENT_PROC_STATE;
 	}
 
-	return EXIP_OK;
+	return leaveValueChannel(strm);
 }
 
 errorCode decimalData(EXIStream* strm, Decimal dec_val)
@@ -816,11 +1040,11 @@ errorCode decimalData(EXIStream* strm, Decimal dec_val)
 	else
 	{
 		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_DECIMAL_CLASS, &prodHit));
 		qnameID = strm->gStack->currQNameID;
-		typeId = prodHit.typeId;
+		typeId = GET_PROD_TYPE_ID(&prodHit);
 	}
 
 	if(typeId != INDEX_MAX)
@@ -828,6 +1052,8 @@ errorCode decimalData(EXIStream* strm, Decimal dec_val)
 	else
 		exiType = VALUE_TYPE_NONE;
 
+	TRY(enterValueChannel(strm, qnameID));
+
 	if(exiType == VALUE_TYPE_DECIMAL)
 	{
 		// TODO: make conditional, not all use cases need Schema type validation
@@ -867,7 +1093,7 @@ errorCode decimalData(EXIStream* strm, Decimal dec_val)
 		}
 		/// END type validation
 
-		return encodeDecimalValue(strm, dec_val);
+		TRY(encodeDecimalValue(strm, dec_val));
 	}
 	else if(exiType == VALUE_TYPE_STRING || exiType == VALUE_TYPE_UNTYPED || exiType == VALUE_TYPE_NONE)
 	{
@@ -891,11 +1117,12 @@ errorCode decimalData(EXIStream* strm, Decimal dec_val)
 		return EXIP_INCONSISTENT_PROC_STATE;
 	}
 
-	return EXIP_OK;
+	return leaveValueChannel(strm);
 }
 
 errorCode listData(EXIStream* strm, unsigned int itemCount)
 {
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	Index typeId;
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n>Start list data serialization\n"));
 
@@ -911,16 +1138,21 @@ errorCode listData(EXIStream* strm, unsigned int itemCount)
 	}
 	else
 	{
-		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+		Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 		TRY(encodeProduction(strm, EVENT_CH_CLASS, TRUE, NULL, VALUE_TYPE_LIST_CLASS, &prodHit));
+		typeId = GET_PROD_TYPE_ID(&prodHit);
+		// The list items are encoded as attribute values of the element
+		strm->context.currAttr = strm->gStack->currQNameID;
 	}
 
 	strm->context.expectATData = itemCount;
  	strm->context.attrTypeId = strm->schema->simpleTypeTable.sType[typeId].length; // The actual type of the list items
 
-	return encodeUnsignedInteger(strm, (UnsignedInteger) itemCount);
+	TRY(enterValueChannel(strm, strm->context.currAttr));
+	TRY(encodeUnsignedInteger(strm, (UnsignedInteger) itemCount));
+
+	return leaveValueChannel(strm);
 }
 
 errorCode qnameData(EXIStream* strm, QName qname)
@@ -941,15 +1173,15 @@ errorCode qnameData(EXIStream* strm, QName qname)
 		TRY(encodeQName(strm, qname, EVENT_AT_ALL, &qnameId));
 
 		// New type grammar is pushed on the stack if it exists
-		newGrammar = GET_TYPE_GRAMMAR_QNAMEID(strm->schema, qnameId);
+		newGrammar = GET_STREAM_TYPE_GRAMMAR_QNAMEID(strm, qnameId);
 
 		if(newGrammar != NULL)
 		{
 			// The grammar is found
 			// preserve the currQNameID
 			QNameID currQNameID = strm->gStack->currQNameID;
-			popGrammar(&(strm->gStack));
-			TRY(pushGrammar(&(strm->gStack), currQNameID, newGrammar));
+			popGrammar(strm);
+			TRY(pushGrammar(strm, currQNameID, newGrammar));
 		}
 		else if(strm->gStack->grammar == NULL)
 			return EXIP_INCONSISTENT_PROC_STATE;
@@ -969,7 +1201,7 @@ errorCode namespaceDeclaration(EXIStream* strm, const String ns, const String pr
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	SmallIndex uriId;
-	Production prodHit = {0, INDEX_MAX, {URI_MAX, LN_MAX}};
+	Production prodHit = {0, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}};
 
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Start namespace declaration\n"));
 
@@ -982,7 +1214,7 @@ errorCode namespaceDeclaration(EXIStream* strm, const String ns, const String pr
 		EventCode tmpEvCode;
 
 		tmpEvCode.length = 2;
-		if(GET_LN_URI_QNAME(strm->schema->uriTable, strm->gStack->currQNameID).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+		if(GET_LN_URI_QNAME(strm->uriTable, strm->gStack->currQNameID).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 		{
 			// This is the case when there is a top level AT(xsi:type) production inserted and hence
 			// the first part of the event code with value 1 must be encoded before the second level part of the event code
@@ -1026,15 +1258,43 @@ errorCode selfContained(EXIStream* strm)
 	return EXIP_NOT_IMPLEMENTED_YET;
 }
 
-errorCode closeEXIStream(EXIStream* strm)
+errorCode initStreamSchemaId(EXIStream* strm, BinaryBuffer buffer, SchemaRegistry* registry, const String* schemaId)
 {
-	errorCode tmp_err_code = EXIP_OK;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIPSchema* schema;
+
+	TRY(acquireSchema(registry, schemaId, &schema));
+
+	strm->header.has_options = TRUE;
+	strm->header.opts.schemaIDMode = SCHEMA_ID_SET;
+	strm->header.opts.schemaID = *schemaId;
+	strm->schema = NULL;
+	tmp_err_code = initStream(strm, buffer, schema);
 
-	while(strm->gStack != NULL)
+	// The schema is released by closeEXIStream() once used by the stream
+	if(strm->schema == schema)
+		strm->registry = registry;
+	else
+		releaseSchema(registry, schema);
+
+	if(tmp_err_code == EXIP_OK)
 	{
-		popGrammar(&strm->gStack);
+		// The header keeps its own copy: schemaId may not outlive the call
+		TRY(cloneStringManaged(schemaId, &strm->header.opts.schemaID, &strm->memList));
 	}
 
+	return tmp_err_code;
+}
+
+errorCode closeEXIStream(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_OK;
+
+#if COMPRESSION_USE
+	// After an error the last block is discarded
+	destroyBlockChannels(strm);
+#endif
+
 	// Flush the buffer first if there is an output Stream
 	if(strm->buffer.ioStrm.readWriteToStream != NULL)
 	{
@@ -1043,13 +1303,22 @@ errorCode closeEXIStream(EXIStream* strm)
 	}
 
 	freeAllMem(strm);
+	if(strm->registry != NULL)
+	{
+		releaseSchema(strm->registry, strm->schema);
+		strm->registry = NULL;
+	}
 	return tmp_err_code;
 }
 
 errorCode flushEXIData(EXIStream* strm, char* outBuf, unsigned int bufSize, unsigned int* bytesFlush)
 {
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	char leftOverBits;
 
+	*bytesFlush = 0;
+	TRY(checkNonBlockingOptions(&strm->header.opts));
+
 	if(bufSize < strm->context.bufferIndx)
 		return EXIP_OUT_OF_BOUND_BUFFER;
 
@@ -1066,6 +1335,46 @@ errorCode flushEXIData(EXIStream* strm, char* outBuf, unsigned int bufSize, unsi
 	return EXIP_OK;
 }
 
+errorCode resolveQNameHandle(const EXIPSchema* schema, QName qname, QNameHandle* handle)
+{
+	SmallIndex uriId;
+	Index lnId;
+
+	assert(qname.uri != NULL);
+	assert(qname.localName != NULL);
+
+	handle->qname = qname;
+	handle->schema = schema;
+	handle->qnameId.uriId = URI_MAX;
+	handle->qnameId.lnId = LN_MAX;
+	handle->elemGrammar = INDEX_MAX;
+
+	if(schema == NULL)
+		return EXIP_OK;
+
+	// Plain scans: the string table indexes of a static schema are not built here
+	for(uriId = 0; uriId < schema->uriTable.count; uriId++)
+	{
+		if(stringEqual(schema->uriTable.uri[uriId].uriStr, *qname.uri))
+			break;
+	}
+	if(uriId == schema->uriTable.count)
+		return EXIP_OK;
+
+	for(lnId = 0; lnId < schema->uriTable.uri[uriId].lnTable.count; lnId++)
+	{
+		if(stringEqual(schema->uriTable.uri[uriId].lnTable.ln[lnId].lnStr, *qname.localName))
+		{
+			handle->qnameId.uriId = uriId;
+			handle->qnameId.lnId = lnId;
+			handle->elemGrammar = schema->uriTable.uri[uriId].lnTable.ln[lnId].elemGrammar;
+			break;
+		}
+	}
+
+	return EXIP_OK;
+}
+
 errorCode serializeEvent(EXIStream* strm, EventCode ec, QName* qname)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
@@ -1105,13 +1414,12 @@ errorCode serializeEvent(EXIStream* strm, EventCode ec, QName* qname)
 		break;
 		case EVENT_AT_QNAME:
 
-			strm->context.currAttr.uriId = tmpProd->qnameId.uriId;
-			strm->context.currAttr.lnId = tmpProd->qnameId.lnId;
+			GET_PROD_QNAME_ID(tmpProd, strm->context.currAttr);
 
-			TRY(encodePfxQName(strm, qname, EVENT_AT_QNAME, tmpProd->qnameId.uriId));
+			TRY(encodePfxQName(strm, qname, EVENT_AT_QNAME, strm->context.currAttr.uriId));
 
 			strm->context.expectATData = TRUE;
-			strm->context.attrTypeId = tmpProd->typeId;
+			strm->context.attrTypeId = GET_PROD_TYPE_ID(tmpProd);
 
 		break;
 		case EVENT_AT_URI:
@@ -1124,26 +1432,28 @@ errorCode serializeEvent(EXIStream* strm, EventCode ec, QName* qname)
 			TRY(encodeQName(strm, *qname, EVENT_AT_ALL, &strm->context.currAttr));
 
 			strm->context.expectATData = TRUE;
-			strm->context.attrTypeId = tmpProd->typeId;
+			strm->context.attrTypeId = GET_PROD_TYPE_ID(tmpProd);
 		break;
 		case EVENT_SE_QNAME:
 		{
 			EXIGrammar* elemGrammar = NULL;
+			QNameID tmpQid;
 
-			TRY(encodePfxQName(strm, qname, EVENT_SE_QNAME, tmpProd->qnameId.uriId));
+			GET_PROD_QNAME_ID(tmpProd, tmpQid);
+			TRY(encodePfxQName(strm, qname, EVENT_SE_QNAME, tmpQid.uriId));
 
 			// New element grammar is pushed on the stack
 			if(IS_BUILT_IN_ELEM(strm->gStack->grammar->props))  // If the current grammar is build-in Element grammar ...
 			{
-				elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, strm->gStack->currQNameID);
+				elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, strm->gStack->currQNameID);
 			}
 			else
 			{
-				elemGrammar = &strm->schema->grammarTable.grammar[tmpProd->typeId];
+				elemGrammar = &strm->schema->grammarTable.grammar[GET_PROD_TYPE_ID(tmpProd)];
 			}
 
 			if(elemGrammar != NULL) // The grammar is found
-				TRY(pushGrammar(&(strm->gStack), tmpProd->qnameId, elemGrammar));
+				TRY(pushGrammar(strm, tmpQid, elemGrammar));
 			else
 				return EXIP_INCONSISTENT_PROC_STATE;  // The event require the presence of Element Grammar previously created
 		}
@@ -1163,34 +1473,27 @@ errorCode serializeEvent(EXIStream* strm, EventCode ec, QName* qname)
 
 			// New element grammar is pushed on the stack
 #if EXI_PROFILE_DEFAULT
-			if(GET_LN_URI_QNAME(strm->schema->uriTable, tmpQid).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+			if(GET_LN_URI_QNAME(strm->uriTable, tmpQid).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 				elemGrammar = NULL;
 			else
 #endif
-			elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, tmpQid);
+			elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, tmpQid);
 
 			if(elemGrammar != NULL) // The grammar is found
 			{
-				TRY(pushGrammar(&(strm->gStack), tmpQid, elemGrammar));
+				TRY(pushGrammar(strm, tmpQid, elemGrammar));
 			}
 			else
 			{
 #if BUILD_IN_GRAMMARS_USE
-				EXIGrammar newElementGrammar;
-				Index dynArrIndx;
-				TRY(createBuiltInElementGrammar(&newElementGrammar, strm));
-
-				TRY(addDynEntry(&strm->schema->grammarTable.dynArray, &newElementGrammar, &dynArrIndx));
-
-				GET_LN_URI_QNAME(strm->schema->uriTable, tmpQid).elemGrammar = dynArrIndx;
-
-				TRY(pushGrammar(&(strm->gStack), tmpQid, &strm->schema->grammarTable.grammar[dynArrIndx]));
+				TRY(addBuiltInElementGrammar(strm, tmpQid, &elemGrammar));
+				TRY(pushGrammar(strm, tmpQid, elemGrammar));
 #elif EXI_PROFILE_DEFAULT
 				// Leave the grammar NULL - if the next event is valid AT(xsi:type)
 				// then its value will be the next grammar.
 				// If the next event is not valid AT(xsi:type) - then the event
 				// AT(xsi:type="anyType") will be inserted beforehand
-				TRY(pushGrammar(&(strm->gStack), tmpQid, elemGrammar));
+				TRY(pushGrammar(strm, tmpQid, elemGrammar));
 
 				return EXIP_OK;
 #else
@@ -1204,7 +1507,7 @@ errorCode serializeEvent(EXIStream* strm, EventCode ec, QName* qname)
 		case EVENT_EE:
 			assert(strm->gStack->currNonTermID == GR_VOID_NON_TERMINAL);
 
-			popGrammar(&(strm->gStack));
+			popGrammar(strm);
 		break;
 		case EVENT_CH:
 			return EXIP_NOT_IMPLEMENTED_YET;
@@ -1243,7 +1546,7 @@ static errorCode encodeATXsiType(EXIStream* strm)
 	EventCode tmpEvCode;
 
 	tmpEvCode.length = 2;
-	if(GET_LN_URI_QNAME(strm->schema->uriTable, strm->gStack->currQNameID).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+	if(GET_LN_URI_QNAME(strm->uriTable, strm->gStack->currQNameID).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 	{
 		// This is the case when there is a top level AT(xsi:type) production inserted and hence
 		// the first part of the event code with value 1 must be encoded before the second level part of the event code
@@ -1254,7 +1557,8 @@ static errorCode encodeATXsiType(EXIStream* strm)
 	{
 		tmpEvCode.part[0] = 0;
 		tmpEvCode.bits[0] = 0;
-		GET_LN_URI_QNAME(strm->schema->uriTable, strm->gStack->currQNameID).elemGrammar = EXI_PROFILE_STUB_GRAMMAR_INDX;
+		TRY(ownLnTable(strm, strm->gStack->currQNameID.uriId));
+		GET_LN_URI_QNAME(strm->uriTable, strm->gStack->currQNameID).elemGrammar = EXI_PROFILE_STUB_GRAMMAR_INDX;
 	}
 
 	tmpEvCode.part[1] = 1;
@@ -1263,9 +1567,9 @@ static errorCode encodeATXsiType(EXIStream* strm)
 			|| IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS));
 	// serialize  AT(xsi:type)
 	TRY(writeEventCode(strm, tmpEvCode));
-	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber(strm->schema->uriTable.count), XML_SCHEMA_INSTANCE_ID + 1));
+	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber(strm->uriTable.count), XML_SCHEMA_INSTANCE_ID + 1));
 	TRY(encodeUnsignedInteger(strm, 0));
-	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber((unsigned int)(strm->schema->uriTable.uri[XML_SCHEMA_INSTANCE_ID].lnTable.count - 1)), XML_SCHEMA_INSTANCE_TYPE_ID));
+	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber((unsigned int)(strm->uriTable.uri[XML_SCHEMA_INSTANCE_ID].lnTable.count - 1)), XML_SCHEMA_INSTANCE_TYPE_ID));
 
 	return EXIP_OK;
 }
@@ -1279,18 +1583,18 @@ static errorCode encodeAnyType(EXIStream* strm)
 	QNameID currQNameID = strm->gStack->currQNameID;
 
 	// serialize "xs:anyType"
-	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber(strm->schema->uriTable.count), XML_SCHEMA_NAMESPACE_ID + 1));
+	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber(strm->uriTable.count), XML_SCHEMA_NAMESPACE_ID + 1));
 	TRY(encodeUnsignedInteger(strm, 0));
-	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber((unsigned int)(strm->schema->uriTable.uri[XML_SCHEMA_NAMESPACE_ID].lnTable.count - 1)), SIMPLE_TYPE_ANY_TYPE));
+	TRY(encodeNBitUnsignedInteger(strm, getBitsNumber((unsigned int)(strm->uriTable.uri[XML_SCHEMA_NAMESPACE_ID].lnTable.count - 1)), SIMPLE_TYPE_ANY_TYPE));
 
 	// "xs:anyType" grammar is pushed on the stack instead of the NULL one
-	popGrammar(&(strm->gStack));
+	popGrammar(strm);
 	anyTypeId.uriId = XML_SCHEMA_NAMESPACE_ID;
 	anyTypeId.lnId = SIMPLE_TYPE_ANY_TYPE;
-	anyGrammar = GET_TYPE_GRAMMAR_QNAMEID(strm->schema, anyTypeId);
+	anyGrammar = GET_STREAM_TYPE_GRAMMAR_QNAMEID(strm, anyTypeId);
 	assert(anyGrammar != NULL);
 
-	TRY(pushGrammar(&(strm->gStack), currQNameID, anyGrammar));
+	TRY(pushGrammar(strm, currQNameID, anyGrammar));
 
 	return EXIP_OK;
 }
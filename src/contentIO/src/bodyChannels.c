@@ -0,0 +1,1417 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bodyChannels.c
+ * @brief Implementation of the EXI body organized in blocks and channels
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "bodyChannels.h"
+
+#if COMPRESSION_USE
+
+#include "dynamicArray.h"
+#include "memManagement.h"
+#include "stringManipulate.h"
+#include "bodyEncode.h"
+#include "bodyDecode.h"
+#include "sTables.h"
+#include "grammars.h"
+
+/** The initial number of entries of the DynArrays of BlockChannels */
+#define CHANNELS_CHUNK_ENTRIES 16
+#define RECORDS_CHUNK_ENTRIES 256
+
+/** The initial size of BlockChannels.channelHash; must be a power of two */
+#define CHANNEL_HASH_INITIAL_SIZE 64
+
+#define CHANNEL_HASH(qnameID, size) ((((Index) (qnameID).uriId * 0x9E3779B1UL) ^ (qnameID).lnId) & ((size) - 1))
+
+static errorCode findChannel(BlockChannels* ch, QNameID qnameID, Index* channelIndx);
+static errorCode resetBlock(BlockChannels* ch);
+static size_t writeWindow(void* buf, size_t size, void* stream);
+static errorCode flushWindow(EXIStream* strm);
+static errorCode writeBlock(EXIStream* strm);
+static errorCode decodeBlock(EXIStream* strm);
+static errorCode deliverRecord(EXIStream* strm, EventRecord* rec, ContentHandler* handler, void* app_data);
+static errorCode sinkRecord(EXIStream* strm, EventRecord* rec, EventSink* sink);
+#if COMPRESSION_THREAD_USE
+static void freeInflateData(BlockChannels* ch);
+#endif
+
+static errorCode rec_endDocument(void* app_data);
+static errorCode rec_startElement(QName qname, void* app_data);
+static errorCode rec_endElement(void* app_data);
+static errorCode rec_attribute(QName qname, void* app_data);
+static errorCode rec_intData(Integer int_val, void* app_data);
+static errorCode rec_booleanData(boolean bool_val, void* app_data);
+static errorCode rec_stringData(const String str_val, void* app_data);
+static errorCode rec_floatData(Float float_val, void* app_data);
+static errorCode rec_binaryData(const char* binary_val, Index nbytes, void* app_data);
+static errorCode rec_dateTimeData(EXIPDateTime dt_val, void* app_data);
+static errorCode rec_decimalData(Decimal dec_val, void* app_data);
+static errorCode rec_listData(EXITypeClass exiType, unsigned int itemCount, void* app_data);
+static errorCode rec_qnameData(const QName qname, void* app_data);
+static errorCode rec_namespaceDeclaration(const String ns, const String prefix, boolean isLocalElementNS, void* app_data);
+static errorCode rec_selfContained(void* app_data);
+
+/**
+ * The content handler that records the events and values of a block.
+ * The app_data of the callbacks is the BlockChannels of the stream.
+ */
+static ContentHandler recordingHandler = {
+	NULL, // startDocument
+	rec_endDocument,
+	rec_startElement,
+	rec_endElement,
+	rec_attribute,
+	rec_intData,
+	rec_booleanData,
+	rec_stringData,
+	rec_floatData,
+	rec_binaryData,
+	rec_dateTimeData,
+	rec_decimalData,
+	rec_listData,
+	rec_qnameData,
+	NULL, // binaryDataBegin
+	NULL, // binaryDataChunk
+	NULL, // binaryDataEnd
+	NULL, // stringDataBegin
+	NULL, // stringDataChunk
+	NULL, // stringDataEnd
+	NULL, // processingInstruction
+	rec_namespaceDeclaration,
+	NULL, // warning
+	NULL, // error
+	NULL, // fatalError
+	rec_selfContained
+};
+
+errorCode initBlockChannels(EXIStream* strm, boolean encode)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch;
+	Index i;
+
+	ch = (BlockChannels*) EXIP_MALLOC(sizeof(BlockChannels));
+	if(ch == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	if(initAllocList(&ch->blockMem) != EXIP_OK)
+	{
+		EXIP_MFREE(ch);
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	}
+
+	initCompressedIO(&ch->cio, strm->buffer, strm->context.bufferIndx, WITH_COMPRESSION(strm->header.opts.enumOpt));
+	ch->channels.channel = NULL;
+	ch->channels.count = 0;
+	ch->channelsInit = 0;
+	ch->channelHashSize = CHANNEL_HASH_INITIAL_SIZE;
+	ch->channelHash = NULL;
+	ch->valueCount = 0;
+	ch->current = INDEX_MAX;
+	ch->structure.buf = NULL;
+	ch->structure.size = 0;
+	ch->structure.capacity = 0;
+	ch->window = NULL;
+	ch->strings.str = NULL;
+	ch->strings.count = 0;
+	ch->flushing = FALSE;
+	ch->events.record = NULL;
+	ch->events.count = 0;
+	ch->values.record = NULL;
+	ch->values.count = 0;
+	ch->recording = &ch->events;
+	ch->deferValues = FALSE;
+	ch->documentEnd = FALSE;
+	ch->replayIndx = 0;
+#if COMPRESSION_THREAD_USE
+	for(i = 0; i < COMPRESSION_THREAD_QUEUE_SIZE; i++)
+	{
+		ch->queue.slot[i].buf = NULL;
+		ch->queue.slot[i].size = 0;
+		ch->queue.slot[i].capacity = 0;
+	}
+	ch->queue.head = 0;
+	ch->queue.count = 0;
+	ch->queue.holding = FALSE;
+	ch->queue.stop = FALSE;
+	ch->queue.workerErr = EXIP_OK;
+	ch->queue.announced = 1; // The structure stream of the first block
+	ch->queue.inflated = 0;
+	ch->queue.reading = FALSE;
+	ch->queue.orphan = FALSE;
+	ch->queue.inputReleased = NULL;
+	ch->queue.released_data = NULL;
+	ch->queue.input = NULL;
+	ch->queue.started = FALSE;
+#else
+	ch->inflated.buf = NULL;
+	ch->inflated.size = 0;
+	ch->inflated.capacity = 0;
+#endif
+	strm->channels = ch;
+
+	ch->channelHash = (Index*) EXIP_MALLOC(sizeof(Index)*ch->channelHashSize);
+	if(ch->channelHash == NULL)
+	{
+		destroyBlockChannels(strm);
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	}
+	for(i = 0; i < ch->channelHashSize; i++)
+		ch->channelHash[i] = INDEX_MAX;
+
+	TRY_CATCH(createDynArray(&ch->channels.dynArray, sizeof(ValueChannel), CHANNELS_CHUNK_ENTRIES), destroyBlockChannels(strm));
+
+	if(encode)
+	{
+		TRY_CATCH(createDynArray(&ch->strings.dynArray, sizeof(DeferredString), RECORDS_CHUNK_ENTRIES), destroyBlockChannels(strm));
+
+		ch->window = (char*) EXIP_MALLOC(CHANNEL_WINDOW_SIZE + 1);
+		if(ch->window == NULL)
+		{
+			destroyBlockChannels(strm);
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		}
+
+		// From now on the serializer encodes into the window
+		strm->buffer.buf = ch->window;
+		strm->buffer.bufLen = CHANNEL_WINDOW_SIZE;
+		strm->buffer.bufContent = 0;
+		strm->buffer.ioStrm.readWriteToStream = writeWindow;
+		strm->buffer.ioStrm.stream = strm;
+		strm->context.bufferIndx = 0;
+		strm->context.bitPointer = 0;
+	}
+	else
+	{
+		TRY_CATCH(createDynArray(&ch->events.dynArray, sizeof(EventRecord), RECORDS_CHUNK_ENTRIES), destroyBlockChannels(strm));
+		TRY_CATCH(createDynArray(&ch->values.dynArray, sizeof(EventRecord), RECORDS_CHUNK_ENTRIES), destroyBlockChannels(strm));
+	}
+
+	return EXIP_OK;
+}
+
+void destroyBlockChannels(EXIStream* strm)
+{
+	releaseBlockChannels(strm, NULL, NULL);
+}
+
+void releaseBlockChannels(EXIStream* strm, void (*inputReleased)(void* app_data), void* app_data)
+{
+	BlockChannels* ch = strm->channels;
+	Index i;
+
+	if(ch == NULL)
+	{
+		if(inputReleased != NULL)
+			inputReleased(app_data);
+		return;
+	}
+
+	if(ch->window != NULL)
+	{
+		// Back to the buffer of the application
+		strm->buffer = ch->cio.io;
+		strm->context.bufferIndx = ch->cio.ioIndx;
+		strm->context.bitPointer = 0;
+		EXIP_MFREE(ch->window);
+	}
+
+	for(i = 0; i < ch->channelsInit; i++)
+		freeOctets(&ch->channels.channel[i].data);
+
+	if(ch->channels.channel != NULL)
+		destroyDynArray(&ch->channels.dynArray);
+	if(ch->strings.str != NULL)
+		destroyDynArray(&ch->strings.dynArray);
+	if(ch->events.record != NULL)
+		destroyDynArray(&ch->events.dynArray);
+	if(ch->values.record != NULL)
+		destroyDynArray(&ch->values.dynArray);
+	if(ch->channelHash != NULL)
+		EXIP_MFREE(ch->channelHash);
+	freeOctets(&ch->structure);
+	freeAllocList(&ch->blockMem);
+	strm->channels = NULL;
+
+#if COMPRESSION_THREAD_USE
+	if(ch->queue.started)
+	{
+		pthread_t worker = ch->queue.worker;
+		boolean orphan;
+
+		// The inflate thread uses cio and the slots: end it first. A read of the
+		// input stream of the application may not return soon (e.g. a socket
+		// without data): the thread is then left to free them and to release
+		// the input stream when it returns
+		pthread_mutex_lock(&ch->queue.lock);
+		ch->queue.stop = TRUE;
+		orphan = ch->queue.reading;
+		ch->queue.orphan = orphan;
+		ch->queue.inputReleased = inputReleased;
+		ch->queue.released_data = app_data;
+		pthread_cond_broadcast(&ch->queue.cond);
+		pthread_mutex_unlock(&ch->queue.lock);
+
+		if(orphan)
+		{
+			pthread_detach(worker);
+			return;
+		}
+		pthread_join(worker, NULL);
+	}
+	freeInflateData(ch);
+#else
+	freeOctets(&ch->inflated);
+	destroyCompressedIO(&ch->cio);
+	EXIP_MFREE(ch);
+#endif
+
+	if(inputReleased != NULL)
+		inputReleased(app_data);
+}
+
+/**
+ * Returns the index of the value channel of qnameID in the current block;
+ * the channel is created if this is the first value for qnameID
+ */
+static errorCode findChannel(BlockChannels* ch, QNameID qnameID, Index* channelIndx)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	ValueChannel* vc;
+	Index h;
+
+	h = CHANNEL_HASH(qnameID, ch->channelHashSize);
+	while(ch->channelHash[h] != INDEX_MAX)
+	{
+		vc = &ch->channels.channel[ch->channelHash[h]];
+		if(vc->qnameId.uriId == qnameID.uriId && vc->qnameId.lnId == qnameID.lnId)
+		{
+			*channelIndx = ch->channelHash[h];
+			return EXIP_OK;
+		}
+		h = (h + 1) & (ch->channelHashSize - 1);
+	}
+
+	if(2*(ch->channels.count + 1) > ch->channelHashSize)
+	{
+		// Keep the load factor under 1/2: double the hash and insert the channels again
+		Index* channelHash;
+		Index size = 2*ch->channelHashSize;
+		Index i;
+
+		channelHash = (Index*) EXIP_REALLOC(ch->channelHash, sizeof(Index)*size);
+		if(channelHash == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+
+		ch->channelHash = channelHash;
+		ch->channelHashSize = size;
+		for(i = 0; i < size; i++)
+			channelHash[i] = INDEX_MAX;
+
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			h = CHANNEL_HASH(ch->channels.channel[i].qnameId, size);
+			while(channelHash[h] != INDEX_MAX)
+				h = (h + 1) & (size - 1);
+			channelHash[h] = i;
+		}
+
+		h = CHANNEL_HASH(qnameID, size);
+		while(channelHash[h] != INDEX_MAX)
+			h = (h + 1) & (size - 1);
+	}
+
+	TRY(addEmptyDynEntry(&ch->channels.dynArray, (void**) &vc, channelIndx));
+
+	if(*channelIndx == ch->channelsInit)
+	{
+		// The octets of the channels are kept from block to block
+		vc->data.buf = NULL;
+		vc->data.capacity = 0;
+		ch->channelsInit++;
+	}
+	vc->data.size = 0;
+	vc->qnameId = qnameID;
+	vc->valueCount = 0;
+	vc->first = INDEX_MAX;
+	vc->last = INDEX_MAX;
+	ch->channelHash[h] = *channelIndx;
+
+	return EXIP_OK;
+}
+
+/**
+ * Discards the channels of the current block
+ */
+static errorCode resetBlock(BlockChannels* ch)
+{
+	Index i;
+
+	ch->structure.size = 0;
+	ch->channels.count = 0;
+	ch->strings.count = 0;
+	ch->events.count = 0;
+	ch->values.count = 0;
+	ch->valueCount = 0;
+	ch->replayIndx = 0;
+	ch->current = INDEX_MAX;
+
+	for(i = 0; i < ch->channelHashSize; i++)
+		ch->channelHash[i] = INDEX_MAX;
+
+	return resetAllocList(&ch->blockMem);
+}
+
+/**
+ * Stores the octets encoded in the window in the current channel,
+ * or writes them to the EXI stream while the block is written
+ */
+static errorCode storeOctets(BlockChannels* ch, const char* data, Index size)
+{
+	if(ch->flushing)
+		return writeCompressedStream(&ch->cio, data, size);
+	else if(ch->current == INDEX_MAX)
+		return appendOctets(&ch->structure, data, size);
+
+	return appendOctets(&ch->channels.channel[ch->current].data, data, size);
+}
+
+/**
+ * The readWriteToStream of the window. The stream parameter is the EXIStream
+ */
+static size_t writeWindow(void* buf, size_t size, void* stream)
+{
+	EXIStream* strm = (EXIStream*) stream;
+
+	if(storeOctets(strm->channels, (const char*) buf, (Index) size) != EXIP_OK)
+		return 0;
+
+	return size;
+}
+
+/**
+ * Empties the window. The encoding must be at an octet boundary,
+ * which is always the case with compression and pre-compression
+ */
+static errorCode flushWindow(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	assert(strm->context.bitPointer == 0);
+
+	if(strm->context.bufferIndx > 0)
+	{
+		TRY(storeOctets(strm->channels, strm->buffer.buf, strm->context.bufferIndx));
+		strm->context.bufferIndx = 0;
+	}
+
+	return EXIP_OK;
+}
+
+errorCode enterValueChannel(EXIStream* strm, QNameID qnameID)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+
+	// Already in the value channel when encoding the items of a list
+	if(ch == NULL || ch->current != INDEX_MAX)
+		return EXIP_OK;
+
+	if(qnameID.uriId == XML_SCHEMA_INSTANCE_ID &&
+			(qnameID.lnId == XML_SCHEMA_INSTANCE_TYPE_ID || qnameID.lnId == XML_SCHEMA_INSTANCE_NIL_ID))
+		return EXIP_OK;
+
+	TRY(flushWindow(strm));
+
+	return findChannel(ch, qnameID, &ch->current);
+}
+
+errorCode leaveValueChannel(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+
+	// The items of a list are still to come
+	if(ch == NULL || ch->current == INDEX_MAX || strm->context.expectATData > 0)
+		return EXIP_OK;
+
+	TRY(flushWindow(strm));
+
+	ch->channels.channel[ch->current].valueCount += 1;
+	ch->valueCount += 1;
+	ch->current = INDEX_MAX;
+
+	if(ch->valueCount >= strm->header.opts.blockSize)
+		return writeBlock(strm);
+
+	return EXIP_OK;
+}
+
+errorCode deferStringData(EXIStream* strm, String strng, QNameID qnameID, Index typeId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	ValueChannel* vc;
+	DeferredString* ds;
+	Index dsIndx;
+
+	TRY(flushWindow(strm));
+	TRY(addEmptyDynEntry(&ch->strings.dynArray, (void**) &ds, &dsIndx));
+
+	vc = &ch->channels.channel[ch->current];
+	ds->offset = vc->data.size;
+	ds->qnameId = qnameID;
+	ds->typeId = typeId;
+	ds->next = INDEX_MAX;
+	if(isStringEmpty(&strng))
+		getEmptyString(&ds->value);
+	else
+		TRY(cloneStringManaged(&strng, &ds->value, &ch->blockMem));
+
+	if(vc->first == INDEX_MAX)
+		vc->first = dsIndx;
+	else
+		ch->strings.str[vc->last].next = dsIndx;
+	vc->last = dsIndx;
+
+	return EXIP_OK;
+}
+
+/**
+ * Writes the octets of a channel to the EXI stream,
+ * encoding its deferred strings (starting with s) in place
+ */
+static errorCode writeChannel(EXIStream* strm, OctetBuffer* data, Index s)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	DeferredString* ds;
+	Index pos = 0;
+
+	while(s != INDEX_MAX)
+	{
+		ds = &ch->strings.str[s];
+		if(ds->offset > pos)
+		{
+			TRY(writeCompressedStream(&ch->cio, data->buf + pos, ds->offset - pos));
+			pos = ds->offset;
+		}
+		TRY(encodeStringData(strm, ds->value, ds->qnameId, ds->typeId));
+		TRY(flushWindow(strm));
+		s = ds->next;
+	}
+
+	if(data->size > pos)
+	{
+		TRY(writeCompressedStream(&ch->cio, data->buf + pos, data->size - pos));
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * Writes the current block to the EXI stream and starts a new one
+ */
+static errorCode writeBlock(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	ValueChannel* vc;
+	Index i;
+
+	TRY(flushWindow(strm));
+	ch->flushing = TRUE;
+
+	if(!ch->cio.deflate || ch->valueCount <= CHANNEL_SMALL_VALUE_COUNT)
+	{
+		TRY(beginCompressedStream(&ch->cio));
+		TRY(writeChannel(strm, &ch->structure, INDEX_MAX));
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			vc = &ch->channels.channel[i];
+			TRY(writeChannel(strm, &vc->data, vc->first));
+		}
+		TRY(endCompressedStream(&ch->cio));
+	}
+	else
+	{
+		boolean smallStream = FALSE;
+
+		TRY(beginCompressedStream(&ch->cio));
+		TRY(writeChannel(strm, &ch->structure, INDEX_MAX));
+		TRY(endCompressedStream(&ch->cio));
+
+		// The channels with up to CHANNEL_SMALL_VALUE_COUNT values are combined
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			vc = &ch->channels.channel[i];
+			if(vc->valueCount <= CHANNEL_SMALL_VALUE_COUNT)
+			{
+				if(!smallStream)
+				{
+					TRY(beginCompressedStream(&ch->cio));
+					smallStream = TRUE;
+				}
+				TRY(writeChannel(strm, &vc->data, vc->first));
+			}
+		}
+		if(smallStream)
+		{
+			TRY(endCompressedStream(&ch->cio));
+		}
+
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			vc = &ch->channels.channel[i];
+			if(vc->valueCount > CHANNEL_SMALL_VALUE_COUNT)
+			{
+				TRY(beginCompressedStream(&ch->cio));
+				TRY(writeChannel(strm, &vc->data, vc->first));
+				TRY(endCompressedStream(&ch->cio));
+			}
+		}
+	}
+
+	ch->flushing = FALSE;
+
+	return resetBlock(ch);
+}
+
+errorCode closeBlockChannels(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+
+	TRY(writeBlock(strm));
+
+	if(ch->cio.ioIndx == ch->cio.io.bufLen && ch->cio.io.ioStrm.readWriteToStream != NULL)
+	{
+		TRY(flushCompressedIO(&ch->cio));
+	}
+
+	destroyBlockChannels(strm);
+
+	return EXIP_OK;
+}
+
+errorCode deferValueItem(EXIStream* strm, Index typeId, QNameID qnameID)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	ValueChannel* vc;
+	EventRecord* rec;
+	Index channelIndx;
+	Index recIndx;
+
+	TRY(findChannel(ch, qnameID, &channelIndx));
+	TRY(addEmptyDynEntry(&ch->events.dynArray, (void**) &rec, &recIndx));
+
+	rec->kind = RECORD_VALUE;
+	rec->data.value.typeId = typeId;
+	rec->data.value.qnameId = qnameID;
+	rec->data.value.next = INDEX_MAX;
+	rec->data.value.first = 0;
+	rec->data.value.count = 0;
+
+	vc = &ch->channels.channel[channelIndx];
+	if(vc->first == INDEX_MAX)
+		vc->first = recIndx;
+	else
+		ch->events.record[vc->last].data.value.next = recIndx;
+	vc->last = recIndx;
+	vc->valueCount += 1;
+	ch->valueCount += 1;
+
+	return EXIP_OK;
+}
+
+#if COMPRESSION_THREAD_USE
+/**
+ * Frees the data of the inflate thread (cio and the slots) and ch, whose
+ * other members are already freed
+ */
+static void freeInflateData(BlockChannels* ch)
+{
+	struct inflateQueue* q = &ch->queue;
+	Index i;
+
+	for(i = 0; i < COMPRESSION_THREAD_QUEUE_SIZE; i++)
+		freeOctets(&q->slot[i]);
+	if(q->input != NULL)
+		EXIP_MFREE(q->input);
+	destroyCompressedIO(&ch->cio);
+	if(q->started)
+	{
+		pthread_cond_destroy(&q->cond);
+		pthread_mutex_destroy(&q->lock);
+	}
+
+	EXIP_MFREE(ch);
+}
+
+/**
+ * The input stream of the inflate thread: reads from the input stream of the
+ * application unless the parser stopped the thread. The octets of a read that
+ * returns after the stop are dropped
+ */
+static size_t readInput(void* buf, size_t size, void* stream)
+{
+	struct inflateQueue* q = &((BlockChannels*) stream)->queue;
+	size_t count;
+
+	pthread_mutex_lock(&q->lock);
+	if(q->stop)
+	{
+		pthread_mutex_unlock(&q->lock);
+		return 0;
+	}
+	q->reading = TRUE;
+	pthread_mutex_unlock(&q->lock);
+
+	count = q->appStrm.readWriteToStream(buf, size, q->appStrm.stream);
+
+	pthread_mutex_lock(&q->lock);
+	q->reading = FALSE;
+	if(q->stop)
+		count = 0;
+	pthread_mutex_unlock(&q->lock);
+
+	return count;
+}
+
+/**
+ * The inflate thread: inflates the DEFLATE streams announced by the parser
+ * one after the other into the free slots of BlockChannels.queue until
+ * the input ends, an error occurs or the parser stops it
+ */
+static void* inflateStreams(void* arg)
+{
+	BlockChannels* ch = (BlockChannels*) arg;
+	struct inflateQueue* q = &ch->queue;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index slot;
+	boolean orphan;
+	void (*inputReleased)(void* app_data);
+	void* app_data;
+
+	pthread_mutex_lock(&q->lock);
+	while(!q->stop)
+	{
+		if(q->count == COMPRESSION_THREAD_QUEUE_SIZE || q->inflated == q->announced)
+		{
+			pthread_cond_wait(&q->cond, &q->lock);
+			continue;
+		}
+
+		// The slot is not used by the parser until count is incremented
+		slot = (q->head + q->count) % COMPRESSION_THREAD_QUEUE_SIZE;
+		pthread_mutex_unlock(&q->lock);
+
+		tmp_err_code = readCompressedStream(&ch->cio, &q->slot[slot]);
+
+		pthread_mutex_lock(&q->lock);
+		if(tmp_err_code != EXIP_OK)
+		{
+			q->workerErr = tmp_err_code;
+			break;
+		}
+		q->count += 1;
+		q->inflated += 1;
+		pthread_cond_broadcast(&q->cond);
+	}
+	orphan = q->orphan;
+	inputReleased = q->inputReleased;
+	app_data = q->released_data;
+	pthread_cond_broadcast(&q->cond);
+	pthread_mutex_unlock(&q->lock);
+
+	// The parser is destroyed: nothing else uses ch or the input stream
+	if(orphan)
+	{
+		freeInflateData(ch);
+		if(inputReleased != NULL)
+			inputReleased(app_data);
+	}
+
+	return NULL;
+}
+
+/**
+ * Lets the inflate thread inflate the remaining streams of the block whose
+ * structure channel is decoded and the structure stream of the next block
+ */
+static void announceBlockStreams(BlockChannels* ch)
+{
+	struct inflateQueue* q = &ch->queue;
+	Index streams = ch->documentEnd ? 0 : 1;
+	boolean smallStream = FALSE;
+	Index i;
+
+	if(ch->valueCount > CHANNEL_SMALL_VALUE_COUNT)
+	{
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			if(ch->channels.channel[i].valueCount <= CHANNEL_SMALL_VALUE_COUNT)
+				smallStream = TRUE;
+			else
+				streams += 1;
+		}
+		if(smallStream)
+			streams += 1;
+	}
+
+	pthread_mutex_lock(&q->lock);
+	q->announced += streams;
+	pthread_cond_broadcast(&q->cond);
+	pthread_mutex_unlock(&q->lock);
+}
+
+/**
+ * Returns the next inflated DEFLATE stream of the inflate thread, which is
+ * started by the first call. The stream returned by the previous call is released
+ */
+static errorCode takeInflatedStream(BlockChannels* ch, OctetBuffer** inflated)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	struct inflateQueue* q = &ch->queue;
+
+	if(!q->started)
+	{
+		if(ch->cio.io.ioStrm.readWriteToStream != NULL && q->input == NULL)
+		{
+			// The thread reads into a buffer of its own, which outlives the
+			// parser when it is destroyed during a read
+			q->input = (char*) EXIP_MALLOC(ch->cio.io.bufLen);
+			if(q->input == NULL)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+			memcpy(q->input, ch->cio.io.buf + ch->cio.ioIndx, ch->cio.io.bufContent - ch->cio.ioIndx);
+			q->appStrm = ch->cio.io.ioStrm;
+			ch->cio.io.buf = q->input;
+			ch->cio.io.bufContent -= ch->cio.ioIndx;
+			ch->cio.ioIndx = 0;
+			ch->cio.io.ioStrm.readWriteToStream = readInput;
+			ch->cio.io.ioStrm.stream = ch;
+		}
+
+		if(pthread_mutex_init(&q->lock, NULL) != 0)
+			return EXIP_UNEXPECTED_ERROR;
+		if(pthread_cond_init(&q->cond, NULL) != 0)
+		{
+			pthread_mutex_destroy(&q->lock);
+			return EXIP_UNEXPECTED_ERROR;
+		}
+		if(pthread_create(&q->worker, NULL, inflateStreams, ch) != 0)
+		{
+			pthread_cond_destroy(&q->cond);
+			pthread_mutex_destroy(&q->lock);
+			return EXIP_UNEXPECTED_ERROR;
+		}
+		q->started = TRUE;
+	}
+
+	pthread_mutex_lock(&q->lock);
+	if(q->holding)
+	{
+		q->head = (q->head + 1) % COMPRESSION_THREAD_QUEUE_SIZE;
+		q->count -= 1;
+		q->holding = FALSE;
+		pthread_cond_broadcast(&q->cond);
+	}
+
+	while(q->count == 0 && q->workerErr == EXIP_OK)
+		pthread_cond_wait(&q->cond, &q->lock);
+
+	if(q->count == 0)
+		tmp_err_code = q->workerErr;
+	else
+	{
+		q->holding = TRUE;
+		*inflated = &q->slot[q->head];
+		tmp_err_code = EXIP_OK;
+	}
+	pthread_mutex_unlock(&q->lock);
+
+	return tmp_err_code;
+}
+#endif
+
+/**
+ * Inflates the next DEFLATE stream and decodes from it
+ */
+static errorCode nextInflatedStream(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	OctetBuffer* inflated = NULL;
+
+#if COMPRESSION_THREAD_USE
+	TRY(takeInflatedStream(ch, &inflated));
+#else
+	inflated = &ch->inflated;
+	TRY(readCompressedStream(&ch->cio, inflated));
+#endif
+
+	strm->buffer.buf = inflated->buf;
+	strm->buffer.bufLen = inflated->size;
+	strm->buffer.bufContent = inflated->size;
+	strm->buffer.ioStrm.readWriteToStream = NULL;
+	strm->buffer.ioStrm.stream = NULL;
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 0;
+
+	return EXIP_OK;
+}
+
+/**
+ * Decodes the values of a value channel into BlockChannels.values
+ */
+static errorCode decodeChannel(EXIStream* strm, Index channelIndx)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	SmallIndex nonTermID = GR_VOID_NON_TERMINAL;
+	EventRecord* rec;
+	Index r = ch->channels.channel[channelIndx].first;
+	Index first;
+
+	while(r != INDEX_MAX)
+	{
+		first = ch->values.count;
+		rec = &ch->events.record[r];
+		TRY(decodeValueItem(strm, rec->data.value.typeId, &recordingHandler, &nonTermID, rec->data.value.qnameId, ch));
+		rec->data.value.first = first;
+		rec->data.value.count = ch->values.count - first;
+		r = rec->data.value.next;
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * Decodes the next block: the structure channel first, recording the
+ * events, then the value channels
+ */
+static errorCode decodeBlock(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	SmallIndex nonTermID;
+	Index i;
+
+	TRY(resetBlock(ch));
+
+	if(ch->cio.deflate)
+	{
+		TRY(nextInflatedStream(strm));
+	}
+
+	ch->deferValues = TRUE;
+	ch->recording = &ch->events;
+	do
+	{
+		nonTermID = GR_VOID_NON_TERMINAL;
+		TRY(processNextProduction(strm, &nonTermID, &recordingHandler, ch));
+
+		if(nonTermID == GR_VOID_NON_TERMINAL)
+		{
+			popGrammar(strm);
+			if(strm->gStack == NULL)
+			{
+				ch->documentEnd = TRUE;
+				break;
+			}
+		}
+		else
+			strm->gStack->currNonTermID = nonTermID;
+	}
+	while(ch->valueCount < strm->header.opts.blockSize);
+
+#if COMPRESSION_THREAD_USE
+	if(ch->cio.deflate)
+		announceBlockStreams(ch);
+#endif
+
+	ch->deferValues = FALSE;
+	ch->recording = &ch->values;
+
+	if(!ch->cio.deflate || ch->valueCount <= CHANNEL_SMALL_VALUE_COUNT)
+	{
+		for(i = 0; i < ch->channels.count; i++)
+			TRY(decodeChannel(strm, i));
+	}
+	else
+	{
+		boolean smallStream = FALSE;
+
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			if(ch->channels.channel[i].valueCount <= CHANNEL_SMALL_VALUE_COUNT)
+			{
+				if(!smallStream)
+				{
+					TRY(nextInflatedStream(strm));
+					smallStream = TRUE;
+				}
+				TRY(decodeChannel(strm, i));
+			}
+		}
+
+		for(i = 0; i < ch->channels.count; i++)
+		{
+			if(ch->channels.channel[i].valueCount > CHANNEL_SMALL_VALUE_COUNT)
+			{
+				TRY(nextInflatedStream(strm));
+				TRY(decodeChannel(strm, i));
+			}
+		}
+	}
+
+	return EXIP_OK;
+}
+
+errorCode parseNextFromChannels(EXIStream* strm, ContentHandler* handler, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+
+	while(ch->replayIndx == ch->events.count)
+	{
+		if(ch->documentEnd)
+			return EXIP_PARSING_COMPLETE;
+
+		TRY(decodeBlock(strm));
+	}
+
+	TRY(deliverRecord(strm, &ch->events.record[ch->replayIndx], handler, app_data));
+	ch->replayIndx += 1;
+
+	if(ch->documentEnd && ch->replayIndx == ch->events.count)
+		return EXIP_PARSING_COMPLETE;
+
+	return EXIP_OK;
+}
+
+/**
+ * Invokes the callback of the application for a recorded event;
+ * with a NULL handler the event is stored in the EventSink app_data
+ */
+static errorCode deliverRecord(EXIStream* strm, EventRecord* rec, ContentHandler* handler, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+
+	if(handler == NULL)
+		return sinkRecord(strm, rec, (EventSink*) app_data);
+
+	switch(rec->kind)
+	{
+		case RECORD_END_DOCUMENT:
+			if(handler->endDocument != NULL)
+				TRY(handler->endDocument(app_data));
+		break;
+		case RECORD_START_ELEMENT:
+		case RECORD_ATTRIBUTE:
+		case RECORD_QNAME:
+		{
+			QName qname;
+
+			qname.uri = &rec->data.qname.uri;
+			qname.localName = &rec->data.qname.localName;
+			qname.prefix = rec->data.qname.hasPrefix ? &rec->data.qname.prefix : NULL;
+
+			if(rec->kind == RECORD_START_ELEMENT && handler->startElement != NULL)
+				TRY(handler->startElement(qname, app_data));
+			else if(rec->kind == RECORD_ATTRIBUTE && handler->attribute != NULL)
+				TRY(handler->attribute(qname, app_data));
+			else if(rec->kind == RECORD_QNAME && handler->qnameData != NULL)
+				TRY(handler->qnameData(qname, app_data));
+		}
+		break;
+		case RECORD_END_ELEMENT:
+			if(handler->endElement != NULL)
+				TRY(handler->endElement(app_data));
+		break;
+		case RECORD_NAMESPACE:
+			if(handler->namespaceDeclaration != NULL)
+				TRY(handler->namespaceDeclaration(rec->data.ns.ns, rec->data.ns.prefix, rec->data.ns.isLocal, app_data));
+		break;
+		case RECORD_SELF_CONTAINED:
+			if(handler->selfContained != NULL)
+				TRY(handler->selfContained(app_data));
+		break;
+		case RECORD_INT:
+			if(handler->intData != NULL)
+				TRY(handler->intData(rec->data.intVal, app_data));
+		break;
+		case RECORD_BOOLEAN:
+			if(handler->booleanData != NULL)
+				TRY(handler->booleanData(rec->data.boolVal, app_data));
+		break;
+		case RECORD_STRING:
+			if(handler->stringDataChunk != NULL)
+			{
+				if(handler->stringDataBegin != NULL)
+					TRY(handler->stringDataBegin(rec->data.strVal.length, app_data));
+				if(rec->data.strVal.length > 0)
+					TRY(handler->stringDataChunk(rec->data.strVal, app_data));
+				if(handler->stringDataEnd != NULL)
+					TRY(handler->stringDataEnd(app_data));
+			}
+			else if(handler->stringData != NULL)
+				TRY(handler->stringData(rec->data.strVal, app_data));
+		break;
+		case RECORD_FLOAT:
+			if(handler->floatData != NULL)
+				TRY(handler->floatData(rec->data.floatVal, app_data));
+		break;
+		case RECORD_BINARY:
+			if(handler->binaryDataChunk != NULL)
+			{
+				if(handler->binaryDataBegin != NULL)
+					TRY(handler->binaryDataBegin(rec->data.binary.nbytes, app_data));
+				if(rec->data.binary.nbytes > 0)
+					TRY(handler->binaryDataChunk(rec->data.binary.val, rec->data.binary.nbytes, app_data));
+				if(handler->binaryDataEnd != NULL)
+					TRY(handler->binaryDataEnd(app_data));
+			}
+			else if(handler->binaryData != NULL)
+				TRY(handler->binaryData(rec->data.binary.val, rec->data.binary.nbytes, app_data));
+		break;
+		case RECORD_DATE_TIME:
+			if(handler->dateTimeData != NULL)
+				TRY(handler->dateTimeData(rec->data.dtVal, app_data));
+		break;
+		case RECORD_DECIMAL:
+			if(handler->decimalData != NULL)
+				TRY(handler->decimalData(rec->data.decVal, app_data));
+		break;
+		case RECORD_LIST:
+			if(handler->listData != NULL)
+				TRY(handler->listData(rec->data.list.exiType, rec->data.list.itemCount, app_data));
+		break;
+		case RECORD_VALUE:
+		{
+			Index i;
+
+			for(i = rec->data.value.first; i < rec->data.value.first + rec->data.value.count; i++)
+				TRY(deliverRecord(strm, &ch->values.record[i], handler, app_data));
+		}
+		break;
+		default:
+			return EXIP_UNEXPECTED_ERROR;
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * Stores a recorded event in an EventSink; the kinds of the records are those of the events.
+ * The ids of the QNames of the elements and attributes are looked up in the string tables.
+ * The strings and binary values in blockMem are copied as the next block reuses it.
+ * The other qnameId of the events are set by parseNextBatch()
+ */
+static errorCode sinkRecord(EXIStream* strm, EventRecord* rec, EventSink* sink)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = strm->channels;
+	QNameID qnameId = {URI_MAX, LN_MAX};
+	EXIEvent* ev;
+	Index i;
+
+	if(rec->kind == RECORD_VALUE)
+	{
+		for(i = rec->data.value.first; i < rec->data.value.first + rec->data.value.count; i++)
+			TRY(sinkRecord(strm, &ch->values.record[i], sink));
+		return EXIP_OK;
+	}
+
+	if(rec->kind == RECORD_START_ELEMENT || rec->kind == RECORD_ATTRIBUTE)
+	{
+		if(!lookupUri(&strm->uriTable, rec->data.qname.uri, &qnameId.uriId) ||
+				!lookupLn(&strm->uriTable.uri[qnameId.uriId].lnTable, rec->data.qname.localName, &qnameId.lnId))
+			return EXIP_INCONSISTENT_PROC_STATE;
+	}
+
+	TRY(addSinkEvent(sink, rec->kind, qnameId, &ev));
+
+	switch(rec->kind)
+	{
+		case RECORD_START_ELEMENT:
+		case RECORD_ATTRIBUTE:
+			ev->data.prefix.str = NULL;
+			ev->data.prefix.length = 0;
+			if(rec->data.qname.hasPrefix)
+				ev->data.prefix = rec->data.qname.prefix;
+		break;
+		case RECORD_QNAME:
+		{
+			EXIQNameValue* qname = (EXIQNameValue*) memManagedAllocate(sink->mem, sizeof(EXIQNameValue));
+			if(qname == NULL)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+			qname->uri = rec->data.qname.uri;
+			qname->localName = rec->data.qname.localName;
+			qname->hasPrefix = rec->data.qname.hasPrefix;
+			if(rec->data.qname.hasPrefix)
+				qname->prefix = rec->data.qname.prefix;
+			else
+				getEmptyString(&qname->prefix);
+			ev->data.qname = qname;
+		}
+		break;
+		case RECORD_NAMESPACE:
+		{
+			EXINamespace* ns = (EXINamespace*) memManagedAllocate(sink->mem, sizeof(EXINamespace));
+			if(ns == NULL)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+			ns->ns = rec->data.ns.ns;
+			ns->prefix = rec->data.ns.prefix;
+			ns->isLocal = rec->data.ns.isLocal;
+			ev->data.ns = ns;
+		}
+		break;
+		case RECORD_INT:
+			ev->data.intVal = rec->data.intVal;
+		break;
+		case RECORD_BOOLEAN:
+			ev->data.boolVal = rec->data.boolVal;
+		break;
+		case RECORD_STRING:
+			if(isStringEmpty(&rec->data.strVal))
+				getEmptyString(&ev->data.strVal);
+			else
+				TRY(cloneStringManaged(&rec->data.strVal, &ev->data.strVal, sink->mem));
+		break;
+		case RECORD_FLOAT:
+			ev->data.floatVal = rec->data.floatVal;
+		break;
+		case RECORD_BINARY:
+			ev->data.binary.nbytes = rec->data.binary.nbytes;
+			ev->data.binary.val = NULL;
+			if(rec->data.binary.nbytes > 0)
+			{
+				char* val = memManagedAllocate(sink->mem, rec->data.binary.nbytes);
+				if(val == NULL)
+					return EXIP_MEMORY_ALLOCATION_ERROR;
+				memcpy(val, rec->data.binary.val, rec->data.binary.nbytes);
+				ev->data.binary.val = val;
+			}
+		break;
+		case RECORD_DATE_TIME:
+		{
+			EXIPDateTime* dtVal = (EXIPDateTime*) memManagedAllocate(sink->mem, sizeof(EXIPDateTime));
+			if(dtVal == NULL)
+				return EXIP_MEMORY_ALLOCATION_ERROR;
+			*dtVal = rec->data.dtVal;
+			ev->data.dtVal = dtVal;
+		}
+		break;
+		case RECORD_DECIMAL:
+			ev->data.decVal = rec->data.decVal;
+		break;
+		case RECORD_LIST:
+			ev->data.list.exiType = rec->data.list.exiType;
+			ev->data.list.itemCount = rec->data.list.itemCount;
+		break;
+		case RECORD_END_DOCUMENT:
+		case RECORD_END_ELEMENT:
+		case RECORD_SELF_CONTAINED:
+		break;
+		default:
+			return EXIP_UNEXPECTED_ERROR;
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * Adds a record to BlockChannels.recording
+ */
+static errorCode addRecord(void* app_data, unsigned char kind, EventRecord** rec)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BlockChannels* ch = (BlockChannels*) app_data;
+	Index recIndx;
+
+	TRY(addEmptyDynEntry(&ch->recording->dynArray, (void**) rec, &recIndx));
+	(*rec)->kind = kind;
+
+	return EXIP_OK;
+}
+
+/**
+ * The strings of a QName are in the string tables; only the String structures are copied
+ */
+static errorCode recordQName(void* app_data, unsigned char kind, QName qname)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, kind, &rec));
+	rec->data.qname.uri = *qname.uri;
+	rec->data.qname.localName = *qname.localName;
+	rec->data.qname.hasPrefix = qname.prefix != NULL;
+	if(qname.prefix != NULL)
+		rec->data.qname.prefix = *qname.prefix;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_endDocument(void* app_data)
+{
+	EventRecord* rec;
+	return addRecord(app_data, RECORD_END_DOCUMENT, &rec);
+}
+
+static errorCode rec_startElement(QName qname, void* app_data)
+{
+	return recordQName(app_data, RECORD_START_ELEMENT, qname);
+}
+
+static errorCode rec_endElement(void* app_data)
+{
+	EventRecord* rec;
+	return addRecord(app_data, RECORD_END_ELEMENT, &rec);
+}
+
+static errorCode rec_attribute(QName qname, void* app_data)
+{
+	return recordQName(app_data, RECORD_ATTRIBUTE, qname);
+}
+
+static errorCode rec_intData(Integer int_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_INT, &rec));
+	rec->data.intVal = int_val;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_booleanData(boolean bool_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_BOOLEAN, &rec));
+	rec->data.boolVal = bool_val;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_stringData(const String str_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_STRING, &rec));
+	if(isStringEmpty(&str_val))
+		getEmptyString(&rec->data.strVal);
+	else
+		TRY(cloneStringManaged(&str_val, &rec->data.strVal, &((BlockChannels*) app_data)->blockMem));
+
+	return EXIP_OK;
+}
+
+static errorCode rec_floatData(Float float_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_FLOAT, &rec));
+	rec->data.floatVal = float_val;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_binaryData(const char* binary_val, Index nbytes, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_BINARY, &rec));
+	rec->data.binary.nbytes = nbytes;
+	rec->data.binary.val = NULL;
+	if(nbytes > 0)
+	{
+		rec->data.binary.val = memManagedAllocate(&((BlockChannels*) app_data)->blockMem, nbytes);
+		if(rec->data.binary.val == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		memcpy(rec->data.binary.val, binary_val, nbytes);
+	}
+
+	return EXIP_OK;
+}
+
+static errorCode rec_dateTimeData(EXIPDateTime dt_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_DATE_TIME, &rec));
+	rec->data.dtVal = dt_val;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_decimalData(Decimal dec_val, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_DECIMAL, &rec));
+	rec->data.decVal = dec_val;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_listData(EXITypeClass exiType, unsigned int itemCount, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_LIST, &rec));
+	rec->data.list.exiType = exiType;
+	rec->data.list.itemCount = itemCount;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_qnameData(const QName qname, void* app_data)
+{
+	return recordQName(app_data, RECORD_QNAME, qname);
+}
+
+static errorCode rec_namespaceDeclaration(const String ns, const String prefix, boolean isLocalElementNS, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventRecord* rec;
+
+	TRY(addRecord(app_data, RECORD_NAMESPACE, &rec));
+	rec->data.ns.ns = ns;
+	rec->data.ns.prefix = prefix;
+	rec->data.ns.isLocal = isLocalElementNS;
+
+	return EXIP_OK;
+}
+
+static errorCode rec_selfContained(void* app_data)
+{
+	EventRecord* rec;
+	return addRecord(app_data, RECORD_SELF_CONTAINED, &rec);
+}
+
+#endif /* COMPRESSION_USE */
@@ -22,11 +22,23 @@
 #include "grammars.h"
 #include "dynamicArray.h"
 #include "stringManipulate.h"
+#include "bodyChannels.h"
 
 
 static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRule, SmallIndex* nonTermID_out, ContentHandler* handler, void* app_data);
+static errorCode decodeLayoutState(EXIStream* strm, const EventCodeLayout* layout, unsigned int* state);
 static errorCode handleProduction(EXIStream* strm, Production* prodHit, SmallIndex* nonTermID_out, ContentHandler* handler, void* app_data);
 static errorCode decodeQNameValue(EXIStream* strm, ContentHandler* handler, SmallIndex* nonTermID_out, void* app_data);
+static errorCode decodeStringValueContent(EXIStream* strm, QNameID qnameID, UnsignedInteger tmpVar, AllocList* valueMem, String* value);
+static errorCode decodeSinkStringValue(EXIStream* strm, QNameID qnameID, EventSink* sink, String* value);
+static errorCode sinkEvent(void* app_data, unsigned char kind, QNameID qnameId);
+static errorCode sinkQName(void* app_data, unsigned char kind, QName qname, QNameID qnameId);
+static errorCode sinkInt(void* app_data, Integer int_val, QNameID qnameId);
+static errorCode sinkBoolean(void* app_data, boolean bool_val, QNameID qnameId);
+static errorCode sinkBinary(void* app_data, char* binary_val, Index nbytes, boolean view, QNameID qnameId);
+
+/** The qnameId of the events without element or attribute */
+static const QNameID voidSinkQNameID = {URI_MAX, LN_MAX};
 
 errorCode processNextProduction(EXIStream* strm, SmallIndex* nonTermID_out, ContentHandler* handler, void* app_data)
 {
@@ -57,7 +69,7 @@ errorCode processNextProduction(EXIStream* strm, SmallIndex* nonTermID_out, Cont
 		currentRule = &strm->gStack->grammar->rule[currNonTermID];
 
 #if DEBUG_CONTENT_IO == ON
-	TRY(printGrammarRule(currNonTermID, currentRule, strm->schema));
+	TRY(printGrammarRule(currNonTermID, currentRule, strm->schema, &strm->uriTable));
 #endif
 
 	if(strm->context.isNilType == FALSE)
@@ -73,7 +85,9 @@ errorCode processNextProduction(EXIStream* strm, SmallIndex* nonTermID_out, Cont
 			if(bitCount > 0)
 				TRY(decodeNBitUnsignedInteger(strm, bitCount, &tmp_bits_val));
 			strm->context.isNilType = FALSE;
-			if(handler->endElement != NULL)
+			if(handler == NULL)
+				TRY(sinkEvent(app_data, EXI_EVENT_END_ELEMENT, strm->gStack->currQNameID));
+			else if(handler->endElement != NULL)
 			{
 				TRY(handler->endElement(app_data));
 			}
@@ -82,7 +96,10 @@ errorCode processNextProduction(EXIStream* strm, SmallIndex* nonTermID_out, Cont
 		}
 	}
 
-	bitCount = getBitsFirstPartCode(strm, prodCount, currNonTermID);
+	if(strm->context.isNilType)
+		bitCount = getBitsFirstPartCode(strm, prodCount, currNonTermID);
+	else
+		bitCount = GET_BITS_FIRST_PART_CODE(strm, currentRule, currNonTermID);
 
 	if(prodCount > 0)
 	{
@@ -104,7 +121,9 @@ errorCode processNextProduction(EXIStream* strm, SmallIndex* nonTermID_out, Cont
 					{
 						// Always last so this is an EE event
 						strm->context.isNilType = FALSE;
-						if(handler->endElement != NULL)
+						if(handler == NULL)
+							TRY(sinkEvent(app_data, EXI_EVENT_END_ELEMENT, strm->gStack->currQNameID));
+						else if(handler->endElement != NULL)
 						{
 							TRY(handler->endElement(app_data));
 						}
@@ -133,7 +152,9 @@ static errorCode handleProduction(EXIStream* strm, Production* prodHit, SmallInd
 	{
 		case EVENT_ED:
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("> ED event:\n"));
-			if(handler->endDocument != NULL)
+			if(handler == NULL)
+				TRY(sinkEvent(app_data, EXI_EVENT_END_DOCUMENT, voidSinkQNameID));
+			else if(handler->endDocument != NULL)
 			{
 				TRY(handler->endDocument(app_data));
 			}
@@ -141,14 +162,18 @@ static errorCode handleProduction(EXIStream* strm, Production* prodHit, SmallInd
 		case EVENT_EE:
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("> EE event:\n"));
 			strm->context.isNilType = FALSE;
-			if(handler->endElement != NULL)
+			if(handler == NULL)
+				TRY(sinkEvent(app_data, EXI_EVENT_END_ELEMENT, strm->gStack->currQNameID));
+			else if(handler->endElement != NULL)
 			{
 				TRY(handler->endElement(app_data));
 			}
 		break;
 		case EVENT_SC:
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("> SC event:\n"));
-			if(handler->selfContained != NULL)
+			if(handler == NULL)
+				TRY(sinkEvent(app_data, EXI_EVENT_SELF_CONTAINED, voidSinkQNameID));
+			else if(handler->selfContained != NULL)
 			{
 				TRY(handler->selfContained(app_data));
 			}
@@ -161,12 +186,30 @@ static errorCode handleProduction(EXIStream* strm, Production* prodHit, SmallInd
 	return EXIP_OK;
 }
 
-static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRule, SmallIndex* nonTermID_out, ContentHandler* handler, void* app_data)
+static errorCode decodeLayoutState(EXIStream* strm, const EventCodeLayout* layout, unsigned int* state)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	unsigned int prodCnt = 0;
 	unsigned long tmp_bits_val = 0;
 
+	if(layout->count == 0)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	if(layout->bits > 0)
+	{
+		TRY(decodeNBitUnsignedInteger(strm, layout->bits, &tmp_bits_val));
+		if(tmp_bits_val >= layout->count)
+			return EXIP_INCONSISTENT_PROC_STATE;
+	}
+
+	*state = layout->state[tmp_bits_val];
+
+	return EXIP_OK;
+}
+
+static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRule, SmallIndex* nonTermID_out, ContentHandler* handler, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
 	if(IS_BUILT_IN_ELEM(strm->gStack->grammar->props))
 	{
 		// Built-in element grammar
@@ -175,67 +218,20 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 
 		/* There are 8 possible states to exit the state machine: EE, AT (*), NS etc.
 		 * The state depends on the input event code from the stream and the
-		 * available productions at level 2.
+		 * available productions at level 2 of the rule (strm->eventCodes.builtIn).
 		 * (Note this is the state for level 2 productions) */
-		unsigned long state = 0;
-
-		/* The state mask stores the availability of the productions on level 2.
-		 * They are encoded ordered:
-		 * Availability for EE is encoded in position 0,
-		 * availability for AT(xsi:type) is encoded in position 1,
-		 * and so on. */
-		boolean state_mask[8] = {FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE};
-		unsigned int i;
-
-		prodCnt = 2; // Always SE, CH, position 4, 5
-		state_mask[4] = TRUE;
-		state_mask[5] = TRUE;
-
-		if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-		{
-			prodCnt += 2; // EE, AT, position 0, 1
-			state_mask[0] = TRUE;
-			state_mask[1] = TRUE;
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES))
-			{
-				prodCnt += 1; // NS, position 2
-				state_mask[2] = TRUE;
-			}
-
-			if(WITH_SELF_CONTAINED(strm->header.opts.enumOpt))
-			{
-				prodCnt += 1; // SC, position 3
-				state_mask[3] = TRUE;
-			}
-		}
-
-		if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
-		{
-			prodCnt += 1; // ER position 6
-			state_mask[6] = TRUE;
-		}
-
-		if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
-		{
-			prodCnt += 1; // CM or PI, position 7
-			state_mask[7] = TRUE;
-		}
-
-		TRY(decodeNBitUnsignedInteger(strm, getBitsNumber(prodCnt - 1), &tmp_bits_val));
-		state = tmp_bits_val;
+		unsigned int state = 0;
 
-		for(i = 0; i <= state && state < 8; i++)
-		{
-			state = state + (state_mask[i] == 0);
-		}
+		TRY(decodeLayoutState(strm, &strm->eventCodes.builtIn[strm->gStack->currNonTermID != GR_START_TAG_CONTENT], &state));
 
 		switch(state)
 		{
 			case 0:
 				// StartTagContent : EE event
 				strm->context.isNilType = FALSE;
-				if(handler->endElement != NULL)
+				if(handler == NULL)
+					TRY(sinkEvent(app_data, EXI_EVENT_END_ELEMENT, strm->gStack->currQNameID));
+				else if(handler->endElement != NULL)
 				{
 					TRY(handler->endElement(app_data));
 				}
@@ -314,87 +310,12 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 		 * The state depends on the input event code from the stream and the
 		 * available productions at level 2 and 3.*/
 		unsigned int state = 0;
-		unsigned int level3ProdCnt = 0;
 
-		if(strm->gStack->currNonTermID == GR_DOC_CONTENT)
+		TRY(decodeLayoutState(strm, &strm->eventCodes.document[strm->gStack->currNonTermID != GR_DOC_CONTENT], &state));
+		if(state == 3)
 		{
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
-				prodCnt += 1; // DT event
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS))
-				level3ProdCnt += 1;
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
-				level3ProdCnt += 1;
-
-			if(level3ProdCnt > 0)
-				prodCnt += 1; // CM or PI third level
-
-			if(prodCnt == 2)
-			{
-				TRY(decodeNBitUnsignedInteger(strm, 1, &tmp_bits_val));
-				if(tmp_bits_val == 0)
-					state = 0;
-				else if(tmp_bits_val == 1)
-				{
-					// CM or PI third level
-					if(level3ProdCnt == 2)
-					{
-						TRY(decodeNBitUnsignedInteger(strm, 1, &tmp_bits_val));
-						state = tmp_bits_val + 1;
-					}
-					else if(level3ProdCnt == 1)
-					{
-						state = !IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) + 1;
-					}
-					else
-						return EXIP_INCONSISTENT_PROC_STATE;
-				}
-				else
-					return EXIP_INCONSISTENT_PROC_STATE;
-			}
-			else if(prodCnt == 1)
-			{
-				if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
-					state = 0;
-				else
-				{
-					// CM or PI third level
-					if(level3ProdCnt == 2)
-					{
-						TRY(decodeNBitUnsignedInteger(strm, 1, &tmp_bits_val));
-						state = tmp_bits_val + 1;
-					}
-					else if(level3ProdCnt == 1)
-					{
-						state = !IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) + 1;
-					}
-					else
-						return EXIP_INCONSISTENT_PROC_STATE;
-				}
-			}
-			else
-				return EXIP_INCONSISTENT_PROC_STATE;
-		}
-		else
-		{
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS))
-				prodCnt += 1; // CM second level
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
-				prodCnt += 1; // PI second level
-
-			if(prodCnt == 2)
-			{
-				TRY(decodeNBitUnsignedInteger(strm, 1, &tmp_bits_val));
-				state = tmp_bits_val + 1;
-			}
-			else if(prodCnt == 1)
-			{
-				state = !IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) + 1;
-			}
-			else
-				return EXIP_INCONSISTENT_PROC_STATE;
+			// CM or PI third level
+			TRY(decodeLayoutState(strm, &strm->eventCodes.document[1], &state));
 		}
 
 		switch(state)
@@ -435,29 +356,12 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 			{
 				/* There are 2 possible states to exit the state machine: AT(xsi:type) and AT(xsi:nil)
 				 * (Note this is the state for level 2 productions) */
-				unsigned long state = 1;
+				unsigned int state = 0;
 				boolean nil;
 
 				*nonTermID_out = GR_START_TAG_CONTENT;
 
-				if(HAS_NAMED_SUB_TYPE_OR_UNION(strm->gStack->grammar->props))
-				{
-					prodCnt += 1;
-					state = 0;
-				}
-
-				if(IS_NILLABLE(strm->gStack->grammar->props))
-					prodCnt += 1;
-
-				if(prodCnt == 0)
-					return EXIP_INCONSISTENT_PROC_STATE;
-				else if(prodCnt == 2)
-				{
-					TRY(decodeNBitUnsignedInteger(strm, 1, &state));
-					if(state > 1)
-						return EXIP_INCONSISTENT_PROC_STATE;
-				}
-				// if prodCnt == 1 -> zero bit encoded event
+				TRY(decodeLayoutState(strm, &strm->eventCodes.strict[EVENT_CODE_STRICT_LAYOUT(strm->gStack->grammar->props)], &state));
 
 				switch(state)
 				{
@@ -466,10 +370,12 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 						DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">AT(xsi:type) event\n"));
 						strm->context.currAttr.uriId = XML_SCHEMA_INSTANCE_ID;
 						strm->context.currAttr.lnId = XML_SCHEMA_INSTANCE_TYPE_ID;
-						qname.uri = &strm->schema->uriTable.uri[strm->context.currAttr.uriId].uriStr;
-						qname.localName = &GET_LN_URI_QNAME(strm->schema->uriTable, strm->context.currAttr).lnStr;
+						qname.uri = &strm->uriTable.uri[strm->context.currAttr.uriId].uriStr;
+						qname.localName = &GET_LN_URI_QNAME(strm->uriTable, strm->context.currAttr).lnStr;
 
-						if(handler->attribute != NULL)  // Invoke handler method
+						if(handler == NULL)
+							TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, strm->context.currAttr));
+						else if(handler->attribute != NULL)  // Invoke handler method
 						{
 							TRY(handler->attribute(qname, app_data));
 						}
@@ -484,17 +390,25 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 						DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">AT(xsi:nil) event\n"));
 						strm->context.currAttr.uriId = XML_SCHEMA_INSTANCE_ID;
 						strm->context.currAttr.lnId = XML_SCHEMA_INSTANCE_NIL_ID;
-						qname.uri = &strm->schema->uriTable.uri[strm->context.currAttr.uriId].uriStr;
-						qname.localName = &GET_LN_URI_QNAME(strm->schema->uriTable, strm->context.currAttr).lnStr;
+						qname.uri = &strm->uriTable.uri[strm->context.currAttr.uriId].uriStr;
+						qname.localName = &GET_LN_URI_QNAME(strm->uriTable, strm->context.currAttr).lnStr;
 
-						if(handler->attribute != NULL)  // Invoke handler method
+						if(handler == NULL)
 						{
-							TRY(handler->attribute(qname, app_data));
+							TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, strm->context.currAttr));
+							TRY(sinkBoolean(app_data, nil, strm->context.currAttr));
 						}
-
-						if(handler->booleanData != NULL)  // Invoke handler method
+						else
 						{
-							TRY(handler->booleanData(nil, app_data));
+							if(handler->attribute != NULL)  // Invoke handler method
+							{
+								TRY(handler->attribute(qname, app_data));
+							}
+
+							if(handler->booleanData != NULL)  // Invoke handler method
+							{
+								TRY(handler->booleanData(nil, app_data));
+							}
 						}
 						*nonTermID_out = GR_START_TAG_CONTENT;
 					break;
@@ -509,17 +423,10 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 		{
 			/* There are 11 possible states to exit the state machine: EE, AT(xsi:type), AT(xsi:nil) etc.
 			 * The state depends on the input event code from the stream and the
-			 * available productions at level 2.
+			 * available productions at level 2 of the rule (strm->eventCodes.schema).
 			 * (Note this is the state for level 2 productions) */
 			unsigned int state = 0;
-
-			/* The state mask stores the availability of the productions on level 2.
-			 * They are encoded ordered:
-			 * Availability for EE is encoded in position 0,
-			 * availability for AT(xsi:type) is encoded in position 1,
-			 * and so on. */
-			boolean state_mask[11] = {FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE};
-			unsigned int i;
+			boolean withAT;
 			// Create a copy of the content grammar if and only if there are AT
 			// productions that point to the content grammar rule OR the content index is 0.
 			// The content2 grammar rule is only needed in case the current rule is
@@ -541,68 +448,19 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 					isContent2Grammar = TRUE;
 			}
 
-			prodCnt = 2; // SE(*), CH(untyped) always available, position 7 and 8
-			state_mask[7] = TRUE;
-			state_mask[8] = TRUE;
-			if(isContent2Grammar ||
-					strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
-			{
-				prodCnt += 2; // AT(*), AT(untyped) third level, position 3 and 4
-				state_mask[3] = TRUE;
-				state_mask[4] = TRUE;
-			}
-
-			if(!RULE_CONTAIN_EE(currentRule->meta))
-			{
-				prodCnt += 1; // EE, position 0
-				state_mask[0] = TRUE;
-			}
-
-			if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-			{
-				prodCnt += 2; // AT(xsi:type), AT(xsi:nil), position 1 and 2
-				state_mask[1] = TRUE;
-				state_mask[2] = TRUE;
-
-				if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES))
-				{
-					prodCnt += 1; // NS, position 5
-					state_mask[5] = TRUE;
-				}
-				if(WITH_SELF_CONTAINED(strm->header.opts.enumOpt))
-				{
-					prodCnt += 1; // SC, position 6
-					state_mask[6] = TRUE;
-				}
-			}
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
-			{
-				prodCnt += 1; // ER, position 9
-				state_mask[9] = TRUE;
-			}
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
-			{
-				prodCnt += 1; // CM or PI, position 10
-				state_mask[10] = TRUE;
-			}
-
-			TRY(decodeNBitUnsignedInteger(strm, getBitsNumber(prodCnt - 1), &tmp_bits_val));
+			withAT = isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props);
 
-			state = tmp_bits_val;
-
-			for(i = 0; i <= state && state < 11; i++)
-			{
-				state = state + (state_mask[i] == 0);
-			}
+			TRY(decodeLayoutState(strm, &strm->eventCodes.schema[EVENT_CODE_SCHEMA_LAYOUT(strm->gStack->currNonTermID == GR_START_TAG_CONTENT,
+																						 withAT, RULE_CONTAIN_EE(currentRule->meta))], &state));
 
 			switch(state)
 			{
 				case 0:
 					// EE event
 					strm->context.isNilType = FALSE;
-					if(handler->endElement != NULL)
+					if(handler == NULL)
+						TRY(sinkEvent(app_data, EXI_EVENT_END_ELEMENT, strm->gStack->currQNameID));
+					else if(handler->endElement != NULL)
 					{
 						TRY(handler->endElement(app_data));
 					}
@@ -613,10 +471,12 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 					DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">AT(xsi:type) event\n"));
 					strm->context.currAttr.uriId = XML_SCHEMA_INSTANCE_ID;
 					strm->context.currAttr.lnId = XML_SCHEMA_INSTANCE_TYPE_ID;
-					qname.uri = &strm->schema->uriTable.uri[strm->context.currAttr.uriId].uriStr;
-					qname.localName = &GET_LN_URI_QNAME(strm->schema->uriTable, strm->context.currAttr).lnStr;
+					qname.uri = &strm->uriTable.uri[strm->context.currAttr.uriId].uriStr;
+					qname.localName = &GET_LN_URI_QNAME(strm->uriTable, strm->context.currAttr).lnStr;
 
-					if(handler->attribute != NULL)  // Invoke handler method
+					if(handler == NULL)
+						TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, strm->context.currAttr));
+					else if(handler->attribute != NULL)  // Invoke handler method
 					{
 						TRY(handler->attribute(qname, app_data));
 					}
@@ -633,17 +493,25 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 						DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">AT(xsi:nil) event\n"));
 						strm->context.currAttr.uriId = XML_SCHEMA_INSTANCE_ID;
 						strm->context.currAttr.lnId = XML_SCHEMA_INSTANCE_NIL_ID;
-						qname.uri = &strm->schema->uriTable.uri[strm->context.currAttr.uriId].uriStr;
-						qname.localName = &GET_LN_URI_QNAME(strm->schema->uriTable, strm->context.currAttr).lnStr;
+						qname.uri = &strm->uriTable.uri[strm->context.currAttr.uriId].uriStr;
+						qname.localName = &GET_LN_URI_QNAME(strm->uriTable, strm->context.currAttr).lnStr;
 
-						if(handler->attribute != NULL)  // Invoke handler method
+						if(handler == NULL)
 						{
-							TRY(handler->attribute(qname, app_data));
+							TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, strm->context.currAttr));
+							TRY(sinkBoolean(app_data, nil, strm->context.currAttr));
 						}
-
-						if(handler->booleanData != NULL)  // Invoke handler method
+						else
 						{
-							TRY(handler->booleanData(nil, app_data));
+							if(handler->attribute != NULL)  // Invoke handler method
+							{
+								TRY(handler->attribute(qname, app_data));
+							}
+
+							if(handler->booleanData != NULL)  // Invoke handler method
+							{
+								TRY(handler->booleanData(nil, app_data));
+							}
 						}
 						*nonTermID_out = GR_START_TAG_CONTENT;
 					}
@@ -667,7 +535,7 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 				break;
 				case 7:
 					// SE(*) content|same_rule
-					if(isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
+					if(withAT)
 					{
 						// currNonTermID should point to the content grammar rule
 						if(GET_CONTENT_INDEX(strm->gStack->grammar->props) == GR_START_TAG_CONTENT)
@@ -680,7 +548,7 @@ static errorCode stateMachineProdDecode(EXIStream* strm, GrammarRule* currentRul
 				case 8:
 					// CH [untyped value] content|same_rule
 					DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">CH event\n"));
-					if(isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
+					if(withAT)
 					{
 						// nonTermID_out should point to the content grammar rule
 						if(GET_CONTENT_INDEX(strm->gStack->grammar->props) == GR_START_TAG_CONTENT)
@@ -733,9 +601,9 @@ errorCode decodeQName(EXIStream* strm, QName* qname, QNameID* qnameID)
 	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Decoding QName\n"));
 
 	TRY(decodeUri(strm, &qnameID->uriId));
-	qname->uri = &(strm->schema->uriTable.uri[qnameID->uriId].uriStr);
+	qname->uri = &(strm->uriTable.uri[qnameID->uriId].uriStr);
 	TRY(decodeLn(strm, qnameID->uriId, &qnameID->lnId));
-	qname->localName = &GET_LN_P_URI_P_QNAME(&strm->schema->uriTable, qnameID).lnStr;
+	qname->localName = &GET_LN_P_URI_P_QNAME(&strm->uriTable, qnameID).lnStr;
 
 	return decodePfxQname(strm, qname, qnameID->uriId);
 }
@@ -744,7 +612,7 @@ errorCode decodeUri(EXIStream* strm, SmallIndex* uriId)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	unsigned long tmp_val_buf = 0;
-	unsigned char uriBits = getBitsNumber(strm->schema->uriTable.count);
+	unsigned char uriBits = getBitsNumber(strm->uriTable.count);
 
 	TRY(decodeNBitUnsignedInteger(strm, uriBits, &tmp_val_buf));
 	if(tmp_val_buf == 0) // uri miss
@@ -752,13 +620,13 @@ errorCode decodeUri(EXIStream* strm, SmallIndex* uriId)
 		String str;
 		DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">URI miss\n"));
 		TRY(decodeString(strm, &str));
-		TRY(addUriEntry(&strm->schema->uriTable, str, uriId));
+		TRY(addUriEntry(&strm->uriTable, str, uriId));
 	}
 	else // uri hit
 	{
 		DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">URI hit\n"));
 		*uriId = (SmallIndex) (tmp_val_buf - 1);
-		if(*uriId >= strm->schema->uriTable.count)
+		if(*uriId >= strm->uriTable.count)
 			return EXIP_INVALID_EXI_INPUT;
 	}
 
@@ -775,11 +643,11 @@ errorCode decodeLn(EXIStream* strm, Index uriId, Index* lnId)
 	if(tmpVar == 0) // local-name table hit
 	{
 		unsigned long l_lnId;
-		unsigned char lnBits = getBitsNumber((unsigned int)(strm->schema->uriTable.uri[uriId].lnTable.count - 1));
+		unsigned char lnBits = getBitsNumber((unsigned int)(strm->uriTable.uri[uriId].lnTable.count - 1));
 		DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">local-name table hit\n"));
 		TRY(decodeNBitUnsignedInteger(strm, lnBits, &l_lnId));
 
-		if(l_lnId >= strm->schema->uriTable.uri[uriId].lnTable.count)
+		if(l_lnId >= strm->uriTable.uri[uriId].lnTable.count)
 			return EXIP_INVALID_EXI_INPUT;
 		*lnId = (Index) l_lnId;
 	}
@@ -791,12 +659,9 @@ errorCode decodeLn(EXIStream* strm, Index uriId, Index* lnId)
 		TRY(allocateStringMemoryManaged(&(lnStr.str),(Index) (tmpVar - 1), &strm->memList));
 		TRY(decodeStringOnly(strm, (Index)tmpVar - 1, &lnStr));
 
-		if(strm->schema->uriTable.uri[uriId].lnTable.ln == NULL)
-		{
-			// Create local name table for this URI entry
-			TRY(createDynArray(&strm->schema->uriTable.uri[uriId].lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER));
-		}
-		TRY(addLnEntry(&strm->schema->uriTable.uri[uriId].lnTable, lnStr, lnId));
+		// The local name is added to the stream's own copy of the local names of the URI
+		TRY(ownLnTable(strm, uriId));
+		TRY(addLnEntry(&strm->uriTable.uri[uriId].lnTable, lnStr, lnId));
 	}
 
 	return EXIP_OK;
@@ -813,20 +678,20 @@ errorCode decodePfxQname(EXIStream* strm, QName* qname, SmallIndex uriId)
 	if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES) == FALSE)
 		return EXIP_OK;
 
-	if(strm->schema->uriTable.uri[uriId].pfxTable.count == 0)
+	if(strm->uriTable.uri[uriId].pfxTable.count == 0)
 		return EXIP_OK;
 
-	prefixBits = getBitsNumber(strm->schema->uriTable.uri[uriId].pfxTable.count - 1);
+	prefixBits = getBitsNumber(strm->uriTable.uri[uriId].pfxTable.count - 1);
 
 	if(prefixBits > 0)
 	{
 		TRY(decodeNBitUnsignedInteger(strm, prefixBits, &prefixID));
 
-		if(prefixID >= strm->schema->uriTable.uri[uriId].pfxTable.count)
+		if(prefixID >= strm->uriTable.uri[uriId].pfxTable.count)
 			return EXIP_INVALID_EXI_INPUT;
 	}
 
-	qname->prefix = &strm->schema->uriTable.uri[uriId].pfxTable.pfx[prefixID];
+	qname->prefix = &strm->uriTable.uri[uriId].pfxTable.pfx[prefixID];
 
 	return EXIP_OK;
 }
@@ -835,7 +700,7 @@ errorCode decodePfx(EXIStream* strm, SmallIndex uriId, SmallIndex* pfxId)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	unsigned long tmp_val_buf = 0;
-	unsigned char prfxBits = getBitsNumber(strm->schema->uriTable.uri[uriId].pfxTable.count);
+	unsigned char prfxBits = getBitsNumber(strm->uriTable.uri[uriId].pfxTable.count);
 
 	TRY(decodeNBitUnsignedInteger(strm, prfxBits, &tmp_val_buf));
 
@@ -844,13 +709,14 @@ errorCode decodePfx(EXIStream* strm, SmallIndex uriId, SmallIndex* pfxId)
 		String str;
 		DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Prefix miss\n"));
 		TRY(decodeString(strm, &str));
-		TRY(addPfxEntry(&strm->schema->uriTable.uri[uriId].pfxTable, str, pfxId));
+		TRY(ownPfxTable(strm, uriId));
+		TRY(addPfxEntry(&strm->uriTable.uri[uriId].pfxTable, str, pfxId));
 	}
 	else // prefix hit
 	{
 		DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Prefix hit\n"));
 		*pfxId = (SmallIndex) (tmp_val_buf-1);
-		if(*pfxId >= strm->schema->uriTable.uri[uriId].pfxTable.count)
+		if(*pfxId >= strm->uriTable.uri[uriId].pfxTable.count)
 			return EXIP_INVALID_EXI_INPUT;
 	}
 
@@ -863,6 +729,19 @@ errorCode decodeStringValue(EXIStream* strm, QNameID qnameID, String* value)
 	UnsignedInteger tmpVar = 0;
 	TRY(decodeUnsignedInteger(strm, &tmpVar));
 
+	return decodeStringValueContent(strm, qnameID, tmpVar, NULL, value);
+}
+
+/**
+ * Decodes a string value after its first Unsigned Integer:
+ * a value partition hit (0 or 1) or the string length + 2.
+ * A value that does not enter the value partitions is decoded into valueMem or,
+ * when NULL, into memory from allocateStringMemory() that the caller frees
+ */
+static errorCode decodeStringValueContent(EXIStream* strm, QNameID qnameID, UnsignedInteger tmpVar, AllocList* valueMem, String* value)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
 	if(tmpVar == 0) // "local" value partition table hit
 	{
 #if VALUE_CROSSTABLE_USE
@@ -870,7 +749,7 @@ errorCode decodeStringValue(EXIStream* strm, QNameID qnameID, String* value)
 		unsigned char vxBits;
 		VxTable* vxTable;
 
-		vxTable = GET_LN_URI_QNAME(strm->schema->uriTable, qnameID).vxTable;
+		vxTable = GET_LN_URI_QNAME(strm->uriTable, qnameID).vxTable;
 		assert(vxTable);
 		vxBits = getBitsNumber(vxTable->count - 1);
 		TRY(decodeNBitUnsignedInteger(strm, vxBits, &vxEntryId));
@@ -895,18 +774,136 @@ errorCode decodeStringValue(EXIStream* strm, QNameID qnameID, String* value)
 	{
 		Index vStrLen = (Index) tmpVar - 2;
 
-		TRY(allocateStringMemory(&value->str, vStrLen));
-		TRY(decodeStringOnly(strm, vStrLen, value));
-
 		if(vStrLen > 0 && vStrLen <= strm->header.opts.valueMaxLength && strm->header.opts.valuePartitionCapacity > 0)
 		{
 			// The value should be entered in the value partitions of the string tables
+			TRY(allocateStringMemory(&value->str, vStrLen));
+			TRY(decodeStringOnly(strm, vStrLen, value));
 			TRY(addValueEntry(strm, *value, qnameID));
 		}
+		else if(valueMem == NULL)
+		{
+			TRY(allocateStringMemory(&value->str, vStrLen));
+			TRY(decodeStringOnly(strm, vStrLen, value));
+		}
+		else if(vStrLen == 0)
+			getEmptyString(value);
+		else
+		{
+			TRY(allocateStringMemoryManaged(&value->str, vStrLen, valueMem));
+			TRY(decodeStringOnly(strm, vStrLen, value));
+		}
 	}
 	return EXIP_OK;
 }
 
+/**
+ * Delivers a whole string value with the chunked string callbacks of the handler
+ */
+static errorCode stringDataInOneChunk(ContentHandler* handler, String value, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	if(handler->stringDataBegin != NULL)
+		TRY(handler->stringDataBegin(value.length, app_data));
+	if(value.length > 0)
+		TRY(handler->stringDataChunk(value, app_data));
+	if(handler->stringDataEnd != NULL)
+		TRY(handler->stringDataEnd(app_data));
+
+	return EXIP_OK;
+}
+
+/**
+ * Decodes a string value and delivers it with the chunked string callbacks of the handler.
+ * The values that do not enter the value partitions are decoded VALUE_CHUNK_SIZE
+ * characters at a time; the others are decoded as by decodeStringValue()
+ */
+static errorCode decodeStringValueInChunks(EXIStream* strm, QNameID qnameID, ContentHandler* handler, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UnsignedInteger tmpVar = 0;
+	Index remaining;
+	Index size;
+	String chunk;
+
+	TRY(decodeUnsignedInteger(strm, &tmpVar));
+
+	if(tmpVar < 2 || (tmpVar - 2 > 0 && tmpVar - 2 <= strm->header.opts.valueMaxLength && strm->header.opts.valuePartitionCapacity > 0))
+	{
+		String value;
+
+		TRY(decodeStringValueContent(strm, qnameID, tmpVar, NULL, &value));
+		return stringDataInOneChunk(handler, value, app_data);
+	}
+
+	remaining = (Index) tmpVar - 2;
+	if(handler->stringDataBegin != NULL)
+		TRY(handler->stringDataBegin(remaining, app_data));
+
+	if(remaining > 0)
+	{
+		TRY(allocateStringMemory(&chunk.str, remaining < VALUE_CHUNK_SIZE ? remaining : VALUE_CHUNK_SIZE));
+
+		while(remaining > 0)
+		{
+			size = remaining < VALUE_CHUNK_SIZE ? remaining : VALUE_CHUNK_SIZE;
+			TRY_CATCH(decodeStringOnly(strm, size, &chunk), EXIP_MFREE(chunk.str));
+			TRY_CATCH(handler->stringDataChunk(chunk, app_data), EXIP_MFREE(chunk.str));
+			remaining -= size;
+		}
+
+		EXIP_MFREE(chunk.str);
+	}
+
+	if(handler->stringDataEnd != NULL)
+		TRY(handler->stringDataEnd(app_data));
+
+	return EXIP_OK;
+}
+
+/**
+ * Decodes a binary value and delivers it with the chunked binary callbacks of the handler
+ */
+static errorCode decodeBinaryInChunks(EXIStream* strm, ContentHandler* handler, void* app_data)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UnsignedInteger length = 0;
+	Index remaining;
+	Index size;
+	char* chunk;
+	char* scratch = NULL;
+
+	TRY(decodeUnsignedInteger(strm, &length));
+	remaining = (Index) length;
+
+	if(handler->binaryDataBegin != NULL)
+		TRY(handler->binaryDataBegin(remaining, app_data));
+
+	if(remaining > 0 && strm->context.bitPointer != 0)
+	{
+		// The octets of a value that is not byte-aligned are shifted to a scratch buffer
+		scratch = (char*) EXIP_MALLOC(VALUE_CHUNK_SIZE);
+		if(scratch == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+	}
+
+	while(remaining > 0)
+	{
+		TRY_CATCH(decodeBinaryChunk(strm, remaining, scratch, VALUE_CHUNK_SIZE, &chunk, &size), if(scratch != NULL) EXIP_MFREE(scratch));
+		TRY_CATCH(handler->binaryDataChunk(chunk, size, app_data), if(scratch != NULL) EXIP_MFREE(scratch));
+		remaining -= size;
+	}
+
+	if(scratch != NULL)
+		EXIP_MFREE(scratch);
+
+	if(handler->binaryDataEnd != NULL)
+		TRY(handler->binaryDataEnd(app_data));
+
+	return EXIP_OK;
+}
+
 errorCode decodeEventContent(EXIStream* strm, Production* prodHit, ContentHandler* handler,
 							SmallIndex* nonTermID_out, void* app_data)
 {
@@ -929,43 +926,47 @@ errorCode decodeEventContent(EXIStream* strm, Production* prodHit, ContentHandle
 		case EVENT_SE_QNAME:
 		{
 			EXIGrammar* elemGrammar = NULL;
+			QNameID qnameID;
 
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">SE(qname) event: \n"));
 			assert(strm->context.isNilType == FALSE);
 
-			qname.uri = &(strm->schema->uriTable.uri[prodHit->qnameId.uriId].uriStr);
-			qname.localName = &(GET_LN_URI_QNAME(strm->schema->uriTable, prodHit->qnameId).lnStr);
+			GET_PROD_QNAME_ID(prodHit, qnameID);
+			qname.uri = &(strm->uriTable.uri[qnameID.uriId].uriStr);
+			qname.localName = &(GET_LN_URI_QNAME(strm->uriTable, qnameID).lnStr);
 #if DEBUG_CONTENT_IO == ON && EXIP_DEBUG_LEVEL == INFO
 			printString(qname.uri);
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (" : "));
 			printString(qname.localName);
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n"));
 #endif
-			TRY(decodePfxQname(strm, &qname, prodHit->qnameId.uriId));
+			TRY(decodePfxQname(strm, &qname, qnameID.uriId));
 
 			strm->gStack->currNonTermID = *nonTermID_out;
 
 			// New element grammar is pushed on the stack
 			if(IS_BUILT_IN_ELEM(strm->gStack->grammar->props))  // If the current grammar is build-in Element grammar ...
 			{
-				elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, prodHit->qnameId);
+				elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, qnameID);
 			}
 			else
 			{
-				elemGrammar = &strm->schema->grammarTable.grammar[prodHit->typeId];
+				elemGrammar = &strm->schema->grammarTable.grammar[GET_PROD_TYPE_ID(prodHit)];
 			}
 
 			if(elemGrammar != NULL) // The grammar is found
 			{
 				*nonTermID_out = GR_START_TAG_CONTENT;
-				TRY(pushGrammar(&(strm->gStack), prodHit->qnameId, elemGrammar));
+				TRY(pushGrammar(strm, qnameID, elemGrammar));
 			}
 			else
 			{
 				return EXIP_INCONSISTENT_PROC_STATE;  // The event require the presence of Element Grammar previously created
 			}
 
-			if(handler->startElement != NULL)  // Invoke handler method passing the element qname
+			if(handler == NULL)
+				TRY(sinkQName(app_data, EXI_EVENT_START_ELEMENT, qname, qnameID));
+			else if(handler->startElement != NULL)  // Invoke handler method passing the element qname
 			{
 				TRY(handler->startElement(qname, app_data));
 			}
@@ -974,28 +975,30 @@ errorCode decodeEventContent(EXIStream* strm, Production* prodHit, ContentHandle
 		case EVENT_AT_QNAME:
 		{
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">AT(qname) event\n"));
-			strm->context.currAttr = prodHit->qnameId;
-			qname.uri = &strm->schema->uriTable.uri[strm->context.currAttr.uriId].uriStr;
-			qname.localName = &GET_LN_URI_QNAME(strm->schema->uriTable, prodHit->qnameId).lnStr;
+			GET_PROD_QNAME_ID(prodHit, strm->context.currAttr);
+			qname.uri = &strm->uriTable.uri[strm->context.currAttr.uriId].uriStr;
+			qname.localName = &GET_LN_URI_QNAME(strm->uriTable, strm->context.currAttr).lnStr;
 #if DEBUG_CONTENT_IO == ON && EXIP_DEBUG_LEVEL == INFO
 			printString(qname.uri);
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (" : "));
 			printString(qname.localName);
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, ("\n"));
 #endif
-			TRY(decodePfxQname(strm, &qname, prodHit->qnameId.uriId));
-			if(handler->attribute != NULL)  // Invoke handler method
+			TRY(decodePfxQname(strm, &qname, strm->context.currAttr.uriId));
+			if(handler == NULL)
+				TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, strm->context.currAttr));
+			else if(handler->attribute != NULL)  // Invoke handler method
 			{
 				TRY(handler->attribute(qname, app_data));
 			}
-			TRY(decodeValueItem(strm, prodHit->typeId, handler, nonTermID_out, prodHit->qnameId, app_data));
+			TRY(decodeValueItem(strm, GET_PROD_TYPE_ID(prodHit), handler, nonTermID_out, strm->context.currAttr, app_data));
 		}
 		break;
 		case EVENT_CH:
 		{
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">CH event\n"));
 			assert(strm->context.isNilType == FALSE);
-			TRY(decodeValueItem(strm, prodHit->typeId, handler, nonTermID_out, strm->gStack->currQNameID, app_data));
+			TRY(decodeValueItem(strm, GET_PROD_TYPE_ID(prodHit), handler, nonTermID_out, strm->gStack->currQNameID, app_data));
 		}
 		break;
 		case EVENT_NS:
@@ -1013,6 +1016,12 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	EXIType exiType = VALUE_TYPE_NONE;
 
+#if COMPRESSION_USE
+	// The value is in a value channel that is decoded after the structure channel of the block
+	if(IS_VALUE_DEFERRED(strm, localQNameID))
+		return deferValueItem(strm, typeId, localQNameID);
+#endif
+
 	if(typeId != INDEX_MAX)
 		exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[typeId].content);
 	else if(localQNameID.uriId == XML_SCHEMA_INSTANCE_ID &&
@@ -1028,7 +1037,9 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			UnsignedInteger uintVal;
 			TRY(decodeUnsignedInteger(strm, &uintVal));
 
-			if(handler->intData != NULL)  // Invoke handler method
+			if(handler == NULL)
+				TRY(sinkInt(app_data, (Integer) uintVal, localQNameID));
+			else if(handler->intData != NULL)  // Invoke handler method
 			{
 				// TODO: the cast to signed int can introduce errors. Check first!
 				TRY(handler->intData((Integer) uintVal, app_data));
@@ -1039,7 +1050,9 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 		{
 			Integer sintVal;
 			TRY(decodeIntegerValue(strm, &sintVal));
-			if(handler->intData != NULL)  // Invoke handler method
+			if(handler == NULL)
+				TRY(sinkInt(app_data, sintVal, localQNameID));
+			else if(handler->intData != NULL)  // Invoke handler method
 			{
 				TRY(handler->intData(sintVal, app_data));
 			}
@@ -1072,7 +1085,9 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 				return EXIP_NOT_IMPLEMENTED_YET;
 
 			TRY(decodeNBitUnsignedInteger(strm, getBitsNumber(upLimit - base), &uintVal));
-			if(handler->intData != NULL)  // Invoke handler method
+			if(handler == NULL)
+				TRY(sinkInt(app_data, (Integer) (base + uintVal), localQNameID));
+			else if(handler->intData != NULL)  // Invoke handler method
 			{
 				TRY(handler->intData((Integer) (base + uintVal), app_data));
 			}
@@ -1083,7 +1098,13 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			Float flVal;
 			DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Float value\n"));
 			TRY(decodeFloatValue(strm, &flVal));
-			if(handler->floatData != NULL)  // Invoke handler method
+			if(handler == NULL)
+			{
+				EXIEvent* ev;
+				TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_FLOAT, localQNameID, &ev));
+				ev->data.floatVal = flVal;
+			}
+			else if(handler->floatData != NULL)  // Invoke handler method
 			{
 				TRY(handler->floatData(flVal, app_data));
 			}
@@ -1093,13 +1114,15 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 		{
 			boolean bool_val;
 			TRY(decodeBoolean(strm, &bool_val));
-			if(handler->booleanData != NULL)  // Invoke handler method
+			if(handler == NULL)
+				TRY(sinkBoolean(app_data, bool_val, localQNameID));
+			else if(handler->booleanData != NULL)  // Invoke handler method
 			{
 				TRY(handler->booleanData(bool_val, app_data));
 			}
 
 			// handle xsi:nil attribute
-			if(IS_SCHEMA(strm->gStack->grammar->props) && localQNameID.uriId == XML_SCHEMA_INSTANCE_ID && localQNameID.lnId == XML_SCHEMA_INSTANCE_NIL_ID) // Schema-enabled grammar and http://www.w3.org/2001/XMLSchema-instance:nil
+			if(localQNameID.uriId == XML_SCHEMA_INSTANCE_ID && localQNameID.lnId == XML_SCHEMA_INSTANCE_NIL_ID && IS_SCHEMA(strm->gStack->grammar->props)) // Schema-enabled grammar and http://www.w3.org/2001/XMLSchema-instance:nil
 			{
 				if(bool_val == TRUE)
 				{
@@ -1115,15 +1138,37 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			Index nbytes;
 			char *binary_val;
 			//DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Binary value\n"));
+			if(handler != NULL && handler->binaryDataChunk != NULL)
+			{
+				TRY(decodeBinaryInChunks(strm, handler, app_data));
+				break;
+			}
+
 			TRY(decodeBinary(strm, &binary_val, &nbytes));
 
-			if(handler->binaryData != NULL)  // Invoke handler method
+#if BINARY_ZERO_COPY_USE
+			if(handler == NULL)
+			{
+				// A view unless the octets are in the scratch buffer or the input buffer is refilled while decoding
+				TRY(sinkBinary(app_data, binary_val, nbytes, binary_val != strm->binaryScratch && strm->buffer.ioStrm.readWriteToStream == NULL, localQNameID));
+			}
+			else if(handler->binaryData != NULL)  // Invoke handler method
+			{
+				TRY(handler->binaryData(binary_val, nbytes, app_data));
+			}
+#else
+			if(handler == NULL)
+			{
+				TRY_CATCH(sinkBinary(app_data, binary_val, nbytes, FALSE, localQNameID), EXIP_MFREE(binary_val));
+			}
+			else if(handler->binaryData != NULL)  // Invoke handler method
 			{
 				TRY_CATCH(handler->binaryData(binary_val, nbytes, app_data), EXIP_MFREE(binary_val));
 			}
 			
 			/* Free the memory allocated by decodeBinary() */
 			EXIP_MFREE(binary_val);
+#endif
 		}
 		break;
 		case VALUE_TYPE_DECIMAL:
@@ -1169,7 +1214,13 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			}
 			/// END type validation
 
-			if(handler->decimalData != NULL)  // Invoke handler method
+			if(handler == NULL)
+			{
+				EXIEvent* ev;
+				TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_DECIMAL, localQNameID, &ev));
+				ev->data.decVal = decVal;
+			}
+			else if(handler->decimalData != NULL)  // Invoke handler method
 			{
 				TRY(handler->decimalData(decVal, app_data));
 			}
@@ -1184,7 +1235,20 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			EXIPDateTime dtVal;
 
 			TRY(decodeDateTimeValue(strm, exiType, &dtVal));
-			if(handler->dateTimeData != NULL)  // Invoke handler method
+			if(handler == NULL)
+			{
+				EventSink* sink = (EventSink*) app_data;
+				EXIPDateTime* sinkVal;
+				EXIEvent* ev;
+
+				sinkVal = (EXIPDateTime*) memManagedAllocate(sink->mem, sizeof(EXIPDateTime));
+				if(sinkVal == NULL)
+					return EXIP_MEMORY_ALLOCATION_ERROR;
+				*sinkVal = dtVal;
+				TRY(addSinkEvent(sink, EXI_EVENT_DATE_TIME, localQNameID, &ev));
+				ev->data.dtVal = sinkVal;
+			}
+			else if(handler->dateTimeData != NULL)  // Invoke handler method
 			{
 				TRY(handler->dateTimeData(dtVal, app_data));
 			}
@@ -1202,7 +1266,14 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 			if(itemTypeId >= strm->schema->simpleTypeTable.count)
 				return EXIP_UNEXPECTED_ERROR;
 
-			if(handler->listData != NULL)  // Invoke handler method
+			if(handler == NULL)
+			{
+				EXIEvent* ev;
+				TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_LIST, localQNameID, &ev));
+				ev->data.list.exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[itemTypeId].content);
+				ev->data.list.itemCount = (unsigned int) itemCount;
+			}
+			else if(handler->listData != NULL)  // Invoke handler method
 			{
 				TRY(handler->listData(GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[itemTypeId].content), (unsigned int) itemCount, app_data));
 			}
@@ -1242,6 +1313,15 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 				value = ((String*) eDefFound->values)[indx];
 				freeable = FALSE;
 			}
+			else if(handler == NULL)
+			{
+				TRY(decodeSinkStringValue(strm, localQNameID, (EventSink*) app_data, &value));
+			}
+			else if(handler->stringDataChunk != NULL)
+			{
+				TRY(decodeStringValueInChunks(strm, localQNameID, handler, app_data));
+				break;
+			}
 			else
 			{
 				TRY(decodeStringValue(strm, localQNameID, &value));
@@ -1250,7 +1330,17 @@ errorCode decodeValueItem(EXIStream* strm, Index typeId, ContentHandler* handler
 					freeable = TRUE;
 			}
 
-			if(handler->stringData != NULL)  // Invoke handler method
+			if(handler == NULL)
+			{
+				EXIEvent* ev;
+				TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_STRING, localQNameID, &ev));
+				ev->data.strVal = value;
+			}
+			else if(handler->stringDataChunk != NULL)
+			{
+				TRY(stringDataInOneChunk(handler, value, app_data));
+			}
+			else if(handler->stringData != NULL)  // Invoke handler method
 			{
 				TRY(handler->stringData(value, app_data));
 			}
@@ -1278,9 +1368,24 @@ errorCode decodeNSEvent(EXIStream* strm, ContentHandler* handler, SmallIndex* no
 	TRY(decodePfx(strm, ns_uriId, &pfxId));
 	TRY(decodeBoolean(strm, &bool));
 
-	if(handler->namespaceDeclaration != NULL)  // Invoke handler method
+	if(handler == NULL)
+	{
+		EventSink* sink = (EventSink*) app_data;
+		EXINamespace* ns;
+		EXIEvent* ev;
+
+		ns = (EXINamespace*) memManagedAllocate(sink->mem, sizeof(EXINamespace));
+		if(ns == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		ns->ns = strm->uriTable.uri[ns_uriId].uriStr;
+		ns->prefix = strm->uriTable.uri[ns_uriId].pfxTable.pfx[pfxId];
+		ns->isLocal = bool;
+		TRY(addSinkEvent(sink, EXI_EVENT_NAMESPACE, voidSinkQNameID, &ev));
+		ev->data.ns = ns;
+	}
+	else if(handler->namespaceDeclaration != NULL)  // Invoke handler method
 	{
-		TRY(handler->namespaceDeclaration(strm->schema->uriTable.uri[ns_uriId].uriStr, strm->schema->uriTable.uri[ns_uriId].pfxTable.pfx[pfxId], bool, app_data));
+		TRY(handler->namespaceDeclaration(strm->uriTable.uri[ns_uriId].uriStr, strm->uriTable.uri[ns_uriId].pfxTable.pfx[pfxId], bool, app_data));
 	}
 	return EXIP_OK;
 }
@@ -1297,35 +1402,32 @@ errorCode decodeSEWildcardEvent(EXIStream* strm, ContentHandler* handler, SmallI
 	// The content of SE event is the element qname
 	TRY(decodeQName(strm, &qname, &qnameId));
 
-	if(handler->startElement != NULL)  // Invoke handler method passing the element qname
+	if(handler == NULL)
+		TRY(sinkQName(app_data, EXI_EVENT_START_ELEMENT, qname, qnameId));
+	else if(handler->startElement != NULL)  // Invoke handler method passing the element qname
 	{
 		TRY(handler->startElement(qname, app_data));
 	}
 
 	// New element grammar is pushed on the stack
 #if EXI_PROFILE_DEFAULT
-	if(GET_LN_URI_QNAME(strm->schema->uriTable, qnameId).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+	if(GET_LN_URI_QNAME(strm->uriTable, qnameId).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 		elemGrammar = NULL;
 	else
 #endif
-	elemGrammar = GET_ELEM_GRAMMAR_QNAMEID(strm->schema, qnameId);
+	elemGrammar = GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, qnameId);
 	*nonTermID_out = GR_START_TAG_CONTENT;
 
 	if(elemGrammar != NULL)
 	{
 		// The grammar is found
-		TRY(pushGrammar(&(strm->gStack), qnameId, elemGrammar));
+		TRY(pushGrammar(strm, qnameId, elemGrammar));
 	}
 	else
 	{
 #if BUILD_IN_GRAMMARS_USE
-		Index dynArrIndx;
-		EXIGrammar newElementGrammar;
-		TRY(createBuiltInElementGrammar(&newElementGrammar, strm));
-		TRY(addDynEntry(&strm->schema->grammarTable.dynArray, &newElementGrammar, &dynArrIndx));
-
-		GET_LN_URI_QNAME(strm->schema->uriTable, qnameId).elemGrammar = dynArrIndx;
-		TRY(pushGrammar(&(strm->gStack), qnameId, &strm->schema->grammarTable.grammar[dynArrIndx]));
+		TRY(addBuiltInElementGrammar(strm, qnameId, &elemGrammar));
+		TRY(pushGrammar(strm, qnameId, elemGrammar));
 #elif EXI_PROFILE_DEFAULT
 		{
 			unsigned int prodCnt = 4;
@@ -1341,7 +1443,7 @@ errorCode decodeSEWildcardEvent(EXIStream* strm, ContentHandler* handler, SmallI
 
 			do
 			{
-				if(GET_LN_URI_QNAME(strm->schema->uriTable, qnameId).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
+				if(GET_LN_URI_QNAME(strm->uriTable, qnameId).elemGrammar == EXI_PROFILE_STUB_GRAMMAR_INDX)
 				{
 					// This grammar must be the EXI Profile stub grammar.
 					// It indicates that there is a AT(xsi:type) as a top level production
@@ -1381,28 +1483,36 @@ errorCode decodeSEWildcardEvent(EXIStream* strm, ContentHandler* handler, SmallI
 				return EXIP_INCONSISTENT_PROC_STATE;
 			}
 
-			if(handler->attribute != NULL)  // Invoke handler method for xsi:type
+			if(handler == NULL)
+				TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, attrQname, attrQnameId));
+			else if(handler->attribute != NULL)  // Invoke handler method for xsi:type
 			{
 				TRY(handler->attribute(attrQname, app_data));
 			}
 
 			TRY(decodeQName(strm, &attrQname, &attrQnameId));
 
-			if(handler->qnameData != NULL)  // Invoke handler method for the QName value of xsi:type
+			if(handler == NULL)
+			{
+				QNameID xsiTypeId = {XML_SCHEMA_INSTANCE_ID, XML_SCHEMA_INSTANCE_TYPE_ID};
+				TRY(sinkQName(app_data, EXI_EVENT_QNAME, attrQname, xsiTypeId));
+			}
+			else if(handler->qnameData != NULL)  // Invoke handler method for the QName value of xsi:type
 			{
 				TRY(handler->qnameData(attrQname, app_data));
 			}
 
-			GET_LN_URI_QNAME(strm->schema->uriTable, qnameId).elemGrammar = EXI_PROFILE_STUB_GRAMMAR_INDX;
+			TRY(ownLnTable(strm, qnameId.uriId));
+			GET_LN_URI_QNAME(strm->uriTable, qnameId).elemGrammar = EXI_PROFILE_STUB_GRAMMAR_INDX;
 
 			// Successful xsi:type switch
 			// New element grammar is pushed on the stack
-			elemGrammar = GET_TYPE_GRAMMAR_QNAMEID(strm->schema, attrQnameId);
+			elemGrammar = GET_STREAM_TYPE_GRAMMAR_QNAMEID(strm, attrQnameId);
 
 			if(elemGrammar != NULL)
 			{
 				// The grammar is found
-				TRY(pushGrammar(&(strm->gStack), qnameId, elemGrammar));
+				TRY(pushGrammar(strm, qnameId, elemGrammar));
 			}
 			else
 			{
@@ -1440,7 +1550,9 @@ errorCode decodeATWildcardEvent(EXIStream* strm, ContentHandler* handler, SmallI
 		}
 	}
 
-	if(handler->attribute != NULL)  // Invoke handler method
+	if(handler == NULL)
+		TRY(sinkQName(app_data, EXI_EVENT_ATTRIBUTE, qname, qnameId));
+	else if(handler->attribute != NULL)  // Invoke handler method
 	{
 		TRY(handler->attribute(qname, app_data));
 	}
@@ -1461,24 +1573,172 @@ static errorCode decodeQNameValue(EXIStream* strm, ContentHandler* handler, Smal
 
 	TRY(decodeQName(strm, &qname, &qnameId));
 
-	if(handler->qnameData != NULL)  // Invoke handler method
+	if(handler == NULL)
+	{
+		// The value of xsi:type
+		QNameID xsiTypeId = {XML_SCHEMA_INSTANCE_ID, XML_SCHEMA_INSTANCE_TYPE_ID};
+		TRY(sinkQName(app_data, EXI_EVENT_QNAME, qname, xsiTypeId));
+	}
+	else if(handler->qnameData != NULL)  // Invoke handler method
 	{
 		TRY(handler->qnameData(qname, app_data));
 	}
 
 	// New type grammar is pushed on the stack if it exists
-	newGrammar = GET_TYPE_GRAMMAR_QNAMEID(strm->schema, qnameId);
+	newGrammar = GET_STREAM_TYPE_GRAMMAR_QNAMEID(strm, qnameId);
 
 	if(newGrammar != NULL)
 	{
 		// The grammar is found
 		// preserve the currQNameID
 		QNameID currQNameID = strm->gStack->currQNameID;
-		popGrammar(&(strm->gStack));
+		popGrammar(strm);
 
 		*nonTermID_out = GR_START_TAG_CONTENT;
-		TRY(pushGrammar(&(strm->gStack), currQNameID, newGrammar));
+		TRY(pushGrammar(strm, currQNameID, newGrammar));
 	}
 
 	return EXIP_OK;
 }
+
+errorCode addSinkEvent(EventSink* sink, unsigned char kind, QNameID qnameId, EXIEvent** ev)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index evIndx;
+
+	if(sink->count < sink->size)
+	{
+		*ev = &sink->event[sink->count];
+		sink->count += 1;
+	}
+	else
+	{
+		TRY(addEmptyDynEntry(&sink->pending.dynArray, (void**) ev, &evIndx));
+	}
+
+	(*ev)->kind = kind;
+	(*ev)->qnameId = qnameId;
+
+	return EXIP_OK;
+}
+
+/**
+ * Decodes a string value of an EventSink: a value in the value partitions is a view
+ * into them unless the partitions are bounded (an evicted value is freed);
+ * the others are decoded into the memory of the sink
+ */
+static errorCode decodeSinkStringValue(EXIStream* strm, QNameID qnameID, EventSink* sink, String* value)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UnsignedInteger tmpVar = 0;
+	String tableValue;
+
+	TRY(decodeUnsignedInteger(strm, &tmpVar));
+	TRY(decodeStringValueContent(strm, qnameID, tmpVar, sink->mem, value));
+
+	if(strm->header.opts.valuePartitionCapacity == INDEX_MAX || value->length == 0)
+		return EXIP_OK;
+
+	if(tmpVar < 2 || (value->length <= strm->header.opts.valueMaxLength && strm->header.opts.valuePartitionCapacity > 0))
+	{
+		tableValue = *value;
+		TRY(cloneStringManaged(&tableValue, value, sink->mem));
+	}
+
+	return EXIP_OK;
+}
+
+static errorCode sinkEvent(void* app_data, unsigned char kind, QNameID qnameId)
+{
+	EXIEvent* ev;
+	return addSinkEvent((EventSink*) app_data, kind, qnameId, &ev);
+}
+
+/**
+ * The strings of a QName are in the string tables: an element or attribute keeps only
+ * its prefix, the names are given by qnameId. The value of xsi:type is stored in the
+ * memory of the sink
+ */
+static errorCode sinkQName(void* app_data, unsigned char kind, QName qname, QNameID qnameId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventSink* sink = (EventSink*) app_data;
+	EXIQNameValue* value;
+	EXIEvent* ev;
+
+	TRY(addSinkEvent(sink, kind, qnameId, &ev));
+
+	if(kind != EXI_EVENT_QNAME)
+	{
+		ev->data.prefix.str = NULL;
+		ev->data.prefix.length = 0;
+		if(qname.prefix != NULL)
+			ev->data.prefix = *qname.prefix;
+		return EXIP_OK;
+	}
+
+	value = (EXIQNameValue*) memManagedAllocate(sink->mem, sizeof(EXIQNameValue));
+	if(value == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	value->uri = *qname.uri;
+	value->localName = *qname.localName;
+	value->hasPrefix = qname.prefix != NULL;
+	if(qname.prefix != NULL)
+		value->prefix = *qname.prefix;
+	else
+		getEmptyString(&value->prefix);
+	ev->data.qname = value;
+
+	return EXIP_OK;
+}
+
+static errorCode sinkInt(void* app_data, Integer int_val, QNameID qnameId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIEvent* ev;
+
+	TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_INT, qnameId, &ev));
+	ev->data.intVal = int_val;
+
+	return EXIP_OK;
+}
+
+static errorCode sinkBoolean(void* app_data, boolean bool_val, QNameID qnameId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIEvent* ev;
+
+	TRY(addSinkEvent((EventSink*) app_data, EXI_EVENT_BOOLEAN, qnameId, &ev));
+	ev->data.boolVal = bool_val;
+
+	return EXIP_OK;
+}
+
+/**
+ * @param[in] view TRUE when binary_val stays unchanged until the next call of parseNextBatch()
+ * or pushEXIData(); otherwise the octets are copied into the memory of the sink
+ */
+static errorCode sinkBinary(void* app_data, char* binary_val, Index nbytes, boolean view, QNameID qnameId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EventSink* sink = (EventSink*) app_data;
+	EXIEvent* ev;
+	char* val = NULL;
+
+	TRY(addSinkEvent(sink, EXI_EVENT_BINARY, qnameId, &ev));
+
+	if(nbytes > 0 && view)
+		val = binary_val;
+	else if(nbytes > 0)
+	{
+		val = memManagedAllocate(sink->mem, nbytes);
+		if(val == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		memcpy(val, binary_val, nbytes);
+	}
+
+	ev->data.binary.val = val;
+	ev->data.binary.nbytes = nbytes;
+
+	return EXIP_OK;
+}
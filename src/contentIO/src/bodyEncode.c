@@ -23,19 +23,41 @@
 #include "grammars.h"
 #include "memManagement.h"
 #include "dynamicArray.h"
-
-extern const String XML_SCHEMA_INSTANCE;
+#include "bodyChannels.h"
 
 /**
  * @brief Encodes second or third level production based on a state machine  */
 static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventClass, GrammarRule* currentRule,
-										QName* qname, EventCode ec, Production* prodHit);
+										QNameID qnameID, EventCode ec, Production* prodHit);
+
+/**
+ * @brief Sets the second level part of an event code from a layout of strm->eventCodes
+ * @return EXIP_INCONSISTENT_PROC_STATE if the event (state) has no production in the layout */
+static errorCode setLayoutCode(const EventCodeLayout* layout, unsigned int state, EventCode* ec);
+
+/**
+ * @brief Resolves a qname to its QNameID in the string tables of the stream. A URI or a local name
+ * that is not in the tables gets the ID it would have once added, so it matches no QName production */
+static void resolveQNameID(EXIStream* strm, QName* qname, QNameID* qnameID);
+
+/**
+ * @brief Finds the first-level production of an event class with the smallest event code in a grammar rule.
+ * For the AT and SE events the production must match the qname: a production with that qname,
+ * a uri:* production or a * production
+ * @return the first part of the event code; prodCount if there is no such production */
+static Index findProduction(GrammarRule* rule, Index prodCount, EventTypeClass eventClass, QNameID qnameID);
 
 errorCode encodeStringData(EXIStream* strm, String strng, QNameID qnameID, Index typeId)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	boolean flag_StringLiteralsPartition = FALSE;
 
+#if COMPRESSION_USE
+	// The string tables are updated when the block is written
+	if(IS_STRING_DEFERRED(strm))
+		return deferStringData(strm, strng, qnameID, typeId);
+#endif
+
 	/* ENUMERATION CHECK */
 	if(typeId != INDEX_MAX && HAS_TYPE_FACET(strm->schema->simpleTypeTable.sType[typeId].content,TYPE_FACET_ENUMERATION))
 	{
@@ -61,7 +83,7 @@ errorCode encodeStringData(EXIStream* strm, String strng, QNameID qnameID, Index
 	}
 #if VALUE_CROSSTABLE_USE
 	{
-		VxTable* vxTable = GET_LN_URI_QNAME(strm->schema->uriTable, qnameID).vxTable;
+		VxTable* vxTable = GET_LN_URI_QNAME(strm->uriTable, qnameID).vxTable;
 		Index vxEntryId = 0;
 		flag_StringLiteralsPartition = lookupVx(&strm->valueTable, vxTable, strng, &vxEntryId);
 		if(flag_StringLiteralsPartition && vxTable->vx[vxEntryId].globalId != INDEX_MAX) //  "local" value partition table hit; when INDEX_MAX -> compact identifier permanently unassigned
@@ -106,6 +128,19 @@ errorCode encodeStringData(EXIStream* strm, String strng, QNameID qnameID, Index
 }
 
 errorCode encodeProduction(EXIStream* strm, EventTypeClass eventClass, boolean isSchemaType, QName* qname, EXITypeClass chTypeClass, Production* prodHit)
+{
+	QNameID qnameID = {URI_MAX, LN_MAX};
+
+	if(eventClass == EVENT_AT_CLASS || eventClass == EVENT_SE_CLASS)
+	{
+		assert(qname);
+		resolveQNameID(strm, qname, &qnameID);
+	}
+
+	return encodeProductionID(strm, eventClass, isSchemaType, qname, qnameID, chTypeClass, prodHit);
+}
+
+errorCode encodeProductionID(EXIStream* strm, EventTypeClass eventClass, boolean isSchemaType, QName* qname, QNameID qnameID, EXITypeClass chTypeClass, Production* prodHit)
 {
 	GrammarRule* currentRule;
 	EventCode ec;
@@ -170,49 +205,35 @@ errorCode encodeProduction(EXIStream* strm, EventTypeClass eventClass, boolean i
 #if DEBUG_CONTENT_IO == ON
 	{
 		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-		TRY(printGrammarRule(currNonTermID, currentRule, strm->schema));
+		TRY(printGrammarRule(currNonTermID, currentRule, strm->schema, &strm->uriTable));
 	}
 #endif
 
-	bitCount = getBitsFirstPartCode(strm, prodCount, currNonTermID);
+	if(strm->context.isNilType)
+		bitCount = getBitsFirstPartCode(strm, prodCount, currNonTermID);
+	else
+		bitCount = GET_BITS_FIRST_PART_CODE(strm, currentRule, currNonTermID);
 
 	if(isSchemaType == TRUE)
 	{
-		for(j = 0; j < prodCount; j++)
+#if PRODUCTION_INDEX_USE
+		if(strm->context.isNilType || prodCount < PRODUCTION_INDEX_THRESHOLD ||
+				!findIndexedProduction(&strm->schema->prodIndex, currentRule, eventClass, qnameID, &j))
+#endif
+			j = findProduction(currentRule, prodCount, eventClass, qnameID);
+
+		if(j < prodCount)
 		{
 			tmpProd = &currentRule->production[currentRule->pCount - 1 - j];
+			matchFound = TRUE;
 
-			if(GET_EVENT_CLASS(GET_PROD_EXI_EVENT(tmpProd->content)) == eventClass)
+			if(eventClass == EVENT_CH_CLASS && GET_PROD_TYPE_ID(tmpProd) != INDEX_MAX)
 			{
-				if(eventClass == EVENT_AT_CLASS || eventClass == EVENT_SE_CLASS)
-				{
-					assert(qname);
-					if(tmpProd->qnameId.uriId == URI_MAX || (stringEqual(strm->schema->uriTable.uri[tmpProd->qnameId.uriId].uriStr, *(qname->uri)) &&
-					   (tmpProd->qnameId.lnId == LN_MAX || stringEqual(GET_LN_URI_QNAME(strm->schema->uriTable, tmpProd->qnameId).lnStr, *(qname->localName)))))
-					{
-						matchFound = TRUE;
-						break;
-					}
-				}
-				else if(eventClass == EVENT_CH_CLASS)
-				{
-					EXIType exiType;
-					if(tmpProd->typeId != INDEX_MAX)
-						exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[tmpProd->typeId].content);
-					else
-						exiType = VALUE_TYPE_NONE;
-
-					if(exiType == VALUE_TYPE_NONE || exiType == VALUE_TYPE_UNTYPED)
-						matchFound = TRUE;
-					else if(chTypeClass == GET_VALUE_TYPE_CLASS(exiType))
-						matchFound = TRUE;
-					break;
-				}
-				else
-				{
-					matchFound = TRUE;
-					break;
-				}
+				// Only the first CH production is considered and its value type must match
+				EXIType exiType = GET_EXI_TYPE(strm->schema->simpleTypeTable.sType[GET_PROD_TYPE_ID(tmpProd)].content);
+
+				if(exiType != VALUE_TYPE_NONE && exiType != VALUE_TYPE_UNTYPED && chTypeClass != GET_VALUE_TYPE_CLASS(exiType))
+					matchFound = FALSE;
 			}
 		}
 	}
@@ -237,45 +258,79 @@ errorCode encodeProduction(EXIStream* strm, EventTypeClass eventClass, boolean i
 		ec.part[0] = prodCount;
 		ec.bits[0] = bitCount;
 
-		return stateMachineProdEncode(strm, eventClass, currentRule, qname, ec, prodHit);
+		return stateMachineProdEncode(strm, eventClass, currentRule, qnameID, ec, prodHit);
 	}
 }
 
+static void resolveQNameID(EXIStream* strm, QName* qname, QNameID* qnameID)
+{
+	if(!lookupUri(&strm->uriTable, *qname->uri, &qnameID->uriId))
+	{
+		qnameID->uriId = strm->uriTable.count;
+		qnameID->lnId = 0;
+	}
+	else if(!lookupLn(&strm->uriTable.uri[qnameID->uriId].lnTable, *qname->localName, &qnameID->lnId))
+	{
+		qnameID->lnId = strm->uriTable.uri[qnameID->uriId].lnTable.count;
+	}
+}
+
+static Index findProduction(GrammarRule* rule, Index prodCount, EventTypeClass eventClass, QNameID qnameID)
+{
+	Production* tmpProd;
+	Index j;
+
+	for(j = 0; j < prodCount; j++)
+	{
+		tmpProd = &rule->production[rule->pCount - 1 - j];
+
+		if(GET_EVENT_CLASS(GET_PROD_EXI_EVENT(tmpProd->content)) != eventClass)
+			continue;
+
+		if(eventClass != EVENT_AT_CLASS && eventClass != EVENT_SE_CLASS)
+			break;
+
+		if(GET_PROD_URI_ID(tmpProd) == URI_MAX || (GET_PROD_URI_ID(tmpProd) == qnameID.uriId &&
+			(GET_PROD_LN_ID(tmpProd) == LN_MAX || GET_PROD_LN_ID(tmpProd) == qnameID.lnId)))
+			break;
+	}
+
+	return j;
+}
+
+static errorCode setLayoutCode(const EventCodeLayout* layout, unsigned int state, EventCode* ec)
+{
+	if(layout->code[state] == EVENT_CODE_NONE)
+		return EXIP_INCONSISTENT_PROC_STATE;
+
+	ec->length = 2;
+	ec->part[1] = layout->code[state];
+	ec->bits[1] = layout->bits;
+
+	return EXIP_OK;
+}
+
 static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventClass,
-						GrammarRule* currentRule, QName* qname, EventCode ec, Production* prodHit)
+						GrammarRule* currentRule, QNameID qnameID, EventCode ec, Production* prodHit)
 {
-	QNameID qnameID;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 
 	if(IS_BUILT_IN_ELEM(strm->gStack->grammar->props))
 	{
 		// Built-in element grammar
 #if BUILD_IN_GRAMMARS_USE
-		errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 		QNameID voidQnameID = {SMALL_INDEX_MAX, INDEX_MAX};
-		if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-		{
-			ec.bits[1] = getBitsNumber(3 +
-									   (IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES) +
-										WITH_SELF_CONTAINED(strm->header.opts.enumOpt) +
-										IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD) +
-										(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) + IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS) != 0)));
-		}
-		else if(strm->gStack->currNonTermID == GR_ELEMENT_CONTENT)
-		{
-			ec.bits[1] = getBitsNumber(1 + IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD) +
-										(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) + IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS) != 0));
-		}
-		else
+		const EventCodeLayout* layout = &strm->eventCodes.builtIn[strm->gStack->currNonTermID != GR_START_TAG_CONTENT];
+
+		if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT && strm->gStack->currNonTermID != GR_ELEMENT_CONTENT)
 			return EXIP_INCONSISTENT_PROC_STATE;
 
 		switch(eventClass)
 		{
 			case EVENT_EE_CLASS:
-				if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT)
-					return EXIP_INCONSISTENT_PROC_STATE;
-
+				// StartTagContent only
+				TRY(setLayoutCode(layout, 0, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_EE);
-				ec.part[1] = 0;
 				strm->gStack->currNonTermID = GR_VOID_NON_TERMINAL;
 
 				// #1# COMMENT and #2# COMMENT
@@ -284,23 +339,11 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 				TRY(insertZeroProduction((DynGrammarRule*) currentRule, EVENT_EE, GR_VOID_NON_TERMINAL, &voidQnameID, 1));
 			break;
 			case EVENT_AT_CLASS:
-				if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT)
-					return EXIP_INCONSISTENT_PROC_STATE;
-
+				// StartTagContent only
+				TRY(setLayoutCode(layout, 1, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_AT_ALL);
-				ec.part[1] = 1;
 				strm->gStack->currNonTermID = GR_START_TAG_CONTENT;
 
-				if(!lookupUri(&strm->schema->uriTable, *qname->uri, &qnameID.uriId))
-				{
-					qnameID.uriId = strm->schema->uriTable.count;
-					qnameID.lnId = 0;
-				}
-				else if(!lookupLn(&strm->schema->uriTable.uri[qnameID.uriId].lnTable, *qname->localName,  &qnameID.lnId))
-				{
-					qnameID.lnId = strm->schema->uriTable.uri[qnameID.uriId].lnTable.count;
-				}
-
 				// If eventType == AT(qname) and qname == xsi:type check first if there is no
 				// such production already at top level (see http://www.w3.org/XML/EXI/exi-10-errata#Substantive20120508)
 				// If there is no -> insert one, otherwise don't insert it
@@ -316,42 +359,24 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 					TRY(insertZeroProduction((DynGrammarRule*) currentRule, EVENT_AT_QNAME, GR_START_TAG_CONTENT, &qnameID, 1));
 			break;
 			case EVENT_NS_CLASS:
-				if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT || !IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES))
-					return EXIP_INCONSISTENT_PROC_STATE;
-
+				// StartTagContent with preserved prefixes only
+				TRY(setLayoutCode(layout, 2, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_NS);
-				ec.part[1] = 2;
 				strm->gStack->currNonTermID = GR_START_TAG_CONTENT;
 			break;
 			case EVENT_SC_CLASS:
 				return EXIP_NOT_IMPLEMENTED_YET;
 			break;
 			case EVENT_SE_CLASS:
+				TRY(setLayoutCode(layout, 4, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_SE_ALL);
-				if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-					ec.part[1] = 2 + IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES) + WITH_SELF_CONTAINED(strm->header.opts.enumOpt);
-				else
-					ec.part[1] = 0;
 				strm->gStack->currNonTermID = GR_ELEMENT_CONTENT;
 
-				if(!lookupUri(&strm->schema->uriTable, *qname->uri, &qnameID.uriId))
-				{
-					qnameID.uriId = strm->schema->uriTable.count;
-					qnameID.lnId = 0;
-				}
-				else if(!lookupLn(&strm->schema->uriTable.uri[qnameID.uriId].lnTable, *qname->localName,  &qnameID.lnId))
-				{
-					qnameID.lnId = strm->schema->uriTable.uri[qnameID.uriId].lnTable.count;
-				}
-
 				TRY(insertZeroProduction((DynGrammarRule*) currentRule, EVENT_SE_QNAME, GR_ELEMENT_CONTENT, &qnameID, 1));
 			break;
 			case EVENT_CH_CLASS:
+				TRY(setLayoutCode(layout, 5, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_CH);
-				if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-					ec.part[1] = 3 + IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES) + WITH_SELF_CONTAINED(strm->header.opts.enumOpt);
-				else
-					ec.part[1] = 1;
 				strm->gStack->currNonTermID = GR_ELEMENT_CONTENT;
 
 				// #1# COMMENT and #2# COMMENT
@@ -416,51 +441,35 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 		if(WITH_STRICT(strm->header.opts.enumOpt))
 		{
 			// Strict mode
+			const EventCodeLayout* layout = &strm->eventCodes.strict[EVENT_CODE_STRICT_LAYOUT(strm->gStack->grammar->props)];
+
 			if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT ||
 					eventClass != EVENT_AT_CLASS ||
-					!stringEqual(*qname->uri, XML_SCHEMA_INSTANCE))
+					qnameID.uriId != XML_SCHEMA_INSTANCE_ID)
 				return EXIP_INCONSISTENT_PROC_STATE;
-			if(stringEqualToAscii(*qname->localName, "type"))
+			if(qnameID.lnId == XML_SCHEMA_INSTANCE_TYPE_ID)
 			{
-				if(!HAS_NAMED_SUB_TYPE_OR_UNION(strm->gStack->grammar->props))
-					return EXIP_INCONSISTENT_PROC_STATE;
-
+				// Only with named sub-types or union
+				TRY(setLayoutCode(layout, 0, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_AT_QNAME);
-				prodHit->qnameId.uriId = XML_SCHEMA_INSTANCE_ID;
-				prodHit->qnameId.lnId = XML_SCHEMA_INSTANCE_TYPE_ID;
-				ec.part[1] = 0;
-
-				if(!IS_NILLABLE(strm->gStack->grammar->props))
-					ec.bits[1] = 0;
-				else
-					ec.bits[1] = 1;
+				SET_PROD_URI_ID(prodHit, XML_SCHEMA_INSTANCE_ID);
+				SET_PROD_LN_ID(prodHit, XML_SCHEMA_INSTANCE_TYPE_ID);
 			}
-			else if(stringEqualToAscii(*qname->localName, "nil"))
+			else if(qnameID.lnId == XML_SCHEMA_INSTANCE_NIL_ID)
 			{
-				if(!IS_NILLABLE(strm->gStack->grammar->props))
-					return EXIP_INCONSISTENT_PROC_STATE;
-
+				// Only if nillable
+				TRY(setLayoutCode(layout, 1, &ec));
 				SET_PROD_EXI_EVENT(prodHit->content, EVENT_AT_QNAME);
-				prodHit->qnameId.uriId = XML_SCHEMA_INSTANCE_ID;
-				prodHit->qnameId.lnId = XML_SCHEMA_INSTANCE_NIL_ID;
-
-				if(!HAS_NAMED_SUB_TYPE_OR_UNION(strm->gStack->grammar->props))
-				{
-					ec.part[1] = 0;
-					ec.bits[1] = 0;
-				}
-				else
-				{
-					ec.part[1] = 1;
-					ec.bits[1] = 1;
-				}
+				SET_PROD_URI_ID(prodHit, XML_SCHEMA_INSTANCE_ID);
+				SET_PROD_LN_ID(prodHit, XML_SCHEMA_INSTANCE_NIL_ID);
 			}
 			else
 				return EXIP_INCONSISTENT_PROC_STATE;
 		}
 		else // Non-strict mode
 		{
-			unsigned int prod2Count = 0;
+			const EventCodeLayout* layout;
+			boolean withAT;
 			// Create a copy of the content grammar if and only if there are AT
 			// productions that point to the content grammar rule OR the content index is 0.
 			// The content2 grammar rule is only needed in case the current rule is
@@ -481,82 +490,37 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 			{
 					isContent2Grammar = TRUE;
 			}
-			prod2Count = 2; // SE(*), CH(untyped) always available
-
-			if(isContent2Grammar ||
-					strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
-			{
-				prod2Count += 2; // AT(*), AT(untyped) third level
-			}
-
-			if(!RULE_CONTAIN_EE(currentRule->meta))
-				prod2Count += 1; // EE
 
-			if(strm->gStack->currNonTermID == GR_START_TAG_CONTENT)
-			{
-				prod2Count += 2; // AT(xsi:type), AT(xsi:nil)
-
-				if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES))
-					prod2Count += 1; // NS
-				if(WITH_SELF_CONTAINED(strm->header.opts.enumOpt))
-					prod2Count += 1; // SC
-			}
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
-				prod2Count += 1; // ER
-
-			if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
-				prod2Count += 1; // CM or PI
+			withAT = isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props);
+			layout = &strm->eventCodes.schema[EVENT_CODE_SCHEMA_LAYOUT(strm->gStack->currNonTermID == GR_START_TAG_CONTENT,
+																		 withAT, RULE_CONTAIN_EE(currentRule->meta))];
 
 			switch(eventClass)
 			{
 				case EVENT_EE_CLASS:
-					assert(!RULE_CONTAIN_EE(currentRule->meta));
-
+					// Only if the rule has no first level EE
+					TRY(setLayoutCode(layout, 0, &ec));
 					SET_PROD_EXI_EVENT(prodHit->content, EVENT_EE);
-					ec.length = 2;
-					ec.part[1] = 0;
-					ec.bits[1] = getBitsNumber(prod2Count - 1);
 					strm->gStack->currNonTermID = GR_VOID_NON_TERMINAL;
 					strm->context.isNilType = FALSE;
 				break;
 				case EVENT_AT_CLASS:
-
-					if(!lookupUri(&strm->schema->uriTable, *qname->uri, &qnameID.uriId))
-					{
-						qnameID.uriId = strm->schema->uriTable.count;
-						qnameID.lnId = 0;
-					}
-					else if(!lookupLn(&strm->schema->uriTable.uri[qnameID.uriId].lnTable, *qname->localName,  &qnameID.lnId))
-					{
-						qnameID.lnId = strm->schema->uriTable.uri[qnameID.uriId].lnTable.count;
-					}
-
 					if(qnameID.uriId == XML_SCHEMA_INSTANCE_ID)
 					{
+						// AT(xsi:type) and AT(xsi:nil) in the first rule only
 						if(qnameID.lnId == XML_SCHEMA_INSTANCE_NIL_ID)
 						{
-							if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT)
-								return EXIP_INCONSISTENT_PROC_STATE;
-
+							TRY(setLayoutCode(layout, 2, &ec));
 							SET_PROD_EXI_EVENT(prodHit->content, EVENT_AT_QNAME);
-							prodHit->qnameId = qnameID;
-							ec.length = 2;
-							ec.part[1] = 1 + !RULE_CONTAIN_EE(currentRule->meta);
-							ec.bits[1] = getBitsNumber(prod2Count - 1);
-							prodHit->typeId = SIMPLE_TYPE_BOOLEAN;
+							SET_PROD_QNAME_ID(prodHit, qnameID);
+							SET_PROD_TYPE_ID(prodHit, SIMPLE_TYPE_BOOLEAN);
 						}
 						else if(qnameID.lnId == XML_SCHEMA_INSTANCE_TYPE_ID)
 						{
-							if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT)
-								return EXIP_INCONSISTENT_PROC_STATE;
-
+							TRY(setLayoutCode(layout, 1, &ec));
 							SET_PROD_EXI_EVENT(prodHit->content, EVENT_AT_QNAME);
-							prodHit->qnameId = qnameID;
-							ec.length = 2;
-							ec.part[1] = 0 + !RULE_CONTAIN_EE(currentRule->meta);
-							ec.bits[1] = getBitsNumber(prod2Count - 1);
-							prodHit->typeId = SIMPLE_TYPE_QNAME;
+							SET_PROD_QNAME_ID(prodHit, qnameID);
+							SET_PROD_TYPE_ID(prodHit, SIMPLE_TYPE_QNAME);
 						}
 						else
 							return EXIP_NOT_IMPLEMENTED_YET;
@@ -565,14 +529,9 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 						return EXIP_NOT_IMPLEMENTED_YET;
 				break;
 				case EVENT_NS_CLASS:
-					if(strm->gStack->currNonTermID != GR_START_TAG_CONTENT ||
-						!IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES))
-						return EXIP_INCONSISTENT_PROC_STATE;
-
+					// First rule with preserved prefixes only
+					TRY(setLayoutCode(layout, 5, &ec));
 					SET_PROD_EXI_EVENT(prodHit->content, EVENT_NS);
-					ec.length = 2;
-					ec.part[1] = !RULE_CONTAIN_EE(currentRule->meta) + 4;
-					ec.bits[1] = getBitsNumber(prod2Count - 1);
 					strm->gStack->currNonTermID = GR_START_TAG_CONTENT;
 				break;
 				case EVENT_SC_CLASS:
@@ -580,7 +539,8 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 				break;
 				case EVENT_SE_CLASS:
 					// SE(*) content|same_rule
-					if(isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
+					TRY(setLayoutCode(layout, 7, &ec));
+					if(withAT)
 					{
 						// currNonTermID should point to the content grammar rule
 						if(GET_CONTENT_INDEX(strm->gStack->grammar->props) == GR_START_TAG_CONTENT)
@@ -589,13 +549,11 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 							strm->gStack->currNonTermID = GET_CONTENT_INDEX(strm->gStack->grammar->props);
 					}
 					SET_PROD_EXI_EVENT(prodHit->content, EVENT_SE_ALL);
-					ec.length = 2;
-					ec.part[1] = prod2Count - 2 - (IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD) == TRUE) - (IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS));
-					ec.bits[1] = getBitsNumber(prod2Count - 1);
 				break;
 				case EVENT_CH_CLASS:
 					// CH [untyped value] content|same_rule
-					if(isContent2Grammar || strm->gStack->currNonTermID < GET_CONTENT_INDEX(strm->gStack->grammar->props))
+					TRY(setLayoutCode(layout, 8, &ec));
+					if(withAT)
 					{
 						// currNonTermID should point to the content grammar rule
 						if(GET_CONTENT_INDEX(strm->gStack->grammar->props) == GR_START_TAG_CONTENT)
@@ -604,9 +562,6 @@ static errorCode stateMachineProdEncode(EXIStream* strm, EventTypeClass eventCla
 							strm->gStack->currNonTermID = GET_CONTENT_INDEX(strm->gStack->grammar->props);
 					}
 					SET_PROD_EXI_EVENT(prodHit->content, EVENT_CH);
-					ec.length = 2;
-					ec.part[1] = prod2Count - 1 - (IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD) == TRUE) - (IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS));
-					ec.bits[1] = getBitsNumber(prod2Count - 1);
 				break;
 				case EVENT_ER_CLASS:
 					return EXIP_NOT_IMPLEMENTED_YET;
@@ -643,12 +598,28 @@ errorCode encodeQName(EXIStream* strm, QName qname, EventType eventT, QNameID* q
 	return encodePfxQName(strm, &qname, eventT, qnameID->uriId);
 }
 
+errorCode encodeQNameID(EXIStream* strm, QName* qname, EventType eventT, QNameID qnameID)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	unsigned char uriBits = getBitsNumber(strm->uriTable.count);
+	unsigned char lnBits = getBitsNumber((unsigned int)(strm->uriTable.uri[qnameID.uriId].lnTable.count - 1));
+
+	DEBUG_MSG(INFO, DEBUG_CONTENT_IO, (">Encoding QName IDs\n"));
+
+	// Both the URI and the local name are string table hits
+	TRY(encodeNBitUnsignedInteger(strm, uriBits, qnameID.uriId + 1));
+	TRY(encodeUnsignedInteger(strm, 0));
+	TRY(encodeNBitUnsignedInteger(strm, lnBits, (unsigned int) qnameID.lnId));
+
+	return encodePfxQName(strm, qname, eventT, qnameID.uriId);
+}
+
 errorCode encodeUri(EXIStream* strm, String* uri, SmallIndex* uriId)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	unsigned char uriBits = getBitsNumber(strm->schema->uriTable.count);
+	unsigned char uriBits = getBitsNumber(strm->uriTable.count);
 
-	if(lookupUri(&strm->schema->uriTable, *uri, uriId)) // uri hit
+	if(lookupUri(&strm->uriTable, *uri, uriId)) // uri hit
 	{
 		TRY(encodeNBitUnsignedInteger(strm, uriBits, *uriId + 1));
 	}
@@ -658,7 +629,7 @@ errorCode encodeUri(EXIStream* strm, String* uri, SmallIndex* uriId)
 		TRY(encodeNBitUnsignedInteger(strm, uriBits, 0));
 		TRY(encodeString(strm, uri));
 		TRY(cloneStringManaged(uri, &copiedURI, &strm->memList));
-		TRY(addUriEntry(&strm->schema->uriTable, copiedURI, uriId));
+		TRY(addUriEntry(&strm->uriTable, copiedURI, uriId));
 	}
 
 	return EXIP_OK;
@@ -668,9 +639,9 @@ errorCode encodeLn(EXIStream* strm, String* ln, QNameID* qnameID)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 
-	if(lookupLn(&strm->schema->uriTable.uri[qnameID->uriId].lnTable, *ln, &qnameID->lnId)) // local-name table hit
+	if(lookupLn(&strm->uriTable.uri[qnameID->uriId].lnTable, *ln, &qnameID->lnId)) // local-name table hit
 	{
-		unsigned char lnBits = getBitsNumber((unsigned int)(strm->schema->uriTable.uri[qnameID->uriId].lnTable.count - 1));
+		unsigned char lnBits = getBitsNumber((unsigned int)(strm->uriTable.uri[qnameID->uriId].lnTable.count - 1));
 		TRY(encodeUnsignedInteger(strm, 0));
 		TRY(encodeNBitUnsignedInteger(strm, lnBits, (unsigned int)(qnameID->lnId)));
 	}
@@ -680,14 +651,11 @@ errorCode encodeLn(EXIStream* strm, String* ln, QNameID* qnameID)
 		TRY(encodeUnsignedInteger(strm, (UnsignedInteger)(ln->length + 1)));
 		TRY(encodeStringOnly(strm,  ln));
 
-		if(strm->schema->uriTable.uri[qnameID->uriId].lnTable.ln == NULL)
-		{
-			// Create local name table for this URI entry
-			TRY(createDynArray(&strm->schema->uriTable.uri[qnameID->uriId].lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER));
-		}
+		// The local name is added to the stream's own copy of the local names of the URI
+		TRY(ownLnTable(strm, qnameID->uriId));
 
 		TRY(cloneStringManaged(ln, &copiedLN, &strm->memList));
-		TRY(addLnEntry(&strm->schema->uriTable.uri[qnameID->uriId].lnTable, copiedLN, &qnameID->lnId));
+		TRY(addLnEntry(&strm->uriTable.uri[qnameID->uriId].lnTable, copiedLN, &qnameID->lnId));
 	}
 
 	return EXIP_OK;
@@ -702,17 +670,17 @@ errorCode encodePfxQName(EXIStream* strm, QName* qname, EventType eventT, SmallI
 	if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES) == FALSE)
 		return EXIP_OK;
 
-	if(strm->schema->uriTable.uri[uriId].pfxTable.count == 0)
+	if(strm->uriTable.uri[uriId].pfxTable.count == 0)
 		return EXIP_OK;
 
-	prefixBits = getBitsNumber(strm->schema->uriTable.uri[uriId].pfxTable.count - 1);
+	prefixBits = getBitsNumber(strm->uriTable.uri[uriId].pfxTable.count - 1);
 
 	if(prefixBits > 0)
 	{
 		if(qname == NULL)
 			return EXIP_NULL_POINTER_REF;
 
-		if(lookupPfx(&strm->schema->uriTable.uri[uriId].pfxTable, *qname->prefix, &prefixID) == TRUE)
+		if(lookupPfx(&strm->uriTable.uri[uriId].pfxTable, *qname->prefix, &prefixID) == TRUE)
 		{
 			TRY(encodeNBitUnsignedInteger(strm, prefixBits, (unsigned int) prefixID));
 		}
@@ -732,9 +700,9 @@ errorCode encodePfx(EXIStream* strm, SmallIndex uriId, String* prefix)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	SmallIndex pfxId;
-	unsigned char pfxBits = getBitsNumber(strm->schema->uriTable.uri[uriId].pfxTable.count);
+	unsigned char pfxBits = getBitsNumber(strm->uriTable.uri[uriId].pfxTable.count);
 
-	if(lookupPfx(&strm->schema->uriTable.uri[uriId].pfxTable, *prefix, &pfxId)) // prefix hit
+	if(lookupPfx(&strm->uriTable.uri[uriId].pfxTable, *prefix, &pfxId)) // prefix hit
 	{
 		TRY(encodeNBitUnsignedInteger(strm, pfxBits, pfxId + 1));
 	}
@@ -744,7 +712,8 @@ errorCode encodePfx(EXIStream* strm, SmallIndex uriId, String* prefix)
 		TRY(encodeNBitUnsignedInteger(strm, pfxBits, 0));
 		TRY(encodeString(strm, prefix));
 		TRY(cloneStringManaged(prefix, &copiedPrefix, &strm->memList));
-		TRY(addPfxEntry(&strm->schema->uriTable.uri[uriId].pfxTable, copiedPrefix, &pfxId));
+		TRY(ownPfxTable(strm, uriId));
+		TRY(addPfxEntry(&strm->uriTable.uri[uriId].pfxTable, copiedPrefix, &pfxId));
 	}
 
 	return EXIP_OK;
@@ -142,7 +142,6 @@ errorCode decodeHeader(EXIStream* strm, boolean outOfBandOpts)
 
 		optionsParser.strm.context.bitPointer = strm->context.bitPointer;
 		optionsParser.strm.context.bufferIndx = strm->context.bufferIndx;
-		optionsParser.strm.gStack = NULL;
 
 		makeDefaultOpts(&optionsParser.strm.header.opts);
 		SET_STRICT(optionsParser.strm.header.opts.enumOpt);
@@ -180,16 +179,16 @@ errorCode decodeHeader(EXIStream* strm, boolean outOfBandOpts)
 		strm->buffer.bufContent = optionsParser.strm.buffer.bufContent;
 		strm->context.bitPointer = optionsParser.strm.context.bitPointer;
 		strm->context.bufferIndx = optionsParser.strm.context.bufferIndx;
+	}
 
-		if(WITH_COMPRESSION(strm->header.opts.enumOpt) ||
-			GET_ALIGNMENT(strm->header.opts.enumOpt) != BIT_PACKED)
+	if(WITH_COMPRESSION(strm->header.opts.enumOpt) ||
+		GET_ALIGNMENT(strm->header.opts.enumOpt) != BIT_PACKED)
+	{
+		// Padding bits
+		if(strm->context.bitPointer != 0)
 		{
-			// Padding bits
-			if(strm->context.bitPointer != 0)
-			{
-				strm->context.bitPointer = 0;
-				strm->context.bufferIndx += 1;
-			}
+			strm->context.bitPointer = 0;
+			strm->context.bufferIndx += 1;
 		}
 	}
 
@@ -25,6 +25,7 @@
 #include "bodyEncode.h"
 #include "ioUtil.h"
 #include "streamEncode.h"
+#include "bodyChannels.h"
 
 /** This is the statically generated EXIP schema definition for the EXI Options document*/
 extern const EXIPSchema ops_schema;
@@ -83,40 +84,59 @@ errorCode encodeHeader(EXIStream* strm)
 		options_strm.context.expectATData = FALSE;
 		options_strm.context.isNilType = FALSE;
 		options_strm.context.attrTypeId = 0;
-		options_strm.gStack = NULL;
+		initGrammarStack(&options_strm);
 		options_strm.schema = (EXIPSchema*) &ops_schema;
+		options_strm.uriTable.uri = NULL;
+		options_strm.uriTable.count = 0;
+#if BUILD_IN_GRAMMARS_USE
+		options_strm.builtInGrammars.grammar = NULL;
+		options_strm.builtInGrammars.count = 0;
+#endif
+#if BINARY_ZERO_COPY_USE
+		options_strm.binaryScratch = NULL;
+		options_strm.binaryScratchSize = 0;
+#endif
+#if COMPRESSION_USE
+		options_strm.channels = NULL;
+#endif
 
 		TRY_CATCH(createValueTable(&options_strm.valueTable), closeOptionsStream(&options_strm));
-		TRY_CATCH(pushGrammar(&options_strm.gStack, emptyQnameID, (EXIGrammar*) &ops_schema.docGrammar), closeOptionsStream(&options_strm));
-		TRY_CATCH(serializeOptionsStream(&options_strm, &strm->header.opts, &strm->schema->uriTable), closeOptionsStream(&options_strm));
+		TRY_CATCH(createStreamUriTable(&options_strm), closeOptionsStream(&options_strm));
+		setEventCodeTables(&options_strm);
+		TRY_CATCH(pushGrammar(&options_strm, emptyQnameID, (EXIGrammar*) &ops_schema.docGrammar), closeOptionsStream(&options_strm));
+		TRY_CATCH(serializeOptionsStream(&options_strm, &strm->header.opts, &strm->uriTable), closeOptionsStream(&options_strm));
 
 		strm->buffer.bufContent = options_strm.buffer.bufContent;
 		strm->context.bitPointer = options_strm.context.bitPointer;
 		strm->context.bufferIndx = options_strm.context.bufferIndx;
 
-		if(WITH_COMPRESSION(strm->header.opts.enumOpt) ||
-				GET_ALIGNMENT(strm->header.opts.enumOpt) != BIT_PACKED)
+		closeOptionsStream(&options_strm);
+	}
+
+	if(WITH_COMPRESSION(strm->header.opts.enumOpt) ||
+			GET_ALIGNMENT(strm->header.opts.enumOpt) != BIT_PACKED)
+	{
+		// Padding bits
+		if(strm->context.bitPointer != 0)
 		{
-			// Padding bits
-			if(strm->context.bitPointer != 0)
-			{
-				strm->context.bitPointer = 0;
-				strm->context.bufferIndx += 1;
-			}
+			strm->context.bitPointer = 0;
+			strm->context.bufferIndx += 1;
 		}
+	}
 
-		closeOptionsStream(&options_strm);
+#if COMPRESSION_USE
+	if(WITH_COMPRESSION(strm->header.opts.enumOpt) ||
+			GET_ALIGNMENT(strm->header.opts.enumOpt) == PRE_COMPRESSION)
+	{
+		TRY(initBlockChannels(strm, TRUE));
 	}
+#endif
 
 	return EXIP_OK;
 }
 
 static void closeOptionsStream(EXIStream* strm)
 {
-	while(strm->gStack != NULL)
-	{
-		popGrammar(&strm->gStack);
-	}
 	freeAllMem(strm);
 }
 
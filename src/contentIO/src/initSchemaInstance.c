@@ -48,9 +48,18 @@ errorCode initSchema(EXIPSchema* schema, InitSchemaType initializationType)
 	schema->grammarTable.grammar = NULL;
 	schema->enumTable.count = 0;
 	schema->enumTable.enumDef = NULL;
+#if PRODUCTION_INDEX_USE
+	schema->prodIndex.slot = NULL;
+	schema->prodIndex.size = 0;
+	schema->prodIndex.count = 0;
+	schema->prodIndex.ruleBase = NULL;
+#endif
 
 	/* Create and initialize initial string table entries */
 	TRY_CATCH(createDynArray(&schema->uriTable.dynArray, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER), freeAllocList(&schema->memList));
+#if STRING_TABLE_INDEX_USE
+	schema->uriTable.index = NULL;
+#endif
 	TRY_CATCH(createUriTableEntries(&schema->uriTable, initializationType != INIT_SCHEMA_SCHEMA_LESS_MODE), freeAllocList(&schema->memList));
 
 	if(initializationType == INIT_SCHEMA_SCHEMA_ENABLED)
@@ -114,27 +123,27 @@ errorCode generateBuiltInTypesGrammars(EXIPSchema* schema)
 
 			SET_PROD_EXI_EVENT(grammar.rule[0].production[3].content, EVENT_AT_ALL);
 			SET_PROD_NON_TERM(grammar.rule[0].production[3].content, 0);
-			grammar.rule[0].production[3].typeId = INDEX_MAX;
-			grammar.rule[0].production[3].qnameId.uriId = URI_MAX;
-			grammar.rule[0].production[3].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[0].production[3], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[0].production[3], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[0].production[3], LN_MAX);
 
 			SET_PROD_EXI_EVENT(grammar.rule[0].production[2].content, EVENT_SE_ALL);
 			SET_PROD_NON_TERM(grammar.rule[0].production[2].content, 1);
-			grammar.rule[0].production[2].typeId = INDEX_MAX;
-			grammar.rule[0].production[2].qnameId.uriId = URI_MAX;
-			grammar.rule[0].production[2].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[0].production[2], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[0].production[2], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[0].production[2], LN_MAX);
 
 			SET_PROD_EXI_EVENT(grammar.rule[0].production[1].content, EVENT_EE);
 			SET_PROD_NON_TERM(grammar.rule[0].production[1].content, GR_VOID_NON_TERMINAL);
-			grammar.rule[0].production[1].typeId = INDEX_MAX;
-			grammar.rule[0].production[1].qnameId.uriId = URI_MAX;
-			grammar.rule[0].production[1].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[0].production[1], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[0].production[1], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[0].production[1], LN_MAX);
 
 			SET_PROD_EXI_EVENT(grammar.rule[0].production[0].content, EVENT_CH);
 			SET_PROD_NON_TERM(grammar.rule[0].production[0].content, 1);
-			grammar.rule[0].production[0].typeId = INDEX_MAX;
-			grammar.rule[0].production[0].qnameId.uriId = URI_MAX;
-			grammar.rule[0].production[0].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[0].production[0], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[0].production[0], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[0].production[0], LN_MAX);
 
 			grammar.rule[0].pCount = 4;
 			grammar.rule[0].meta = 0;
@@ -146,21 +155,21 @@ errorCode generateBuiltInTypesGrammars(EXIPSchema* schema)
 
 			SET_PROD_EXI_EVENT(grammar.rule[1].production[2].content, EVENT_SE_ALL);
 			SET_PROD_NON_TERM(grammar.rule[1].production[2].content, 1);
-			grammar.rule[1].production[2].typeId = INDEX_MAX;
-			grammar.rule[1].production[2].qnameId.uriId = URI_MAX;
-			grammar.rule[1].production[2].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[1].production[2], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[1].production[2], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[1].production[2], LN_MAX);
 
 			SET_PROD_EXI_EVENT(grammar.rule[1].production[1].content, EVENT_EE);
 			SET_PROD_NON_TERM(grammar.rule[1].production[1].content, GR_VOID_NON_TERMINAL);
-			grammar.rule[1].production[1].typeId = INDEX_MAX;
-			grammar.rule[1].production[1].qnameId.uriId = URI_MAX;
-			grammar.rule[1].production[1].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[1].production[1], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[1].production[1], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[1].production[1], LN_MAX);
 
 			SET_PROD_EXI_EVENT(grammar.rule[1].production[0].content, EVENT_CH);
 			SET_PROD_NON_TERM(grammar.rule[1].production[0].content, 1);
-			grammar.rule[1].production[0].typeId = INDEX_MAX;
-			grammar.rule[1].production[0].qnameId.uriId = URI_MAX;
-			grammar.rule[1].production[0].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[1].production[0], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[1].production[0], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[1].production[0], LN_MAX);
 
 			grammar.rule[1].pCount = 3;
 			grammar.rule[1].meta = 0;
@@ -174,9 +183,9 @@ errorCode generateBuiltInTypesGrammars(EXIPSchema* schema)
 
 			SET_PROD_EXI_EVENT(grammar.rule[0].production[0].content, EVENT_CH);
 			SET_PROD_NON_TERM(grammar.rule[0].production[0].content, 1);
-			grammar.rule[0].production[0].typeId = typeId;
-			grammar.rule[0].production[0].qnameId.uriId = URI_MAX;
-			grammar.rule[0].production[0].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[0].production[0], typeId);
+			SET_PROD_URI_ID(&grammar.rule[0].production[0], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[0].production[0], LN_MAX);
 			grammar.rule[0].pCount = 1;
 			grammar.rule[0].meta = 0;
 
@@ -186,14 +195,17 @@ errorCode generateBuiltInTypesGrammars(EXIPSchema* schema)
 
 			SET_PROD_EXI_EVENT(grammar.rule[1].production[0].content, EVENT_EE);
 			SET_PROD_NON_TERM(grammar.rule[1].production[0].content, GR_VOID_NON_TERMINAL);
-			grammar.rule[1].production[0].typeId = INDEX_MAX;
-			grammar.rule[1].production[0].qnameId.uriId = URI_MAX;
-			grammar.rule[1].production[0].qnameId.lnId = LN_MAX;
+			SET_PROD_TYPE_ID(&grammar.rule[1].production[0], INDEX_MAX);
+			SET_PROD_URI_ID(&grammar.rule[1].production[0], URI_MAX);
+			SET_PROD_LN_ID(&grammar.rule[1].production[0], LN_MAX);
 			grammar.rule[1].pCount = 1;
 			grammar.rule[1].meta = 0;
 			RULE_SET_CONTAIN_EE(grammar.rule[1].meta);
 		}
 
+		setRuleCodeBits(&grammar.rule[0]);
+		setRuleCodeBits(&grammar.rule[1]);
+
 		/** Add the grammar to the schema grammar table */
 		addDynEntry(&schema->grammarTable.dynArray, &grammar, &dynArrId);
 		schema->uriTable.uri[3].lnTable.ln[i].typeGrammar = dynArrId;
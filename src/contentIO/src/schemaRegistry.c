@@ -0,0 +1,419 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file schemaRegistry.c
+ * @brief Implementation of the registry of the schemas identified by schemaId
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "schemaRegistry.h"
+#include "schemaImage.h"
+#include "memManagement.h"
+#include "stringManipulate.h"
+
+#if SCHEMA_REGISTRY_THREAD_USE
+# include <pthread.h>
+# define LOCK_REGISTRY(r) pthread_mutex_lock(&(r)->lock)
+# define UNLOCK_REGISTRY(r) pthread_mutex_unlock(&(r)->lock)
+#else
+# define LOCK_REGISTRY(r)
+# define UNLOCK_REGISTRY(r)
+#endif
+
+/** A registered schemaId */
+struct registryEntry
+{
+	String schemaId;
+	SchemaSource source;
+	EXIPSchema schema;
+	boolean loaded;
+	/** TRUE while source.load runs, without the lock of the registry */
+	boolean loading;
+	/** The number of acquireSchema() not yet released */
+	unsigned int refCount;
+	/** The estimated memory of the loaded schema */
+	size_t memSize;
+	/** The next registered entry */
+	struct registryEntry* next;
+	/** The list of the loaded entries that are not in use,
+	 * from the least to the most recently released */
+	struct registryEntry* lruPrev;
+	struct registryEntry* lruNext;
+};
+
+struct schemaRegistry
+{
+	/** The entries and the schemaIds */
+	AllocList memList;
+	struct registryEntry* entries;
+	struct registryEntry* lruFirst;
+	struct registryEntry* lruLast;
+	size_t memBudget;
+	/** The memory of the loaded entries */
+	size_t memLoaded;
+	/** The memory of the loaded entries that are not in use */
+	size_t memUnused;
+#if SCHEMA_REGISTRY_THREAD_USE
+	pthread_mutex_t lock;
+	/** Signaled when a load ends */
+	pthread_cond_t loadEnd;
+#endif
+};
+
+/** The data of the SchemaSource of registerSchemaImage() */
+struct imageSource
+{
+	const void* image;
+	size_t size;
+};
+
+static errorCode loadImage(void* data, EXIPSchema* schema);
+static void unloadImage(void* data, EXIPSchema* schema);
+static void destroyImage(void* data);
+static void removeUnused(SchemaRegistry* registry, struct registryEntry* entry);
+static void trimUnused(SchemaRegistry* registry);
+static size_t schemaMemSize(const EXIPSchema* schema);
+
+errorCode createSchemaRegistry(size_t memBudget, SchemaRegistry** registry)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	SchemaRegistry* reg;
+
+	reg = (SchemaRegistry*) EXIP_MALLOC(sizeof(SchemaRegistry));
+	if(reg == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	TRY_CATCH(initAllocList(&reg->memList), EXIP_MFREE(reg));
+#if SCHEMA_REGISTRY_THREAD_USE
+	if(pthread_mutex_init(&reg->lock, NULL) != 0)
+	{
+		freeAllocList(&reg->memList);
+		EXIP_MFREE(reg);
+		return EXIP_UNEXPECTED_ERROR;
+	}
+	if(pthread_cond_init(&reg->loadEnd, NULL) != 0)
+	{
+		pthread_mutex_destroy(&reg->lock);
+		freeAllocList(&reg->memList);
+		EXIP_MFREE(reg);
+		return EXIP_UNEXPECTED_ERROR;
+	}
+#endif
+	reg->entries = NULL;
+	reg->lruFirst = NULL;
+	reg->lruLast = NULL;
+	reg->memBudget = memBudget;
+	reg->memLoaded = 0;
+	reg->memUnused = 0;
+
+	*registry = reg;
+	return EXIP_OK;
+}
+
+errorCode registerSchemaSource(SchemaRegistry* registry, const String* schemaId, SchemaSource source)
+{
+	errorCode tmp_err_code = EXIP_OK;
+	struct registryEntry* entry;
+
+	LOCK_REGISTRY(registry);
+
+	if(isStringEmpty(schemaId))
+		tmp_err_code = EXIP_INVALID_EXIP_CONFIGURATION;
+
+	for(entry = registry->entries; entry != NULL && tmp_err_code == EXIP_OK; entry = entry->next)
+	{
+		if(stringEqual(entry->schemaId, *schemaId))
+		{
+			DEBUG_MSG(ERROR, DEBUG_CONTENT_IO, ("\n> The schemaId is already registered"));
+			tmp_err_code = EXIP_INVALID_EXIP_CONFIGURATION;
+		}
+	}
+
+	if(tmp_err_code == EXIP_OK)
+	{
+		entry = memManagedAllocate(&registry->memList, sizeof(struct registryEntry));
+		if(entry == NULL)
+			tmp_err_code = EXIP_MEMORY_ALLOCATION_ERROR;
+		else
+			tmp_err_code = cloneStringManaged(schemaId, &entry->schemaId, &registry->memList);
+	}
+
+	if(tmp_err_code == EXIP_OK)
+	{
+		entry->source = source;
+		entry->loaded = FALSE;
+		entry->loading = FALSE;
+		entry->refCount = 0;
+		entry->memSize = 0;
+		entry->lruPrev = NULL;
+		entry->lruNext = NULL;
+		entry->next = registry->entries;
+		registry->entries = entry;
+	}
+	else if(source.destroy != NULL)
+		source.destroy(source.data);
+
+	UNLOCK_REGISTRY(registry);
+	return tmp_err_code;
+}
+
+errorCode registerSchemaImage(SchemaRegistry* registry, const String* schemaId, const void* image, size_t size)
+{
+	SchemaSource source;
+	struct imageSource* img;
+
+	img = (struct imageSource*) EXIP_MALLOC(sizeof(struct imageSource));
+	if(img == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	img->image = image;
+	img->size = size;
+
+	source.load = loadImage;
+	source.unload = unloadImage;
+	source.destroy = destroyImage;
+	source.data = img;
+
+	return registerSchemaSource(registry, schemaId, source);
+}
+
+errorCode acquireSchema(SchemaRegistry* registry, const String* schemaId, EXIPSchema** schema)
+{
+	errorCode tmp_err_code = EXIP_OK;
+	struct registryEntry* entry;
+
+	LOCK_REGISTRY(registry);
+
+	for(entry = registry->entries; entry != NULL; entry = entry->next)
+	{
+		if(stringEqual(entry->schemaId, *schemaId))
+			break;
+	}
+
+	if(entry == NULL)
+	{
+		DEBUG_MSG(ERROR, DEBUG_CONTENT_IO, ("\n> No schema registered for the schemaId"));
+		tmp_err_code = EXIP_INVALID_EXIP_CONFIGURATION;
+	}
+	else
+	{
+#if SCHEMA_REGISTRY_THREAD_USE
+		// The schema is being loaded by another thread
+		while(entry->loading)
+			pthread_cond_wait(&registry->loadEnd, &registry->lock);
+#endif
+		if(!entry->loaded)
+		{
+			// The other schemaIds can be acquired and released during the load
+			entry->loading = TRUE;
+			UNLOCK_REGISTRY(registry);
+			tmp_err_code = entry->source.load(entry->source.data, &entry->schema);
+			LOCK_REGISTRY(registry);
+			entry->loading = FALSE;
+			if(tmp_err_code == EXIP_OK)
+			{
+				entry->loaded = TRUE;
+				entry->memSize = schemaMemSize(&entry->schema);
+				registry->memLoaded += entry->memSize;
+			}
+#if SCHEMA_REGISTRY_THREAD_USE
+			pthread_cond_broadcast(&registry->loadEnd);
+#endif
+		}
+		else if(entry->refCount == 0)
+			removeUnused(registry, entry);
+	}
+
+	if(tmp_err_code == EXIP_OK)
+	{
+		entry->refCount++;
+		*schema = &entry->schema;
+	}
+
+	UNLOCK_REGISTRY(registry);
+	return tmp_err_code;
+}
+
+void releaseSchema(SchemaRegistry* registry, EXIPSchema* schema)
+{
+	struct registryEntry* entry;
+
+	LOCK_REGISTRY(registry);
+
+	for(entry = registry->entries; entry != NULL; entry = entry->next)
+	{
+		if(&entry->schema == schema)
+			break;
+	}
+
+	if(entry != NULL && entry->refCount > 0)
+	{
+		entry->refCount--;
+		if(entry->refCount == 0)
+		{
+			// The most recently released
+			entry->lruPrev = registry->lruLast;
+			entry->lruNext = NULL;
+			if(registry->lruLast != NULL)
+				registry->lruLast->lruNext = entry;
+			else
+				registry->lruFirst = entry;
+			registry->lruLast = entry;
+			registry->memUnused += entry->memSize;
+
+			trimUnused(registry);
+		}
+	}
+
+	UNLOCK_REGISTRY(registry);
+}
+
+size_t getSchemaRegistryMemory(SchemaRegistry* registry)
+{
+	size_t memLoaded;
+
+	LOCK_REGISTRY(registry);
+	memLoaded = registry->memLoaded;
+	UNLOCK_REGISTRY(registry);
+
+	return memLoaded;
+}
+
+errorCode destroySchemaRegistry(SchemaRegistry* registry)
+{
+	struct registryEntry* entry;
+
+	LOCK_REGISTRY(registry);
+	for(entry = registry->entries; entry != NULL; entry = entry->next)
+	{
+		if(entry->refCount > 0 || entry->loading)
+		{
+			DEBUG_MSG(ERROR, DEBUG_CONTENT_IO, ("\n> Destroying a schema registry with acquired schemas"));
+			UNLOCK_REGISTRY(registry);
+			return EXIP_INVALID_EXIP_CONFIGURATION;
+		}
+	}
+	UNLOCK_REGISTRY(registry);
+
+	for(entry = registry->entries; entry != NULL; entry = entry->next)
+	{
+		if(entry->loaded)
+			entry->source.unload(entry->source.data, &entry->schema);
+		if(entry->source.destroy != NULL)
+			entry->source.destroy(entry->source.data);
+	}
+
+#if SCHEMA_REGISTRY_THREAD_USE
+	pthread_cond_destroy(&registry->loadEnd);
+	pthread_mutex_destroy(&registry->lock);
+#endif
+	freeAllocList(&registry->memList);
+	EXIP_MFREE(registry);
+
+	return EXIP_OK;
+}
+
+/**
+ * Removes an entry from the list of the loaded entries that are not in use
+ */
+static void removeUnused(SchemaRegistry* registry, struct registryEntry* entry)
+{
+	if(entry->lruPrev != NULL)
+		entry->lruPrev->lruNext = entry->lruNext;
+	else
+		registry->lruFirst = entry->lruNext;
+
+	if(entry->lruNext != NULL)
+		entry->lruNext->lruPrev = entry->lruPrev;
+	else
+		registry->lruLast = entry->lruPrev;
+
+	entry->lruPrev = NULL;
+	entry->lruNext = NULL;
+	registry->memUnused -= entry->memSize;
+}
+
+/**
+ * Unloads the least recently released schemas until the memory
+ * of the schemas not in use is within the budget
+ */
+static void trimUnused(SchemaRegistry* registry)
+{
+	struct registryEntry* entry;
+
+	while(registry->memUnused > registry->memBudget && registry->lruFirst != NULL)
+	{
+		entry = registry->lruFirst;
+		removeUnused(registry, entry);
+		entry->source.unload(entry->source.data, &entry->schema);
+		entry->loaded = FALSE;
+		registry->memLoaded -= entry->memSize;
+		entry->memSize = 0;
+	}
+}
+
+/**
+ * An estimate of the memory of the string tables, grammars,
+ * simple types and enumerations of a schema
+ */
+static size_t schemaMemSize(const EXIPSchema* schema)
+{
+	size_t size;
+	Index i, j;
+	const UriEntry* uri;
+	const EXIGrammar* grammar;
+
+	size = schema->uriTable.count*sizeof(UriEntry);
+	for(i = 0; i < schema->uriTable.count; i++)
+	{
+		uri = &schema->uriTable.uri[i];
+		size += uri->uriStr.length*sizeof(CharType);
+		size += uri->pfxTable.count*sizeof(String);
+		for(j = 0; j < uri->pfxTable.count; j++)
+			size += uri->pfxTable.pfx[j].length*sizeof(CharType);
+		size += uri->lnTable.count*sizeof(LnEntry);
+		for(j = 0; j < uri->lnTable.count; j++)
+			size += uri->lnTable.ln[j].lnStr.length*sizeof(CharType);
+	}
+
+	size += schema->grammarTable.count*sizeof(EXIGrammar);
+	for(i = 0; i < schema->grammarTable.count; i++)
+	{
+		grammar = &schema->grammarTable.grammar[i];
+		size += grammar->count*sizeof(GrammarRule);
+		for(j = 0; j < grammar->count; j++)
+			size += grammar->rule[j].pCount*sizeof(Production);
+	}
+
+	size += schema->simpleTypeTable.count*sizeof(SimpleType);
+	size += schema->enumTable.count*sizeof(EnumDefinition);
+	for(i = 0; i < schema->enumTable.count; i++)
+		size += schema->enumTable.enumDef[i].count*sizeof(String);
+
+	return size;
+}
+
+static errorCode loadImage(void* data, EXIPSchema* schema)
+{
+	struct imageSource* img = (struct imageSource*) data;
+
+	return loadSchemaImage(img->image, img->size, schema);
+}
+
+static void unloadImage(void* data, EXIPSchema* schema)
+{
+	unloadSchemaImage(schema);
+}
+
+static void destroyImage(void* data)
+{
+	EXIP_MFREE(data);
+}
@@ -115,947 +115,947 @@ static CONST Production ops_prod_0_0[1] =
 {
     {
         838860801, 0,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_0_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_0[2] =
 {
-    {ops_prod_0_0, 1, 0},
-    {ops_prod_0_1, 1, 1}
+    {ops_prod_0_0, 1, 0, {1, 2}},
+    {ops_prod_0_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_1_0[1] =
 {
     {
         838860801, 1,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_1_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_1[2] =
 {
-    {ops_prod_1_0, 1, 0},
-    {ops_prod_1_1, 1, 1}
+    {ops_prod_1_0, 1, 0, {1, 2}},
+    {ops_prod_1_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_2_0[1] =
 {
     {
         838860801, 2,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_2_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_2[2] =
 {
-    {ops_prod_2_0, 1, 0},
-    {ops_prod_2_1, 1, 1}
+    {ops_prod_2_0, 1, 0, {1, 2}},
+    {ops_prod_2_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_3_0[1] =
 {
     {
         838860801, 3,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_3_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_3[2] =
 {
-    {ops_prod_3_0, 1, 0},
-    {ops_prod_3_1, 1, 1}
+    {ops_prod_3_0, 1, 0, {1, 2}},
+    {ops_prod_3_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_4_0[1] =
 {
     {
         838860801, 4,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_4_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_4[2] =
 {
-    {ops_prod_4_0, 1, 0},
-    {ops_prod_4_1, 1, 1}
+    {ops_prod_4_0, 1, 0, {1, 2}},
+    {ops_prod_4_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_5_0[1] =
 {
     {
         838860801, 5,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_5_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_5[2] =
 {
-    {ops_prod_5_0, 1, 0},
-    {ops_prod_5_1, 1, 1}
+    {ops_prod_5_0, 1, 0, {1, 2}},
+    {ops_prod_5_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_6_0[1] =
 {
     {
         838860801, 6,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_6_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_6[2] =
 {
-    {ops_prod_6_0, 1, 0},
-    {ops_prod_6_1, 1, 1}
+    {ops_prod_6_0, 1, 0, {1, 2}},
+    {ops_prod_6_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_7_0[1] =
 {
     {
         838860801, 7,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_7_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_7[2] =
 {
-    {ops_prod_7_0, 1, 0},
-    {ops_prod_7_1, 1, 1}
+    {ops_prod_7_0, 1, 0, {1, 2}},
+    {ops_prod_7_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_8_0[1] =
 {
     {
         838860801, 8,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_8_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_8[2] =
 {
-    {ops_prod_8_0, 1, 0},
-    {ops_prod_8_1, 1, 1}
+    {ops_prod_8_0, 1, 0, {1, 2}},
+    {ops_prod_8_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_9_0[1] =
 {
     {
         838860801, 9,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_9_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_9[2] =
 {
-    {ops_prod_9_0, 1, 0},
-    {ops_prod_9_1, 1, 1}
+    {ops_prod_9_0, 1, 0, {1, 2}},
+    {ops_prod_9_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_10_0[1] =
 {
     {
         838860801, 10,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_10_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_10[2] =
 {
-    {ops_prod_10_0, 1, 0},
-    {ops_prod_10_1, 1, 1}
+    {ops_prod_10_0, 1, 0, {1, 2}},
+    {ops_prod_10_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_11_0[1] =
 {
     {
         838860801, 11,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_11_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_11[2] =
 {
-    {ops_prod_11_0, 1, 0},
-    {ops_prod_11_1, 1, 1}
+    {ops_prod_11_0, 1, 0, {1, 2}},
+    {ops_prod_11_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_12_0[4] =
 {
     {
-        838860801, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860801, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_12_1[3] =
 {
     {
-        838860801, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860801, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_12[2] =
 {
-    {ops_prod_12_0, 4, 1},
-    {ops_prod_12_1, 3, 1}
+    {ops_prod_12_0, 4, 1, {3, 4}},
+    {ops_prod_12_1, 3, 1, {3, 3}}
 };
 
 static CONST Production ops_prod_13_0[1] =
 {
     {
         838860801, 13,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_13_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_13[2] =
 {
-    {ops_prod_13_0, 1, 0},
-    {ops_prod_13_1, 1, 1}
+    {ops_prod_13_0, 1, 0, {1, 2}},
+    {ops_prod_13_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_14_0[1] =
 {
     {
         838860801, 14,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_14_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_14[2] =
 {
-    {ops_prod_14_0, 1, 0},
-    {ops_prod_14_1, 1, 1}
+    {ops_prod_14_0, 1, 0, {1, 2}},
+    {ops_prod_14_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_15_0[1] =
 {
     {
         838860801, 15,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_15_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_15[2] =
 {
-    {ops_prod_15_0, 1, 0},
-    {ops_prod_15_1, 1, 1}
+    {ops_prod_15_0, 1, 0, {1, 2}},
+    {ops_prod_15_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_16_0[1] =
 {
     {
         838860801, 16,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_16_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_16[2] =
 {
-    {ops_prod_16_0, 1, 0},
-    {ops_prod_16_1, 1, 1}
+    {ops_prod_16_0, 1, 0, {1, 2}},
+    {ops_prod_16_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_17_0[1] =
 {
     {
         838860801, 17,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_17_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_17[2] =
 {
-    {ops_prod_17_0, 1, 0},
-    {ops_prod_17_1, 1, 1}
+    {ops_prod_17_0, 1, 0, {1, 2}},
+    {ops_prod_17_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_18_0[1] =
 {
     {
         838860801, 18,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_18_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_18[2] =
 {
-    {ops_prod_18_0, 1, 0},
-    {ops_prod_18_1, 1, 1}
+    {ops_prod_18_0, 1, 0, {1, 2}},
+    {ops_prod_18_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_19_0[1] =
 {
     {
         838860801, 19,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_19_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_19[2] =
 {
-    {ops_prod_19_0, 1, 0},
-    {ops_prod_19_1, 1, 1}
+    {ops_prod_19_0, 1, 0, {1, 2}},
+    {ops_prod_19_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_20_0[1] =
 {
     {
         838860801, 20,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_20_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_20[2] =
 {
-    {ops_prod_20_0, 1, 0},
-    {ops_prod_20_1, 1, 1}
+    {ops_prod_20_0, 1, 0, {1, 2}},
+    {ops_prod_20_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_21_0[1] =
 {
     {
         838860801, 21,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_21_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_21[2] =
 {
-    {ops_prod_21_0, 1, 0},
-    {ops_prod_21_1, 1, 1}
+    {ops_prod_21_0, 1, 0, {1, 2}},
+    {ops_prod_21_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_22_0[1] =
 {
     {
         838860801, 22,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_22_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_22[2] =
 {
-    {ops_prod_22_0, 1, 0},
-    {ops_prod_22_1, 1, 1}
+    {ops_prod_22_0, 1, 0, {1, 2}},
+    {ops_prod_22_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_23_0[1] =
 {
     {
         838860801, 23,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_23_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_23[2] =
 {
-    {ops_prod_23_0, 1, 0},
-    {ops_prod_23_1, 1, 1}
+    {ops_prod_23_0, 1, 0, {1, 2}},
+    {ops_prod_23_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_24_0[1] =
 {
     {
         838860801, 24,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_24_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_24[2] =
 {
-    {ops_prod_24_0, 1, 0},
-    {ops_prod_24_1, 1, 1}
+    {ops_prod_24_0, 1, 0, {1, 2}},
+    {ops_prod_24_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_25_0[1] =
 {
     {
         838860801, 25,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_25_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_25[2] =
 {
-    {ops_prod_25_0, 1, 0},
-    {ops_prod_25_1, 1, 1}
+    {ops_prod_25_0, 1, 0, {1, 2}},
+    {ops_prod_25_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_26_0[1] =
 {
     {
         838860801, 26,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_26_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_26[2] =
 {
-    {ops_prod_26_0, 1, 0},
-    {ops_prod_26_1, 1, 1}
+    {ops_prod_26_0, 1, 0, {1, 2}},
+    {ops_prod_26_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_27_0[1] =
 {
     {
         838860801, 27,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_27_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_27[2] =
 {
-    {ops_prod_27_0, 1, 0},
-    {ops_prod_27_1, 1, 1}
+    {ops_prod_27_0, 1, 0, {1, 2}},
+    {ops_prod_27_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_28_0[1] =
 {
     {
         838860801, 28,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_28_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_28[2] =
 {
-    {ops_prod_28_0, 1, 0},
-    {ops_prod_28_1, 1, 1}
+    {ops_prod_28_0, 1, 0, {1, 2}},
+    {ops_prod_28_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_29_0[1] =
 {
     {
         838860801, 29,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_29_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_29[2] =
 {
-    {ops_prod_29_0, 1, 0},
-    {ops_prod_29_1, 1, 1}
+    {ops_prod_29_0, 1, 0, {1, 2}},
+    {ops_prod_29_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_30_0[1] =
 {
     {
         838860801, 30,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_30_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_30[2] =
 {
-    {ops_prod_30_0, 1, 0},
-    {ops_prod_30_1, 1, 1}
+    {ops_prod_30_0, 1, 0, {1, 2}},
+    {ops_prod_30_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_31_0[1] =
 {
     {
         838860801, 31,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_31_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_31[2] =
 {
-    {ops_prod_31_0, 1, 0},
-    {ops_prod_31_1, 1, 1}
+    {ops_prod_31_0, 1, 0, {1, 2}},
+    {ops_prod_31_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_32_0[1] =
 {
     {
         838860801, 32,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_32_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_32[2] =
 {
-    {ops_prod_32_0, 1, 0},
-    {ops_prod_32_1, 1, 1}
+    {ops_prod_32_0, 1, 0, {1, 2}},
+    {ops_prod_32_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_33_0[1] =
 {
     {
         838860801, 33,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_33_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_33[2] =
 {
-    {ops_prod_33_0, 1, 0},
-    {ops_prod_33_1, 1, 1}
+    {ops_prod_33_0, 1, 0, {1, 2}},
+    {ops_prod_33_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_34_0[1] =
 {
     {
         838860801, 34,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_34_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_34[2] =
 {
-    {ops_prod_34_0, 1, 0},
-    {ops_prod_34_1, 1, 1}
+    {ops_prod_34_0, 1, 0, {1, 2}},
+    {ops_prod_34_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_35_0[1] =
 {
     {
         838860801, 35,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_35_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_35[2] =
 {
-    {ops_prod_35_0, 1, 0},
-    {ops_prod_35_1, 1, 1}
+    {ops_prod_35_0, 1, 0, {1, 2}},
+    {ops_prod_35_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_36_0[1] =
 {
     {
         838860801, 36,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_36_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_36[2] =
 {
-    {ops_prod_36_0, 1, 0},
-    {ops_prod_36_1, 1, 1}
+    {ops_prod_36_0, 1, 0, {1, 2}},
+    {ops_prod_36_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_37_0[1] =
 {
     {
         838860801, 37,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_37_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_37[2] =
 {
-    {ops_prod_37_0, 1, 0},
-    {ops_prod_37_1, 1, 1}
+    {ops_prod_37_0, 1, 0, {1, 2}},
+    {ops_prod_37_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_38_0[1] =
 {
     {
         838860801, 38,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_38_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_38[2] =
 {
-    {ops_prod_38_0, 1, 0},
-    {ops_prod_38_1, 1, 1}
+    {ops_prod_38_0, 1, 0, {1, 2}},
+    {ops_prod_38_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_39_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_39_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_39[2] =
 {
-    {ops_prod_39_0, 1, 0},
-    {ops_prod_39_1, 1, 1}
+    {ops_prod_39_0, 1, 0, {1, 2}},
+    {ops_prod_39_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_40_0[1] =
 {
     {
         838860801, 40,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_40_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_40[2] =
 {
-    {ops_prod_40_0, 1, 0},
-    {ops_prod_40_1, 1, 1}
+    {ops_prod_40_0, 1, 0, {1, 2}},
+    {ops_prod_40_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_41_0[1] =
 {
     {
         838860801, 41,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_41_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_41[2] =
 {
-    {ops_prod_41_0, 1, 0},
-    {ops_prod_41_1, 1, 1}
+    {ops_prod_41_0, 1, 0, {1, 2}},
+    {ops_prod_41_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_42_0[1] =
 {
     {
         838860801, 42,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_42_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_42[2] =
 {
-    {ops_prod_42_0, 1, 0},
-    {ops_prod_42_1, 1, 1}
+    {ops_prod_42_0, 1, 0, {1, 2}},
+    {ops_prod_42_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_43_0[1] =
 {
     {
         838860801, 43,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_43_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_43[2] =
 {
-    {ops_prod_43_0, 1, 0},
-    {ops_prod_43_1, 1, 1}
+    {ops_prod_43_0, 1, 0, {1, 2}},
+    {ops_prod_43_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_44_0[1] =
 {
     {
         838860801, 44,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_44_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_44[2] =
 {
-    {ops_prod_44_0, 1, 0},
-    {ops_prod_44_1, 1, 1}
+    {ops_prod_44_0, 1, 0, {1, 2}},
+    {ops_prod_44_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_45_0[1] =
 {
     {
         838860801, 45,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_45_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_45[2] =
 {
-    {ops_prod_45_0, 1, 0},
-    {ops_prod_45_1, 1, 1}
+    {ops_prod_45_0, 1, 0, {1, 2}},
+    {ops_prod_45_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_46_0[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_46[1] =
 {
-    {ops_prod_46_0, 1, 1}
+    {ops_prod_46_0, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_47_0[2] =
@@ -1071,100 +1071,100 @@ static CONST Production ops_prod_47_0[2] =
 static CONST Production ops_prod_47_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_47_2[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_47[3] =
 {
-    {ops_prod_47_0, 2, 0},
-    {ops_prod_47_1, 1, 1},
-    {ops_prod_47_2, 1, 1}
+    {ops_prod_47_0, 2, 0, {2, 3}},
+    {ops_prod_47_1, 1, 1, {1, 2}},
+    {ops_prod_47_2, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_48_0[1] =
 {
     {
         838860801, 46,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_48_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_48[2] =
 {
-    {ops_prod_48_0, 1, 0},
-    {ops_prod_48_1, 1, 1}
+    {ops_prod_48_0, 1, 0, {1, 2}},
+    {ops_prod_48_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_49_0[1] =
 {
     {
         838860801, 47,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_49_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_49[2] =
 {
-    {ops_prod_49_0, 1, 0},
-    {ops_prod_49_1, 1, 1}
+    {ops_prod_49_0, 1, 0, {1, 2}},
+    {ops_prod_49_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_50_0[1] =
 {
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_50_1[1] =
 {
     {
-        536870914, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870914, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_50_2[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_50[3] =
 {
-    {ops_prod_50_0, 1, 0},
-    {ops_prod_50_1, 1, 0},
-    {ops_prod_50_2, 1, 1}
+    {ops_prod_50_0, 1, 0, {1, 2}},
+    {ops_prod_50_1, 1, 0, {1, 2}},
+    {ops_prod_50_2, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_51_0[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}},
@@ -1185,11 +1185,11 @@ static CONST Production ops_prod_51_0[7] =
 static CONST Production ops_prod_51_1[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}},
@@ -1210,8 +1210,8 @@ static CONST Production ops_prod_51_1[7] =
 static CONST Production ops_prod_51_2[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}},
@@ -1229,8 +1229,8 @@ static CONST Production ops_prod_51_2[5] =
 static CONST Production ops_prod_51_3[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}},
@@ -1245,8 +1245,8 @@ static CONST Production ops_prod_51_3[4] =
 static CONST Production ops_prod_51_4[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}},
@@ -1258,8 +1258,8 @@ static CONST Production ops_prod_51_4[3] =
 static CONST Production ops_prod_51_5[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}}
@@ -1268,8 +1268,8 @@ static CONST Production ops_prod_51_5[2] =
 static CONST Production ops_prod_51_6[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 50,
         {4, 8}}
@@ -1277,20 +1277,20 @@ static CONST Production ops_prod_51_6[2] =
 
 static CONST GrammarRule ops_rule_51[7] =
 {
-    {ops_prod_51_0, 7, 1},
-    {ops_prod_51_1, 7, 1},
-    {ops_prod_51_2, 5, 1},
-    {ops_prod_51_3, 4, 1},
-    {ops_prod_51_4, 3, 1},
-    {ops_prod_51_5, 2, 1},
-    {ops_prod_51_6, 2, 1}
+    {ops_prod_51_0, 7, 1, {4, 4}},
+    {ops_prod_51_1, 7, 1, {4, 4}},
+    {ops_prod_51_2, 5, 1, {4, 4}},
+    {ops_prod_51_3, 4, 1, {3, 4}},
+    {ops_prod_51_4, 3, 1, {3, 3}},
+    {ops_prod_51_5, 2, 1, {2, 3}},
+    {ops_prod_51_6, 2, 1, {2, 3}}
 };
 
 static CONST Production ops_prod_52_0[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 46,
         {4, 27}},
@@ -1311,8 +1311,8 @@ static CONST Production ops_prod_52_0[6] =
 static CONST Production ops_prod_52_1[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 46,
         {4, 27}},
@@ -1330,8 +1330,8 @@ static CONST Production ops_prod_52_1[5] =
 static CONST Production ops_prod_52_2[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 46,
         {4, 27}},
@@ -1346,8 +1346,8 @@ static CONST Production ops_prod_52_2[4] =
 static CONST Production ops_prod_52_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 46,
         {4, 27}},
@@ -1359,8 +1359,8 @@ static CONST Production ops_prod_52_3[3] =
 static CONST Production ops_prod_52_4[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 46,
         {4, 27}}
@@ -1369,45 +1369,45 @@ static CONST Production ops_prod_52_4[2] =
 static CONST Production ops_prod_52_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_52[6] =
 {
-    {ops_prod_52_0, 6, 1},
-    {ops_prod_52_1, 5, 1},
-    {ops_prod_52_2, 4, 1},
-    {ops_prod_52_3, 3, 1},
-    {ops_prod_52_4, 2, 1},
-    {ops_prod_52_5, 1, 1}
+    {ops_prod_52_0, 6, 1, {4, 4}},
+    {ops_prod_52_1, 5, 1, {4, 4}},
+    {ops_prod_52_2, 4, 1, {3, 4}},
+    {ops_prod_52_3, 3, 1, {3, 3}},
+    {ops_prod_52_4, 2, 1, {2, 3}},
+    {ops_prod_52_5, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_53_0[1] =
 {
     {
         838860801, 48,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_53_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_53[2] =
 {
-    {ops_prod_53_0, 1, 0},
-    {ops_prod_53_1, 1, 1}
+    {ops_prod_53_0, 1, 0, {1, 2}},
+    {ops_prod_53_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_54_0[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 53,
         {4, 2}},
@@ -1422,8 +1422,8 @@ static CONST Production ops_prod_54_0[4] =
 static CONST Production ops_prod_54_1[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 53,
         {4, 2}},
@@ -1435,8 +1435,8 @@ static CONST Production ops_prod_54_1[3] =
 static CONST Production ops_prod_54_2[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 53,
         {4, 2}}
@@ -1445,43 +1445,43 @@ static CONST Production ops_prod_54_2[2] =
 static CONST Production ops_prod_54_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_54[4] =
 {
-    {ops_prod_54_0, 4, 1},
-    {ops_prod_54_1, 3, 1},
-    {ops_prod_54_2, 2, 1},
-    {ops_prod_54_3, 1, 1}
+    {ops_prod_54_0, 4, 1, {3, 4}},
+    {ops_prod_54_1, 3, 1, {3, 3}},
+    {ops_prod_54_2, 2, 1, {2, 3}},
+    {ops_prod_54_3, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_55_0[1] =
 {
     {
         838860801, 49,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_55_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_55[2] =
 {
-    {ops_prod_55_0, 1, 0},
-    {ops_prod_55_1, 1, 1}
+    {ops_prod_55_0, 1, 0, {1, 2}},
+    {ops_prod_55_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_56_0[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 55,
         {4, 31}},
@@ -1496,8 +1496,8 @@ static CONST Production ops_prod_56_0[4] =
 static CONST Production ops_prod_56_1[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 55,
         {4, 31}},
@@ -1509,8 +1509,8 @@ static CONST Production ops_prod_56_1[3] =
 static CONST Production ops_prod_56_2[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 55,
         {4, 31}}
@@ -1519,23 +1519,23 @@ static CONST Production ops_prod_56_2[2] =
 static CONST Production ops_prod_56_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_56[4] =
 {
-    {ops_prod_56_0, 4, 1},
-    {ops_prod_56_1, 3, 1},
-    {ops_prod_56_2, 2, 1},
-    {ops_prod_56_3, 1, 1}
+    {ops_prod_56_0, 4, 1, {3, 4}},
+    {ops_prod_56_1, 3, 1, {3, 3}},
+    {ops_prod_56_2, 2, 1, {2, 3}},
+    {ops_prod_56_3, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_57_0[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 46,
         {4, 33}},
@@ -1550,8 +1550,8 @@ static CONST Production ops_prod_57_0[4] =
 static CONST Production ops_prod_57_1[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 46,
         {4, 33}},
@@ -1563,8 +1563,8 @@ static CONST Production ops_prod_57_1[3] =
 static CONST Production ops_prod_57_2[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 46,
         {4, 33}}
@@ -1573,356 +1573,356 @@ static CONST Production ops_prod_57_2[2] =
 static CONST Production ops_prod_57_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_57[4] =
 {
-    {ops_prod_57_0, 4, 1},
-    {ops_prod_57_1, 3, 1},
-    {ops_prod_57_2, 2, 1},
-    {ops_prod_57_3, 1, 1}
+    {ops_prod_57_0, 4, 1, {3, 4}},
+    {ops_prod_57_1, 3, 1, {3, 3}},
+    {ops_prod_57_2, 2, 1, {2, 3}},
+    {ops_prod_57_3, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_58_0[1] =
 {
     {
         838860801, 50,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_58_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_58[2] =
 {
-    {ops_prod_58_0, 1, 0},
-    {ops_prod_58_1, 1, 1}
+    {ops_prod_58_0, 1, 0, {1, 2}},
+    {ops_prod_58_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_59_0[1] =
 {
     {
         838860801, 51,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_59_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_59[2] =
 {
-    {ops_prod_59_0, 1, 0},
-    {ops_prod_59_1, 1, 1}
+    {ops_prod_59_0, 1, 0, {1, 2}},
+    {ops_prod_59_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_60_0[1] =
 {
     {
         838860801, 52,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_60_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_60[2] =
 {
-    {ops_prod_60_0, 1, 0},
-    {ops_prod_60_1, 1, 1}
+    {ops_prod_60_0, 1, 0, {1, 2}},
+    {ops_prod_60_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_61_0[1] =
 {
     {
         838860801, 53,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_61_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_61[2] =
 {
-    {ops_prod_61_0, 1, 0},
-    {ops_prod_61_1, 1, 1}
+    {ops_prod_61_0, 1, 0, {1, 2}},
+    {ops_prod_61_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_62_0[1] =
 {
     {
         838860801, 54,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_62_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_62[2] =
 {
-    {ops_prod_62_0, 1, 0},
-    {ops_prod_62_1, 1, 1}
+    {ops_prod_62_0, 1, 0, {1, 2}},
+    {ops_prod_62_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_63_0[1] =
 {
     {
         838860801, 55,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_63_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_63[2] =
 {
-    {ops_prod_63_0, 1, 0},
-    {ops_prod_63_1, 1, 1}
+    {ops_prod_63_0, 1, 0, {1, 2}},
+    {ops_prod_63_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_64_0[1] =
 {
     {
         838860801, 56,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_64_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_64[2] =
 {
-    {ops_prod_64_0, 1, 0},
-    {ops_prod_64_1, 1, 1}
+    {ops_prod_64_0, 1, 0, {1, 2}},
+    {ops_prod_64_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_65_0[1] =
 {
     {
         838860801, 57,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_65_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_65[2] =
 {
-    {ops_prod_65_0, 1, 0},
-    {ops_prod_65_1, 1, 1}
+    {ops_prod_65_0, 1, 0, {1, 2}},
+    {ops_prod_65_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_66_0[1] =
 {
     {
         838860801, 58,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_66_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_66[2] =
 {
-    {ops_prod_66_0, 1, 0},
-    {ops_prod_66_1, 1, 1}
+    {ops_prod_66_0, 1, 0, {1, 2}},
+    {ops_prod_66_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_67_0[1] =
 {
     {
         838860801, 59,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_67_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_67[2] =
 {
-    {ops_prod_67_0, 1, 0},
-    {ops_prod_67_1, 1, 1}
+    {ops_prod_67_0, 1, 0, {1, 2}},
+    {ops_prod_67_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_68_0[1] =
 {
     {
         838860801, 60,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_68_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_68[2] =
 {
-    {ops_prod_68_0, 1, 0},
-    {ops_prod_68_1, 1, 1}
+    {ops_prod_68_0, 1, 0, {1, 2}},
+    {ops_prod_68_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_69_0[1] =
 {
     {
         838860801, 61,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_69_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_69[2] =
 {
-    {ops_prod_69_0, 1, 0},
-    {ops_prod_69_1, 1, 1}
+    {ops_prod_69_0, 1, 0, {1, 2}},
+    {ops_prod_69_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_70_0[1] =
 {
     {
         838860801, 62,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_70_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_70[2] =
 {
-    {ops_prod_70_0, 1, 0},
-    {ops_prod_70_1, 1, 1}
+    {ops_prod_70_0, 1, 0, {1, 2}},
+    {ops_prod_70_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_71_0[1] =
 {
     {
         838860801, 63,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_71_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_71[2] =
 {
-    {ops_prod_71_0, 1, 0},
-    {ops_prod_71_1, 1, 1}
+    {ops_prod_71_0, 1, 0, {1, 2}},
+    {ops_prod_71_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_72_0[1] =
 {
     {
         838860801, 64,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_72_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_72[2] =
 {
-    {ops_prod_72_0, 1, 0},
-    {ops_prod_72_1, 1, 1}
+    {ops_prod_72_0, 1, 0, {1, 2}},
+    {ops_prod_72_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_73_0[1] =
 {
     {
         838860801, 65,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_73_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_73[2] =
 {
-    {ops_prod_73_0, 1, 0},
-    {ops_prod_73_1, 1, 1}
+    {ops_prod_73_0, 1, 0, {1, 2}},
+    {ops_prod_73_1, 1, 1, {1, 2}}
 };
 
 static CONST Production ops_prod_74_0[1] =
 {
     {
         838860801, 66,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production ops_prod_74_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_rule_74[2] =
 {
-    {ops_prod_74_0, 1, 0},
-    {ops_prod_74_1, 1, 1}
+    {ops_prod_74_0, 1, 0, {1, 2}},
+    {ops_prod_74_1, 1, 1, {1, 2}}
 };
 
 static CONST EXIGrammar ops_grammarTable[75] =
@@ -2704,8 +2704,8 @@ static CONST UriEntry ops_uriEntry[5] =
 static CONST Production ops_prod_doc_content[2] =
 {
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316481, 57,
         {4, 20}}
@@ -2714,14 +2714,14 @@ static CONST Production ops_prod_doc_content[2] =
 static CONST Production ops_prod_doc_end[1] =
 {
     {
-        0xAFFFFFF, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        0xAFFFFFF, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule ops_docGrammarRule[2] =
 {
-    {ops_prod_doc_content, 2, 0},
-    {ops_prod_doc_end, 1, 0}
+    {ops_prod_doc_content, 2, 0, {2, 3}},
+    {ops_prod_doc_end, 1, 0, {1, 2}}
 };
 
 static CONST SimpleType ops_simpleTypes[67] =
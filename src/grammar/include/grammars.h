@@ -38,22 +38,62 @@
  */
 #define GET_TYPE_GRAMMAR_QNAMEID(schema, qnameID) GET_LN_URI_QNAME((schema)->uriTable, qnameID).typeGrammar == INDEX_MAX?NULL:&((schema)->grammarTable.grammar[GET_LN_URI_QNAME((schema)->uriTable, qnameID).typeGrammar])
 
+#if BUILD_IN_GRAMMARS_USE
+/**
+ * Get an EXIGrammar of a stream by its index in LnEntry.elemGrammar: either a grammar
+ * of the SchemaGrammarTable of the schema or a built-in element grammar of the stream
+ */
+# define GET_STREAM_GRAMMAR(strm, grIndx) ((grIndx) < (strm)->schema->grammarTable.count?&((strm)->schema->grammarTable.grammar[grIndx]):&((strm)->builtInGrammars.grammar[(grIndx) - (strm)->schema->grammarTable.count]))
+#else
+# define GET_STREAM_GRAMMAR(strm, grIndx) (&((strm)->schema->grammarTable.grammar[grIndx]))
+#endif
+
+/**
+ * Get global element EXIGrammar of a stream by given QNameID from the string tables of the stream.
+ * Returns NULL if the grammar does not exists
+ * (i.e. the index of the grammar in the string table is INDEX_MAX)
+ */
+#define GET_STREAM_ELEM_GRAMMAR_QNAMEID(strm, qnameID) GET_LN_URI_QNAME((strm)->uriTable, qnameID).elemGrammar == INDEX_MAX?NULL:GET_STREAM_GRAMMAR(strm, GET_LN_URI_QNAME((strm)->uriTable, qnameID).elemGrammar)
+
 /**
- * @brief Push a grammar on top of the Grammar Stack
+ * Get global type EXIGrammar of a stream by given QNameID from the string tables of the stream.
+ * Returns NULL if the grammar does not exists in the SchemaGrammarTable
+ * (i.e. the index of the grammar in the string table is INDEX_MAX)
+ */
+#define GET_STREAM_TYPE_GRAMMAR_QNAMEID(strm, qnameID) GET_LN_URI_QNAME((strm)->uriTable, qnameID).typeGrammar == INDEX_MAX?NULL:&((strm)->schema->grammarTable.grammar[GET_LN_URI_QNAME((strm)->uriTable, qnameID).typeGrammar])
+
+/**
+ * @brief Push a grammar on top of the Grammar Stack of a stream
  * 
- * @param[in, out] gStack the Grammar Stack
+ * @param[in, out] strm EXI stream
  * @param[in] currQNameID the currently proccessed element QNameID that is having this grammar
  * @param[in] grammar a EXI grammar
- * @return Error handling code
+ * @return Error handling code; EXIP_OUT_OF_BOUND_BUFFER when the stack
+ * already holds GRAMMAR_STACK_MAX_DEPTH grammars
  */
-errorCode pushGrammar(EXIGrammarStack** gStack, QNameID currQNameID, EXIGrammar* grammar);
+errorCode pushGrammar(EXIStream* strm, QNameID currQNameID, EXIGrammar* grammar);
 
 /**
- * @brief Pop a grammar off the top of the Grammar Stack
+ * @brief Pop a grammar off the top of the Grammar Stack of a stream
  * 
- * @param[in, out] gStack the Grammar stack
+ * @param[in, out] strm EXI stream
  */
-void popGrammar(EXIGrammarStack** gStack);
+void popGrammar(EXIStream* strm);
+
+/**
+ * @brief Sets up an empty Grammar Stack; no memory is allocated
+ * 
+ * @param[out] strm EXI stream
+ */
+void initGrammarStack(EXIStream* strm);
+
+/**
+ * @brief Frees the memory of the Grammar Stack (when GRAMMAR_STACK_MAX_DEPTH is 0)
+ * and empties it
+ * 
+ * @param[in, out] strm EXI stream
+ */
+void destroyGrammarStack(EXIStream* strm);
 
 /**
  * @brief Creates an instance of the EXI Built-in Document Grammar or Schema-Informed Document Grammar
@@ -91,6 +131,17 @@ errorCode createFragmentGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index q
 	 */
 	errorCode createBuiltInElementGrammar(EXIGrammar* elementGrammar, EXIStream* strm);
 
+	/**
+	 * @brief Creates the EXI Built-in Element Grammar of an element qname in strm->builtInGrammars
+	 * and sets it as the global element grammar of the qname in the string tables of the stream
+	 *
+	 * @param[in, out] strm EXI stream
+	 * @param[in] qnameID the element qname
+	 * @param[out] elemGrammar the created grammar
+	 * @return Error handling code
+	 */
+	errorCode addBuiltInElementGrammar(EXIStream* strm, QNameID qnameID, EXIGrammar** elemGrammar);
+
 	/**
 	 * @brief Inserts a Production to a Grammar Rule (with LeftHandSide) with an event code 0
 	 * Note! It increments the first part of the event code of each production
@@ -116,16 +167,121 @@ errorCode createFragmentGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index q
  */
 unsigned int getBitsFirstPartCode(EXIStream* strm, Index prodCount, SmallIndex currentRuleIndx);
 
+/**
+ * @name The flags of EXIGrammarStack.secondLevel
+ */
+/**@{*/
+#define SECOND_LEVEL_FIRST_RULE  0x01
+#define SECOND_LEVEL_OTHER_RULES 0x02
+/**@}*/
+
+/** The codeBits entry of a rule of the current grammar of the stream */
+#define GET_RULE_CODE_BITS(strm, rule, ruleIndx) ((rule)->codeBits[((strm)->gStack->secondLevel >> ((ruleIndx) != 0)) & 1])
+
+/**
+ * getBitsFirstPartCode() for a rule of the current grammar of the stream read from
+ * the rule; computed only for the rules without codeBits.
+ * Not valid when strm->context.isNilType is TRUE (the number of productions differs)
+ */
+#define GET_BITS_FIRST_PART_CODE(strm, rule, ruleIndx) (GET_RULE_CODE_BITS(strm, rule, ruleIndx) != 0 ? \
+		(unsigned int) GET_RULE_CODE_BITS(strm, rule, ruleIndx) - 1 : getBitsFirstPartCode(strm, (rule)->pCount, ruleIndx))
+
+/**
+ * @brief Sets the number of bits of the first part of the event codes of a rule of a document,
+ * fragment or schema-informed grammar from its number of productions (GrammarRule.codeBits).
+ * Whether the rule has second level productions depends on the options of the
+ * stream and is kept for the grammar in the grammar stack (EXIGrammarStack.secondLevel).
+ * @param[in, out] rule the grammar rule
+ */
+void setRuleCodeBits(GrammarRule* rule);
+
+/**
+ * @brief Sets the codeBits of the rules of the document grammar and of the
+ * grammars in the grammar table of a schema. Invoked once the grammars are complete
+ * @param[in, out] schema the schema
+ */
+void setSchemaCodeBits(EXIPSchema* schema);
+
+/**
+ * The events of the EventCodeLayout entries of EventCodeTables:
+ * <ul>
+ *   <li> builtIn: 0 EE, 1 AT(*), 2 NS, 3 SC, 4 SE(*), 5 CH, 6 ER, 7 CM or PI </li>
+ *   <li> schema: 0 EE, 1 AT(xsi:type), 2 AT(xsi:nil), 3 AT(*), 4 AT [untyped value] (third level),
+ *        5 NS, 6 SC, 7 SE(*), 8 CH [untyped value], 9 ER, 10 CM or PI </li>
+ *   <li> strict: 0 AT(xsi:type), 1 AT(xsi:nil) </li>
+ *   <li> document: 0 DT, 1 CM, 2 PI, 3 CM or PI (third level in document[1]) </li>
+ * </ul>
+ */
+
+/**
+ * The schema layout of a rule in non-strict mode: whether the rule is the first rule,
+ * whether it has the AT(*) productions (the rules before the content and the content2 rule)
+ * and whether it has an EE production at the first level
+ */
+#define EVENT_CODE_SCHEMA_LAYOUT(firstRule, withAT, containEE) ((((firstRule) != 0) << 2) | (((withAT) != 0) << 1) | ((containEE) == 0))
+
+/** The strict layout of the first rule of a schema-informed grammar with the properties props */
+#define EVENT_CODE_STRICT_LAYOUT(props) ((HAS_NAMED_SUB_TYPE_OR_UNION(props) << 1) | IS_NILLABLE(props))
+
+/**
+ * @brief Sets the layouts of the second and third level productions (strm->eventCodes)
+ * from the options of the stream. Invoked once the header is processed,
+ * before the document grammar is pushed.
+ * @param[in, out] strm EXI stream
+ */
+void setEventCodeTables(EXIStream* strm);
+
+#if PRODUCTION_INDEX_USE
+/**
+ * @brief Builds the production index of a schema (schema->prodIndex) from its schema-informed grammars.
+ * The AT and SE productions of a rule with at least PRODUCTION_INDEX_THRESHOLD productions are indexed
+ * by their qname (uri:* and * productions included), the other productions by their event class only.
+ * The index is allocated in schema->memList. Invoked once the grammars of the schema are complete.
+ *
+ * @param[in, out] schema the schema
+ * @return Error handling code
+ */
+errorCode createProductionIndex(EXIPSchema* schema);
+
+/**
+ * @brief Builds a production index of the rules of an array, keyed by their position in the array
+ * (index->ruleBase) instead of their address: the index stays valid for a copy of the rules at
+ * another address, as in schema images
+ *
+ * @param[in] rules the array of the grammar rules
+ * @param[in] ruleCount the number of rules in the array
+ * @param[in, out] memList the slots of the index are allocated in it
+ * @param[out] index the production index
+ * @return Error handling code
+ */
+errorCode createRuleArrayIndex(const GrammarRule* rules, Index ruleCount, AllocList* memList, ProductionIndex* index);
+
+/**
+ * @brief Looks up the first production of a grammar rule that matches an event.
+ * The first part of the event code of the production is the smallest code among
+ * the exact qname, uri:* and * productions of the event class
+ *
+ * @param[in] index the production index of the schema
+ * @param[in] rule the grammar rule
+ * @param[in] eventClass the class of the event
+ * @param[in] qnameID the qname of the AT and SE events; {URI_MAX, LN_MAX} otherwise
+ * @param[out] code the first part of the event code of the production; rule->pCount if there is no match
+ * @return FALSE if the rule is not indexed
+ */
+boolean findIndexedProduction(const ProductionIndex* index, const GrammarRule* rule, EventTypeClass eventClass, QNameID qnameID, Index* code);
+#endif
+
 #if EXIP_DEBUG == ON
 /**
  * @brief Prints a grammar rule
  * Note! This is only for debugging purposes!
  * @param[in] nonTermID The left hand side nonTerminal of the Rule
  * @param[in] rule a Grammar Rule to be printed
- * @param[in] schema for string tables
+ * @param[in] schema for the simple types
+ * @param[in] uriTable for the qnames: the string tables of the schema or of the stream
  * @return Error handling code
  */
-errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *schema);
+errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *schema, UriTable* uriTable);
 
 #endif // EXIP_DEBUG
 
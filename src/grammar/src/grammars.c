@@ -19,11 +19,22 @@
 #include "memManagement.h"
 #include "sTables.h"
 #include "ioUtil.h"
+#include "dynamicArray.h"
 
 #define DEF_DOC_GRAMMAR_RULE_NUMBER 2 // first rule is excluded
 #define DEF_FRAG_GRAMMAR_RULE_NUMBER 1 // first rule is excluded
 #define DEF_ELEMENT_GRAMMAR_RULE_NUMBER 2
 
+/** The initial number of built-in element grammars of a stream, also the number added each expansion time */
+#define DEF_BUILT_IN_GRAMMAR_NUMBER 300
+
+#if !GRAMMAR_STACK_MAX_DEPTH
+/** The initial number of nodes of the grammar stack; doubled each expansion time */
+# define GRAMMAR_STACK_CHUNK 16
+#endif
+
+static unsigned char getSecondLevelFlags(EXIStream* strm, EXIGrammar* grammar);
+
 errorCode createDocGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index qnameCount)
 {
 	GrammarRule* tmp_rule;
@@ -71,8 +82,10 @@ errorCode createDocGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index qnameC
 		{
 			SET_PROD_EXI_EVENT(tmp_rule->production[qnameCount - e].content, EVENT_SE_QNAME);
 			SET_PROD_NON_TERM(tmp_rule->production[qnameCount - e].content, GR_DOC_END);
-			tmp_rule->production[qnameCount - e].typeId = GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar;
-			tmp_rule->production[qnameCount - e].qnameId = elQnameArr[e];
+			if(!PROD_IDS_FIT(GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar, elQnameArr[e]))
+				return EXIP_OUT_OF_BOUND_BUFFER;
+			SET_PROD_TYPE_ID(&tmp_rule->production[qnameCount - e], GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar);
+			SET_PROD_QNAME_ID(&tmp_rule->production[qnameCount - e], elQnameArr[e]);
 		}
 		tmp_rule->pCount = tmp_code1;
 	}
@@ -92,9 +105,9 @@ errorCode createDocGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index qnameC
 	 */
 	SET_PROD_EXI_EVENT(tmp_rule->production[0].content, EVENT_SE_ALL);
 	SET_PROD_NON_TERM(tmp_rule->production[0].content, GR_DOC_END);
-	tmp_rule->production[0].typeId = INDEX_MAX;
-	tmp_rule->production[0].qnameId.uriId = URI_MAX;
-	tmp_rule->production[0].qnameId.lnId = LN_MAX;
+	SET_PROD_TYPE_ID(&tmp_rule->production[0], INDEX_MAX);
+	SET_PROD_URI_ID(&tmp_rule->production[0], URI_MAX);
+	SET_PROD_LN_ID(&tmp_rule->production[0], LN_MAX);
 
 	/* Rule for Document end */
 	/* 
@@ -112,13 +125,16 @@ errorCode createDocGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index qnameC
 
 	SET_PROD_EXI_EVENT(tmp_rule->production[0].content, EVENT_ED);
 	SET_PROD_NON_TERM(tmp_rule->production[0].content, GR_VOID_NON_TERMINAL);
-	tmp_rule->production[0].typeId = INDEX_MAX;
-	tmp_rule->production[0].qnameId.uriId = URI_MAX;
-	tmp_rule->production[0].qnameId.lnId = LN_MAX;
+	SET_PROD_TYPE_ID(&tmp_rule->production[0], INDEX_MAX);
+	SET_PROD_URI_ID(&tmp_rule->production[0], URI_MAX);
+	SET_PROD_LN_ID(&tmp_rule->production[0], LN_MAX);
 
 	tmp_rule->pCount = 1;
 	tmp_rule->meta = 0;
 
+	setRuleCodeBits(&schema->docGrammar.rule[GR_DOC_CONTENT]);
+	setRuleCodeBits(&schema->docGrammar.rule[GR_DOC_END]);
+
 	return EXIP_OK;
 }
 
@@ -157,6 +173,7 @@ errorCode createBuiltInElementGrammar(EXIGrammar* elementGrammar, EXIStream* str
 	/* The part 1 productions get added later... */
 	tmp_rule->pCount = 0;
 	tmp_rule->meta = 0;
+	tmp_rule->codeBits[0] = tmp_rule->codeBits[1] = 1 + getBitsNumber(0);
 	tmp_rule->prodDim = DEFAULT_PROD_ARRAY_DIM;
 
 	/* Rule for ElementContent */
@@ -178,11 +195,12 @@ errorCode createBuiltInElementGrammar(EXIGrammar* elementGrammar, EXIStream* str
 	/* EE	                  0 */
 	SET_PROD_EXI_EVENT(tmp_rule->production[0].content, EVENT_EE);
 	SET_PROD_NON_TERM(tmp_rule->production[0].content, GR_VOID_NON_TERMINAL);
-	tmp_rule->production[0].typeId = INDEX_MAX;
-	tmp_rule->production[0].qnameId.uriId = URI_MAX;
-	tmp_rule->production[0].qnameId.lnId = LN_MAX;
+	SET_PROD_TYPE_ID(&tmp_rule->production[0], INDEX_MAX);
+	SET_PROD_URI_ID(&tmp_rule->production[0], URI_MAX);
+	SET_PROD_LN_ID(&tmp_rule->production[0], LN_MAX);
 	tmp_rule->pCount = 1;
 	tmp_rule->meta = 0;
+	tmp_rule->codeBits[0] = tmp_rule->codeBits[1] = 1 + getBitsNumber(1);
 	tmp_rule->prodDim = DEFAULT_PROD_ARRAY_DIM;
 	/* More part 1 productions get added later... */
 
@@ -191,6 +209,9 @@ errorCode createBuiltInElementGrammar(EXIGrammar* elementGrammar, EXIStream* str
 
 errorCode insertZeroProduction(DynGrammarRule* rule, EventType eventType, SmallIndex nonTermID, QNameID* qnameId, boolean hasSecondLevelProd)
 {
+	if(!PROD_IDS_FIT(INDEX_MAX, *qnameId))
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
 	if(rule->pCount == rule->prodDim) // The dynamic array rule->production needs to be resized
 	{
 		void* ptr = EXIP_REALLOC(rule->production, sizeof(Production)*(rule->prodDim + DEFAULT_PROD_ARRAY_DIM));
@@ -203,38 +224,103 @@ errorCode insertZeroProduction(DynGrammarRule* rule, EventType eventType, SmallI
 
 	SET_PROD_EXI_EVENT(rule->production[rule->pCount].content, eventType);
 	SET_PROD_NON_TERM(rule->production[rule->pCount].content, nonTermID);
-	rule->production[rule->pCount].typeId = INDEX_MAX;
-	rule->production[rule->pCount].qnameId = *qnameId;
+	SET_PROD_TYPE_ID(&rule->production[rule->pCount], INDEX_MAX);
+	SET_PROD_QNAME_ID(&rule->production[rule->pCount], *qnameId);
 
 	rule->pCount += 1;
+	// The second level productions are counted
+	rule->codeBits[0] = rule->codeBits[1] = 1 + getBitsNumber(rule->pCount);
+	return EXIP_OK;
+}
+
+errorCode addBuiltInElementGrammar(EXIStream* strm, QNameID qnameID, EXIGrammar** elemGrammar)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIGrammar newElementGrammar;
+	Index dynArrIndx;
+
+	if(strm->builtInGrammars.grammar == NULL)
+		TRY(createDynArray(&strm->builtInGrammars.dynArray, sizeof(EXIGrammar), DEF_BUILT_IN_GRAMMAR_NUMBER));
+
+	// The grammar index is set in the stream's own copy of the local names
+	TRY(ownLnTable(strm, qnameID.uriId));
+
+	TRY(createBuiltInElementGrammar(&newElementGrammar, strm));
+	TRY(addDynEntry(&strm->builtInGrammars.dynArray, &newElementGrammar, &dynArrIndx));
+
+	GET_LN_URI_QNAME(strm->uriTable, qnameID).elemGrammar = strm->schema->grammarTable.count + dynArrIndx;
+	*elemGrammar = &strm->builtInGrammars.grammar[dynArrIndx];
+
 	return EXIP_OK;
 }
 #endif
 
-errorCode pushGrammar(EXIGrammarStack** gStack, QNameID currQNameID, EXIGrammar* grammar)
+errorCode pushGrammar(EXIStream* strm, QNameID currQNameID, EXIGrammar* grammar)
 {
-	struct GrammarStackNode* node = (struct GrammarStackNode*)EXIP_MALLOC(sizeof(struct GrammarStackNode));
-	if(node == NULL)
-		return EXIP_MEMORY_ALLOCATION_ERROR;
+	GrammarStack* stack = &strm->grammarStack;
+	EXIGrammarStack* node;
+
+#if GRAMMAR_STACK_MAX_DEPTH
+	if(stack->depth == GRAMMAR_STACK_MAX_DEPTH)
+	{
+		DEBUG_MSG(ERROR, DEBUG_GRAMMAR, (">The element nesting exceeds GRAMMAR_STACK_MAX_DEPTH (%d)\n", GRAMMAR_STACK_MAX_DEPTH));
+		return EXIP_OUT_OF_BOUND_BUFFER;
+	}
+#else
+	if(stack->depth == stack->size)
+	{
+		Index size = stack->size == 0 ? GRAMMAR_STACK_CHUNK : 2*stack->size;
+
+		node = (EXIGrammarStack*) EXIP_REALLOC(stack->node, sizeof(EXIGrammarStack)*size);
+		if(node == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+
+		stack->node = node;
+		stack->size = size;
+	}
+#endif
+
+	node = &stack->node[stack->depth];
+	stack->depth += 1;
 
 	node->grammar = grammar;
 	node->currNonTermID = GR_START_TAG_CONTENT;
 	node->currQNameID = currQNameID;
-	node->nextInStack = *gStack;
-	*gStack = node;
+	node->secondLevel = getSecondLevelFlags(strm, grammar);
+	strm->gStack = node;
 	return EXIP_OK;
 }
 
-void popGrammar(EXIGrammarStack** gStack)
+void popGrammar(EXIStream* strm)
 {
-	struct GrammarStackNode* node = *gStack;
-	if((*gStack) != NULL)
-	{
-		node = *gStack;
-		*gStack = (*gStack)->nextInStack;
+	GrammarStack* stack = &strm->grammarStack;
 
-		EXIP_MFREE(node);
-	}
+	if(stack->depth > 0)
+		stack->depth -= 1;
+
+	strm->gStack = stack->depth == 0 ? NULL : &stack->node[stack->depth - 1];
+}
+
+void initGrammarStack(EXIStream* strm)
+{
+#if !GRAMMAR_STACK_MAX_DEPTH
+	strm->grammarStack.node = NULL;
+	strm->grammarStack.size = 0;
+#endif
+	strm->grammarStack.depth = 0;
+	strm->gStack = NULL;
+}
+
+void destroyGrammarStack(EXIStream* strm)
+{
+#if !GRAMMAR_STACK_MAX_DEPTH
+	if(strm->grammarStack.node != NULL)
+		EXIP_MFREE(strm->grammarStack.node);
+	strm->grammarStack.node = NULL;
+	strm->grammarStack.size = 0;
+#endif
+	strm->grammarStack.depth = 0;
+	strm->gStack = NULL;
 }
 
 errorCode createFragmentGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index qnameCount)
@@ -281,8 +367,10 @@ errorCode createFragmentGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index q
 		{
 			SET_PROD_EXI_EVENT(tmp_rule->production[qnameCount - e].content, EVENT_SE_QNAME);
 			SET_PROD_NON_TERM(tmp_rule->production[qnameCount - e].content, GR_FRAGMENT_CONTENT);
-			tmp_rule->production[qnameCount - e].typeId = GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar;
-			tmp_rule->production[qnameCount - e].qnameId = elQnameArr[e];
+			if(!PROD_IDS_FIT(GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar, elQnameArr[e]))
+				return EXIP_OUT_OF_BOUND_BUFFER;
+			SET_PROD_TYPE_ID(&tmp_rule->production[qnameCount - e], GET_LN_URI_QNAME(schema->uriTable, elQnameArr[e]).elemGrammar);
+			SET_PROD_QNAME_ID(&tmp_rule->production[qnameCount - e], elQnameArr[e]);
 		}
 		tmp_rule->pCount = tmp_code1;
 	}
@@ -304,15 +392,17 @@ errorCode createFragmentGrammar(EXIPSchema* schema, QNameID* elQnameArr, Index q
 
 	SET_PROD_EXI_EVENT(tmp_rule->production[0].content, EVENT_ED);
 	SET_PROD_NON_TERM(tmp_rule->production[0].content, GR_VOID_NON_TERMINAL);
-	tmp_rule->production[0].typeId = INDEX_MAX;
-	tmp_rule->production[0].qnameId.uriId = URI_MAX;
-	tmp_rule->production[0].qnameId.lnId = LN_MAX;
+	SET_PROD_TYPE_ID(&tmp_rule->production[0], INDEX_MAX);
+	SET_PROD_URI_ID(&tmp_rule->production[0], URI_MAX);
+	SET_PROD_LN_ID(&tmp_rule->production[0], LN_MAX);
 
 	SET_PROD_EXI_EVENT(tmp_rule->production[1].content, EVENT_SE_ALL);
 	SET_PROD_NON_TERM(tmp_rule->production[1].content, GR_FRAGMENT_CONTENT);
-	tmp_rule->production[1].typeId = INDEX_MAX;
-	tmp_rule->production[1].qnameId.uriId = URI_MAX;
-	tmp_rule->production[1].qnameId.lnId = LN_MAX;
+	SET_PROD_TYPE_ID(&tmp_rule->production[1], INDEX_MAX);
+	SET_PROD_URI_ID(&tmp_rule->production[1], URI_MAX);
+	SET_PROD_LN_ID(&tmp_rule->production[1], LN_MAX);
+
+	setRuleCodeBits(tmp_rule);
 
 	return EXIP_OK;
 }
@@ -363,6 +453,376 @@ unsigned int getBitsFirstPartCode(EXIStream* strm, Index prodCount, SmallIndex c
 	return getBitsNumber(prodCount - 1 + secondLevelExists);
 }
 
+/**
+ * The second level productions of the rules of a grammar with the options of the stream,
+ * as in getBitsFirstPartCode() (xsi:nil aside)
+ */
+static unsigned char getSecondLevelFlags(EXIStream* strm, EXIGrammar* grammar)
+{
+	unsigned char flags = 0;
+
+	if(IS_BUILT_IN_ELEM(grammar->props))
+	{
+		// The codeBits of the built-in element grammars count the second level
+	}
+	else if(IS_DOCUMENT(grammar->props) || IS_FRAGMENT(grammar->props))
+	{
+		if(IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS) || IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS))
+			flags = SECOND_LEVEL_FIRST_RULE | SECOND_LEVEL_OTHER_RULES;
+		else if(IS_DOCUMENT(grammar->props) && IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD))
+			flags = SECOND_LEVEL_FIRST_RULE;
+	}
+	else if(!WITH_STRICT(strm->header.opts.enumOpt))
+		flags = SECOND_LEVEL_FIRST_RULE | SECOND_LEVEL_OTHER_RULES;
+	else if(IS_NILLABLE(grammar->props) || HAS_NAMED_SUB_TYPE_OR_UNION(grammar->props))
+		flags = SECOND_LEVEL_FIRST_RULE;
+
+	return flags;
+}
+
+void setRuleCodeBits(GrammarRule* rule)
+{
+	if(rule->pCount == 0)
+	{
+		// Left to getBitsFirstPartCode()
+		rule->codeBits[0] = rule->codeBits[1] = 0;
+		return;
+	}
+
+	rule->codeBits[0] = 1 + getBitsNumber(rule->pCount - 1);
+	rule->codeBits[1] = 1 + getBitsNumber(rule->pCount);
+}
+
+void setSchemaCodeBits(EXIPSchema* schema)
+{
+	Index g;
+	Index r;
+
+	for(r = 0; r < schema->docGrammar.count; r++)
+		setRuleCodeBits(&schema->docGrammar.rule[r]);
+
+	for(g = 0; g < schema->grammarTable.count; g++)
+	{
+		for(r = 0; r < schema->grammarTable.grammar[g].count; r++)
+			setRuleCodeBits(&schema->grammarTable.grammar[g].rule[r]);
+	}
+}
+
+/**
+ * Numbers the events of a layout in the order of their position;
+ * bit i of mask is set when the event at position i has a production
+ */
+static void setEventCodeLayout(EventCodeLayout* layout, unsigned int mask)
+{
+	unsigned char i;
+
+	layout->count = 0;
+	for(i = 0; i < EVENT_CODE_STATE_COUNT; i++)
+	{
+		layout->state[i] = EVENT_CODE_NONE;
+		layout->code[i] = EVENT_CODE_NONE;
+	}
+
+	for(i = 0; i < EVENT_CODE_STATE_COUNT; i++)
+	{
+		if(mask & (1 << i))
+		{
+			layout->state[layout->count] = i;
+			layout->code[i] = layout->count;
+			layout->count += 1;
+		}
+	}
+
+	layout->bits = layout->count > 0 ? getBitsNumber(layout->count - 1) : 0;
+}
+
+void setEventCodeTables(EXIStream* strm)
+{
+	EventCodeTables* tables = &strm->eventCodes;
+	unsigned int ns = IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PREFIXES);
+	unsigned int sc = WITH_SELF_CONTAINED(strm->header.opts.enumOpt);
+	unsigned int dtd = IS_PRESERVED(strm->header.opts.preserve, PRESERVE_DTD);
+	unsigned int cm = IS_PRESERVED(strm->header.opts.preserve, PRESERVE_COMMENTS);
+	unsigned int pi = IS_PRESERVED(strm->header.opts.preserve, PRESERVE_PIS);
+	unsigned int mask;
+	unsigned int l;
+
+	// Built-in element grammars: SE(*), CH, ER and CM or PI in both rules;
+	// EE, AT(*), NS and SC in StartTagContent only
+	mask = (1 << 4) | (1 << 5) | (dtd << 6) | ((cm | pi) << 7);
+	setEventCodeLayout(&tables->builtIn[0], mask | (1 << 0) | (1 << 1) | (ns << 2) | (sc << 3));
+	setEventCodeLayout(&tables->builtIn[1], mask);
+
+	// Schema-informed grammars, non-strict mode
+	for(l = 0; l < 8; l++)
+	{
+		mask = (1 << 7) | (1 << 8) | (dtd << 9) | ((cm | pi) << 10);
+		if(l & 1)
+			mask |= 1 << 0; // EE
+		if(l & 2)
+			mask |= (1 << 3) | (1 << 4); // AT(*), AT [untyped value]
+		if(l & 4)
+			mask |= (1 << 1) | (1 << 2) | (ns << 5) | (sc << 6); // AT(xsi:type), AT(xsi:nil), NS, SC
+		setEventCodeLayout(&tables->schema[l], mask);
+	}
+
+	// Schema-informed grammars, strict mode: AT(xsi:type) with named sub-types or union, AT(xsi:nil) if nillable
+	for(l = 0; l < 4; l++)
+		setEventCodeLayout(&tables->strict[l], ((l >> 1) << 0) | ((l & 1) << 1));
+
+	// Document grammar
+	setEventCodeLayout(&tables->document[0], (dtd << 0) | ((cm | pi) << 3));
+	setEventCodeLayout(&tables->document[1], (cm << 1) | (pi << 2));
+}
+
+#if PRODUCTION_INDEX_USE
+
+/** The smallest number of slots of a production index */
+#define PRODUCTION_INDEX_MIN_SIZE 16
+
+/**
+ * @name The flags in the code of the slot that marks an indexed rule:
+ * the kinds of wildcard productions of the rule
+ */
+/**@{*/
+#define WILDCARD_AT_URI 0x01
+#define WILDCARD_AT_ALL 0x02
+#define WILDCARD_SE_URI 0x04
+#define WILDCARD_SE_ALL 0x08
+/**@}*/
+
+static Index productionIndexHash(size_t ruleKey, EventTypeClass eventClass, SmallIndex uriId, Index lnId)
+{
+	size_t hash = ruleKey;
+
+	hash = (hash ^ (hash >> 16)) * 0x45d9f3b;
+	hash = (hash ^ ((size_t) uriId << 8) ^ (size_t) eventClass) * 0x45d9f3b;
+	hash = (hash ^ (size_t) lnId) * 0x45d9f3b;
+
+	return (Index) (hash ^ (hash >> 16));
+}
+
+/**
+ * @brief Finds the slot of a key in the production index; the empty slot where it goes if the key is not there
+ */
+static ProductionIndexSlot* productionIndexSlot(const ProductionIndex* index, size_t ruleKey, EventTypeClass eventClass, SmallIndex uriId, Index lnId)
+{
+	Index mask = index->size - 1;
+	Index pos = productionIndexHash(ruleKey, eventClass, uriId, lnId) & mask;
+	ProductionIndexSlot* slot = &index->slot[pos];
+
+	while(slot->ruleKey != 0)
+	{
+		if(slot->ruleKey == ruleKey && slot->eventClass == eventClass && slot->qnameId.uriId == uriId && slot->qnameId.lnId == lnId)
+			break;
+		pos = (pos + 1) & mask;
+		slot = &index->slot[pos];
+	}
+
+	return slot;
+}
+
+/**
+ * @brief Adds a key to the production index or lowers its code
+ */
+static void productionIndexInsert(ProductionIndex* index, size_t ruleKey, EventTypeClass eventClass, SmallIndex uriId, Index lnId, Index code)
+{
+	ProductionIndexSlot* slot = productionIndexSlot(index, ruleKey, eventClass, uriId, lnId);
+
+	if(slot->ruleKey == 0)
+	{
+		slot->ruleKey = ruleKey;
+		slot->eventClass = eventClass;
+		slot->qnameId.uriId = uriId;
+		slot->qnameId.lnId = lnId;
+		slot->code = code;
+		index->count += 1;
+	}
+	else if(code < slot->code)
+		slot->code = code;
+}
+
+/**
+ * @brief Indexes the productions of a rule. A rule slot (EVENT_VOID_CLASS)
+ * records that the rule is indexed and which wildcard productions it has
+ */
+static void indexRuleProductions(ProductionIndex* index, const GrammarRule* rule)
+{
+	Production* tmpProd;
+	EventTypeClass eventClass;
+	size_t ruleKey = PRODUCTION_INDEX_RULE_KEY(index, rule);
+	Index wildcards = 0;
+	Index j;
+
+	if(rule->pCount < PRODUCTION_INDEX_THRESHOLD)
+		return;
+
+	// A rule shared by several grammars is indexed once
+	if(productionIndexSlot(index, ruleKey, EVENT_VOID_CLASS, URI_MAX, LN_MAX)->ruleKey != 0)
+		return;
+
+	for(j = 0; j < rule->pCount; j++)
+	{
+		tmpProd = &rule->production[rule->pCount - 1 - j];
+		eventClass = GET_EVENT_CLASS(GET_PROD_EXI_EVENT(tmpProd->content));
+
+		if(eventClass == EVENT_AT_CLASS || eventClass == EVENT_SE_CLASS)
+		{
+			productionIndexInsert(index, ruleKey, eventClass, GET_PROD_URI_ID(tmpProd), GET_PROD_LN_ID(tmpProd), j);
+			if(GET_PROD_URI_ID(tmpProd) == URI_MAX)
+				wildcards |= eventClass == EVENT_AT_CLASS ? WILDCARD_AT_ALL : WILDCARD_SE_ALL;
+			else if(GET_PROD_LN_ID(tmpProd) == LN_MAX)
+				wildcards |= eventClass == EVENT_AT_CLASS ? WILDCARD_AT_URI : WILDCARD_SE_URI;
+		}
+		else
+			productionIndexInsert(index, ruleKey, eventClass, URI_MAX, LN_MAX, j);
+	}
+
+	productionIndexInsert(index, ruleKey, EVENT_VOID_CLASS, URI_MAX, LN_MAX, wildcards);
+}
+
+/**
+ * @brief At most one key per production and one per rule of the rules that are indexed
+ */
+static size_t countIndexKeys(const GrammarRule* rule, Index ruleCount)
+{
+	size_t keyCount = 0;
+	Index r;
+
+	for(r = 0; r < ruleCount; r++)
+	{
+		if(rule[r].pCount >= PRODUCTION_INDEX_THRESHOLD)
+			keyCount += rule[r].pCount + 1;
+	}
+
+	return keyCount;
+}
+
+/**
+ * @brief Allocates the empty slots of a production index for keyCount keys
+ */
+static errorCode allocateProductionIndex(ProductionIndex* index, size_t keyCount, AllocList* memList)
+{
+	size_t size;
+
+	index->slot = NULL;
+	index->size = 0;
+	index->count = 0;
+
+	if(keyCount == 0)
+		return EXIP_OK;
+
+	// Keep the index at most three quarters full
+	size = PRODUCTION_INDEX_MIN_SIZE;
+	while(3*size < 4*keyCount)
+		size = 2*size;
+	if(size > INDEX_MAX)
+	{
+		DEBUG_MSG(WARNING, DEBUG_GRAMMAR, (">The production index of the schema would need %lu slots - the schema is not indexed\n", (unsigned long) size));
+		return EXIP_OK;
+	}
+
+	index->slot = (ProductionIndexSlot*) memManagedAllocate(memList, sizeof(ProductionIndexSlot)*size);
+	if(index->slot == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	memset(index->slot, 0, sizeof(ProductionIndexSlot)*size);
+	index->size = (Index) size;
+
+	return EXIP_OK;
+}
+
+errorCode createProductionIndex(EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	ProductionIndex* index = &schema->prodIndex;
+	size_t keyCount;
+	Index i, r;
+
+	keyCount = countIndexKeys(schema->docGrammar.rule, schema->docGrammar.count);
+	for(i = 0; i < schema->grammarTable.count; i++)
+		keyCount += countIndexKeys(schema->grammarTable.grammar[i].rule, schema->grammarTable.grammar[i].count);
+
+	index->ruleBase = NULL;
+	TRY(allocateProductionIndex(index, keyCount, &schema->memList));
+	if(index->size == 0)
+		return EXIP_OK;
+
+	for(r = 0; r < schema->docGrammar.count; r++)
+		indexRuleProductions(index, &schema->docGrammar.rule[r]);
+	for(i = 0; i < schema->grammarTable.count; i++)
+	{
+		for(r = 0; r < schema->grammarTable.grammar[i].count; r++)
+			indexRuleProductions(index, &schema->grammarTable.grammar[i].rule[r]);
+	}
+
+	return EXIP_OK;
+}
+
+errorCode createRuleArrayIndex(const GrammarRule* rules, Index ruleCount, AllocList* memList, ProductionIndex* index)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index r;
+
+	index->ruleBase = rules;
+	TRY(allocateProductionIndex(index, countIndexKeys(rules, ruleCount), memList));
+	if(index->size == 0)
+		return EXIP_OK;
+
+	for(r = 0; r < ruleCount; r++)
+		indexRuleProductions(index, &rules[r]);
+
+	return EXIP_OK;
+}
+
+boolean findIndexedProduction(const ProductionIndex* index, const GrammarRule* rule, EventTypeClass eventClass, QNameID qnameID, Index* code)
+{
+	ProductionIndexSlot* slot;
+	size_t ruleKey;
+	Index wildcards;
+
+	if(index->size == 0)
+		return FALSE;
+
+	ruleKey = PRODUCTION_INDEX_RULE_KEY(index, rule);
+	slot = productionIndexSlot(index, ruleKey, EVENT_VOID_CLASS, URI_MAX, LN_MAX);
+	if(slot->ruleKey == 0)
+		return FALSE;
+	wildcards = slot->code;
+
+	*code = rule->pCount;
+
+	if(eventClass != EVENT_AT_CLASS && eventClass != EVENT_SE_CLASS)
+	{
+		slot = productionIndexSlot(index, ruleKey, eventClass, URI_MAX, LN_MAX);
+		if(slot->ruleKey != 0)
+			*code = slot->code;
+		return TRUE;
+	}
+
+	// The qname, uri:* and * productions: the one with the smallest event code
+	slot = productionIndexSlot(index, ruleKey, eventClass, qnameID.uriId, qnameID.lnId);
+	if(slot->ruleKey != 0)
+		*code = slot->code;
+
+	if(wildcards & (eventClass == EVENT_AT_CLASS ? WILDCARD_AT_URI : WILDCARD_SE_URI))
+	{
+		slot = productionIndexSlot(index, ruleKey, eventClass, qnameID.uriId, LN_MAX);
+		if(slot->ruleKey != 0 && slot->code < *code)
+			*code = slot->code;
+	}
+
+	if(wildcards & (eventClass == EVENT_AT_CLASS ? WILDCARD_AT_ALL : WILDCARD_SE_ALL))
+	{
+		slot = productionIndexSlot(index, ruleKey, eventClass, URI_MAX, LN_MAX);
+		if(slot->ruleKey != 0 && slot->code < *code)
+			*code = slot->code;
+	}
+
+	return TRUE;
+}
+
+#endif /* PRODUCTION_INDEX_USE */
+
 #if EXIP_DEBUG == ON
 
 static void writeValueTypeString(EXIType exiType)
@@ -423,7 +883,7 @@ static void writeValueTypeString(EXIType exiType)
 	}
 }
 
-errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *schema)
+errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *schema, UriTable* uriTable)
 {
 	Index j = 0;
 	Production* tmpProd;
@@ -440,8 +900,8 @@ errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *
 		tmpProd = &rule->production[rule->pCount - 1 - j];
 		DEBUG_MSG(INFO, EXIP_DEBUG, ("\t"));
 
-		if(GET_PROD_EXI_EVENT(tmpProd->content) != EVENT_SE_QNAME && tmpProd->typeId != INDEX_MAX)
-			exiType = GET_EXI_TYPE(schema->simpleTypeTable.sType[tmpProd->typeId].content);
+		if(GET_PROD_EXI_EVENT(tmpProd->content) != EVENT_SE_QNAME && GET_PROD_TYPE_ID(tmpProd) != INDEX_MAX)
+			exiType = GET_EXI_TYPE(schema->simpleTypeTable.sType[GET_PROD_TYPE_ID(tmpProd)].content);
 		else
 			exiType = VALUE_TYPE_NONE;
 
@@ -455,9 +915,10 @@ errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *
 				break;
 			case EVENT_SE_QNAME:
 			{
-				QNameID *qname = &tmpProd->qnameId;
-				localName = &(GET_LN_URI_P_QNAME(schema->uriTable, qname).lnStr);
-				DEBUG_MSG(INFO, EXIP_DEBUG, ("SE (qname: %u:%u) ", (unsigned int) qname->uriId, (unsigned int) qname->lnId));
+				QNameID qname;
+				GET_PROD_QNAME_ID(tmpProd, qname);
+				localName = &(GET_LN_P_URI_P_QNAME(uriTable, &qname).lnStr);
+				DEBUG_MSG(INFO, EXIP_DEBUG, ("SE (qname: %u:%u) ", (unsigned int) qname.uriId, (unsigned int) qname.lnId));
 				break;
 			}
 			case EVENT_SE_URI:
@@ -471,9 +932,10 @@ errorCode printGrammarRule(SmallIndex nonTermID, GrammarRule* rule, EXIPSchema *
 				break;
 			case EVENT_AT_QNAME:
 			{
-				QNameID *qname = &tmpProd->qnameId;
-				localName = &(GET_LN_URI_P_QNAME(schema->uriTable, qname).lnStr);
-				DEBUG_MSG(INFO, EXIP_DEBUG, ("AT (qname %u:%u) ", (unsigned int) tmpProd->qnameId.uriId, (unsigned int) tmpProd->qnameId.lnId));
+				QNameID qname;
+				GET_PROD_QNAME_ID(tmpProd, qname);
+				localName = &(GET_LN_P_URI_P_QNAME(uriTable, &qname).lnStr);
+				DEBUG_MSG(INFO, EXIP_DEBUG, ("AT (qname %u:%u) ", (unsigned int) qname.uriId, (unsigned int) qname.lnId));
 				writeValueTypeString(exiType);
 				break;
 			}
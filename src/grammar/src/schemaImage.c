@@ -0,0 +1,844 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file schemaImage.c
+ * @brief Writing and loading of the binary images of EXIPSchema objects
+ *
+ * The image starts with an imageHeader. The sections that follow it are aligned
+ * on SCHEMA_IMAGE_ALIGN bytes and referenced by their offset from the start of
+ * the image; the offset 0 stands for NULL. The records of the image use the
+ * types of the runtime structures where these do not contain pointers and are
+ * zeroed before they are filled, so that the padding bytes do not make two images
+ * of the same schema differ. The loader checks the indexes in the records against
+ * the tables they refer to.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "schemaImage.h"
+#include "grammars.h"
+#include "memManagement.h"
+#include "sTables.h"
+#include "stringManipulate.h"
+
+/** The first octets of a schema image */
+#define IMAGE_MAGIC "EXIS"
+
+/** Written in the byte order of the writer */
+#define IMAGE_BYTE_ORDER 0x0102
+
+#define IMAGE_FLAG_PACKED_GRAMMAR 0x01
+#define IMAGE_FLAG_STRING_UTF8    0x02
+
+#if DYN_ARRAY_USE == ON
+# define SET_IMAGE_TABLE(dynArr, size, count) ((dynArr).entrySize = (size), (dynArr).chunkEntries = (count), (dynArr).arrayEntries = (count))
+#else
+# define SET_IMAGE_TABLE(dynArr, size, count)
+#endif
+
+/**
+ * Identifies the format and the build of EXIP that wrote an image.
+ * 16 bytes without padding at the start of the image
+ */
+struct imageFingerprint
+{
+	char magic[4];
+	uint16_t version;
+	uint16_t byteOrder;
+	/** The sizes of Index, SmallIndex, CharType, UnsignedInteger, Production, ProdCount and size_t */
+	unsigned char typeSize[7];
+	unsigned char flags;
+};
+
+struct imageString
+{
+	uint32_t offset;
+	/** The number of CharType units */
+	uint32_t size;
+	Index length;
+};
+
+struct imageUri
+{
+	struct imageString uriStr;
+	Index lnCount;
+	Index pfxCount;
+	/** An array of imageLn */
+	uint32_t lnOffset;
+	/** An array of imageString */
+	uint32_t pfxOffset;
+};
+
+struct imageLn
+{
+	struct imageString lnStr;
+	Index elemGrammar;
+	Index typeGrammar;
+};
+
+struct imageGrammar
+{
+	/** The index of the first rule of the grammar in the rules of the image */
+	uint32_t firstRule;
+	uint32_t props;
+	SmallIndex count;
+};
+
+struct imageRule
+{
+	/** An array of Production */
+	uint32_t prodOffset;
+	uint16_t meta;
+	unsigned char codeBits[2];
+	ProdCount pCount;
+};
+
+struct imageEnum
+{
+	Index typeId;
+	SmallIndex count;
+	/** An array of imageString or UnsignedInteger */
+	uint32_t valuesOffset;
+};
+
+struct imageHeader
+{
+	struct imageFingerprint fp;
+	/** The size of the image in bytes */
+	uint32_t size;
+	uint32_t ruleCount;
+	/** An array of imageUri */
+	uint32_t uriOffset;
+	/** An array of imageGrammar */
+	uint32_t grammarOffset;
+	/** An array of imageRule: the rules of the document grammar and then the ones of the grammarTable */
+	uint32_t ruleOffset;
+	/** An array of SimpleType */
+	uint32_t simpleTypeOffset;
+	/** An array of imageEnum */
+	uint32_t enumOffset;
+	/** An array of ProductionIndexSlot keyed by the positions of the rules; 0 when the index is not in the image */
+	uint32_t prodIndexOffset;
+	Index prodIndexSize;
+	Index prodIndexCount;
+	SmallIndex uriCount;
+	Index grammarCount;
+	Index simpleTypeCount;
+	Index enumCount;
+	Index staticGrCount;
+	struct imageGrammar docGrammar;
+};
+
+/** The image being written; it is written twice, with image NULL to get its size first */
+struct imageWriter
+{
+	unsigned char* image;
+	size_t used;
+#if PRODUCTION_INDEX_USE
+	/** The production index of the rules in the order of the image */
+	ProductionIndex prodIndex;
+#endif
+};
+
+static void setImageFingerprint(struct imageFingerprint* fp)
+{
+	memset(fp, 0, sizeof(struct imageFingerprint));
+	memcpy(fp->magic, IMAGE_MAGIC, 4);
+	fp->version = SCHEMA_IMAGE_VERSION;
+	fp->byteOrder = IMAGE_BYTE_ORDER;
+	fp->typeSize[0] = (unsigned char) sizeof(Index);
+	fp->typeSize[1] = (unsigned char) sizeof(SmallIndex);
+	fp->typeSize[2] = (unsigned char) sizeof(CharType);
+	fp->typeSize[3] = (unsigned char) sizeof(UnsignedInteger);
+	fp->typeSize[4] = (unsigned char) sizeof(Production);
+	fp->typeSize[5] = (unsigned char) sizeof(ProdCount);
+	fp->typeSize[6] = (unsigned char) sizeof(size_t);
+#if PACKED_GRAMMAR_USE
+	fp->flags |= IMAGE_FLAG_PACKED_GRAMMAR;
+#endif
+#if STRING_UTF8_USE
+	fp->flags |= IMAGE_FLAG_STRING_UTF8;
+#endif
+}
+
+/**
+ * @brief Reserves bytes at the end of the image, aligned on align bytes
+ * @return the offset of the reserved bytes
+ */
+static uint32_t imageReserve(struct imageWriter* w, size_t bytes, size_t align)
+{
+	size_t offset = (w->used + align - 1)/align*align;
+
+	if(w->image != NULL && offset > w->used)
+		memset(w->image + w->used, 0, offset - w->used);
+	w->used = offset + bytes;
+
+	return (uint32_t) offset;
+}
+
+static void imagePut(struct imageWriter* w, uint32_t offset, const void* data, size_t bytes)
+{
+	if(w->image != NULL && bytes > 0)
+		memcpy(w->image + offset, data, bytes);
+}
+
+static void writeImageString(struct imageWriter* w, const String* str, struct imageString* rec)
+{
+	Index octets = 0;
+	Index i;
+
+	// The number of CharType units of the string
+	for(i = 0; i < str->length; i++)
+		readCharFromString(str, &octets);
+
+	rec->length = str->length;
+	rec->size = (uint32_t) octets;
+	rec->offset = 0;
+	if(octets > 0)
+	{
+		rec->offset = imageReserve(w, sizeof(CharType)*octets, sizeof(CharType));
+		imagePut(w, rec->offset, str->str, sizeof(CharType)*octets);
+	}
+}
+
+static void writeImageProductions(struct imageWriter* w, uint32_t offset, const Production* production, ProdCount pCount)
+{
+	Production prodRec;
+	ProdCount p;
+
+	for(p = 0; p < pCount; p++)
+	{
+		memset(&prodRec, 0, sizeof(Production));
+		prodRec.content = production[p].content;
+		prodRec.typeId = production[p].typeId;
+		prodRec.qnameId.uriId = production[p].qnameId.uriId;
+		prodRec.qnameId.lnId = production[p].qnameId.lnId;
+		imagePut(w, offset + p*sizeof(Production), &prodRec, sizeof(Production));
+	}
+}
+
+static void writeImageSimpleTypes(struct imageWriter* w, uint32_t offset, const SimpleType* sType, Index count)
+{
+	SimpleType typeRec;
+	Index i;
+
+	for(i = 0; i < count; i++)
+	{
+		memset(&typeRec, 0, sizeof(SimpleType));
+		typeRec.content = sType[i].content;
+		typeRec.length = sType[i].length;
+		typeRec.max = sType[i].max;
+		typeRec.min = sType[i].min;
+		imagePut(w, offset + i*sizeof(SimpleType), &typeRec, sizeof(SimpleType));
+	}
+}
+
+static void writeImageGrammar(struct imageWriter* w, const EXIGrammar* grammar, uint32_t ruleOffset, uint32_t* ruleId, struct imageGrammar* rec)
+{
+	struct imageRule ruleRec;
+	GrammarRule* rule;
+	Index r;
+
+	memset(rec, 0, sizeof(struct imageGrammar));
+	rec->firstRule = *ruleId;
+	rec->props = grammar->props;
+	rec->count = grammar->count;
+
+	for(r = 0; r < grammar->count; r++)
+	{
+		rule = &grammar->rule[r];
+
+		memset(&ruleRec, 0, sizeof(struct imageRule));
+		ruleRec.pCount = rule->pCount;
+		ruleRec.meta = rule->meta;
+		ruleRec.codeBits[0] = rule->codeBits[0];
+		ruleRec.codeBits[1] = rule->codeBits[1];
+		if(rule->pCount > 0)
+		{
+			ruleRec.prodOffset = imageReserve(w, sizeof(Production)*rule->pCount, SCHEMA_IMAGE_ALIGN);
+			writeImageProductions(w, ruleRec.prodOffset, rule->production, rule->pCount);
+		}
+
+		imagePut(w, ruleOffset + (*ruleId)*sizeof(struct imageRule), &ruleRec, sizeof(struct imageRule));
+		*ruleId += 1;
+	}
+}
+
+static errorCode writeImage(EXIPSchema* schema, struct imageWriter* w)
+{
+	struct imageHeader hdr;
+	struct imageUri uriRec;
+	struct imageLn lnRec;
+	struct imageString strRec;
+	struct imageGrammar grRec;
+	struct imageEnum enumRec;
+	EnumDefinition* enumDef;
+	UriEntry* uriEntry;
+	uint32_t ruleId = 0;
+	size_t ruleCount;
+	Index i, j;
+
+	ruleCount = schema->docGrammar.count;
+	for(i = 0; i < schema->grammarTable.count; i++)
+		ruleCount += schema->grammarTable.grammar[i].count;
+
+	memset(&hdr, 0, sizeof(struct imageHeader));
+	setImageFingerprint(&hdr.fp);
+	hdr.ruleCount = (uint32_t) ruleCount;
+	hdr.uriCount = schema->uriTable.count;
+	hdr.grammarCount = schema->grammarTable.count;
+	hdr.simpleTypeCount = schema->simpleTypeTable.count;
+	hdr.enumCount = schema->enumTable.count;
+	hdr.staticGrCount = schema->staticGrCount;
+
+	imageReserve(w, sizeof(struct imageHeader), SCHEMA_IMAGE_ALIGN);
+	hdr.uriOffset = imageReserve(w, sizeof(struct imageUri)*hdr.uriCount, SCHEMA_IMAGE_ALIGN);
+	hdr.grammarOffset = imageReserve(w, sizeof(struct imageGrammar)*hdr.grammarCount, SCHEMA_IMAGE_ALIGN);
+	hdr.ruleOffset = imageReserve(w, sizeof(struct imageRule)*ruleCount, SCHEMA_IMAGE_ALIGN);
+	hdr.enumOffset = imageReserve(w, sizeof(struct imageEnum)*hdr.enumCount, SCHEMA_IMAGE_ALIGN);
+	hdr.simpleTypeOffset = imageReserve(w, sizeof(SimpleType)*hdr.simpleTypeCount, SCHEMA_IMAGE_ALIGN);
+	writeImageSimpleTypes(w, hdr.simpleTypeOffset, schema->simpleTypeTable.sType, hdr.simpleTypeCount);
+#if PRODUCTION_INDEX_USE
+	if(w->prodIndex.size > 0)
+	{
+		// The slots are zeroed when they are allocated
+		hdr.prodIndexSize = w->prodIndex.size;
+		hdr.prodIndexCount = w->prodIndex.count;
+		hdr.prodIndexOffset = imageReserve(w, sizeof(ProductionIndexSlot)*hdr.prodIndexSize, SCHEMA_IMAGE_ALIGN);
+		imagePut(w, hdr.prodIndexOffset, w->prodIndex.slot, sizeof(ProductionIndexSlot)*hdr.prodIndexSize);
+	}
+#endif
+
+	/* The string tables */
+	for(i = 0; i < schema->uriTable.count; i++)
+	{
+		uriEntry = &schema->uriTable.uri[i];
+
+		memset(&uriRec, 0, sizeof(struct imageUri));
+		writeImageString(w, &uriEntry->uriStr, &uriRec.uriStr);
+		uriRec.lnCount = uriEntry->lnTable.count;
+		uriRec.pfxCount = uriEntry->pfxTable.count;
+		uriRec.lnOffset = imageReserve(w, sizeof(struct imageLn)*uriRec.lnCount, SCHEMA_IMAGE_ALIGN);
+		uriRec.pfxOffset = imageReserve(w, sizeof(struct imageString)*uriRec.pfxCount, SCHEMA_IMAGE_ALIGN);
+
+		for(j = 0; j < uriEntry->lnTable.count; j++)
+		{
+			memset(&lnRec, 0, sizeof(struct imageLn));
+			writeImageString(w, &uriEntry->lnTable.ln[j].lnStr, &lnRec.lnStr);
+			lnRec.elemGrammar = uriEntry->lnTable.ln[j].elemGrammar;
+			lnRec.typeGrammar = uriEntry->lnTable.ln[j].typeGrammar;
+			imagePut(w, uriRec.lnOffset + j*sizeof(struct imageLn), &lnRec, sizeof(struct imageLn));
+		}
+
+		for(j = 0; j < uriEntry->pfxTable.count; j++)
+		{
+			memset(&strRec, 0, sizeof(struct imageString));
+			writeImageString(w, &uriEntry->pfxTable.pfx[j], &strRec);
+			imagePut(w, uriRec.pfxOffset + j*sizeof(struct imageString), &strRec, sizeof(struct imageString));
+		}
+
+		imagePut(w, hdr.uriOffset + i*sizeof(struct imageUri), &uriRec, sizeof(struct imageUri));
+	}
+
+	/* The grammars */
+	writeImageGrammar(w, &schema->docGrammar, hdr.ruleOffset, &ruleId, &hdr.docGrammar);
+	for(i = 0; i < schema->grammarTable.count; i++)
+	{
+		writeImageGrammar(w, &schema->grammarTable.grammar[i], hdr.ruleOffset, &ruleId, &grRec);
+		imagePut(w, hdr.grammarOffset + i*sizeof(struct imageGrammar), &grRec, sizeof(struct imageGrammar));
+	}
+
+	/* The enumerations */
+	for(i = 0; i < schema->enumTable.count; i++)
+	{
+		enumDef = &schema->enumTable.enumDef[i];
+
+		memset(&enumRec, 0, sizeof(struct imageEnum));
+		enumRec.typeId = enumDef->typeId;
+		enumRec.count = enumDef->count;
+
+		switch(GET_EXI_TYPE(schema->simpleTypeTable.sType[enumDef->typeId].content))
+		{
+			case VALUE_TYPE_STRING:
+				enumRec.valuesOffset = imageReserve(w, sizeof(struct imageString)*enumDef->count, SCHEMA_IMAGE_ALIGN);
+				for(j = 0; j < enumDef->count; j++)
+				{
+					memset(&strRec, 0, sizeof(struct imageString));
+					writeImageString(w, &((String*) enumDef->values)[j], &strRec);
+					imagePut(w, enumRec.valuesOffset + j*sizeof(struct imageString), &strRec, sizeof(struct imageString));
+				}
+			break;
+			case VALUE_TYPE_NON_NEGATIVE_INT:
+				enumRec.valuesOffset = imageReserve(w, sizeof(UnsignedInteger)*enumDef->count, SCHEMA_IMAGE_ALIGN);
+				imagePut(w, enumRec.valuesOffset, enumDef->values, sizeof(UnsignedInteger)*enumDef->count);
+			break;
+			default:
+				// The enumerations of the other types are not generated yet either
+				return EXIP_NOT_IMPLEMENTED_YET;
+		}
+
+		imagePut(w, hdr.enumOffset + i*sizeof(struct imageEnum), &enumRec, sizeof(struct imageEnum));
+	}
+
+	hdr.size = (uint32_t) w->used;
+	imagePut(w, 0, &hdr, sizeof(struct imageHeader));
+
+	return EXIP_OK;
+}
+
+static errorCode writeImageTwice(EXIPSchema* schema, struct imageWriter* w, void* image, size_t* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	w->image = NULL;
+	w->used = 0;
+	TRY(writeImage(schema, w));
+
+	// The offsets in the image are 32 bits
+	if((uint64_t) w->used > UINT32_MAX)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	if(image != NULL)
+	{
+		if(*size < w->used)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+
+		w->image = (unsigned char*) image;
+		w->used = 0;
+		TRY(writeImage(schema, w));
+	}
+
+	*size = w->used;
+
+	return EXIP_OK;
+}
+
+#if PRODUCTION_INDEX_USE
+/**
+ * @brief Builds the production index of the image: the rules of the schema are copied
+ * in the order of the image and keyed by their position there
+ */
+static errorCode createImageProductionIndex(EXIPSchema* schema, AllocList* memList, ProductionIndex* index)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	GrammarRule* rules;
+	size_t ruleCount;
+	Index i;
+
+	ruleCount = schema->docGrammar.count;
+	for(i = 0; i < schema->grammarTable.count; i++)
+		ruleCount += schema->grammarTable.grammar[i].count;
+
+	index->slot = NULL;
+	index->size = 0;
+	index->count = 0;
+	if(ruleCount == 0)
+		return EXIP_OK;
+
+	rules = (GrammarRule*) EXIP_MALLOC(sizeof(GrammarRule)*ruleCount);
+	if(rules == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	if(schema->docGrammar.count > 0)
+		memcpy(rules, schema->docGrammar.rule, sizeof(GrammarRule)*schema->docGrammar.count);
+	ruleCount = schema->docGrammar.count;
+	for(i = 0; i < schema->grammarTable.count; i++)
+	{
+		if(schema->grammarTable.grammar[i].count > 0)
+			memcpy(rules + ruleCount, schema->grammarTable.grammar[i].rule, sizeof(GrammarRule)*schema->grammarTable.grammar[i].count);
+		ruleCount += schema->grammarTable.grammar[i].count;
+	}
+
+	tmp_err_code = createRuleArrayIndex(rules, (Index) ruleCount, memList, index);
+	EXIP_MFREE(rules);
+
+	return tmp_err_code;
+}
+#endif
+
+errorCode writeSchemaImage(EXIPSchema* schema, void* image, size_t* size)
+{
+	struct imageWriter w;
+#if PRODUCTION_INDEX_USE
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	AllocList indexMem;
+
+	TRY(initAllocList(&indexMem));
+	TRY_CATCH(createImageProductionIndex(schema, &indexMem, &w.prodIndex), freeAllocList(&indexMem));
+	tmp_err_code = writeImageTwice(schema, &w, image, size);
+	freeAllocList(&indexMem);
+
+	return tmp_err_code;
+#else
+	return writeImageTwice(schema, &w, image, size);
+#endif
+}
+
+/**
+ * @brief Returns in section the count entries of entrySize bytes at offset in the image
+ * @return EXIP_OUT_OF_BOUND_BUFFER when they are not inside the image
+ */
+static errorCode imageSection(const unsigned char* image, size_t size, uint32_t offset, size_t count, size_t entrySize, const void** section)
+{
+	*section = NULL;
+	if(count == 0)
+		return EXIP_OK;
+
+	if(offset == 0 || offset > size || count > (size - offset)/entrySize)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	*section = image + offset;
+
+	return EXIP_OK;
+}
+
+static errorCode allocateImageTable(AllocList* memList, size_t count, size_t entrySize, void** table)
+{
+	*table = NULL;
+	if(count == 0)
+		return EXIP_OK;
+
+	*table = memManagedAllocate(memList, count*entrySize);
+	if(*table == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	memset(*table, 0, count*entrySize);
+
+	return EXIP_OK;
+}
+
+/**
+ * @brief Loads a string of the image in place
+ * The size CharType units of the record must hold exactly its length characters:
+ * the string functions rely on the length and would read past the characters otherwise
+ */
+static errorCode loadImageString(const unsigned char* image, size_t size, const struct imageString* rec, String* str)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	const void* chars;
+#if STRING_UTF8_USE
+	const unsigned char* octets;
+	uint32_t i = 0;
+	uint32_t end;
+	Index count = 0;
+#endif
+
+	TRY(imageSection(image, size, rec->offset, rec->size, sizeof(CharType), &chars));
+
+#if STRING_UTF8_USE
+	// Every UTF-8 sequence is complete and within the octets of the string
+	octets = (const unsigned char*) chars;
+	while(i < rec->size)
+	{
+		if(octets[i] < 0x80)
+			end = i + 1;
+		else if(octets[i] < 0xC0)
+			return EXIP_INVALID_EXIP_CONFIGURATION;
+		else
+			end = i + (octets[i] < 0xE0 ? 2 : (octets[i] < 0xF0 ? 3 : 4));
+
+		if(end > rec->size)
+			return EXIP_INVALID_EXIP_CONFIGURATION;
+		for(i++; i < end; i++)
+		{
+			if((octets[i] & 0xC0) != 0x80)
+				return EXIP_INVALID_EXIP_CONFIGURATION;
+		}
+		count++;
+	}
+
+	if(count != rec->length)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+#else
+	if(rec->length != rec->size)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+#endif
+
+	str->str = (CharType*) chars;
+	str->length = rec->length;
+
+	return EXIP_OK;
+}
+
+/**
+ * @brief Checks the indexes of a production of a grammar with count rules
+ * against the tables of the schema
+ */
+static errorCode checkImageProduction(const Production* prod, Index count, const EXIPSchema* schema)
+{
+	Index nonTerm = GET_PROD_NON_TERM(prod->content);
+	Index typeId = GET_PROD_TYPE_ID(prod);
+	SmallIndex uriId = GET_PROD_URI_ID(prod);
+	Index lnId = GET_PROD_LN_ID(prod);
+
+	if(nonTerm >= count && nonTerm != (GR_VOID_NON_TERMINAL & PROD_CONTENT_MASK))
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+
+	switch(GET_PROD_EXI_EVENT_CLASS(prod->content))
+	{
+		case EVENT_SE_CLASS:
+			if(typeId != INDEX_MAX && typeId >= schema->grammarTable.count)
+				return EXIP_INVALID_EXIP_CONFIGURATION;
+		break;
+		case EVENT_AT_CLASS:
+		case EVENT_CH_CLASS:
+			if(typeId != INDEX_MAX && typeId >= schema->simpleTypeTable.count)
+				return EXIP_INVALID_EXIP_CONFIGURATION;
+		break;
+		default:
+			return EXIP_OK;
+	}
+
+	// The qname of the AT and SE productions: uri:* and * included
+	if(uriId == URI_MAX)
+		return lnId == LN_MAX ? EXIP_OK : EXIP_INVALID_EXIP_CONFIGURATION;
+	if(uriId >= schema->uriTable.count || (lnId != LN_MAX && lnId >= schema->uriTable.uri[uriId].lnTable.count))
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+
+	return EXIP_OK;
+}
+
+/**
+ * @brief Loads a grammar; the grammars take the rules of the image one after the other
+ * @param[in, out] nextRule the first rule of the grammar; the first rule of the next grammar on return
+ */
+static errorCode loadImageGrammar(const struct imageGrammar* rec, GrammarRule* rules, uint32_t ruleCount, uint32_t* nextRule, const EXIPSchema* schema, EXIGrammar* grammar)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index r, p;
+
+	if(rec->firstRule != *nextRule || rec->count > ruleCount - rec->firstRule)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+	*nextRule += (uint32_t) rec->count;
+
+	grammar->rule = rec->count == 0 ? NULL : rules + rec->firstRule;
+	grammar->props = rec->props;
+	grammar->count = rec->count;
+
+	for(r = 0; r < grammar->count; r++)
+	{
+		for(p = 0; p < grammar->rule[r].pCount; p++)
+			TRY(checkImageProduction(&grammar->rule[r].production[p], grammar->count, schema));
+	}
+
+	return EXIP_OK;
+}
+
+#if PRODUCTION_INDEX_USE
+/**
+ * @brief Uses the production index of the image in place, after checking its slots:
+ * the event codes index the productions of the rules and the index has empty slots
+ */
+static errorCode loadImageProductionIndex(const unsigned char* image, const struct imageHeader* hdr, GrammarRule* rules, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	const ProductionIndexSlot* slot;
+	const void* section;
+	Index count = 0;
+	Index i;
+
+	if(hdr->prodIndexOffset == 0)
+		return EXIP_OK;
+
+	if(hdr->prodIndexSize == 0 || (hdr->prodIndexSize & (hdr->prodIndexSize - 1)) != 0)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+	TRY(imageSection(image, hdr->size, hdr->prodIndexOffset, hdr->prodIndexSize, sizeof(ProductionIndexSlot), &section));
+	slot = (const ProductionIndexSlot*) section;
+
+	for(i = 0; i < hdr->prodIndexSize; i++)
+	{
+		if(slot[i].ruleKey == 0)
+			continue;
+		if(slot[i].ruleKey > hdr->ruleCount || (slot[i].eventClass != EVENT_VOID_CLASS && slot[i].code >= rules[slot[i].ruleKey - 1].pCount))
+			return EXIP_INVALID_EXIP_CONFIGURATION;
+		count++;
+	}
+	if(count != hdr->prodIndexCount || count == hdr->prodIndexSize)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+
+	schema->prodIndex.slot = (ProductionIndexSlot*) section;
+	schema->prodIndex.size = hdr->prodIndexSize;
+	schema->prodIndex.count = hdr->prodIndexCount;
+	schema->prodIndex.ruleBase = rules;
+
+	return EXIP_OK;
+}
+#endif
+
+static errorCode loadImageTables(const unsigned char* image, const struct imageHeader* hdr, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	size_t size = hdr->size;
+	const struct imageUri* uriRec;
+	const struct imageLn* lnRec;
+	const struct imageString* strRec;
+	const struct imageGrammar* grRec;
+	const struct imageRule* ruleRec;
+	const struct imageEnum* enumRec;
+	const void* section;
+	GrammarRule* rules;
+	UriEntry* uriEntry;
+	LnEntry* lnEntry;
+	EnumDefinition* enumDef;
+	uint32_t nextRule = 0;
+	uint32_t r;
+	Index i, j;
+
+	/* The simple types are used in place */
+	TRY(imageSection(image, size, hdr->simpleTypeOffset, hdr->simpleTypeCount, sizeof(SimpleType), &section));
+	schema->simpleTypeTable.sType = (SimpleType*) section;
+	SET_IMAGE_TABLE(schema->simpleTypeTable.dynArray, sizeof(SimpleType), hdr->simpleTypeCount);
+	schema->simpleTypeTable.count = hdr->simpleTypeCount;
+
+	/* The string tables: the strings are used in place */
+	TRY(imageSection(image, size, hdr->uriOffset, hdr->uriCount, sizeof(struct imageUri), &section));
+	uriRec = (const struct imageUri*) section;
+	TRY(allocateImageTable(&schema->memList, hdr->uriCount, sizeof(UriEntry), (void**) &schema->uriTable.uri));
+	SET_IMAGE_TABLE(schema->uriTable.dynArray, sizeof(UriEntry), hdr->uriCount);
+	schema->uriTable.count = hdr->uriCount;
+	for(i = 0; i < hdr->uriCount; i++)
+	{
+		uriEntry = &schema->uriTable.uri[i];
+		TRY(loadImageString(image, size, &uriRec[i].uriStr, &uriEntry->uriStr));
+
+		TRY(imageSection(image, size, uriRec[i].lnOffset, uriRec[i].lnCount, sizeof(struct imageLn), &section));
+		lnRec = (const struct imageLn*) section;
+		TRY(allocateImageTable(&schema->memList, uriRec[i].lnCount, sizeof(LnEntry), (void**) &uriEntry->lnTable.ln));
+		SET_IMAGE_TABLE(uriEntry->lnTable.dynArray, sizeof(LnEntry), uriRec[i].lnCount);
+		uriEntry->lnTable.count = uriRec[i].lnCount;
+		for(j = 0; j < uriRec[i].lnCount; j++)
+		{
+			lnEntry = &uriEntry->lnTable.ln[j];
+			TRY(loadImageString(image, size, &lnRec[j].lnStr, &lnEntry->lnStr));
+			lnEntry->elemGrammar = lnRec[j].elemGrammar;
+			lnEntry->typeGrammar = lnRec[j].typeGrammar;
+			if((lnEntry->elemGrammar != INDEX_MAX && lnEntry->elemGrammar >= hdr->grammarCount) ||
+					(lnEntry->typeGrammar != INDEX_MAX && lnEntry->typeGrammar >= hdr->grammarCount))
+				return EXIP_INVALID_EXIP_CONFIGURATION;
+		}
+
+		TRY(imageSection(image, size, uriRec[i].pfxOffset, uriRec[i].pfxCount, sizeof(struct imageString), &section));
+		strRec = (const struct imageString*) section;
+		TRY(allocateImageTable(&schema->memList, uriRec[i].pfxCount, sizeof(String), (void**) &uriEntry->pfxTable.pfx));
+		SET_IMAGE_TABLE(uriEntry->pfxTable.dynArray, sizeof(String), uriRec[i].pfxCount);
+		uriEntry->pfxTable.count = uriRec[i].pfxCount;
+		for(j = 0; j < uriRec[i].pfxCount; j++)
+			TRY(loadImageString(image, size, &strRec[j], &uriEntry->pfxTable.pfx[j]));
+	}
+
+	/* The grammars: the productions are used in place, once checked against the tables */
+	TRY(imageSection(image, size, hdr->ruleOffset, hdr->ruleCount, sizeof(struct imageRule), &section));
+	ruleRec = (const struct imageRule*) section;
+	TRY(allocateImageTable(&schema->memList, hdr->ruleCount, sizeof(GrammarRule), (void**) &rules));
+	for(r = 0; r < hdr->ruleCount; r++)
+	{
+		TRY(imageSection(image, size, ruleRec[r].prodOffset, ruleRec[r].pCount, sizeof(Production), &section));
+		rules[r].production = (Production*) section;
+		rules[r].pCount = ruleRec[r].pCount;
+		rules[r].meta = ruleRec[r].meta;
+		rules[r].codeBits[0] = ruleRec[r].codeBits[0];
+		rules[r].codeBits[1] = ruleRec[r].codeBits[1];
+	}
+
+	TRY(imageSection(image, size, hdr->grammarOffset, hdr->grammarCount, sizeof(struct imageGrammar), &section));
+	grRec = (const struct imageGrammar*) section;
+	TRY(allocateImageTable(&schema->memList, hdr->grammarCount, sizeof(EXIGrammar), (void**) &schema->grammarTable.grammar));
+	SET_IMAGE_TABLE(schema->grammarTable.dynArray, sizeof(EXIGrammar), hdr->grammarCount);
+	schema->grammarTable.count = hdr->grammarCount;
+
+	TRY(loadImageGrammar(&hdr->docGrammar, rules, hdr->ruleCount, &nextRule, schema, &schema->docGrammar));
+	for(i = 0; i < hdr->grammarCount; i++)
+		TRY(loadImageGrammar(&grRec[i], rules, hdr->ruleCount, &nextRule, schema, &schema->grammarTable.grammar[i]));
+	if(nextRule != hdr->ruleCount || hdr->staticGrCount > hdr->grammarCount)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+	schema->staticGrCount = hdr->staticGrCount;
+
+	/* The enumerations: the integer values are used in place */
+	TRY(imageSection(image, size, hdr->enumOffset, hdr->enumCount, sizeof(struct imageEnum), &section));
+	enumRec = (const struct imageEnum*) section;
+	TRY(allocateImageTable(&schema->memList, hdr->enumCount, sizeof(EnumDefinition), (void**) &schema->enumTable.enumDef));
+	SET_IMAGE_TABLE(schema->enumTable.dynArray, sizeof(EnumDefinition), hdr->enumCount);
+	schema->enumTable.count = hdr->enumCount;
+	for(i = 0; i < hdr->enumCount; i++)
+	{
+		enumDef = &schema->enumTable.enumDef[i];
+		enumDef->typeId = enumRec[i].typeId;
+		enumDef->count = enumRec[i].count;
+
+		if(enumDef->typeId >= schema->simpleTypeTable.count)
+			return EXIP_OUT_OF_BOUND_BUFFER;
+
+		switch(GET_EXI_TYPE(schema->simpleTypeTable.sType[enumDef->typeId].content))
+		{
+			case VALUE_TYPE_STRING:
+				TRY(imageSection(image, size, enumRec[i].valuesOffset, enumDef->count, sizeof(struct imageString), &section));
+				strRec = (const struct imageString*) section;
+				TRY(allocateImageTable(&schema->memList, enumDef->count, sizeof(String), &enumDef->values));
+				for(j = 0; j < enumDef->count; j++)
+					TRY(loadImageString(image, size, &strRec[j], &((String*) enumDef->values)[j]));
+			break;
+			case VALUE_TYPE_NON_NEGATIVE_INT:
+				TRY(imageSection(image, size, enumRec[i].valuesOffset, enumDef->count, sizeof(UnsignedInteger), &section));
+				enumDef->values = (void*) section;
+			break;
+			default:
+				return EXIP_NOT_IMPLEMENTED_YET;
+		}
+	}
+
+#if PRODUCTION_INDEX_USE
+	// Images written without the index get one keyed by the positions of their rules
+	TRY(loadImageProductionIndex(image, hdr, rules, schema));
+	if(hdr->prodIndexOffset == 0)
+		TRY(createRuleArrayIndex(rules, (Index) hdr->ruleCount, &schema->memList, &schema->prodIndex));
+#endif
+#if STRING_TABLE_INDEX_USE
+	TRY(createSchemaNameIndexes(schema));
+#endif
+
+	return EXIP_OK;
+}
+
+errorCode loadSchemaImage(const void* image, size_t size, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	const struct imageHeader* hdr = (const struct imageHeader*) image;
+	struct imageFingerprint fp;
+
+	setImageFingerprint(&fp);
+	if(((size_t) image) % SCHEMA_IMAGE_ALIGN != 0 || size < sizeof(struct imageFingerprint) || memcmp(&hdr->fp, &fp, sizeof(struct imageFingerprint)) != 0)
+		return EXIP_INVALID_EXIP_CONFIGURATION;
+
+	if(size < sizeof(struct imageHeader) || hdr->size > size)
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
+	memset(schema, 0, sizeof(EXIPSchema));
+	TRY(initAllocList(&schema->memList));
+
+	TRY_CATCH(loadImageTables((const unsigned char*) image, hdr, schema), unloadSchemaImage(schema));
+
+	return EXIP_OK;
+}
+
+void unloadSchemaImage(EXIPSchema* schema)
+{
+#if STRING_TABLE_INDEX_USE
+	SmallIndex i;
+
+	// The indexes of the string tables of the schema
+	for(i = 0; i < schema->uriTable.count; i++)
+	{
+		destroyNameIndex(&schema->uriTable.uri[i].pfxTable.index);
+		destroyNameIndex(&schema->uriTable.uri[i].lnTable.index);
+	}
+	destroyNameIndex(&schema->uriTable.index);
+#endif
+
+	freeAllocList(&schema->memList);
+}
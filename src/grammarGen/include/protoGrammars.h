@@ -97,6 +97,17 @@ errorCode addProtoRule(ProtoGrammar* pg, Index prodDim, ProtoRuleEntry** ruleEnt
  */
 errorCode addProduction(ProtoRuleEntry* ruleEntry, EventType eventType, Index typeId, QNameID qnameID, SmallIndex nonTermID);
 
+/**
+ * @brief Add a copy of a production, with a different right-hand side
+ * non-terminal, to a particular proto rule
+ *
+ * @param[in, out] ruleEntry the rule to which the production is added
+ * @param[in] prod the production copied
+ * @param[in] nonTermID of the new production
+ * @return Error handling code
+ */
+errorCode copyProduction(ProtoRuleEntry* ruleEntry, Production* prod, SmallIndex nonTermID);
+
 /**
  * @brief Create a new EXI grammar from existing proto grammar
  *
@@ -77,10 +77,8 @@ errorCode concatenateGrammars(ProtoGrammar* left, ProtoGrammar* right)
 		/* Copy the RHS productions into the new rule entry, adjusting the non terminal ID */
 		for(prodIterR = 0; prodIterR < right->rule[ruleIterR].count; prodIterR++)
 		{
-			TRY(addProduction(pRuleEntry, GET_PROD_EXI_EVENT(right->rule[ruleIterR].prod[prodIterR].content),
-										 right->rule[ruleIterR].prod[prodIterR].typeId,
-										 right->rule[ruleIterR].prod[prodIterR].qnameId,
-										 GET_PROD_NON_TERM(right->rule[ruleIterR].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[ruleIterR].prod[prodIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
+			TRY(copyProduction(pRuleEntry, &right->rule[ruleIterR].prod[prodIterR],
+												 GET_PROD_NON_TERM(right->rule[ruleIterR].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[ruleIterR].prod[prodIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
 		}
 	}
 
@@ -102,11 +100,8 @@ errorCode concatenateGrammars(ProtoGrammar* left, ProtoGrammar* right)
 						// Just copy all the production...
 						for(prodIterR = 0; prodIterR < right->rule[0].count; prodIterR++)
 						{
-							TRY(addProduction(&left->rule[ruleIterL],
-														 GET_PROD_EXI_EVENT(right->rule[0].prod[prodIterR].content),
-														 right->rule[0].prod[prodIterR].typeId,
-														 right->rule[0].prod[prodIterR].qnameId,
-														 GET_PROD_NON_TERM(right->rule[0].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[0].prod[prodIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
+							TRY(copyProduction(&left->rule[ruleIterL], &right->rule[0].prod[prodIterR],
+																 GET_PROD_NON_TERM(right->rule[0].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[0].prod[prodIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
 						}
 					}
 					else
@@ -213,9 +208,8 @@ static errorCode addProductionsToARule(ProtoGrammar* left, Index ruleIndxL, Prot
 					/* Copy the RHS productions into the new rule entry, adjusting the non terminal ID */
 					for(tmpIterR = 0; tmpIterR < right->rule[ruleIndxR].count; tmpIterR++)
 					{
-						TRY(addProduction(pRuleEntry, GET_PROD_EXI_EVENT(right->rule[ruleIndxR].prod[tmpIterR].content),
-								right->rule[ruleIndxR].prod[tmpIterR].typeId, right->rule[ruleIndxR].prod[tmpIterR].qnameId,
-													 GET_PROD_NON_TERM(right->rule[ruleIndxR].prod[tmpIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[ruleIndxR].prod[tmpIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
+						TRY(copyProduction(pRuleEntry, &right->rule[ruleIndxR].prod[tmpIterR],
+															 GET_PROD_NON_TERM(right->rule[ruleIndxR].prod[tmpIterR].content) + ((GET_PROD_EXI_EVENT(right->rule[ruleIndxR].prod[tmpIterR].content) == EVENT_EE)?0:(initialLeftRulesCount-1))));
 					}
 
 					*currRuleIndex += 1;
@@ -229,9 +223,9 @@ static errorCode addProductionsToARule(ProtoGrammar* left, Index ruleIndxL, Prot
 		{
 			/* Check for the same terminal symbol e.g. SE(qname) */
 			if(GET_PROD_EXI_EVENT(left->rule[ruleIndxL].prod[prodIterL].content) == GET_PROD_EXI_EVENT(right->rule[ruleIndxR].prod[prodIterR].content) &&
-					left->rule[ruleIndxL].prod[prodIterL].typeId == right->rule[ruleIndxR].prod[prodIterR].typeId &&
-					left->rule[ruleIndxL].prod[prodIterL].qnameId.uriId == right->rule[ruleIndxR].prod[prodIterR].qnameId.uriId &&
-					left->rule[ruleIndxL].prod[prodIterL].qnameId.lnId == right->rule[ruleIndxR].prod[prodIterR].qnameId.lnId)
+					GET_PROD_TYPE_ID(&left->rule[ruleIndxL].prod[prodIterL]) == GET_PROD_TYPE_ID(&right->rule[ruleIndxR].prod[prodIterR]) &&
+					GET_PROD_URI_ID(&left->rule[ruleIndxL].prod[prodIterL]) == GET_PROD_URI_ID(&right->rule[ruleIndxR].prod[prodIterR]) &&
+					GET_PROD_LN_ID(&left->rule[ruleIndxL].prod[prodIterL]) == GET_PROD_LN_ID(&right->rule[ruleIndxR].prod[prodIterR]))
 			{
 				/* Now check the non-terminal ID (noting that EE's don't have a non-terminal ID) */
 				if(GET_PROD_EXI_EVENT(left->rule[ruleIndxL].prod[prodIterL].content) == EVENT_EE ||
@@ -279,11 +273,8 @@ static errorCode addProductionsToARule(ProtoGrammar* left, Index ruleIndxL, Prot
 			 * We have been through all LHS productions and there were no clashes
 			 * so just add the production
 			 */
-			TRY(addProduction(&left->rule[ruleIndxL],
-										 GET_PROD_EXI_EVENT(right->rule[ruleIndxR].prod[prodIterR].content),
-										 right->rule[ruleIndxR].prod[prodIterR].typeId,
-										 right->rule[ruleIndxR].prod[prodIterR].qnameId,
-										 nonTermRight));
+			TRY(copyProduction(&left->rule[ruleIndxL], &right->rule[ruleIndxR].prod[prodIterR],
+												 nonTermRight));
 		}
 	}
 	return EXIP_OK;
@@ -446,11 +437,8 @@ errorCode createParticleGrammar(int minOccurs, int maxOccurs,
 								// Just copy all the production...
 								for(prodIterR = 0; prodIterR < termGrammar->rule[0].count; prodIterR++)
 								{
-									TRY(addProduction(&termGrammar->rule[i],
-																 GET_PROD_EXI_EVENT(termGrammar->rule[0].prod[prodIterR].content),
-																 termGrammar->rule[0].prod[prodIterR].typeId,
-																 termGrammar->rule[0].prod[prodIterR].qnameId,
-																 GET_PROD_NON_TERM(termGrammar->rule[0].prod[prodIterR].content)));
+									TRY(copyProduction(&termGrammar->rule[i], &termGrammar->rule[0].prod[prodIterR],
+																		 GET_PROD_NON_TERM(termGrammar->rule[0].prod[prodIterR].content)));
 								}
 							}
 							else
@@ -602,11 +590,8 @@ errorCode createChoiceModelGroupsGrammar(ProtoGrammarArray* pgArray, ProtoGramma
 
 			for(prodIterTerm = 0; prodIterTerm < tmpGrammar->rule[ruleIterTerm].count; prodIterTerm++)
 			{
-				TRY(addProduction(pRuleEntry,
-											 GET_PROD_EXI_EVENT(tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].content),
-											 tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].typeId,
-											 tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].qnameId,
-											 GET_PROD_NON_TERM(tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].content) + ((GET_PROD_EXI_EVENT(tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].content) == EVENT_EE)?0:(initialResultRulesCount-1))));
+				TRY(copyProduction(pRuleEntry, &tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm],
+													 GET_PROD_NON_TERM(tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].content) + ((GET_PROD_EXI_EVENT(tmpGrammar->rule[ruleIterTerm].prod[prodIterTerm].content) == EVENT_EE)?0:(initialResultRulesCount-1))));
 			}
 		}
 
@@ -620,11 +605,8 @@ errorCode createChoiceModelGroupsGrammar(ProtoGrammarArray* pgArray, ProtoGramma
 				// Just copy all the production...
 				for(prodIterR = 0; prodIterR < tmpGrammar->rule[0].count; prodIterR++)
 				{
-					TRY(addProduction(&modGrpGrammar->rule[0],
-												 GET_PROD_EXI_EVENT(tmpGrammar->rule[0].prod[prodIterR].content),
-												 tmpGrammar->rule[0].prod[prodIterR].typeId,
-												 tmpGrammar->rule[0].prod[prodIterR].qnameId,
-												 GET_PROD_NON_TERM(tmpGrammar->rule[0].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(tmpGrammar->rule[0].prod[prodIterR].content) == EVENT_EE)?0:(initialResultRulesCount-1))));
+					TRY(copyProduction(&modGrpGrammar->rule[0], &tmpGrammar->rule[0].prod[prodIterR],
+														 GET_PROD_NON_TERM(tmpGrammar->rule[0].prod[prodIterR].content) + ((GET_PROD_EXI_EVENT(tmpGrammar->rule[0].prod[prodIterR].content) == EVENT_EE)?0:(initialResultRulesCount-1))));
 				}
 			}
 			else
@@ -657,10 +639,10 @@ errorCode addEEProduction(ProtoRuleEntry* rule)
 	TRY(addEmptyDynEntry(&rule->dynArray, (void**)&prod, &prodId));
 
 	SET_PROD_EXI_EVENT(prod->content, EVENT_EE);
-	prod->typeId = INDEX_MAX;
+	SET_PROD_TYPE_ID(prod, INDEX_MAX);
 	SET_PROD_NON_TERM(prod->content, GR_VOID_NON_TERMINAL);
-	prod->qnameId.uriId = URI_MAX;
-	prod->qnameId.lnId = LN_MAX;
+	SET_PROD_URI_ID(prod, URI_MAX);
+	SET_PROD_LN_ID(prod, LN_MAX);
 
 	return EXIP_OK;
 }
@@ -726,9 +708,9 @@ static char rulesEqual(ProtoGrammar* g1, Index ruleIndx1, ProtoGrammar* g2, Inde
 		for(j = 0; j < g2->rule[ruleIndx2].count; j++)
 		{
 			if(GET_PROD_EXI_EVENT(g1->rule[ruleIndx1].prod[i].content) == GET_PROD_EXI_EVENT(g2->rule[ruleIndx2].prod[j].content) &&
-					g1->rule[ruleIndx1].prod[i].typeId == g2->rule[ruleIndx2].prod[j].typeId &&
-					g1->rule[ruleIndx1].prod[i].qnameId.uriId == g2->rule[ruleIndx2].prod[j].qnameId.uriId &&
-					g1->rule[ruleIndx1].prod[i].qnameId.lnId == g2->rule[ruleIndx2].prod[j].qnameId.lnId)
+					GET_PROD_TYPE_ID(&g1->rule[ruleIndx1].prod[i]) == GET_PROD_TYPE_ID(&g2->rule[ruleIndx2].prod[j]) &&
+					GET_PROD_URI_ID(&g1->rule[ruleIndx1].prod[i]) == GET_PROD_URI_ID(&g2->rule[ruleIndx2].prod[j]) &&
+					GET_PROD_LN_ID(&g1->rule[ruleIndx1].prod[i]) == GET_PROD_LN_ID(&g2->rule[ruleIndx2].prod[j]))
 			{
 				prodFound = TRUE;
 				break;
@@ -20,6 +20,8 @@
 #include "memManagement.h"
 #include "initSchemaInstance.h"
 #include "sTables.h"
+#include "grammars.h"
+#include "schemaRegistry.h"
 
 
 static int compareLn(const void* lnRow1, const void* lnRow2);
@@ -30,6 +32,23 @@ static int compareUri(const void* uriRow1, const void* uriRow2);
  */
 static void sortUriTable(UriTable* uriTable);
 
+/**
+ * The copies of the schema definitions of registerSchemaDefinitions()
+ */
+struct schemaDefinitions
+{
+	BinaryBuffer* buffers;
+	unsigned int bufCount;
+	SchemaFormat schemaFormat;
+	EXIOptions opt;
+	boolean hasOpt;
+	errorCode (*loadSchemaHandler) (String* namespace, String* schemaLocation, BinaryBuffer** buffers, unsigned int* bufCount, SchemaFormat* schemaFormat, EXIOptions** opt);
+};
+
+static errorCode generateDefinitions(void* data, EXIPSchema* schema);
+static void destroyGenerated(void* data, EXIPSchema* schema);
+static void destroyDefinitions(void* data);
+
 errorCode generateSchemaInformedGrammars(BinaryBuffer* buffers, unsigned int bufCount, SchemaFormat schemaFormat, EXIOptions* opt, EXIPSchema* schema,
 		errorCode (*loadSchemaHandler) (String* namespace, String* schemaLocation, BinaryBuffer** buffers, unsigned int* bufCount, SchemaFormat* schemaFormat, EXIOptions** opt))
 {
@@ -145,6 +164,15 @@ errorCode generateSchemaInformedGrammars(BinaryBuffer* buffers, unsigned int buf
 
 	EXIP_MFREE(treeT);
 
+	setSchemaCodeBits(schema);
+
+#if PRODUCTION_INDEX_USE
+	TRY(createProductionIndex(schema));
+#endif
+#if STRING_TABLE_INDEX_USE
+	TRY(createSchemaNameIndexes(schema));
+#endif
+
 	return tmp_err_code;
 }
 
@@ -158,9 +186,16 @@ void destroySchema(EXIPSchema* schema)
 	{
 		destroyDynArray(&schema->uriTable.uri[i].pfxTable.dynArray);
 		destroyDynArray(&schema->uriTable.uri[i].lnTable.dynArray);
+#if STRING_TABLE_INDEX_USE
+		destroyNameIndex(&schema->uriTable.uri[i].pfxTable.index);
+		destroyNameIndex(&schema->uriTable.uri[i].lnTable.index);
+#endif
 	}
 
 	destroyDynArray(&schema->uriTable.dynArray);
+#if STRING_TABLE_INDEX_USE
+	destroyNameIndex(&schema->uriTable.index);
+#endif
 	destroyDynArray(&schema->grammarTable.dynArray);
 	destroyDynArray(&schema->simpleTypeTable.dynArray);
 	destroyDynArray(&schema->enumTable.dynArray);
@@ -168,6 +203,79 @@ void destroySchema(EXIPSchema* schema)
 }
 
 
+errorCode registerSchemaDefinitions(SchemaRegistry* registry, const String* schemaId, BinaryBuffer* buffers, unsigned int bufCount,
+		SchemaFormat schemaFormat, EXIOptions* opt,
+		errorCode (*loadSchemaHandler) (String* namespace, String* schemaLocation, BinaryBuffer** buffers, unsigned int* bufCount, SchemaFormat* schemaFormat, EXIOptions** opt))
+{
+	SchemaSource source;
+	struct schemaDefinitions* defs;
+	unsigned int i;
+
+	defs = (struct schemaDefinitions*) EXIP_MALLOC(sizeof(struct schemaDefinitions));
+	if(defs == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	defs->buffers = (BinaryBuffer*) EXIP_MALLOC(sizeof(BinaryBuffer)*bufCount);
+	if(defs->buffers == NULL)
+	{
+		EXIP_MFREE(defs);
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+	}
+
+	for(defs->bufCount = 0; defs->bufCount < bufCount; defs->bufCount++)
+	{
+		i = defs->bufCount;
+		defs->buffers[i].buf = EXIP_MALLOC(buffers[i].bufContent);
+		if(defs->buffers[i].buf == NULL)
+		{
+			destroyDefinitions(defs);
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		}
+		memcpy(defs->buffers[i].buf, buffers[i].buf, buffers[i].bufContent);
+		defs->buffers[i].bufLen = buffers[i].bufContent;
+		defs->buffers[i].bufContent = buffers[i].bufContent;
+		defs->buffers[i].ioStrm.readWriteToStream = NULL;
+		defs->buffers[i].ioStrm.stream = NULL;
+	}
+
+	defs->schemaFormat = schemaFormat;
+	defs->hasOpt = opt != NULL;
+	if(opt != NULL)
+		defs->opt = *opt;
+	defs->loadSchemaHandler = loadSchemaHandler;
+
+	source.load = generateDefinitions;
+	source.unload = destroyGenerated;
+	source.destroy = destroyDefinitions;
+	source.data = defs;
+
+	return registerSchemaSource(registry, schemaId, source);
+}
+
+static errorCode generateDefinitions(void* data, EXIPSchema* schema)
+{
+	struct schemaDefinitions* defs = (struct schemaDefinitions*) data;
+
+	return generateSchemaInformedGrammars(defs->buffers, defs->bufCount, defs->schemaFormat,
+			defs->hasOpt ? &defs->opt : NULL, schema, defs->loadSchemaHandler);
+}
+
+static void destroyGenerated(void* data, EXIPSchema* schema)
+{
+	destroySchema(schema);
+}
+
+static void destroyDefinitions(void* data)
+{
+	struct schemaDefinitions* defs = (struct schemaDefinitions*) data;
+	unsigned int i;
+
+	for(i = 0; i < defs->bufCount; i++)
+		EXIP_MFREE(defs->buffers[i].buf);
+	EXIP_MFREE(defs->buffers);
+	EXIP_MFREE(defs);
+}
+
 static int compareLn(const void* lnRow1, const void* lnRow2)
 {
 	LnEntry* lnEntry1 = (LnEntry*)lnRow1;
@@ -212,6 +320,9 @@ static void sortUriTable(UriTable* uriTable)
 
 		if(uriTable->uri[i].lnTable.ln != NULL)
 			qsort(&uriTable->uri[i].lnTable.ln[initialEntries], uriTable->uri[i].lnTable.count - initialEntries, sizeof(LnEntry), compareLn);
+#if STRING_TABLE_INDEX_USE
+		destroyNameIndex(&uriTable->uri[i].lnTable.index);
+#endif
 	}
 
 	// Then sort the uri tables
@@ -222,4 +333,7 @@ static void sortUriTable(UriTable* uriTable)
 	//	URI	2	"http://www.w3.org/2001/XMLSchema-instance"
 	//	URI	3	"http://www.w3.org/2001/XMLSchema"
 	qsort(&uriTable->uri[4], uriTable->count - 4, sizeof(UriEntry), compareUri);
+#if STRING_TABLE_INDEX_USE
+	destroyNameIndex(&uriTable->index);
+#endif
 }
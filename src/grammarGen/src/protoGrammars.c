@@ -45,11 +45,29 @@ errorCode addProduction(ProtoRuleEntry* ruleEntry, EventType eventType, Index ty
 	Production *newProd;
 	Index newProdId;
 
+	// The indices of a compact production are narrower than Index
+	if(!PROD_IDS_FIT(typeId, qnameID))
+		return EXIP_OUT_OF_BOUND_BUFFER;
+
 	TRY(addEmptyDynEntry(&ruleEntry->dynArray, (void**)&newProd, &newProdId));
 
 	SET_PROD_EXI_EVENT(newProd->content, eventType);
-	newProd->typeId = typeId;
-	newProd->qnameId = qnameID;
+	SET_PROD_TYPE_ID(newProd, typeId);
+	SET_PROD_QNAME_ID(newProd, qnameID);
+	SET_PROD_NON_TERM(newProd->content, nonTermID);
+
+	return EXIP_OK;
+}
+
+errorCode copyProduction(ProtoRuleEntry* ruleEntry, Production* prod, SmallIndex nonTermID)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Production *newProd;
+	Index newProdId;
+
+	TRY(addEmptyDynEntry(&ruleEntry->dynArray, (void**)&newProd, &newProdId));
+
+	*newProd = *prod;
 	SET_PROD_NON_TERM(newProd->content, nonTermID);
 
 	return EXIP_OK;
@@ -116,7 +134,7 @@ errorCode cloneProtoGrammar(ProtoGrammar* src, ProtoGrammar* dest)
 
 		for (j = 0; j < src->rule[i].count; j++)
 		{
-			TRY(addProduction(pRuleEntry, GET_PROD_EXI_EVENT(src->rule[i].prod[j].content), src->rule[i].prod[j].typeId, src->rule[i].prod[j].qnameId, GET_PROD_NON_TERM(src->rule[i].prod[j].content)));
+			TRY(copyProduction(pRuleEntry, &src->rule[i].prod[j], GET_PROD_NON_TERM(src->rule[i].prod[j].content)));
 		}
 	}
 
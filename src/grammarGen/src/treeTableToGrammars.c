@@ -26,8 +26,8 @@
 
 // TODO: check if this empty grammar is needed?
 //       Also this is platform dependent and must be fixed! - maybe auto-generation?
-static Production static_grammar_prod_empty[1] = {{0x28FFFFFF, INDEX_MAX, {URI_MAX, LN_MAX}}};
-static GrammarRule static_grammar_rule_empty[1] = {{static_grammar_prod_empty, 1, 0x01}};
+static Production static_grammar_prod_empty[1] = {{0x28FFFFFF, PROD_TYPE_ID_MAX, {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}};
+static GrammarRule static_grammar_rule_empty[1] = {{static_grammar_prod_empty, 1, 0x01, {1, 2}}};
 static EXIGrammar static_grammar_empty = {static_grammar_rule_empty, 0x42000000, 1};
 
 /** It is used by compareAttrUse(), compareProductions() and compareGlobalElemQName() functions */
@@ -381,17 +381,6 @@ errorCode convertTreeTablesToExipSchema(TreeTable* treeT, unsigned int count, EX
 	schema->staticGrCount = schema->grammarTable.count;
 	freeAllocList(&ctx.tmpMemList);
 
-	// Assign the chunkEntries for URL and LN tables to their entries count
-	// so it is known how many are the static ones from the schema
-	// after more are added.
-	schema->uriTable.dynArray.chunkEntries = schema->uriTable.count;
-
-	for(i = 0; i < schema->uriTable.count; i++)
-	{
-		schema->uriTable.uri[i].lnTable.dynArray.chunkEntries = schema->uriTable.uri[i].lnTable.count;
-		schema->uriTable.uri[i].pfxTable.dynArray.chunkEntries = schema->uriTable.uri[i].pfxTable.count;
-	}
-
 	return tmp_err_code;
 }
 
@@ -413,8 +402,12 @@ static int compareAttrUse(const void* attrPG1, const void* attrPG2)
 {
 	ProtoGrammar** a1 = (ProtoGrammar**) attrPG1;
 	ProtoGrammar** a2 = (ProtoGrammar**) attrPG2;
+	QNameID q1, q2;
+
+	GET_PROD_QNAME_ID(&(*a1)->rule[0].prod[0], q1);
+	GET_PROD_QNAME_ID(&(*a2)->rule[0].prod[0], q2);
 
-	return compareQNameID(&((*a1)->rule[0].prod[0].qnameId), &((*a2)->rule[0].prod[0].qnameId), &globalSchemaPtr->uriTable);
+	return compareQNameID(&q1, &q2, &globalSchemaPtr->uriTable);
 }
 
 static void sortAttributeUseGrammars(ProtoGrammarArray* attrUseArray)
@@ -2018,7 +2011,7 @@ static errorCode getTypeId(BuildContext* ctx, const QNameID typeQnameId, Qualifi
 
 		}
 
-		*typeId = (GET_TYPE_GRAMMAR_QNAMEID(ctx->schema, typeQnameId))->rule[0].production[0].typeId;
+		*typeId = GET_PROD_TYPE_ID(&(GET_TYPE_GRAMMAR_QNAMEID(ctx->schema, typeQnameId))->rule[0].production[0]);
 		if(*typeId == INDEX_MAX)
 			return EXIP_UNEXPECTED_ERROR;
 	}
@@ -2047,7 +2040,7 @@ static errorCode getAnonymousTypeId(BuildContext* ctx, QualifiedTreeTableEntry*
 	if(tmpGr == NULL)
 		return EXIP_UNEXPECTED_ERROR;
 
-	*typeId = tmpGr->rule[0].prod[0].typeId;
+	*typeId = GET_PROD_TYPE_ID(&tmpGr->rule[0].prod[0]);
 
 	destroyProtoGrammar(tmpGr);
 
@@ -2160,7 +2153,7 @@ static errorCode storeGrammar(BuildContext* ctx, QNameID qnameID, ProtoGrammar*
 		DEBUG_MSG(INFO, DEBUG_GRAMMAR_GEN, ("]:"));
 		for(t = 0; t < exiGr.count; t++)
 		{
-			TRY(printGrammarRule(t, &(exiGr.rule[t]), ctx->schema));
+			TRY(printGrammarRule(t, &(exiGr.rule[t]), ctx->schema, &ctx->schema->uriTable));
 		}
 	}
 #endif
@@ -2222,15 +2215,19 @@ static int compareProductions(const void* prod1, const void* prod2)
 	{
 		if(GET_PROD_EXI_EVENT(p1->content) == EVENT_AT_QNAME)
 		{
-			return -compareQNameID(&(p1->qnameId), &(p2->qnameId), &globalSchemaPtr->uriTable);
+			QNameID q1, q2;
+
+			GET_PROD_QNAME_ID(p1, q1);
+			GET_PROD_QNAME_ID(p2, q2);
+			return -compareQNameID(&q1, &q2, &globalSchemaPtr->uriTable);
 		}
 		else if(GET_PROD_EXI_EVENT(p1->content) == EVENT_AT_URI)
 		{
-			if(p1->qnameId.uriId < p2->qnameId.uriId)
+			if(GET_PROD_URI_ID(p1) < GET_PROD_URI_ID(p2))
 			{
 				return 1;
 			}
-			else if(p1->qnameId.uriId > p2->qnameId.uriId)
+			else if(GET_PROD_URI_ID(p1) > GET_PROD_URI_ID(p2))
 			{
 				return -1;
 			}
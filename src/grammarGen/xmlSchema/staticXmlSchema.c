@@ -208,966 +208,966 @@ static CONST Production xmlscm_prod_0_0[1] =
 {
     {
         838860801, 0,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_0_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_0[2] =
 {
-    {xmlscm_prod_0_0, 1, 0},
-    {xmlscm_prod_0_1, 1, 1}
+    {xmlscm_prod_0_0, 1, 0, {1, 2}},
+    {xmlscm_prod_0_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_1_0[1] =
 {
     {
         838860801, 1,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_1_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_1[2] =
 {
-    {xmlscm_prod_1_0, 1, 0},
-    {xmlscm_prod_1_1, 1, 1}
+    {xmlscm_prod_1_0, 1, 0, {1, 2}},
+    {xmlscm_prod_1_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_2_0[1] =
 {
     {
         838860801, 2,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_2_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_2[2] =
 {
-    {xmlscm_prod_2_0, 1, 0},
-    {xmlscm_prod_2_1, 1, 1}
+    {xmlscm_prod_2_0, 1, 0, {1, 2}},
+    {xmlscm_prod_2_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_3_0[1] =
 {
     {
         838860801, 3,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_3_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_3[2] =
 {
-    {xmlscm_prod_3_0, 1, 0},
-    {xmlscm_prod_3_1, 1, 1}
+    {xmlscm_prod_3_0, 1, 0, {1, 2}},
+    {xmlscm_prod_3_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_4_0[1] =
 {
     {
         838860801, 4,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_4_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_4[2] =
 {
-    {xmlscm_prod_4_0, 1, 0},
-    {xmlscm_prod_4_1, 1, 1}
+    {xmlscm_prod_4_0, 1, 0, {1, 2}},
+    {xmlscm_prod_4_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_5_0[1] =
 {
     {
         838860801, 5,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_5_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_5[2] =
 {
-    {xmlscm_prod_5_0, 1, 0},
-    {xmlscm_prod_5_1, 1, 1}
+    {xmlscm_prod_5_0, 1, 0, {1, 2}},
+    {xmlscm_prod_5_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_6_0[1] =
 {
     {
         838860801, 6,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_6_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_6[2] =
 {
-    {xmlscm_prod_6_0, 1, 0},
-    {xmlscm_prod_6_1, 1, 1}
+    {xmlscm_prod_6_0, 1, 0, {1, 2}},
+    {xmlscm_prod_6_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_7_0[1] =
 {
     {
         838860801, 7,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_7_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_7[2] =
 {
-    {xmlscm_prod_7_0, 1, 0},
-    {xmlscm_prod_7_1, 1, 1}
+    {xmlscm_prod_7_0, 1, 0, {1, 2}},
+    {xmlscm_prod_7_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_8_0[1] =
 {
     {
         838860801, 8,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_8_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_8[2] =
 {
-    {xmlscm_prod_8_0, 1, 0},
-    {xmlscm_prod_8_1, 1, 1}
+    {xmlscm_prod_8_0, 1, 0, {1, 2}},
+    {xmlscm_prod_8_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_9_0[1] =
 {
     {
         838860801, 9,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_9_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_9[2] =
 {
-    {xmlscm_prod_9_0, 1, 0},
-    {xmlscm_prod_9_1, 1, 1}
+    {xmlscm_prod_9_0, 1, 0, {1, 2}},
+    {xmlscm_prod_9_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_10_0[1] =
 {
     {
         838860801, 10,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_10_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_10[2] =
 {
-    {xmlscm_prod_10_0, 1, 0},
-    {xmlscm_prod_10_1, 1, 1}
+    {xmlscm_prod_10_0, 1, 0, {1, 2}},
+    {xmlscm_prod_10_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_11_0[1] =
 {
     {
         838860801, 11,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_11_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_11[2] =
 {
-    {xmlscm_prod_11_0, 1, 0},
-    {xmlscm_prod_11_1, 1, 1}
+    {xmlscm_prod_11_0, 1, 0, {1, 2}},
+    {xmlscm_prod_11_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_12_0[4] =
 {
     {
-        838860801, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860801, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_12_1[3] =
 {
     {
-        838860801, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860801, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_12[2] =
 {
-    {xmlscm_prod_12_0, 4, 1},
-    {xmlscm_prod_12_1, 3, 1}
+    {xmlscm_prod_12_0, 4, 1, {3, 4}},
+    {xmlscm_prod_12_1, 3, 1, {3, 3}}
 };
 
 static CONST Production xmlscm_prod_13_0[1] =
 {
     {
         838860801, 13,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_13_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_13[2] =
 {
-    {xmlscm_prod_13_0, 1, 0},
-    {xmlscm_prod_13_1, 1, 1}
+    {xmlscm_prod_13_0, 1, 0, {1, 2}},
+    {xmlscm_prod_13_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_14_0[1] =
 {
     {
         838860801, 14,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_14_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_14[2] =
 {
-    {xmlscm_prod_14_0, 1, 0},
-    {xmlscm_prod_14_1, 1, 1}
+    {xmlscm_prod_14_0, 1, 0, {1, 2}},
+    {xmlscm_prod_14_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_15_0[1] =
 {
     {
         838860801, 15,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_15_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_15[2] =
 {
-    {xmlscm_prod_15_0, 1, 0},
-    {xmlscm_prod_15_1, 1, 1}
+    {xmlscm_prod_15_0, 1, 0, {1, 2}},
+    {xmlscm_prod_15_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_16_0[1] =
 {
     {
         838860801, 16,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_16_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_16[2] =
 {
-    {xmlscm_prod_16_0, 1, 0},
-    {xmlscm_prod_16_1, 1, 1}
+    {xmlscm_prod_16_0, 1, 0, {1, 2}},
+    {xmlscm_prod_16_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_17_0[1] =
 {
     {
         838860801, 17,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_17_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_17[2] =
 {
-    {xmlscm_prod_17_0, 1, 0},
-    {xmlscm_prod_17_1, 1, 1}
+    {xmlscm_prod_17_0, 1, 0, {1, 2}},
+    {xmlscm_prod_17_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_18_0[1] =
 {
     {
         838860801, 18,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_18_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_18[2] =
 {
-    {xmlscm_prod_18_0, 1, 0},
-    {xmlscm_prod_18_1, 1, 1}
+    {xmlscm_prod_18_0, 1, 0, {1, 2}},
+    {xmlscm_prod_18_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_19_0[1] =
 {
     {
         838860801, 19,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_19_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_19[2] =
 {
-    {xmlscm_prod_19_0, 1, 0},
-    {xmlscm_prod_19_1, 1, 1}
+    {xmlscm_prod_19_0, 1, 0, {1, 2}},
+    {xmlscm_prod_19_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_20_0[1] =
 {
     {
         838860801, 20,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_20_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_20[2] =
 {
-    {xmlscm_prod_20_0, 1, 0},
-    {xmlscm_prod_20_1, 1, 1}
+    {xmlscm_prod_20_0, 1, 0, {1, 2}},
+    {xmlscm_prod_20_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_21_0[1] =
 {
     {
         838860801, 21,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_21_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_21[2] =
 {
-    {xmlscm_prod_21_0, 1, 0},
-    {xmlscm_prod_21_1, 1, 1}
+    {xmlscm_prod_21_0, 1, 0, {1, 2}},
+    {xmlscm_prod_21_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_22_0[1] =
 {
     {
         838860801, 22,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_22_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_22[2] =
 {
-    {xmlscm_prod_22_0, 1, 0},
-    {xmlscm_prod_22_1, 1, 1}
+    {xmlscm_prod_22_0, 1, 0, {1, 2}},
+    {xmlscm_prod_22_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_23_0[1] =
 {
     {
         838860801, 23,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_23_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_23[2] =
 {
-    {xmlscm_prod_23_0, 1, 0},
-    {xmlscm_prod_23_1, 1, 1}
+    {xmlscm_prod_23_0, 1, 0, {1, 2}},
+    {xmlscm_prod_23_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_24_0[1] =
 {
     {
         838860801, 24,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_24_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_24[2] =
 {
-    {xmlscm_prod_24_0, 1, 0},
-    {xmlscm_prod_24_1, 1, 1}
+    {xmlscm_prod_24_0, 1, 0, {1, 2}},
+    {xmlscm_prod_24_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_25_0[1] =
 {
     {
         838860801, 25,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_25_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_25[2] =
 {
-    {xmlscm_prod_25_0, 1, 0},
-    {xmlscm_prod_25_1, 1, 1}
+    {xmlscm_prod_25_0, 1, 0, {1, 2}},
+    {xmlscm_prod_25_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_26_0[1] =
 {
     {
         838860801, 26,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_26_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_26[2] =
 {
-    {xmlscm_prod_26_0, 1, 0},
-    {xmlscm_prod_26_1, 1, 1}
+    {xmlscm_prod_26_0, 1, 0, {1, 2}},
+    {xmlscm_prod_26_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_27_0[1] =
 {
     {
         838860801, 27,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_27_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_27[2] =
 {
-    {xmlscm_prod_27_0, 1, 0},
-    {xmlscm_prod_27_1, 1, 1}
+    {xmlscm_prod_27_0, 1, 0, {1, 2}},
+    {xmlscm_prod_27_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_28_0[1] =
 {
     {
         838860801, 28,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_28_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_28[2] =
 {
-    {xmlscm_prod_28_0, 1, 0},
-    {xmlscm_prod_28_1, 1, 1}
+    {xmlscm_prod_28_0, 1, 0, {1, 2}},
+    {xmlscm_prod_28_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_29_0[1] =
 {
     {
         838860801, 29,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_29_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_29[2] =
 {
-    {xmlscm_prod_29_0, 1, 0},
-    {xmlscm_prod_29_1, 1, 1}
+    {xmlscm_prod_29_0, 1, 0, {1, 2}},
+    {xmlscm_prod_29_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_30_0[1] =
 {
     {
         838860801, 30,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_30_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_30[2] =
 {
-    {xmlscm_prod_30_0, 1, 0},
-    {xmlscm_prod_30_1, 1, 1}
+    {xmlscm_prod_30_0, 1, 0, {1, 2}},
+    {xmlscm_prod_30_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_31_0[1] =
 {
     {
         838860801, 31,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_31_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_31[2] =
 {
-    {xmlscm_prod_31_0, 1, 0},
-    {xmlscm_prod_31_1, 1, 1}
+    {xmlscm_prod_31_0, 1, 0, {1, 2}},
+    {xmlscm_prod_31_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_32_0[1] =
 {
     {
         838860801, 32,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_32_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_32[2] =
 {
-    {xmlscm_prod_32_0, 1, 0},
-    {xmlscm_prod_32_1, 1, 1}
+    {xmlscm_prod_32_0, 1, 0, {1, 2}},
+    {xmlscm_prod_32_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_33_0[1] =
 {
     {
         838860801, 33,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_33_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_33[2] =
 {
-    {xmlscm_prod_33_0, 1, 0},
-    {xmlscm_prod_33_1, 1, 1}
+    {xmlscm_prod_33_0, 1, 0, {1, 2}},
+    {xmlscm_prod_33_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_34_0[1] =
 {
     {
         838860801, 34,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_34_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_34[2] =
 {
-    {xmlscm_prod_34_0, 1, 0},
-    {xmlscm_prod_34_1, 1, 1}
+    {xmlscm_prod_34_0, 1, 0, {1, 2}},
+    {xmlscm_prod_34_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_35_0[1] =
 {
     {
         838860801, 35,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_35_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_35[2] =
 {
-    {xmlscm_prod_35_0, 1, 0},
-    {xmlscm_prod_35_1, 1, 1}
+    {xmlscm_prod_35_0, 1, 0, {1, 2}},
+    {xmlscm_prod_35_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_36_0[1] =
 {
     {
         838860801, 36,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_36_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_36[2] =
 {
-    {xmlscm_prod_36_0, 1, 0},
-    {xmlscm_prod_36_1, 1, 1}
+    {xmlscm_prod_36_0, 1, 0, {1, 2}},
+    {xmlscm_prod_36_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_37_0[1] =
 {
     {
         838860801, 37,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_37_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_37[2] =
 {
-    {xmlscm_prod_37_0, 1, 0},
-    {xmlscm_prod_37_1, 1, 1}
+    {xmlscm_prod_37_0, 1, 0, {1, 2}},
+    {xmlscm_prod_37_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_38_0[1] =
 {
     {
         838860801, 38,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_38_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_38[2] =
 {
-    {xmlscm_prod_38_0, 1, 0},
-    {xmlscm_prod_38_1, 1, 1}
+    {xmlscm_prod_38_0, 1, 0, {1, 2}},
+    {xmlscm_prod_38_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_39_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_39_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_39[2] =
 {
-    {xmlscm_prod_39_0, 1, 0},
-    {xmlscm_prod_39_1, 1, 1}
+    {xmlscm_prod_39_0, 1, 0, {1, 2}},
+    {xmlscm_prod_39_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_40_0[1] =
 {
     {
         838860801, 40,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_40_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_40[2] =
 {
-    {xmlscm_prod_40_0, 1, 0},
-    {xmlscm_prod_40_1, 1, 1}
+    {xmlscm_prod_40_0, 1, 0, {1, 2}},
+    {xmlscm_prod_40_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_41_0[1] =
 {
     {
         838860801, 41,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_41_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_41[2] =
 {
-    {xmlscm_prod_41_0, 1, 0},
-    {xmlscm_prod_41_1, 1, 1}
+    {xmlscm_prod_41_0, 1, 0, {1, 2}},
+    {xmlscm_prod_41_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_42_0[1] =
 {
     {
         838860801, 42,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_42_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_42[2] =
 {
-    {xmlscm_prod_42_0, 1, 0},
-    {xmlscm_prod_42_1, 1, 1}
+    {xmlscm_prod_42_0, 1, 0, {1, 2}},
+    {xmlscm_prod_42_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_43_0[1] =
 {
     {
         838860801, 43,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_43_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_43[2] =
 {
-    {xmlscm_prod_43_0, 1, 0},
-    {xmlscm_prod_43_1, 1, 1}
+    {xmlscm_prod_43_0, 1, 0, {1, 2}},
+    {xmlscm_prod_43_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_44_0[1] =
 {
     {
         838860801, 44,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_44_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_44[2] =
 {
-    {xmlscm_prod_44_0, 1, 0},
-    {xmlscm_prod_44_1, 1, 1}
+    {xmlscm_prod_44_0, 1, 0, {1, 2}},
+    {xmlscm_prod_44_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_45_0[1] =
 {
     {
         838860801, 45,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_45_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_45[2] =
 {
-    {xmlscm_prod_45_0, 1, 0},
-    {xmlscm_prod_45_1, 1, 1}
+    {xmlscm_prod_45_0, 1, 0, {1, 2}},
+    {xmlscm_prod_45_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_46_0[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_46[1] =
 {
-    {xmlscm_prod_46_0, 2, 3}
+    {xmlscm_prod_46_0, 2, 3, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_47_0[5] =
 {
     {
-        838860802, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860802, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870914, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870914, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 13,
         {0, 25}}
@@ -1176,53 +1176,53 @@ static CONST Production xmlscm_prod_47_0[5] =
 static CONST Production xmlscm_prod_47_1[4] =
 {
     {
-        838860802, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860802, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870914, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870914, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_47_2[3] =
 {
     {
-        838860802, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860802, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870914, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870914, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_47[3] =
 {
-    {xmlscm_prod_47_0, 5, 5},
-    {xmlscm_prod_47_1, 4, 3},
-    {xmlscm_prod_47_2, 3, 1}
+    {xmlscm_prod_47_0, 5, 5, {4, 4}},
+    {xmlscm_prod_47_1, 4, 3, {3, 4}},
+    {xmlscm_prod_47_2, 3, 1, {3, 3}}
 };
 
 static CONST Production xmlscm_prod_48_0[6] =
 {
     {
-        838860803, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860803, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870915, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870915, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 25}},
@@ -1234,17 +1234,17 @@ static CONST Production xmlscm_prod_48_0[6] =
 static CONST Production xmlscm_prod_48_1[5] =
 {
     {
-        838860803, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860803, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870915, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870915, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 25}}
@@ -1253,45 +1253,45 @@ static CONST Production xmlscm_prod_48_1[5] =
 static CONST Production xmlscm_prod_48_2[4] =
 {
     {
-        838860803, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860803, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870915, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870915, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_48_3[3] =
 {
     {
-        838860803, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        838860803, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
-        536870915, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        536870915, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_48[4] =
 {
-    {xmlscm_prod_48_0, 6, 7},
-    {xmlscm_prod_48_1, 5, 5},
-    {xmlscm_prod_48_2, 4, 3},
-    {xmlscm_prod_48_3, 3, 1}
+    {xmlscm_prod_48_0, 6, 7, {4, 4}},
+    {xmlscm_prod_48_1, 5, 5, {4, 4}},
+    {xmlscm_prod_48_2, 4, 3, {3, 4}},
+    {xmlscm_prod_48_3, 3, 1, {3, 3}}
 };
 
 static CONST Production xmlscm_prod_49_0[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 48,
         {3, 67}},
@@ -1299,8 +1299,8 @@ static CONST Production xmlscm_prod_49_0[5] =
         503316482, 47,
         {3, 53}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -1309,8 +1309,8 @@ static CONST Production xmlscm_prod_49_0[5] =
 static CONST Production xmlscm_prod_49_1[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 48,
         {3, 67}},
@@ -1318,15 +1318,15 @@ static CONST Production xmlscm_prod_49_1[4] =
         503316482, 47,
         {3, 53}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_49_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 48,
         {3, 67}},
@@ -1338,8 +1338,8 @@ static CONST Production xmlscm_prod_49_2[3] =
 static CONST Production xmlscm_prod_49_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 48,
         {3, 67}},
@@ -1350,23 +1350,23 @@ static CONST Production xmlscm_prod_49_3[3] =
 
 static CONST GrammarRule xmlscm_rule_49[4] =
 {
-    {xmlscm_prod_49_0, 5, 5},
-    {xmlscm_prod_49_1, 4, 3},
-    {xmlscm_prod_49_2, 3, 1},
-    {xmlscm_prod_49_3, 3, 1}
+    {xmlscm_prod_49_0, 5, 5, {4, 4}},
+    {xmlscm_prod_49_1, 4, 3, {3, 4}},
+    {xmlscm_prod_49_2, 3, 1, {3, 3}},
+    {xmlscm_prod_49_3, 3, 1, {3, 3}}
 };
 
 static CONST Production xmlscm_prod_50_0[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316482, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -1375,155 +1375,155 @@ static CONST Production xmlscm_prod_50_0[4] =
 static CONST Production xmlscm_prod_50_1[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316482, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_50_2[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_50[3] =
 {
-    {xmlscm_prod_50_0, 4, 5},
-    {xmlscm_prod_50_1, 3, 3},
-    {xmlscm_prod_50_2, 1, 1}
+    {xmlscm_prod_50_0, 4, 5, {3, 4}},
+    {xmlscm_prod_50_1, 3, 3, {3, 3}},
+    {xmlscm_prod_50_2, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_51_0[1] =
 {
     {
         838860801, 46,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_51_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_51[2] =
 {
-    {xmlscm_prod_51_0, 1, 0},
-    {xmlscm_prod_51_1, 1, 1}
+    {xmlscm_prod_51_0, 1, 0, {1, 2}},
+    {xmlscm_prod_51_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_52_0[1] =
 {
     {
         838860801, 47,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_52_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_52[2] =
 {
-    {xmlscm_prod_52_0, 1, 0},
-    {xmlscm_prod_52_1, 1, 1}
+    {xmlscm_prod_52_0, 1, 0, {1, 2}},
+    {xmlscm_prod_52_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_53_0[1] =
 {
     {
         838860801, 48,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_53_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_53[2] =
 {
-    {xmlscm_prod_53_0, 1, 0},
-    {xmlscm_prod_53_1, 1, 1}
+    {xmlscm_prod_53_0, 1, 0, {1, 2}},
+    {xmlscm_prod_53_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_54_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_54_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_54[2] =
 {
-    {xmlscm_prod_54_0, 1, 0},
-    {xmlscm_prod_54_1, 1, 1}
+    {xmlscm_prod_54_0, 1, 0, {1, 2}},
+    {xmlscm_prod_54_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_55_0[1] =
 {
     {
         838860801, 49,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_55_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_55[2] =
 {
-    {xmlscm_prod_55_0, 1, 0},
-    {xmlscm_prod_55_1, 1, 1}
+    {xmlscm_prod_55_0, 1, 0, {1, 2}},
+    {xmlscm_prod_55_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_56_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_56_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_56[2] =
 {
-    {xmlscm_prod_56_0, 1, 0},
-    {xmlscm_prod_56_1, 1, 1}
+    {xmlscm_prod_56_0, 1, 0, {1, 2}},
+    {xmlscm_prod_56_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_57_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 24}},
@@ -1535,8 +1535,8 @@ static CONST Production xmlscm_prod_57_0[3] =
 static CONST Production xmlscm_prod_57_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 24}}
@@ -1545,42 +1545,42 @@ static CONST Production xmlscm_prod_57_1[2] =
 static CONST Production xmlscm_prod_57_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_57_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_57[4] =
 {
-    {xmlscm_prod_57_0, 3, 6},
-    {xmlscm_prod_57_1, 2, 4},
-    {xmlscm_prod_57_2, 3, 3},
-    {xmlscm_prod_57_3, 1, 1}
+    {xmlscm_prod_57_0, 3, 6, {3, 3}},
+    {xmlscm_prod_57_1, 2, 4, {2, 3}},
+    {xmlscm_prod_57_2, 3, 3, {3, 3}},
+    {xmlscm_prod_57_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_58_0[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 13,
         {0, 24}},
@@ -1595,14 +1595,14 @@ static CONST Production xmlscm_prod_58_0[6] =
 static CONST Production xmlscm_prod_58_1[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 13,
         {0, 24}},
@@ -1614,14 +1614,14 @@ static CONST Production xmlscm_prod_58_1[5] =
 static CONST Production xmlscm_prod_58_2[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 13,
         {0, 24}}
@@ -1630,37 +1630,37 @@ static CONST Production xmlscm_prod_58_2[4] =
 static CONST Production xmlscm_prod_58_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_58_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_58[5] =
 {
-    {xmlscm_prod_58_0, 6, 9},
-    {xmlscm_prod_58_1, 5, 7},
-    {xmlscm_prod_58_2, 4, 5},
-    {xmlscm_prod_58_3, 3, 3},
-    {xmlscm_prod_58_4, 1, 1}
+    {xmlscm_prod_58_0, 6, 9, {4, 4}},
+    {xmlscm_prod_58_1, 5, 7, {4, 4}},
+    {xmlscm_prod_58_2, 4, 5, {3, 4}},
+    {xmlscm_prod_58_3, 3, 3, {3, 3}},
+    {xmlscm_prod_58_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_59_0[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1704,8 +1704,8 @@ static CONST Production xmlscm_prod_59_0[18] =
         503316483, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}},
@@ -1717,8 +1717,8 @@ static CONST Production xmlscm_prod_59_0[18] =
 static CONST Production xmlscm_prod_59_1[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1762,8 +1762,8 @@ static CONST Production xmlscm_prod_59_1[17] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -1772,8 +1772,8 @@ static CONST Production xmlscm_prod_59_1[17] =
 static CONST Production xmlscm_prod_59_2[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1817,15 +1817,15 @@ static CONST Production xmlscm_prod_59_2[16] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_59_3[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1870,8 +1870,8 @@ static CONST Production xmlscm_prod_59_3[14] =
 static CONST Production xmlscm_prod_59_4[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1913,8 +1913,8 @@ static CONST Production xmlscm_prod_59_4[13] =
 static CONST Production xmlscm_prod_59_5[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1956,8 +1956,8 @@ static CONST Production xmlscm_prod_59_5[13] =
 static CONST Production xmlscm_prod_59_6[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -1999,8 +1999,8 @@ static CONST Production xmlscm_prod_59_6[13] =
 static CONST Production xmlscm_prod_59_7[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2042,8 +2042,8 @@ static CONST Production xmlscm_prod_59_7[13] =
 static CONST Production xmlscm_prod_59_8[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2085,8 +2085,8 @@ static CONST Production xmlscm_prod_59_8[13] =
 static CONST Production xmlscm_prod_59_9[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2128,8 +2128,8 @@ static CONST Production xmlscm_prod_59_9[13] =
 static CONST Production xmlscm_prod_59_10[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2171,8 +2171,8 @@ static CONST Production xmlscm_prod_59_10[13] =
 static CONST Production xmlscm_prod_59_11[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2214,8 +2214,8 @@ static CONST Production xmlscm_prod_59_11[13] =
 static CONST Production xmlscm_prod_59_12[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2257,8 +2257,8 @@ static CONST Production xmlscm_prod_59_12[13] =
 static CONST Production xmlscm_prod_59_13[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2300,8 +2300,8 @@ static CONST Production xmlscm_prod_59_13[13] =
 static CONST Production xmlscm_prod_59_14[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2343,8 +2343,8 @@ static CONST Production xmlscm_prod_59_14[13] =
 static CONST Production xmlscm_prod_59_15[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2386,8 +2386,8 @@ static CONST Production xmlscm_prod_59_15[13] =
 static CONST Production xmlscm_prod_59_16[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 68,
         {3, 109}},
@@ -2428,23 +2428,23 @@ static CONST Production xmlscm_prod_59_16[13] =
 
 static CONST GrammarRule xmlscm_rule_59[17] =
 {
-    {xmlscm_prod_59_0, 18, 7},
-    {xmlscm_prod_59_1, 17, 5},
-    {xmlscm_prod_59_2, 16, 3},
-    {xmlscm_prod_59_3, 14, 1},
-    {xmlscm_prod_59_4, 13, 1},
-    {xmlscm_prod_59_5, 13, 1},
-    {xmlscm_prod_59_6, 13, 1},
-    {xmlscm_prod_59_7, 13, 1},
-    {xmlscm_prod_59_8, 13, 1},
-    {xmlscm_prod_59_9, 13, 1},
-    {xmlscm_prod_59_10, 13, 1},
-    {xmlscm_prod_59_11, 13, 1},
-    {xmlscm_prod_59_12, 13, 1},
-    {xmlscm_prod_59_13, 13, 1},
-    {xmlscm_prod_59_14, 13, 1},
-    {xmlscm_prod_59_15, 13, 1},
-    {xmlscm_prod_59_16, 13, 1}
+    {xmlscm_prod_59_0, 18, 7, {6, 6}},
+    {xmlscm_prod_59_1, 17, 5, {6, 6}},
+    {xmlscm_prod_59_2, 16, 3, {5, 6}},
+    {xmlscm_prod_59_3, 14, 1, {5, 5}},
+    {xmlscm_prod_59_4, 13, 1, {5, 5}},
+    {xmlscm_prod_59_5, 13, 1, {5, 5}},
+    {xmlscm_prod_59_6, 13, 1, {5, 5}},
+    {xmlscm_prod_59_7, 13, 1, {5, 5}},
+    {xmlscm_prod_59_8, 13, 1, {5, 5}},
+    {xmlscm_prod_59_9, 13, 1, {5, 5}},
+    {xmlscm_prod_59_10, 13, 1, {5, 5}},
+    {xmlscm_prod_59_11, 13, 1, {5, 5}},
+    {xmlscm_prod_59_12, 13, 1, {5, 5}},
+    {xmlscm_prod_59_13, 13, 1, {5, 5}},
+    {xmlscm_prod_59_14, 13, 1, {5, 5}},
+    {xmlscm_prod_59_15, 13, 1, {5, 5}},
+    {xmlscm_prod_59_16, 13, 1, {5, 5}}
 };
 
 static CONST Production xmlscm_prod_60_0[6] =
@@ -2462,8 +2462,8 @@ static CONST Production xmlscm_prod_60_0[6] =
         503316482, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -2484,8 +2484,8 @@ static CONST Production xmlscm_prod_60_1[5] =
         503316482, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_60_2[3] =
@@ -2504,39 +2504,39 @@ static CONST Production xmlscm_prod_60_2[3] =
 static CONST Production xmlscm_prod_60_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_60_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_60_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_60[6] =
 {
-    {xmlscm_prod_60_0, 6, 4},
-    {xmlscm_prod_60_1, 5, 2},
-    {xmlscm_prod_60_2, 3, 0},
-    {xmlscm_prod_60_3, 1, 1},
-    {xmlscm_prod_60_4, 1, 1},
-    {xmlscm_prod_60_5, 1, 1}
+    {xmlscm_prod_60_0, 6, 4, {4, 4}},
+    {xmlscm_prod_60_1, 5, 2, {4, 4}},
+    {xmlscm_prod_60_2, 3, 0, {3, 3}},
+    {xmlscm_prod_60_3, 1, 1, {1, 2}},
+    {xmlscm_prod_60_4, 1, 1, {1, 2}},
+    {xmlscm_prod_60_5, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_61_0[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2544,8 +2544,8 @@ static CONST Production xmlscm_prod_61_0[6] =
         503316483, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 10,
         {0, 12}},
@@ -2557,8 +2557,8 @@ static CONST Production xmlscm_prod_61_0[6] =
 static CONST Production xmlscm_prod_61_1[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2566,8 +2566,8 @@ static CONST Production xmlscm_prod_61_1[5] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 10,
         {0, 12}}
@@ -2576,8 +2576,8 @@ static CONST Production xmlscm_prod_61_1[5] =
 static CONST Production xmlscm_prod_61_2[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2585,15 +2585,15 @@ static CONST Production xmlscm_prod_61_2[4] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_61_3[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}}
@@ -2602,24 +2602,24 @@ static CONST Production xmlscm_prod_61_3[2] =
 static CONST Production xmlscm_prod_61_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_61[5] =
 {
-    {xmlscm_prod_61_0, 6, 7},
-    {xmlscm_prod_61_1, 5, 5},
-    {xmlscm_prod_61_2, 4, 3},
-    {xmlscm_prod_61_3, 2, 1},
-    {xmlscm_prod_61_4, 1, 1}
+    {xmlscm_prod_61_0, 6, 7, {4, 4}},
+    {xmlscm_prod_61_1, 5, 5, {4, 4}},
+    {xmlscm_prod_61_2, 4, 3, {3, 4}},
+    {xmlscm_prod_61_3, 2, 1, {2, 3}},
+    {xmlscm_prod_61_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_62_0[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2627,8 +2627,8 @@ static CONST Production xmlscm_prod_62_0[6] =
         503316483, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 50,
         {0, 14}},
@@ -2640,8 +2640,8 @@ static CONST Production xmlscm_prod_62_0[6] =
 static CONST Production xmlscm_prod_62_1[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2649,8 +2649,8 @@ static CONST Production xmlscm_prod_62_1[5] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 50,
         {0, 14}}
@@ -2659,8 +2659,8 @@ static CONST Production xmlscm_prod_62_1[5] =
 static CONST Production xmlscm_prod_62_2[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}},
@@ -2668,15 +2668,15 @@ static CONST Production xmlscm_prod_62_2[4] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_62_3[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}}
@@ -2685,8 +2685,8 @@ static CONST Production xmlscm_prod_62_3[2] =
 static CONST Production xmlscm_prod_62_4[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 60,
         {3, 128}}
@@ -2694,18 +2694,18 @@ static CONST Production xmlscm_prod_62_4[2] =
 
 static CONST GrammarRule xmlscm_rule_62[5] =
 {
-    {xmlscm_prod_62_0, 6, 7},
-    {xmlscm_prod_62_1, 5, 5},
-    {xmlscm_prod_62_2, 4, 3},
-    {xmlscm_prod_62_3, 2, 1},
-    {xmlscm_prod_62_4, 2, 1}
+    {xmlscm_prod_62_0, 6, 7, {4, 4}},
+    {xmlscm_prod_62_1, 5, 5, {4, 4}},
+    {xmlscm_prod_62_2, 4, 3, {3, 4}},
+    {xmlscm_prod_62_3, 2, 1, {2, 3}},
+    {xmlscm_prod_62_4, 2, 1, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_63_0[4] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 11,
         {0, 31}},
@@ -2720,8 +2720,8 @@ static CONST Production xmlscm_prod_63_0[4] =
 static CONST Production xmlscm_prod_63_1[3] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 11,
         {0, 31}},
@@ -2733,8 +2733,8 @@ static CONST Production xmlscm_prod_63_1[3] =
 static CONST Production xmlscm_prod_63_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 11,
         {0, 31}}
@@ -2743,37 +2743,37 @@ static CONST Production xmlscm_prod_63_2[2] =
 static CONST Production xmlscm_prod_63_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_63_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_63[5] =
 {
-    {xmlscm_prod_63_0, 4, 8},
-    {xmlscm_prod_63_1, 3, 6},
-    {xmlscm_prod_63_2, 2, 4},
-    {xmlscm_prod_63_3, 3, 3},
-    {xmlscm_prod_63_4, 1, 1}
+    {xmlscm_prod_63_0, 4, 8, {3, 4}},
+    {xmlscm_prod_63_1, 3, 6, {3, 3}},
+    {xmlscm_prod_63_2, 2, 4, {2, 3}},
+    {xmlscm_prod_63_3, 3, 3, {3, 3}},
+    {xmlscm_prod_63_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_64_0[4] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 37,
         {0, 31}},
@@ -2788,8 +2788,8 @@ static CONST Production xmlscm_prod_64_0[4] =
 static CONST Production xmlscm_prod_64_1[3] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 37,
         {0, 31}},
@@ -2801,8 +2801,8 @@ static CONST Production xmlscm_prod_64_1[3] =
 static CONST Production xmlscm_prod_64_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 37,
         {0, 31}}
@@ -2811,37 +2811,37 @@ static CONST Production xmlscm_prod_64_2[2] =
 static CONST Production xmlscm_prod_64_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_64_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_64[5] =
 {
-    {xmlscm_prod_64_0, 4, 8},
-    {xmlscm_prod_64_1, 3, 6},
-    {xmlscm_prod_64_2, 2, 4},
-    {xmlscm_prod_64_3, 3, 3},
-    {xmlscm_prod_64_4, 1, 1}
+    {xmlscm_prod_64_0, 4, 8, {3, 4}},
+    {xmlscm_prod_64_1, 3, 6, {3, 3}},
+    {xmlscm_prod_64_2, 2, 4, {2, 3}},
+    {xmlscm_prod_64_3, 3, 3, {3, 3}},
+    {xmlscm_prod_64_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_65_0[4] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 31}},
@@ -2856,8 +2856,8 @@ static CONST Production xmlscm_prod_65_0[4] =
 static CONST Production xmlscm_prod_65_1[3] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 31}},
@@ -2869,8 +2869,8 @@ static CONST Production xmlscm_prod_65_1[3] =
 static CONST Production xmlscm_prod_65_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 31}}
@@ -2879,37 +2879,37 @@ static CONST Production xmlscm_prod_65_2[2] =
 static CONST Production xmlscm_prod_65_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_65_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_65[5] =
 {
-    {xmlscm_prod_65_0, 4, 8},
-    {xmlscm_prod_65_1, 3, 6},
-    {xmlscm_prod_65_2, 2, 4},
-    {xmlscm_prod_65_3, 3, 3},
-    {xmlscm_prod_65_4, 1, 1}
+    {xmlscm_prod_65_0, 4, 8, {3, 4}},
+    {xmlscm_prod_65_1, 3, 6, {3, 3}},
+    {xmlscm_prod_65_2, 2, 4, {2, 3}},
+    {xmlscm_prod_65_3, 3, 3, {3, 3}},
+    {xmlscm_prod_65_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_66_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 11,
         {0, 31}},
@@ -2921,8 +2921,8 @@ static CONST Production xmlscm_prod_66_0[3] =
 static CONST Production xmlscm_prod_66_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 11,
         {0, 31}}
@@ -2931,36 +2931,36 @@ static CONST Production xmlscm_prod_66_1[2] =
 static CONST Production xmlscm_prod_66_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_66_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_66[4] =
 {
-    {xmlscm_prod_66_0, 3, 6},
-    {xmlscm_prod_66_1, 2, 4},
-    {xmlscm_prod_66_2, 3, 3},
-    {xmlscm_prod_66_3, 1, 1}
+    {xmlscm_prod_66_0, 3, 6, {3, 3}},
+    {xmlscm_prod_66_1, 2, 4, {2, 3}},
+    {xmlscm_prod_66_2, 3, 3, {3, 3}},
+    {xmlscm_prod_66_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_67_0[4] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 51,
         {0, 31}},
@@ -2975,8 +2975,8 @@ static CONST Production xmlscm_prod_67_0[4] =
 static CONST Production xmlscm_prod_67_1[3] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 51,
         {0, 31}},
@@ -2988,8 +2988,8 @@ static CONST Production xmlscm_prod_67_1[3] =
 static CONST Production xmlscm_prod_67_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 51,
         {0, 31}}
@@ -2998,37 +2998,37 @@ static CONST Production xmlscm_prod_67_2[2] =
 static CONST Production xmlscm_prod_67_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_67_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_67[5] =
 {
-    {xmlscm_prod_67_0, 4, 8},
-    {xmlscm_prod_67_1, 3, 6},
-    {xmlscm_prod_67_2, 2, 4},
-    {xmlscm_prod_67_3, 3, 3},
-    {xmlscm_prod_67_4, 1, 1}
+    {xmlscm_prod_67_0, 4, 8, {3, 4}},
+    {xmlscm_prod_67_1, 3, 6, {3, 3}},
+    {xmlscm_prod_67_2, 2, 4, {2, 3}},
+    {xmlscm_prod_67_3, 3, 3, {3, 3}},
+    {xmlscm_prod_67_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_68_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 39,
         {0, 31}},
@@ -3040,8 +3040,8 @@ static CONST Production xmlscm_prod_68_0[3] =
 static CONST Production xmlscm_prod_68_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 39,
         {0, 31}}
@@ -3050,56 +3050,56 @@ static CONST Production xmlscm_prod_68_1[2] =
 static CONST Production xmlscm_prod_68_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_68_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_68[4] =
 {
-    {xmlscm_prod_68_0, 3, 6},
-    {xmlscm_prod_68_1, 2, 4},
-    {xmlscm_prod_68_2, 3, 3},
-    {xmlscm_prod_68_3, 1, 1}
+    {xmlscm_prod_68_0, 3, 6, {3, 3}},
+    {xmlscm_prod_68_1, 2, 4, {2, 3}},
+    {xmlscm_prod_68_2, 3, 3, {3, 3}},
+    {xmlscm_prod_68_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_69_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_69_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_69[2] =
 {
-    {xmlscm_prod_69_0, 1, 0},
-    {xmlscm_prod_69_1, 1, 1}
+    {xmlscm_prod_69_0, 1, 0, {1, 2}},
+    {xmlscm_prod_69_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_70_0[4] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}},
@@ -3114,8 +3114,8 @@ static CONST Production xmlscm_prod_70_0[4] =
 static CONST Production xmlscm_prod_70_1[3] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}},
@@ -3127,8 +3127,8 @@ static CONST Production xmlscm_prod_70_1[3] =
 static CONST Production xmlscm_prod_70_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}}
@@ -3149,8 +3149,8 @@ static CONST Production xmlscm_prod_70_3[5] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_70_4[3] =
@@ -3169,41 +3169,41 @@ static CONST Production xmlscm_prod_70_4[3] =
 static CONST Production xmlscm_prod_70_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_70_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_70_7[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_70[8] =
 {
-    {xmlscm_prod_70_0, 4, 8},
-    {xmlscm_prod_70_1, 3, 6},
-    {xmlscm_prod_70_2, 2, 4},
-    {xmlscm_prod_70_3, 5, 2},
-    {xmlscm_prod_70_4, 3, 0},
-    {xmlscm_prod_70_5, 1, 1},
-    {xmlscm_prod_70_6, 1, 1},
-    {xmlscm_prod_70_7, 1, 1}
+    {xmlscm_prod_70_0, 4, 8, {3, 4}},
+    {xmlscm_prod_70_1, 3, 6, {3, 3}},
+    {xmlscm_prod_70_2, 2, 4, {2, 3}},
+    {xmlscm_prod_70_3, 5, 2, {4, 4}},
+    {xmlscm_prod_70_4, 3, 0, {3, 3}},
+    {xmlscm_prod_70_5, 1, 1, {1, 2}},
+    {xmlscm_prod_70_6, 1, 1, {1, 2}},
+    {xmlscm_prod_70_7, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_71_0[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3211,8 +3211,8 @@ static CONST Production xmlscm_prod_71_0[12] =
         503316489, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3242,8 +3242,8 @@ static CONST Production xmlscm_prod_71_0[12] =
 static CONST Production xmlscm_prod_71_1[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3251,8 +3251,8 @@ static CONST Production xmlscm_prod_71_1[11] =
         503316489, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3279,8 +3279,8 @@ static CONST Production xmlscm_prod_71_1[11] =
 static CONST Production xmlscm_prod_71_2[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3288,8 +3288,8 @@ static CONST Production xmlscm_prod_71_2[10] =
         503316489, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3313,8 +3313,8 @@ static CONST Production xmlscm_prod_71_2[10] =
 static CONST Production xmlscm_prod_71_3[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3322,8 +3322,8 @@ static CONST Production xmlscm_prod_71_3[9] =
         503316489, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3344,8 +3344,8 @@ static CONST Production xmlscm_prod_71_3[9] =
 static CONST Production xmlscm_prod_71_4[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3353,8 +3353,8 @@ static CONST Production xmlscm_prod_71_4[8] =
         503316489, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3372,8 +3372,8 @@ static CONST Production xmlscm_prod_71_4[8] =
 static CONST Production xmlscm_prod_71_5[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3381,8 +3381,8 @@ static CONST Production xmlscm_prod_71_5[7] =
         503316489, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3397,8 +3397,8 @@ static CONST Production xmlscm_prod_71_5[7] =
 static CONST Production xmlscm_prod_71_6[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3406,8 +3406,8 @@ static CONST Production xmlscm_prod_71_6[6] =
         503316489, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}},
@@ -3419,8 +3419,8 @@ static CONST Production xmlscm_prod_71_6[6] =
 static CONST Production xmlscm_prod_71_7[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3428,8 +3428,8 @@ static CONST Production xmlscm_prod_71_7[5] =
         503316489, 49,
         {3, 50}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 52,
         {0, 30}}
@@ -3438,8 +3438,8 @@ static CONST Production xmlscm_prod_71_7[5] =
 static CONST Production xmlscm_prod_71_8[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}},
@@ -3447,15 +3447,15 @@ static CONST Production xmlscm_prod_71_8[4] =
         503316489, 49,
         {3, 50}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_71_9[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 60,
         {3, 128}}
@@ -3464,30 +3464,30 @@ static CONST Production xmlscm_prod_71_9[2] =
 static CONST Production xmlscm_prod_71_10[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_71[11] =
 {
-    {xmlscm_prod_71_0, 12, 19},
-    {xmlscm_prod_71_1, 11, 17},
-    {xmlscm_prod_71_2, 10, 15},
-    {xmlscm_prod_71_3, 9, 13},
-    {xmlscm_prod_71_4, 8, 11},
-    {xmlscm_prod_71_5, 7, 9},
-    {xmlscm_prod_71_6, 6, 7},
-    {xmlscm_prod_71_7, 5, 5},
-    {xmlscm_prod_71_8, 4, 3},
-    {xmlscm_prod_71_9, 2, 1},
-    {xmlscm_prod_71_10, 1, 1}
+    {xmlscm_prod_71_0, 12, 19, {5, 5}},
+    {xmlscm_prod_71_1, 11, 17, {5, 5}},
+    {xmlscm_prod_71_2, 10, 15, {5, 5}},
+    {xmlscm_prod_71_3, 9, 13, {5, 5}},
+    {xmlscm_prod_71_4, 8, 11, {4, 5}},
+    {xmlscm_prod_71_5, 7, 9, {4, 4}},
+    {xmlscm_prod_71_6, 6, 7, {4, 4}},
+    {xmlscm_prod_71_7, 5, 5, {4, 4}},
+    {xmlscm_prod_71_8, 4, 3, {3, 4}},
+    {xmlscm_prod_71_9, 2, 1, {2, 3}},
+    {xmlscm_prod_71_10, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_72_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 10,
         {0, 22}},
@@ -3499,8 +3499,8 @@ static CONST Production xmlscm_prod_72_0[3] =
 static CONST Production xmlscm_prod_72_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 10,
         {0, 22}}
@@ -3509,62 +3509,62 @@ static CONST Production xmlscm_prod_72_1[2] =
 static CONST Production xmlscm_prod_72_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_72_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_72[4] =
 {
-    {xmlscm_prod_72_0, 3, 6},
-    {xmlscm_prod_72_1, 2, 4},
-    {xmlscm_prod_72_2, 3, 3},
-    {xmlscm_prod_72_3, 1, 1}
+    {xmlscm_prod_72_0, 3, 6, {3, 3}},
+    {xmlscm_prod_72_1, 2, 4, {2, 3}},
+    {xmlscm_prod_72_2, 3, 3, {3, 3}},
+    {xmlscm_prod_72_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_73_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_73_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_73[2] =
 {
-    {xmlscm_prod_73_0, 1, 0},
-    {xmlscm_prod_73_1, 1, 1}
+    {xmlscm_prod_73_0, 1, 0, {1, 2}},
+    {xmlscm_prod_73_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_74_0[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 53,
         {0, 20}},
@@ -3579,14 +3579,14 @@ static CONST Production xmlscm_prod_74_0[6] =
 static CONST Production xmlscm_prod_74_1[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 53,
         {0, 20}},
@@ -3598,14 +3598,14 @@ static CONST Production xmlscm_prod_74_1[5] =
 static CONST Production xmlscm_prod_74_2[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 53,
         {0, 20}}
@@ -3614,37 +3614,37 @@ static CONST Production xmlscm_prod_74_2[4] =
 static CONST Production xmlscm_prod_74_3[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_74_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_74[5] =
 {
-    {xmlscm_prod_74_0, 6, 9},
-    {xmlscm_prod_74_1, 5, 7},
-    {xmlscm_prod_74_2, 4, 5},
-    {xmlscm_prod_74_3, 3, 3},
-    {xmlscm_prod_74_4, 1, 1}
+    {xmlscm_prod_74_0, 6, 9, {4, 4}},
+    {xmlscm_prod_74_1, 5, 7, {4, 4}},
+    {xmlscm_prod_74_2, 4, 5, {3, 4}},
+    {xmlscm_prod_74_3, 3, 3, {3, 3}},
+    {xmlscm_prod_74_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_75_0[2] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 10,
         {0, 2}}
@@ -3653,8 +3653,8 @@ static CONST Production xmlscm_prod_75_0[2] =
 static CONST Production xmlscm_prod_75_1[20] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3707,8 +3707,8 @@ static CONST Production xmlscm_prod_75_1[20] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -3717,8 +3717,8 @@ static CONST Production xmlscm_prod_75_1[20] =
 static CONST Production xmlscm_prod_75_2[19] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3771,15 +3771,15 @@ static CONST Production xmlscm_prod_75_2[19] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_75_3[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3833,8 +3833,8 @@ static CONST Production xmlscm_prod_75_3[17] =
 static CONST Production xmlscm_prod_75_4[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3885,8 +3885,8 @@ static CONST Production xmlscm_prod_75_4[16] =
 static CONST Production xmlscm_prod_75_5[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3937,8 +3937,8 @@ static CONST Production xmlscm_prod_75_5[16] =
 static CONST Production xmlscm_prod_75_6[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -3989,8 +3989,8 @@ static CONST Production xmlscm_prod_75_6[16] =
 static CONST Production xmlscm_prod_75_7[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4041,8 +4041,8 @@ static CONST Production xmlscm_prod_75_7[16] =
 static CONST Production xmlscm_prod_75_8[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4093,8 +4093,8 @@ static CONST Production xmlscm_prod_75_8[16] =
 static CONST Production xmlscm_prod_75_9[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4145,8 +4145,8 @@ static CONST Production xmlscm_prod_75_9[16] =
 static CONST Production xmlscm_prod_75_10[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4197,8 +4197,8 @@ static CONST Production xmlscm_prod_75_10[16] =
 static CONST Production xmlscm_prod_75_11[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4249,8 +4249,8 @@ static CONST Production xmlscm_prod_75_11[16] =
 static CONST Production xmlscm_prod_75_12[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4301,8 +4301,8 @@ static CONST Production xmlscm_prod_75_12[16] =
 static CONST Production xmlscm_prod_75_13[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4353,8 +4353,8 @@ static CONST Production xmlscm_prod_75_13[16] =
 static CONST Production xmlscm_prod_75_14[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4405,8 +4405,8 @@ static CONST Production xmlscm_prod_75_14[16] =
 static CONST Production xmlscm_prod_75_15[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4457,8 +4457,8 @@ static CONST Production xmlscm_prod_75_15[16] =
 static CONST Production xmlscm_prod_75_16[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4509,8 +4509,8 @@ static CONST Production xmlscm_prod_75_16[16] =
 static CONST Production xmlscm_prod_75_17[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4525,8 +4525,8 @@ static CONST Production xmlscm_prod_75_17[4] =
 static CONST Production xmlscm_prod_75_18[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 74,
         {3, 52}},
@@ -4541,39 +4541,39 @@ static CONST Production xmlscm_prod_75_18[4] =
 static CONST Production xmlscm_prod_75_19[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_75[20] =
 {
-    {xmlscm_prod_75_0, 2, 4},
-    {xmlscm_prod_75_1, 20, 5},
-    {xmlscm_prod_75_2, 19, 3},
-    {xmlscm_prod_75_3, 17, 1},
-    {xmlscm_prod_75_4, 16, 1},
-    {xmlscm_prod_75_5, 16, 1},
-    {xmlscm_prod_75_6, 16, 1},
-    {xmlscm_prod_75_7, 16, 1},
-    {xmlscm_prod_75_8, 16, 1},
-    {xmlscm_prod_75_9, 16, 1},
-    {xmlscm_prod_75_10, 16, 1},
-    {xmlscm_prod_75_11, 16, 1},
-    {xmlscm_prod_75_12, 16, 1},
-    {xmlscm_prod_75_13, 16, 1},
-    {xmlscm_prod_75_14, 16, 1},
-    {xmlscm_prod_75_15, 16, 1},
-    {xmlscm_prod_75_16, 16, 1},
-    {xmlscm_prod_75_17, 4, 1},
-    {xmlscm_prod_75_18, 4, 1},
-    {xmlscm_prod_75_19, 1, 1}
+    {xmlscm_prod_75_0, 2, 4, {2, 3}},
+    {xmlscm_prod_75_1, 20, 5, {6, 6}},
+    {xmlscm_prod_75_2, 19, 3, {6, 6}},
+    {xmlscm_prod_75_3, 17, 1, {6, 6}},
+    {xmlscm_prod_75_4, 16, 1, {5, 6}},
+    {xmlscm_prod_75_5, 16, 1, {5, 6}},
+    {xmlscm_prod_75_6, 16, 1, {5, 6}},
+    {xmlscm_prod_75_7, 16, 1, {5, 6}},
+    {xmlscm_prod_75_8, 16, 1, {5, 6}},
+    {xmlscm_prod_75_9, 16, 1, {5, 6}},
+    {xmlscm_prod_75_10, 16, 1, {5, 6}},
+    {xmlscm_prod_75_11, 16, 1, {5, 6}},
+    {xmlscm_prod_75_12, 16, 1, {5, 6}},
+    {xmlscm_prod_75_13, 16, 1, {5, 6}},
+    {xmlscm_prod_75_14, 16, 1, {5, 6}},
+    {xmlscm_prod_75_15, 16, 1, {5, 6}},
+    {xmlscm_prod_75_16, 16, 1, {5, 6}},
+    {xmlscm_prod_75_17, 4, 1, {3, 4}},
+    {xmlscm_prod_75_18, 4, 1, {3, 4}},
+    {xmlscm_prod_75_19, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_76_0[2] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 10,
         {0, 2}}
@@ -4582,8 +4582,8 @@ static CONST Production xmlscm_prod_76_0[2] =
 static CONST Production xmlscm_prod_76_1[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -4597,8 +4597,8 @@ static CONST Production xmlscm_prod_76_1[7] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -4607,8 +4607,8 @@ static CONST Production xmlscm_prod_76_1[7] =
 static CONST Production xmlscm_prod_76_2[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -4622,15 +4622,15 @@ static CONST Production xmlscm_prod_76_2[6] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_76_3[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -4645,8 +4645,8 @@ static CONST Production xmlscm_prod_76_3[4] =
 static CONST Production xmlscm_prod_76_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -4661,8 +4661,8 @@ static CONST Production xmlscm_prod_76_4[4] =
 static CONST Production xmlscm_prod_76_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -4677,19 +4677,19 @@ static CONST Production xmlscm_prod_76_5[4] =
 static CONST Production xmlscm_prod_76_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_76[7] =
 {
-    {xmlscm_prod_76_0, 2, 4},
-    {xmlscm_prod_76_1, 7, 5},
-    {xmlscm_prod_76_2, 6, 3},
-    {xmlscm_prod_76_3, 4, 1},
-    {xmlscm_prod_76_4, 4, 1},
-    {xmlscm_prod_76_5, 4, 1},
-    {xmlscm_prod_76_6, 1, 1}
+    {xmlscm_prod_76_0, 2, 4, {2, 3}},
+    {xmlscm_prod_76_1, 7, 5, {4, 4}},
+    {xmlscm_prod_76_2, 6, 3, {4, 4}},
+    {xmlscm_prod_76_3, 4, 1, {3, 4}},
+    {xmlscm_prod_76_4, 4, 1, {3, 4}},
+    {xmlscm_prod_76_5, 4, 1, {3, 4}},
+    {xmlscm_prod_76_6, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_77_0[5] =
@@ -4704,8 +4704,8 @@ static CONST Production xmlscm_prod_77_0[5] =
         503316482, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -4723,8 +4723,8 @@ static CONST Production xmlscm_prod_77_1[4] =
         503316482, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_77_2[2] =
@@ -4740,51 +4740,51 @@ static CONST Production xmlscm_prod_77_2[2] =
 static CONST Production xmlscm_prod_77_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_77_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_77[5] =
 {
-    {xmlscm_prod_77_0, 5, 4},
-    {xmlscm_prod_77_1, 4, 2},
-    {xmlscm_prod_77_2, 2, 0},
-    {xmlscm_prod_77_3, 1, 1},
-    {xmlscm_prod_77_4, 1, 1}
+    {xmlscm_prod_77_0, 5, 4, {4, 4}},
+    {xmlscm_prod_77_1, 4, 2, {3, 4}},
+    {xmlscm_prod_77_2, 2, 0, {2, 3}},
+    {xmlscm_prod_77_3, 1, 1, {1, 2}},
+    {xmlscm_prod_77_4, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_78_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_78_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_78[2] =
 {
-    {xmlscm_prod_78_0, 1, 0},
-    {xmlscm_prod_78_1, 1, 1}
+    {xmlscm_prod_78_0, 1, 0, {1, 2}},
+    {xmlscm_prod_78_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_79_0[5] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 10,
         {0, 22}},
@@ -4802,8 +4802,8 @@ static CONST Production xmlscm_prod_79_0[5] =
 static CONST Production xmlscm_prod_79_1[4] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 10,
         {0, 22}},
@@ -4818,8 +4818,8 @@ static CONST Production xmlscm_prod_79_1[4] =
 static CONST Production xmlscm_prod_79_2[3] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 10,
         {0, 22}},
@@ -4831,8 +4831,8 @@ static CONST Production xmlscm_prod_79_2[3] =
 static CONST Production xmlscm_prod_79_3[2] =
 {
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 10,
         {0, 22}}
@@ -4841,31 +4841,31 @@ static CONST Production xmlscm_prod_79_3[2] =
 static CONST Production xmlscm_prod_79_4[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_79_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_79[6] =
 {
-    {xmlscm_prod_79_0, 5, 10},
-    {xmlscm_prod_79_1, 4, 8},
-    {xmlscm_prod_79_2, 3, 6},
-    {xmlscm_prod_79_3, 2, 4},
-    {xmlscm_prod_79_4, 3, 3},
-    {xmlscm_prod_79_5, 1, 1}
+    {xmlscm_prod_79_0, 5, 10, {4, 4}},
+    {xmlscm_prod_79_1, 4, 8, {3, 4}},
+    {xmlscm_prod_79_2, 3, 6, {3, 3}},
+    {xmlscm_prod_79_3, 2, 4, {2, 3}},
+    {xmlscm_prod_79_4, 3, 3, {3, 3}},
+    {xmlscm_prod_79_5, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_80_0[6] =
@@ -4880,8 +4880,8 @@ static CONST Production xmlscm_prod_80_0[6] =
         503316483, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 15,
         {0, 16}},
@@ -4902,8 +4902,8 @@ static CONST Production xmlscm_prod_80_1[5] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 15,
         {0, 16}}
@@ -4921,8 +4921,8 @@ static CONST Production xmlscm_prod_80_2[4] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_80_3[2] =
@@ -4938,32 +4938,32 @@ static CONST Production xmlscm_prod_80_3[2] =
 static CONST Production xmlscm_prod_80_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_80_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_80[6] =
 {
-    {xmlscm_prod_80_0, 6, 6},
-    {xmlscm_prod_80_1, 5, 4},
-    {xmlscm_prod_80_2, 4, 2},
-    {xmlscm_prod_80_3, 2, 0},
-    {xmlscm_prod_80_4, 1, 1},
-    {xmlscm_prod_80_5, 1, 1}
+    {xmlscm_prod_80_0, 6, 6, {4, 4}},
+    {xmlscm_prod_80_1, 5, 4, {4, 4}},
+    {xmlscm_prod_80_2, 4, 2, {3, 4}},
+    {xmlscm_prod_80_3, 2, 0, {2, 3}},
+    {xmlscm_prod_80_4, 1, 1, {1, 2}},
+    {xmlscm_prod_80_5, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_81_0[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}},
@@ -4971,8 +4971,8 @@ static CONST Production xmlscm_prod_81_0[7] =
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 59,
         {0, 15}},
@@ -4987,8 +4987,8 @@ static CONST Production xmlscm_prod_81_0[7] =
 static CONST Production xmlscm_prod_81_1[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}},
@@ -4996,8 +4996,8 @@ static CONST Production xmlscm_prod_81_1[6] =
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 59,
         {0, 15}},
@@ -5009,8 +5009,8 @@ static CONST Production xmlscm_prod_81_1[6] =
 static CONST Production xmlscm_prod_81_2[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}},
@@ -5018,8 +5018,8 @@ static CONST Production xmlscm_prod_81_2[5] =
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 59,
         {0, 15}}
@@ -5028,8 +5028,8 @@ static CONST Production xmlscm_prod_81_2[5] =
 static CONST Production xmlscm_prod_81_3[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}},
@@ -5037,15 +5037,15 @@ static CONST Production xmlscm_prod_81_3[4] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_81_4[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}}
@@ -5054,8 +5054,8 @@ static CONST Production xmlscm_prod_81_4[2] =
 static CONST Production xmlscm_prod_81_5[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 91,
         {3, 68}}
@@ -5063,19 +5063,19 @@ static CONST Production xmlscm_prod_81_5[2] =
 
 static CONST GrammarRule xmlscm_rule_81[6] =
 {
-    {xmlscm_prod_81_0, 7, 9},
-    {xmlscm_prod_81_1, 6, 7},
-    {xmlscm_prod_81_2, 5, 5},
-    {xmlscm_prod_81_3, 4, 3},
-    {xmlscm_prod_81_4, 2, 1},
-    {xmlscm_prod_81_5, 2, 1}
+    {xmlscm_prod_81_0, 7, 9, {4, 4}},
+    {xmlscm_prod_81_1, 6, 7, {4, 4}},
+    {xmlscm_prod_81_2, 5, 5, {4, 4}},
+    {xmlscm_prod_81_3, 4, 3, {3, 4}},
+    {xmlscm_prod_81_4, 2, 1, {2, 3}},
+    {xmlscm_prod_81_5, 2, 1, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_82_0[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5107,8 +5107,8 @@ static CONST Production xmlscm_prod_82_0[14] =
         503316483, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 15,
         {0, 16}},
@@ -5120,8 +5120,8 @@ static CONST Production xmlscm_prod_82_0[14] =
 static CONST Production xmlscm_prod_82_1[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5153,8 +5153,8 @@ static CONST Production xmlscm_prod_82_1[13] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 15,
         {0, 16}}
@@ -5163,8 +5163,8 @@ static CONST Production xmlscm_prod_82_1[13] =
 static CONST Production xmlscm_prod_82_2[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5196,15 +5196,15 @@ static CONST Production xmlscm_prod_82_2[12] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_82_3[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5237,22 +5237,22 @@ static CONST Production xmlscm_prod_82_3[10] =
 static CONST Production xmlscm_prod_82_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_82_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_82_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5267,8 +5267,8 @@ static CONST Production xmlscm_prod_82_6[4] =
 static CONST Production xmlscm_prod_82_7[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5283,8 +5283,8 @@ static CONST Production xmlscm_prod_82_7[4] =
 static CONST Production xmlscm_prod_82_8[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5299,8 +5299,8 @@ static CONST Production xmlscm_prod_82_8[4] =
 static CONST Production xmlscm_prod_82_9[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5315,8 +5315,8 @@ static CONST Production xmlscm_prod_82_9[4] =
 static CONST Production xmlscm_prod_82_10[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5331,8 +5331,8 @@ static CONST Production xmlscm_prod_82_10[4] =
 static CONST Production xmlscm_prod_82_11[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 74,
         {3, 52}},
@@ -5347,32 +5347,32 @@ static CONST Production xmlscm_prod_82_11[4] =
 static CONST Production xmlscm_prod_82_12[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_82[13] =
 {
-    {xmlscm_prod_82_0, 14, 7},
-    {xmlscm_prod_82_1, 13, 5},
-    {xmlscm_prod_82_2, 12, 3},
-    {xmlscm_prod_82_3, 10, 1},
-    {xmlscm_prod_82_4, 1, 1},
-    {xmlscm_prod_82_5, 1, 1},
-    {xmlscm_prod_82_6, 4, 1},
-    {xmlscm_prod_82_7, 4, 1},
-    {xmlscm_prod_82_8, 4, 1},
-    {xmlscm_prod_82_9, 4, 1},
-    {xmlscm_prod_82_10, 4, 1},
-    {xmlscm_prod_82_11, 4, 1},
-    {xmlscm_prod_82_12, 1, 1}
+    {xmlscm_prod_82_0, 14, 7, {5, 5}},
+    {xmlscm_prod_82_1, 13, 5, {5, 5}},
+    {xmlscm_prod_82_2, 12, 3, {5, 5}},
+    {xmlscm_prod_82_3, 10, 1, {5, 5}},
+    {xmlscm_prod_82_4, 1, 1, {1, 2}},
+    {xmlscm_prod_82_5, 1, 1, {1, 2}},
+    {xmlscm_prod_82_6, 4, 1, {3, 4}},
+    {xmlscm_prod_82_7, 4, 1, {3, 4}},
+    {xmlscm_prod_82_8, 4, 1, {3, 4}},
+    {xmlscm_prod_82_9, 4, 1, {3, 4}},
+    {xmlscm_prod_82_10, 4, 1, {3, 4}},
+    {xmlscm_prod_82_11, 4, 1, {3, 4}},
+    {xmlscm_prod_82_12, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_83_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 54,
         {0, 33}},
@@ -5384,8 +5384,8 @@ static CONST Production xmlscm_prod_83_0[3] =
 static CONST Production xmlscm_prod_83_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 54,
         {0, 33}}
@@ -5394,36 +5394,36 @@ static CONST Production xmlscm_prod_83_1[2] =
 static CONST Production xmlscm_prod_83_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_83_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_83[4] =
 {
-    {xmlscm_prod_83_0, 3, 6},
-    {xmlscm_prod_83_1, 2, 4},
-    {xmlscm_prod_83_2, 3, 3},
-    {xmlscm_prod_83_3, 1, 1}
+    {xmlscm_prod_83_0, 3, 6, {3, 3}},
+    {xmlscm_prod_83_1, 2, 4, {2, 3}},
+    {xmlscm_prod_83_2, 3, 3, {3, 3}},
+    {xmlscm_prod_83_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_84_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 55,
         {0, 33}},
@@ -5435,8 +5435,8 @@ static CONST Production xmlscm_prod_84_0[3] =
 static CONST Production xmlscm_prod_84_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 55,
         {0, 33}}
@@ -5445,36 +5445,36 @@ static CONST Production xmlscm_prod_84_1[2] =
 static CONST Production xmlscm_prod_84_2[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_84_3[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_84[4] =
 {
-    {xmlscm_prod_84_0, 3, 6},
-    {xmlscm_prod_84_1, 2, 4},
-    {xmlscm_prod_84_2, 3, 3},
-    {xmlscm_prod_84_3, 1, 1}
+    {xmlscm_prod_84_0, 3, 6, {3, 3}},
+    {xmlscm_prod_84_1, 2, 4, {2, 3}},
+    {xmlscm_prod_84_2, 3, 3, {3, 3}},
+    {xmlscm_prod_84_3, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_85_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}},
@@ -5486,8 +5486,8 @@ static CONST Production xmlscm_prod_85_0[3] =
 static CONST Production xmlscm_prod_85_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}}
@@ -5502,8 +5502,8 @@ static CONST Production xmlscm_prod_85_2[3] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_85_3[1] =
@@ -5523,8 +5523,8 @@ static CONST Production xmlscm_prod_85_4[1] =
 static CONST Production xmlscm_prod_85_5[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 84,
         {3, 75}}
@@ -5533,8 +5533,8 @@ static CONST Production xmlscm_prod_85_5[2] =
 static CONST Production xmlscm_prod_85_6[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 84,
         {3, 75}}
@@ -5542,20 +5542,20 @@ static CONST Production xmlscm_prod_85_6[2] =
 
 static CONST GrammarRule xmlscm_rule_85[7] =
 {
-    {xmlscm_prod_85_0, 3, 6},
-    {xmlscm_prod_85_1, 2, 4},
-    {xmlscm_prod_85_2, 3, 2},
-    {xmlscm_prod_85_3, 1, 0},
-    {xmlscm_prod_85_4, 1, 0},
-    {xmlscm_prod_85_5, 2, 1},
-    {xmlscm_prod_85_6, 2, 1}
+    {xmlscm_prod_85_0, 3, 6, {3, 3}},
+    {xmlscm_prod_85_1, 2, 4, {2, 3}},
+    {xmlscm_prod_85_2, 3, 2, {3, 3}},
+    {xmlscm_prod_85_3, 1, 0, {1, 2}},
+    {xmlscm_prod_85_4, 1, 0, {1, 2}},
+    {xmlscm_prod_85_5, 2, 1, {2, 3}},
+    {xmlscm_prod_85_6, 2, 1, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_86_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}},
@@ -5567,8 +5567,8 @@ static CONST Production xmlscm_prod_86_0[3] =
 static CONST Production xmlscm_prod_86_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}}
@@ -5577,8 +5577,8 @@ static CONST Production xmlscm_prod_86_1[2] =
 static CONST Production xmlscm_prod_86_2[2] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 10,
         {0, 23}}
@@ -5593,8 +5593,8 @@ static CONST Production xmlscm_prod_86_3[3] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_86_4[1] =
@@ -5614,8 +5614,8 @@ static CONST Production xmlscm_prod_86_5[1] =
 static CONST Production xmlscm_prod_86_6[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 84,
         {3, 75}}
@@ -5624,8 +5624,8 @@ static CONST Production xmlscm_prod_86_6[2] =
 static CONST Production xmlscm_prod_86_7[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 84,
         {3, 75}}
@@ -5633,41 +5633,41 @@ static CONST Production xmlscm_prod_86_7[2] =
 
 static CONST GrammarRule xmlscm_rule_86[8] =
 {
-    {xmlscm_prod_86_0, 3, 6},
-    {xmlscm_prod_86_1, 2, 4},
-    {xmlscm_prod_86_2, 2, 4},
-    {xmlscm_prod_86_3, 3, 2},
-    {xmlscm_prod_86_4, 1, 0},
-    {xmlscm_prod_86_5, 1, 0},
-    {xmlscm_prod_86_6, 2, 1},
-    {xmlscm_prod_86_7, 2, 1}
+    {xmlscm_prod_86_0, 3, 6, {3, 3}},
+    {xmlscm_prod_86_1, 2, 4, {2, 3}},
+    {xmlscm_prod_86_2, 2, 4, {2, 3}},
+    {xmlscm_prod_86_3, 3, 2, {3, 3}},
+    {xmlscm_prod_86_4, 1, 0, {1, 2}},
+    {xmlscm_prod_86_5, 1, 0, {1, 2}},
+    {xmlscm_prod_86_6, 2, 1, {2, 3}},
+    {xmlscm_prod_86_7, 2, 1, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_87_0[1] =
 {
     {
         838860801, 39,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_87_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_87[2] =
 {
-    {xmlscm_prod_87_0, 1, 0},
-    {xmlscm_prod_87_1, 1, 1}
+    {xmlscm_prod_87_0, 1, 0, {1, 2}},
+    {xmlscm_prod_87_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_88_0[19] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5687,8 +5687,8 @@ static CONST Production xmlscm_prod_88_0[19] =
         503316492, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5727,8 +5727,8 @@ static CONST Production xmlscm_prod_88_0[19] =
 static CONST Production xmlscm_prod_88_1[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5748,8 +5748,8 @@ static CONST Production xmlscm_prod_88_1[18] =
         503316492, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5785,8 +5785,8 @@ static CONST Production xmlscm_prod_88_1[18] =
 static CONST Production xmlscm_prod_88_2[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5806,8 +5806,8 @@ static CONST Production xmlscm_prod_88_2[17] =
         503316492, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5840,8 +5840,8 @@ static CONST Production xmlscm_prod_88_2[17] =
 static CONST Production xmlscm_prod_88_3[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5861,8 +5861,8 @@ static CONST Production xmlscm_prod_88_3[16] =
         503316492, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5892,8 +5892,8 @@ static CONST Production xmlscm_prod_88_3[16] =
 static CONST Production xmlscm_prod_88_4[15] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5913,8 +5913,8 @@ static CONST Production xmlscm_prod_88_4[15] =
         503316492, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5941,8 +5941,8 @@ static CONST Production xmlscm_prod_88_4[15] =
 static CONST Production xmlscm_prod_88_5[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -5962,8 +5962,8 @@ static CONST Production xmlscm_prod_88_5[14] =
         503316492, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -5987,8 +5987,8 @@ static CONST Production xmlscm_prod_88_5[14] =
 static CONST Production xmlscm_prod_88_6[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6008,8 +6008,8 @@ static CONST Production xmlscm_prod_88_6[13] =
         503316492, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6030,8 +6030,8 @@ static CONST Production xmlscm_prod_88_6[13] =
 static CONST Production xmlscm_prod_88_7[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6051,8 +6051,8 @@ static CONST Production xmlscm_prod_88_7[12] =
         503316492, 49,
         {3, 50}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6070,8 +6070,8 @@ static CONST Production xmlscm_prod_88_7[12] =
 static CONST Production xmlscm_prod_88_8[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6091,8 +6091,8 @@ static CONST Production xmlscm_prod_88_8[11] =
         503316492, 49,
         {3, 50}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6107,8 +6107,8 @@ static CONST Production xmlscm_prod_88_8[11] =
 static CONST Production xmlscm_prod_88_9[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6128,8 +6128,8 @@ static CONST Production xmlscm_prod_88_9[10] =
         503316492, 49,
         {3, 50}},
     {
-        369098761, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098761, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6141,8 +6141,8 @@ static CONST Production xmlscm_prod_88_9[10] =
 static CONST Production xmlscm_prod_88_10[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6162,8 +6162,8 @@ static CONST Production xmlscm_prod_88_10[9] =
         503316492, 49,
         {3, 50}},
     {
-        369098762, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098762, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}}
@@ -6172,8 +6172,8 @@ static CONST Production xmlscm_prod_88_10[9] =
 static CONST Production xmlscm_prod_88_11[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6193,15 +6193,15 @@ static CONST Production xmlscm_prod_88_11[8] =
         503316492, 49,
         {3, 50}},
     {
-        369098763, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098763, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_88_12[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6222,8 +6222,8 @@ static CONST Production xmlscm_prod_88_12[6] =
 static CONST Production xmlscm_prod_88_13[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6238,8 +6238,8 @@ static CONST Production xmlscm_prod_88_13[4] =
 static CONST Production xmlscm_prod_88_14[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6254,8 +6254,8 @@ static CONST Production xmlscm_prod_88_14[4] =
 static CONST Production xmlscm_prod_88_15[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6270,8 +6270,8 @@ static CONST Production xmlscm_prod_88_15[4] =
 static CONST Production xmlscm_prod_88_16[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6286,8 +6286,8 @@ static CONST Production xmlscm_prod_88_16[4] =
 static CONST Production xmlscm_prod_88_17[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6301,31 +6301,31 @@ static CONST Production xmlscm_prod_88_17[4] =
 
 static CONST GrammarRule xmlscm_rule_88[18] =
 {
-    {xmlscm_prod_88_0, 19, 25},
-    {xmlscm_prod_88_1, 18, 23},
-    {xmlscm_prod_88_2, 17, 21},
-    {xmlscm_prod_88_3, 16, 19},
-    {xmlscm_prod_88_4, 15, 17},
-    {xmlscm_prod_88_5, 14, 15},
-    {xmlscm_prod_88_6, 13, 13},
-    {xmlscm_prod_88_7, 12, 11},
-    {xmlscm_prod_88_8, 11, 9},
-    {xmlscm_prod_88_9, 10, 7},
-    {xmlscm_prod_88_10, 9, 5},
-    {xmlscm_prod_88_11, 8, 3},
-    {xmlscm_prod_88_12, 6, 1},
-    {xmlscm_prod_88_13, 4, 1},
-    {xmlscm_prod_88_14, 4, 1},
-    {xmlscm_prod_88_15, 4, 1},
-    {xmlscm_prod_88_16, 4, 1},
-    {xmlscm_prod_88_17, 4, 1}
+    {xmlscm_prod_88_0, 19, 25, {6, 6}},
+    {xmlscm_prod_88_1, 18, 23, {6, 6}},
+    {xmlscm_prod_88_2, 17, 21, {6, 6}},
+    {xmlscm_prod_88_3, 16, 19, {5, 6}},
+    {xmlscm_prod_88_4, 15, 17, {5, 5}},
+    {xmlscm_prod_88_5, 14, 15, {5, 5}},
+    {xmlscm_prod_88_6, 13, 13, {5, 5}},
+    {xmlscm_prod_88_7, 12, 11, {5, 5}},
+    {xmlscm_prod_88_8, 11, 9, {5, 5}},
+    {xmlscm_prod_88_9, 10, 7, {5, 5}},
+    {xmlscm_prod_88_10, 9, 5, {5, 5}},
+    {xmlscm_prod_88_11, 8, 3, {4, 5}},
+    {xmlscm_prod_88_12, 6, 1, {4, 4}},
+    {xmlscm_prod_88_13, 4, 1, {3, 4}},
+    {xmlscm_prod_88_14, 4, 1, {3, 4}},
+    {xmlscm_prod_88_15, 4, 1, {3, 4}},
+    {xmlscm_prod_88_16, 4, 1, {3, 4}},
+    {xmlscm_prod_88_17, 4, 1, {3, 4}}
 };
 
 static CONST Production xmlscm_prod_89_0[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6345,8 +6345,8 @@ static CONST Production xmlscm_prod_89_0[11] =
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 15}},
@@ -6361,8 +6361,8 @@ static CONST Production xmlscm_prod_89_0[11] =
 static CONST Production xmlscm_prod_89_1[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6382,8 +6382,8 @@ static CONST Production xmlscm_prod_89_1[10] =
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 15}},
@@ -6395,8 +6395,8 @@ static CONST Production xmlscm_prod_89_1[10] =
 static CONST Production xmlscm_prod_89_2[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6416,8 +6416,8 @@ static CONST Production xmlscm_prod_89_2[9] =
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 34,
         {0, 15}}
@@ -6426,8 +6426,8 @@ static CONST Production xmlscm_prod_89_2[9] =
 static CONST Production xmlscm_prod_89_3[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6447,15 +6447,15 @@ static CONST Production xmlscm_prod_89_3[8] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_89_4[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6476,8 +6476,8 @@ static CONST Production xmlscm_prod_89_4[6] =
 static CONST Production xmlscm_prod_89_5[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6498,8 +6498,8 @@ static CONST Production xmlscm_prod_89_5[6] =
 static CONST Production xmlscm_prod_89_6[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6520,8 +6520,8 @@ static CONST Production xmlscm_prod_89_6[6] =
 static CONST Production xmlscm_prod_89_7[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6542,8 +6542,8 @@ static CONST Production xmlscm_prod_89_7[6] =
 static CONST Production xmlscm_prod_89_8[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6564,8 +6564,8 @@ static CONST Production xmlscm_prod_89_8[6] =
 static CONST Production xmlscm_prod_89_9[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 90,
         {3, 51}},
@@ -6585,29 +6585,29 @@ static CONST Production xmlscm_prod_89_9[6] =
 
 static CONST GrammarRule xmlscm_rule_89[10] =
 {
-    {xmlscm_prod_89_0, 11, 9},
-    {xmlscm_prod_89_1, 10, 7},
-    {xmlscm_prod_89_2, 9, 5},
-    {xmlscm_prod_89_3, 8, 3},
-    {xmlscm_prod_89_4, 6, 1},
-    {xmlscm_prod_89_5, 6, 1},
-    {xmlscm_prod_89_6, 6, 1},
-    {xmlscm_prod_89_7, 6, 1},
-    {xmlscm_prod_89_8, 6, 1},
-    {xmlscm_prod_89_9, 6, 1}
+    {xmlscm_prod_89_0, 11, 9, {5, 5}},
+    {xmlscm_prod_89_1, 10, 7, {5, 5}},
+    {xmlscm_prod_89_2, 9, 5, {5, 5}},
+    {xmlscm_prod_89_3, 8, 3, {4, 5}},
+    {xmlscm_prod_89_4, 6, 1, {4, 4}},
+    {xmlscm_prod_89_5, 6, 1, {4, 4}},
+    {xmlscm_prod_89_6, 6, 1, {4, 4}},
+    {xmlscm_prod_89_7, 6, 1, {4, 4}},
+    {xmlscm_prod_89_8, 6, 1, {4, 4}},
+    {xmlscm_prod_89_9, 6, 1, {4, 4}}
 };
 
 static CONST Production xmlscm_prod_90_0[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 56,
         {0, 20}},
@@ -6628,14 +6628,14 @@ static CONST Production xmlscm_prod_90_0[8] =
 static CONST Production xmlscm_prod_90_1[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 56,
         {0, 20}},
@@ -6653,14 +6653,14 @@ static CONST Production xmlscm_prod_90_1[7] =
 static CONST Production xmlscm_prod_90_2[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 56,
         {0, 20}},
@@ -6675,14 +6675,14 @@ static CONST Production xmlscm_prod_90_2[6] =
 static CONST Production xmlscm_prod_90_3[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 56,
         {0, 20}},
@@ -6694,14 +6694,14 @@ static CONST Production xmlscm_prod_90_3[5] =
 static CONST Production xmlscm_prod_90_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 56,
         {0, 20}}
@@ -6710,39 +6710,39 @@ static CONST Production xmlscm_prod_90_4[4] =
 static CONST Production xmlscm_prod_90_5[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_90_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_90[7] =
 {
-    {xmlscm_prod_90_0, 8, 13},
-    {xmlscm_prod_90_1, 7, 11},
-    {xmlscm_prod_90_2, 6, 9},
-    {xmlscm_prod_90_3, 5, 7},
-    {xmlscm_prod_90_4, 4, 5},
-    {xmlscm_prod_90_5, 3, 3},
-    {xmlscm_prod_90_6, 1, 1}
+    {xmlscm_prod_90_0, 8, 13, {4, 5}},
+    {xmlscm_prod_90_1, 7, 11, {4, 4}},
+    {xmlscm_prod_90_2, 6, 9, {4, 4}},
+    {xmlscm_prod_90_3, 5, 7, {4, 4}},
+    {xmlscm_prod_90_4, 4, 5, {3, 4}},
+    {xmlscm_prod_90_5, 3, 3, {3, 3}},
+    {xmlscm_prod_90_6, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_91_0[19] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6762,8 +6762,8 @@ static CONST Production xmlscm_prod_91_0[19] =
         503316492, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6802,8 +6802,8 @@ static CONST Production xmlscm_prod_91_0[19] =
 static CONST Production xmlscm_prod_91_1[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6823,8 +6823,8 @@ static CONST Production xmlscm_prod_91_1[18] =
         503316492, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6860,8 +6860,8 @@ static CONST Production xmlscm_prod_91_1[18] =
 static CONST Production xmlscm_prod_91_2[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6881,8 +6881,8 @@ static CONST Production xmlscm_prod_91_2[17] =
         503316492, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6915,8 +6915,8 @@ static CONST Production xmlscm_prod_91_2[17] =
 static CONST Production xmlscm_prod_91_3[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6936,8 +6936,8 @@ static CONST Production xmlscm_prod_91_3[16] =
         503316492, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -6967,8 +6967,8 @@ static CONST Production xmlscm_prod_91_3[16] =
 static CONST Production xmlscm_prod_91_4[15] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -6988,8 +6988,8 @@ static CONST Production xmlscm_prod_91_4[15] =
         503316492, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7016,8 +7016,8 @@ static CONST Production xmlscm_prod_91_4[15] =
 static CONST Production xmlscm_prod_91_5[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7037,8 +7037,8 @@ static CONST Production xmlscm_prod_91_5[14] =
         503316492, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7062,8 +7062,8 @@ static CONST Production xmlscm_prod_91_5[14] =
 static CONST Production xmlscm_prod_91_6[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7083,8 +7083,8 @@ static CONST Production xmlscm_prod_91_6[13] =
         503316492, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7105,8 +7105,8 @@ static CONST Production xmlscm_prod_91_6[13] =
 static CONST Production xmlscm_prod_91_7[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7126,8 +7126,8 @@ static CONST Production xmlscm_prod_91_7[12] =
         503316492, 49,
         {3, 50}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7145,8 +7145,8 @@ static CONST Production xmlscm_prod_91_7[12] =
 static CONST Production xmlscm_prod_91_8[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7166,8 +7166,8 @@ static CONST Production xmlscm_prod_91_8[11] =
         503316492, 49,
         {3, 50}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7182,8 +7182,8 @@ static CONST Production xmlscm_prod_91_8[11] =
 static CONST Production xmlscm_prod_91_9[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7203,8 +7203,8 @@ static CONST Production xmlscm_prod_91_9[10] =
         503316492, 49,
         {3, 50}},
     {
-        369098761, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098761, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}},
@@ -7216,8 +7216,8 @@ static CONST Production xmlscm_prod_91_9[10] =
 static CONST Production xmlscm_prod_91_10[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7237,8 +7237,8 @@ static CONST Production xmlscm_prod_91_10[9] =
         503316492, 49,
         {3, 50}},
     {
-        369098762, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098762, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544331, 10,
         {0, 29}}
@@ -7247,8 +7247,8 @@ static CONST Production xmlscm_prod_91_10[9] =
 static CONST Production xmlscm_prod_91_11[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7268,15 +7268,15 @@ static CONST Production xmlscm_prod_91_11[8] =
         503316492, 49,
         {3, 50}},
     {
-        369098763, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098763, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_91_12[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7297,8 +7297,8 @@ static CONST Production xmlscm_prod_91_12[6] =
 static CONST Production xmlscm_prod_91_13[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7313,8 +7313,8 @@ static CONST Production xmlscm_prod_91_13[4] =
 static CONST Production xmlscm_prod_91_14[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7329,8 +7329,8 @@ static CONST Production xmlscm_prod_91_14[4] =
 static CONST Production xmlscm_prod_91_15[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7345,8 +7345,8 @@ static CONST Production xmlscm_prod_91_15[4] =
 static CONST Production xmlscm_prod_91_16[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7361,8 +7361,8 @@ static CONST Production xmlscm_prod_91_16[4] =
 static CONST Production xmlscm_prod_91_17[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316497, 86,
         {3, 86}},
@@ -7376,31 +7376,31 @@ static CONST Production xmlscm_prod_91_17[4] =
 
 static CONST GrammarRule xmlscm_rule_91[18] =
 {
-    {xmlscm_prod_91_0, 19, 25},
-    {xmlscm_prod_91_1, 18, 23},
-    {xmlscm_prod_91_2, 17, 21},
-    {xmlscm_prod_91_3, 16, 19},
-    {xmlscm_prod_91_4, 15, 17},
-    {xmlscm_prod_91_5, 14, 15},
-    {xmlscm_prod_91_6, 13, 13},
-    {xmlscm_prod_91_7, 12, 11},
-    {xmlscm_prod_91_8, 11, 9},
-    {xmlscm_prod_91_9, 10, 7},
-    {xmlscm_prod_91_10, 9, 5},
-    {xmlscm_prod_91_11, 8, 3},
-    {xmlscm_prod_91_12, 6, 1},
-    {xmlscm_prod_91_13, 4, 1},
-    {xmlscm_prod_91_14, 4, 1},
-    {xmlscm_prod_91_15, 4, 1},
-    {xmlscm_prod_91_16, 4, 1},
-    {xmlscm_prod_91_17, 4, 1}
+    {xmlscm_prod_91_0, 19, 25, {6, 6}},
+    {xmlscm_prod_91_1, 18, 23, {6, 6}},
+    {xmlscm_prod_91_2, 17, 21, {6, 6}},
+    {xmlscm_prod_91_3, 16, 19, {5, 6}},
+    {xmlscm_prod_91_4, 15, 17, {5, 5}},
+    {xmlscm_prod_91_5, 14, 15, {5, 5}},
+    {xmlscm_prod_91_6, 13, 13, {5, 5}},
+    {xmlscm_prod_91_7, 12, 11, {5, 5}},
+    {xmlscm_prod_91_8, 11, 9, {5, 5}},
+    {xmlscm_prod_91_9, 10, 7, {5, 5}},
+    {xmlscm_prod_91_10, 9, 5, {5, 5}},
+    {xmlscm_prod_91_11, 8, 3, {4, 5}},
+    {xmlscm_prod_91_12, 6, 1, {4, 4}},
+    {xmlscm_prod_91_13, 4, 1, {3, 4}},
+    {xmlscm_prod_91_14, 4, 1, {3, 4}},
+    {xmlscm_prod_91_15, 4, 1, {3, 4}},
+    {xmlscm_prod_91_16, 4, 1, {3, 4}},
+    {xmlscm_prod_91_17, 4, 1, {3, 4}}
 };
 
 static CONST Production xmlscm_prod_92_0[2] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 10,
         {0, 2}}
@@ -7409,8 +7409,8 @@ static CONST Production xmlscm_prod_92_0[2] =
 static CONST Production xmlscm_prod_92_1[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7436,8 +7436,8 @@ static CONST Production xmlscm_prod_92_1[11] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -7446,8 +7446,8 @@ static CONST Production xmlscm_prod_92_1[11] =
 static CONST Production xmlscm_prod_92_2[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7473,15 +7473,15 @@ static CONST Production xmlscm_prod_92_2[10] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_92_3[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7508,8 +7508,8 @@ static CONST Production xmlscm_prod_92_3[8] =
 static CONST Production xmlscm_prod_92_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7524,8 +7524,8 @@ static CONST Production xmlscm_prod_92_4[4] =
 static CONST Production xmlscm_prod_92_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7540,8 +7540,8 @@ static CONST Production xmlscm_prod_92_5[4] =
 static CONST Production xmlscm_prod_92_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7556,8 +7556,8 @@ static CONST Production xmlscm_prod_92_6[4] =
 static CONST Production xmlscm_prod_92_7[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7572,8 +7572,8 @@ static CONST Production xmlscm_prod_92_7[4] =
 static CONST Production xmlscm_prod_92_8[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7588,8 +7588,8 @@ static CONST Production xmlscm_prod_92_8[4] =
 static CONST Production xmlscm_prod_92_9[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7604,30 +7604,30 @@ static CONST Production xmlscm_prod_92_9[4] =
 static CONST Production xmlscm_prod_92_10[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_92[11] =
 {
-    {xmlscm_prod_92_0, 2, 4},
-    {xmlscm_prod_92_1, 11, 5},
-    {xmlscm_prod_92_2, 10, 3},
-    {xmlscm_prod_92_3, 8, 1},
-    {xmlscm_prod_92_4, 4, 1},
-    {xmlscm_prod_92_5, 4, 1},
-    {xmlscm_prod_92_6, 4, 1},
-    {xmlscm_prod_92_7, 4, 1},
-    {xmlscm_prod_92_8, 4, 1},
-    {xmlscm_prod_92_9, 4, 1},
-    {xmlscm_prod_92_10, 1, 1}
+    {xmlscm_prod_92_0, 2, 4, {2, 3}},
+    {xmlscm_prod_92_1, 11, 5, {5, 5}},
+    {xmlscm_prod_92_2, 10, 3, {5, 5}},
+    {xmlscm_prod_92_3, 8, 1, {4, 5}},
+    {xmlscm_prod_92_4, 4, 1, {3, 4}},
+    {xmlscm_prod_92_5, 4, 1, {3, 4}},
+    {xmlscm_prod_92_6, 4, 1, {3, 4}},
+    {xmlscm_prod_92_7, 4, 1, {3, 4}},
+    {xmlscm_prod_92_8, 4, 1, {3, 4}},
+    {xmlscm_prod_92_9, 4, 1, {3, 4}},
+    {xmlscm_prod_92_10, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_93_0[2] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 10,
         {0, 2}}
@@ -7636,8 +7636,8 @@ static CONST Production xmlscm_prod_93_0[2] =
 static CONST Production xmlscm_prod_93_1[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7663,8 +7663,8 @@ static CONST Production xmlscm_prod_93_1[11] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -7673,8 +7673,8 @@ static CONST Production xmlscm_prod_93_1[11] =
 static CONST Production xmlscm_prod_93_2[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7700,15 +7700,15 @@ static CONST Production xmlscm_prod_93_2[10] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_93_3[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7735,8 +7735,8 @@ static CONST Production xmlscm_prod_93_3[8] =
 static CONST Production xmlscm_prod_93_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7751,8 +7751,8 @@ static CONST Production xmlscm_prod_93_4[4] =
 static CONST Production xmlscm_prod_93_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7767,8 +7767,8 @@ static CONST Production xmlscm_prod_93_5[4] =
 static CONST Production xmlscm_prod_93_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7783,8 +7783,8 @@ static CONST Production xmlscm_prod_93_6[4] =
 static CONST Production xmlscm_prod_93_7[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7799,8 +7799,8 @@ static CONST Production xmlscm_prod_93_7[4] =
 static CONST Production xmlscm_prod_93_8[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7815,8 +7815,8 @@ static CONST Production xmlscm_prod_93_8[4] =
 static CONST Production xmlscm_prod_93_9[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316490, 74,
         {3, 52}},
@@ -7831,30 +7831,30 @@ static CONST Production xmlscm_prod_93_9[4] =
 static CONST Production xmlscm_prod_93_10[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_93[11] =
 {
-    {xmlscm_prod_93_0, 2, 4},
-    {xmlscm_prod_93_1, 11, 5},
-    {xmlscm_prod_93_2, 10, 3},
-    {xmlscm_prod_93_3, 8, 1},
-    {xmlscm_prod_93_4, 4, 1},
-    {xmlscm_prod_93_5, 4, 1},
-    {xmlscm_prod_93_6, 4, 1},
-    {xmlscm_prod_93_7, 4, 1},
-    {xmlscm_prod_93_8, 4, 1},
-    {xmlscm_prod_93_9, 4, 1},
-    {xmlscm_prod_93_10, 1, 1}
+    {xmlscm_prod_93_0, 2, 4, {2, 3}},
+    {xmlscm_prod_93_1, 11, 5, {5, 5}},
+    {xmlscm_prod_93_2, 10, 3, {5, 5}},
+    {xmlscm_prod_93_3, 8, 1, {4, 5}},
+    {xmlscm_prod_93_4, 4, 1, {3, 4}},
+    {xmlscm_prod_93_5, 4, 1, {3, 4}},
+    {xmlscm_prod_93_6, 4, 1, {3, 4}},
+    {xmlscm_prod_93_7, 4, 1, {3, 4}},
+    {xmlscm_prod_93_8, 4, 1, {3, 4}},
+    {xmlscm_prod_93_9, 4, 1, {3, 4}},
+    {xmlscm_prod_93_10, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_94_0[7] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -7878,8 +7878,8 @@ static CONST Production xmlscm_prod_94_0[7] =
 static CONST Production xmlscm_prod_94_1[6] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -7900,8 +7900,8 @@ static CONST Production xmlscm_prod_94_1[6] =
 static CONST Production xmlscm_prod_94_2[5] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -7919,8 +7919,8 @@ static CONST Production xmlscm_prod_94_2[5] =
 static CONST Production xmlscm_prod_94_3[4] =
 {
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -7935,8 +7935,8 @@ static CONST Production xmlscm_prod_94_3[4] =
 static CONST Production xmlscm_prod_94_4[3] =
 {
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -7948,8 +7948,8 @@ static CONST Production xmlscm_prod_94_4[3] =
 static CONST Production xmlscm_prod_94_5[2] =
 {
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}}
@@ -7958,8 +7958,8 @@ static CONST Production xmlscm_prod_94_5[2] =
 static CONST Production xmlscm_prod_94_6[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -7991,15 +7991,15 @@ static CONST Production xmlscm_prod_94_6[12] =
         503316487, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_94_7[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8032,22 +8032,22 @@ static CONST Production xmlscm_prod_94_7[10] =
 static CONST Production xmlscm_prod_94_8[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_94_9[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_94_10[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8062,8 +8062,8 @@ static CONST Production xmlscm_prod_94_10[4] =
 static CONST Production xmlscm_prod_94_11[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8078,8 +8078,8 @@ static CONST Production xmlscm_prod_94_11[4] =
 static CONST Production xmlscm_prod_94_12[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8094,8 +8094,8 @@ static CONST Production xmlscm_prod_94_12[4] =
 static CONST Production xmlscm_prod_94_13[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8110,8 +8110,8 @@ static CONST Production xmlscm_prod_94_13[4] =
 static CONST Production xmlscm_prod_94_14[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8126,8 +8126,8 @@ static CONST Production xmlscm_prod_94_14[4] =
 static CONST Production xmlscm_prod_94_15[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -8142,36 +8142,36 @@ static CONST Production xmlscm_prod_94_15[4] =
 static CONST Production xmlscm_prod_94_16[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_94[17] =
 {
-    {xmlscm_prod_94_0, 7, 14},
-    {xmlscm_prod_94_1, 6, 12},
-    {xmlscm_prod_94_2, 5, 10},
-    {xmlscm_prod_94_3, 4, 8},
-    {xmlscm_prod_94_4, 3, 6},
-    {xmlscm_prod_94_5, 2, 4},
-    {xmlscm_prod_94_6, 12, 3},
-    {xmlscm_prod_94_7, 10, 1},
-    {xmlscm_prod_94_8, 1, 1},
-    {xmlscm_prod_94_9, 1, 1},
-    {xmlscm_prod_94_10, 4, 1},
-    {xmlscm_prod_94_11, 4, 1},
-    {xmlscm_prod_94_12, 4, 1},
-    {xmlscm_prod_94_13, 4, 1},
-    {xmlscm_prod_94_14, 4, 1},
-    {xmlscm_prod_94_15, 4, 1},
-    {xmlscm_prod_94_16, 1, 1}
+    {xmlscm_prod_94_0, 7, 14, {4, 4}},
+    {xmlscm_prod_94_1, 6, 12, {4, 4}},
+    {xmlscm_prod_94_2, 5, 10, {4, 4}},
+    {xmlscm_prod_94_3, 4, 8, {3, 4}},
+    {xmlscm_prod_94_4, 3, 6, {3, 3}},
+    {xmlscm_prod_94_5, 2, 4, {2, 3}},
+    {xmlscm_prod_94_6, 12, 3, {5, 5}},
+    {xmlscm_prod_94_7, 10, 1, {5, 5}},
+    {xmlscm_prod_94_8, 1, 1, {1, 2}},
+    {xmlscm_prod_94_9, 1, 1, {1, 2}},
+    {xmlscm_prod_94_10, 4, 1, {3, 4}},
+    {xmlscm_prod_94_11, 4, 1, {3, 4}},
+    {xmlscm_prod_94_12, 4, 1, {3, 4}},
+    {xmlscm_prod_94_13, 4, 1, {3, 4}},
+    {xmlscm_prod_94_14, 4, 1, {3, 4}},
+    {xmlscm_prod_94_15, 4, 1, {3, 4}},
+    {xmlscm_prod_94_16, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_95_0[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 91,
         {3, 68}},
@@ -8179,8 +8179,8 @@ static CONST Production xmlscm_prod_95_0[5] =
         503316482, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -8189,8 +8189,8 @@ static CONST Production xmlscm_prod_95_0[5] =
 static CONST Production xmlscm_prod_95_1[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 91,
         {3, 68}},
@@ -8198,15 +8198,15 @@ static CONST Production xmlscm_prod_95_1[4] =
         503316482, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_95_2[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 91,
         {3, 68}}
@@ -8215,8 +8215,8 @@ static CONST Production xmlscm_prod_95_2[2] =
 static CONST Production xmlscm_prod_95_3[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316483, 91,
         {3, 68}}
@@ -8224,17 +8224,17 @@ static CONST Production xmlscm_prod_95_3[2] =
 
 static CONST GrammarRule xmlscm_rule_95[4] =
 {
-    {xmlscm_prod_95_0, 5, 5},
-    {xmlscm_prod_95_1, 4, 3},
-    {xmlscm_prod_95_2, 2, 1},
-    {xmlscm_prod_95_3, 2, 1}
+    {xmlscm_prod_95_0, 5, 5, {4, 4}},
+    {xmlscm_prod_95_1, 4, 3, {3, 4}},
+    {xmlscm_prod_95_2, 2, 1, {2, 3}},
+    {xmlscm_prod_95_3, 2, 1, {2, 3}}
 };
 
 static CONST Production xmlscm_prod_96_0[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8254,8 +8254,8 @@ static CONST Production xmlscm_prod_96_0[9] =
         503316482, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 2,
         {0, 11}}
@@ -8264,8 +8264,8 @@ static CONST Production xmlscm_prod_96_0[9] =
 static CONST Production xmlscm_prod_96_1[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8285,15 +8285,15 @@ static CONST Production xmlscm_prod_96_1[8] =
         503316482, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_96_2[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8314,8 +8314,8 @@ static CONST Production xmlscm_prod_96_2[6] =
 static CONST Production xmlscm_prod_96_3[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8336,8 +8336,8 @@ static CONST Production xmlscm_prod_96_3[6] =
 static CONST Production xmlscm_prod_96_4[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8358,8 +8358,8 @@ static CONST Production xmlscm_prod_96_4[6] =
 static CONST Production xmlscm_prod_96_5[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8380,8 +8380,8 @@ static CONST Production xmlscm_prod_96_5[6] =
 static CONST Production xmlscm_prod_96_6[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8402,8 +8402,8 @@ static CONST Production xmlscm_prod_96_6[6] =
 static CONST Production xmlscm_prod_96_7[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 90,
         {3, 51}},
@@ -8423,21 +8423,21 @@ static CONST Production xmlscm_prod_96_7[6] =
 
 static CONST GrammarRule xmlscm_rule_96[8] =
 {
-    {xmlscm_prod_96_0, 9, 5},
-    {xmlscm_prod_96_1, 8, 3},
-    {xmlscm_prod_96_2, 6, 1},
-    {xmlscm_prod_96_3, 6, 1},
-    {xmlscm_prod_96_4, 6, 1},
-    {xmlscm_prod_96_5, 6, 1},
-    {xmlscm_prod_96_6, 6, 1},
-    {xmlscm_prod_96_7, 6, 1}
+    {xmlscm_prod_96_0, 9, 5, {5, 5}},
+    {xmlscm_prod_96_1, 8, 3, {4, 5}},
+    {xmlscm_prod_96_2, 6, 1, {4, 4}},
+    {xmlscm_prod_96_3, 6, 1, {4, 4}},
+    {xmlscm_prod_96_4, 6, 1, {4, 4}},
+    {xmlscm_prod_96_5, 6, 1, {4, 4}},
+    {xmlscm_prod_96_6, 6, 1, {4, 4}},
+    {xmlscm_prod_96_7, 6, 1, {4, 4}}
 };
 
 static CONST Production xmlscm_prod_97_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}},
@@ -8449,8 +8449,8 @@ static CONST Production xmlscm_prod_97_0[3] =
 static CONST Production xmlscm_prod_97_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}}
@@ -8471,8 +8471,8 @@ static CONST Production xmlscm_prod_97_2[5] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_97_3[3] =
@@ -8491,40 +8491,40 @@ static CONST Production xmlscm_prod_97_3[3] =
 static CONST Production xmlscm_prod_97_4[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_97_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_97_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_97[7] =
 {
-    {xmlscm_prod_97_0, 3, 6},
-    {xmlscm_prod_97_1, 2, 4},
-    {xmlscm_prod_97_2, 5, 2},
-    {xmlscm_prod_97_3, 3, 0},
-    {xmlscm_prod_97_4, 1, 1},
-    {xmlscm_prod_97_5, 1, 1},
-    {xmlscm_prod_97_6, 1, 1}
+    {xmlscm_prod_97_0, 3, 6, {3, 3}},
+    {xmlscm_prod_97_1, 2, 4, {2, 3}},
+    {xmlscm_prod_97_2, 5, 2, {4, 4}},
+    {xmlscm_prod_97_3, 3, 0, {3, 3}},
+    {xmlscm_prod_97_4, 1, 1, {1, 2}},
+    {xmlscm_prod_97_5, 1, 1, {1, 2}},
+    {xmlscm_prod_97_6, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_98_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}},
@@ -8536,8 +8536,8 @@ static CONST Production xmlscm_prod_98_0[3] =
 static CONST Production xmlscm_prod_98_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}}
@@ -8546,8 +8546,8 @@ static CONST Production xmlscm_prod_98_1[2] =
 static CONST Production xmlscm_prod_98_2[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -8561,15 +8561,15 @@ static CONST Production xmlscm_prod_98_2[6] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_98_3[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -8584,8 +8584,8 @@ static CONST Production xmlscm_prod_98_3[4] =
 static CONST Production xmlscm_prod_98_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -8600,8 +8600,8 @@ static CONST Production xmlscm_prod_98_4[4] =
 static CONST Production xmlscm_prod_98_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316486, 74,
         {3, 52}},
@@ -8616,26 +8616,26 @@ static CONST Production xmlscm_prod_98_5[4] =
 static CONST Production xmlscm_prod_98_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_98[7] =
 {
-    {xmlscm_prod_98_0, 3, 6},
-    {xmlscm_prod_98_1, 2, 4},
-    {xmlscm_prod_98_2, 6, 3},
-    {xmlscm_prod_98_3, 4, 1},
-    {xmlscm_prod_98_4, 4, 1},
-    {xmlscm_prod_98_5, 4, 1},
-    {xmlscm_prod_98_6, 1, 1}
+    {xmlscm_prod_98_0, 3, 6, {3, 3}},
+    {xmlscm_prod_98_1, 2, 4, {2, 3}},
+    {xmlscm_prod_98_2, 6, 3, {4, 4}},
+    {xmlscm_prod_98_3, 4, 1, {3, 4}},
+    {xmlscm_prod_98_4, 4, 1, {3, 4}},
+    {xmlscm_prod_98_5, 4, 1, {3, 4}},
+    {xmlscm_prod_98_6, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_99_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 24}},
@@ -8647,8 +8647,8 @@ static CONST Production xmlscm_prod_99_0[3] =
 static CONST Production xmlscm_prod_99_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 13,
         {0, 24}}
@@ -8657,8 +8657,8 @@ static CONST Production xmlscm_prod_99_1[2] =
 static CONST Production xmlscm_prod_99_2[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8675,15 +8675,15 @@ static CONST Production xmlscm_prod_99_2[7] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_99_3[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8704,8 +8704,8 @@ static CONST Production xmlscm_prod_99_3[6] =
 static CONST Production xmlscm_prod_99_4[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8726,8 +8726,8 @@ static CONST Production xmlscm_prod_99_4[6] =
 static CONST Production xmlscm_prod_99_5[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8748,8 +8748,8 @@ static CONST Production xmlscm_prod_99_5[6] =
 static CONST Production xmlscm_prod_99_6[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8770,8 +8770,8 @@ static CONST Production xmlscm_prod_99_6[6] =
 static CONST Production xmlscm_prod_99_7[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 98,
         {3, 56}},
@@ -8791,21 +8791,21 @@ static CONST Production xmlscm_prod_99_7[6] =
 
 static CONST GrammarRule xmlscm_rule_99[8] =
 {
-    {xmlscm_prod_99_0, 3, 6},
-    {xmlscm_prod_99_1, 2, 4},
-    {xmlscm_prod_99_2, 7, 3},
-    {xmlscm_prod_99_3, 6, 1},
-    {xmlscm_prod_99_4, 6, 1},
-    {xmlscm_prod_99_5, 6, 1},
-    {xmlscm_prod_99_6, 6, 1},
-    {xmlscm_prod_99_7, 6, 1}
+    {xmlscm_prod_99_0, 3, 6, {3, 3}},
+    {xmlscm_prod_99_1, 2, 4, {2, 3}},
+    {xmlscm_prod_99_2, 7, 3, {4, 4}},
+    {xmlscm_prod_99_3, 6, 1, {4, 4}},
+    {xmlscm_prod_99_4, 6, 1, {4, 4}},
+    {xmlscm_prod_99_5, 6, 1, {4, 4}},
+    {xmlscm_prod_99_6, 6, 1, {4, 4}},
+    {xmlscm_prod_99_7, 6, 1, {4, 4}}
 };
 
 static CONST Production xmlscm_prod_100_0[8] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8832,8 +8832,8 @@ static CONST Production xmlscm_prod_100_0[8] =
 static CONST Production xmlscm_prod_100_1[7] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8857,8 +8857,8 @@ static CONST Production xmlscm_prod_100_1[7] =
 static CONST Production xmlscm_prod_100_2[6] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8879,8 +8879,8 @@ static CONST Production xmlscm_prod_100_2[6] =
 static CONST Production xmlscm_prod_100_3[5] =
 {
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8898,8 +8898,8 @@ static CONST Production xmlscm_prod_100_3[5] =
 static CONST Production xmlscm_prod_100_4[4] =
 {
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8914,8 +8914,8 @@ static CONST Production xmlscm_prod_100_4[4] =
 static CONST Production xmlscm_prod_100_5[3] =
 {
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}},
@@ -8927,8 +8927,8 @@ static CONST Production xmlscm_prod_100_5[3] =
 static CONST Production xmlscm_prod_100_6[2] =
 {
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544327, 5,
         {0, 17}}
@@ -8937,8 +8937,8 @@ static CONST Production xmlscm_prod_100_6[2] =
 static CONST Production xmlscm_prod_100_7[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -8958,8 +8958,8 @@ static CONST Production xmlscm_prod_100_7[11] =
         503316491, 49,
         {3, 50}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544330, 10,
         {0, 29}},
@@ -8974,8 +8974,8 @@ static CONST Production xmlscm_prod_100_7[11] =
 static CONST Production xmlscm_prod_100_8[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -8995,8 +8995,8 @@ static CONST Production xmlscm_prod_100_8[10] =
         503316491, 49,
         {3, 50}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544330, 10,
         {0, 29}},
@@ -9008,8 +9008,8 @@ static CONST Production xmlscm_prod_100_8[10] =
 static CONST Production xmlscm_prod_100_9[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9029,8 +9029,8 @@ static CONST Production xmlscm_prod_100_9[9] =
         503316491, 49,
         {3, 50}},
     {
-        369098761, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098761, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544330, 10,
         {0, 29}}
@@ -9039,8 +9039,8 @@ static CONST Production xmlscm_prod_100_9[9] =
 static CONST Production xmlscm_prod_100_10[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9060,15 +9060,15 @@ static CONST Production xmlscm_prod_100_10[8] =
         503316491, 49,
         {3, 50}},
     {
-        369098762, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098762, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_100_11[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9089,8 +9089,8 @@ static CONST Production xmlscm_prod_100_11[6] =
 static CONST Production xmlscm_prod_100_12[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9105,8 +9105,8 @@ static CONST Production xmlscm_prod_100_12[4] =
 static CONST Production xmlscm_prod_100_13[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9121,8 +9121,8 @@ static CONST Production xmlscm_prod_100_13[4] =
 static CONST Production xmlscm_prod_100_14[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9137,8 +9137,8 @@ static CONST Production xmlscm_prod_100_14[4] =
 static CONST Production xmlscm_prod_100_15[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9153,8 +9153,8 @@ static CONST Production xmlscm_prod_100_15[4] =
 static CONST Production xmlscm_prod_100_16[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 86,
         {3, 86}},
@@ -9168,30 +9168,30 @@ static CONST Production xmlscm_prod_100_16[4] =
 
 static CONST GrammarRule xmlscm_rule_100[17] =
 {
-    {xmlscm_prod_100_0, 8, 16},
-    {xmlscm_prod_100_1, 7, 14},
-    {xmlscm_prod_100_2, 6, 12},
-    {xmlscm_prod_100_3, 5, 10},
-    {xmlscm_prod_100_4, 4, 8},
-    {xmlscm_prod_100_5, 3, 6},
-    {xmlscm_prod_100_6, 2, 4},
-    {xmlscm_prod_100_7, 11, 9},
-    {xmlscm_prod_100_8, 10, 7},
-    {xmlscm_prod_100_9, 9, 5},
-    {xmlscm_prod_100_10, 8, 3},
-    {xmlscm_prod_100_11, 6, 1},
-    {xmlscm_prod_100_12, 4, 1},
-    {xmlscm_prod_100_13, 4, 1},
-    {xmlscm_prod_100_14, 4, 1},
-    {xmlscm_prod_100_15, 4, 1},
-    {xmlscm_prod_100_16, 4, 1}
+    {xmlscm_prod_100_0, 8, 16, {4, 5}},
+    {xmlscm_prod_100_1, 7, 14, {4, 4}},
+    {xmlscm_prod_100_2, 6, 12, {4, 4}},
+    {xmlscm_prod_100_3, 5, 10, {4, 4}},
+    {xmlscm_prod_100_4, 4, 8, {3, 4}},
+    {xmlscm_prod_100_5, 3, 6, {3, 3}},
+    {xmlscm_prod_100_6, 2, 4, {2, 3}},
+    {xmlscm_prod_100_7, 11, 9, {5, 5}},
+    {xmlscm_prod_100_8, 10, 7, {5, 5}},
+    {xmlscm_prod_100_9, 9, 5, {5, 5}},
+    {xmlscm_prod_100_10, 8, 3, {4, 5}},
+    {xmlscm_prod_100_11, 6, 1, {4, 4}},
+    {xmlscm_prod_100_12, 4, 1, {3, 4}},
+    {xmlscm_prod_100_13, 4, 1, {3, 4}},
+    {xmlscm_prod_100_14, 4, 1, {3, 4}},
+    {xmlscm_prod_100_15, 4, 1, {3, 4}},
+    {xmlscm_prod_100_16, 4, 1, {3, 4}}
 };
 
 static CONST Production xmlscm_prod_101_0[5] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 5,
         {0, 17}},
@@ -9209,8 +9209,8 @@ static CONST Production xmlscm_prod_101_0[5] =
 static CONST Production xmlscm_prod_101_1[4] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 5,
         {0, 17}},
@@ -9225,8 +9225,8 @@ static CONST Production xmlscm_prod_101_1[4] =
 static CONST Production xmlscm_prod_101_2[3] =
 {
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 5,
         {0, 17}},
@@ -9238,8 +9238,8 @@ static CONST Production xmlscm_prod_101_2[3] =
 static CONST Production xmlscm_prod_101_3[2] =
 {
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 5,
         {0, 17}}
@@ -9248,8 +9248,8 @@ static CONST Production xmlscm_prod_101_3[2] =
 static CONST Production xmlscm_prod_101_4[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 60,
         {3, 128}},
@@ -9257,8 +9257,8 @@ static CONST Production xmlscm_prod_101_4[5] =
         503316486, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 29}}
@@ -9267,8 +9267,8 @@ static CONST Production xmlscm_prod_101_4[5] =
 static CONST Production xmlscm_prod_101_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 60,
         {3, 128}},
@@ -9276,15 +9276,15 @@ static CONST Production xmlscm_prod_101_5[4] =
         503316486, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_101_6[2] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 60,
         {3, 128}}
@@ -9293,47 +9293,47 @@ static CONST Production xmlscm_prod_101_6[2] =
 static CONST Production xmlscm_prod_101_7[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_101[8] =
 {
-    {xmlscm_prod_101_0, 5, 10},
-    {xmlscm_prod_101_1, 4, 8},
-    {xmlscm_prod_101_2, 3, 6},
-    {xmlscm_prod_101_3, 2, 4},
-    {xmlscm_prod_101_4, 5, 5},
-    {xmlscm_prod_101_5, 4, 3},
-    {xmlscm_prod_101_6, 2, 1},
-    {xmlscm_prod_101_7, 1, 1}
+    {xmlscm_prod_101_0, 5, 10, {4, 4}},
+    {xmlscm_prod_101_1, 4, 8, {3, 4}},
+    {xmlscm_prod_101_2, 3, 6, {3, 3}},
+    {xmlscm_prod_101_3, 2, 4, {2, 3}},
+    {xmlscm_prod_101_4, 5, 5, {4, 4}},
+    {xmlscm_prod_101_5, 4, 3, {3, 4}},
+    {xmlscm_prod_101_6, 2, 1, {2, 3}},
+    {xmlscm_prod_101_7, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_102_0[1] =
 {
     {
         838860801, 61,
-        {URI_MAX, LN_MAX}}
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_102_1[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_102[2] =
 {
-    {xmlscm_prod_102_0, 1, 0},
-    {xmlscm_prod_102_1, 1, 1}
+    {xmlscm_prod_102_0, 1, 0, {1, 2}},
+    {xmlscm_prod_102_1, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_103_0[3] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}},
@@ -9345,8 +9345,8 @@ static CONST Production xmlscm_prod_103_0[3] =
 static CONST Production xmlscm_prod_103_1[2] =
 {
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 5,
         {0, 17}}
@@ -9355,14 +9355,14 @@ static CONST Production xmlscm_prod_103_1[2] =
 static CONST Production xmlscm_prod_103_2[5] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 13,
         {0, 27}},
@@ -9374,14 +9374,14 @@ static CONST Production xmlscm_prod_103_2[5] =
 static CONST Production xmlscm_prod_103_3[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544324, 13,
         {0, 27}}
@@ -9390,38 +9390,38 @@ static CONST Production xmlscm_prod_103_3[4] =
 static CONST Production xmlscm_prod_103_4[3] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316485, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_103_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_103[6] =
 {
-    {xmlscm_prod_103_0, 3, 6},
-    {xmlscm_prod_103_1, 2, 4},
-    {xmlscm_prod_103_2, 5, 7},
-    {xmlscm_prod_103_3, 4, 5},
-    {xmlscm_prod_103_4, 3, 3},
-    {xmlscm_prod_103_5, 1, 1}
+    {xmlscm_prod_103_0, 3, 6, {3, 3}},
+    {xmlscm_prod_103_1, 2, 4, {2, 3}},
+    {xmlscm_prod_103_2, 5, 7, {4, 4}},
+    {xmlscm_prod_103_3, 4, 5, {3, 4}},
+    {xmlscm_prod_103_4, 3, 3, {3, 3}},
+    {xmlscm_prod_103_5, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_104_0[21] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9456,8 +9456,8 @@ static CONST Production xmlscm_prod_104_0[21] =
         503316489, 57,
         {3, 83}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9487,8 +9487,8 @@ static CONST Production xmlscm_prod_104_0[21] =
 static CONST Production xmlscm_prod_104_1[20] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9523,8 +9523,8 @@ static CONST Production xmlscm_prod_104_1[20] =
         503316489, 57,
         {3, 83}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9551,8 +9551,8 @@ static CONST Production xmlscm_prod_104_1[20] =
 static CONST Production xmlscm_prod_104_2[19] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9587,8 +9587,8 @@ static CONST Production xmlscm_prod_104_2[19] =
         503316489, 57,
         {3, 83}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9612,8 +9612,8 @@ static CONST Production xmlscm_prod_104_2[19] =
 static CONST Production xmlscm_prod_104_3[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9648,8 +9648,8 @@ static CONST Production xmlscm_prod_104_3[18] =
         503316489, 57,
         {3, 83}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9670,8 +9670,8 @@ static CONST Production xmlscm_prod_104_3[18] =
 static CONST Production xmlscm_prod_104_4[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9706,8 +9706,8 @@ static CONST Production xmlscm_prod_104_4[17] =
         503316489, 57,
         {3, 83}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9725,8 +9725,8 @@ static CONST Production xmlscm_prod_104_4[17] =
 static CONST Production xmlscm_prod_104_5[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9761,8 +9761,8 @@ static CONST Production xmlscm_prod_104_5[16] =
         503316489, 57,
         {3, 83}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9777,8 +9777,8 @@ static CONST Production xmlscm_prod_104_5[16] =
 static CONST Production xmlscm_prod_104_6[15] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9813,8 +9813,8 @@ static CONST Production xmlscm_prod_104_6[15] =
         503316489, 57,
         {3, 83}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}},
@@ -9826,8 +9826,8 @@ static CONST Production xmlscm_prod_104_6[15] =
 static CONST Production xmlscm_prod_104_7[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9862,8 +9862,8 @@ static CONST Production xmlscm_prod_104_7[14] =
         503316489, 57,
         {3, 83}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544328, 41,
         {0, 32}}
@@ -9872,8 +9872,8 @@ static CONST Production xmlscm_prod_104_7[14] =
 static CONST Production xmlscm_prod_104_8[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9908,15 +9908,15 @@ static CONST Production xmlscm_prod_104_8[13] =
         503316489, 57,
         {3, 83}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_104_9[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9955,8 +9955,8 @@ static CONST Production xmlscm_prod_104_9[12] =
 static CONST Production xmlscm_prod_104_10[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -9995,8 +9995,8 @@ static CONST Production xmlscm_prod_104_10[12] =
 static CONST Production xmlscm_prod_104_11[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -10035,8 +10035,8 @@ static CONST Production xmlscm_prod_104_11[12] =
 static CONST Production xmlscm_prod_104_12[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316499, 103,
         {3, 104}},
@@ -10075,8 +10075,8 @@ static CONST Production xmlscm_prod_104_12[12] =
 static CONST Production xmlscm_prod_104_13[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10106,8 +10106,8 @@ static CONST Production xmlscm_prod_104_13[9] =
 static CONST Production xmlscm_prod_104_14[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10137,8 +10137,8 @@ static CONST Production xmlscm_prod_104_14[9] =
 static CONST Production xmlscm_prod_104_15[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10168,8 +10168,8 @@ static CONST Production xmlscm_prod_104_15[9] =
 static CONST Production xmlscm_prod_104_16[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10199,8 +10199,8 @@ static CONST Production xmlscm_prod_104_16[9] =
 static CONST Production xmlscm_prod_104_17[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10230,8 +10230,8 @@ static CONST Production xmlscm_prod_104_17[9] =
 static CONST Production xmlscm_prod_104_18[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10261,8 +10261,8 @@ static CONST Production xmlscm_prod_104_18[9] =
 static CONST Production xmlscm_prod_104_19[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10292,8 +10292,8 @@ static CONST Production xmlscm_prod_104_19[9] =
 static CONST Production xmlscm_prod_104_20[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 49,
         {3, 50}},
@@ -10322,34 +10322,34 @@ static CONST Production xmlscm_prod_104_20[9] =
 
 static CONST GrammarRule xmlscm_rule_104[21] =
 {
-    {xmlscm_prod_104_0, 21, 19},
-    {xmlscm_prod_104_1, 20, 17},
-    {xmlscm_prod_104_2, 19, 15},
-    {xmlscm_prod_104_3, 18, 13},
-    {xmlscm_prod_104_4, 17, 11},
-    {xmlscm_prod_104_5, 16, 9},
-    {xmlscm_prod_104_6, 15, 7},
-    {xmlscm_prod_104_7, 14, 5},
-    {xmlscm_prod_104_8, 13, 3},
-    {xmlscm_prod_104_9, 12, 1},
-    {xmlscm_prod_104_10, 12, 1},
-    {xmlscm_prod_104_11, 12, 1},
-    {xmlscm_prod_104_12, 12, 1},
-    {xmlscm_prod_104_13, 9, 1},
-    {xmlscm_prod_104_14, 9, 1},
-    {xmlscm_prod_104_15, 9, 1},
-    {xmlscm_prod_104_16, 9, 1},
-    {xmlscm_prod_104_17, 9, 1},
-    {xmlscm_prod_104_18, 9, 1},
-    {xmlscm_prod_104_19, 9, 1},
-    {xmlscm_prod_104_20, 9, 1}
+    {xmlscm_prod_104_0, 21, 19, {6, 6}},
+    {xmlscm_prod_104_1, 20, 17, {6, 6}},
+    {xmlscm_prod_104_2, 19, 15, {6, 6}},
+    {xmlscm_prod_104_3, 18, 13, {6, 6}},
+    {xmlscm_prod_104_4, 17, 11, {6, 6}},
+    {xmlscm_prod_104_5, 16, 9, {5, 6}},
+    {xmlscm_prod_104_6, 15, 7, {5, 5}},
+    {xmlscm_prod_104_7, 14, 5, {5, 5}},
+    {xmlscm_prod_104_8, 13, 3, {5, 5}},
+    {xmlscm_prod_104_9, 12, 1, {5, 5}},
+    {xmlscm_prod_104_10, 12, 1, {5, 5}},
+    {xmlscm_prod_104_11, 12, 1, {5, 5}},
+    {xmlscm_prod_104_12, 12, 1, {5, 5}},
+    {xmlscm_prod_104_13, 9, 1, {5, 5}},
+    {xmlscm_prod_104_14, 9, 1, {5, 5}},
+    {xmlscm_prod_104_15, 9, 1, {5, 5}},
+    {xmlscm_prod_104_16, 9, 1, {5, 5}},
+    {xmlscm_prod_104_17, 9, 1, {5, 5}},
+    {xmlscm_prod_104_18, 9, 1, {5, 5}},
+    {xmlscm_prod_104_19, 9, 1, {5, 5}},
+    {xmlscm_prod_104_20, 9, 1, {5, 5}}
 };
 
 static CONST Production xmlscm_prod_105_0[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10381,8 +10381,8 @@ static CONST Production xmlscm_prod_105_0[18] =
         503316487, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -10406,8 +10406,8 @@ static CONST Production xmlscm_prod_105_0[18] =
 static CONST Production xmlscm_prod_105_1[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10439,8 +10439,8 @@ static CONST Production xmlscm_prod_105_1[17] =
         503316487, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -10461,8 +10461,8 @@ static CONST Production xmlscm_prod_105_1[17] =
 static CONST Production xmlscm_prod_105_2[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10494,8 +10494,8 @@ static CONST Production xmlscm_prod_105_2[16] =
         503316487, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -10513,8 +10513,8 @@ static CONST Production xmlscm_prod_105_2[16] =
 static CONST Production xmlscm_prod_105_3[15] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10546,8 +10546,8 @@ static CONST Production xmlscm_prod_105_3[15] =
         503316487, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -10562,8 +10562,8 @@ static CONST Production xmlscm_prod_105_3[15] =
 static CONST Production xmlscm_prod_105_4[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10595,8 +10595,8 @@ static CONST Production xmlscm_prod_105_4[14] =
         503316487, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}},
@@ -10608,8 +10608,8 @@ static CONST Production xmlscm_prod_105_4[14] =
 static CONST Production xmlscm_prod_105_5[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10641,8 +10641,8 @@ static CONST Production xmlscm_prod_105_5[13] =
         503316487, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544326, 5,
         {0, 17}}
@@ -10651,8 +10651,8 @@ static CONST Production xmlscm_prod_105_5[13] =
 static CONST Production xmlscm_prod_105_6[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10684,15 +10684,15 @@ static CONST Production xmlscm_prod_105_6[12] =
         503316487, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_105_7[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10725,22 +10725,22 @@ static CONST Production xmlscm_prod_105_7[10] =
 static CONST Production xmlscm_prod_105_8[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_105_9[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_105_10[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10755,8 +10755,8 @@ static CONST Production xmlscm_prod_105_10[4] =
 static CONST Production xmlscm_prod_105_11[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10771,8 +10771,8 @@ static CONST Production xmlscm_prod_105_11[4] =
 static CONST Production xmlscm_prod_105_12[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10787,8 +10787,8 @@ static CONST Production xmlscm_prod_105_12[4] =
 static CONST Production xmlscm_prod_105_13[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10803,8 +10803,8 @@ static CONST Production xmlscm_prod_105_13[4] =
 static CONST Production xmlscm_prod_105_14[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10819,8 +10819,8 @@ static CONST Production xmlscm_prod_105_14[4] =
 static CONST Production xmlscm_prod_105_15[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316496, 74,
         {3, 52}},
@@ -10835,36 +10835,36 @@ static CONST Production xmlscm_prod_105_15[4] =
 static CONST Production xmlscm_prod_105_16[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_105[17] =
 {
-    {xmlscm_prod_105_0, 18, 15},
-    {xmlscm_prod_105_1, 17, 13},
-    {xmlscm_prod_105_2, 16, 11},
-    {xmlscm_prod_105_3, 15, 9},
-    {xmlscm_prod_105_4, 14, 7},
-    {xmlscm_prod_105_5, 13, 5},
-    {xmlscm_prod_105_6, 12, 3},
-    {xmlscm_prod_105_7, 10, 1},
-    {xmlscm_prod_105_8, 1, 1},
-    {xmlscm_prod_105_9, 1, 1},
-    {xmlscm_prod_105_10, 4, 1},
-    {xmlscm_prod_105_11, 4, 1},
-    {xmlscm_prod_105_12, 4, 1},
-    {xmlscm_prod_105_13, 4, 1},
-    {xmlscm_prod_105_14, 4, 1},
-    {xmlscm_prod_105_15, 4, 1},
-    {xmlscm_prod_105_16, 1, 1}
+    {xmlscm_prod_105_0, 18, 15, {6, 6}},
+    {xmlscm_prod_105_1, 17, 13, {6, 6}},
+    {xmlscm_prod_105_2, 16, 11, {5, 6}},
+    {xmlscm_prod_105_3, 15, 9, {5, 5}},
+    {xmlscm_prod_105_4, 14, 7, {5, 5}},
+    {xmlscm_prod_105_5, 13, 5, {5, 5}},
+    {xmlscm_prod_105_6, 12, 3, {5, 5}},
+    {xmlscm_prod_105_7, 10, 1, {5, 5}},
+    {xmlscm_prod_105_8, 1, 1, {1, 2}},
+    {xmlscm_prod_105_9, 1, 1, {1, 2}},
+    {xmlscm_prod_105_10, 4, 1, {3, 4}},
+    {xmlscm_prod_105_11, 4, 1, {3, 4}},
+    {xmlscm_prod_105_12, 4, 1, {3, 4}},
+    {xmlscm_prod_105_13, 4, 1, {3, 4}},
+    {xmlscm_prod_105_14, 4, 1, {3, 4}},
+    {xmlscm_prod_105_15, 4, 1, {3, 4}},
+    {xmlscm_prod_105_16, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_106_0[2] =
 {
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544321, 10,
         {0, 2}}
@@ -10873,8 +10873,8 @@ static CONST Production xmlscm_prod_106_0[2] =
 static CONST Production xmlscm_prod_106_1[24] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -10939,8 +10939,8 @@ static CONST Production xmlscm_prod_106_1[24] =
         503316483, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544322, 2,
         {0, 11}}
@@ -10949,8 +10949,8 @@ static CONST Production xmlscm_prod_106_1[24] =
 static CONST Production xmlscm_prod_106_2[23] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11015,15 +11015,15 @@ static CONST Production xmlscm_prod_106_2[23] =
         503316483, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_106_3[21] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11089,8 +11089,8 @@ static CONST Production xmlscm_prod_106_3[21] =
 static CONST Production xmlscm_prod_106_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11105,8 +11105,8 @@ static CONST Production xmlscm_prod_106_4[4] =
 static CONST Production xmlscm_prod_106_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11121,8 +11121,8 @@ static CONST Production xmlscm_prod_106_5[4] =
 static CONST Production xmlscm_prod_106_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11137,8 +11137,8 @@ static CONST Production xmlscm_prod_106_6[4] =
 static CONST Production xmlscm_prod_106_7[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11153,8 +11153,8 @@ static CONST Production xmlscm_prod_106_7[4] =
 static CONST Production xmlscm_prod_106_8[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11205,8 +11205,8 @@ static CONST Production xmlscm_prod_106_8[16] =
 static CONST Production xmlscm_prod_106_9[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11257,8 +11257,8 @@ static CONST Production xmlscm_prod_106_9[16] =
 static CONST Production xmlscm_prod_106_10[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11309,8 +11309,8 @@ static CONST Production xmlscm_prod_106_10[16] =
 static CONST Production xmlscm_prod_106_11[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11361,8 +11361,8 @@ static CONST Production xmlscm_prod_106_11[16] =
 static CONST Production xmlscm_prod_106_12[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11413,8 +11413,8 @@ static CONST Production xmlscm_prod_106_12[16] =
 static CONST Production xmlscm_prod_106_13[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11465,8 +11465,8 @@ static CONST Production xmlscm_prod_106_13[16] =
 static CONST Production xmlscm_prod_106_14[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11517,8 +11517,8 @@ static CONST Production xmlscm_prod_106_14[16] =
 static CONST Production xmlscm_prod_106_15[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11569,8 +11569,8 @@ static CONST Production xmlscm_prod_106_15[16] =
 static CONST Production xmlscm_prod_106_16[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11621,8 +11621,8 @@ static CONST Production xmlscm_prod_106_16[16] =
 static CONST Production xmlscm_prod_106_17[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11673,8 +11673,8 @@ static CONST Production xmlscm_prod_106_17[16] =
 static CONST Production xmlscm_prod_106_18[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11725,8 +11725,8 @@ static CONST Production xmlscm_prod_106_18[16] =
 static CONST Production xmlscm_prod_106_19[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11777,8 +11777,8 @@ static CONST Production xmlscm_prod_106_19[16] =
 static CONST Production xmlscm_prod_106_20[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11829,8 +11829,8 @@ static CONST Production xmlscm_prod_106_20[16] =
 static CONST Production xmlscm_prod_106_21[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11845,8 +11845,8 @@ static CONST Production xmlscm_prod_106_21[4] =
 static CONST Production xmlscm_prod_106_22[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316503, 74,
         {3, 52}},
@@ -11861,43 +11861,43 @@ static CONST Production xmlscm_prod_106_22[4] =
 static CONST Production xmlscm_prod_106_23[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_106[24] =
 {
-    {xmlscm_prod_106_0, 2, 4},
-    {xmlscm_prod_106_1, 24, 5},
-    {xmlscm_prod_106_2, 23, 3},
-    {xmlscm_prod_106_3, 21, 1},
-    {xmlscm_prod_106_4, 4, 1},
-    {xmlscm_prod_106_5, 4, 1},
-    {xmlscm_prod_106_6, 4, 1},
-    {xmlscm_prod_106_7, 4, 1},
-    {xmlscm_prod_106_8, 16, 1},
-    {xmlscm_prod_106_9, 16, 1},
-    {xmlscm_prod_106_10, 16, 1},
-    {xmlscm_prod_106_11, 16, 1},
-    {xmlscm_prod_106_12, 16, 1},
-    {xmlscm_prod_106_13, 16, 1},
-    {xmlscm_prod_106_14, 16, 1},
-    {xmlscm_prod_106_15, 16, 1},
-    {xmlscm_prod_106_16, 16, 1},
-    {xmlscm_prod_106_17, 16, 1},
-    {xmlscm_prod_106_18, 16, 1},
-    {xmlscm_prod_106_19, 16, 1},
-    {xmlscm_prod_106_20, 16, 1},
-    {xmlscm_prod_106_21, 4, 1},
-    {xmlscm_prod_106_22, 4, 1},
-    {xmlscm_prod_106_23, 1, 1}
+    {xmlscm_prod_106_0, 2, 4, {2, 3}},
+    {xmlscm_prod_106_1, 24, 5, {6, 6}},
+    {xmlscm_prod_106_2, 23, 3, {6, 6}},
+    {xmlscm_prod_106_3, 21, 1, {6, 6}},
+    {xmlscm_prod_106_4, 4, 1, {3, 4}},
+    {xmlscm_prod_106_5, 4, 1, {3, 4}},
+    {xmlscm_prod_106_6, 4, 1, {3, 4}},
+    {xmlscm_prod_106_7, 4, 1, {3, 4}},
+    {xmlscm_prod_106_8, 16, 1, {5, 6}},
+    {xmlscm_prod_106_9, 16, 1, {5, 6}},
+    {xmlscm_prod_106_10, 16, 1, {5, 6}},
+    {xmlscm_prod_106_11, 16, 1, {5, 6}},
+    {xmlscm_prod_106_12, 16, 1, {5, 6}},
+    {xmlscm_prod_106_13, 16, 1, {5, 6}},
+    {xmlscm_prod_106_14, 16, 1, {5, 6}},
+    {xmlscm_prod_106_15, 16, 1, {5, 6}},
+    {xmlscm_prod_106_16, 16, 1, {5, 6}},
+    {xmlscm_prod_106_17, 16, 1, {5, 6}},
+    {xmlscm_prod_106_18, 16, 1, {5, 6}},
+    {xmlscm_prod_106_19, 16, 1, {5, 6}},
+    {xmlscm_prod_106_20, 16, 1, {5, 6}},
+    {xmlscm_prod_106_21, 4, 1, {3, 4}},
+    {xmlscm_prod_106_22, 4, 1, {3, 4}},
+    {xmlscm_prod_106_23, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_107_0[22] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -11917,8 +11917,8 @@ static CONST Production xmlscm_prod_107_0[22] =
         503316495, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -11966,8 +11966,8 @@ static CONST Production xmlscm_prod_107_0[22] =
 static CONST Production xmlscm_prod_107_1[21] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -11987,8 +11987,8 @@ static CONST Production xmlscm_prod_107_1[21] =
         503316495, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12033,8 +12033,8 @@ static CONST Production xmlscm_prod_107_1[21] =
 static CONST Production xmlscm_prod_107_2[20] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12054,8 +12054,8 @@ static CONST Production xmlscm_prod_107_2[20] =
         503316495, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12097,8 +12097,8 @@ static CONST Production xmlscm_prod_107_2[20] =
 static CONST Production xmlscm_prod_107_3[19] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12118,8 +12118,8 @@ static CONST Production xmlscm_prod_107_3[19] =
         503316495, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12158,8 +12158,8 @@ static CONST Production xmlscm_prod_107_3[19] =
 static CONST Production xmlscm_prod_107_4[18] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12179,8 +12179,8 @@ static CONST Production xmlscm_prod_107_4[18] =
         503316495, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12216,8 +12216,8 @@ static CONST Production xmlscm_prod_107_4[18] =
 static CONST Production xmlscm_prod_107_5[17] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12237,8 +12237,8 @@ static CONST Production xmlscm_prod_107_5[17] =
         503316495, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12271,8 +12271,8 @@ static CONST Production xmlscm_prod_107_5[17] =
 static CONST Production xmlscm_prod_107_6[16] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12292,8 +12292,8 @@ static CONST Production xmlscm_prod_107_6[16] =
         503316495, 49,
         {3, 50}},
     {
-        369098758, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098758, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12323,8 +12323,8 @@ static CONST Production xmlscm_prod_107_6[16] =
 static CONST Production xmlscm_prod_107_7[15] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12344,8 +12344,8 @@ static CONST Production xmlscm_prod_107_7[15] =
         503316495, 49,
         {3, 50}},
     {
-        369098759, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098759, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12372,8 +12372,8 @@ static CONST Production xmlscm_prod_107_7[15] =
 static CONST Production xmlscm_prod_107_8[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12393,8 +12393,8 @@ static CONST Production xmlscm_prod_107_8[14] =
         503316495, 49,
         {3, 50}},
     {
-        369098760, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098760, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12418,8 +12418,8 @@ static CONST Production xmlscm_prod_107_8[14] =
 static CONST Production xmlscm_prod_107_9[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12439,8 +12439,8 @@ static CONST Production xmlscm_prod_107_9[13] =
         503316495, 49,
         {3, 50}},
     {
-        369098761, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098761, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12461,8 +12461,8 @@ static CONST Production xmlscm_prod_107_9[13] =
 static CONST Production xmlscm_prod_107_10[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12482,8 +12482,8 @@ static CONST Production xmlscm_prod_107_10[12] =
         503316495, 49,
         {3, 50}},
     {
-        369098762, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098762, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12501,8 +12501,8 @@ static CONST Production xmlscm_prod_107_10[12] =
 static CONST Production xmlscm_prod_107_11[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12522,8 +12522,8 @@ static CONST Production xmlscm_prod_107_11[11] =
         503316495, 49,
         {3, 50}},
     {
-        369098763, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098763, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12538,8 +12538,8 @@ static CONST Production xmlscm_prod_107_11[11] =
 static CONST Production xmlscm_prod_107_12[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12559,8 +12559,8 @@ static CONST Production xmlscm_prod_107_12[10] =
         503316495, 49,
         {3, 50}},
     {
-        369098764, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098764, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}},
@@ -12572,8 +12572,8 @@ static CONST Production xmlscm_prod_107_12[10] =
 static CONST Production xmlscm_prod_107_13[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12593,8 +12593,8 @@ static CONST Production xmlscm_prod_107_13[9] =
         503316495, 49,
         {3, 50}},
     {
-        369098765, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098765, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544334, 10,
         {0, 29}}
@@ -12603,8 +12603,8 @@ static CONST Production xmlscm_prod_107_13[9] =
 static CONST Production xmlscm_prod_107_14[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12624,15 +12624,15 @@ static CONST Production xmlscm_prod_107_14[8] =
         503316495, 49,
         {3, 50}},
     {
-        369098766, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098766, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_107_15[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12653,8 +12653,8 @@ static CONST Production xmlscm_prod_107_15[6] =
 static CONST Production xmlscm_prod_107_16[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12669,8 +12669,8 @@ static CONST Production xmlscm_prod_107_16[4] =
 static CONST Production xmlscm_prod_107_17[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12685,8 +12685,8 @@ static CONST Production xmlscm_prod_107_17[4] =
 static CONST Production xmlscm_prod_107_18[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12701,8 +12701,8 @@ static CONST Production xmlscm_prod_107_18[4] =
 static CONST Production xmlscm_prod_107_19[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12717,8 +12717,8 @@ static CONST Production xmlscm_prod_107_19[4] =
 static CONST Production xmlscm_prod_107_20[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316500, 86,
         {3, 86}},
@@ -12732,34 +12732,34 @@ static CONST Production xmlscm_prod_107_20[4] =
 
 static CONST GrammarRule xmlscm_rule_107[21] =
 {
-    {xmlscm_prod_107_0, 22, 31},
-    {xmlscm_prod_107_1, 21, 29},
-    {xmlscm_prod_107_2, 20, 27},
-    {xmlscm_prod_107_3, 19, 25},
-    {xmlscm_prod_107_4, 18, 23},
-    {xmlscm_prod_107_5, 17, 21},
-    {xmlscm_prod_107_6, 16, 19},
-    {xmlscm_prod_107_7, 15, 17},
-    {xmlscm_prod_107_8, 14, 15},
-    {xmlscm_prod_107_9, 13, 13},
-    {xmlscm_prod_107_10, 12, 11},
-    {xmlscm_prod_107_11, 11, 9},
-    {xmlscm_prod_107_12, 10, 7},
-    {xmlscm_prod_107_13, 9, 5},
-    {xmlscm_prod_107_14, 8, 3},
-    {xmlscm_prod_107_15, 6, 1},
-    {xmlscm_prod_107_16, 4, 1},
-    {xmlscm_prod_107_17, 4, 1},
-    {xmlscm_prod_107_18, 4, 1},
-    {xmlscm_prod_107_19, 4, 1},
-    {xmlscm_prod_107_20, 4, 1}
+    {xmlscm_prod_107_0, 22, 31, {6, 6}},
+    {xmlscm_prod_107_1, 21, 29, {6, 6}},
+    {xmlscm_prod_107_2, 20, 27, {6, 6}},
+    {xmlscm_prod_107_3, 19, 25, {6, 6}},
+    {xmlscm_prod_107_4, 18, 23, {6, 6}},
+    {xmlscm_prod_107_5, 17, 21, {6, 6}},
+    {xmlscm_prod_107_6, 16, 19, {5, 6}},
+    {xmlscm_prod_107_7, 15, 17, {5, 5}},
+    {xmlscm_prod_107_8, 14, 15, {5, 5}},
+    {xmlscm_prod_107_9, 13, 13, {5, 5}},
+    {xmlscm_prod_107_10, 12, 11, {5, 5}},
+    {xmlscm_prod_107_11, 11, 9, {5, 5}},
+    {xmlscm_prod_107_12, 10, 7, {5, 5}},
+    {xmlscm_prod_107_13, 9, 5, {5, 5}},
+    {xmlscm_prod_107_14, 8, 3, {4, 5}},
+    {xmlscm_prod_107_15, 6, 1, {4, 4}},
+    {xmlscm_prod_107_16, 4, 1, {3, 4}},
+    {xmlscm_prod_107_17, 4, 1, {3, 4}},
+    {xmlscm_prod_107_18, 4, 1, {3, 4}},
+    {xmlscm_prod_107_19, 4, 1, {3, 4}},
+    {xmlscm_prod_107_20, 4, 1, {3, 4}}
 };
 
 static CONST Production xmlscm_prod_108_0[14] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12782,8 +12782,8 @@ static CONST Production xmlscm_prod_108_0[14] =
         503316486, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -12804,8 +12804,8 @@ static CONST Production xmlscm_prod_108_0[14] =
 static CONST Production xmlscm_prod_108_1[13] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12828,8 +12828,8 @@ static CONST Production xmlscm_prod_108_1[13] =
         503316486, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -12847,8 +12847,8 @@ static CONST Production xmlscm_prod_108_1[13] =
 static CONST Production xmlscm_prod_108_2[12] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12871,8 +12871,8 @@ static CONST Production xmlscm_prod_108_2[12] =
         503316486, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -12887,8 +12887,8 @@ static CONST Production xmlscm_prod_108_2[12] =
 static CONST Production xmlscm_prod_108_3[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12911,8 +12911,8 @@ static CONST Production xmlscm_prod_108_3[11] =
         503316486, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -12924,8 +12924,8 @@ static CONST Production xmlscm_prod_108_3[11] =
 static CONST Production xmlscm_prod_108_4[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12948,8 +12948,8 @@ static CONST Production xmlscm_prod_108_4[10] =
         503316486, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}}
@@ -12958,8 +12958,8 @@ static CONST Production xmlscm_prod_108_4[10] =
 static CONST Production xmlscm_prod_108_5[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -12982,15 +12982,15 @@ static CONST Production xmlscm_prod_108_5[9] =
         503316486, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_108_6[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13014,8 +13014,8 @@ static CONST Production xmlscm_prod_108_6[7] =
 static CONST Production xmlscm_prod_108_7[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13039,8 +13039,8 @@ static CONST Production xmlscm_prod_108_7[7] =
 static CONST Production xmlscm_prod_108_8[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13064,8 +13064,8 @@ static CONST Production xmlscm_prod_108_8[7] =
 static CONST Production xmlscm_prod_108_9[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13089,8 +13089,8 @@ static CONST Production xmlscm_prod_108_9[7] =
 static CONST Production xmlscm_prod_108_10[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13114,8 +13114,8 @@ static CONST Production xmlscm_prod_108_10[7] =
 static CONST Production xmlscm_prod_108_11[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13139,8 +13139,8 @@ static CONST Production xmlscm_prod_108_11[7] =
 static CONST Production xmlscm_prod_108_12[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316492, 90,
         {3, 51}},
@@ -13163,26 +13163,26 @@ static CONST Production xmlscm_prod_108_12[7] =
 
 static CONST GrammarRule xmlscm_rule_108[13] =
 {
-    {xmlscm_prod_108_0, 14, 13},
-    {xmlscm_prod_108_1, 13, 11},
-    {xmlscm_prod_108_2, 12, 9},
-    {xmlscm_prod_108_3, 11, 7},
-    {xmlscm_prod_108_4, 10, 5},
-    {xmlscm_prod_108_5, 9, 3},
-    {xmlscm_prod_108_6, 7, 1},
-    {xmlscm_prod_108_7, 7, 1},
-    {xmlscm_prod_108_8, 7, 1},
-    {xmlscm_prod_108_9, 7, 1},
-    {xmlscm_prod_108_10, 7, 1},
-    {xmlscm_prod_108_11, 7, 1},
-    {xmlscm_prod_108_12, 7, 1}
+    {xmlscm_prod_108_0, 14, 13, {5, 5}},
+    {xmlscm_prod_108_1, 13, 11, {5, 5}},
+    {xmlscm_prod_108_2, 12, 9, {5, 5}},
+    {xmlscm_prod_108_3, 11, 7, {5, 5}},
+    {xmlscm_prod_108_4, 10, 5, {5, 5}},
+    {xmlscm_prod_108_5, 9, 3, {5, 5}},
+    {xmlscm_prod_108_6, 7, 1, {4, 4}},
+    {xmlscm_prod_108_7, 7, 1, {4, 4}},
+    {xmlscm_prod_108_8, 7, 1, {4, 4}},
+    {xmlscm_prod_108_9, 7, 1, {4, 4}},
+    {xmlscm_prod_108_10, 7, 1, {4, 4}},
+    {xmlscm_prod_108_11, 7, 1, {4, 4}},
+    {xmlscm_prod_108_12, 7, 1, {4, 4}}
 };
 
 static CONST Production xmlscm_prod_109_0[11] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13196,8 +13196,8 @@ static CONST Production xmlscm_prod_109_0[11] =
         503316486, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -13218,8 +13218,8 @@ static CONST Production xmlscm_prod_109_0[11] =
 static CONST Production xmlscm_prod_109_1[10] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13233,8 +13233,8 @@ static CONST Production xmlscm_prod_109_1[10] =
         503316486, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -13252,8 +13252,8 @@ static CONST Production xmlscm_prod_109_1[10] =
 static CONST Production xmlscm_prod_109_2[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13267,8 +13267,8 @@ static CONST Production xmlscm_prod_109_2[9] =
         503316486, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -13283,8 +13283,8 @@ static CONST Production xmlscm_prod_109_2[9] =
 static CONST Production xmlscm_prod_109_3[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13298,8 +13298,8 @@ static CONST Production xmlscm_prod_109_3[8] =
         503316486, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}},
@@ -13311,8 +13311,8 @@ static CONST Production xmlscm_prod_109_3[8] =
 static CONST Production xmlscm_prod_109_4[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13326,8 +13326,8 @@ static CONST Production xmlscm_prod_109_4[7] =
         503316486, 49,
         {3, 50}},
     {
-        369098756, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098756, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544325, 10,
         {0, 22}}
@@ -13336,8 +13336,8 @@ static CONST Production xmlscm_prod_109_4[7] =
 static CONST Production xmlscm_prod_109_5[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13351,15 +13351,15 @@ static CONST Production xmlscm_prod_109_5[6] =
         503316486, 49,
         {3, 50}},
     {
-        369098757, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098757, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_109_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316489, 89,
         {3, 120}},
@@ -13374,43 +13374,43 @@ static CONST Production xmlscm_prod_109_6[4] =
 static CONST Production xmlscm_prod_109_7[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_109_8[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_109_9[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_109[10] =
 {
-    {xmlscm_prod_109_0, 11, 13},
-    {xmlscm_prod_109_1, 10, 11},
-    {xmlscm_prod_109_2, 9, 9},
-    {xmlscm_prod_109_3, 8, 7},
-    {xmlscm_prod_109_4, 7, 5},
-    {xmlscm_prod_109_5, 6, 3},
-    {xmlscm_prod_109_6, 4, 1},
-    {xmlscm_prod_109_7, 1, 1},
-    {xmlscm_prod_109_8, 1, 1},
-    {xmlscm_prod_109_9, 1, 1}
+    {xmlscm_prod_109_0, 11, 13, {5, 5}},
+    {xmlscm_prod_109_1, 10, 11, {5, 5}},
+    {xmlscm_prod_109_2, 9, 9, {5, 5}},
+    {xmlscm_prod_109_3, 8, 7, {4, 5}},
+    {xmlscm_prod_109_4, 7, 5, {4, 4}},
+    {xmlscm_prod_109_5, 6, 3, {4, 4}},
+    {xmlscm_prod_109_6, 4, 1, {3, 4}},
+    {xmlscm_prod_109_7, 1, 1, {1, 2}},
+    {xmlscm_prod_109_8, 1, 1, {1, 2}},
+    {xmlscm_prod_109_9, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_110_0[9] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13424,8 +13424,8 @@ static CONST Production xmlscm_prod_110_0[9] =
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 10,
         {0, 22}},
@@ -13440,8 +13440,8 @@ static CONST Production xmlscm_prod_110_0[9] =
 static CONST Production xmlscm_prod_110_1[8] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13455,8 +13455,8 @@ static CONST Production xmlscm_prod_110_1[8] =
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 10,
         {0, 22}},
@@ -13468,8 +13468,8 @@ static CONST Production xmlscm_prod_110_1[8] =
 static CONST Production xmlscm_prod_110_2[7] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13483,8 +13483,8 @@ static CONST Production xmlscm_prod_110_2[7] =
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 10,
         {0, 22}}
@@ -13493,8 +13493,8 @@ static CONST Production xmlscm_prod_110_2[7] =
 static CONST Production xmlscm_prod_110_3[6] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13508,15 +13508,15 @@ static CONST Production xmlscm_prod_110_3[6] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_110_4[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13531,8 +13531,8 @@ static CONST Production xmlscm_prod_110_4[4] =
 static CONST Production xmlscm_prod_110_5[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13547,8 +13547,8 @@ static CONST Production xmlscm_prod_110_5[4] =
 static CONST Production xmlscm_prod_110_6[4] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316487, 74,
         {3, 52}},
@@ -13563,20 +13563,20 @@ static CONST Production xmlscm_prod_110_6[4] =
 static CONST Production xmlscm_prod_110_7[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_110[8] =
 {
-    {xmlscm_prod_110_0, 9, 9},
-    {xmlscm_prod_110_1, 8, 7},
-    {xmlscm_prod_110_2, 7, 5},
-    {xmlscm_prod_110_3, 6, 3},
-    {xmlscm_prod_110_4, 4, 1},
-    {xmlscm_prod_110_5, 4, 1},
-    {xmlscm_prod_110_6, 4, 1},
-    {xmlscm_prod_110_7, 1, 1}
+    {xmlscm_prod_110_0, 9, 9, {5, 5}},
+    {xmlscm_prod_110_1, 8, 7, {4, 5}},
+    {xmlscm_prod_110_2, 7, 5, {4, 4}},
+    {xmlscm_prod_110_3, 6, 3, {4, 4}},
+    {xmlscm_prod_110_4, 4, 1, {3, 4}},
+    {xmlscm_prod_110_5, 4, 1, {3, 4}},
+    {xmlscm_prod_110_6, 4, 1, {3, 4}},
+    {xmlscm_prod_110_7, 1, 1, {1, 2}}
 };
 
 static CONST Production xmlscm_prod_111_0[8] =
@@ -13594,8 +13594,8 @@ static CONST Production xmlscm_prod_111_0[8] =
         503316484, 49,
         {3, 50}},
     {
-        369098752, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098752, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}},
@@ -13622,8 +13622,8 @@ static CONST Production xmlscm_prod_111_1[7] =
         503316484, 49,
         {3, 50}},
     {
-        369098753, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098753, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}},
@@ -13647,8 +13647,8 @@ static CONST Production xmlscm_prod_111_2[6] =
         503316484, 49,
         {3, 50}},
     {
-        369098754, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        369098754, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         335544323, 5,
         {0, 17}}
@@ -13669,8 +13669,8 @@ static CONST Production xmlscm_prod_111_3[5] =
         503316484, 49,
         {3, 50}},
     {
-        369098755, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        369098755, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_111_4[3] =
@@ -13689,34 +13689,34 @@ static CONST Production xmlscm_prod_111_4[3] =
 static CONST Production xmlscm_prod_111_5[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_111_6[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST Production xmlscm_prod_111_7[1] =
 {
     {
-        687865855, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        687865855, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_rule_111[8] =
 {
-    {xmlscm_prod_111_0, 8, 8},
-    {xmlscm_prod_111_1, 7, 6},
-    {xmlscm_prod_111_2, 6, 4},
-    {xmlscm_prod_111_3, 5, 2},
-    {xmlscm_prod_111_4, 3, 0},
-    {xmlscm_prod_111_5, 1, 1},
-    {xmlscm_prod_111_6, 1, 1},
-    {xmlscm_prod_111_7, 1, 1}
+    {xmlscm_prod_111_0, 8, 8, {4, 5}},
+    {xmlscm_prod_111_1, 7, 6, {4, 4}},
+    {xmlscm_prod_111_2, 6, 4, {4, 4}},
+    {xmlscm_prod_111_3, 5, 2, {4, 4}},
+    {xmlscm_prod_111_4, 3, 0, {3, 3}},
+    {xmlscm_prod_111_5, 1, 1, {1, 2}},
+    {xmlscm_prod_111_6, 1, 1, {1, 2}},
+    {xmlscm_prod_111_7, 1, 1, {1, 2}}
 };
 
 static CONST EXIGrammar xmlscm_grammarTable[117] =
@@ -15218,8 +15218,8 @@ static CONST UriEntry xmlscm_uriEntry[14] =
 static CONST Production xmlscm_prod_doc_content[42] =
 {
     {
-        536870913, INDEX_MAX,
-        {URI_MAX, LN_MAX}},
+        536870913, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}},
     {
         503316481, 67,
         {3, 138}},
@@ -15348,14 +15348,14 @@ static CONST Production xmlscm_prod_doc_content[42] =
 static CONST Production xmlscm_prod_doc_end[1] =
 {
     {
-        0xAFFFFFF, INDEX_MAX,
-        {URI_MAX, LN_MAX}}
+        0xAFFFFFF, PROD_TYPE_ID_MAX,
+        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}
 };
 
 static CONST GrammarRule xmlscm_docGrammarRule[2] =
 {
-    {xmlscm_prod_doc_content, 42, 0},
-    {xmlscm_prod_doc_end, 1, 0}
+    {xmlscm_prod_doc_content, 42, 0, {7, 7}},
+    {xmlscm_prod_doc_end, 1, 0, {1, 2}}
 };
 
 static CONST SimpleType xmlscm_simpleTypes[62] =
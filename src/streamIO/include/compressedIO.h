@@ -0,0 +1,152 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file compressedIO.h
+ * @brief Reading and writing the octets of the EXI channels (compression and
+ * pre-compression alignment) from/to the BinaryBuffer of the application.
+ * With compression the octets are DEFLATE-compressed (RFC 1951) using zlib.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#ifndef COMPRESSEDIO_H_
+#define COMPRESSEDIO_H_
+
+#include "errorHandle.h"
+#include "procTypes.h"
+
+#if COMPRESSION_USE
+
+#include <zlib.h>
+
+/**
+ * A growing array of octets
+ */
+struct octetBuffer
+{
+	char* buf;
+	/** The number of octets stored */
+	Index size;
+	/** The allocated size of buf */
+	Index capacity;
+};
+
+typedef struct octetBuffer OctetBuffer;
+
+/**
+ * The EXI stream of the application (after the header) when the body is
+ * organized in channels
+ */
+struct compressedIO
+{
+	/** The BinaryBuffer of the application */
+	BinaryBuffer io;
+
+	/** The current position in io.buf */
+	Index ioIndx;
+
+	/** TRUE for compression, FALSE for pre-compression */
+	boolean deflate;
+
+	/** Whether zs is initialized for deflate (encoding) */
+	boolean zDeflateInit;
+
+	/** Whether zs is initialized for inflate (decoding) */
+	boolean zInflateInit;
+
+	z_stream zs;
+};
+
+typedef struct compressedIO CompressedIO;
+
+/**
+ * @brief Appends octets at the end of an OctetBuffer. The buffer grows
+ * by doubling its capacity.
+ *
+ * @param[in, out] ob the octet buffer
+ * @param[in] data the octets to append
+ * @param[in] size the number of octets to append
+ * @return Error handling code
+ */
+errorCode appendOctets(OctetBuffer* ob, const char* data, Index size);
+
+/**
+ * @brief Frees the memory of an OctetBuffer
+ *
+ * @param[in, out] ob the octet buffer
+ */
+void freeOctets(OctetBuffer* ob);
+
+/**
+ * @brief Sets up a CompressedIO on top of the BinaryBuffer of the application
+ *
+ * @param[out] cio the compressed stream
+ * @param[in] io the BinaryBuffer of the application
+ * @param[in] ioIndx the position of the first octet of the body in io.buf
+ * @param[in] deflate TRUE for compression, FALSE for pre-compression
+ */
+void initCompressedIO(CompressedIO* cio, BinaryBuffer io, Index ioIndx, boolean deflate);
+
+/**
+ * @brief Starts a new DEFLATE stream. No-op for pre-compression
+ *
+ * @param[in, out] cio the compressed stream
+ * @return Error handling code
+ */
+errorCode beginCompressedStream(CompressedIO* cio);
+
+/**
+ * @brief Writes octets to the current DEFLATE stream (or as they are for pre-compression).
+ * When io.buf is full it is flushed with io.ioStrm.readWriteToStream
+ *
+ * @param[in, out] cio the compressed stream
+ * @param[in] data the octets to write
+ * @param[in] size the number of octets
+ * @return Error handling code; EXIP_BUFFER_END_REACHED if io.buf is full and there is no output stream
+ */
+errorCode writeCompressedStream(CompressedIO* cio, const char* data, Index size);
+
+/**
+ * @brief Writes the octets in io.buf to the output stream of the application
+ * with io.ioStrm.readWriteToStream and starts over at the beginning of io.buf
+ *
+ * @param[in, out] cio the compressed stream
+ * @return Error handling code; EXIP_BUFFER_END_REACHED if there is no output stream
+ */
+errorCode flushCompressedIO(CompressedIO* cio);
+
+/**
+ * @brief Completes the current DEFLATE stream. No-op for pre-compression
+ *
+ * @param[in, out] cio the compressed stream
+ * @return Error handling code
+ */
+errorCode endCompressedStream(CompressedIO* cio);
+
+/**
+ * @brief Inflates the next DEFLATE stream of the input as a whole. io.buf is refilled
+ * with io.ioStrm.readWriteToStream when its content is consumed.
+ *
+ * @param[in, out] cio the compressed stream
+ * @param[out] dst receives the inflated octets (its previous content is discarded)
+ * @return Error handling code
+ */
+errorCode readCompressedStream(CompressedIO* cio, OctetBuffer* dst);
+
+/**
+ * @brief Frees the zlib state of a CompressedIO
+ *
+ * @param[in, out] cio the compressed stream
+ */
+void destroyCompressedIO(CompressedIO* cio);
+
+#endif /* COMPRESSION_USE */
+
+#endif /* COMPRESSEDIO_H_ */
@@ -21,6 +21,60 @@
 #include "procTypes.h"
 #include "errorHandle.h"
 
+#if STREAM_WORD_IO_USE
+/**
+ * @name Word-at-a-time stream access
+ *
+ * @def STREAM_WORD_BYTES
+ * 		The size in bytes of the window loaded from the EXI buffer
+ * @def LOAD_WORD_BE(p, w)
+ * 		Loads the STREAM_WORD_BYTES bytes starting at p (no alignment required)
+ * 		into the uint64_t w so that p[0] ends up in the most significant byte
+ * @def STORE_WORD_BE(p, w)
+ * 		The reverse of LOAD_WORD_BE: stores the uint64_t w at p with the
+ * 		most significant byte first. Modifies w.
+ */
+/**@{*/
+# define STREAM_WORD_BYTES 8
+
+# if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define LOAD_WORD_BE(p, w) do { memcpy(&(w), (p), STREAM_WORD_BYTES); (w) = __builtin_bswap64(w); } while(0)
+#  define STORE_WORD_BE(p, w) do { (w) = __builtin_bswap64(w); memcpy((p), &(w), STREAM_WORD_BYTES); } while(0)
+# elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#  define LOAD_WORD_BE(p, w) memcpy(&(w), (p), STREAM_WORD_BYTES)
+#  define STORE_WORD_BE(p, w) memcpy((p), &(w), STREAM_WORD_BYTES)
+# elif defined(_MSC_VER)
+#  define LOAD_WORD_BE(p, w) do { memcpy(&(w), (p), STREAM_WORD_BYTES); (w) = _byteswap_uint64(w); } while(0)
+#  define STORE_WORD_BE(p, w) do { (w) = _byteswap_uint64(w); memcpy((p), &(w), STREAM_WORD_BYTES); } while(0)
+# else
+#  define LOAD_WORD_BE(p, w) ((w) = ((uint64_t) (p)[0] << 56) | ((uint64_t) (p)[1] << 48) | \
+								((uint64_t) (p)[2] << 40) | ((uint64_t) (p)[3] << 32) | \
+								((uint64_t) (p)[4] << 24) | ((uint64_t) (p)[5] << 16) | \
+								((uint64_t) (p)[6] << 8)  |  (uint64_t) (p)[7])
+#  define STORE_WORD_BE(p, w) do { int _b; for(_b = STREAM_WORD_BYTES - 1; _b >= 0; _b--) { \
+								(p)[_b] = (unsigned char) ((w) & 0xFF); (w) = (w) >> 8; } } while(0)
+# endif
+/**@}*/
+
+/**
+ * Whether the SSE2 intrinsics are available for scanning 16 octets of the buffer at once */
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define STREAM_SSE2_USE ON
+# endif
+#endif
+
+#ifndef STREAM_SSE2_USE
+# define STREAM_SSE2_USE OFF
+#endif
+
+/**
+ * TRUE when the body of the EXI stream is byte-granular: byte-aligned, pre-compression
+ * or compression. The n-bit unsigned integers (including the event codes) then take
+ * whole octets and the bit pointer stays 0.
+ */
+#define IS_BYTE_GRANULAR(strm) (WITH_COMPRESSION((strm)->header.opts.enumOpt) || GET_ALIGNMENT((strm)->header.opts.enumOpt) != BIT_PACKED)
+
 /**
  * @brief Moves the BitPointer with certain positions. Takes care of byteIndex increasing when
  *        the movement cross a byte boundary
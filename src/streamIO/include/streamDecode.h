@@ -83,7 +83,11 @@ errorCode decodeStringOnly(EXIStream* strm, Index str_length, String* string_val
 /**
  * @brief Decode EXI Binary type
  * Decode a binary value as a length-prefixed sequence of octets.
- * Dynamically allocate a memory for the buffer
+ * Dynamically allocate a memory for the buffer that must be freed by the caller.
+ * When BINARY_ZERO_COPY_USE is ON binary_val points instead into the input buffer
+ * of the stream, when the value is byte-aligned and within the buffer content, or
+ * into a buffer owned by the stream (strm->binaryScratch). It must not be freed and
+ * is valid until the next read from the stream.
  *
  * @param[in] strm EXI stream of bits
  * @param[out] binary_val decoded binary value
@@ -92,6 +96,23 @@ errorCode decodeStringOnly(EXIStream* strm, Index str_length, String* string_val
  */
 errorCode decodeBinary(EXIStream* strm, char** binary_val, Index* nbytes);
 
+/**
+ * @brief Decode the next piece of a binary value without materializing the whole value
+ * The length of the value must be decoded beforehand with decodeUnsignedInteger().
+ * When the value is byte-aligned the piece points into the input buffer of the stream and
+ * spans what is left of the buffer content; otherwise it is copied to the scratch buffer.
+ * The input buffer is refilled as needed.
+ *
+ * @param[in, out] strm EXI stream of bits
+ * @param[in] remaining the number of octets of the value not decoded yet; must be > 0
+ * @param[in] scratch a buffer of scratchSize octets used when the value is not byte-aligned
+ * @param[in] scratchSize the size of scratch; must be > 0
+ * @param[out] chunk the octets of the piece; valid until the next read from the stream
+ * @param[out] size the number of octets in the piece, between 1 and remaining
+ * @return Error handling code
+ */
+errorCode decodeBinaryChunk(EXIStream* strm, Index remaining, char* scratch, Index scratchSize, char** chunk, Index* size);
+
 /**
  * @brief Decode EXI (signed) Integer type
  * Decode an arbitrary precision integer using a sign bit followed by a
@@ -39,4 +39,14 @@ errorCode readNextBit(EXIStream* strm, boolean* bit_val);
  */
 errorCode readBits(EXIStream* strm, unsigned char n, unsigned long* bits_val);
 
+/**
+ * @brief Reads the next count octets into dst. When the stream is at a byte boundary the octets
+ * are copied as they are, refilling the buffer as needed; otherwise each is read with readBits()
+ * @param[in, out] strm EXI stream of bits
+ * @param[out] dst where the octets are stored
+ * @param[in] count the number of octets to read
+ * @return Error handling code
+ */
+errorCode readOctets(EXIStream* strm, char* dst, Index count);
+
 #endif /* STREAMREADER_H_ */
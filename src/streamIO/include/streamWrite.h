@@ -38,4 +38,14 @@ errorCode writeNextBit(EXIStream* strm, boolean bit_val);
  */
 errorCode writeNBits(EXIStream* strm, unsigned char nbits, unsigned long bits_val);
 
+/**
+ * @brief Writes count octets to an EXI stream. When the stream is at a byte boundary the octets
+ * are copied as they are, flushing the buffer as needed; otherwise each is written with writeNBits()
+ * @param[out] strm EXI stream of bits
+ * @param[in] src the octets to write
+ * @param[in] count the number of octets
+ * @return Error handling code
+ */
+errorCode writeOctets(EXIStream* strm, const char* src, Index count);
+
 #endif /* STREAMWRITE_H_ */
@@ -0,0 +1,263 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file compressedIO.c
+ * @brief Implementation of the DEFLATE streams of the compression alignment
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include "compressedIO.h"
+
+#if COMPRESSION_USE
+
+/** The initial capacity of an OctetBuffer */
+#define OCTET_BUFFER_INITIAL_SIZE 1024
+
+/** Raw DEFLATE streams (no zlib header and checksum) with a 32KB window */
+#define RAW_DEFLATE_WINDOW_BITS -15
+
+static errorCode reserveOctets(OctetBuffer* ob, Index size);
+
+/**
+ * Makes room for size more octets in an OctetBuffer
+ */
+static errorCode reserveOctets(OctetBuffer* ob, Index size)
+{
+	if(ob->size + size > ob->capacity)
+	{
+		Index capacity = ob->capacity == 0 ? OCTET_BUFFER_INITIAL_SIZE : ob->capacity;
+		char* buf;
+
+		while(capacity < ob->size + size)
+			capacity = 2*capacity;
+
+		buf = (char*) EXIP_REALLOC(ob->buf, capacity);
+		if(buf == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+
+		ob->buf = buf;
+		ob->capacity = capacity;
+	}
+
+	return EXIP_OK;
+}
+
+errorCode appendOctets(OctetBuffer* ob, const char* data, Index size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	TRY(reserveOctets(ob, size));
+
+	memcpy(ob->buf + ob->size, data, size);
+	ob->size += size;
+
+	return EXIP_OK;
+}
+
+void freeOctets(OctetBuffer* ob)
+{
+	if(ob->buf != NULL)
+		EXIP_MFREE(ob->buf);
+
+	ob->buf = NULL;
+	ob->size = 0;
+	ob->capacity = 0;
+}
+
+void initCompressedIO(CompressedIO* cio, BinaryBuffer io, Index ioIndx, boolean deflate)
+{
+	cio->io = io;
+	cio->ioIndx = ioIndx;
+	cio->deflate = deflate;
+	cio->zDeflateInit = FALSE;
+	cio->zInflateInit = FALSE;
+	cio->zs.zalloc = Z_NULL;
+	cio->zs.zfree = Z_NULL;
+	cio->zs.opaque = Z_NULL;
+}
+
+errorCode flushCompressedIO(CompressedIO* cio)
+{
+	if(cio->io.ioStrm.readWriteToStream == NULL)
+		return EXIP_BUFFER_END_REACHED;
+
+	if((Index) cio->io.ioStrm.readWriteToStream(cio->io.buf, cio->ioIndx, cio->io.ioStrm.stream) < cio->ioIndx)
+		return EXIP_BUFFER_END_REACHED;
+
+	cio->ioIndx = 0;
+
+	return EXIP_OK;
+}
+
+errorCode beginCompressedStream(CompressedIO* cio)
+{
+	if(!cio->deflate)
+		return EXIP_OK;
+
+	if(cio->zDeflateInit)
+	{
+		if(deflateReset(&cio->zs) != Z_OK)
+			return EXIP_UNEXPECTED_ERROR;
+	}
+	else
+	{
+		if(deflateInit2(&cio->zs, COMPRESSION_LEVEL, Z_DEFLATED, RAW_DEFLATE_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		cio->zDeflateInit = TRUE;
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * Runs deflate() on the pending input until it is consumed (Z_NO_FLUSH)
+ * or until the stream is complete (Z_FINISH)
+ */
+static errorCode runDeflate(CompressedIO* cio, int flush)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	int ret;
+
+	do
+	{
+		if(cio->ioIndx == cio->io.bufLen)
+			TRY(flushCompressedIO(cio));
+
+		cio->zs.next_out = (Bytef*) cio->io.buf + cio->ioIndx;
+		cio->zs.avail_out = (uInt) (cio->io.bufLen - cio->ioIndx);
+
+		ret = deflate(&cio->zs, flush);
+		if(ret == Z_STREAM_ERROR)
+			return EXIP_UNEXPECTED_ERROR;
+
+		cio->ioIndx = cio->io.bufLen - cio->zs.avail_out;
+	}
+	while(flush == Z_FINISH ? ret != Z_STREAM_END : (cio->zs.avail_in > 0 || cio->zs.avail_out == 0));
+
+	return EXIP_OK;
+}
+
+errorCode writeCompressedStream(CompressedIO* cio, const char* data, Index size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	if(size == 0)
+		return EXIP_OK;
+
+	if(cio->deflate)
+	{
+		cio->zs.next_in = (Bytef*) data;
+		cio->zs.avail_in = (uInt) size;
+
+		return runDeflate(cio, Z_NO_FLUSH);
+	}
+
+	while(size > 0)
+	{
+		Index part;
+
+		if(cio->ioIndx == cio->io.bufLen)
+			TRY(flushCompressedIO(cio));
+
+		part = cio->io.bufLen - cio->ioIndx;
+		if(part > size)
+			part = size;
+
+		memcpy(cio->io.buf + cio->ioIndx, data, part);
+		cio->ioIndx += part;
+		data += part;
+		size -= part;
+	}
+
+	return EXIP_OK;
+}
+
+errorCode endCompressedStream(CompressedIO* cio)
+{
+	if(!cio->deflate)
+		return EXIP_OK;
+
+	cio->zs.next_in = Z_NULL;
+	cio->zs.avail_in = 0;
+
+	return runDeflate(cio, Z_FINISH);
+}
+
+errorCode readCompressedStream(CompressedIO* cio, OctetBuffer* dst)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	int ret;
+
+	if(cio->zInflateInit)
+	{
+		if(inflateReset(&cio->zs) != Z_OK)
+			return EXIP_UNEXPECTED_ERROR;
+	}
+	else
+	{
+		cio->zs.next_in = Z_NULL;
+		cio->zs.avail_in = 0;
+		if(inflateInit2(&cio->zs, RAW_DEFLATE_WINDOW_BITS) != Z_OK)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		cio->zInflateInit = TRUE;
+	}
+
+	dst->size = 0;
+
+	do
+	{
+		if(cio->ioIndx >= cio->io.bufContent)
+		{
+			// The input is consumed: read the next part of the stream
+			if(cio->io.ioStrm.readWriteToStream == NULL)
+				return EXIP_BUFFER_END_REACHED;
+
+			cio->io.bufContent = cio->io.ioStrm.readWriteToStream(cio->io.buf, cio->io.bufLen, cio->io.ioStrm.stream);
+			cio->ioIndx = 0;
+			if(cio->io.bufContent == 0)
+				return EXIP_BUFFER_END_REACHED;
+		}
+
+		if(dst->size == dst->capacity)
+			TRY(reserveOctets(dst, 1));
+
+		cio->zs.next_in = (Bytef*) cio->io.buf + cio->ioIndx;
+		cio->zs.avail_in = (uInt) (cio->io.bufContent - cio->ioIndx);
+		cio->zs.next_out = (Bytef*) dst->buf + dst->size;
+		cio->zs.avail_out = (uInt) (dst->capacity - dst->size);
+
+		ret = inflate(&cio->zs, Z_NO_FLUSH);
+		if(ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+		{
+			DEBUG_MSG(ERROR, DEBUG_STREAM_IO, (">Invalid DEFLATE stream: %d\n", ret));
+			return EXIP_INVALID_EXI_INPUT;
+		}
+
+		cio->ioIndx = cio->io.bufContent - cio->zs.avail_in;
+		dst->size = dst->capacity - cio->zs.avail_out;
+	}
+	while(ret != Z_STREAM_END);
+
+	return EXIP_OK;
+}
+
+void destroyCompressedIO(CompressedIO* cio)
+{
+	if(cio->zDeflateInit)
+		deflateEnd(&cio->zs);
+	if(cio->zInflateInit)
+		inflateEnd(&cio->zs);
+
+	cio->zDeflateInit = FALSE;
+	cio->zInflateInit = FALSE;
+}
+
+#endif /* COMPRESSION_USE */
@@ -21,6 +21,9 @@
 #include "ioUtil.h"
 #include <math.h>
 
+/** The maximum number of octets of an Unsigned Integer that fits into UnsignedInteger */
+#define UINT_MAX_OCTETS ((sizeof(UnsignedInteger)*8 + 6) / 7)
+
 errorCode decodeNBitUnsignedInteger(EXIStream* strm, unsigned char n, unsigned long* int_val)
 {
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (">> (%d-bits uint)", n));
@@ -30,14 +33,15 @@ errorCode decodeNBitUnsignedInteger(EXIStream* strm, unsigned char n, unsigned l
 		return EXIP_OK;
 	}
 
-	if(WITH_COMPRESSION(strm->header.opts.enumOpt) == FALSE && GET_ALIGNMENT(strm->header.opts.enumOpt) == BIT_PACKED)
+	if(!IS_BYTE_GRANULAR(strm))
 	{
 		return readBits(strm, n, int_val);
 	}
 	else
 	{
+		// The minimum number of octets, least significant octet first
 		unsigned int byte_number = ((unsigned int) n) / 8 + (n % 8 != 0);
-		unsigned long tmp_byte_buf = 0;
+		unsigned char* buf;
 		unsigned int i = 0;
 
 		if(strm->buffer.bufContent < strm->context.bufferIndx + byte_number)
@@ -48,13 +52,13 @@ errorCode decodeNBitUnsignedInteger(EXIStream* strm, unsigned char n, unsigned l
 			TRY(readEXIChunkForParsing(strm, byte_number));
 		}
 
-		*int_val = 0;
-		for(i = 0; i < byte_number*8; i += 8)
-		{
-			tmp_byte_buf = strm->buffer.buf[strm->context.bufferIndx] << i;
-			*int_val = *int_val | tmp_byte_buf;
-			strm->context.bufferIndx++;
-		}
+		buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+		strm->context.bufferIndx += byte_number;
+
+		// Event codes and booleans: a single octet
+		*int_val = buf[0];
+		for(i = 1; i < byte_number; i++)
+			*int_val = *int_val | ((unsigned long) buf[i] << 8*i);
 	}
 	return EXIP_OK;
 }
@@ -78,6 +82,80 @@ errorCode decodeUnsignedInteger(EXIStream* strm, UnsignedInteger* int_val)
 	*int_val = 0;
 
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (">> (uint)"));
+
+	if(IS_BYTE_GRANULAR(strm))
+	{
+		// Octets straight from the buffer, refilled when its content is consumed
+		unsigned int octet;
+
+		do
+		{
+			if(strm->buffer.bufContent <= strm->context.bufferIndx)
+				TRY(readEXIChunkForParsing(strm, 1));
+
+			octet = (unsigned char) strm->buffer.buf[strm->context.bufferIndx++];
+			*int_val += ((UnsignedInteger) (octet & 0x7F)) << i;
+			i += 7;
+		}
+		while(octet & 0x80);
+
+		return EXIP_OK;
+	}
+
+#if STREAM_WORD_IO_USE
+	/* Fast path: all the octets of the integer are in the buffer content.
+	 * Unsigned Integers always take whole octets so only bufferIndx moves */
+	if(strm->buffer.bufContent >= strm->context.bufferIndx + STREAM_WORD_BYTES)
+	{
+		unsigned char* buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+		uint64_t window;
+		unsigned int octet;
+
+# if STREAM_SSE2_USE
+		/* Byte-aligned position: the most significant bits of 16 octets at once give the
+		 * position of the terminating octet (the first one with the most significant bit 0) */
+		if(strm->context.bitPointer == 0 && strm->buffer.bufContent >= strm->context.bufferIndx + 16)
+		{
+			unsigned int contMask = (unsigned int) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) buf));
+
+			if((~contMask & ((1 << UINT_MAX_OCTETS) - 1)) != 0)
+			{
+				do
+				{
+					octet = *buf++;
+					*int_val += ((UnsignedInteger) (octet & 0x7F)) << i;
+					i += 7;
+				}
+				while(octet & 0x80);
+
+				strm->context.bufferIndx = (Index) (buf - (unsigned char *) strm->buffer.buf);
+				return EXIP_OK;
+			}
+		}
+# endif
+		/* The shifted word window holds 8 whole octets when the position is
+		 * byte-aligned and 7 otherwise; only use it if one of them terminates the integer */
+		LOAD_WORD_BE(buf, window);
+		window = window << strm->context.bitPointer;
+
+		if((~window & (strm->context.bitPointer == 0 ? 0x8080808080808080ULL : 0x8080808080808000ULL)) != 0)
+		{
+			do
+			{
+				octet = (unsigned int) (window >> 56);
+				*int_val += ((UnsignedInteger) (octet & 0x7F)) << i;
+				i += 7;
+				window = window << 8;
+				strm->context.bufferIndx++;
+			}
+			while(octet & 0x80);
+
+			return EXIP_OK;
+		}
+	}
+#endif
+
+	// Reference implementation: one octet at a time
 	do
 	{
 		TRY(readBits(strm, 8, &tmp_byte_buf));
@@ -101,6 +179,89 @@ errorCode decodeString(EXIStream* strm, String* string_val)
 	return decodeStringOnly(strm,(Index)  string_length, string_val);
 }
 
+/**
+ * @brief Decodes a run of ASCII code points directly from the buffer content
+ * Each ASCII code point is a single octet Unsigned Integer. The run stops before the
+ * first code point that is not ASCII, after max_chars code points or when the octets
+ * left in the buffer content are too few (the caller falls back to decodeUnsignedInteger()
+ * which also refills the buffer).
+ * Byte-aligned octets are copied as they are; bit-packed octets are unpacked
+ * with shifts and masks from a word window.
+ *
+ * @param[in, out] strm EXI stream of bits
+ * @param[out] chars where the code points are stored
+ * @param[in] max_chars the maximum number of code points to decode
+ * @return the number of code points decoded
+ */
+static Index decodeASCIIRun(EXIStream* strm, CharType* chars, Index max_chars)
+{
+	unsigned char* buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+	Index avail = strm->buffer.bufContent > strm->context.bufferIndx ? strm->buffer.bufContent - strm->context.bufferIndx : 0;
+	Index count = 0;
+
+	if(strm->context.bitPointer == 0)
+	{
+		if(avail > max_chars)
+			avail = max_chars;
+
+#if STREAM_WORD_IO_USE
+		while(count + STREAM_WORD_BYTES <= avail)
+		{
+			uint64_t word;
+
+			memcpy(&word, buf + count, STREAM_WORD_BYTES);
+			if((word & 0x8080808080808080ULL) != 0)
+				break;
+			count += STREAM_WORD_BYTES;
+		}
+#endif
+		while(count < avail && (buf[count] & 0x80) == 0)
+			count++;
+
+		if(sizeof(CharType) == 1)
+			memcpy(chars, buf, count);
+		else
+		{
+			Index i;
+			for(i = 0; i < count; i++)
+				chars[i] = (CharType) buf[i];
+		}
+
+		strm->context.bufferIndx += count;
+	}
+#if STREAM_WORD_IO_USE
+	else
+	{
+		/* The shifted window holds 7 whole octets */
+		uint64_t window;
+		unsigned int j;
+
+		while(avail >= STREAM_WORD_BYTES && count < max_chars)
+		{
+			LOAD_WORD_BE(buf, window);
+			window = window << strm->context.bitPointer;
+
+			for(j = 0; j < STREAM_WORD_BYTES - 1 && count < max_chars; j++)
+			{
+				if(window & 0x8000000000000000ULL)
+				{
+					strm->context.bufferIndx += j;
+					return count;
+				}
+				chars[count++] = (CharType) (window >> 56);
+				window = window << 8;
+			}
+
+			buf += j;
+			avail -= j;
+			strm->context.bufferIndx += j;
+		}
+	}
+#endif
+
+	return count;
+}
+
 errorCode decodeStringOnly(EXIStream* strm, Index str_length, String* string_val)
 {
 	// Assume no Restricted Character Set is defined
@@ -111,37 +272,139 @@ errorCode decodeStringOnly(EXIStream* strm, Index str_length, String* string_val
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	Index i = 0;
 	Index writerPosition = 0;
+	Index run;
 	UnsignedInteger tmp_code_point = 0;
 
 	string_val->length = str_length;
 
-	for(i = 0; i < str_length; i++)
+	while(i < str_length)
 	{
-		TRY(decodeUnsignedInteger(strm, &tmp_code_point));
-		TRY(writeCharToString(string_val, (uint32_t) tmp_code_point, &writerPosition));
+		// Most string values are entirely ASCII: decode them in runs
+		run = decodeASCIIRun(strm, string_val->str + writerPosition, str_length - i);
+		i += run;
+		writerPosition += run;
+
+		if(i < str_length)
+		{
+			TRY(decodeUnsignedInteger(strm, &tmp_code_point));
+			TRY(writeCharToString(string_val, (uint32_t) tmp_code_point, &writerPosition));
+			i++;
+		}
 	}
 	return EXIP_OK;
 }
 
+/**
+ * Copies count octets that start bitPointer bits into buf to dst
+ * @warning buf[count] is read as well when bitPointer is not 0
+ */
+static void shiftOctets(const unsigned char* buf, unsigned char bitPointer, char* dst, Index count)
+{
+	Index i;
+
+	if(bitPointer == 0)
+		memcpy(dst, buf, count);
+	else
+	{
+		for(i = 0; i < count; i++)
+			dst[i] = (char) ((buf[i] << bitPointer) | (buf[i + 1] >> (8 - bitPointer)));
+	}
+}
+
 errorCode decodeBinary(EXIStream* strm, char** binary_val, Index* nbytes)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	UnsignedInteger length = 0;
-	unsigned long int_val = 0;
-	UnsignedInteger i = 0;
+#if BINARY_ZERO_COPY_USE
+	Index avail;
+#endif
 
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (">> (binary)"));
 	TRY(decodeUnsignedInteger(strm, &length));
 	*nbytes = (Index) length;
+
+#if BINARY_ZERO_COPY_USE
+	avail = strm->buffer.bufContent > strm->context.bufferIndx ? strm->buffer.bufContent - strm->context.bufferIndx : 0;
+
+	if(strm->context.bitPointer == 0 && length <= avail)
+	{
+		// The octets are in the input buffer as they are
+		(*binary_val) = strm->buffer.buf + strm->context.bufferIndx;
+		strm->context.bufferIndx += (Index) length;
+		return EXIP_OK;
+	}
+
+	if(strm->binaryScratchSize < length)
+	{
+		char* scratch = (char*) EXIP_REALLOC(strm->binaryScratch, length);
+		if(scratch == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		strm->binaryScratch = scratch;
+		strm->binaryScratchSize = (Index) length;
+	}
+	(*binary_val) = strm->binaryScratch;
+
+	if(length < avail)
+	{
+		// Not byte-aligned but within the input buffer: shift the octets out in bulk
+		shiftOctets((unsigned char *) strm->buffer.buf + strm->context.bufferIndx, strm->context.bitPointer, *binary_val, (Index) length);
+		strm->context.bufferIndx += (Index) length;
+		return EXIP_OK;
+	}
+
+	// The value continues past the input buffer content that is available
+	TRY(readOctets(strm, *binary_val, (Index) length));
+#else
 	(*binary_val) = (char*) EXIP_MALLOC(length); // This memory should be manually freed after the content handler is invoked
 	if((*binary_val) == NULL)
 		return EXIP_MEMORY_ALLOCATION_ERROR;
 
-	for(i = 0; i < length; i++)
+	TRY_CATCH(readOctets(strm, *binary_val, (Index) length), EXIP_MFREE(*binary_val));
+#endif
+	return EXIP_OK;
+}
+
+errorCode decodeBinaryChunk(EXIStream* strm, Index remaining, char* scratch, Index scratchSize, char** chunk, Index* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index avail = strm->buffer.bufContent > strm->context.bufferIndx ? strm->buffer.bufContent - strm->context.bufferIndx : 0;
+	unsigned long int_val = 0;
+
+	if(strm->context.bitPointer == 0)
 	{
-		TRY_CATCH(readBits(strm, 8, &int_val), EXIP_MFREE(*binary_val));
-		(*binary_val)[i]=(char) int_val;
+		if(avail == 0)
+		{
+			TRY(readEXIChunkForParsing(strm, 1));
+			avail = strm->buffer.bufContent - strm->context.bufferIndx;
+		}
+
+		// The octets are in the input buffer as they are
+		*size = remaining < avail ? remaining : avail;
+		*chunk = strm->buffer.buf + strm->context.bufferIndx;
+		strm->context.bufferIndx += *size;
+		return EXIP_OK;
 	}
+
+	*chunk = scratch;
+	if(avail > 1)
+	{
+		// Shift out the octets that lie entirely within the input buffer
+		*size = avail - 1;
+		if(*size > remaining)
+			*size = remaining;
+		if(*size > scratchSize)
+			*size = scratchSize;
+
+		shiftOctets((unsigned char *) strm->buffer.buf + strm->context.bufferIndx, strm->context.bitPointer, scratch, *size);
+		strm->context.bufferIndx += *size;
+		return EXIP_OK;
+	}
+
+	// The next octet continues past the input buffer content
+	TRY(readBits(strm, 8, &int_val));
+	scratch[0] = (char) int_val;
+	*size = 1;
+
 	return EXIP_OK;
 }
 
@@ -25,31 +25,33 @@
 errorCode encodeNBitUnsignedInteger(EXIStream* strm, unsigned char n, unsigned long int_val)
 {
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (">> %lu [0x%lX] (%u bits)", int_val, int_val, n));
-	if(WITH_COMPRESSION(strm->header.opts.enumOpt) == FALSE && GET_ALIGNMENT(strm->header.opts.enumOpt) == BIT_PACKED)
+	if(!IS_BYTE_GRANULAR(strm))
 	{
 		return writeNBits(strm, n, int_val);
 	}
 	else
 	{
+		// The minimum number of octets, least significant octet first
 		unsigned int byte_number = n / 8 + (n % 8 != 0);
-		int tmp_byte_buf;
+		unsigned char* buf;
 		unsigned int i;
 
-		if(strm->buffer.bufLen < strm->context.bufferIndx + byte_number)
+		if(strm->buffer.bufLen <= strm->context.bufferIndx + byte_number)
 		{
-			// The buffer end is reached: there are fewer than nbits bits left in the buffer
+			// The buffer end is reached: keep the last byte of the buffer as the current one
 			// Flush the buffer if possible
 			errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 
 			TRY(writeEncodedEXIChunk(strm));
 		}
 
-		for(i = 0; i < byte_number*8; i += 8)
-		{
-			tmp_byte_buf = (int_val >> i) & 0xFF;
-			strm->buffer.buf[strm->context.bufferIndx] = tmp_byte_buf;
-			strm->context.bufferIndx++;
-		}
+		buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+		strm->context.bufferIndx += byte_number;
+
+		// Event codes and booleans: a single octet
+		buf[0] = (unsigned char) int_val;
+		for(i = 1; i < byte_number; i++)
+			buf[i] = (unsigned char) (int_val >> 8*i);
 	}
 	return EXIP_OK;
 }
@@ -67,6 +69,27 @@ errorCode encodeUnsignedInteger(EXIStream* strm, UnsignedInteger int_val)
 	unsigned int tmp_byte_buf = 0;
 	
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (" Write %lu (unsigned)\n", (long unsigned int)int_val));
+
+	if(IS_BYTE_GRANULAR(strm))
+	{
+		// Octets straight into the buffer, flushed when it is full
+		do
+		{
+			if(strm->buffer.bufLen <= strm->context.bufferIndx + 1)
+				TRY(writeEncodedEXIChunk(strm));
+
+			tmp_byte_buf = (unsigned int) (int_val & 0x7F);
+			int_val = int_val >> 7;
+			if(int_val)
+				tmp_byte_buf |= 0x80;
+
+			strm->buffer.buf[strm->context.bufferIndx++] = (char) tmp_byte_buf;
+		}
+		while(int_val);
+
+		return EXIP_OK;
+	}
+
 	do
 	{
 		tmp_byte_buf = (unsigned int) (int_val & 0x7F);
@@ -95,6 +118,90 @@ errorCode encodeString(EXIStream* strm, const String* string_val)
 	return encodeStringOnly(strm, string_val);
 }
 
+/**
+ * @brief Returns the number of leading ASCII characters (code points below 128) in chars
+ * @param[in] chars the characters to scan
+ * @param[in] count the number of characters to scan
+ * @return the length of the ASCII run
+ */
+static Index scanASCIIRun(const CharType* chars, Index count)
+{
+	Index run = 0;
+
+#if STREAM_SSE2_USE
+	if(sizeof(CharType) == 1)
+	{
+		while(run + 16 <= count && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (chars + run))) == 0)
+			run += 16;
+	}
+#endif
+	while(run < count && (uint32_t) chars[run] < 128)
+		run++;
+
+	return run;
+}
+
+/**
+ * @brief Encodes a run of ASCII characters. Each of them is a single-octet Unsigned Integer
+ * When byte-aligned the characters are copied directly into the buffer, flushing it when
+ * it is full; when bit-packed they are written as several octets packed into a single
+ * writeNBits() call.
+ *
+ * @param[in, out] strm EXI stream of bits
+ * @param[in] chars ASCII characters
+ * @param[in] count the number of characters
+ * @return Error handling code
+ */
+static errorCode encodeASCIIRun(EXIStream* strm, const CharType* chars, Index count)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index i = 0;
+	unsigned long packed;
+	unsigned int n;
+
+	if(strm->context.bitPointer == 0)
+	{
+		if(sizeof(CharType) == 1)
+			return writeOctets(strm, (const char*) chars, count);
+
+		while(i < count)
+		{
+			// Leave the last byte of the buffer: writeEncodedEXIChunk() expects it to be the current one
+			Index space = strm->buffer.bufLen > strm->context.bufferIndx + 1 ? strm->buffer.bufLen - strm->context.bufferIndx - 1 : 0;
+			unsigned char* buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+			Index j;
+
+			if(space == 0)
+			{
+				TRY(writeEncodedEXIChunk(strm));
+				continue;
+			}
+
+			if(space > count - i)
+				space = count - i;
+
+			for(j = 0; j < space; j++)
+				buf[j] = (unsigned char) chars[i + j];
+
+			i += space;
+			strm->context.bufferIndx += space;
+		}
+
+		return EXIP_OK;
+	}
+
+	while(i < count)
+	{
+		packed = 0;
+		for(n = 0; n < sizeof(unsigned long) - 1 && i < count; n++, i++)
+			packed = (packed << 8) | (unsigned char) chars[i];
+
+		TRY(writeNBits(strm, (unsigned char) (8*n), packed));
+	}
+
+	return EXIP_OK;
+}
+
 errorCode encodeStringOnly(EXIStream* strm, const String* string_val)
 {
 	// Assume no Restricted Character Set is defined
@@ -104,17 +211,31 @@ errorCode encodeStringOnly(EXIStream* strm, const String* string_val)
 	uint32_t tmp_val = 0;
 	Index i = 0;
 	Index readerPosition = 0;
+	Index run;
 #if DEBUG_STREAM_IO == ON && EXIP_DEBUG_LEVEL == INFO
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("\n Write string, len %u: ", (unsigned int) string_val->length));
 	printString(string_val);
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("\n"));
 #endif
 	
-	for(i = 0; i < string_val->length; i++)
+	while(i < string_val->length)
 	{
-		tmp_val = readCharFromString(string_val, &readerPosition);
+		// Most string values are entirely ASCII: encode them in runs
+		run = scanASCIIRun(string_val->str + readerPosition, string_val->length - i);
+		if(run > 0)
+		{
+			TRY(encodeASCIIRun(strm, string_val->str + readerPosition, run));
+			readerPosition += run;
+			i += run;
+		}
+
+		if(i < string_val->length)
+		{
+			tmp_val = readCharFromString(string_val, &readerPosition);
 
-		TRY(encodeUnsignedInteger(strm, (UnsignedInteger) tmp_val));
+			TRY(encodeUnsignedInteger(strm, (UnsignedInteger) tmp_val));
+			i++;
+		}
 	}
 
 	return EXIP_OK;
@@ -123,17 +244,12 @@ errorCode encodeStringOnly(EXIStream* strm, const String* string_val)
 errorCode encodeBinary(EXIStream* strm, char* binary_val, Index nbytes)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	Index i = 0;
 
 	TRY(encodeUnsignedInteger(strm, (UnsignedInteger) nbytes));
 
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (" Write %u (binary bytes)\n", (unsigned int) nbytes));
-	for(i = 0; i < nbytes; i++)
-	{
-		TRY(writeNBits(strm, 8, (unsigned int) binary_val[i]));
-	}
-	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("\n"));
-	return EXIP_OK;
+
+	return writeOctets(strm, binary_val, nbytes);
 }
 
 errorCode encodeIntegerValue(EXIStream* strm, Integer sint_val)
@@ -153,7 +269,7 @@ errorCode encodeIntegerValue(EXIStream* strm, Integer sint_val)
 		sign = 1;
 	}
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, (" Write %ld (signed)", (long int)sint_val));
-	TRY(writeNextBit(strm, sign));
+	TRY(encodeBoolean(strm, sign));
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("\n"));
 	return encodeUnsignedInteger(strm, uval);
 }
@@ -44,12 +44,54 @@ errorCode readNextBit(EXIStream* strm, boolean* bit_val)
 
 	*bit_val = (strm->buffer.buf[strm->context.bufferIndx] & (1<<REVERSE_BIT_POSITION(strm->context.bitPointer))) != 0;
 
-	moveBitPointer(strm, 1);
+	if(strm->context.bitPointer == 7)
+	{
+		strm->context.bitPointer = 0;
+		strm->context.bufferIndx += 1;
+	}
+	else
+		strm->context.bitPointer += 1;
+
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("  @%u:%u", (unsigned int) strm->context.bufferIndx, strm->context.bitPointer));
 	return EXIP_OK;
 }
 
+static errorCode readBitsByteWise(EXIStream* strm, unsigned char n, unsigned long* bits_val);
+
 errorCode readBits(EXIStream* strm, unsigned char n, unsigned long* bits_val)
+{
+#if STREAM_WORD_IO_USE
+	/* Fast path: the whole value lies within one word window that is fully
+	 * inside the buffer content - a single load followed by shifts and masks.
+	 * The window is taken from the current bufferIndx/bitPointer on every call
+	 * so that it cannot go stale when the context is saved, restored or
+	 * rewritten by the header codecs and readEXIChunkForParsing() */
+	if(n != 0 && n + strm->context.bitPointer <= 8*STREAM_WORD_BYTES &&
+			strm->buffer.bufContent >= strm->context.bufferIndx + STREAM_WORD_BYTES)
+	{
+		uint64_t window;
+		unsigned char *buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+
+		LOAD_WORD_BE(buf, window);
+		*bits_val = (unsigned long) ((window << strm->context.bitPointer) >> (8*STREAM_WORD_BYTES - n));
+
+		DEBUG_MSG(INFO, DEBUG_STREAM_IO, (">> %lu [0x%lX] (%u bits)", *bits_val, *bits_val, n));
+
+		n += strm->context.bitPointer;
+		strm->context.bufferIndx += n / 8;
+		strm->context.bitPointer = n % 8;
+
+		DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("  @%u:%u\n", (unsigned int) strm->context.bufferIndx, strm->context.bitPointer));
+
+		return EXIP_OK;
+	}
+#endif
+
+	return readBitsByteWise(strm, n, bits_val);
+}
+
+/* Slow path: close to the end of the buffer content */
+static errorCode readBitsByteWise(EXIStream* strm, unsigned char n, unsigned long* bits_val)
 {
 	unsigned int numBytesToBeRead = 1 + ((n + strm->context.bitPointer - 1) / 8);
 	unsigned int byteIndx = 1;
@@ -65,7 +107,7 @@ errorCode readBits(EXIStream* strm, unsigned char n, unsigned long* bits_val)
 
 	buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
 
-	*bits_val = (buf[0] & BIT_MASK[8 - strm->context.bitPointer])<<((numBytesToBeRead-1)*8);
+	*bits_val = (unsigned long) (buf[0] & BIT_MASK[8 - strm->context.bitPointer])<<((numBytesToBeRead-1)*8);
 
 	while(byteIndx < numBytesToBeRead)
 	{
@@ -86,3 +128,37 @@ errorCode readBits(EXIStream* strm, unsigned char n, unsigned long* bits_val)
 	return EXIP_OK;
 }
 
+
+errorCode readOctets(EXIStream* strm, char* dst, Index count)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	unsigned long bits_val;
+	Index part;
+
+	if(strm->context.bitPointer != 0)
+	{
+		for(part = 0; part < count; part++)
+		{
+			TRY(readBits(strm, 8, &bits_val));
+			dst[part] = (char) bits_val;
+		}
+		return EXIP_OK;
+	}
+
+	while(count > 0)
+	{
+		if(strm->buffer.bufContent <= strm->context.bufferIndx)
+			TRY(readEXIChunkForParsing(strm, 1));
+
+		part = strm->buffer.bufContent - strm->context.bufferIndx;
+		if(part > count)
+			part = count;
+
+		memcpy(dst, strm->buffer.buf + strm->context.bufferIndx, part);
+		strm->context.bufferIndx += part;
+		dst += part;
+		count -= part;
+	}
+
+	return EXIP_OK;
+}
@@ -39,12 +39,64 @@ errorCode writeNextBit(EXIStream* strm, boolean bit_val)
 	else
 		strm->buffer.buf[strm->context.bufferIndx] = strm->buffer.buf[strm->context.bufferIndx] | (1<<REVERSE_BIT_POSITION(strm->context.bitPointer));
 
-	moveBitPointer(strm, 1);
+	if(strm->context.bitPointer == 7)
+	{
+		strm->context.bitPointer = 0;
+		strm->context.bufferIndx += 1;
+	}
+	else
+		strm->context.bitPointer += 1;
+
 	DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("  @%u:%u", (unsigned int) strm->context.bufferIndx, strm->context.bitPointer));
 	return EXIP_OK;
 }
 
+static errorCode writeNBitsByteWise(EXIStream* strm, unsigned char nbits, unsigned long bits_val);
+
 errorCode writeNBits(EXIStream* strm, unsigned char nbits, unsigned long bits_val)
+{
+#if STREAM_WORD_IO_USE
+	/* Fast path: there is room for a whole word window after the current position.
+	 * The bits are merged into the window with a single read-modify-write: the bits
+	 * before the bit pointer are kept, the rest of the last touched byte is zeroed
+	 * (as in the byte-wise path) and the bytes after it are left untouched.
+	 * The buffer is flushed only when it is full - by the byte-wise path */
+	if(nbits != 0 && nbits + strm->context.bitPointer <= 8*STREAM_WORD_BYTES &&
+			strm->buffer.bufLen > strm->context.bufferIndx + STREAM_WORD_BYTES)
+	{
+		unsigned char* buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+		unsigned int endBit = nbits + strm->context.bitPointer;
+		unsigned int touchedBits = (endBit + 7) & ~7U;
+		uint64_t window;
+		uint64_t keepMask = 0;
+		uint64_t val = (uint64_t) bits_val;
+
+		if(nbits < 8*STREAM_WORD_BYTES)
+			val = val & ((((uint64_t) 1) << nbits) - 1);
+
+		if(strm->context.bitPointer != 0)
+			keepMask = ~((uint64_t) 0) << (8*STREAM_WORD_BYTES - strm->context.bitPointer);
+		if(touchedBits < 8*STREAM_WORD_BYTES)
+			keepMask = keepMask | (~((uint64_t) 0) >> touchedBits);
+
+		LOAD_WORD_BE(buf, window);
+		window = (window & keepMask) | (val << (8*STREAM_WORD_BYTES - endBit));
+		STORE_WORD_BE(buf, window);
+
+		strm->context.bufferIndx += endBit / 8;
+		strm->context.bitPointer = endBit % 8;
+
+		DEBUG_MSG(INFO, DEBUG_STREAM_IO, ("  @%u:%u\n", (unsigned int) strm->context.bufferIndx, strm->context.bitPointer));
+
+		return EXIP_OK;
+	}
+#endif
+
+	return writeNBitsByteWise(strm, nbits, bits_val);
+}
+
+/* Slow path: close to the end of the buffer */
+static errorCode writeNBitsByteWise(EXIStream* strm, unsigned char nbits, unsigned long bits_val)
 {
 	unsigned int numBitsWrite = 0; // Number of the bits written so far
 	unsigned char tmp = 0;
@@ -79,3 +131,34 @@ errorCode writeNBits(EXIStream* strm, unsigned char nbits, unsigned long bits_va
 
 	return EXIP_OK;
 }
+
+errorCode writeOctets(EXIStream* strm, const char* src, Index count)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index part;
+
+	if(strm->context.bitPointer != 0 || strm->buffer.bufLen < 2)
+	{
+		for(part = 0; part < count; part++)
+			TRY(writeNBits(strm, 8, (unsigned char) src[part]));
+		return EXIP_OK;
+	}
+
+	while(count > 0)
+	{
+		// Leave the last byte of the buffer: writeEncodedEXIChunk() expects it to be the current one
+		if(strm->buffer.bufLen <= strm->context.bufferIndx + 1)
+			TRY(writeEncodedEXIChunk(strm));
+
+		part = strm->buffer.bufLen - strm->context.bufferIndx - 1;
+		if(part > count)
+			part = count;
+
+		memcpy(strm->buffer.buf + strm->context.bufferIndx, src, part);
+		strm->context.bufferIndx += part;
+		src += part;
+		count -= part;
+	}
+
+	return EXIP_OK;
+}
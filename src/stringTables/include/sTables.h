@@ -124,7 +124,8 @@ errorCode createUriTableEntries(UriTable* uriTable, boolean withSchema);
 
 /**
  * @brief Search the URI table for a particular string value
- * Implements full scan
+ * Implements full scan; a hash index lookup when STRING_TABLE_INDEX_USE is ON
+ * and the table has at least STRING_TABLE_INDEX_THRESHOLD entries
  *
  * @param[in] uriTable URI table to be searched
  * @param[in] uriStr The string searched for
@@ -135,8 +136,8 @@ boolean lookupUri(UriTable* uriTable, String uriStr, SmallIndex* uriEntryId);
 
 /**
  * @brief Search the local names table for a particular string value
- * Implements full scan
- * RCC 20120201: Try to optimize?
+ * Implements full scan; a hash index lookup when STRING_TABLE_INDEX_USE is ON
+ * and the table has at least STRING_TABLE_INDEX_THRESHOLD entries
  *
  * @param[in] lnTable Local names table to be searched
  * @param[in] lnStr The local name string searched for
@@ -147,7 +148,8 @@ boolean lookupLn(LnTable* lnTable, String lnStr, Index* lnEntryId);
 
 /**
  * @brief Search the Prefix table for a particular string value
- * Implements full scan
+ * Implements full scan; a hash index lookup when STRING_TABLE_INDEX_USE is ON
+ * and the table has at least STRING_TABLE_INDEX_THRESHOLD entries
  *
  * @param[in] pfxTable Prefix table to be searched
  * @param[in] pfxStr The string searched for
@@ -156,12 +158,75 @@ boolean lookupLn(LnTable* lnTable, String lnStr, Index* lnEntryId);
  */
 boolean lookupPfx(PfxTable* pfxTable, String pfxStr, SmallIndex* pfxEntryId);
 
+/**
+ * @brief Creates the string tables of a stream (strm->uriTable) on top of the string tables of strm->schema
+ * The URI partition is copied. The local-name and prefix partitions of the URIs stay shared with
+ * the schema (the schema is never modified by the stream) until ownLnTable() or ownPfxTable()
+ * gives the stream its own copy of them. Must be invoked once strm->schema is set.
+ *
+ * @param[in, out] strm EXI stream
+ * @return Error handling code
+ */
+errorCode createStreamUriTable(EXIStream* strm);
+
+/**
+ * @brief Gives the stream its own copy of the local-name partition of a URI
+ * Must be invoked before a local name is added to the partition or an LnEntry of the
+ * partition is changed. No-op when the partition is not shared with the schema.
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] uriId the ID of the URI in strm->uriTable
+ * @return Error handling code
+ */
+errorCode ownLnTable(EXIStream* strm, SmallIndex uriId);
+
+/**
+ * @brief Gives the stream its own copy of the prefix partition of a URI
+ * Must be invoked before a prefix is added to the partition.
+ * No-op when the partition is not shared with the schema.
+ *
+ * @param[in, out] strm EXI stream
+ * @param[in] uriId the ID of the URI in strm->uriTable
+ * @return Error handling code
+ */
+errorCode ownPfxTable(EXIStream* strm, SmallIndex uriId);
+
+/**
+ * @brief Frees the string tables of a stream created by createStreamUriTable()
+ * Leaves the partitions shared with strm->schema intact.
+ *
+ * @param[in, out] strm EXI stream
+ */
+void destroyStreamUriTable(EXIStream* strm);
+
+#if STRING_TABLE_INDEX_USE
+/**
+ * @brief Builds the hash indexes of the URI, local-name and prefix tables of a schema
+ * that have at least STRING_TABLE_INDEX_THRESHOLD entries. Invoked once the string tables
+ * of the schema are complete and must not change afterwards: the streams of the schema
+ * use these indexes read-only until they add entries to their copy of a table.
+ *
+ * @param[in, out] schema the schema
+ * @return Error handling code
+ */
+errorCode createSchemaNameIndexes(EXIPSchema* schema);
+
+/**
+ * @brief Frees the hash index of a URI, local-name or prefix table (if built)
+ * Must be called when the table is destroyed or its entries are reordered.
+ * The index is built again by the next lookup.
+ *
+ * @param[in, out] index the index of the table; set to NULL
+ */
+void destroyNameIndex(NameIndex** index);
+#endif
+
 #if VALUE_CROSSTABLE_USE
 /**
  * @brief Search the value cross table for a particular string value
  * Search the value cross table (local partition of the value table) for a particular string value
- * Implements full scan
- * RCC 20120201: Try to optimize?
+ * Implements full scan; a hash index lookup when STRING_TABLE_INDEX_USE is ON
+ * and the table has at least STRING_TABLE_INDEX_THRESHOLD entries
  *
  * @param[in] valueTable Global Value table - used to check the string values
  * @param[in] vxTable Value cross table - local partition of the Value table to be searched
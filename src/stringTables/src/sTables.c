@@ -145,6 +145,175 @@ static const String URI_3_LN[] = {
 
 /********* END: String table default entries ***************/
 
+#if STRING_TABLE_INDEX_USE
+
+/** The i-th string of a table given the string of the first entry and the size of the entries */
+#define TABLE_STRING(first, entrySize, i) ((const String*) ((const char*) (first) + (entrySize)*(i)))
+
+/** The initial number of slots of a name index */
+#define NAME_INDEX_MIN_SIZE 64
+
+static void insertNameIndex(NameIndex* index, const String* str, Index id)
+{
+	Index mask = index->size - 1;
+	Index pos = wordHash(*str) & mask;
+
+	while(index->slot[pos] != 0)
+		pos = (pos + 1) & mask;
+
+	index->slot[pos] = id + 1;
+}
+
+/**
+ * @brief Prepares the index of a table with count entries for the insertion of its new entries
+ * The index is created when needed, cleared when the table has fewer entries than indexed
+ * and grown so that it is kept at most half full. On return, the entries from (*index)->count
+ * on must be inserted.
+ *
+ * @param[in, out] index the index of the table
+ * @param[in] count the number of table entries
+ * @return Error handling code
+ */
+static errorCode prepareNameIndex(NameIndex** index, Index count)
+{
+	NameIndex* idx = *index;
+
+	if(idx == NULL)
+	{
+		idx = EXIP_MALLOC(sizeof(NameIndex));
+		if(idx == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		idx->slot = NULL;
+		idx->size = 0;
+		idx->count = 0;
+		idx->shared = FALSE;
+		*index = idx;
+	}
+
+	if(idx->count > count)
+	{
+		memset(idx->slot, 0, sizeof(Index)*idx->size);
+		idx->count = 0;
+	}
+
+	if(2*count > idx->size)
+	{
+		Index newSize = NAME_INDEX_MIN_SIZE;
+		Index* newSlot;
+
+		while(newSize < 4*count)
+			newSize = newSize << 1;
+
+		newSlot = EXIP_MALLOC(sizeof(Index)*newSize);
+		if(newSlot == NULL)
+			return EXIP_MEMORY_ALLOCATION_ERROR;
+		memset(newSlot, 0, sizeof(Index)*newSize);
+
+		if(idx->slot != NULL)
+			EXIP_MFREE(idx->slot);
+		idx->slot = newSlot;
+		idx->size = newSize;
+		idx->count = 0;
+	}
+
+	return EXIP_OK;
+}
+
+/**
+ * @brief Brings the index of a table in sync with its count entries
+ *
+ * @param[in, out] index the index of the table
+ * @param[in] first the string of the first table entry
+ * @param[in] entrySize the size of the table entries
+ * @param[in] count the number of table entries
+ * @return Error handling code
+ */
+static errorCode syncNameIndex(NameIndex** index, const String* first, size_t entrySize, Index count)
+{
+	errorCode tmp_err_code;
+	Index i;
+
+	// An index in sync is not written to: the indexes of the schema are read by concurrent streams
+	if(*index != NULL && (*index)->count == count)
+		return EXIP_OK;
+
+	// The table of the stream has entries the schema does not have: the stream needs an index of its own
+	if(*index != NULL && (*index)->shared)
+		*index = NULL;
+
+	TRY(prepareNameIndex(index, count));
+
+	for(i = (*index)->count; i < count; i++)
+		insertNameIndex(*index, TABLE_STRING(first, entrySize, i), i);
+	(*index)->count = count;
+
+	return EXIP_OK;
+}
+
+static boolean lookupNameIndex(NameIndex* index, const String* first, size_t entrySize, String str, Index* id)
+{
+	Index mask = index->size - 1;
+	Index pos = wordHash(str) & mask;
+
+	while(index->slot[pos] != 0)
+	{
+		if(stringEqual(*TABLE_STRING(first, entrySize, index->slot[pos] - 1), str))
+		{
+			*id = index->slot[pos] - 1;
+			return TRUE;
+		}
+		pos = (pos + 1) & mask;
+	}
+
+	return FALSE;
+}
+
+/**
+ * @brief Builds the index of a table of the schema, shared by the streams
+ */
+static errorCode createSharedIndex(NameIndex** index, const String* first, size_t entrySize, Index count)
+{
+	errorCode tmp_err_code;
+
+	TRY(syncNameIndex(index, first, entrySize, count));
+	(*index)->shared = TRUE;
+
+	return EXIP_OK;
+}
+
+errorCode createSchemaNameIndexes(EXIPSchema* schema)
+{
+	errorCode tmp_err_code;
+	UriTable* uriTable = &schema->uriTable;
+	UriEntry* uriEntry;
+	SmallIndex i;
+
+	if(uriTable->count >= STRING_TABLE_INDEX_THRESHOLD)
+		TRY(createSharedIndex(&uriTable->index, &uriTable->uri->uriStr, sizeof(UriEntry), uriTable->count));
+	for(i = 0; i < uriTable->count; i++)
+	{
+		uriEntry = &uriTable->uri[i];
+		if(uriEntry->lnTable.count >= STRING_TABLE_INDEX_THRESHOLD)
+			TRY(createSharedIndex(&uriEntry->lnTable.index, &uriEntry->lnTable.ln->lnStr, sizeof(LnEntry), uriEntry->lnTable.count));
+		if(uriEntry->pfxTable.count >= STRING_TABLE_INDEX_THRESHOLD)
+			TRY(createSharedIndex(&uriEntry->pfxTable.index, uriEntry->pfxTable.pfx, sizeof(String), uriEntry->pfxTable.count));
+	}
+
+	return EXIP_OK;
+}
+
+void destroyNameIndex(NameIndex** index)
+{
+	if(*index != NULL)
+	{
+		EXIP_MFREE((*index)->slot);
+		EXIP_MFREE(*index);
+		*index = NULL;
+	}
+}
+
+#endif
+
 errorCode createValueTable(ValueTable* valueTable)
 {
 	errorCode tmp_err_code;
@@ -175,6 +344,13 @@ errorCode addUriEntry(UriTable* uriTable, String uriStr, SmallIndex* uriEntryId)
 	// Create local names table for this URI
 	TRY(createDynArray(&uriEntry->lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER));
 
+#if STRING_TABLE_INDEX_USE
+	uriEntry->pfxTable.index = NULL;
+	uriEntry->lnTable.index = NULL;
+	if(uriTable->index != NULL)
+		TRY(syncNameIndex(&uriTable->index, &uriTable->uri->uriStr, sizeof(UriEntry), uriTable->count));
+#endif
+
 	*uriEntryId = (SmallIndex)uriLEntryId;
 	return EXIP_OK;
 }
@@ -193,6 +369,10 @@ errorCode addLnEntry(LnTable* lnTable, String lnStr, Index* lnEntryId)
 #if VALUE_CROSSTABLE_USE
 	// The Vx table is created on-demand (additions to value cross table are done when a value is inserted in the value table)
 	lnEntry->vxTable = NULL;
+#endif
+#if STRING_TABLE_INDEX_USE
+	if(lnTable->index != NULL)
+		TRY(syncNameIndex(&lnTable->index, &lnTable->ln->lnStr, sizeof(LnEntry), lnTable->count));
 #endif
 	return EXIP_OK;
 }
@@ -210,17 +390,24 @@ errorCode addValueEntry(EXIStream* strm, String valueStr, QNameID qnameID)
 		VxEntry vxEntry;
 
 		// Find the local name entry from QNameID
-		lnEntry = &GET_LN_URI_QNAME(strm->schema->uriTable, qnameID);
+		lnEntry = &GET_LN_URI_QNAME(strm->uriTable, qnameID);
 
 		// Add entry to the local name entry's value cross table (vxTable)
 		if(lnEntry->vxTable == NULL)
 		{
+			// The vxTable is set in the stream's own copy of the local names
+			TRY(ownLnTable(strm, qnameID.uriId));
+			lnEntry = &GET_LN_URI_QNAME(strm->uriTable, qnameID);
+
 			lnEntry->vxTable = memManagedAllocate(&strm->memList, sizeof(VxTable));
 			if(lnEntry->vxTable == NULL)
 				return EXIP_MEMORY_ALLOCATION_ERROR;
 
 			// First value entry - create the vxTable
 			TRY(createDynArray(&lnEntry->vxTable->dynArray, sizeof(VxEntry), DEFAULT_VX_ENTRIES_NUMBER));
+#if STRING_TABLE_INDEX_USE
+			lnEntry->vxTable->index = NULL;
+#endif
 		}
 
 		assert(lnEntry->vxTable->vx);
@@ -241,9 +428,10 @@ errorCode addValueEntry(EXIStream* strm, String valueStr, QNameID qnameID)
 		valueEntry = &strm->valueTable.value[strm->valueTable.globalId];
 
 #if VALUE_CROSSTABLE_USE
-		assert(GET_LN_URI_QNAME(strm->schema->uriTable, valueEntry->locValuePartition.forQNameId).vxTable);
-		// Null out the existing cross table entry
-		GET_LN_URI_QNAME(strm->schema->uriTable, valueEntry->locValuePartition.forQNameId).vxTable->vx[valueEntry->locValuePartition.vxEntryId].globalId = INDEX_MAX;
+		assert(GET_LN_URI_QNAME(strm->uriTable, valueEntry->locValuePartition.forQNameId).vxTable);
+		// Null out the existing cross table entry. This also removes it from the index of the
+		// cross table: the look-ups skip the entries with globalId == INDEX_MAX
+		GET_LN_URI_QNAME(strm->uriTable, valueEntry->locValuePartition.forQNameId).vxTable->vx[valueEntry->locValuePartition.vxEntryId].globalId = INDEX_MAX;
 #endif
 
 #if HASH_TABLE_USE
@@ -301,6 +489,11 @@ errorCode addPfxEntry(PfxTable* pfxTable, String pfxStr, SmallIndex* pfxEntryId)
 	strEntry->length = pfxStr.length;
 	strEntry->str = pfxStr.str;
 
+#if STRING_TABLE_INDEX_USE
+	if(pfxTable->index != NULL)
+		TRY(syncNameIndex(&pfxTable->index, pfxTable->pfx, sizeof(String), pfxTable->count));
+#endif
+
 	return EXIP_OK;
 }
 
@@ -375,6 +568,165 @@ errorCode createUriTableEntries(UriTable* uriTable, boolean withSchema)
 	return EXIP_OK;
 }
 
+/**
+ * @brief Replaces the entries of a table with a copy of them that has room for chunkEntries more
+ *
+ * @param[out] dynArray the DynArray of the table
+ * @param[in, out] base the entries of the table
+ * @param[in] count the number of entries
+ * @param[in] entrySize the size of an entry
+ * @param[in] chunkEntries the number of entries to be added each expansion time
+ * @return Error handling code
+ */
+static errorCode copyTableEntries(DynArray* dynArray, void** base, Index count, size_t entrySize, uint16_t chunkEntries)
+{
+	void* entries = EXIP_MALLOC(entrySize*(count + chunkEntries));
+	if(entries == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	if(count > 0)
+		memcpy(entries, *base, entrySize*count);
+
+	dynArray->entrySize = entrySize;
+	dynArray->chunkEntries = chunkEntries;
+	dynArray->arrayEntries = count + chunkEntries;
+	*base = entries;
+
+	return EXIP_OK;
+}
+
+/** TRUE when the local-name partition of the URI uriId is the one of the schema */
+#define IS_LN_TABLE_SHARED(strm, uriId) ((uriId) < (strm)->schema->uriTable.count && \
+		(strm)->uriTable.uri[uriId].lnTable.ln == (strm)->schema->uriTable.uri[uriId].lnTable.ln)
+
+/** TRUE when the prefix partition of the URI uriId is the one of the schema */
+#define IS_PFX_TABLE_SHARED(strm, uriId) ((uriId) < (strm)->schema->uriTable.count && \
+		(strm)->uriTable.uri[uriId].pfxTable.pfx == (strm)->schema->uriTable.uri[uriId].pfxTable.pfx)
+
+errorCode createStreamUriTable(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UriTable* schemaTable = &strm->schema->uriTable;
+
+	strm->uriTable.uri = schemaTable->uri;
+	strm->uriTable.count = schemaTable->count;
+	TRY(copyTableEntries(&strm->uriTable.dynArray, (void**) &strm->uriTable.uri, schemaTable->count, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER));
+
+#if STRING_TABLE_INDEX_USE
+	{
+		SmallIndex i;
+		UriEntry* uriEntry;
+
+		// The shared partitions keep the index of the schema while it is in sync with them;
+		// otherwise the stream builds an index of its own on demand. The copy of the URI
+		// partition keeps the index of the schema until a URI is added to it
+		strm->uriTable.index = NULL;
+		if(schemaTable->index != NULL && schemaTable->index->shared)
+			strm->uriTable.index = schemaTable->index;
+		for(i = 0; i < strm->uriTable.count; i++)
+		{
+			uriEntry = &strm->uriTable.uri[i];
+			if(uriEntry->lnTable.index != NULL && uriEntry->lnTable.index->count != uriEntry->lnTable.count)
+				uriEntry->lnTable.index = NULL;
+			if(uriEntry->pfxTable.index != NULL && uriEntry->pfxTable.index->count != uriEntry->pfxTable.count)
+				uriEntry->pfxTable.index = NULL;
+		}
+	}
+#endif
+
+	return EXIP_OK;
+}
+
+errorCode ownLnTable(EXIStream* strm, SmallIndex uriId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	LnTable* lnTable = &strm->uriTable.uri[uriId].lnTable;
+
+	if(!IS_LN_TABLE_SHARED(strm, uriId))
+		return EXIP_OK;
+
+	TRY(copyTableEntries(&lnTable->dynArray, (void**) &lnTable->ln, lnTable->count, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER));
+
+#if STRING_TABLE_INDEX_USE
+	// The index of the schema is not extended with the local names of the stream
+	if(lnTable->index == strm->schema->uriTable.uri[uriId].lnTable.index)
+		lnTable->index = NULL;
+#endif
+
+	return EXIP_OK;
+}
+
+errorCode ownPfxTable(EXIStream* strm, SmallIndex uriId)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	PfxTable* pfxTable = &strm->uriTable.uri[uriId].pfxTable;
+
+	if(!IS_PFX_TABLE_SHARED(strm, uriId))
+		return EXIP_OK;
+
+	TRY(copyTableEntries(&pfxTable->dynArray, (void**) &pfxTable->pfx, pfxTable->count, sizeof(String), DEFAULT_PFX_ENTRIES_NUMBER));
+
+#if STRING_TABLE_INDEX_USE
+	if(pfxTable->index == strm->schema->uriTable.uri[uriId].pfxTable.index)
+		pfxTable->index = NULL;
+#endif
+
+	return EXIP_OK;
+}
+
+void destroyStreamUriTable(EXIStream* strm)
+{
+	SmallIndex i;
+	UriEntry* uriEntry;
+
+	if(strm->uriTable.uri == NULL)
+		return;
+
+	for(i = 0; i < strm->uriTable.count; i++)
+	{
+		uriEntry = &strm->uriTable.uri[i];
+
+		if(!IS_LN_TABLE_SHARED(strm, i))
+		{
+#if VALUE_CROSSTABLE_USE
+			Index j;
+
+			// The VxTable structures themselves are in the allocation list of the stream
+			for(j = 0; j < uriEntry->lnTable.count; j++)
+			{
+				if(uriEntry->lnTable.ln[j].vxTable != NULL)
+				{
+					assert(uriEntry->lnTable.ln[j].vxTable->vx);
+					destroyDynArray(&uriEntry->lnTable.ln[j].vxTable->dynArray);
+#if STRING_TABLE_INDEX_USE
+					destroyNameIndex(&uriEntry->lnTable.ln[j].vxTable->index);
+#endif
+				}
+			}
+#endif
+			destroyDynArray(&uriEntry->lnTable.dynArray);
+		}
+
+		if(!IS_PFX_TABLE_SHARED(strm, i))
+			destroyDynArray(&uriEntry->pfxTable.dynArray);
+
+#if STRING_TABLE_INDEX_USE
+		if(i >= strm->schema->uriTable.count || uriEntry->lnTable.index != strm->schema->uriTable.uri[i].lnTable.index)
+			destroyNameIndex(&uriEntry->lnTable.index);
+		if(i >= strm->schema->uriTable.count || uriEntry->pfxTable.index != strm->schema->uriTable.uri[i].pfxTable.index)
+			destroyNameIndex(&uriEntry->pfxTable.index);
+#endif
+	}
+
+	destroyDynArray(&strm->uriTable.dynArray);
+#if STRING_TABLE_INDEX_USE
+	if(strm->uriTable.index != strm->schema->uriTable.index)
+		destroyNameIndex(&strm->uriTable.index);
+#endif
+	strm->uriTable.uri = NULL;
+	strm->uriTable.count = 0;
+}
+
 boolean lookupUri(UriTable* uriTable, String uriStr, SmallIndex* uriEntryId)
 {
 	SmallIndex i;
@@ -382,6 +734,19 @@ boolean lookupUri(UriTable* uriTable, String uriStr, SmallIndex* uriEntryId)
 	if(uriTable == NULL)
 		return FALSE;
 
+#if STRING_TABLE_INDEX_USE
+	if(uriTable->count >= STRING_TABLE_INDEX_THRESHOLD &&
+			syncNameIndex(&uriTable->index, &uriTable->uri->uriStr, sizeof(UriEntry), uriTable->count) == EXIP_OK)
+	{
+		Index id;
+
+		if(!lookupNameIndex(uriTable->index, &uriTable->uri->uriStr, sizeof(UriEntry), uriStr, &id))
+			return FALSE;
+		*uriEntryId = (SmallIndex) id;
+		return TRUE;
+	}
+#endif
+
 	for(i = 0; i < uriTable->count; i++)
 	{
 		if(stringEqual(uriTable->uri[i].uriStr, uriStr))
@@ -399,6 +764,13 @@ boolean lookupLn(LnTable* lnTable, String lnStr, Index* lnEntryId)
 
 	if(lnTable == NULL)
 		return FALSE;
+
+#if STRING_TABLE_INDEX_USE
+	if(lnTable->count >= STRING_TABLE_INDEX_THRESHOLD &&
+			syncNameIndex(&lnTable->index, &lnTable->ln->lnStr, sizeof(LnEntry), lnTable->count) == EXIP_OK)
+		return lookupNameIndex(lnTable->index, &lnTable->ln->lnStr, sizeof(LnEntry), lnStr, lnEntryId);
+#endif
+
 	for(i = 0; i < lnTable->count; i++)
 	{
 		if(stringEqual(lnTable->ln[i].lnStr, lnStr))
@@ -414,6 +786,19 @@ boolean lookupPfx(PfxTable* pfxTable, String pfxStr, SmallIndex* pfxEntryId)
 {
 	SmallIndex i;
 
+#if STRING_TABLE_INDEX_USE
+	if(pfxTable->count >= STRING_TABLE_INDEX_THRESHOLD &&
+			syncNameIndex(&pfxTable->index, pfxTable->pfx, sizeof(String), pfxTable->count) == EXIP_OK)
+	{
+		Index id;
+
+		if(!lookupNameIndex(pfxTable->index, pfxTable->pfx, sizeof(String), pfxStr, &id))
+			return FALSE;
+		*pfxEntryId = (SmallIndex) id;
+		return TRUE;
+	}
+#endif
+
 	for(i = 0; i < pfxTable->count; i++)
 	{
 		if(stringEqual(pfxTable->pfx[i], pfxStr))
@@ -426,6 +811,31 @@ boolean lookupPfx(PfxTable* pfxTable, String pfxStr, SmallIndex* pfxEntryId)
 }
 
 #if VALUE_CROSSTABLE_USE
+#if STRING_TABLE_INDEX_USE
+/**
+ * @brief Brings the index of a value cross table in sync with its entries
+ * The entries removed from the local value partition (globalId == INDEX_MAX) are not
+ * inserted; the ones removed after their insertion stay in the index and are skipped
+ * by the look-ups until the index is rebuilt.
+ */
+static errorCode syncVxIndex(ValueTable* valueTable, VxTable* vxTable)
+{
+	errorCode tmp_err_code;
+	Index i;
+
+	TRY(prepareNameIndex(&vxTable->index, vxTable->count));
+
+	for(i = vxTable->index->count; i < vxTable->count; i++)
+	{
+		if(vxTable->vx[i].globalId != INDEX_MAX)
+			insertNameIndex(vxTable->index, &valueTable->value[vxTable->vx[i].globalId].valueStr, i);
+	}
+	vxTable->index->count = vxTable->count;
+
+	return EXIP_OK;
+}
+#endif
+
 boolean lookupVx(ValueTable* valueTable, VxTable* vxTable, String valueStr, Index* vxEntryId)
 {
 	Index i;
@@ -435,6 +845,27 @@ boolean lookupVx(ValueTable* valueTable, VxTable* vxTable, String valueStr, Inde
 	if(vxTable == NULL || vxTable->vx == NULL)
 		return FALSE;
 
+#if STRING_TABLE_INDEX_USE
+	if(vxTable->count >= STRING_TABLE_INDEX_THRESHOLD && syncVxIndex(valueTable, vxTable) == EXIP_OK)
+	{
+		Index mask = vxTable->index->size - 1;
+		Index pos = wordHash(valueStr) & mask;
+
+		while(vxTable->index->slot[pos] != 0)
+		{
+			vxEntry = vxTable->vx + vxTable->index->slot[pos] - 1;
+			if(vxEntry->globalId != INDEX_MAX && stringEqual(valueTable->value[vxEntry->globalId].valueStr, valueStr))
+			{
+				*vxEntryId = vxTable->index->slot[pos] - 1;
+				return TRUE;
+			}
+			pos = (pos + 1) & mask;
+		}
+
+		return FALSE;
+	}
+#endif
+
 	for(i = 0; i < vxTable->count; i++)
 	{
 		vxEntry = vxTable->vx + i;
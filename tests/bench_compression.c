@@ -0,0 +1,332 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_compression.c
+ * @brief Compares the size of the EXI streams and the encoding/decoding time
+ * of the four alignment options
+ *
+ * Encodes a synthetic schema-less document of repeating records with
+ * the bit-packed, byte-aligned, pre-compression and compression alignments,
+ * decodes each stream back and reports the stream size, the time taken and
+ * the decoding speed relative to bit-packed. With the test-set folder as a first
+ * argument the same is done for a schema-informed SenML document with typed values
+ * (exip/SenML-xsd.exi). The compression rows need COMPRESSION_USE ON; with
+ * COMPRESSION_THREAD_USE ON the DEFLATE streams are inflated on a separate thread.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "EXISerializer.h"
+#include "EXIParser.h"
+#include "stringManipulate.h"
+#include "grammarGenerator.h"
+
+#define DOC_RECORD_COUNT 2000
+#define DOC_BUFFER_SIZE 200000
+#define ROUNDS 20
+#define MAX_PATH_LEN 200
+
+typedef errorCode (*EncodeDocument)(EXIStream* strm);
+
+static const String NS_EMPTY = {NULL, 0};
+static const String NS_SENML = {"urn:ietf:params:xml:ns:senml", 28};
+static const char* const RECORD_FIELDS[4] = {"id", "temperature", "humidity", "status"};
+static const char* const STATUS_VALUES[3] = {"ok", "warning", "maintenance"};
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+/* The body of a schema-less document of DOC_RECORD_COUNT <record> elements,
+ * each with a sensor attribute and four child elements with short text values */
+static errorCode encodeRecords(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	String chVal;
+	char value[32];
+	EXITypeClass valueType;
+	unsigned int i, f;
+
+	TRY(asciiToString("http://www.ltu.se/EISLAB/bench", &uri, &strm->memList, FALSE));
+	TRY(asciiToString("log", &ln, &strm->memList, FALSE));
+	TRY(serialize.startElement(strm, qname, &valueType));
+
+	for(i = 0; i < DOC_RECORD_COUNT; i++)
+	{
+		TRY(asciiToString("record", &ln, &strm->memList, FALSE));
+		TRY(serialize.startElement(strm, qname, &valueType));
+
+		qname.uri = &NS_EMPTY;
+		TRY(asciiToString("sensor", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		sprintf(value, "node-%u", i % 16);
+		TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+		TRY(serialize.stringData(strm, chVal));
+		qname.uri = &uri;
+
+		for(f = 0; f < 4; f++)
+		{
+			TRY(asciiToString(RECORD_FIELDS[f], &ln, &strm->memList, FALSE));
+			TRY(serialize.startElement(strm, qname, &valueType));
+			switch(f)
+			{
+				case 0:
+					sprintf(value, "%u", 100000 + i);
+				break;
+				case 1:
+					sprintf(value, "%u.%u", 20 + (i*7) % 9, (i*3) % 10);
+				break;
+				case 2:
+					sprintf(value, "%u", 40 + (i*11) % 25);
+				break;
+				default:
+					strcpy(value, STATUS_VALUES[i % 29 == 0 ? 2 : (i % 7 == 0 ? 1 : 0)]);
+			}
+			TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+			TRY(serialize.stringData(strm, chVal));
+			TRY(serialize.endElement(strm));
+		}
+
+		TRY(serialize.endElement(strm));
+	}
+
+	return serialize.endElement(strm);
+}
+
+/* The body of a SenML document (exip/SenML-xsd.exi) of DOC_RECORD_COUNT <e> elements
+ * with a string, an integer and a float attribute value each */
+static errorCode encodeSenML(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String ln;
+	QName qname = {&NS_SENML, &ln, NULL};
+	String chVal;
+	Float fl;
+	char value[32];
+	EXITypeClass valueType;
+	unsigned int i;
+
+	TRY(asciiToString("senml", &ln, &strm->memList, FALSE));
+	TRY(serialize.startElement(strm, qname, &valueType));
+
+	for(i = 0; i < DOC_RECORD_COUNT; i++)
+	{
+		qname.uri = &NS_SENML;
+		TRY(asciiToString("e", &ln, &strm->memList, FALSE));
+		TRY(serialize.startElement(strm, qname, &valueType));
+
+		qname.uri = &NS_EMPTY;
+		TRY(asciiToString("n", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		strcpy(value, RECORD_FIELDS[1 + i % 3]);
+		TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+		TRY(serialize.stringData(strm, chVal));
+
+		TRY(asciiToString("t", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		TRY(serialize.intData(strm, (Integer) (10*i)));
+
+		TRY(asciiToString("v", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		fl.mantissa = 200 + (i*7) % 90;
+		fl.exponent = -1;
+		TRY(serialize.floatData(strm, fl));
+
+		TRY(serialize.endElement(strm));
+	}
+
+	return serialize.endElement(strm);
+}
+
+static errorCode encodeDocument(BinaryBuffer* buffer, EXIPSchema* schema, EncodeDocument encodeBody, unsigned char alignment, Index* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+
+	serialize.initHeader(&strm);
+	strm.header.has_options = TRUE;
+	if(alignment == COMPRESSION)
+		SET_COMPRESSION(strm.header.opts.enumOpt);
+	else
+		SET_ALIGNMENT(strm.header.opts.enumOpt, alignment);
+
+	TRY(serialize.initStream(&strm, *buffer, schema));
+
+	TRY_CATCH(serialize.exiHeader(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startDocument(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(encodeBody(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.endDocument(&strm), serialize.closeEXIStream(&strm));
+
+	*size = strm.context.bufferIndx + (strm.context.bitPointer != 0 ? 1 : 0);
+	buffer->bufContent = strm.context.bufferIndx + 1;
+
+	return serialize.closeEXIStream(&strm);
+}
+
+static errorCode decodeDocument(BinaryBuffer buffer, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Parser parser;
+
+	TRY(initParser(&parser, buffer, NULL));
+	TRY_CATCH(parseHeader(&parser, FALSE), destroyParser(&parser));
+	TRY_CATCH(setSchema(&parser, schema), destroyParser(&parser));
+
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&parser);
+
+	destroyParser(&parser);
+
+	return tmp_err_code == EXIP_PARSING_COMPLETE ? EXIP_OK : tmp_err_code;
+}
+
+/* Returns the decoding time per round in *decodeMs; the speed is reported relative to bitPackedMs */
+static int benchAlignment(BinaryBuffer buffer, EXIPSchema* schema, EncodeDocument encodeBody,
+		const char* name, unsigned char alignment, double bitPackedMs, double* decodeMs)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index size = 0;
+	double encodeMs;
+	unsigned int r;
+	clock_t start;
+
+	start = clock();
+	for(r = 0; r < ROUNDS; r++)
+	{
+		tmp_err_code = encodeDocument(&buffer, schema, encodeBody, alignment, &size);
+		if(tmp_err_code != EXIP_OK)
+		{
+			printf("%s: encoding error %d\n", name, tmp_err_code);
+			return 1;
+		}
+	}
+	encodeMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < ROUNDS; r++)
+	{
+		tmp_err_code = decodeDocument(buffer, schema);
+		if(tmp_err_code != EXIP_OK)
+		{
+			printf("%s: decoding error %d\n", name, tmp_err_code);
+			return 1;
+		}
+	}
+	*decodeMs = elapsedMs(start)/ROUNDS;
+
+	printf("%-16s %10u %12.2f %12.2f %9.2fx\n", name, (unsigned int) size, encodeMs/ROUNDS, *decodeMs,
+			bitPackedMs > 0 && *decodeMs > 0 ? bitPackedMs / *decodeMs : 1.0);
+
+	return 0;
+}
+
+static int benchDocument(BinaryBuffer buffer, EXIPSchema* schema, EncodeDocument encodeBody, const char* title)
+{
+	double bitPackedMs = 0;
+	double decodeMs = 0;
+	int failed = 0;
+
+	printf("\n%s\n", title);
+	printf("%-16s %10s %12s %12s %10s\n", "", "bytes", "encode [ms]", "decode [ms]", "decode vs");
+	printf("%-16s %10s %12s %12s %10s\n", "", "", "", "", "bit-packed");
+
+	failed += benchAlignment(buffer, schema, encodeBody, "bit-packed", BIT_PACKED, 0, &bitPackedMs);
+	failed += benchAlignment(buffer, schema, encodeBody, "byte-aligned", BYTE_ALIGNMENT, bitPackedMs, &decodeMs);
+#if COMPRESSION_USE
+	failed += benchAlignment(buffer, schema, encodeBody, "pre-compression", PRE_COMPRESSION, bitPackedMs, &decodeMs);
+	failed += benchAlignment(buffer, schema, encodeBody, "compression", COMPRESSION, bitPackedMs, &decodeMs);
+#endif
+
+	return failed;
+}
+
+static int loadSchema(const char* dataDir, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char path[MAX_PATH_LEN];
+	FILE* schemaFile;
+	BinaryBuffer buffer;
+
+	sprintf(path, "%.*s/exip/SenML-xsd.exi", MAX_PATH_LEN - 32, dataDir);
+	schemaFile = fopen(path, "rb");
+	if(schemaFile == NULL)
+	{
+		printf("Unable to open file %s\n", path);
+		return 1;
+	}
+
+	fseek(schemaFile, 0, SEEK_END);
+	buffer.bufLen = ftell(schemaFile) + 1;
+	fseek(schemaFile, 0, SEEK_SET);
+	buffer.buf = (char*) malloc(buffer.bufLen);
+	if(buffer.buf == NULL || fread(buffer.buf, buffer.bufLen - 1, 1, schemaFile) != 1)
+	{
+		fclose(schemaFile);
+		free(buffer.buf);
+		printf("Unable to read file %s\n", path);
+		return 1;
+	}
+	fclose(schemaFile);
+	buffer.bufContent = buffer.bufLen;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	tmp_err_code = generateSchemaInformedGrammars(&buffer, 1, SCHEMA_FORMAT_XSD_EXI, NULL, schema, NULL);
+	free(buffer.buf);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("grammar generation error %d\n", tmp_err_code);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static char buf[DOC_BUFFER_SIZE];
+	BinaryBuffer buffer;
+	EXIPSchema schema;
+	int failed = 0;
+
+	buffer.buf = buf;
+	buffer.bufLen = DOC_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	printf("COMPRESSION_USE %s, COMPRESSION_THREAD_USE %s, %d records x %d rounds\n", COMPRESSION_USE ? "ON" : "OFF",
+			COMPRESSION_THREAD_USE ? "ON" : "OFF", DOC_RECORD_COUNT, ROUNDS);
+
+	failed += benchDocument(buffer, NULL, encodeRecords, "schema-less records (string values)");
+
+	if(argc > 1)
+	{
+		if(loadSchema(argv[1], &schema) == 0)
+		{
+			failed += benchDocument(buffer, &schema, encodeSenML, "SenML schema (typed values)");
+			destroySchema(&schema);
+		}
+		else
+			failed++;
+	}
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,412 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_encoding.c
+ * @brief Measures the serialization of schema-informed documents with wide grammar rules
+ *
+ * Builds an XML schema (EXI encoded in memory) with an element <wide> of WIDE_ATTR_COUNT
+ * optional attributes and an unbounded choice of WIDE_ELEM_COUNT child elements, then
+ * encodes a document with all the attributes and DOC_CHILD_COUNT children in a
+ * pseudo-random order. The productions of the start element, attribute and end element
+ * events are looked up in rules with tens of productions. The document is encoded with
+ * the qnames (startElement/attribute) and with QName handles (startElementH/attributeH),
+ * then decoded. The memory of the grammar rules and productions of the schema is reported
+ * for the grammar layout of the build (PACKED_GRAMMAR_USE), and the time of the grammar
+ * generation is compared with the loading of the image of the schema (loadSchemaImage()).
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "EXISerializer.h"
+#include "EXIParser.h"
+#include "stringManipulate.h"
+#include "grammarGenerator.h"
+#include "schemaImage.h"
+
+#ifndef WIDE_ELEM_COUNT
+# define WIDE_ELEM_COUNT 64
+#endif
+#ifndef WIDE_ATTR_COUNT
+# define WIDE_ATTR_COUNT 32
+#endif
+#define DOC_CHILD_COUNT 20000
+#define SCHEMA_BUFFER_SIZE (4000 + 128*(WIDE_ELEM_COUNT + WIDE_ATTR_COUNT))
+#define DOC_BUFFER_SIZE 400000
+#define ROUNDS 20
+
+static const String NS_EMPTY = {NULL, 0};
+static const String NS_XSD = {"http://www.w3.org/2001/XMLSchema", 32};
+static const String PFX_XSD = {"xsd", 3};
+static const String NS_BENCH = {"urn:bench", 9};
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+static errorCode xsdStartElement(EXIStream* strm, const char* name)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String ln;
+	QName qname;
+	EXITypeClass valueType;
+
+	qname.uri = &NS_XSD;
+	qname.localName = &ln;
+	qname.prefix = &PFX_XSD;
+	TRY(asciiToString(name, &ln, &strm->memList, FALSE));
+
+	return serialize.startElement(strm, qname, &valueType);
+}
+
+static errorCode xsdAttribute(EXIStream* strm, const char* name, const char* value)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String ln;
+	String val;
+	QName qname = {&NS_EMPTY, &ln, NULL};
+	EXITypeClass valueType;
+
+	TRY(asciiToString(name, &ln, &strm->memList, FALSE));
+	TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+	TRY(asciiToString(value, &val, &strm->memList, TRUE));
+
+	return serialize.stringData(strm, val);
+}
+
+/* A named local element or attribute of type xsd:string */
+static errorCode xsdStringDecl(EXIStream* strm, const char* kind, const char* name)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	TRY(xsdStartElement(strm, kind));
+	TRY(xsdAttribute(strm, "name", name));
+	TRY(xsdAttribute(strm, "type", "xsd:string"));
+
+	return serialize.endElement(strm);
+}
+
+static errorCode encodeSchemaBody(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char name[16];
+	unsigned int i;
+
+	TRY(xsdStartElement(strm, "schema"));
+	TRY(serialize.namespaceDeclaration(strm, NS_XSD, PFX_XSD, TRUE));
+	TRY(xsdAttribute(strm, "elementFormDefault", "qualified"));
+	TRY(xsdAttribute(strm, "targetNamespace", "urn:bench"));
+
+	TRY(xsdStartElement(strm, "element"));
+	TRY(xsdAttribute(strm, "name", "wide"));
+	TRY(xsdStartElement(strm, "complexType"));
+
+	TRY(xsdStartElement(strm, "choice"));
+	TRY(xsdAttribute(strm, "maxOccurs", "unbounded"));
+	TRY(xsdAttribute(strm, "minOccurs", "0"));
+	for(i = 0; i < WIDE_ELEM_COUNT; i++)
+	{
+		sprintf(name, "e%03u", i);
+		TRY(xsdStringDecl(strm, "element", name));
+	}
+	TRY(serialize.endElement(strm));
+
+	for(i = 0; i < WIDE_ATTR_COUNT; i++)
+	{
+		sprintf(name, "a%03u", i);
+		TRY(xsdStringDecl(strm, "attribute", name));
+	}
+
+	TRY(serialize.endElement(strm));
+	TRY(serialize.endElement(strm));
+
+	return serialize.endElement(strm);
+}
+
+static errorCode loadWideSchema(EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	static char buf[SCHEMA_BUFFER_SIZE];
+	BinaryBuffer buffer;
+	EXIStream strm;
+
+	buffer.buf = buf;
+	buffer.bufLen = SCHEMA_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	serialize.initHeader(&strm);
+	strm.header.has_options = TRUE;
+	SET_PRESERVED(strm.header.opts.preserve, PRESERVE_PREFIXES);
+
+	TRY(serialize.initStream(&strm, buffer, NULL));
+	TRY_CATCH(serialize.exiHeader(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startDocument(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(encodeSchemaBody(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.endDocument(&strm), serialize.closeEXIStream(&strm));
+	buffer.bufContent = strm.context.bufferIndx + 1;
+	TRY(serialize.closeEXIStream(&strm));
+
+	return generateSchemaInformedGrammars(&buffer, 1, SCHEMA_FORMAT_XSD_EXI, NULL, schema, NULL);
+}
+
+/* With startElementH() and attributeH() when handles is not NULL */
+static errorCode encodeWideDocument(BinaryBuffer* buffer, EXIPSchema* schema, String* names, const QNameHandle* handles, Index* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+	QName qname = {&NS_BENCH, NULL, NULL};
+	String wide = {"wide", 4};
+	String chVal = {"value", 5};
+	EXITypeClass valueType;
+	unsigned int i, n;
+	unsigned int seed = 12345;
+
+	serialize.initHeader(&strm);
+	strm.header.has_options = TRUE;
+	TRY(serialize.initStream(&strm, *buffer, schema));
+
+	TRY_CATCH(serialize.exiHeader(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startDocument(&strm), serialize.closeEXIStream(&strm));
+
+	qname.localName = &wide;
+	TRY_CATCH(serialize.startElement(&strm, qname, &valueType), serialize.closeEXIStream(&strm));
+
+	qname.uri = &NS_EMPTY;
+	for(i = 0; i < WIDE_ATTR_COUNT; i++)
+	{
+		n = WIDE_ELEM_COUNT + i;
+		qname.localName = &names[n];
+		if(handles != NULL)
+			TRY_CATCH(serialize.attributeH(&strm, &handles[n], TRUE, &valueType), serialize.closeEXIStream(&strm));
+		else
+			TRY_CATCH(serialize.attribute(&strm, qname, TRUE, &valueType), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.stringData(&strm, chVal), serialize.closeEXIStream(&strm));
+	}
+
+	qname.uri = &NS_BENCH;
+	for(i = 0; i < DOC_CHILD_COUNT; i++)
+	{
+		seed = seed*1103515245 + 12345;
+		n = (seed >> 16) % WIDE_ELEM_COUNT;
+		qname.localName = &names[n];
+		if(handles != NULL)
+			TRY_CATCH(serialize.startElementH(&strm, &handles[n], &valueType), serialize.closeEXIStream(&strm));
+		else
+			TRY_CATCH(serialize.startElement(&strm, qname, &valueType), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.stringData(&strm, chVal), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.endElement(&strm), serialize.closeEXIStream(&strm));
+	}
+
+	TRY_CATCH(serialize.endElement(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.endDocument(&strm), serialize.closeEXIStream(&strm));
+
+	*size = strm.context.bufferIndx + (strm.context.bitPointer != 0 ? 1 : 0);
+	buffer->bufContent = strm.context.bufferIndx + 1;
+
+	return serialize.closeEXIStream(&strm);
+}
+
+static errorCode decodeDocument(BinaryBuffer buffer, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Parser parser;
+
+	TRY(initParser(&parser, buffer, NULL));
+	TRY_CATCH(parseHeader(&parser, FALSE), destroyParser(&parser));
+	TRY_CATCH(setSchema(&parser, schema), destroyParser(&parser));
+
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&parser);
+
+	destroyParser(&parser);
+
+	return tmp_err_code == EXIP_PARSING_COMPLETE ? EXIP_OK : tmp_err_code;
+}
+
+/* The bytes of the grammar rules and productions of the schema-informed grammars */
+static size_t grammarBytes(EXIPSchema* schema, Index* prodCount)
+{
+	size_t bytes = 0;
+	Index g, r;
+
+	*prodCount = 0;
+	for(g = 0; g < schema->grammarTable.count; g++)
+	{
+		bytes += schema->grammarTable.grammar[g].count*sizeof(GrammarRule);
+		for(r = 0; r < schema->grammarTable.grammar[g].count; r++)
+			*prodCount += schema->grammarTable.grammar[g].rule[r].pCount;
+	}
+
+	return bytes + *prodCount*sizeof(Production);
+}
+
+/**
+ * Writes the image of the schema in memory and measures its loading
+ */
+static errorCode loadImageMs(EXIPSchema* schema, size_t* imageSize, double* loadMs)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIPSchema loaded;
+	void* image;
+	clock_t start;
+	unsigned int i;
+
+	TRY(writeSchemaImage(schema, NULL, imageSize));
+	image = malloc(*imageSize);
+	if(image == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	tmp_err_code = writeSchemaImage(schema, image, imageSize);
+	start = clock();
+	for(i = 0; i < ROUNDS && tmp_err_code == EXIP_OK; i++)
+	{
+		tmp_err_code = loadSchemaImage(image, *imageSize, &loaded);
+		if(tmp_err_code == EXIP_OK)
+			unloadSchemaImage(&loaded);
+	}
+	*loadMs = elapsedMs(start)/ROUNDS;
+
+	free(image);
+
+	return tmp_err_code;
+}
+
+int main(int argc, char *argv[])
+{
+	static char buf[DOC_BUFFER_SIZE];
+	static char nameChars[WIDE_ELEM_COUNT + WIDE_ATTR_COUNT][8];
+	String names[WIDE_ELEM_COUNT + WIDE_ATTR_COUNT];
+	QNameHandle handles[WIDE_ELEM_COUNT + WIDE_ATTR_COUNT];
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	EXIPSchema schema;
+	QName qname = {NULL, NULL, NULL};
+	Index size = 0;
+	Index sizeH = 0;
+	unsigned int i;
+	clock_t start;
+	double encodeMs;
+	double encodeHMs = 0;
+	double decodeMs = 0;
+	size_t grBytes;
+	Index prodCount;
+	double generateMs;
+	double imageMs = 0;
+	size_t imageSize = 0;
+
+	(void) argc;
+	(void) argv;
+
+	for(i = 0; i < WIDE_ELEM_COUNT + WIDE_ATTR_COUNT; i++)
+	{
+		sprintf(nameChars[i], "%c%03u", i < WIDE_ELEM_COUNT ? 'e' : 'a', i < WIDE_ELEM_COUNT ? i : i - WIDE_ELEM_COUNT);
+		names[i].str = nameChars[i];
+		names[i].length = strlen(nameChars[i]);
+	}
+
+	start = clock();
+	tmp_err_code = loadWideSchema(&schema);
+	generateMs = elapsedMs(start);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("grammar generation error %d\n", tmp_err_code);
+		return 1;
+	}
+
+	tmp_err_code = loadImageMs(&schema, &imageSize, &imageMs);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("schema image error %d\n", tmp_err_code);
+		return 1;
+	}
+
+	for(i = 0; i < WIDE_ELEM_COUNT + WIDE_ATTR_COUNT; i++)
+	{
+		qname.uri = i < WIDE_ELEM_COUNT ? &NS_BENCH : &NS_EMPTY;
+		qname.localName = &names[i];
+		resolveQNameHandle(&schema, qname, &handles[i]);
+	}
+
+	buffer.buf = buf;
+	buffer.bufLen = DOC_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	grBytes = grammarBytes(&schema, &prodCount);
+
+	printf("PRODUCTION_INDEX_USE %s, %d elements x %d attributes, %d children x %d rounds\n",
+			PRODUCTION_INDEX_USE ? "ON" : "OFF", WIDE_ELEM_COUNT, WIDE_ATTR_COUNT, DOC_CHILD_COUNT, ROUNDS);
+	printf("PACKED_GRAMMAR_USE %s, %u productions of %u bytes, %u bytes of grammar rules and productions\n",
+			PACKED_GRAMMAR_USE ? "ON" : "OFF", (unsigned int) prodCount, (unsigned int) sizeof(Production), (unsigned int) grBytes);
+	printf("grammar generation [ms] %.2f, loading of the schema image of %u bytes [ms] %.3f\n",
+			generateMs, (unsigned int) imageSize, imageMs);
+
+	start = clock();
+	for(i = 0; i < ROUNDS; i++)
+	{
+		tmp_err_code = encodeWideDocument(&buffer, &schema, names, NULL, &size);
+		if(tmp_err_code != EXIP_OK)
+			break;
+	}
+	encodeMs = elapsedMs(start)/ROUNDS;
+
+	if(tmp_err_code == EXIP_OK)
+	{
+		start = clock();
+		for(i = 0; i < ROUNDS; i++)
+		{
+			tmp_err_code = encodeWideDocument(&buffer, &schema, names, handles, &sizeH);
+			if(tmp_err_code != EXIP_OK)
+				break;
+		}
+		encodeHMs = elapsedMs(start)/ROUNDS;
+	}
+
+	if(tmp_err_code == EXIP_OK)
+	{
+		start = clock();
+		for(i = 0; i < ROUNDS; i++)
+		{
+			tmp_err_code = decodeDocument(buffer, &schema);
+			if(tmp_err_code != EXIP_OK)
+				break;
+		}
+		decodeMs = elapsedMs(start)/ROUNDS;
+	}
+
+	destroySchema(&schema);
+
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("error %d\n", tmp_err_code);
+		return 1;
+	}
+	if(sizeH != size)
+	{
+		printf("the document encoded with the QName handles has %u bytes instead of %u\n", (unsigned int) sizeH, (unsigned int) size);
+		return 1;
+	}
+
+	printf("%-16s %10s %12s\n", "", "bytes", "encode [ms]");
+	printf("%-16s %10u %12.2f\n", "qnames", (unsigned int) size, encodeMs);
+	printf("%-16s %10u %12.2f\n", "QName handles", (unsigned int) sizeH, encodeHMs);
+	printf("decode [ms] %.2f\n", decodeMs);
+
+	return 0;
+}
@@ -0,0 +1,264 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_memory.c
+ * @brief Counts the heap allocations made while decoding EXI streams
+ *
+ * Decodes a synthetic schema-less document repeatedly, once with a new parser
+ * object per stream (initParser()/destroyParser()) and once with a single parser
+ * object reused through resetParser(), and generates the grammars of the
+ * exip/schema_demo.xsd schema repeatedly. Reports the malloc/realloc/calloc
+ * calls per round and the time taken. Compare the numbers with MEM_ARENA_USE ON
+ * and OFF. The allocations are only counted with the GNU C library.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "EXISerializer.h"
+#include "EXIParser.h"
+#include "stringManipulate.h"
+#include "grammarGenerator.h"
+
+#define DOC_ELEM_COUNT 2000
+#define DOC_NAMES_COUNT 200
+#define DOC_BUFFER_SIZE 100000
+#define DECODE_ROUNDS 200
+#define SCHEMA_ROUNDS 50
+#define MAX_PATH_LEN 200
+
+static unsigned long allocCount = 0;
+
+#ifdef __GLIBC__
+/* Count the allocations by interposing the allocation functions of the C library */
+extern void* __libc_malloc(size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void* __libc_calloc(size_t nmemb, size_t size);
+
+void* malloc(size_t size)
+{
+	allocCount++;
+	return __libc_malloc(size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+	allocCount++;
+	return __libc_realloc(ptr, size);
+}
+
+void* calloc(size_t nmemb, size_t size)
+{
+	allocCount++;
+	return __libc_calloc(nmemb, size);
+}
+#endif
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+static void printRow(const char* name, unsigned long allocs, unsigned int rounds, double ms)
+{
+#ifdef __GLIBC__
+	printf("%-24s %12lu %10.2f\n", name, allocs/rounds, ms);
+#else
+	printf("%-24s %12s %10.2f\n", name, "n/a", ms);
+#endif
+}
+
+/* Serializes a schema-less document of DOC_ELEM_COUNT elements
+ * with DOC_NAMES_COUNT distinct names and distinct values */
+static errorCode encodeDocument(BinaryBuffer* buffer)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln};
+	String chVal;
+	char name[32];
+	EXITypeClass valueType;
+	unsigned int i;
+
+	serialize.initHeader(&strm);
+	TRY(serialize.initStream(&strm, *buffer, NULL));
+
+	TRY_CATCH(serialize.exiHeader(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startDocument(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(asciiToString("http://www.ltu.se/EISLAB/bench", &uri, &strm.memList, FALSE), serialize.closeEXIStream(&strm));
+	TRY_CATCH(asciiToString("document", &ln, &strm.memList, FALSE), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startElement(&strm, qname, &valueType), serialize.closeEXIStream(&strm));
+
+	for(i = 0; i < DOC_ELEM_COUNT; i++)
+	{
+		sprintf(name, "element%u", (i*7) % DOC_NAMES_COUNT);
+		TRY_CATCH(asciiToString(name, &ln, &strm.memList, TRUE), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.startElement(&strm, qname, &valueType), serialize.closeEXIStream(&strm));
+		sprintf(name, "value %u", i);
+		TRY_CATCH(asciiToString(name, &chVal, &strm.memList, TRUE), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.stringData(&strm, chVal), serialize.closeEXIStream(&strm));
+		TRY_CATCH(serialize.endElement(&strm), serialize.closeEXIStream(&strm));
+	}
+
+	TRY_CATCH(serialize.endElement(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.endDocument(&strm), serialize.closeEXIStream(&strm));
+
+	buffer->bufContent = strm.context.bufferIndx + 1;
+
+	return serialize.closeEXIStream(&strm);
+}
+
+static errorCode decodeDocument(Parser* parser)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	TRY(parseHeader(parser, TRUE));
+	TRY(setSchema(parser, NULL));
+
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(parser);
+
+	return tmp_err_code == EXIP_PARSING_COMPLETE ? EXIP_OK : tmp_err_code;
+}
+
+static int benchDecode(BinaryBuffer buffer, boolean reuse)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Parser parser;
+	unsigned long allocs;
+	unsigned int r;
+	clock_t start;
+
+	allocs = allocCount;
+	start = clock();
+
+	if(reuse)
+		tmp_err_code = initParser(&parser, buffer, NULL);
+
+	for(r = 0; r < DECODE_ROUNDS; r++)
+	{
+		if(!reuse)
+			tmp_err_code = initParser(&parser, buffer, NULL);
+		else if(r > 0)
+			tmp_err_code = parse.resetParser(&parser, buffer, NULL);
+
+		if(tmp_err_code == EXIP_OK)
+			tmp_err_code = decodeDocument(&parser);
+
+		if(!reuse || tmp_err_code != EXIP_OK)
+			destroyParser(&parser);
+
+		if(tmp_err_code != EXIP_OK)
+		{
+			printf("decoding error %d\n", tmp_err_code);
+			return 1;
+		}
+	}
+
+	if(reuse)
+		destroyParser(&parser);
+
+	printRow(reuse ? "decode, resetParser" : "decode, new parser", allocCount - allocs, DECODE_ROUNDS, elapsedMs(start));
+
+	return 0;
+}
+
+static int benchSchema(const char* dataDir)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char path[MAX_PATH_LEN];
+	FILE* schemaFile;
+	BinaryBuffer buffer;
+	EXIPSchema schema;
+	unsigned long allocs;
+	unsigned int r;
+	clock_t start;
+
+	sprintf(path, "%.*s/exip/schema_demo.exi", MAX_PATH_LEN - 32, dataDir);
+	schemaFile = fopen(path, "rb");
+	if(schemaFile == NULL)
+	{
+		printf("Unable to open file %s\n", path);
+		return 1;
+	}
+
+	fseek(schemaFile, 0, SEEK_END);
+	buffer.bufLen = ftell(schemaFile) + 1;
+	fseek(schemaFile, 0, SEEK_SET);
+	buffer.buf = (char*) malloc(buffer.bufLen);
+	if(buffer.buf == NULL || fread(buffer.buf, buffer.bufLen - 1, 1, schemaFile) != 1)
+	{
+		fclose(schemaFile);
+		printf("Unable to read file %s\n", path);
+		return 1;
+	}
+	fclose(schemaFile);
+	buffer.bufContent = buffer.bufLen;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	allocs = allocCount;
+	start = clock();
+
+	for(r = 0; r < SCHEMA_ROUNDS; r++)
+	{
+		tmp_err_code = generateSchemaInformedGrammars(&buffer, 1, SCHEMA_FORMAT_XSD_EXI, NULL, &schema, NULL);
+		if(tmp_err_code != EXIP_OK)
+		{
+			printf("grammar generation error %d\n", tmp_err_code);
+			free(buffer.buf);
+			return 1;
+		}
+		destroySchema(&schema);
+	}
+
+	printRow("schema_demo.xsd grammars", allocCount - allocs, SCHEMA_ROUNDS, elapsedMs(start));
+
+	free(buffer.buf);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static char buf[DOC_BUFFER_SIZE];
+	BinaryBuffer buffer;
+	int failed = 0;
+
+	buffer.buf = buf;
+	buffer.bufLen = DOC_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	if(encodeDocument(&buffer) != EXIP_OK)
+	{
+		printf("encoding error\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("MEM_ARENA_USE %s, %d elements (%u bytes) x %d rounds, schema x %d rounds\n", MEM_ARENA_USE ? "ON" : "OFF",
+			DOC_ELEM_COUNT, (unsigned int) buffer.bufContent, DECODE_ROUNDS, SCHEMA_ROUNDS);
+	printf("%-24s %12s %10s\n", "", "allocs/round", "total [ms]");
+
+	failed += benchDecode(buffer, FALSE);
+	failed += benchDecode(buffer, TRUE);
+	if(argc > 1)
+		failed += benchSchema(argv[1]);
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,455 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_parsing.c
+ * @brief Compares the decoding time of parseNext() and parseNextBatch()
+ *
+ * Encodes a synthetic schema-less document of repeating records and decodes
+ * it with parseNext() and a content handler, then with parseNextBatch() and
+ * arrays of several sizes. Both consume every event in the same way (a checksum of
+ * the kinds, the strings and the values) so that only the delivery of the events
+ * differs. The time per round and the speed relative to parseNext() are reported.
+ * With the test-set folder as a first argument the same is done for a
+ * schema-informed SenML document with typed values (exip/SenML-xsd.exi).
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "EXISerializer.h"
+#include "EXIParser.h"
+#include "stringManipulate.h"
+#include "grammarGenerator.h"
+
+#define DOC_RECORD_COUNT 2000
+#define DOC_BUFFER_SIZE 200000
+#define ROUNDS 200
+#define MAX_PATH_LEN 200
+#define MAX_BATCH_SIZE 256
+#define BENCH_COUNT 5
+
+typedef errorCode (*EncodeDocument)(EXIStream* strm);
+
+static const String NS_EMPTY = {NULL, 0};
+static const String NS_SENML = {"urn:ietf:params:xml:ns:senml", 28};
+static const char* const RECORD_FIELDS[4] = {"id", "temperature", "humidity", "status"};
+static const char* const STATUS_VALUES[3] = {"ok", "warning", "maintenance"};
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+/* The body of a schema-less document of DOC_RECORD_COUNT <record> elements,
+ * each with a sensor attribute and four child elements with short text values */
+static errorCode encodeRecords(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	String chVal;
+	char value[32];
+	EXITypeClass valueType;
+	unsigned int i, f;
+
+	TRY(asciiToString("http://www.ltu.se/EISLAB/bench", &uri, &strm->memList, FALSE));
+	TRY(asciiToString("log", &ln, &strm->memList, FALSE));
+	TRY(serialize.startElement(strm, qname, &valueType));
+
+	for(i = 0; i < DOC_RECORD_COUNT; i++)
+	{
+		TRY(asciiToString("record", &ln, &strm->memList, FALSE));
+		TRY(serialize.startElement(strm, qname, &valueType));
+
+		qname.uri = &NS_EMPTY;
+		TRY(asciiToString("sensor", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		sprintf(value, "node-%u", i % 16);
+		TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+		TRY(serialize.stringData(strm, chVal));
+		qname.uri = &uri;
+
+		for(f = 0; f < 4; f++)
+		{
+			TRY(asciiToString(RECORD_FIELDS[f], &ln, &strm->memList, FALSE));
+			TRY(serialize.startElement(strm, qname, &valueType));
+			switch(f)
+			{
+				case 0:
+					sprintf(value, "%u", 100000 + i);
+				break;
+				case 1:
+					sprintf(value, "%u.%u", 20 + (i*7) % 9, (i*3) % 10);
+				break;
+				case 2:
+					sprintf(value, "%u", 40 + (i*11) % 25);
+				break;
+				default:
+					strcpy(value, STATUS_VALUES[i % 29 == 0 ? 2 : (i % 7 == 0 ? 1 : 0)]);
+			}
+			TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+			TRY(serialize.stringData(strm, chVal));
+			TRY(serialize.endElement(strm));
+		}
+
+		TRY(serialize.endElement(strm));
+	}
+
+	return serialize.endElement(strm);
+}
+
+/* The body of a SenML document (exip/SenML-xsd.exi) of DOC_RECORD_COUNT <e> elements
+ * with a string, an integer and a float attribute value each */
+static errorCode encodeSenML(EXIStream* strm)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	String ln;
+	QName qname = {&NS_SENML, &ln, NULL};
+	String chVal;
+	Float fl;
+	char value[32];
+	EXITypeClass valueType;
+	unsigned int i;
+
+	TRY(asciiToString("senml", &ln, &strm->memList, FALSE));
+	TRY(serialize.startElement(strm, qname, &valueType));
+
+	for(i = 0; i < DOC_RECORD_COUNT; i++)
+	{
+		qname.uri = &NS_SENML;
+		TRY(asciiToString("e", &ln, &strm->memList, FALSE));
+		TRY(serialize.startElement(strm, qname, &valueType));
+
+		qname.uri = &NS_EMPTY;
+		TRY(asciiToString("n", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		strcpy(value, RECORD_FIELDS[1 + i % 3]);
+		TRY(asciiToString(value, &chVal, &strm->memList, TRUE));
+		TRY(serialize.stringData(strm, chVal));
+
+		TRY(asciiToString("t", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		TRY(serialize.intData(strm, (Integer) (10*i)));
+
+		TRY(asciiToString("v", &ln, &strm->memList, FALSE));
+		TRY(serialize.attribute(strm, qname, TRUE, &valueType));
+		fl.mantissa = 200 + (i*7) % 90;
+		fl.exponent = -1;
+		TRY(serialize.floatData(strm, fl));
+
+		TRY(serialize.endElement(strm));
+	}
+
+	return serialize.endElement(strm);
+}
+
+static errorCode encodeDocument(BinaryBuffer* buffer, EXIPSchema* schema, EncodeDocument encodeBody, Index* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+
+	serialize.initHeader(&strm);
+	strm.header.has_options = TRUE;
+	TRY(serialize.initStream(&strm, *buffer, schema));
+
+	TRY_CATCH(serialize.exiHeader(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.startDocument(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(encodeBody(&strm), serialize.closeEXIStream(&strm));
+	TRY_CATCH(serialize.endDocument(&strm), serialize.closeEXIStream(&strm));
+
+	*size = strm.context.bufferIndx + (strm.context.bitPointer != 0 ? 1 : 0);
+	buffer->bufContent = *size;
+
+	return serialize.closeEXIStream(&strm);
+}
+
+/* The work done for every event by both ways of parsing */
+static void sumString(unsigned long* sum, const String* str)
+{
+	*sum += str->length;
+	if(str->length > 0)
+		*sum += (unsigned char) str->str[str->length - 1];
+}
+
+static errorCode sum_endDocument(void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_END_DOCUMENT + 1;
+	return EXIP_OK;
+}
+
+static errorCode sum_startElement(QName qname, void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_START_ELEMENT + 1;
+	sumString((unsigned long*) app_data, qname.localName);
+	return EXIP_OK;
+}
+
+static errorCode sum_endElement(void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_END_ELEMENT + 1;
+	return EXIP_OK;
+}
+
+static errorCode sum_attribute(QName qname, void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_ATTRIBUTE + 1;
+	sumString((unsigned long*) app_data, qname.localName);
+	return EXIP_OK;
+}
+
+static errorCode sum_intData(Integer int_val, void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_INT + 1 + (unsigned long) int_val;
+	return EXIP_OK;
+}
+
+static errorCode sum_stringData(const String str_val, void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_STRING + 1;
+	sumString((unsigned long*) app_data, &str_val);
+	return EXIP_OK;
+}
+
+static errorCode sum_floatData(Float float_val, void* app_data)
+{
+	*(unsigned long*) app_data += EXI_EVENT_FLOAT + 1 + (unsigned long) float_val.mantissa;
+	return EXIP_OK;
+}
+
+static errorCode parseWithHandler(BinaryBuffer buffer, EXIPSchema* schema, unsigned long* sum)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Parser parser;
+
+	TRY(initParser(&parser, buffer, sum));
+	parser.handler.endDocument = sum_endDocument;
+	parser.handler.startElement = sum_startElement;
+	parser.handler.endElement = sum_endElement;
+	parser.handler.attribute = sum_attribute;
+	parser.handler.intData = sum_intData;
+	parser.handler.stringData = sum_stringData;
+	parser.handler.floatData = sum_floatData;
+
+	TRY_CATCH(parseHeader(&parser, FALSE), destroyParser(&parser));
+	TRY_CATCH(setSchema(&parser, schema), destroyParser(&parser));
+
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&parser);
+
+	destroyParser(&parser);
+
+	return tmp_err_code == EXIP_PARSING_COMPLETE ? EXIP_OK : tmp_err_code;
+}
+
+static errorCode parseInBatches(BinaryBuffer buffer, EXIPSchema* schema, Index batchSize, unsigned long* sum)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	static EXIEvent events[MAX_BATCH_SIZE];
+	Parser parser;
+	String uri;
+	String ln;
+	Index count = 0;
+	Index i;
+
+	TRY(initParser(&parser, buffer, NULL));
+	TRY_CATCH(parseHeader(&parser, FALSE), destroyParser(&parser));
+	TRY_CATCH(setSchema(&parser, schema), destroyParser(&parser));
+
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parseNextBatch(&parser, events, batchSize, &count);
+		for(i = 0; i < count; i++)
+		{
+			*sum += events[i].kind + 1;
+			switch(events[i].kind)
+			{
+				case EXI_EVENT_START_ELEMENT:
+				case EXI_EVENT_ATTRIBUTE:
+					if(getQNameStrings(&parser, events[i].qnameId, &uri, &ln) == EXIP_OK)
+						sumString(sum, &ln);
+				break;
+				case EXI_EVENT_INT:
+					*sum += (unsigned long) events[i].data.intVal;
+				break;
+				case EXI_EVENT_STRING:
+					sumString(sum, &events[i].data.strVal);
+				break;
+				case EXI_EVENT_FLOAT:
+					*sum += (unsigned long) events[i].data.floatVal.mantissa;
+				break;
+			}
+		}
+	}
+
+	destroyParser(&parser);
+
+	return tmp_err_code == EXIP_PARSING_COMPLETE ? EXIP_OK : tmp_err_code;
+}
+
+/* batchSize 0 parses with parseNext(); keeps the fastest round in *decodeMs */
+static int parseRound(BinaryBuffer buffer, EXIPSchema* schema, const char* name, Index batchSize,
+		unsigned long* sum, double* decodeMs)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	clock_t start;
+	double roundMs;
+
+	*sum = 0;
+	start = clock();
+	if(batchSize == 0)
+		tmp_err_code = parseWithHandler(buffer, schema, sum);
+	else
+		tmp_err_code = parseInBatches(buffer, schema, batchSize, sum);
+	roundMs = elapsedMs(start);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("%s: decoding error %d\n", name, tmp_err_code);
+		return 1;
+	}
+
+	if(*decodeMs < 0 || roundMs < *decodeMs)
+		*decodeMs = roundMs;
+
+	return 0;
+}
+
+/* The rounds of the ways of parsing are interleaved so that they are measured
+ * under the same load of the machine */
+static int benchDocument(BinaryBuffer buffer, EXIPSchema* schema, EncodeDocument encodeBody, const char* title)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	const Index batchSizes[BENCH_COUNT] = {0, 1, 16, 64, MAX_BATCH_SIZE};
+	char name[BENCH_COUNT][32];
+	double decodeMs[BENCH_COUNT];
+	unsigned long sum[BENCH_COUNT];
+	Index size = 0;
+	unsigned int r;
+	unsigned int b;
+
+	tmp_err_code = encodeDocument(&buffer, schema, encodeBody, &size);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("%s: encoding error %d\n", title, tmp_err_code);
+		return 1;
+	}
+
+	for(b = 0; b < BENCH_COUNT; b++)
+	{
+		if(batchSizes[b] == 0)
+			sprintf(name[b], "parseNext");
+		else
+			sprintf(name[b], "parseNextBatch %u", (unsigned int) batchSizes[b]);
+		decodeMs[b] = -1;
+	}
+
+	for(r = 0; r < ROUNDS; r++)
+	{
+		for(b = 0; b < BENCH_COUNT; b++)
+		{
+			if(parseRound(buffer, schema, name[b], batchSizes[b], &sum[b], &decodeMs[b]) != 0)
+				return 1;
+		}
+	}
+
+	printf("\n%s, %u bytes\n", title, (unsigned int) size);
+	printf("%-22s %12s %10s\n", "", "decode [ms]", "vs");
+	printf("%-22s %12s %10s\n", "", "", "parseNext");
+
+	for(b = 0; b < BENCH_COUNT; b++)
+	{
+		if(sum[b] != sum[0])
+		{
+			printf("%s: the events differ from parseNext()\n", name[b]);
+			return 1;
+		}
+		printf("%-22s %12.3f %9.2fx\n", name[b], decodeMs[b], decodeMs[b] > 0 ? decodeMs[0] / decodeMs[b] : 1.0);
+	}
+
+	return 0;
+}
+
+static int loadSchema(const char* dataDir, EXIPSchema* schema)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char path[MAX_PATH_LEN];
+	FILE* schemaFile;
+	BinaryBuffer buffer;
+
+	sprintf(path, "%.*s/exip/SenML-xsd.exi", MAX_PATH_LEN - 32, dataDir);
+	schemaFile = fopen(path, "rb");
+	if(schemaFile == NULL)
+	{
+		printf("Unable to open file %s\n", path);
+		return 1;
+	}
+
+	fseek(schemaFile, 0, SEEK_END);
+	buffer.bufLen = ftell(schemaFile) + 1;
+	fseek(schemaFile, 0, SEEK_SET);
+	buffer.buf = (char*) malloc(buffer.bufLen);
+	if(buffer.buf == NULL || fread(buffer.buf, buffer.bufLen - 1, 1, schemaFile) != 1)
+	{
+		fclose(schemaFile);
+		free(buffer.buf);
+		printf("Unable to read file %s\n", path);
+		return 1;
+	}
+	fclose(schemaFile);
+	buffer.bufContent = buffer.bufLen;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	tmp_err_code = generateSchemaInformedGrammars(&buffer, 1, SCHEMA_FORMAT_XSD_EXI, NULL, schema, NULL);
+	free(buffer.buf);
+	if(tmp_err_code != EXIP_OK)
+	{
+		printf("grammar generation error %d\n", tmp_err_code);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static char buf[DOC_BUFFER_SIZE];
+	BinaryBuffer buffer;
+	EXIPSchema schema;
+	int failed = 0;
+
+	buffer.buf = buf;
+	buffer.bufLen = DOC_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	printf("%d records x %d rounds\n", DOC_RECORD_COUNT, ROUNDS);
+
+	failed += benchDocument(buffer, NULL, encodeRecords, "schema-less records (string values)");
+
+	if(argc > 1)
+	{
+		if(loadSchema(argv[1], &schema) == 0)
+		{
+			failed += benchDocument(buffer, &schema, encodeSenML, "SenML schema (typed values)");
+			destroySchema(&schema);
+		}
+		else
+			failed++;
+	}
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
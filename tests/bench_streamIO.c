@@ -0,0 +1,624 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_streamIO.c
+ * @brief Micro-benchmarks for the low-level EXI stream reader/writer
+ *
+ * Compares the byte-by-byte reference reader and writer with the word-at-a-time
+ * ones of streamRead.c and streamWrite.c on the EXI streams from the test-set folder.
+ * Run with the test-set folder as a first argument:
+ * <code>
+ *   bench_streamIO ../../tests/test-set
+ * </code>
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "streamRead.h"
+#include "streamWrite.h"
+#include "streamDecode.h"
+#include "streamEncode.h"
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "memManagement.h"
+#include "ioUtil.h"
+
+#define MAX_PATH_LEN 200
+#define MAX_FILE_SIZE 100000
+#define BENCH_ROUNDS 2000
+#define PAYLOAD_UINT_COUNT 20000
+#define PAYLOAD_STRING_COUNT 16
+#define PAYLOAD_STRING_LENGTH 4096
+
+/* Location for external test data */
+static char *dataDir;
+
+static const char* benchFiles[] = {
+		"Ant/build-build.bitPacked",
+		"exip/schema_demo.exi",
+		"SchemaStrict/lkab-devices-xsd.exi",
+		"SchemaLess-WrongBody.exi",
+		"exip/SenML-xsd.exi",
+		"testStates/acceptance-xsd.exi"
+};
+
+/* The widths of the consecutive fields read from a stream: a mix of event codes,
+ * n-bit integers and 8-bit unsigned integer octets */
+static const unsigned char fieldWidths[] = {1, 2, 8, 3, 8, 8, 1, 4, 8, 5, 2, 9, 8, 17, 8, 11, 6, 1, 8, 8};
+
+#define FIELD_WIDTHS_COUNT (sizeof(fieldWidths)/sizeof(fieldWidths[0]))
+
+#define REMAINING_BITS(strm) (8*((strm)->buffer.bufContent - (strm)->context.bufferIndx) - (strm)->context.bitPointer)
+
+extern const unsigned char BIT_MASK[];
+
+/* The byte-by-byte reader as implemented before the word-at-a-time reader;
+ * used as a reference for the results and the timings */
+static errorCode refReadBits(EXIStream* strm, unsigned char n, unsigned long* bits_val)
+{
+	unsigned int numBytesToBeRead = 1 + ((n + strm->context.bitPointer - 1) / 8);
+	unsigned int byteIndx = 1;
+	unsigned char *buf;
+
+	if(strm->buffer.bufContent < strm->context.bufferIndx + numBytesToBeRead)
+		return EXIP_BUFFER_END_REACHED;
+
+	buf = (unsigned char *) strm->buffer.buf + strm->context.bufferIndx;
+
+	*bits_val = (buf[0] & BIT_MASK[8 - strm->context.bitPointer])<<((numBytesToBeRead-1)*8);
+
+	while(byteIndx < numBytesToBeRead)
+	{
+		*bits_val += (unsigned long) (buf[byteIndx])<<((numBytesToBeRead-byteIndx-1)*8);
+		byteIndx++;
+	}
+
+	*bits_val = *bits_val >> (numBytesToBeRead*8 - n - strm->context.bitPointer);
+
+	n += strm->context.bitPointer;
+	strm->context.bufferIndx += n / 8;
+	strm->context.bitPointer = n % 8;
+
+	return EXIP_OK;
+}
+
+/* The byte-by-byte writer as implemented before the word-at-a-time writer */
+static errorCode refWriteNBits(EXIStream* strm, unsigned char nbits, unsigned long bits_val)
+{
+	unsigned int numBitsWrite = 0;
+	unsigned char tmp = 0;
+	int bits_in_byte = 0;
+
+	while(numBitsWrite < nbits)
+	{
+		if((unsigned int)(nbits - numBitsWrite) <= (unsigned int)(8 - strm->context.bitPointer))
+			bits_in_byte = nbits - numBitsWrite;
+		else
+			bits_in_byte = 8 - strm->context.bitPointer;
+
+		tmp = (bits_val >> (nbits - numBitsWrite - bits_in_byte)) & BIT_MASK[bits_in_byte];
+		tmp = tmp << (8 - strm->context.bitPointer - bits_in_byte);
+		strm->buffer.buf[strm->context.bufferIndx] = strm->buffer.buf[strm->context.bufferIndx] & (~BIT_MASK[8 - strm->context.bitPointer]);
+		strm->buffer.buf[strm->context.bufferIndx] = strm->buffer.buf[strm->context.bufferIndx] | tmp;
+
+		numBitsWrite += bits_in_byte;
+		moveBitPointer(strm, bits_in_byte);
+	}
+
+	return EXIP_OK;
+}
+
+/* The octet-by-octet Unsigned Integer decoder on top of the reference reader */
+static errorCode refDecodeUnsignedInteger(EXIStream* strm, UnsignedInteger* int_val)
+{
+	unsigned int i = 0;
+	unsigned long tmp_byte_buf = 0;
+	*int_val = 0;
+
+	do
+	{
+		if(refReadBits(strm, 8, &tmp_byte_buf) != EXIP_OK)
+			return EXIP_BUFFER_END_REACHED;
+
+		*int_val += ((UnsignedInteger) (tmp_byte_buf & 0x7F)) << i;
+		i += 7;
+	}
+	while(tmp_byte_buf & 0x80);
+
+	return EXIP_OK;
+}
+
+static void initBenchStream(EXIStream* strm, char* buf, Index size)
+{
+	strm->buffer.buf = buf;
+	strm->buffer.bufLen = size;
+	strm->buffer.bufContent = size;
+	strm->buffer.ioStrm.readWriteToStream = NULL;
+	strm->buffer.ioStrm.stream = NULL;
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 0;
+	makeDefaultOpts(&strm->header.opts);
+#if BINARY_ZERO_COPY_USE
+	strm->binaryScratch = NULL;
+	strm->binaryScratchSize = 0;
+#endif
+}
+
+static Index loadFile(const char* fileName, char* buf)
+{
+	char exiFileName[MAX_PATH_LEN + 1];
+	FILE* infile;
+	size_t size;
+
+	if(strlen(dataDir) + strlen(fileName) + 1 > MAX_PATH_LEN)
+		return 0;
+
+	strcpy(exiFileName, dataDir);
+	strcat(exiFileName, "/");
+	strcat(exiFileName, fileName);
+	infile = fopen(exiFileName, "rb");
+	if(!infile)
+	{
+		fprintf(stderr, "Unable to open file %s\n", exiFileName);
+		return 0;
+	}
+
+	size = fread(buf, 1, MAX_FILE_SIZE, infile);
+	fclose(infile);
+
+	return (Index) size;
+}
+
+/* Reads the whole buffer as a sequence of fields with the given reader.
+ * Returns a checksum of the values read */
+static unsigned long readAllFields(EXIStream* strm, errorCode (*reader)(EXIStream*, unsigned char, unsigned long*))
+{
+	unsigned long checksum = 0;
+	unsigned long val;
+	unsigned int i = 0;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 0;
+
+	while(REMAINING_BITS(strm) >= fieldWidths[i])
+	{
+		if(reader(strm, fieldWidths[i], &val) != EXIP_OK)
+			break;
+		checksum = checksum*31 + val;
+		i = (i + 1) % FIELD_WIDTHS_COUNT;
+	}
+
+	return checksum;
+}
+
+static unsigned long readAllUInts(EXIStream* strm)
+{
+	unsigned long checksum = 0;
+	UnsignedInteger val;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 3;
+
+	/* Stop before the last 10 bytes, which may hold an unterminated unsigned integer */
+	while(REMAINING_BITS(strm) >= 80)
+	{
+		if(decodeUnsignedInteger(strm, &val) != EXIP_OK)
+			break;
+		checksum = checksum*31 + (unsigned long) val;
+	}
+
+	return checksum;
+}
+
+/* Writes back the fields of the input stream to the output stream with the given writer */
+static void writeAllFields(EXIStream* in, EXIStream* out, errorCode (*writer)(EXIStream*, unsigned char, unsigned long))
+{
+	unsigned long val;
+	unsigned int i = 0;
+
+	in->context.bufferIndx = 0;
+	in->context.bitPointer = 0;
+	out->context.bufferIndx = 0;
+	out->context.bitPointer = 0;
+
+	while(REMAINING_BITS(in) >= fieldWidths[i])
+	{
+		if(readBits(in, fieldWidths[i], &val) != EXIP_OK || writer(out, fieldWidths[i], val) != EXIP_OK)
+			break;
+		i = (i + 1) % FIELD_WIDTHS_COUNT;
+	}
+}
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+/* Decodes all the unsigned integers of a payload */
+static UnsignedInteger decodeUIntPayload(EXIStream* strm, unsigned char startBit, errorCode (*decoder)(EXIStream*, UnsignedInteger*))
+{
+	UnsignedInteger sum = 0;
+	UnsignedInteger val;
+	unsigned int i;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = startBit;
+
+	for(i = 0; i < PAYLOAD_UINT_COUNT; i++)
+	{
+		decoder(strm, &val);
+		sum += val;
+	}
+
+	return sum;
+}
+
+/* Decodes all the length prefixed strings of a payload; the code points are decoded
+ * one by one with the given decoder, or with decodeStringOnly() when NULL */
+static UnsignedInteger decodeStringPayload(EXIStream* strm, unsigned char startBit, errorCode (*decoder)(EXIStream*, UnsignedInteger*), String* str)
+{
+	UnsignedInteger sum = 0;
+	UnsignedInteger len;
+	UnsignedInteger codePoint;
+	unsigned int i;
+	Index c;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = startBit;
+
+	for(i = 0; i < PAYLOAD_STRING_COUNT; i++)
+	{
+		if(decoder == NULL)
+		{
+			decodeUnsignedInteger(strm, &len);
+			decodeStringOnly(strm, (Index) len, str);
+			sum += (UnsignedInteger) str->str[len - 1];
+		}
+		else
+		{
+			decoder(strm, &len);
+			for(c = 0; c < len; c++)
+			{
+				decoder(strm, &codePoint);
+				str->str[c] = (CharType) codePoint;
+			}
+			sum += codePoint;
+		}
+	}
+
+	return sum;
+}
+
+/* The binary decoding with an allocation and a readBits() call per octet */
+static errorCode refDecodeBinary(EXIStream* strm, char** binary_val, Index* nbytes)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UnsignedInteger length;
+	unsigned long int_val;
+	UnsignedInteger i;
+
+	TRY(decodeUnsignedInteger(strm, &length));
+	*nbytes = (Index) length;
+	*binary_val = (char*) EXIP_MALLOC(length);
+	if(*binary_val == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	for(i = 0; i < length; i++)
+	{
+		TRY_CATCH(readBits(strm, 8, &int_val), EXIP_MFREE(*binary_val));
+		(*binary_val)[i] = (char) int_val;
+	}
+
+	return EXIP_OK;
+}
+
+/* Decodes all the binary values of a payload with decodeBinary(),
+ * or with refDecodeBinary() when reference is TRUE */
+static UnsignedInteger decodeBinaryPayload(EXIStream* strm, unsigned char startBit, boolean reference)
+{
+	UnsignedInteger sum = 0;
+	char* binary_val;
+	Index nbytes;
+	unsigned int i;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = startBit;
+
+	for(i = 0; i < PAYLOAD_STRING_COUNT; i++)
+	{
+		if(reference)
+		{
+			refDecodeBinary(strm, &binary_val, &nbytes);
+			sum += (unsigned char) binary_val[nbytes - 1];
+			EXIP_MFREE(binary_val);
+		}
+		else
+		{
+			decodeBinary(strm, &binary_val, &nbytes);
+			sum += (unsigned char) binary_val[nbytes - 1];
+#if !BINARY_ZERO_COPY_USE
+			EXIP_MFREE(binary_val);
+#endif
+		}
+	}
+
+	return sum;
+}
+
+/* Encodes the string PAYLOAD_STRING_COUNT times: one Unsigned Integer per character
+ * when reference is TRUE and with encodeString() otherwise */
+static void encodeStringPayload(EXIStream* strm, unsigned char startBit, const String* str, boolean reference)
+{
+	unsigned int i;
+	Index c;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = startBit;
+
+	for(i = 0; i < PAYLOAD_STRING_COUNT; i++)
+	{
+		if(reference)
+		{
+			encodeUnsignedInteger(strm, (UnsignedInteger) str->length);
+			for(c = 0; c < str->length; c++)
+				encodeUnsignedInteger(strm, (UnsignedInteger) str->str[c]);
+		}
+		else
+			encodeString(strm, str);
+	}
+}
+
+/* Compares the reference and the fast decoding of synthetic payloads dominated by short
+ * unsigned integers, by long strings and by binary values; both bit-packed and byte-aligned */
+static int benchPayloads(void)
+{
+	static char buf[MAX_FILE_SIZE];
+	static char refBuf[MAX_FILE_SIZE];
+	static CharType chars[PAYLOAD_STRING_LENGTH];
+	EXIStream strm;
+	EXIStream refStrm;
+	String str;
+	unsigned char startBit;
+	unsigned int i, r;
+	UnsignedInteger refSum, newSum;
+	clock_t start;
+	double refMs, newMs;
+	int failed = 0;
+
+	str.str = chars;
+	str.length = PAYLOAD_STRING_LENGTH;
+
+	printf("\n%-36s %7s | %7s %7s %7s\n", "payload", "bytes", "ref", "fast", "speedup");
+
+	for(startBit = 0; startBit <= 3; startBit += 3)
+	{
+		initBenchStream(&strm, buf, MAX_FILE_SIZE);
+		strm.context.bitPointer = startBit;
+		for(i = 0; i < PAYLOAD_UINT_COUNT; i++)
+			encodeUnsignedInteger(&strm, (UnsignedInteger) ((i*37) % 300));
+		strm.buffer.bufContent = strm.context.bufferIndx + 1;
+
+		refSum = decodeUIntPayload(&strm, startBit, refDecodeUnsignedInteger);
+		newSum = decodeUIntPayload(&strm, startBit, decodeUnsignedInteger);
+		if(refSum != newSum)
+		{
+			printf("short uints: the fast decoding returns different values\n");
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			refSum += decodeUIntPayload(&strm, startBit, refDecodeUnsignedInteger);
+		refMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			newSum += decodeUIntPayload(&strm, startBit, decodeUnsignedInteger);
+		newMs = elapsedMs(start);
+
+		printf("%-36s %7u | %7.2f %7.2f %6.2fx\n", startBit == 0 ? "short uints (byte-aligned)" : "short uints (bit-packed)",
+				(unsigned int) strm.buffer.bufContent, refMs, newMs, newMs > 0 ? refMs/newMs : 0.0);
+	}
+
+	for(startBit = 0; startBit <= 3; startBit += 3)
+	{
+		initBenchStream(&strm, buf, MAX_FILE_SIZE);
+		strm.context.bitPointer = startBit;
+		for(i = 0; i < PAYLOAD_STRING_LENGTH; i++)
+			chars[i] = (CharType) (' ' + (i*7) % 90);
+		for(i = 0; i < PAYLOAD_STRING_COUNT; i++)
+			encodeString(&strm, &str);
+		strm.buffer.bufContent = strm.context.bufferIndx + 1;
+
+		refSum = decodeStringPayload(&strm, startBit, refDecodeUnsignedInteger, &str);
+		newSum = decodeStringPayload(&strm, startBit, NULL, &str);
+		if(refSum != newSum)
+		{
+			printf("long strings: the fast decoding returns different values\n");
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			refSum += decodeStringPayload(&strm, startBit, refDecodeUnsignedInteger, &str);
+		refMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			newSum += decodeStringPayload(&strm, startBit, NULL, &str);
+		newMs = elapsedMs(start);
+
+		printf("%-36s %7u | %7.2f %7.2f %6.2fx\n", startBit == 0 ? "long strings (byte-aligned)" : "long strings (bit-packed)",
+				(unsigned int) strm.buffer.bufContent, refMs, newMs, newMs > 0 ? refMs/newMs : 0.0);
+	}
+
+	for(startBit = 0; startBit <= 3; startBit += 3)
+	{
+		initBenchStream(&strm, buf, MAX_FILE_SIZE);
+		strm.context.bitPointer = startBit;
+		for(i = 0; i < PAYLOAD_STRING_LENGTH; i++)
+			refBuf[i] = (char) ((i*7) % 128);
+		for(i = 0; i < PAYLOAD_STRING_COUNT; i++)
+			encodeBinary(&strm, refBuf, PAYLOAD_STRING_LENGTH);
+		strm.buffer.bufContent = strm.context.bufferIndx + 1;
+
+		refSum = decodeBinaryPayload(&strm, startBit, TRUE);
+		newSum = decodeBinaryPayload(&strm, startBit, FALSE);
+		if(refSum != newSum)
+		{
+			printf("binary values: the fast decoding returns different values\n");
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			refSum += decodeBinaryPayload(&strm, startBit, TRUE);
+		refMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			newSum += decodeBinaryPayload(&strm, startBit, FALSE);
+		newMs = elapsedMs(start);
+
+		printf("%-36s %7u | %7.2f %7.2f %6.2fx\n", startBit == 0 ? "binary values (byte-aligned)" : "binary values (bit-packed)",
+				(unsigned int) strm.buffer.bufContent, refMs, newMs, newMs > 0 ? refMs/newMs : 0.0);
+#if BINARY_ZERO_COPY_USE
+		EXIP_MFREE(strm.binaryScratch);
+#endif
+	}
+
+	for(startBit = 0; startBit <= 3; startBit += 3)
+	{
+		initBenchStream(&strm, buf, MAX_FILE_SIZE);
+		initBenchStream(&refStrm, refBuf, MAX_FILE_SIZE);
+		memset(buf, 0, MAX_FILE_SIZE);
+		memset(refBuf, 0, MAX_FILE_SIZE);
+
+		encodeStringPayload(&refStrm, startBit, &str, TRUE);
+		encodeStringPayload(&strm, startBit, &str, FALSE);
+		if(refStrm.context.bufferIndx != strm.context.bufferIndx || memcmp(refBuf, buf, strm.context.bufferIndx + 1) != 0)
+		{
+			printf("long strings: the fast encoding writes different output\n");
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			encodeStringPayload(&refStrm, startBit, &str, TRUE);
+		refMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS/10; r++)
+			encodeStringPayload(&strm, startBit, &str, FALSE);
+		newMs = elapsedMs(start);
+
+		printf("%-36s %7u | %7.2f %7.2f %6.2fx\n", startBit == 0 ? "long strings encode (byte-aligned)" : "long strings encode (bit-packed)",
+				(unsigned int) strm.context.bufferIndx, refMs, newMs, newMs > 0 ? refMs/newMs : 0.0);
+	}
+
+	return failed;
+}
+
+int main(int argc, char *argv[])
+{
+	static char buf[MAX_FILE_SIZE];
+	static char refOutBuf[MAX_FILE_SIZE];
+	static char outBuf[MAX_FILE_SIZE];
+	EXIStream strm;
+	EXIStream outStrm;
+	unsigned int f, r;
+	Index size;
+	unsigned long refSum, newSum;
+	clock_t start;
+	double refMs, newMs, uintMs, refWrMs, newWrMs;
+	int failed = 0;
+
+	if(argc < 2)
+	{
+		printf("ERR: Expected test data directory\n");
+		exit(1);
+	}
+	dataDir = argv[1];
+
+	printf("%-36s %7s | %-23s %10s | %-23s\n", "", "", "readBits [ms]", "", "writeNBits [ms]");
+	printf("%-36s %7s | %7s %7s %7s %10s | %7s %7s %7s\n", "stream", "bytes", "ref", "word", "speedup", "uint [ms]", "ref", "word", "speedup");
+
+	for(f = 0; f < sizeof(benchFiles)/sizeof(benchFiles[0]); f++)
+	{
+		size = loadFile(benchFiles[f], buf);
+		if(size == 0)
+		{
+			failed++;
+			continue;
+		}
+
+		initBenchStream(&strm, buf, size);
+
+		refSum = readAllFields(&strm, refReadBits);
+		newSum = readAllFields(&strm, readBits);
+		if(refSum != newSum)
+		{
+			printf("%s: the word-at-a-time reader returns different values\n", benchFiles[f]);
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS; r++)
+			refSum += readAllFields(&strm, refReadBits);
+		refMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS; r++)
+			newSum += readAllFields(&strm, readBits);
+		newMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS; r++)
+			newSum += readAllUInts(&strm);
+		uintMs = elapsedMs(start);
+
+		initBenchStream(&outStrm, refOutBuf, size);
+		writeAllFields(&strm, &outStrm, refWriteNBits);
+		initBenchStream(&outStrm, outBuf, size);
+		writeAllFields(&strm, &outStrm, writeNBits);
+		if(memcmp(refOutBuf, outBuf, outStrm.context.bufferIndx) != 0)
+		{
+			printf("%s: the word-at-a-time writer produces different output\n", benchFiles[f]);
+			failed++;
+			continue;
+		}
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS; r++)
+			writeAllFields(&strm, &outStrm, refWriteNBits);
+		refWrMs = elapsedMs(start);
+
+		start = clock();
+		for(r = 0; r < BENCH_ROUNDS; r++)
+			writeAllFields(&strm, &outStrm, writeNBits);
+		newWrMs = elapsedMs(start);
+
+		printf("%-36s %7u | %7.2f %7.2f %6.2fx %10.2f | %7.2f %7.2f %6.2fx\n", benchFiles[f], (unsigned int) size,
+				refMs, newMs, newMs > 0 ? refMs/newMs : 0.0, uintMs,
+				refWrMs, newWrMs, newWrMs > 0 ? refWrMs/newWrMs : 0.0);
+	}
+
+	failed += benchPayloads();
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
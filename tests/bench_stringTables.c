@@ -0,0 +1,406 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_stringTables.c
+ * @brief Micro-benchmarks for the lookups in the string tables
+ *
+ * Fills a local-name table with the names of a synthetic 10k-name schema, a
+ * URI table with 500 namespaces and the local value partition of an element with
+ * 5000 distinct values, and compares lookupLn()/lookupUri()/lookupVx() against a
+ * plain linear scan with stringEqual(), for strings that are in the tables and
+ * strings that are not. The hash table of the global value partition is measured
+ * under the insert/remove churn of a value partition that wraps around.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sTables.h"
+#include "stringManipulate.h"
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "memManagement.h"
+#include "dynamicArray.h"
+#include "hashtable.h"
+
+#define LN_NAMES_NUMBER 10000
+#define URI_NAMES_NUMBER 500
+#define VX_VALUES_NUMBER 5000
+#define CHURN_CAPACITY 4096
+#define CHURN_VALUES_NUMBER 200000
+#define BENCH_ROUNDS 2
+#define NAME_SIZE 32
+
+static char lnNames[LN_NAMES_NUMBER][NAME_SIZE];
+static char missingNames[LN_NAMES_NUMBER][NAME_SIZE];
+static char uriNames[URI_NAMES_NUMBER][NAME_SIZE];
+static char vxValues[VX_VALUES_NUMBER][NAME_SIZE];
+static char churnValues[CHURN_VALUES_NUMBER][NAME_SIZE];
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+/* The lookup without the index */
+static boolean linearLookupLn(LnTable* lnTable, String lnStr, Index* lnEntryId)
+{
+	Index i;
+
+	for(i = 0; i < lnTable->count; i++)
+	{
+		if(stringEqual(lnTable->ln[i].lnStr, lnStr))
+		{
+			*lnEntryId = i;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static boolean linearLookupUri(UriTable* uriTable, String uriStr, SmallIndex* uriEntryId)
+{
+	SmallIndex i;
+
+	for(i = 0; i < uriTable->count; i++)
+	{
+		if(stringEqual(uriTable->uri[i].uriStr, uriStr))
+		{
+			*uriEntryId = i;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+#if VALUE_CROSSTABLE_USE
+static boolean linearLookupVx(ValueTable* valueTable, VxTable* vxTable, String valueStr, Index* vxEntryId)
+{
+	Index i;
+
+	for(i = 0; i < vxTable->count; i++)
+	{
+		if(vxTable->vx[i].globalId != INDEX_MAX && stringEqual(valueTable->value[vxTable->vx[i].globalId].valueStr, valueStr))
+		{
+			*vxEntryId = i;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+#endif
+
+static int benchLn(LnTable* lnTable)
+{
+	String name;
+	Index id, refId;
+	unsigned int r, i;
+	unsigned long found = 0;
+	clock_t start;
+	double linMs, idxMs, linMissMs, idxMissMs;
+
+	for(i = 0; i < LN_NAMES_NUMBER; i++)
+	{
+		asciiToString(lnNames[i], &name, NULL, FALSE);
+		if(!lookupLn(lnTable, name, &id) || !linearLookupLn(lnTable, name, &refId) || id != refId)
+		{
+			printf("lookupLn: wrong result for %s\n", lnNames[i]);
+			return 1;
+		}
+		asciiToString(missingNames[i], &name, NULL, FALSE);
+		if(lookupLn(lnTable, name, &id))
+		{
+			printf("lookupLn: finds the missing name %s\n", missingNames[i]);
+			return 1;
+		}
+	}
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		for(i = 0; i < LN_NAMES_NUMBER; i++)
+		{
+			asciiToString(lnNames[i], &name, NULL, FALSE);
+			found += linearLookupLn(lnTable, name, &id);
+		}
+	linMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		for(i = 0; i < LN_NAMES_NUMBER; i++)
+		{
+			asciiToString(lnNames[i], &name, NULL, FALSE);
+			found += lookupLn(lnTable, name, &id);
+		}
+	idxMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		for(i = 0; i < LN_NAMES_NUMBER; i++)
+		{
+			asciiToString(missingNames[i], &name, NULL, FALSE);
+			found += linearLookupLn(lnTable, name, &id);
+		}
+	linMissMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		for(i = 0; i < LN_NAMES_NUMBER; i++)
+		{
+			asciiToString(missingNames[i], &name, NULL, FALSE);
+			found += lookupLn(lnTable, name, &id);
+		}
+	idxMissMs = elapsedMs(start);
+
+	printf("%-12s %7u | %9.2f %9.2f %9.2f %9.2f   (%lu)\n", "local-names", (unsigned int) lnTable->count,
+			linMs, idxMs, linMissMs, idxMissMs, found);
+
+	return 0;
+}
+
+static int benchUri(UriTable* uriTable)
+{
+	String name;
+	SmallIndex id, refId;
+	unsigned int r, i;
+	unsigned long found = 0;
+	clock_t start;
+	double linMs, idxMs;
+
+	for(i = 0; i < URI_NAMES_NUMBER; i++)
+	{
+		asciiToString(uriNames[i], &name, NULL, FALSE);
+		if(!lookupUri(uriTable, name, &id) || !linearLookupUri(uriTable, name, &refId) || id != refId)
+		{
+			printf("lookupUri: wrong result for %s\n", uriNames[i]);
+			return 1;
+		}
+	}
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS*10; r++)
+		for(i = 0; i < URI_NAMES_NUMBER; i++)
+		{
+			asciiToString(uriNames[i], &name, NULL, FALSE);
+			found += linearLookupUri(uriTable, name, &id);
+		}
+	linMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS*10; r++)
+		for(i = 0; i < URI_NAMES_NUMBER; i++)
+		{
+			asciiToString(uriNames[i], &name, NULL, FALSE);
+			found += lookupUri(uriTable, name, &id);
+		}
+	idxMs = elapsedMs(start);
+
+	printf("%-12s %7u | %9.2f %9.2f %9s %9s   (%lu)\n", "uris", (unsigned int) uriTable->count,
+			linMs, idxMs, "-", "-", found);
+
+	return 0;
+}
+
+#if VALUE_CROSSTABLE_USE
+static int benchVx(ValueTable* valueTable, VxTable* vxTable)
+{
+	String value;
+	Index id, refId;
+	unsigned int r, i;
+	unsigned long found = 0;
+	clock_t start;
+	double linMs, idxMs;
+
+	for(i = 0; i < VX_VALUES_NUMBER; i++)
+	{
+		asciiToString(vxValues[i], &value, NULL, FALSE);
+		if(!lookupVx(valueTable, vxTable, value, &id) || !linearLookupVx(valueTable, vxTable, value, &refId) || id != refId)
+		{
+			printf("lookupVx: wrong result for %s\n", vxValues[i]);
+			return 1;
+		}
+	}
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS*2; r++)
+		for(i = 0; i < VX_VALUES_NUMBER; i++)
+		{
+			asciiToString(vxValues[i], &value, NULL, FALSE);
+			found += linearLookupVx(valueTable, vxTable, value, &id);
+		}
+	linMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS*2; r++)
+		for(i = 0; i < VX_VALUES_NUMBER; i++)
+		{
+			asciiToString(vxValues[i], &value, NULL, FALSE);
+			found += lookupVx(valueTable, vxTable, value, &id);
+		}
+	idxMs = elapsedMs(start);
+
+	printf("%-12s %7u | %9.2f %9.2f %9s %9s   (%lu)\n", "values", (unsigned int) vxTable->count,
+			linMs, idxMs, "-", "-", found);
+
+	return 0;
+}
+#endif
+
+/* The value partition hash table with valuePartitionCapacity CHURN_CAPACITY:
+ * each new value evicts the oldest one */
+static int benchHashChurn(void)
+{
+	struct hashtable* h;
+	String value;
+	unsigned int i;
+	unsigned long found = 0;
+	clock_t start;
+	double churnMs, searchMs;
+
+	h = create_hashtable(INITIAL_HASH_TABLE_SIZE, wordHash, stringEqual);
+	if(h == NULL)
+	{
+		printf("create_hashtable error\n");
+		return 1;
+	}
+
+	for(i = 0; i < CHURN_VALUES_NUMBER; i++)
+		sprintf(churnValues[i], "value-%06u", i);
+
+	start = clock();
+	for(i = 0; i < CHURN_VALUES_NUMBER; i++)
+	{
+		if(i >= CHURN_CAPACITY)
+		{
+			asciiToString(churnValues[i - CHURN_CAPACITY], &value, NULL, FALSE);
+			found += hashtable_remove(h, value) == i - CHURN_CAPACITY;
+		}
+		asciiToString(churnValues[i], &value, NULL, FALSE);
+		if(hashtable_insert(h, value, i) != EXIP_OK)
+		{
+			printf("hashtable_insert error\n");
+			return 1;
+		}
+	}
+	churnMs = elapsedMs(start);
+
+	start = clock();
+	for(i = 0; i < CHURN_VALUES_NUMBER; i++)
+	{
+		asciiToString(churnValues[i], &value, NULL, FALSE);
+		found += hashtable_search(h, value) != INDEX_MAX;
+	}
+	searchMs = elapsedMs(start);
+
+	if(found != CHURN_VALUES_NUMBER)
+	{
+		printf("hashtable: wrong results\n");
+		return 1;
+	}
+
+	printf("%-12s %7u | %9s %9s %9.2f %9.2f   (%lu)\n", "value-churn", hashtable_count(h),
+			"-", "-", churnMs, searchMs, found);
+	hashtable_destroy(h);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	LnTable lnTable;
+	UriTable uriTable;
+#if VALUE_CROSSTABLE_USE
+	ValueTable valueTable;
+	VxTable vxTable;
+#endif
+	String name;
+	Index lnId;
+	SmallIndex uriId;
+	unsigned int i;
+	int failed = 0;
+
+	if(createDynArray(&lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER) != EXIP_OK ||
+			createDynArray(&uriTable.dynArray, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER) != EXIP_OK)
+	{
+		printf("memory allocation error\n");
+		return EXIT_FAILURE;
+	}
+#if STRING_TABLE_INDEX_USE
+	lnTable.index = NULL;
+	uriTable.index = NULL;
+#endif
+
+	/* Element and attribute names as found in a large generated schema */
+	for(i = 0; i < LN_NAMES_NUMBER; i++)
+	{
+		sprintf(lnNames[i], "%sType%05u", i % 3 == 0 ? "element" : (i % 3 == 1 ? "attribute" : "group"), i);
+		sprintf(missingNames[i], "%sType%05u", i % 2 == 0 ? "element" : "complex", i + LN_NAMES_NUMBER);
+		asciiToString(lnNames[i], &name, NULL, FALSE);
+		if(addLnEntry(&lnTable, name, &lnId) != EXIP_OK)
+		{
+			printf("addLnEntry error\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	for(i = 0; i < URI_NAMES_NUMBER; i++)
+	{
+		sprintf(uriNames[i], "http://example.org/ns/%03u", i);
+		asciiToString(uriNames[i], &name, NULL, FALSE);
+		if(addUriEntry(&uriTable, name, &uriId) != EXIP_OK)
+		{
+			printf("addUriEntry error\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+#if VALUE_CROSSTABLE_USE
+	/* A local value partition of sensor identifiers */
+	if(createDynArray(&valueTable.dynArray, sizeof(ValueEntry), DEFAULT_VALUE_ENTRIES_NUMBER) != EXIP_OK ||
+			createDynArray(&vxTable.dynArray, sizeof(VxEntry), DEFAULT_VX_ENTRIES_NUMBER) != EXIP_OK)
+	{
+		printf("memory allocation error\n");
+		return EXIT_FAILURE;
+	}
+#if STRING_TABLE_INDEX_USE
+	vxTable.index = NULL;
+#endif
+	for(i = 0; i < VX_VALUES_NUMBER; i++)
+	{
+		ValueEntry* valueEntry;
+		VxEntry vxEntry;
+		Index id;
+
+		sprintf(vxValues[i], "sensor-%04X-%u", i*7919 % 65536, i % 10);
+		vxEntry.globalId = i;
+		if(addEmptyDynEntry(&valueTable.dynArray, (void**) &valueEntry, &id) != EXIP_OK ||
+				addDynEntry(&vxTable.dynArray, &vxEntry, &id) != EXIP_OK)
+		{
+			printf("memory allocation error\n");
+			return EXIT_FAILURE;
+		}
+		asciiToString(vxValues[i], &valueEntry->valueStr, NULL, FALSE);
+	}
+#endif
+
+	printf("String table index %s, %s hash tables, %d rounds [ms]\n", STRING_TABLE_INDEX_USE ? "ON" : "OFF",
+			OPEN_HASH_TABLE_USE ? "open addressing" : "chained", BENCH_ROUNDS);
+	printf("%-12s %7s | %9s %9s %9s %9s\n", "table", "entries", "linear", "lookup", "lin-miss", "miss");
+
+	failed += benchLn(&lnTable);
+	failed += benchUri(&uriTable);
+	failed += benchHashChurn();
+#if VALUE_CROSSTABLE_USE
+	failed += benchVx(&valueTable, &vxTable);
+#endif
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+/*==================================================================*\
+|                EXIP - Embeddable EXI Processor in C                |
+|--------------------------------------------------------------------|
+|          This work is licensed under BSD 3-Clause License          |
+|  The full license terms and conditions are located in LICENSE.txt  |
+\===================================================================*/
+
+/**
+ * @file bench_strings.c
+ * @brief Micro-benchmarks for the stringManipulate.h backend
+ *
+ * Measures the string encoding/decoding and the string functions used in the hot
+ * paths (stringEqual, stringCompare, readCharFromString) on an ASCII-only and a
+ * mixed-script payload. The mixed-script payload is only run with the UTF-8
+ * backend (STRING_UTF8_USE ON); the ASCII backend can not represent it.
+ *
+ * @date Oct 18, 2026
+ * @version 0.5
+ * @par[Revision] $Id$
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "streamDecode.h"
+#include "streamEncode.h"
+#include "stringManipulate.h"
+#include "procTypes.h"
+#include "errorHandle.h"
+#include "memManagement.h"
+
+#define BENCH_ROUNDS 5000
+#define PAYLOAD_LENGTH 4096
+#define MAX_ENCODED_SIZE (PAYLOAD_LENGTH*4 + 16)
+
+/* The code points used for the words of the mixed-script payload:
+ * Latin-1, Cyrillic, CJK and a supplementary plane character */
+static const uint32_t mixedCodePoints[] = {0xE9, 0x430, 0x44F, 0x4E2D, 0x6587, 0x1F600};
+
+#define MIXED_CODE_POINTS_COUNT (sizeof(mixedCodePoints)/sizeof(mixedCodePoints[0]))
+
+static double elapsedMs(clock_t start)
+{
+	return 1000.0*(clock() - start)/CLOCKS_PER_SEC;
+}
+
+/* Fills str with PAYLOAD_LENGTH characters: words of 7 characters separated by spaces.
+ * The words are ASCII or take their characters from mixedCodePoints */
+static errorCode makePayload(String* str, boolean mixed)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Index writerPosition = 0;
+	uint32_t codePoint;
+	unsigned int i;
+
+	TRY(allocateStringMemory(&str->str, PAYLOAD_LENGTH));
+	str->length = PAYLOAD_LENGTH;
+
+	for(i = 0; i < PAYLOAD_LENGTH; i++)
+	{
+		if(i % 8 == 7)
+			codePoint = ' ';
+		else if(mixed && (i / 8) % 2 == 0)
+			codePoint = mixedCodePoints[(i / 8 + i) % MIXED_CODE_POINTS_COUNT];
+		else
+			codePoint = 'a' + (i*7) % 26;
+
+		TRY(writeCharToString(str, codePoint, &writerPosition));
+	}
+
+	return EXIP_OK;
+}
+
+static void initBenchStream(EXIStream* strm, char* buf)
+{
+	strm->buffer.buf = buf;
+	strm->buffer.bufLen = MAX_ENCODED_SIZE;
+	strm->buffer.bufContent = MAX_ENCODED_SIZE;
+	strm->buffer.ioStrm.readWriteToStream = NULL;
+	strm->buffer.ioStrm.stream = NULL;
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 3;
+	makeDefaultOpts(&strm->header.opts);
+}
+
+/* Decodes the string at the beginning of the stream into str */
+static errorCode decodePayload(EXIStream* strm, String* str)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	UnsignedInteger len;
+
+	strm->context.bufferIndx = 0;
+	strm->context.bitPointer = 3;
+	TRY(decodeUnsignedInteger(strm, &len));
+
+	return decodeStringOnly(strm, (Index) len, str);
+}
+
+/* Sums all the code points of a string */
+static uint32_t sumCodePoints(const String* str)
+{
+	Index readerPosition = 0;
+	uint32_t sum = 0;
+	Index i;
+
+	for(i = 0; i < str->length; i++)
+		sum += readCharFromString(str, &readerPosition);
+
+	return sum;
+}
+
+static int benchPayload(const char* name, boolean mixed)
+{
+	static char buf[MAX_ENCODED_SIZE];
+	EXIStream strm;
+	String payload;
+	String decoded;
+	String clone;
+	unsigned int r;
+	uint32_t sum = 0;
+	int diff = 0;
+	clock_t start;
+	double encMs, decMs, eqMs, cmpMs, readMs;
+
+	if(makePayload(&payload, mixed) != EXIP_OK || allocateStringMemory(&decoded.str, PAYLOAD_LENGTH) != EXIP_OK ||
+			cloneString(&payload, &clone) != EXIP_OK)
+	{
+		printf("%s: memory allocation error\n", name);
+		return 1;
+	}
+
+	initBenchStream(&strm, buf);
+	if(encodeString(&strm, &payload) != EXIP_OK || decodePayload(&strm, &decoded) != EXIP_OK ||
+			!stringEqual(payload, decoded) || sumCodePoints(&payload) != sumCodePoints(&decoded))
+	{
+		printf("%s: the string does not survive the encoding and decoding\n", name);
+		return 1;
+	}
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+	{
+		strm.context.bufferIndx = 0;
+		strm.context.bitPointer = 3;
+		encodeString(&strm, &payload);
+	}
+	encMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		decodePayload(&strm, &decoded);
+	decMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		diff += stringEqual(clone, decoded);
+	eqMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		diff += stringCompare(clone, decoded);
+	cmpMs = elapsedMs(start);
+
+	start = clock();
+	for(r = 0; r < BENCH_ROUNDS; r++)
+		sum += sumCodePoints(&decoded);
+	readMs = elapsedMs(start);
+
+	printf("%-12s %7u | %9.2f %9.2f %9.2f %9.2f %9.2f   (%u)\n", name, (unsigned int) strm.context.bufferIndx,
+			encMs, decMs, eqMs, cmpMs, readMs, (unsigned int) (sum + diff) % 10);
+
+	EXIP_MFREE(payload.str);
+	EXIP_MFREE(decoded.str);
+	EXIP_MFREE(clone.str);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	printf("%s backend, %d characters, %d rounds [ms]\n", STRING_UTF8_USE ? "UTF-8" : "ASCII", PAYLOAD_LENGTH, BENCH_ROUNDS);
+	printf("%-12s %7s | %9s %9s %9s %9s %9s\n", "payload", "bytes", "encode", "decode", "equal", "compare", "read");
+
+	failed += benchPayload("ascii", FALSE);
+#if STRING_UTF8_USE
+	failed += benchPayload("mixed", TRUE);
+#else
+	printf("%-12s (requires STRING_UTF8_USE)\n", "mixed");
+#endif
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -18,6 +18,7 @@
 #include <stdlib.h>
 #include <check.h>
 #include "headerDecode.h"
+#include "headerEncode.h"
 #include "bodyDecode.h"
 #include "memManagement.h"
 
@@ -85,6 +86,54 @@ START_TEST (test_decodeHeader)
 }
 END_TEST
 
+/**
+ * In byte-aligned mode the header is padded to the next octet also without
+ * the options document: the version 16 takes 8 bits and the header 12
+ */
+START_TEST (test_headerPaddingByteAligned)
+{
+	EXIStream testStream;
+	char buf[3];
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+
+	buf[0] = 0;
+	buf[1] = 0;
+	buf[2] = (char) 0x42;
+	testStream.buffer.buf = buf;
+	testStream.buffer.bufLen = 3;
+	testStream.buffer.bufContent = 0;
+	testStream.buffer.ioStrm.readWriteToStream = NULL;
+	testStream.buffer.ioStrm.stream = NULL;
+	testStream.context.bufferIndx = 0;
+	testStream.context.bitPointer = 0;
+	testStream.header.has_cookie = FALSE;
+	testStream.header.has_options = FALSE;
+	testStream.header.is_preview_version = FALSE;
+	testStream.header.version_number = 16;
+	makeDefaultOpts(&testStream.header.opts);
+	SET_ALIGNMENT(testStream.header.opts.enumOpt, BYTE_ALIGNMENT);
+
+	err = encodeHeader(&testStream);
+	fail_unless (err == EXIP_OK, "encodeHeader returns error code %d", err);
+	fail_unless (testStream.context.bufferIndx == 2 && testStream.context.bitPointer == 0,
+					"The header is not padded to the next octet");
+	fail_unless (buf[0] == (char) 0x8F && buf[1] == 0,
+					"The header is encoded as 0x%02X 0x%02X", (unsigned char) buf[0], (unsigned char) buf[1]);
+
+	testStream.buffer.bufContent = 3;
+	testStream.context.bufferIndx = 0;
+	testStream.context.bitPointer = 0;
+	testStream.header.version_number = 0;
+
+	err = decodeHeader(&testStream, TRUE);
+	fail_unless (err == EXIP_OK, "decodeHeader returns error code %d", err);
+	fail_unless (testStream.header.version_number == 16,
+					"decodeHeader reads version %d", testStream.header.version_number);
+	fail_unless (testStream.context.bufferIndx == 2 && testStream.context.bitPointer == 0,
+					"The padding of the header is not skipped");
+}
+END_TEST
+
 /* END: header tests */
 
 Suite * contentio_suite (void)
@@ -94,6 +143,7 @@ Suite * contentio_suite (void)
   /* Header test case */
   TCase *tc_header = tcase_create ("EXI Header");
   tcase_add_test (tc_header, test_decodeHeader);
+  tcase_add_test (tc_header, test_headerPaddingByteAligned);
   suite_add_tcase (s, tc_header);
   return s;
 }
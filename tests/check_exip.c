@@ -17,12 +17,22 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <check.h>
 #include "procTypes.h"
 #include "EXISerializer.h"
 #include "EXIParser.h"
 #include "stringManipulate.h"
 #include "grammarGenerator.h"
+#include "grammars.h"
+#include "sTables.h"
+#include "schemaImage.h"
+#include "schemaRegistry.h"
+#ifndef _MSC_VER
+# include <pthread.h>
+# include <sys/mman.h>
+# include <time.h>
+#endif
 
 #define MAX_PATH_LEN 200
 #define OUTPUT_BUFFER_SIZE 2000
@@ -716,6 +726,13 @@ START_TEST (test_built_in_dynamic_types)
 	int strmSize = 0;
 	BinaryBuffer buffer;
 	Parser testParser;
+	const unsigned char kinds[9] = {EXI_EVENT_START_ELEMENT, EXI_EVENT_NAMESPACE, EXI_EVENT_START_ELEMENT, EXI_EVENT_ATTRIBUTE,
+			EXI_EVENT_QNAME, EXI_EVENT_DATE_TIME, EXI_EVENT_END_ELEMENT, EXI_EVENT_END_ELEMENT, EXI_EVENT_END_DOCUMENT};
+	EXIEvent events[16];
+	String uri;
+	String ln;
+	Index count = 0;
+	Index i;
 
 	tmp_err_code = encodeWithDynamicTypes(buf, OUTPUT_BUFFER_SIZE, &strmSize);
 	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of dynamic types through xsi:type switch.");
@@ -728,6 +745,8 @@ START_TEST (test_built_in_dynamic_types)
 	// Parsing steps:
 
 	// I: First, define an external stream for the input to the parser if any
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
 
 	// II: Second, initialize the parser object
 	tmp_err_code = initParser(&testParser, buffer, NULL);
@@ -754,6 +773,33 @@ START_TEST (test_built_in_dynamic_types)
 
 	destroyParser(&testParser);
 	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+
+	// The namespace, the xsi:type value and the dateTime are pointed to by the events of parseNextBatch()
+	tmp_err_code = initParser(&testParser, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	if(tmp_err_code == EXIP_OK)
+		tmp_err_code = setSchema(&testParser, NULL);
+	if(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNextBatch(&testParser, events, 16, &count);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "parseNextBatch() returns an error code %d", tmp_err_code);
+	fail_unless (count == 9, "parseNextBatch() decodes %u events", (unsigned int) count);
+	for(i = 0; i < count; i++)
+		fail_unless (events[i].kind == kinds[i], "Event %u is of kind %u", (unsigned int) i, (unsigned int) events[i].kind);
+
+	tmp_err_code = getQNameStrings(&testParser, events[2].qnameId, &uri, &ln);
+	fail_unless (tmp_err_code == EXIP_OK && stringEqualToAscii(ln, "anElement") && uri.length == 0, "The element is not resolved by its qnameId");
+	fail_unless (events[3].qnameId.uriId == XML_SCHEMA_INSTANCE_ID && events[3].qnameId.lnId == XML_SCHEMA_INSTANCE_TYPE_ID &&
+			stringEqualToAscii(events[3].data.prefix, "xsi"), "The xsi:type attribute is not decoded with its prefix");
+	fail_unless (stringEqualToAscii(events[1].data.ns->ns, "http://www.w3.org/2001/XMLSchema-instance") &&
+			stringEqualToAscii(events[1].data.ns->prefix, "xsi") && !events[1].data.ns->isLocal, "The namespace declaration is not decoded");
+	fail_unless (stringEqualToAscii(events[4].data.qname->uri, "http://www.w3.org/2001/XMLSchema") &&
+			stringEqualToAscii(events[4].data.qname->localName, "dateTime"), "The xsi:type value is not decoded");
+	fail_unless (events[5].data.dtVal->dateTime.tm_year == 114 && events[5].data.dtVal->dateTime.tm_mday == 31 &&
+			events[5].data.dtVal->dateTime.tm_sec == 25, "The dateTime value is not decoded");
+	tmp_err_code = getQNameStrings(&testParser, events[8].qnameId, &uri, &ln);
+	fail_unless (tmp_err_code == EXIP_OUT_OF_BOUND_BUFFER, "getQNameStrings() of the end of the document returns an error code %d", tmp_err_code);
+	destroyParser(&testParser);
 }
 END_TEST
 
@@ -850,1668 +896,4311 @@ errorCode encodeWithDynamicTypes(char* buf, int buf_size, int *strmSize)
 	return EXIP_OK;
 }
 
-/* END: SchemaLess tests */
-
-#define OUTPUT_BUFFER_SIZE_LARGE_DOC 20000
-#define MAX_XSD_FILES_COUNT 10 // up to 10 XSD files
+#define REUSE_ELEM_COUNT 50
+#define REUSE_PARSE_ROUNDS 3
 
-/* BEGIN: Schema-mode tests */
-START_TEST (test_large_doc_str_pattern)
+struct reuseCounts
 {
-	const String NS_EMPTY_STR = {NULL, 0};
-
-	const String ELEM_CONFIGURATION = {"configuration", 13};
-	const String ELEM_CAPSWITCH = {"capable-switch", 14};
-	const String ELEM_RESOURCES = {"resources", 9};
-	const String ELEM_PORT = {"port", 4};
-	const String ELEM_RESID = {"resource-id", 11};
-	const String ELEM_ADMIN_STATE = {"admin-state", 11};
-	const String ELEM_NORECEIVE = {"no-receive", 10};
-	const String ELEM_NOFORWARD = {"no-forward", 10};
-	const String ELEM_NOPACKET = {"no-packet-in", 12};
+	unsigned int elements;
+	unsigned int values;
+};
 
-	const String ELEM_LOGSWITCHES = {"logical-switches", 16};
-	const String ELEM_SWITCH = {"switch", 6};
-	const String ELEM_ID = {"id", 2};
-	const String ELEM_DATAPATHID = {"datapath-id", 11};
-	const String ELEM_ENABLED = {"enabled", 7};
-	const String ELEM_LOSTCONNBEH = {"lost-connection-behavior", 24};
-	const String ELEM_CONTROLLERS = {"controllers", 11};
-	const String ELEM_CONTROLLER = {"controller", 10};
-	const String ELEM_ROLE = {"role", 4};
-	const String ELEM_IPADDR = {"ip-address", 10};
-	const String ELEM_PROTOCOL = {"protocol", 8};
-	const String ELEM_STATE = {"state", 5};
-	const String ELEM_CONNSTATE = {"connection-state", 16};
-	const String ELEM_CURRVER = {"current-version", 15};
+static errorCode reuse_startElement(QName qname, void* app_data)
+{
+	((struct reuseCounts*) app_data)->elements += 1;
+	return EXIP_OK;
+}
 
-	const char * PORT_STR = "port";
-	const char * SWITCH_STR = "switch";
-	const char * STATE_UP_STR = "up";
-	const char * DATAPATH_STR = "10:14:56:7C:89:46:7A:";
-	const char * LOST_CONN_BEHAVIOR_STR = "failSecureMode";
-	const char * CTRL_STR = "ctrl";
-	const char * ROLE_STR = "equal";
-	const char * IPADDR_STR = "10.10.10.";
-	const char * PROTOCOL_STR = "tcp";
-	const char * VER_STR = "1.0";
+static errorCode reuse_stringData(const String value, void* app_data)
+{
+	((struct reuseCounts*) app_data)->values += 1;
+	return EXIP_OK;
+}
 
-	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	FILE *outfile;
-	char* sourceFile = "testOutputFile.exi";
-	EXIPSchema schema;
-//	struct timespec start;
-//	struct timespec end;
-	char* schemafname[1] = {"exip/schema_demo.exi"};
+/**
+ * Parses the same schema-less EXI stream several times with one
+ * parser object that is prepared for each round with resetParser()
+ */
+START_TEST (test_parser_reuse)
+{
 	EXIStream testStrm;
+	Parser testParser;
 	String uri;
 	String ln;
-	QName qname = {&uri, &ln, NULL};
+	QName qname= {&uri, &ln};
 	String chVal;
-	char buf[OUTPUT_BUFFER_SIZE_LARGE_DOC];
+	char buf[OUTPUT_BUFFER_SIZE];
+	char name[20];
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	BinaryBuffer buffer;
-	int i, j;
-	char strbuffer[32];
+	EXITypeClass valueType;
+	struct reuseCounts counts;
+	unsigned int i;
 
 	buffer.buf = buf;
-	buffer.bufLen = OUTPUT_BUFFER_SIZE_LARGE_DOC;
 	buffer.bufContent = 0;
+	buffer.bufLen = OUTPUT_BUFFER_SIZE;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
 
-	parseSchema(schemafname, 1, &schema);
+	serialize.initHeader(&testStrm);
+	tmp_err_code = serialize.initStream(&testStrm, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
 
-	outfile = fopen(sourceFile, "wb" );
-	fail_if(!outfile, "Unable to open file %s", sourceFile);
+	tmp_err_code += serialize.exiHeader(&testStrm);
+	tmp_err_code += serialize.startDocument(&testStrm);
+	tmp_err_code += asciiToString("http://www.ltu.se/EISLAB/schema-test", &uri, &testStrm.memList, FALSE);
+	tmp_err_code += asciiToString("list", &ln, &testStrm.memList, FALSE);
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
 
-	// Serialization steps:
+	for(i = 0; i < REUSE_ELEM_COUNT; i++)
+	{
+		sprintf(name, "item%u", i % 20);
+		tmp_err_code += asciiToString(name, &ln, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+		sprintf(name, "value %u", i);
+		tmp_err_code += asciiToString(name, &chVal, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+	}
 
-	// I: First initialize the header of the stream
-	serialize.initHeader(&testStrm);
+	tmp_err_code += serialize.endElement(&testStrm);
+	tmp_err_code += serialize.endDocument(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialization ended with error code %d", tmp_err_code);
 
-	// II: Set any options in the header, if different from the defaults
-	testStrm.header.has_cookie = TRUE;
-	testStrm.header.has_options = TRUE;
-	testStrm.header.opts.valueMaxLength = 300;
-	testStrm.header.opts.valuePartitionCapacity = INDEX_MAX;
-	SET_STRICT(testStrm.header.opts.enumOpt);
+	tmp_err_code = serialize.closeEXIStream(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialize.closeEXIStream ended with error code %d", tmp_err_code);
 
-	// III: Define an external stream for the output if any
-	buffer.ioStrm.readWriteToStream = writeFileOutputStream;
-	buffer.ioStrm.stream = outfile;
-	//buffer.ioStrm.readWriteToStream = NULL;
-	//buffer.ioStrm.stream = NULL;
-// printf("line:%d: %d\n", __LINE__, tmp_err_code);
-	//clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
-	// IV: Initialize the stream
-	tmp_err_code = serialize.initStream(&testStrm, buffer, &schema);
-	fail_unless(tmp_err_code == EXIP_OK);
+	buffer.bufContent = OUTPUT_BUFFER_SIZE;
 
-//printf("line:%d: %d\n", __LINE__, tmp_err_code);
-//                clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
+	tmp_err_code = initParser(&testParser, buffer, &counts);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
 
-	// V: Start building the stream step by step: header, document, element etc...
-	tmp_err_code += serialize.exiHeader(&testStrm);
-// printf("line:%d: %d\n", __LINE__, tmp_err_code);
-	tmp_err_code += serialize.startDocument(&testStrm);
-// printf("line:%d: %d\n", __LINE__, tmp_err_code);
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_CONFIGURATION;
-	EXITypeClass typeClass;
-	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	testParser.handler.startElement = reuse_startElement;
+	testParser.handler.stringData = reuse_stringData;
 
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_CAPSWITCH;
-	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	for(i = 0; i < REUSE_PARSE_ROUNDS; i++)
+	{
+		if(i > 0)
+		{
+			tmp_err_code = parse.resetParser(&testParser, buffer, &counts);
+			fail_unless (tmp_err_code == EXIP_OK, "resetParser returns an error code %d", tmp_err_code);
+		}
 
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_RESOURCES;
-	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+		counts.elements = 0;
+		counts.values = 0;
 
-// printf("line:%d: %d\n", __LINE__, tmp_err_code);
-	for (i = 0; i < 100; i++)
-	{
-		qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_PORT;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+		tmp_err_code = parseHeader(&testParser, TRUE);
+		fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_RESID;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+		tmp_err_code = setSchema(&testParser, NULL);
+		fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
 
-	    sprintf(strbuffer, "%s%d", PORT_STR, i);
-	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+		while(tmp_err_code == EXIP_OK)
+		{
+			tmp_err_code = parseNext(&testParser);
+		}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_CONFIGURATION;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+		fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing round %u: %d", i, tmp_err_code);
+		fail_unless (counts.elements == REUSE_ELEM_COUNT + 1, "Parsing round %u reports %u elements", i, counts.elements);
+		fail_unless (counts.values == REUSE_ELEM_COUNT, "Parsing round %u reports %u values", i, counts.values);
+	}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_ADMIN_STATE;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += asciiToString(STATE_UP_STR, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+	destroyParser(&testParser);
+}
+END_TEST
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_NORECEIVE;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += serialize.booleanData(&testStrm, FALSE);
-		tmp_err_code += serialize.endElement(&testStrm);
+#define CHUNKED_STRING_LENGTH 10000
+#define CHUNKED_BINARY_LENGTH 5000
+#define CHUNKED_ENCODE_PIECE 700
+#define CHUNKED_BUFFER_SIZE 20000
+#define CHUNKED_PARSER_BUFFER_SIZE 512
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_NOFORWARD;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += serialize.booleanData(&testStrm, FALSE);
-		tmp_err_code += serialize.endElement(&testStrm);
+struct chunkedValues
+{
+	unsigned int strings;
+	unsigned int stringChunks;
+	Index stringLength;
+	Index stringReceived;
+	boolean stringMatch;
+	unsigned int binaries;
+	Index binaryLength;
+	Index binaryReceived;
+	boolean binaryMatch;
+	boolean chunkTooLarge;
+};
+
+struct memorySource
+{
+	const char* data;
+	size_t length;
+	size_t position;
+};
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_NOPACKET;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += serialize.booleanData(&testStrm, TRUE);
-		tmp_err_code += serialize.endElement(&testStrm);
+static size_t readMemorySource(void* buf, size_t readSize, void* stream)
+{
+	struct memorySource* src = (struct memorySource*) stream;
+	size_t count = src->length - src->position;
 
-		tmp_err_code += serialize.endElement(&testStrm);
+	if(count > readSize)
+		count = readSize;
 
-		tmp_err_code += serialize.endElement(&testStrm);
-	}
-	tmp_err_code += serialize.endElement(&testStrm);
+	memcpy(buf, src->data + src->position, count);
+	src->position += count;
+	return count;
+}
 
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LOGSWITCHES;
-	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+static char chunkedStringChar(Index i)
+{
+	return (char) ('a' + (i*7) % 26);
+}
 
-	for (i = 0; i < 20; i++)
-	{
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_SWITCH;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+static char chunkedBinaryOctet(Index i)
+{
+	return (char) ((i*37 + 11) & 0xFF);
+}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_ID;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+static errorCode chunked_stringDataBegin(Index length, void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
 
-		sprintf(strbuffer, "%s%d", SWITCH_STR, i);
-	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+	vals->strings += 1;
+	vals->stringChunks = 0;
+	vals->stringLength = length;
+	vals->stringReceived = 0;
+	return EXIP_OK;
+}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_DATAPATHID;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+static errorCode chunked_stringDataChunk(const String chunk, void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
+	Index i;
 
-		sprintf(strbuffer, "%s%d", DATAPATH_STR, 10 + i);
-	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+	vals->stringChunks += 1;
+	if(chunk.length > VALUE_CHUNK_SIZE)
+		vals->chunkTooLarge = TRUE;
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_ENABLED;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += serialize.booleanData(&testStrm, TRUE);
-		tmp_err_code += serialize.endElement(&testStrm);
+	// Only the long value is checked character by character
+	if(vals->stringLength == CHUNKED_STRING_LENGTH)
+	{
+		for(i = 0; i < chunk.length; i++)
+		{
+			if(chunk.str[i] != chunkedStringChar(vals->stringReceived + i))
+				vals->stringMatch = FALSE;
+		}
+	}
+	vals->stringReceived += chunk.length;
+	return EXIP_OK;
+}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_LOSTCONNBEH;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += asciiToString(LOST_CONN_BEHAVIOR_STR, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-//		if ( i == 0 )
-//		{
-	        qname.uri = &NS_EMPTY_STR;
-	        qname.localName = &ELEM_RESOURCES;
-	        tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+static errorCode chunked_stringDataEnd(void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
 
-			for (j = 0; j < 100; j++)
-			{
-	            qname.uri = &NS_EMPTY_STR;
-	            qname.localName = &ELEM_PORT;
-	            tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	if(vals->stringReceived != vals->stringLength)
+		vals->stringMatch = FALSE;
+	return EXIP_OK;
+}
 
-				sprintf(strbuffer, "%s%d", PORT_STR, j);
-	            tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	            tmp_err_code += serialize.stringData(&testStrm, chVal);
-				tmp_err_code += serialize.endElement(&testStrm);
-			}
-			tmp_err_code += serialize.endElement(&testStrm);
-//		}
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_CONTROLLERS;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_CONTROLLER;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_ID;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-		sprintf(strbuffer, "%s%d", CTRL_STR, i);
-	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_ROLE;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += asciiToString(ROLE_STR, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+static errorCode chunked_binaryDataBegin(Index nbytes, void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_IPADDR;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-		sprintf(strbuffer, "%s%d", IPADDR_STR, i);
-	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+	vals->binaries += 1;
+	vals->binaryLength = nbytes;
+	vals->binaryReceived = 0;
+	return EXIP_OK;
+}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_PORT;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += serialize.intData(&testStrm, 6620);
-		tmp_err_code += serialize.endElement(&testStrm);
+static errorCode chunked_binaryDataChunk(const char* chunk, Index size, void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
+	Index i;
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_PROTOCOL;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += asciiToString(PROTOCOL_STR, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+	if(size > VALUE_CHUNK_SIZE)
+		vals->chunkTooLarge = TRUE;
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_STATE;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	for(i = 0; i < size; i++)
+	{
+		if(chunk[i] != chunkedBinaryOctet(vals->binaryReceived + i))
+			vals->binaryMatch = FALSE;
+	}
+	vals->binaryReceived += size;
+	return EXIP_OK;
+}
 
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_CONNSTATE;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-	    tmp_err_code += asciiToString(STATE_UP_STR, &chVal, &testStrm.memList, FALSE);
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+static errorCode chunked_binaryDataEnd(void* app_data)
+{
+	struct chunkedValues* vals = (struct chunkedValues*) app_data;
 
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    qname.uri = &NS_EMPTY_STR;
-	    qname.localName = &ELEM_CURRVER;
-	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
-// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
-	    tmp_err_code += asciiToString(VER_STR, &chVal, &testStrm.memList, FALSE);
+	if(vals->binaryReceived != vals->binaryLength)
+		vals->binaryMatch = FALSE;
+	return EXIP_OK;
+}
 
-	    tmp_err_code += serialize.stringData(&testStrm, chVal);
-		tmp_err_code += serialize.endElement(&testStrm);
+/**
+ * Serializes a long string value and a long xsi:type base64Binary value in pieces
+ * and parses them back through the chunk callbacks with a small parser buffer
+ */
+START_TEST (test_chunked_values)
+{
+	const String NS_EMPTY = {NULL, 0};
+	const String NS_XSI = {"http://www.w3.org/2001/XMLSchema-instance", 41};
+	const String NS_XSD = {"http://www.w3.org/2001/XMLSchema", 32};
+	const String ELEM_ROOT = {"root", 4};
+	const String ELEM_TEXT = {"text", 4};
+	const String ELEM_DATA = {"data", 4};
+	const String ELEM_SHORT = {"short", 5};
+	const String PREFIX_XSI = {"xsi", 3};
+	const String ATTR_TYPE = {"type", 4};
+	const String VALUE_BINARY = {"base64Binary", 12};
+	const String VALUE_SHORT = {"short value", 11};
 
-		tmp_err_code += serialize.endElement(&testStrm);
+	static char buf[CHUNKED_BUFFER_SIZE];
+	char parserBuf[CHUNKED_PARSER_BUFFER_SIZE];
+	char piece[CHUNKED_ENCODE_PIECE];
+	EXIStream testStrm;
+	Parser testParser;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	String chVal;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+	struct chunkedValues vals;
+	struct memorySource src;
+	Index i, j, count;
 
-		tmp_err_code += serialize.endElement(&testStrm);
+	buffer.buf = buf;
+	buffer.bufContent = 0;
+	buffer.bufLen = CHUNKED_BUFFER_SIZE;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
 
-		tmp_err_code += serialize.endElement(&testStrm);
+	serialize.initHeader(&testStrm);
+	testStrm.header.has_options = TRUE;
+	SET_PRESERVED(testStrm.header.opts.preserve, PRESERVE_PREFIXES);
+	testStrm.header.opts.schemaIDMode = SCHEMA_ID_EMPTY;
+	testStrm.header.opts.valueMaxLength = 16;
 
-		tmp_err_code += serialize.endElement(&testStrm);
-	}
+	tmp_err_code = serialize.initStream(&testStrm, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
+
+	tmp_err_code += serialize.exiHeader(&testStrm);
+	tmp_err_code += serialize.startDocument(&testStrm);
+	qname.uri = &NS_EMPTY;
+	qname.localName = &ELEM_ROOT;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	tmp_err_code += serialize.namespaceDeclaration(&testStrm, NS_XSI, PREFIX_XSI, FALSE);
+
+	qname.localName = &ELEM_SHORT;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	fail_unless (tmp_err_code == EXIP_OK, "serialization ended with error code %d", tmp_err_code);
+
+	// A value that enters the value partitions can not be serialized in chunks
+	tmp_err_code = serialize.stringDataBegin(&testStrm, VALUE_SHORT.length);
+	fail_unless (tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "stringDataBegin accepts a short value: %d", tmp_err_code);
 
+	tmp_err_code = serialize.stringData(&testStrm, VALUE_SHORT);
+	tmp_err_code += serialize.endElement(&testStrm);
+
+	qname.localName = &ELEM_TEXT;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	tmp_err_code += serialize.stringDataBegin(&testStrm, CHUNKED_STRING_LENGTH);
+	for(i = 0; i < CHUNKED_STRING_LENGTH; i += count)
+	{
+		count = CHUNKED_STRING_LENGTH - i < CHUNKED_ENCODE_PIECE ? CHUNKED_STRING_LENGTH - i : CHUNKED_ENCODE_PIECE;
+		for(j = 0; j < count; j++)
+			piece[j] = chunkedStringChar(i + j);
+		chVal.str = piece;
+		chVal.length = count;
+		tmp_err_code += serialize.stringDataChunk(&testStrm, chVal);
+	}
+	tmp_err_code += serialize.stringDataEnd(&testStrm);
 	tmp_err_code += serialize.endElement(&testStrm);
 
+	qname.localName = &ELEM_DATA;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	qname.uri = &NS_XSI;
+	qname.localName = &ATTR_TYPE;
+	tmp_err_code += serialize.attribute(&testStrm, qname, TRUE, &valueType);
+	qname.uri = &NS_XSD;
+	qname.localName = &VALUE_BINARY;
+	tmp_err_code += serialize.qnameData(&testStrm, qname);
+	tmp_err_code += serialize.binaryDataBegin(&testStrm, CHUNKED_BINARY_LENGTH);
+	for(i = 0; i < CHUNKED_BINARY_LENGTH; i += count)
+	{
+		count = CHUNKED_BINARY_LENGTH - i < CHUNKED_ENCODE_PIECE ? CHUNKED_BINARY_LENGTH - i : CHUNKED_ENCODE_PIECE;
+		for(j = 0; j < count; j++)
+			piece[j] = chunkedBinaryOctet(i + j);
+		tmp_err_code += serialize.binaryDataChunk(&testStrm, piece, count);
+	}
+	tmp_err_code += serialize.binaryDataEnd(&testStrm);
 	tmp_err_code += serialize.endElement(&testStrm);
 
 	tmp_err_code += serialize.endElement(&testStrm);
 	tmp_err_code += serialize.endDocument(&testStrm);
-	fail_unless(tmp_err_code == EXIP_OK);
+	fail_unless (tmp_err_code == EXIP_OK, "serialization ended with error code %d", tmp_err_code);
 
-//	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+	src.data = buf;
+	src.length = testStrm.context.bufferIndx + 1;
+	src.position = 0;
 
-	// VI: Free the memory allocated by the EXI stream object
 	tmp_err_code = serialize.closeEXIStream(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialize.closeEXIStream ended with error code %d", tmp_err_code);
 
-//                        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
-//                total += ((end.tv_sec * SEC2NANO) + end.tv_nsec) - ((start.tv_sec * SEC2NANO) + start.tv_nsec);
+	// Parse through a buffer much smaller than the values
+	buffer.buf = parserBuf;
+	buffer.bufContent = 0;
+	buffer.bufLen = CHUNKED_PARSER_BUFFER_SIZE;
+	buffer.ioStrm.readWriteToStream = readMemorySource;
+	buffer.ioStrm.stream = &src;
 
-    fclose(outfile);
-    destroySchema(&schema);
+	memset(&vals, 0, sizeof(vals));
+	vals.stringMatch = TRUE;
+	vals.binaryMatch = TRUE;
 
-    /* DECODE */
-    {
-    	Parser testParser;
-    	FILE *infile;
+	tmp_err_code = initParser(&testParser, buffer, &vals);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
 
-    	buffer.buf = buf;
-    	buffer.bufContent = 0;
-    	buffer.bufLen = OUTPUT_BUFFER_SIZE_LARGE_DOC;
-    	unsigned int eventCount;
+	testParser.handler.stringDataBegin = chunked_stringDataBegin;
+	testParser.handler.stringDataChunk = chunked_stringDataChunk;
+	testParser.handler.stringDataEnd = chunked_stringDataEnd;
+	testParser.handler.binaryDataBegin = chunked_binaryDataBegin;
+	testParser.handler.binaryDataChunk = chunked_binaryDataChunk;
+	testParser.handler.binaryDataEnd = chunked_binaryDataEnd;
 
-    	// Parsing steps:
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
 
-    	// I.A: First, read in the schema
-    	parseSchema(schemafname, 1, &schema);
+	tmp_err_code = setSchema(&testParser, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
 
-    	// I.B: Define an external stream for the input to the parser if any
-    	infile = fopen(sourceFile, "rb" );
-    	if(!infile)
-    		fail("Unable to open file %s", sourceFile);
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parseNext(&testParser);
+	}
 
-    	buffer.ioStrm.readWriteToStream = readFileInputStream;
-    	buffer.ioStrm.stream = infile;
+	destroyParser(&testParser);
 
-    	// II: Second, initialize the parser object
-    	tmp_err_code = initParser(&testParser, buffer, &eventCount);
-    	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+	fail_unless (vals.strings == 2, "%u string values reported", vals.strings);
+	fail_unless (vals.stringLength == CHUNKED_STRING_LENGTH && vals.stringMatch, "The long string value is not decoded correctly");
+	fail_unless (vals.stringChunks >= CHUNKED_STRING_LENGTH/VALUE_CHUNK_SIZE, "The long string value is delivered in %u chunks", vals.stringChunks);
+	fail_unless (vals.binaries == 1, "%u binary values reported", vals.binaries);
+	fail_unless (vals.binaryLength == CHUNKED_BINARY_LENGTH && vals.binaryMatch, "The binary value is not decoded correctly");
+	fail_unless (!vals.chunkTooLarge, "A chunk is larger than VALUE_CHUNK_SIZE");
+}
+END_TEST
 
-    	// IV: Parse the header of the stream
-		tmp_err_code = parseHeader(&testParser, FALSE);
-		fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+#if COMPRESSION_USE
 
-		tmp_err_code = setSchema(&testParser, &schema);
-		fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+#define COMPRESSION_ELEM_COUNT 400
+#define COMPRESSION_BUFFER_SIZE 20000
+#define COMPRESSION_IO_BUFFER_SIZE 64
 
-		// V: Parse the body of the EXI stream
-		while(tmp_err_code == EXIP_OK)
-		{
-			tmp_err_code = parseNext(&testParser);
-		}
+/** A digest of the events and values of a document, in their order */
+struct compressionTrace
+{
+	unsigned long hash;
+	unsigned int elements;
+	unsigned int attributes;
+	unsigned int values;
+	/** The calls of Parser.inputReleased */
+	unsigned int released;
+};
+
+struct memorySink
+{
+	char* data;
+	size_t length;
+	size_t size;
+};
 
-		// VI: Free the memory allocated by the parser object
-		destroyParser(&testParser);
-		fclose(infile);
-		fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
-    }
+static size_t writeMemorySink(void* buf, size_t readSize, void* stream)
+{
+	struct memorySink* sink = (struct memorySink*) stream;
 
-    remove(sourceFile);
-	destroySchema(&schema);
-}
-END_TEST
+	if(readSize > sink->size - sink->length)
+		return 0;
 
-#define INPUT_BUFFER_SIZE 200
+	memcpy(sink->data + sink->length, buf, readSize);
+	sink->length += readSize;
+	return readSize;
+}
 
-/* Test substitution groups */
-START_TEST (test_substitution_groups)
+static void traceEvent(struct compressionTrace* tr, char tag, const String* str)
 {
-	EXIPSchema schema;
-	FILE *infile;
-	Parser testParser;
-	char buf[INPUT_BUFFER_SIZE];
-	char* schemafname[2] = {"exip/subsGroups/root-xsd.exi","exip/subsGroups/sub-xsd.exi"};
-	char *exifname = "exip/subsGroups/root.exi";
-	char exipath[MAX_PATH_LEN + strlen(exifname)];
-	unsigned int eventCount;
-	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	BinaryBuffer buffer;
+	Index i;
 
-	buffer.buf = buf;
-	buffer.bufContent = 0;
-	buffer.bufLen = INPUT_BUFFER_SIZE;
+	tr->hash = tr->hash*31 + (unsigned char) tag;
+	if(str != NULL)
+	{
+		for(i = 0; i < str->length; i++)
+			tr->hash = tr->hash*31 + (unsigned char) str->str[i];
+	}
+}
 
-	// Parsing steps:
+static errorCode trace_startElement(QName qname, void* app_data)
+{
+	struct compressionTrace* tr = (struct compressionTrace*) app_data;
 
-	// I.A: First, read in the schema
-	parseSchema(schemafname, 2, &schema);
+	tr->elements += 1;
+	traceEvent(tr, 'S', qname.localName);
+	return EXIP_OK;
+}
 
-	// I.B: Define an external stream for the input to the parser if any
-	size_t pathlen = strlen(dataDir);
-	memcpy(exipath, dataDir, pathlen);
-	exipath[pathlen] = '/';
-	memcpy(&exipath[pathlen+1], exifname, strlen(exifname)+1);
+static errorCode trace_endElement(void* app_data)
+{
+	traceEvent((struct compressionTrace*) app_data, 'E', NULL);
+	return EXIP_OK;
+}
 
-	infile = fopen(exipath, "rb" );
-	if(!infile)
-		fail("Unable to open file %s", exipath);
+static errorCode trace_attribute(QName qname, void* app_data)
+{
+	struct compressionTrace* tr = (struct compressionTrace*) app_data;
 
-	buffer.ioStrm.readWriteToStream = readFileInputStream;
-	buffer.ioStrm.stream = infile;
+	tr->attributes += 1;
+	traceEvent(tr, 'A', qname.localName);
+	return EXIP_OK;
+}
 
-	// II: Second, initialize the parser object
-	tmp_err_code = initParser(&testParser, buffer, &eventCount);
-	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+static errorCode trace_stringData(const String value, void* app_data)
+{
+	struct compressionTrace* tr = (struct compressionTrace*) app_data;
 
-	// III: Initialize the parsing data and hook the callback handlers to the parser object
-	eventCount = 0;
+	tr->values += 1;
+	traceEvent(tr, 'V', &value);
+	return EXIP_OK;
+}
 
-	// IV: Parse the header of the stream
-	tmp_err_code = parseHeader(&testParser, FALSE);
-	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+/**
+ * Serializes a schema-less document with repeating names and values with the
+ * given alignment and blockSize into buffer and records its events in expected
+ */
+static void serializeCompressionDocument(BinaryBuffer buffer, unsigned char alignment, uint32_t blockSize, struct compressionTrace* expected)
+{
+	const String NS_EMPTY = {NULL, 0};
+	const String ELEM_DOC = {"doc", 3};
+	const String ELEM_NOTE = {"note", 4};
+	const String ATTR_N = {"n", 1};
+	char name[20];
+	EXIStream testStrm;
+	String ln;
+	QName qname = {&NS_EMPTY, &ln, NULL};
+	String chVal;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXITypeClass valueType;
+	unsigned int i;
 
-	tmp_err_code = setSchema(&testParser,  &schema);
-	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
-	// V: Parse the body of the EXI stream
-	while(tmp_err_code == EXIP_OK)
-	{
-		tmp_err_code = parseNext(&testParser);
-		eventCount++;
-	}
+	memset(expected, 0, sizeof(struct compressionTrace));
 
-	fail_unless(eventCount == 38,
-	            "Unexpected event count: %u", eventCount);
+	serialize.initHeader(&testStrm);
+	testStrm.header.has_options = TRUE;
+	if(alignment == COMPRESSION)
+		SET_COMPRESSION(testStrm.header.opts.enumOpt);
+	else
+		SET_ALIGNMENT(testStrm.header.opts.enumOpt, alignment);
+	testStrm.header.opts.blockSize = blockSize;
 
-	// VI: Free the memory allocated by the parser object
-	destroyParser(&testParser);
-	fclose(infile);
-	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
-	destroySchema(&schema);
-}
-END_TEST
+	tmp_err_code = serialize.initStream(&testStrm, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
 
-errorCode encodeNonBlockingStreaming(EXIPSchema* schema, char* flushBuf, int buf_size, int *strmSize, unsigned char alignment);
+	tmp_err_code += serialize.exiHeader(&testStrm);
+	tmp_err_code += serialize.startDocument(&testStrm);
+	ln = ELEM_DOC;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	traceEvent(expected, 'S', &ELEM_DOC);
+	expected->elements += 1;
 
-START_TEST (test_non_blocking_streaming)
-{
-	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	char flushBuf[OUTPUT_BUFFER_SIZE];
-	int strmSize = 0;
-	BinaryBuffer buffer;
-	Parser testParser;
-	char* schemafname[1] = {"exip/NonBlockingStreaming-xsd.exi"};
-	EXIPSchema schema;
-	char tmpBuf[40];
-	unsigned int flushMarker;
-	unsigned int bytesRead;
+	for(i = 0; i < COMPRESSION_ELEM_COUNT; i++)
+	{
+		if(i % 80 == 79)
+		{
+			ln = ELEM_NOTE;
+			tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+			traceEvent(expected, 'S', &ELEM_NOTE);
+			sprintf(name, "note %u", i);
+			tmp_err_code += asciiToString(name, &chVal, &testStrm.memList, TRUE);
+			tmp_err_code += serialize.stringData(&testStrm, chVal);
+			traceEvent(expected, 'V', &chVal);
+			tmp_err_code += serialize.endElement(&testStrm);
+			traceEvent(expected, 'E', NULL);
+			expected->elements += 1;
+			expected->values += 1;
+		}
 
-	parseSchema(schemafname, 1, &schema);
+		sprintf(name, "item%u", i % 3);
+		tmp_err_code += asciiToString(name, &ln, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+		traceEvent(expected, 'S', &ln);
 
-	tmp_err_code = encodeNonBlockingStreaming(&schema, flushBuf, OUTPUT_BUFFER_SIZE, &strmSize, BIT_PACKED);
-	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of non blocking EXI stream");
-	fail_unless(strmSize > 0, "Encoding using non blocking flushing produces empty streams.");
+		ln = ATTR_N;
+		tmp_err_code += serialize.attribute(&testStrm, qname, TRUE, &valueType);
+		traceEvent(expected, 'A', &ATTR_N);
+		sprintf(name, "%u", i % 11);
+		tmp_err_code += asciiToString(name, &chVal, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.stringData(&testStrm, chVal);
+		traceEvent(expected, 'V', &chVal);
 
-	flushMarker = 20;
-	memcpy(tmpBuf, flushBuf, flushMarker);
+		sprintf(name, "value %u", i % 37);
+		tmp_err_code += asciiToString(name, &chVal, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.stringData(&testStrm, chVal);
+		traceEvent(expected, 'V', &chVal);
 
-	buffer.bufContent = flushMarker;
-	buffer.buf = tmpBuf;
-	buffer.bufLen = 40;
-	buffer.ioStrm.readWriteToStream = NULL;
-	buffer.ioStrm.stream = NULL;
+		tmp_err_code += serialize.endElement(&testStrm);
+		traceEvent(expected, 'E', NULL);
+		expected->elements += 1;
+		expected->attributes += 1;
+		expected->values += 2;
+	}
 
-	// Parsing steps:
+	tmp_err_code += serialize.endElement(&testStrm);
+	traceEvent(expected, 'E', NULL);
+	tmp_err_code += serialize.endDocument(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialization ended with error code %d", tmp_err_code);
 
-	// I: First, define an external stream for the input to the parser if any
+	tmp_err_code = serialize.closeEXIStream(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialize.closeEXIStream ended with error code %d", tmp_err_code);
+}
 
-	// II: Second, initialize the parser object
-	tmp_err_code = parse.initParser(&testParser, buffer, NULL);
-	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+/**
+ * Initializes a parser of a document of serializeCompressionDocument()
+ * that records its events in parsed and parses the header
+ */
+static void initCompressionParser(Parser* testParser, BinaryBuffer buffer, struct compressionTrace* parsed)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 
-	// III: Initialize the parsing data and hook the callback handlers to the parser object
+	memset(parsed, 0, sizeof(struct compressionTrace));
+	tmp_err_code = initParser(testParser, buffer, parsed);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
 
-	// IV: Parse the header of the stream
+	testParser->handler.startElement = trace_startElement;
+	testParser->handler.endElement = trace_endElement;
+	testParser->handler.attribute = trace_attribute;
+	testParser->handler.stringData = trace_stringData;
 
-	tmp_err_code = parse.parseHeader(&testParser, FALSE);
+	tmp_err_code = parseHeader(testParser, FALSE);
 	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
 
-	tmp_err_code = parse.setSchema(&testParser, &schema);
+	tmp_err_code = setSchema(testParser, NULL);
 	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+}
 
-	// V: Parse the body of the EXI stream
+static void trace_inputReleased(void* app_data)
+{
+	((struct compressionTrace*) app_data)->released += 1;
+}
 
-	while(tmp_err_code == EXIP_OK)
+/**
+ * Serializes a document with the compression and pre-compression alignments,
+ * in blocks of various sizes and through an output/input stream with a small
+ * buffer, and parses it back. The input stream of a parsed document is
+ * released by destroyParser()
+ */
+START_TEST (test_compression)
+{
+	const unsigned char alignments[4] = {COMPRESSION, COMPRESSION, PRE_COMPRESSION, COMPRESSION};
+	const uint32_t blockSizes[4] = {50, 1000000, 50, 50};
+	static char buf[COMPRESSION_BUFFER_SIZE];
+	static char sinkBuf[COMPRESSION_BUFFER_SIZE];
+	char ioBuf[COMPRESSION_IO_BUFFER_SIZE];
+	Parser testParser;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	struct compressionTrace expected;
+	struct compressionTrace parsed;
+	struct memorySink sink;
+	struct memorySource src;
+	boolean useStreams;
+	unsigned int c;
+
+	for(c = 0; c < 4; c++)
 	{
-		tmp_err_code = parse.parseNext(&testParser);
-	}
+		useStreams = (c == 3);
 
-	while (tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		tmp_err_code = parse.pushEXIData(flushBuf + flushMarker, strmSize - flushMarker, &bytesRead, &testParser);
-		if(tmp_err_code != EXIP_OK)
-			break;
-		flushMarker += bytesRead;
+		if(useStreams)
+		{
+			sink.data = sinkBuf;
+			sink.length = 0;
+			sink.size = COMPRESSION_BUFFER_SIZE;
+			buffer.buf = ioBuf;
+			buffer.bufLen = COMPRESSION_IO_BUFFER_SIZE;
+			buffer.ioStrm.readWriteToStream = writeMemorySink;
+			buffer.ioStrm.stream = &sink;
+		}
+		else
+		{
+			buffer.buf = buf;
+			buffer.bufLen = COMPRESSION_BUFFER_SIZE;
+			buffer.ioStrm.readWriteToStream = NULL;
+			buffer.ioStrm.stream = NULL;
+		}
+		buffer.bufContent = 0;
 
+		serializeCompressionDocument(buffer, alignments[c], blockSizes[c], &expected);
+
+		if(useStreams)
+		{
+			fail_unless (sink.length > COMPRESSION_IO_BUFFER_SIZE, "The output stream received %u octets", (unsigned int) sink.length);
+			src.data = sinkBuf;
+			src.length = sink.length;
+			src.position = 0;
+			buffer.bufContent = 0;
+			buffer.ioStrm.readWriteToStream = readMemorySource;
+			buffer.ioStrm.stream = &src;
+		}
+		else
+			buffer.bufContent = COMPRESSION_BUFFER_SIZE;
+
+		initCompressionParser(&testParser, buffer, &parsed);
+		testParser.inputReleased = trace_inputReleased;
+		fail_unless (testParser.strm.header.opts.blockSize == blockSizes[c], "The blockSize is not in the header");
+
+		tmp_err_code = EXIP_OK;
 		while(tmp_err_code == EXIP_OK)
 		{
-			tmp_err_code = parse.parseNext(&testParser);
+			tmp_err_code = parseNext(&testParser);
 		}
-	}
 
-	// VI: Free the memory allocated by the parser object
+		fail_unless (parsed.released == 0, "The input stream is released during parsing");
+		destroyParser(&testParser);
+		fail_unless (parsed.released == 1, "destroyParser() releases the input stream %u times", parsed.released);
 
-	parse.destroyParser(&testParser);
-	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
-	destroySchema(&schema);
+		fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of stream %u: %d", c, tmp_err_code);
+		fail_unless (parsed.elements == expected.elements, "Stream %u: %u elements parsed, %u expected", c, parsed.elements, expected.elements);
+		fail_unless (parsed.attributes == expected.attributes, "Stream %u: %u attributes parsed, %u expected", c, parsed.attributes, expected.attributes);
+		fail_unless (parsed.values == expected.values, "Stream %u: %u values parsed, %u expected", c, parsed.values, expected.values);
+		fail_unless (parsed.hash == expected.hash, "Stream %u: the events are not parsed in order", c);
+	}
 }
 END_TEST
 
-START_TEST (test_non_blocking_streaming_bytealigned)
+/**
+ * Stops parsing a compressed document after a few blocks, while the next
+ * streams are still to be inflated, with resetParser() and destroyParser(),
+ * and parses a truncated document
+ */
+START_TEST (test_compression_abandon)
 {
+	static char sinkBuf[COMPRESSION_BUFFER_SIZE];
+	char ioBuf[COMPRESSION_IO_BUFFER_SIZE];
+	Parser testParser;
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	char flushBuf[OUTPUT_BUFFER_SIZE];
-	int strmSize = 0;
 	BinaryBuffer buffer;
-	Parser testParser;
-	char* schemafname[1] = {"exip/NonBlockingStreaming-xsd.exi"};
-	EXIPSchema schema;
-	char tmpBuf[40];
-	unsigned int flushMarker;
-	unsigned int bytesRead;
+	struct compressionTrace expected;
+	struct compressionTrace parsed;
+	struct memorySink sink;
+	struct memorySource src, src2, src3, src4;
+	unsigned int i;
+
+	sink.data = sinkBuf;
+	sink.length = 0;
+	sink.size = COMPRESSION_BUFFER_SIZE;
+	buffer.buf = ioBuf;
+	buffer.bufLen = COMPRESSION_IO_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = writeMemorySink;
+	buffer.ioStrm.stream = &sink;
+	serializeCompressionDocument(buffer, COMPRESSION, 20, &expected);
 
-	parseSchema(schemafname, 1, &schema);
+	src.data = sinkBuf;
+	src.length = sink.length;
+	src.position = 0;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = readMemorySource;
+	buffer.ioStrm.stream = &src;
 
-	tmp_err_code = encodeNonBlockingStreaming(&schema, flushBuf, OUTPUT_BUFFER_SIZE, &strmSize, BYTE_ALIGNMENT);
-	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of non blocking EXI stream");
-	fail_unless(strmSize > 0, "Encoding using non blocking flushing produces empty streams.");
+	initCompressionParser(&testParser, buffer, &parsed);
+	tmp_err_code = EXIP_OK;
+	for(i = 0; i < 100 && tmp_err_code == EXIP_OK; i++)
+		tmp_err_code = parseNext(&testParser);
+	fail_unless (tmp_err_code == EXIP_OK, "Error during parsing: %d", tmp_err_code);
 
-	flushMarker = 20;
-	memcpy(tmpBuf, flushBuf, flushMarker);
+	// The same document from the beginning, from another source: a read of the
+	// inflate thread in progress may end after resetParser() returns
+	src2 = src;
+	src2.position = 0;
+	buffer.bufContent = 0;
+	buffer.ioStrm.stream = &src2;
+	tmp_err_code = resetParser(&testParser, buffer, &parsed);
+	fail_unless (tmp_err_code == EXIP_OK, "resetParser returns an error code %d", tmp_err_code);
+	memset(&parsed, 0, sizeof(parsed));
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+	tmp_err_code = setSchema(&testParser, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
 
-	buffer.bufContent = flushMarker;
-	buffer.buf = tmpBuf;
-	buffer.bufLen = 40;
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&testParser);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing: %d", tmp_err_code);
+	fail_unless (parsed.elements == expected.elements && parsed.values == expected.values && parsed.hash == expected.hash,
+			"The events are not parsed in order after resetParser");
+
+	// Parsing stopped after a few blocks
+	src3 = src;
+	src3.position = 0;
+	buffer.bufContent = 0;
+	buffer.ioStrm.stream = &src3;
+	tmp_err_code = resetParser(&testParser, buffer, &parsed);
+	fail_unless (tmp_err_code == EXIP_OK, "resetParser returns an error code %d", tmp_err_code);
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	tmp_err_code += setSchema(&testParser, NULL);
+	for(i = 0; i < 200 && tmp_err_code == EXIP_OK; i++)
+		tmp_err_code = parseNext(&testParser);
+	fail_unless (tmp_err_code == EXIP_OK, "Error during parsing: %d", tmp_err_code);
+	destroyParser(&testParser);
+
+	// The last part of the document is missing
+	src4 = src;
+	src4.position = 0;
+	src4.length = 2*sink.length/3;
+	buffer.bufContent = 0;
+	buffer.ioStrm.stream = &src4;
+	initCompressionParser(&testParser, buffer, &parsed);
+	tmp_err_code = EXIP_OK;
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&testParser);
+	destroyParser(&testParser);
+	fail_unless (tmp_err_code == EXIP_BUFFER_END_REACHED, "Parsing a truncated document returns %d", tmp_err_code);
+	fail_unless (parsed.elements > 0 && parsed.elements < expected.elements, "%u elements parsed from a truncated document", parsed.elements);
+}
+END_TEST
+
+/**
+ * pushEXIData() and flushEXIData() reject the compression and pre-compression
+ * alignments, whose blocks are read and written as a whole
+ */
+START_TEST (test_compression_non_blocking)
+{
+	const unsigned char alignments[2] = {COMPRESSION, PRE_COMPRESSION};
+	static char buf[COMPRESSION_BUFFER_SIZE];
+	char outBuf[COMPRESSION_IO_BUFFER_SIZE];
+	EXIStream testStrm;
+	Parser testParser;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	struct compressionTrace expected;
+	struct compressionTrace parsed;
+	unsigned int bytesDone;
+	unsigned int c;
+	unsigned int i;
+
+	buffer.buf = buf;
+	buffer.bufLen = COMPRESSION_BUFFER_SIZE;
 	buffer.ioStrm.readWriteToStream = NULL;
 	buffer.ioStrm.stream = NULL;
 
-	// Parsing steps:
-
-	// I: First, define an external stream for the input to the parser if any
+	for(c = 0; c < 2; c++)
+	{
+		buffer.bufContent = 0;
+		serialize.initHeader(&testStrm);
+		testStrm.header.has_options = TRUE;
+		if(alignments[c] == COMPRESSION)
+			SET_COMPRESSION(testStrm.header.opts.enumOpt);
+		else
+			SET_ALIGNMENT(testStrm.header.opts.enumOpt, alignments[c]);
+		tmp_err_code = serialize.initStream(&testStrm, buffer, NULL);
+		fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
+		tmp_err_code = serialize.exiHeader(&testStrm);
+		fail_unless (tmp_err_code == EXIP_OK, "exiHeader returns an error code %d", tmp_err_code);
+
+		bytesDone = 1;
+		tmp_err_code = flushEXIData(&testStrm, outBuf, COMPRESSION_IO_BUFFER_SIZE, &bytesDone);
+		fail_unless (tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION && bytesDone == 0,
+				"flushEXIData returns %d with alignment %u", tmp_err_code, (unsigned int) alignments[c]);
+		serialize.closeEXIStream(&testStrm);
+
+		// The whole document in the buffer is parsed
+		buffer.bufContent = 0;
+		serializeCompressionDocument(buffer, alignments[c], 50, &expected);
+		buffer.bufContent = COMPRESSION_BUFFER_SIZE;
+		initCompressionParser(&testParser, buffer, &parsed);
+		tmp_err_code = EXIP_OK;
+		for(i = 0; i < 10 && tmp_err_code == EXIP_OK; i++)
+			tmp_err_code = parseNext(&testParser);
+		fail_unless (tmp_err_code == EXIP_OK, "Error during parsing: %d", tmp_err_code);
 
-	// II: Second, initialize the parser object
-	tmp_err_code = parse.initParser(&testParser, buffer, NULL);
-	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+		bytesDone = 1;
+		tmp_err_code = pushEXIData(outBuf, COMPRESSION_IO_BUFFER_SIZE, &bytesDone, &testParser);
+		fail_unless (tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION && bytesDone == 0,
+				"pushEXIData returns %d with alignment %u", tmp_err_code, (unsigned int) alignments[c]);
+		destroyParser(&testParser);
+	}
+}
+END_TEST
 
-	// III: Initialize the parsing data and hook the callback handlers to the parser object
+/** A memorySource that counts the reads at the end of its data */
+struct framedSource
+{
+	struct memorySource src;
+	unsigned int pastEnd;
+};
 
-	// IV: Parse the header of the stream
+static size_t readFramedSource(void* buf, size_t readSize, void* stream)
+{
+	struct framedSource* fs = (struct framedSource*) stream;
 
-	tmp_err_code = parse.parseHeader(&testParser, FALSE);
-	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+	if(fs->src.position == fs->src.length)
+		fs->pastEnd += 1;
 
-	tmp_err_code = parse.setSchema(&testParser, &schema);
-	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+	return readMemorySource(buf, readSize, &fs->src);
+}
 
-	// V: Parse the body of the EXI stream
+/**
+ * Parses compressed documents from an input stream that ends with the document,
+ * as a socket without the next message yet: the input is not read past the end
+ * of the last DEFLATE stream of the document
+ */
+START_TEST (test_compression_document_end)
+{
+	const uint32_t blockSizes[3] = {20, 300, 1000000};
+	static char sinkBuf[COMPRESSION_BUFFER_SIZE];
+	char ioBuf[COMPRESSION_IO_BUFFER_SIZE];
+	Parser testParser;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	struct compressionTrace expected;
+	struct compressionTrace parsed;
+	struct memorySink sink;
+	struct framedSource fs;
+	unsigned int c;
 
-	while(tmp_err_code == EXIP_OK)
+	for(c = 0; c < 3; c++)
 	{
-		tmp_err_code = parse.parseNext(&testParser);
+		sink.data = sinkBuf;
+		sink.length = 0;
+		sink.size = COMPRESSION_BUFFER_SIZE;
+		buffer.buf = ioBuf;
+		buffer.bufLen = COMPRESSION_IO_BUFFER_SIZE;
+		buffer.bufContent = 0;
+		buffer.ioStrm.readWriteToStream = writeMemorySink;
+		buffer.ioStrm.stream = &sink;
+		serializeCompressionDocument(buffer, COMPRESSION, blockSizes[c], &expected);
+
+		fs.src.data = sinkBuf;
+		fs.src.length = sink.length;
+		fs.src.position = 0;
+		fs.pastEnd = 0;
+		buffer.bufContent = 0;
+		buffer.ioStrm.readWriteToStream = readFramedSource;
+		buffer.ioStrm.stream = &fs;
+
+		initCompressionParser(&testParser, buffer, &parsed);
+		tmp_err_code = EXIP_OK;
+		while(tmp_err_code == EXIP_OK)
+			tmp_err_code = parseNext(&testParser);
+		destroyParser(&testParser);
+
+		fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing with blockSize %u: %d", (unsigned int) blockSizes[c], tmp_err_code);
+		fail_unless (parsed.hash == expected.hash, "BlockSize %u: the events are not parsed in order", (unsigned int) blockSizes[c]);
+		fail_unless (fs.src.position == fs.src.length, "BlockSize %u: the document is not read to its end", (unsigned int) blockSizes[c]);
+		fail_unless (fs.pastEnd == 0, "BlockSize %u: the input is read %u times past the end of the document", (unsigned int) blockSizes[c], fs.pastEnd);
 	}
+}
+END_TEST
 
-	while (tmp_err_code == EXIP_BUFFER_END_REACHED)
+#if COMPRESSION_THREAD_USE && !defined(_MSC_VER)
+
+/** An input stream whose reads by the inflate thread block from a position on until released */
+struct blockingSource
+{
+	/** The app_data of the parser: first, for the trace handlers */
+	struct compressionTrace parsed;
+	struct memorySource src;
+	pthread_t parser;
+	size_t blockAt;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	boolean blocked;
+	boolean released;
+	boolean returned;
+	/** Set by Parser.inputReleased */
+	boolean closed;
+};
+
+static size_t readBlockingSource(void* buf, size_t readSize, void* stream)
+{
+	struct blockingSource* bs = (struct blockingSource*) stream;
+	struct timespec until;
+	int waitErr = 0;
+	size_t count;
+
+	if(pthread_equal(pthread_self(), bs->parser) || bs->src.position < bs->blockAt)
+		return readMemorySource(buf, readSize, &bs->src);
+
+	pthread_mutex_lock(&bs->lock);
+	bs->blocked = TRUE;
+	pthread_cond_broadcast(&bs->cond);
+	// Bounded, so that a parser waiting for the read fails the test instead of hanging it
+	clock_gettime(CLOCK_REALTIME, &until);
+	until.tv_sec += 5;
+	while(!bs->released && waitErr == 0)
+		waitErr = pthread_cond_timedwait(&bs->cond, &bs->lock, &until);
+	count = readMemorySource(buf, readSize, &bs->src);
+	bs->returned = TRUE;
+	pthread_cond_broadcast(&bs->cond);
+	pthread_mutex_unlock(&bs->lock);
+
+	return count;
+}
+
+static void closeBlockingSource(void* app_data)
+{
+	struct blockingSource* bs = (struct blockingSource*) app_data;
+
+	pthread_mutex_lock(&bs->lock);
+	bs->closed = TRUE;
+	pthread_cond_broadcast(&bs->cond);
+	pthread_mutex_unlock(&bs->lock);
+}
+
+/**
+ * Destroys the parser of a compressed document while the inflate thread is
+ * blocked in a read of the input stream: destroyParser() returns without it
+ * and Parser.inputReleased is called once the read returns
+ */
+START_TEST (test_compression_blocked_read)
+{
+	static char sinkBuf[COMPRESSION_BUFFER_SIZE];
+	char ioBuf[COMPRESSION_IO_BUFFER_SIZE];
+	Parser testParser;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+	struct compressionTrace expected;
+	struct memorySink sink;
+	struct blockingSource bs;
+	struct timespec until;
+	boolean blocked = FALSE;
+	boolean returnedEarly;
+	boolean closedEarly;
+	int waitErr = 0;
+
+	sink.data = sinkBuf;
+	sink.length = 0;
+	sink.size = COMPRESSION_BUFFER_SIZE;
+	buffer.buf = ioBuf;
+	buffer.bufLen = COMPRESSION_IO_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = writeMemorySink;
+	buffer.ioStrm.stream = &sink;
+	// Blocks of up to 100 values: a single DEFLATE stream each
+	serializeCompressionDocument(buffer, COMPRESSION, 20, &expected);
+
+	bs.src.data = sinkBuf;
+	bs.src.length = sink.length;
+	bs.src.position = 0;
+	bs.parser = pthread_self();
+	bs.blockAt = sink.length/2;
+	bs.blocked = FALSE;
+	bs.released = FALSE;
+	bs.returned = FALSE;
+	bs.closed = FALSE;
+	fail_unless(pthread_mutex_init(&bs.lock, NULL) == 0 && pthread_cond_init(&bs.cond, NULL) == 0, "Unable to create the lock");
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = readBlockingSource;
+	buffer.ioStrm.stream = &bs;
+
+	initCompressionParser(&testParser, buffer, &bs.parsed);
+	testParser.inputReleased = closeBlockingSource;
+	tmp_err_code = EXIP_OK;
+	while(tmp_err_code == EXIP_OK && !blocked)
 	{
-		tmp_err_code = parse.pushEXIData(flushBuf + flushMarker, strmSize - flushMarker, &bytesRead, &testParser);
-		if(tmp_err_code != EXIP_OK)
-			break;
-		flushMarker += bytesRead;
+		tmp_err_code = parseNext(&testParser);
 
-		while(tmp_err_code == EXIP_OK)
+		// Lets the inflate thread run ahead of the parser
+		pthread_mutex_lock(&bs.lock);
+		if(!bs.blocked)
 		{
-			tmp_err_code = parse.parseNext(&testParser);
+			clock_gettime(CLOCK_REALTIME, &until);
+			until.tv_nsec += 1000000;
+			if(until.tv_nsec >= 1000000000)
+			{
+				until.tv_sec += 1;
+				until.tv_nsec -= 1000000000;
+			}
+			pthread_cond_timedwait(&bs.cond, &bs.lock, &until);
 		}
+		blocked = bs.blocked;
+		pthread_mutex_unlock(&bs.lock);
 	}
+	fail_unless (tmp_err_code == EXIP_OK, "Error during parsing: %d", tmp_err_code);
+	fail_unless (blocked, "The inflate thread does not read the second half of the document");
 
-	// VI: Free the memory allocated by the parser object
+	destroyParser(&testParser);
 
-	parse.destroyParser(&testParser);
-	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
-	destroySchema(&schema);
+	pthread_mutex_lock(&bs.lock);
+	returnedEarly = bs.returned;
+	closedEarly = bs.closed;
+	bs.released = TRUE;
+	pthread_cond_broadcast(&bs.cond);
+	clock_gettime(CLOCK_REALTIME, &until);
+	until.tv_sec += 5;
+	while(!bs.closed && waitErr == 0)
+		waitErr = pthread_cond_timedwait(&bs.cond, &bs.lock, &until);
+	pthread_mutex_unlock(&bs.lock);
+	fail_unless (!returnedEarly, "destroyParser() waits for the read of the inflate thread");
+	fail_unless (!closedEarly, "The input stream is released during the read of the inflate thread");
+	fail_unless (bs.closed, "The input stream is not released when the read of the inflate thread returns");
+
+	pthread_cond_destroy(&bs.cond);
+	pthread_mutex_destroy(&bs.lock);
 }
 END_TEST
 
-errorCode encodeNonBlockingStreaming(EXIPSchema* schema, char* flushBuf, int buf_size, int *strmSize, unsigned char alignment)
-{
-	const String NS_EMPTY_STR = {NULL, 0};
-	const String NS_URN_STR = {"non:blocking:check", 18};
+#endif /* COMPRESSION_THREAD_USE */
 
-	const String ELEM_TEST = {"test", 4};
-	const String ELEM_LONG_TEST = {"long-test", 9};
+#endif /* COMPRESSION_USE */
 
-	const String ATTR_SAMPLE = {"sample", 6};
-	const String ATTR_SAMPLE_2 = {"sample-2", 8};
+/* END: SchemaLess tests */
 
-	const String LONG_DATA_STR = {"Test data.", 10};
-	const String SHORT_DATA_STR = {"echo-echoo-echooo", 17};
-	const String LT1_DATA_STR = {"long-test 1 data", 16};
-	const String LT2_DATA_STR = {"long-test 2 data", 16};
-	const String LT3_DATA_STR = {"long-test 3 data", 16};
+#define OUTPUT_BUFFER_SIZE_LARGE_DOC 20000
+#define MAX_XSD_FILES_COUNT 10 // up to 10 XSD files
 
-	const String SCHEMA_ID_STR = {"schemaID=test", 13};
+/* BEGIN: Schema-mode tests */
+START_TEST (test_large_doc_str_pattern)
+{
+	const String NS_EMPTY_STR = {NULL, 0};
 
-	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	const String ELEM_CONFIGURATION = {"configuration", 13};
+	const String ELEM_CAPSWITCH = {"capable-switch", 14};
+	const String ELEM_RESOURCES = {"resources", 9};
+	const String ELEM_PORT = {"port", 4};
+	const String ELEM_RESID = {"resource-id", 11};
+	const String ELEM_ADMIN_STATE = {"admin-state", 11};
+	const String ELEM_NORECEIVE = {"no-receive", 10};
+	const String ELEM_NOFORWARD = {"no-forward", 10};
+	const String ELEM_NOPACKET = {"no-packet-in", 12};
+
+	const String ELEM_LOGSWITCHES = {"logical-switches", 16};
+	const String ELEM_SWITCH = {"switch", 6};
+	const String ELEM_ID = {"id", 2};
+	const String ELEM_DATAPATHID = {"datapath-id", 11};
+	const String ELEM_ENABLED = {"enabled", 7};
+	const String ELEM_LOSTCONNBEH = {"lost-connection-behavior", 24};
+	const String ELEM_CONTROLLERS = {"controllers", 11};
+	const String ELEM_CONTROLLER = {"controller", 10};
+	const String ELEM_ROLE = {"role", 4};
+	const String ELEM_IPADDR = {"ip-address", 10};
+	const String ELEM_PROTOCOL = {"protocol", 8};
+	const String ELEM_STATE = {"state", 5};
+	const String ELEM_CONNSTATE = {"connection-state", 16};
+	const String ELEM_CURRVER = {"current-version", 15};
+
+	const char * PORT_STR = "port";
+	const char * SWITCH_STR = "switch";
+	const char * STATE_UP_STR = "up";
+	const char * DATAPATH_STR = "10:14:56:7C:89:46:7A:";
+	const char * LOST_CONN_BEHAVIOR_STR = "failSecureMode";
+	const char * CTRL_STR = "ctrl";
+	const char * ROLE_STR = "equal";
+	const char * IPADDR_STR = "10.10.10.";
+	const char * PROTOCOL_STR = "tcp";
+	const char * VER_STR = "1.0";
+
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	FILE *outfile;
+	char* sourceFile = "testOutputFile.exi";
+	EXIPSchema schema;
+//	struct timespec start;
+//	struct timespec end;
+	char* schemafname[1] = {"exip/schema_demo.exi"};
 	EXIStream testStrm;
-	BinaryBuffer buffer;
 	String uri;
 	String ln;
 	QName qname = {&uri, &ln, NULL};
-	EXITypeClass valueType;
-	char smallBuf[40];
-	StreamContext savedContext;
-	SmallIndex savedNonTerminalIndex;
-	unsigned int bytesFlushed = 0;
+	String chVal;
+	char buf[OUTPUT_BUFFER_SIZE_LARGE_DOC];
+	BinaryBuffer buffer;
+	int i, j;
+	char strbuffer[32];
 
-	buffer.buf = smallBuf;
-	buffer.bufLen = 40;
+	buffer.buf = buf;
+	buffer.bufLen = OUTPUT_BUFFER_SIZE_LARGE_DOC;
 	buffer.bufContent = 0;
 
-	*strmSize = 0;
+	parseSchema(schemafname, 1, &schema);
+
+	outfile = fopen(sourceFile, "wb" );
+	fail_if(!outfile, "Unable to open file %s", sourceFile);
 
 	// Serialization steps:
+
 	// I: First initialize the header of the stream
 	serialize.initHeader(&testStrm);
 
-	// II: Set any options in the header (including schemaID and schemaIDMode), if different from the defaults.
+	// II: Set any options in the header, if different from the defaults
+	testStrm.header.has_cookie = TRUE;
 	testStrm.header.has_options = TRUE;
-	SET_ALIGNMENT(testStrm.header.opts.enumOpt, alignment);
-	testStrm.header.opts.schemaIDMode = SCHEMA_ID_SET;
-	testStrm.header.opts.schemaID = SCHEMA_ID_STR;
-
-	// III: Define an external stream for the output if any, otherwise set to NULL
-	buffer.ioStrm.readWriteToStream = NULL;
-	buffer.ioStrm.stream = NULL;
+	testStrm.header.opts.valueMaxLength = 300;
+	testStrm.header.opts.valuePartitionCapacity = INDEX_MAX;
+	SET_STRICT(testStrm.header.opts.enumOpt);
 
+	// III: Define an external stream for the output if any
+	buffer.ioStrm.readWriteToStream = writeFileOutputStream;
+	buffer.ioStrm.stream = outfile;
+	//buffer.ioStrm.readWriteToStream = NULL;
+	//buffer.ioStrm.stream = NULL;
+// printf("line:%d: %d\n", __LINE__, tmp_err_code);
+	//clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
 	// IV: Initialize the stream
-	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+	tmp_err_code = serialize.initStream(&testStrm, buffer, &schema);
+	fail_unless(tmp_err_code == EXIP_OK);
 
-	// V: Start building the stream step by step: header, document, element etc...
-	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+//printf("line:%d: %d\n", __LINE__, tmp_err_code);
+//                clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
 
-	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+	// V: Start building the stream step by step: header, document, element etc...
+	tmp_err_code += serialize.exiHeader(&testStrm);
+// printf("line:%d: %d\n", __LINE__, tmp_err_code);
+	tmp_err_code += serialize.startDocument(&testStrm);
+// printf("line:%d: %d\n", __LINE__, tmp_err_code);
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_CONFIGURATION;
+	EXITypeClass typeClass;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_URN_STR;
-	qname.localName = &ELEM_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <test>
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_CAPSWITCH;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
 	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample="
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	qname.localName = &ELEM_RESOURCES;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+// printf("line:%d: %d\n", __LINE__, tmp_err_code);
+	for (i = 0; i < 100; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+		qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_PORT;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LONG_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_RESID;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+	    sprintf(strbuffer, "%s%d", PORT_STR, i);
+	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_CONFIGURATION;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_ADMIN_STATE;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += asciiToString(STATE_UP_STR, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_NORECEIVE;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += serialize.booleanData(&testStrm, FALSE);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_NOFORWARD;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += serialize.booleanData(&testStrm, FALSE);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_NOPACKET;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += serialize.booleanData(&testStrm, TRUE);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	tmp_err_code += serialize.endElement(&testStrm);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
 	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE_2;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	qname.localName = &ELEM_LOGSWITCHES;
+	tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	for (i = 0; i < 20; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_SWITCH;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, LONG_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo LONG_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_ID;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+		sprintf(strbuffer, "%s%d", SWITCH_STR, i);
+	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_DATAPATHID;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+		sprintf(strbuffer, "%s%d", DATAPATH_STR, 10 + i);
+	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_ENABLED;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += serialize.booleanData(&testStrm, TRUE);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_LOSTCONNBEH;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += asciiToString(LOST_CONN_BEHAVIOR_STR, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+//		if ( i == 0 )
+//		{
+	        qname.uri = &NS_EMPTY_STR;
+	        qname.localName = &ELEM_RESOURCES;
+	        tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+			for (j = 0; j < 100; j++)
+			{
+	            qname.uri = &NS_EMPTY_STR;
+	            qname.localName = &ELEM_PORT;
+	            tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+				sprintf(strbuffer, "%s%d", PORT_STR, j);
+	            tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	            tmp_err_code += serialize.stringData(&testStrm, chVal);
+				tmp_err_code += serialize.endElement(&testStrm);
+			}
+			tmp_err_code += serialize.endElement(&testStrm);
+//		}
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_CONTROLLERS;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_CONTROLLER;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_ID;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+		sprintf(strbuffer, "%s%d", CTRL_STR, i);
+	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_ROLE;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += asciiToString(ROLE_STR, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_IPADDR;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+		sprintf(strbuffer, "%s%d", IPADDR_STR, i);
+	    tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_PORT;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += serialize.intData(&testStrm, 6620);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_PROTOCOL;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += asciiToString(PROTOCOL_STR, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_STATE;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_CONNSTATE;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+	    tmp_err_code += asciiToString(STATE_UP_STR, &chVal, &testStrm.memList, FALSE);
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    qname.uri = &NS_EMPTY_STR;
+	    qname.localName = &ELEM_CURRVER;
+	    tmp_err_code += serialize.startElement(&testStrm, qname, &typeClass);
+// printf("in loop(%d) line:%d: %d\n", i, __LINE__, tmp_err_code);
+	    tmp_err_code += asciiToString(VER_STR, &chVal, &testStrm.memList, FALSE);
+
+	    tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
+
+		tmp_err_code += serialize.endElement(&testStrm);
+	}
+
+	tmp_err_code += serialize.endElement(&testStrm);
+
+	tmp_err_code += serialize.endElement(&testStrm);
+
+	tmp_err_code += serialize.endElement(&testStrm);
+	tmp_err_code += serialize.endDocument(&testStrm);
+	fail_unless(tmp_err_code == EXIP_OK);
+
+//	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+
+	// VI: Free the memory allocated by the EXI stream object
+	tmp_err_code = serialize.closeEXIStream(&testStrm);
+
+//                        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+//                total += ((end.tv_sec * SEC2NANO) + end.tv_nsec) - ((start.tv_sec * SEC2NANO) + start.tv_nsec);
+
+    fclose(outfile);
+    destroySchema(&schema);
+
+    /* DECODE */
+    {
+    	Parser testParser;
+    	FILE *infile;
+
+    	buffer.buf = buf;
+    	buffer.bufContent = 0;
+    	buffer.bufLen = OUTPUT_BUFFER_SIZE_LARGE_DOC;
+    	unsigned int eventCount;
+
+    	// Parsing steps:
+
+    	// I.A: First, read in the schema
+    	parseSchema(schemafname, 1, &schema);
+
+    	// I.B: Define an external stream for the input to the parser if any
+    	infile = fopen(sourceFile, "rb" );
+    	if(!infile)
+    		fail("Unable to open file %s", sourceFile);
+
+    	buffer.ioStrm.readWriteToStream = readFileInputStream;
+    	buffer.ioStrm.stream = infile;
+
+    	// II: Second, initialize the parser object
+    	tmp_err_code = initParser(&testParser, buffer, &eventCount);
+    	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+
+    	// IV: Parse the header of the stream
+		tmp_err_code = parseHeader(&testParser, FALSE);
+		fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+
+		tmp_err_code = setSchema(&testParser, &schema);
+		fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+
+		// V: Parse the body of the EXI stream
+		while(tmp_err_code == EXIP_OK)
+		{
+			tmp_err_code = parseNext(&testParser);
+		}
+
+		// VI: Free the memory allocated by the parser object
+		destroyParser(&testParser);
+		fclose(infile);
+		fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+    }
+
+    remove(sourceFile);
+	destroySchema(&schema);
+}
+END_TEST
+
+#define INPUT_BUFFER_SIZE 200
+
+/* Test substitution groups */
+START_TEST (test_substitution_groups)
+{
+	EXIPSchema schema;
+	FILE *infile;
+	Parser testParser;
+	char buf[INPUT_BUFFER_SIZE];
+	char* schemafname[2] = {"exip/subsGroups/root-xsd.exi","exip/subsGroups/sub-xsd.exi"};
+	char *exifname = "exip/subsGroups/root.exi";
+	char exipath[MAX_PATH_LEN + strlen(exifname)];
+	unsigned int eventCount;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	BinaryBuffer buffer;
+
+	buffer.buf = buf;
+	buffer.bufContent = 0;
+	buffer.bufLen = INPUT_BUFFER_SIZE;
+
+	// Parsing steps:
+
+	// I.A: First, read in the schema
+	parseSchema(schemafname, 2, &schema);
+
+	// I.B: Define an external stream for the input to the parser if any
+	size_t pathlen = strlen(dataDir);
+	memcpy(exipath, dataDir, pathlen);
+	exipath[pathlen] = '/';
+	memcpy(&exipath[pathlen+1], exifname, strlen(exifname)+1);
+
+	infile = fopen(exipath, "rb" );
+	if(!infile)
+		fail("Unable to open file %s", exipath);
+
+	buffer.ioStrm.readWriteToStream = readFileInputStream;
+	buffer.ioStrm.stream = infile;
+
+	// II: Second, initialize the parser object
+	tmp_err_code = initParser(&testParser, buffer, &eventCount);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+
+	// III: Initialize the parsing data and hook the callback handlers to the parser object
+	eventCount = 0;
+
+	// IV: Parse the header of the stream
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+
+	tmp_err_code = setSchema(&testParser,  &schema);
+	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+	// V: Parse the body of the EXI stream
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parseNext(&testParser);
+		eventCount++;
+	}
+
+	fail_unless(eventCount == 38,
+	            "Unexpected event count: %u", eventCount);
+
+	// VI: Free the memory allocated by the parser object
+	destroyParser(&testParser);
+	fclose(infile);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+	destroySchema(&schema);
+}
+END_TEST
+
+errorCode encodeNonBlockingStreaming(EXIPSchema* schema, char* flushBuf, int buf_size, int *strmSize, unsigned char alignment);
+
+START_TEST (test_non_blocking_streaming)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char flushBuf[OUTPUT_BUFFER_SIZE];
+	int strmSize = 0;
+	BinaryBuffer buffer;
+	Parser testParser;
+	char* schemafname[1] = {"exip/NonBlockingStreaming-xsd.exi"};
+	EXIPSchema schema;
+	char tmpBuf[40];
+	unsigned int flushMarker;
+	unsigned int bytesRead;
+
+	parseSchema(schemafname, 1, &schema);
+
+	tmp_err_code = encodeNonBlockingStreaming(&schema, flushBuf, OUTPUT_BUFFER_SIZE, &strmSize, BIT_PACKED);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of non blocking EXI stream");
+	fail_unless(strmSize > 0, "Encoding using non blocking flushing produces empty streams.");
+
+	flushMarker = 20;
+	memcpy(tmpBuf, flushBuf, flushMarker);
+
+	buffer.bufContent = flushMarker;
+	buffer.buf = tmpBuf;
+	buffer.bufLen = 40;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	// Parsing steps:
+
+	// I: First, define an external stream for the input to the parser if any
+
+	// II: Second, initialize the parser object
+	tmp_err_code = parse.initParser(&testParser, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+
+	// III: Initialize the parsing data and hook the callback handlers to the parser object
+
+	// IV: Parse the header of the stream
+
+	tmp_err_code = parse.parseHeader(&testParser, FALSE);
+	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+
+	tmp_err_code = parse.setSchema(&testParser, &schema);
+	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+
+	// V: Parse the body of the EXI stream
+
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parse.parseNext(&testParser);
+	}
+
+	while (tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		tmp_err_code = parse.pushEXIData(flushBuf + flushMarker, strmSize - flushMarker, &bytesRead, &testParser);
+		if(tmp_err_code != EXIP_OK)
+			break;
+		flushMarker += bytesRead;
+
+		while(tmp_err_code == EXIP_OK)
+		{
+			tmp_err_code = parse.parseNext(&testParser);
+		}
+	}
+
+	// VI: Free the memory allocated by the parser object
+
+	parse.destroyParser(&testParser);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+	destroySchema(&schema);
+}
+END_TEST
+
+START_TEST (test_non_blocking_streaming_bytealigned)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char flushBuf[OUTPUT_BUFFER_SIZE];
+	int strmSize = 0;
+	BinaryBuffer buffer;
+	Parser testParser;
+	char* schemafname[1] = {"exip/NonBlockingStreaming-xsd.exi"};
+	EXIPSchema schema;
+	char tmpBuf[40];
+	unsigned int flushMarker;
+	unsigned int bytesRead;
+
+	parseSchema(schemafname, 1, &schema);
+
+	tmp_err_code = encodeNonBlockingStreaming(&schema, flushBuf, OUTPUT_BUFFER_SIZE, &strmSize, BYTE_ALIGNMENT);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of non blocking EXI stream");
+	fail_unless(strmSize > 0, "Encoding using non blocking flushing produces empty streams.");
+
+	flushMarker = 20;
+	memcpy(tmpBuf, flushBuf, flushMarker);
+
+	buffer.bufContent = flushMarker;
+	buffer.buf = tmpBuf;
+	buffer.bufLen = 40;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	// Parsing steps:
+
+	// I: First, define an external stream for the input to the parser if any
+
+	// II: Second, initialize the parser object
+	tmp_err_code = parse.initParser(&testParser, buffer, NULL);
+	fail_unless (tmp_err_code == EXIP_OK, "initParser returns an error code %d", tmp_err_code);
+
+	// III: Initialize the parsing data and hook the callback handlers to the parser object
+
+	// IV: Parse the header of the stream
+
+	tmp_err_code = parse.parseHeader(&testParser, FALSE);
+	fail_unless (tmp_err_code == EXIP_OK, "parsing the header returns an error code %d", tmp_err_code);
+
+	tmp_err_code = parse.setSchema(&testParser, &schema);
+	fail_unless (tmp_err_code == EXIP_OK, "setSchema() returns an error code %d", tmp_err_code);
+
+	// V: Parse the body of the EXI stream
+
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parse.parseNext(&testParser);
+	}
+
+	while (tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		tmp_err_code = parse.pushEXIData(flushBuf + flushMarker, strmSize - flushMarker, &bytesRead, &testParser);
+		if(tmp_err_code != EXIP_OK)
+			break;
+		flushMarker += bytesRead;
+
+		while(tmp_err_code == EXIP_OK)
+		{
+			tmp_err_code = parse.parseNext(&testParser);
+		}
+	}
+
+	// VI: Free the memory allocated by the parser object
+
+	parse.destroyParser(&testParser);
+	fail_unless (tmp_err_code == EXIP_PARSING_COMPLETE, "Error during parsing of the EXI body %d", tmp_err_code);
+	destroySchema(&schema);
+}
+END_TEST
+
+errorCode encodeNonBlockingStreaming(EXIPSchema* schema, char* flushBuf, int buf_size, int *strmSize, unsigned char alignment)
+{
+	const String NS_EMPTY_STR = {NULL, 0};
+	const String NS_URN_STR = {"non:blocking:check", 18};
+
+	const String ELEM_TEST = {"test", 4};
+	const String ELEM_LONG_TEST = {"long-test", 9};
+
+	const String ATTR_SAMPLE = {"sample", 6};
+	const String ATTR_SAMPLE_2 = {"sample-2", 8};
+
+	const String LONG_DATA_STR = {"Test data.", 10};
+	const String SHORT_DATA_STR = {"echo-echoo-echooo", 17};
+	const String LT1_DATA_STR = {"long-test 1 data", 16};
+	const String LT2_DATA_STR = {"long-test 2 data", 16};
+	const String LT3_DATA_STR = {"long-test 3 data", 16};
+
+	const String SCHEMA_ID_STR = {"schemaID=test", 13};
+
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream testStrm;
+	BinaryBuffer buffer;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	EXITypeClass valueType;
+	char smallBuf[40];
+	StreamContext savedContext;
+	SmallIndex savedNonTerminalIndex;
+	unsigned int bytesFlushed = 0;
+
+	buffer.buf = smallBuf;
+	buffer.bufLen = 40;
+	buffer.bufContent = 0;
+
+	*strmSize = 0;
+
+	// Serialization steps:
+	// I: First initialize the header of the stream
+	serialize.initHeader(&testStrm);
+
+	// II: Set any options in the header (including schemaID and schemaIDMode), if different from the defaults.
+	testStrm.header.has_options = TRUE;
+	SET_ALIGNMENT(testStrm.header.opts.enumOpt, alignment);
+	testStrm.header.opts.schemaIDMode = SCHEMA_ID_SET;
+	testStrm.header.opts.schemaID = SCHEMA_ID_STR;
+
+	// III: Define an external stream for the output if any, otherwise set to NULL
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	// IV: Initialize the stream
+	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+
+	// V: Start building the stream step by step: header, document, element etc...
+	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+
+	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_URN_STR;
+	qname.localName = &ELEM_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_LONG_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE_2;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, LONG_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo LONG_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	// ***************************
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_LONG_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE_2;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, LT1_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT1_DATA_STR)); // redo LT1_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	// *************************
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_LONG_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE_2;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, LT2_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT2_DATA_STR)); // redo LT2_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	// ********************************************
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_LONG_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE_2;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, LT3_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT3_DATA_STR)); // redo LT2_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	// ************************
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ELEM_LONG_TEST;
+	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_SAMPLE_2;
+	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo SHORT_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.stringData(&testStrm, LONG_DATA_STR);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo LONG_DATA_STR encoding
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
 
 	savedContext = testStrm.context;
 	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
 	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
 	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	// ************************
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endElement(&testStrm); // </test>
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </test>
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	savedContext = testStrm.context;
+	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
+	tmp_err_code = serialize.endDocument(&testStrm);
+	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	{
+		testStrm.context = savedContext;
+		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
+		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
+		*strmSize += bytesFlushed;
+		TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
+	}
+	else if(tmp_err_code != EXIP_OK)
+		return tmp_err_code;
+
+	if(buf_size - *strmSize < testStrm.buffer.bufContent)
+		return EXIP_UNEXPECTED_ERROR;
+
+	memcpy(flushBuf + *strmSize, testStrm.buffer.buf, testStrm.buffer.bufContent);
+	*strmSize += testStrm.buffer.bufContent;
+
+	// VI: Free the memory allocated by the EXI stream object
+	TRY_CATCH_ENCODE(serialize.closeEXIStream(&testStrm));
+
+	return EXIP_OK;
+}
+
+#define BN_STR_SIZE  50
+#define ALL_STR_SIZE 20
+
+typedef struct
+{
+	char n[ALL_STR_SIZE];  // "" for N/A
+	char u[ALL_STR_SIZE];  // "" for N/A
+	Float v;     // Float.exponent == INT16_MAX for N/A
+	char sv[ALL_STR_SIZE]; // "" for N/A
+	unsigned char bv; // boolean: 0 False, 1 true, else N/A
+	Decimal s;   // Decimal.exponent == INT16_MAX for N/A
+	int t;       // INT_MAX for N/A
+	int ut;      // INT_MAX for N/A
+} senml_elem;
+
+typedef struct
+{
+	char bn[BN_STR_SIZE]; // "" for N/A
+	long bt;     // LONG_MAX for N/A
+	int version; // -1 for N/A
+	char bu[ALL_STR_SIZE]; // "" for N/A
+	senml_elem* eArray;   // Statically assigned array
+	size_t eArrayCount; // The number of e elements in the array
+	size_t eArraySize; // The total number of elements allocated in the array
+} senml;
+
+
+/**
+ * Given an input of senmlData, it encodes an EXI stream (using the EXI options opts,
+ * or the default EXI options if opts is NULL) in buf and returns the size of the resultion stream in size.
+ */
+errorCode encodeSenML(EXIPSchema* schema, senml senmlData, const EXIOptions* opts, char* buf, int buflen, size_t* size);
+
+/**
+ * Given an input EXI stream of SenML data (using default EXI options),
+ * it decodes the data from the stream into senmlData output argument.
+ */
+errorCode decodeSenML(EXIPSchema* schema, char* buf, int buflen, senml* senmlData);
+
+const String NS_SENML_STR = {"urn:ietf:params:xml:ns:senml", 28};
+const String NS_EMPTY_STR = {NULL, 0};
+
+const String ELEM_E_STR = {"e", 1};
+const String ELEM_SENML_STR = {"senml", 5};
+
+const String ATTR_BN_STR = {"bn", 2};
+const String ATTR_BT_STR = {"bt", 2};
+const String ATTR_BU_STR = {"bu", 2};
+const String ATTR_VER_STR = {"ver", 3};
+
+const String ATTR_N_STR = {"n", 1};
+const String ATTR_U_STR = {"u", 1};
+const String ATTR_V_STR = {"v", 1};
+const String ATTR_SV_STR = {"sv", 2};
+const String ATTR_BV_STR = {"bv", 2};
+const String ATTR_S_STR = {"s", 1};
+const String ATTR_T_STR = {"t", 1};
+const String ATTR_UT_STR = {"ut", 2};
+
+errorCode encodeSenML(EXIPSchema* schema, senml senmlData, const EXIOptions* opts, char* buf, int buflen, size_t* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream testStrm;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+	size_t e;
+	String chVal;
+
+	buffer.buf = buf;
+	buffer.bufLen = buflen;
+	buffer.bufContent = buflen;
+
+	// Serialization steps:
+
+	// I: First initialize the header of the stream
+	serialize.initHeader(&testStrm);
+
+	// II: Set any options in the header (including schemaID and schemaIDMode), if different from the defaults.
+	testStrm.header.has_options = TRUE;
+	if(opts != NULL)
+		testStrm.header.opts = *opts;
+
+	// III: Define an external stream for the output if any, otherwise set to NULL
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	// IV: Initialize the stream
+	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+
+	// V: Start building the stream step by step: header, document, element etc...
+	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+
+	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+
+	qname.uri = &NS_SENML_STR;
+	qname.localName = &ELEM_SENML_STR;
+	TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <senml>
+
+	if(senmlData.bn[0] != '\0')
+	{
+		qname.uri = &NS_EMPTY_STR;
+		qname.localName = &ATTR_BN_STR;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bn=""
+
+		TRY_CATCH_ENCODE(asciiToString(senmlData.bn, &chVal, &testStrm.memList, FALSE));
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+	}
+
+	if(senmlData.bt != LONG_MAX)
+	{
+		qname.uri = &NS_EMPTY_STR;
+		qname.localName = &ATTR_BT_STR;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bt=""
+
+		TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.bt));
+	}
+
+	if(senmlData.bu[0] != '\0')
+	{
+		qname.uri = &NS_EMPTY_STR;
+		qname.localName = &ATTR_BU_STR;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bu=""
+		TRY_CATCH_ENCODE(asciiToString(senmlData.bu, &chVal, &testStrm.memList, FALSE));
+		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+	}
+
+	if(senmlData.version != -1)
+	{
+		qname.uri = &NS_EMPTY_STR;
+		qname.localName = &ATTR_VER_STR;
+		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // ver=""
+		TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.version));
+	}
+
+	for(e = 0; e < senmlData.eArrayCount; e++)
+	{
+		qname.uri = &NS_SENML_STR;
+		qname.localName = &ELEM_E_STR;
+		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <e>
+
+		if(senmlData.eArray[e].bv == 0 || senmlData.eArray[e].bv == 1)
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_BV_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bv=""
+			TRY_CATCH_ENCODE(serialize.booleanData(&testStrm, (boolean) senmlData.eArray[e].bv));
+		}
+
+		if(senmlData.eArray[e].n[0] != '\0')
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_N_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // n=""
+			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].n, &chVal, &testStrm.memList, FALSE));
+			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+		}
+
+		if(senmlData.eArray[e].s.exponent != INT16_MAX)
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_S_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // s=""
+			TRY_CATCH_ENCODE(serialize.decimalData(&testStrm, senmlData.eArray[e].s));
+		}
+
+		if(senmlData.eArray[e].sv[0] != '\0')
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_SV_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // sv=""
+			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].sv, &chVal, &testStrm.memList, FALSE));
+			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+		}
+
+		if(senmlData.eArray[e].t != INT_MAX)
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_T_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // t=""
+			TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.eArray[e].t));
+		}
+
+		if(senmlData.eArray[e].u[0] != '\0')
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_U_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // u=""
+			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].u, &chVal, &testStrm.memList, FALSE));
+			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+		}
+
+		if(senmlData.eArray[e].ut != INT_MAX)
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_UT_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // ut=""
+			TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.eArray[e].ut));
+		}
+
+		if(senmlData.eArray[e].v.exponent != INT16_MAX)
+		{
+			qname.uri = &NS_EMPTY_STR;
+			qname.localName = &ATTR_V_STR;
+			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // v=""
+			TRY_CATCH_ENCODE(serialize.floatData(&testStrm, senmlData.eArray[e].v));
+		}
+
+		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </e>
+	}
+
+	TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </senml>
+
+	TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
+
+	// VI: Free the memory allocated by the EXI stream object
+	TRY_CATCH_ENCODE(serialize.closeEXIStream(&testStrm));
+
+	*size = testStrm.buffer.bufContent;
+
+	return tmp_err_code;
+}
+
+typedef enum {
+	BN   = 0,
+	BT   = 1,
+	BU   = 2,
+	VER  = 3,
+	BV   = 4,
+	N    = 5,
+	S    = 6,
+	SV   = 7,
+	T    = 8,
+	U    = 9,
+	UT  = 10,
+	V   = 11,
+	NON = 12
+} Attr;
+
+typedef enum {
+	ELEM_SEN_ML = 0,
+	ELEM_E      = 1,
+	ELEM_NON    = 2
+} Elem;
+
+typedef struct
+{
+	senml* data;
+	Attr currAttr;
+	Elem currElem;
+	int eIndex;
+} AppData;
+
+static errorCode sample_startElement(QName qname, void* app_data);
+static errorCode sample_attribute(QName qname, void* app_data);
+static errorCode sample_stringData(const String value, void* app_data);
+static errorCode sample_floatData(Float fl_val, void* app_data);
+static errorCode sample_booleanData(boolean bool_val, void* app_data);
+static errorCode sample_decimalData(Decimal value, void* app_data);
+static errorCode sample_intData(Integer int_val, void* app_data);
+
+errorCode decodeSenML(EXIPSchema* schema, char* buf, int buflen, senml* senmlData)
+{
+	Parser testParser;
+	BinaryBuffer buffer;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	AppData parsingData;
+
+	buffer.buf = buf;
+	buffer.bufLen = buflen;
+	buffer.bufContent = buflen;
+	// Parsing steps:
+
+	// I: First, define an external stream for the input to the parser if any, otherwise set to NULL
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	parsingData.currElem = ELEM_NON;
+	parsingData.currAttr = NON;
+	parsingData.data = senmlData;
+	parsingData.eIndex = -1;
+	senmlData->eArrayCount = 0;
+
+	// II: Second, initialize the parser object
+	TRY(initParser(&testParser, buffer, &parsingData));
+
+	// III: Initialize the parsing data and hook the callback handlers to the parser object.
+	//      If out-of-band options are defined use testParser.strm.header.opts to set them
+
+	testParser.handler.startElement = sample_startElement;
+	testParser.handler.attribute = sample_attribute;
+	testParser.handler.stringData = sample_stringData;
+	testParser.handler.floatData = sample_floatData;
+	testParser.handler.booleanData = sample_booleanData;
+	testParser.handler.decimalData = sample_decimalData;
+	testParser.handler.intData = sample_intData;
+
+	// IV: Parse the header of the stream
+
+	TRY(parseHeader(&testParser, FALSE));
+
+	// IV.1: Set the schema to be used for parsing.
+	// The schemaID mode and schemaID field can be read at
+	// parser.strm.header.opts.schemaIDMode and
+	// parser.strm.header.opts.schemaID respectively
+	// If schemaless mode, use setSchema(&parser, NULL);
+
+	TRY(setSchema(&testParser, schema));
+
+	// V: Parse the body of the EXI stream
+
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parseNext(&testParser);
 	}
-	else if(tmp_err_code != EXIP_OK)
+
+	// VI: Free the memory allocated by the parser
+
+	destroyParser(&testParser);
+
+	if(tmp_err_code == EXIP_PARSING_COMPLETE)
+		return EXIP_OK;
+	else
 		return tmp_err_code;
+}
 
-	// ***************************
+static errorCode sample_startElement(QName qname, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LONG_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	if(appD->currElem == ELEM_NON)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+		// must senml
+		if(stringCompare(*qname.uri, NS_SENML_STR) == 0 && stringCompare(*qname.localName, ELEM_SENML_STR) == 0)
+		{
+			appD->currElem = ELEM_SEN_ML;
+		}
+		else
+			return EXIP_HANDLER_STOP;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
-
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE_2;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	else if (appD->currElem == ELEM_SEN_ML)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+		// must e
+		if(stringCompare(*qname.uri, NS_SENML_STR) == 0 && stringCompare(*qname.localName, ELEM_E_STR) == 0)
+		{
+			appD->currElem = ELEM_E;
+		}
+		else
+			return EXIP_HANDLER_STOP;
+
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	if (appD->currElem == ELEM_E)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
+		appD->data->eArrayCount += 1;
+		if(appD->data->eArrayCount > appD->data->eArraySize)
+			return EXIP_HANDLER_STOP;
+
+		appD->eIndex += 1;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, LT1_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	return EXIP_OK;
+}
+
+static errorCode sample_attribute(QName qname, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
+
+	// must have empty namespace
+	if(stringCompare(*qname.uri, NS_EMPTY_STR) != 0)
+		return EXIP_HANDLER_STOP;
+
+	if(appD->currElem == ELEM_SEN_ML)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT1_DATA_STR)); // redo LT1_DATA_STR encoding
+		if(stringCompare(*qname.localName, ATTR_BN_STR) == 0)
+			appD->currAttr = BN;
+		else if(stringCompare(*qname.localName, ATTR_BT_STR) == 0)
+			appD->currAttr = BT;
+		else if(stringCompare(*qname.localName, ATTR_BU_STR) == 0)
+			appD->currAttr = BU;
+		else if(stringCompare(*qname.localName, ATTR_VER_STR) == 0)
+			appD->currAttr = VER;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
-
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	else if(appD->currElem == ELEM_E)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+		if(stringCompare(*qname.localName, ATTR_N_STR) == 0)
+			appD->currAttr = N;
+		else if(stringCompare(*qname.localName, ATTR_U_STR) == 0)
+			appD->currAttr = U;
+		else if(stringCompare(*qname.localName, ATTR_V_STR) == 0)
+			appD->currAttr = V;
+		else if(stringCompare(*qname.localName, ATTR_SV_STR) == 0)
+			appD->currAttr = SV;
+		else if(stringCompare(*qname.localName, ATTR_BV_STR) == 0)
+			appD->currAttr = BV;
+		else if(stringCompare(*qname.localName, ATTR_S_STR) == 0)
+			appD->currAttr = S;
+		else if(stringCompare(*qname.localName, ATTR_T_STR) == 0)
+			appD->currAttr = T;
+		else if(stringCompare(*qname.localName, ATTR_UT_STR) == 0)
+			appD->currAttr = UT;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	else
+		return EXIP_HANDLER_STOP;
 
-	// *************************
+	return EXIP_OK;
+}
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LONG_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+static errorCode sample_stringData(const String value, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
+
+	switch(appD->currAttr)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+		case BN:
+			if(value.length < BN_STR_SIZE)
+			{
+				memcpy(appD->data->bn, value.str, value.length);
+				appD->data->bn[value.length] = '\0';
+			}
+			else
+				return EXIP_HANDLER_STOP;
+		break;
+		case BU:
+			if(value.length < ALL_STR_SIZE)
+			{
+				memcpy(appD->data->bu, value.str, value.length);
+				appD->data->bu[value.length] = '\0';
+			}
+			else
+				return EXIP_HANDLER_STOP;
+		break;
+		case N:
+			if(value.length < ALL_STR_SIZE)
+			{
+				memcpy(appD->data->eArray[appD->eIndex].n, value.str, value.length);
+				appD->data->eArray[appD->eIndex].n[value.length] = '\0';
+			}
+			else
+				return EXIP_HANDLER_STOP;
+		break;
+		case U:
+			if(value.length < ALL_STR_SIZE)
+			{
+				memcpy(appD->data->eArray[appD->eIndex].u, value.str, value.length);
+				appD->data->eArray[appD->eIndex].u[value.length] = '\0';
+			}
+			else
+				return EXIP_HANDLER_STOP;
+		break;
+		case SV:
+			if(value.length < ALL_STR_SIZE)
+			{
+				memcpy(appD->data->eArray[appD->eIndex].sv, value.str, value.length);
+				appD->data->eArray[appD->eIndex].sv[value.length] = '\0';
+			}
+			else
+				return EXIP_HANDLER_STOP;
+		break;
+		default:
+			return EXIP_HANDLER_STOP;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE_2;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	return EXIP_OK;
+}
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+static errorCode sample_floatData(Float fl_val, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, LT2_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	if(appD->currAttr == V)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT2_DATA_STR)); // redo LT2_DATA_STR encoding
+		appD->data->eArray[appD->eIndex].v = fl_val;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	else
+		return EXIP_HANDLER_STOP;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	return EXIP_OK;
+}
 
-	// ********************************************
+static errorCode sample_booleanData(boolean bool_val, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LONG_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	if(appD->currAttr == BV)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+		appD->data->eArray[appD->eIndex].bv = bool_val;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	else
+		return EXIP_HANDLER_STOP;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE_2;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	return EXIP_OK;
+}
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, SHORT_DATA_STR)); // redo SHORT_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+static errorCode sample_decimalData(Decimal value, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, LT3_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	if(appD->currAttr == S)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LT3_DATA_STR)); // redo LT2_DATA_STR encoding
+		appD->data->eArray[appD->eIndex].s = value;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	else
+		return EXIP_HANDLER_STOP;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	return EXIP_OK;
+}
 
-	// ************************
+static errorCode sample_intData(Integer int_val, void* app_data)
+{
+	AppData* appD = (AppData*) app_data;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ELEM_LONG_TEST;
-	tmp_err_code = serialize.startElement(&testStrm, qname, &valueType); // <long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	switch(appD->currAttr)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // redo the <long-test>
+		case BT:
+			appD->data->bt = int_val;
+		break;
+		case VER:
+			appD->data->version = int_val;
+		break;
+		case T:
+			appD->data->eArray[appD->eIndex].t = int_val;
+		break;
+		case UT:
+			appD->data->eArray[appD->eIndex].ut = int_val;
+		break;
+		default:
+			return EXIP_HANDLER_STOP;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	return EXIP_OK;
+}
+
+#define E_ELEM_COUNT   7  // The number of e elems in the senML to be encoded is 7
+
+START_TEST (test_various_senml)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char buf[OUTPUT_BUFFER_SIZE];
+	char* schemafname[1] = {"exip/SenML-xsd.exi"};
+	EXIPSchema schema;
+	size_t exiSize = 0;
+	senml_elem eArr[E_ELEM_COUNT];
+	senml senML_instance;
+	senml_elem eArrParsed[E_ELEM_COUNT];
+	senml senMLParsed;
+	int i;
+
+	parseSchema(schemafname, 1, &schema);
+
+	strcpy(senML_instance.bn, "urn:dev:mac:0024befffe804ff1");
+	senML_instance.bt = 1415355691;
+	senML_instance.version = 1;
+	senML_instance.bu[0] = '\0';
+	senML_instance.eArrayCount = E_ELEM_COUNT;
+	senML_instance.eArraySize = E_ELEM_COUNT;
+	senML_instance.eArray = eArr;
+
+	// E elem 0
+	strcpy(eArr[0].n, "pktid");
+	strcpy(eArr[0].u, "count");
+	eArr[0].v.mantissa = 1;
+	eArr[0].v.exponent = 0;
+
+	// E elem 1
+	strcpy(eArr[1].n, "rpm");
+	strcpy(eArr[1].u, "r/m");
+	eArr[1].v.mantissa = 352;
+	eArr[1].v.exponent = 0;
+
+	// E elem 2
+	strcpy(eArr[2].n, "rpm_av");
+	strcpy(eArr[2].u, "r/m");
+	eArr[2].v.mantissa = 352;
+	eArr[2].v.exponent = 0;
+
+	// E elem 3
+	strcpy(eArr[3].n, "totrounds");
+	strcpy(eArr[3].u, "count");
+	eArr[3].v.mantissa = 461;
+	eArr[3].v.exponent = 3;   // 461000
+
+	// E elem 4
+	strcpy(eArr[4].n, "totrounds_r");
+	strcpy(eArr[4].u, "count");
+	eArr[4].v.mantissa = 0;
+	eArr[4].v.exponent = 0;
+
+	// E elem 5
+	strcpy(eArr[5].n, "bearingtemp");
+	strcpy(eArr[5].u, "Cel");
+	eArr[5].v.mantissa = 454;
+	eArr[5].v.exponent = -1; // 45.4
+
+	// E elem 6
+	strcpy(eArr[6].n, "rssi");
+	strcpy(eArr[6].u, "%");
+	eArr[6].v.mantissa = 9;
+	eArr[6].v.exponent = 1; // 90
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	qname.uri = &NS_EMPTY_STR;
-	qname.localName = &ATTR_SAMPLE_2;
-	tmp_err_code = serialize.attribute(&testStrm, qname, TRUE, &valueType); // sample-2="
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	// All the other fileds are set to N/A
+	for(i = 0; i < E_ELEM_COUNT; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // redo sample-2="
+		eArr[i].bv = 5;
+		eArr[i].s.exponent = INT16_MAX;
+		eArr[i].sv[0] = '\0';
+		eArr[i].t = INT_MAX;
+		eArr[i].ut = INT_MAX;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, SHORT_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
-	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo SHORT_DATA_STR encoding
-	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	tmp_err_code = encodeSenML(&schema, senML_instance, NULL, buf, OUTPUT_BUFFER_SIZE, &exiSize);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of an EXI SenML stream");
+	fail_unless(exiSize > 0, "Encoding SenML produces empty streams.");
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.stringData(&testStrm, LONG_DATA_STR);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	senMLParsed.eArray = eArrParsed;
+	senMLParsed.bn[0] = '\0';
+	senMLParsed.bt = LONG_MAX;
+	senMLParsed.version = -1;
+	senMLParsed.bu[0] = '\0';
+	senMLParsed.eArrayCount = 0;
+	senMLParsed.eArraySize = E_ELEM_COUNT;
+	senMLParsed.eArray = eArr;
+
+	for(i = 0; i < E_ELEM_COUNT; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, LONG_DATA_STR)); // redo LONG_DATA_STR encoding
+		eArrParsed[i].n[0] = '\0';
+		eArrParsed[i].u[0] = '\0';
+		eArrParsed[i].v.exponent = INT16_MAX;
+		eArrParsed[i].bv = 5;
+		eArrParsed[i].s.exponent = INT16_MAX;
+		eArrParsed[i].sv[0] = '\0';
+		eArrParsed[i].t = INT_MAX;
+		eArrParsed[i].ut = INT_MAX;
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endElement(&testStrm); // </long-test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	tmp_err_code = decodeSenML(&schema, buf, OUTPUT_BUFFER_SIZE, &senMLParsed);
+	destroySchema(&schema);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the decoding of an EXI SenML stream");
+	fail_unless(!strcmp(senMLParsed.bn, senML_instance.bn), "SenML BN value error");
+	fail_unless(senMLParsed.bt == senML_instance.bt, "SenML BT value error");
+	fail_unless(senMLParsed.version == senML_instance.version, "SenML version value error");
+
+	for(i = 0; i < senMLParsed.eArrayCount; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </long-test>
+		fail_unless(!strcmp(senMLParsed.eArray[i].n, senML_instance.eArray[i].n), "SenML N value error");
+		fail_unless(!strcmp(senMLParsed.eArray[i].u, senML_instance.eArray[i].u), "SenML U value error");
+		fail_unless(senMLParsed.eArray[i].v.mantissa == senML_instance.eArray[i].v.mantissa, "SenML V value error");
+		fail_unless(senMLParsed.eArray[i].v.exponent == senML_instance.eArray[i].v.exponent, "SenML V value error");
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
 
-	// ************************
+}
+END_TEST
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endElement(&testStrm); // </test>
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+/**
+ * The qnames of a document with the schema Profile/input/localValTbl/indexed.xsd: the global
+ * element root with an xs:any wildcard, the global attribute at1 and two qnames out of the schema
+ */
+enum handleQName {HQ_ROOT, HQ_AT1, HQ_OTHER, HQ_AT2, HQ_COUNT};
+
+static const String HQ_LN_STR[HQ_COUNT] = {{"root", 4}, {"at1", 3}, {"other", 5}, {"at2", 3}};
+
+/**
+ * <root><root/><other at1="" at2="">value</other><other at1="">value</other></root>
+ * as start element (S), attribute (A), characters (C) and end element (E) steps
+ */
+static const char HQ_STEPS[] = "S0S0E0S2A1A3C2E2S2A1C2E2E0";
+
+/**
+ * Encodes the document with startElementH() and attributeH() when handles is not NULL;
+ * with startElement() and attribute() otherwise
+ */
+static errorCode encodeHandleDoc(EXIPSchema* schema, const QNameHandle* handles, char* buf, int buflen, size_t* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream testStrm;
+	QName qname = {&NS_EMPTY_STR, NULL, NULL};
+	String chVal = {"value", 5};
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+	unsigned int i, q;
+
+	buffer.buf = buf;
+	buffer.bufLen = buflen;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	serialize.initHeader(&testStrm);
+	testStrm.header.has_options = TRUE;
+	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+
+	for(i = 0; HQ_STEPS[i] != '\0'; i += 2)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // redo the </test>
+		q = HQ_STEPS[i + 1] - '0';
+		qname.localName = &HQ_LN_STR[q];
+
+		switch(HQ_STEPS[i])
+		{
+			case 'S':
+				if(handles != NULL)
+					TRY_CATCH_ENCODE(serialize.startElementH(&testStrm, &handles[q], &valueType));
+				else
+					TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType));
+			break;
+			case 'A':
+				if(handles != NULL)
+					TRY_CATCH_ENCODE(serialize.attributeH(&testStrm, &handles[q], TRUE, &valueType));
+				else
+					TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType));
+				TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+			break;
+			case 'C':
+				TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+			break;
+			default:
+				TRY_CATCH_ENCODE(serialize.endElement(&testStrm));
+		}
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
 
-	savedContext = testStrm.context;
-	savedNonTerminalIndex = testStrm.gStack->currNonTermID;
-	tmp_err_code = serialize.endDocument(&testStrm);
-	if(tmp_err_code == EXIP_BUFFER_END_REACHED)
+	*size = testStrm.context.bufferIndx + (testStrm.context.bitPointer != 0);
+
+	return serialize.closeEXIStream(&testStrm);
+}
+
+/**
+ * The streams encoded with the QName handles are the same as with the strings:
+ * for the qnames in and out of the schema, through the SE(*) and AT(*) productions,
+ * in schema and schema-less mode
+ */
+START_TEST (test_qname_handles)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char bufStr[OUTPUT_BUFFER_SIZE];
+	char bufHandle[OUTPUT_BUFFER_SIZE];
+	char* schemafname[1] = {"Profile/input/localValTbl/indexed-schema-xsd.exi"};
+	QNameHandle handles[HQ_COUNT];
+	QName qname = {&NS_EMPTY_STR, NULL, NULL};
+	EXIPSchema schema;
+	size_t sizeStr = 0;
+	size_t sizeHandle = 0;
+	unsigned int i;
+
+	parseSchema(schemafname, 1, &schema);
+
+	for(i = 0; i < HQ_COUNT; i++)
 	{
-		testStrm.context = savedContext;
-		testStrm.gStack->currNonTermID = savedNonTerminalIndex;
-		TRY_CATCH_ENCODE(flushEXIData(&testStrm, flushBuf + *strmSize, buf_size - *strmSize, &bytesFlushed));
-		*strmSize += bytesFlushed;
-		TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
+		qname.localName = &HQ_LN_STR[i];
+		tmp_err_code = serialize.resolveQNameHandle(&schema, qname, &handles[i]);
+		fail_unless(tmp_err_code == EXIP_OK, "resolveQNameHandle returns an error code %d", tmp_err_code);
 	}
-	else if(tmp_err_code != EXIP_OK)
-		return tmp_err_code;
+	fail_unless(handles[HQ_ROOT].qnameId.uriId != URI_MAX && handles[HQ_ROOT].elemGrammar != INDEX_MAX, "<root> is not resolved");
+	fail_unless(handles[HQ_AT1].qnameId.uriId != URI_MAX, "at1 is not resolved");
+	fail_unless(handles[HQ_OTHER].qnameId.uriId == URI_MAX && handles[HQ_AT2].qnameId.uriId == URI_MAX, "A qname out of the schema is resolved");
+
+	// Schema mode
+	tmp_err_code = encodeHandleDoc(&schema, NULL, bufStr, OUTPUT_BUFFER_SIZE, &sizeStr);
+	fail_unless(tmp_err_code == EXIP_OK, "Encoding with qnames returns an error code %d", tmp_err_code);
+	tmp_err_code = encodeHandleDoc(&schema, handles, bufHandle, OUTPUT_BUFFER_SIZE, &sizeHandle);
+	fail_unless(tmp_err_code == EXIP_OK, "Encoding with QName handles returns an error code %d", tmp_err_code);
+	fail_unless(sizeStr == sizeHandle && memcmp(bufStr, bufHandle, sizeStr) == 0, "The streams encoded with the QName handles differ");
+
+	// Schema-less mode: the handles resolved against the schema take the path of the qnames
+	tmp_err_code = encodeHandleDoc(NULL, NULL, bufStr, OUTPUT_BUFFER_SIZE, &sizeStr);
+	fail_unless(tmp_err_code == EXIP_OK, "Schema-less encoding with qnames returns an error code %d", tmp_err_code);
+	tmp_err_code = encodeHandleDoc(NULL, handles, bufHandle, OUTPUT_BUFFER_SIZE, &sizeHandle);
+	fail_unless(tmp_err_code == EXIP_OK, "Schema-less encoding with QName handles returns an error code %d", tmp_err_code);
+	fail_unless(sizeStr == sizeHandle && memcmp(bufStr, bufHandle, sizeStr) == 0, "The schema-less streams encoded with the QName handles differ");
 
-	if(buf_size - *strmSize < testStrm.buffer.bufContent)
-		return EXIP_UNEXPECTED_ERROR;
+	destroySchema(&schema);
+}
+END_TEST
 
-	memcpy(flushBuf + *strmSize, testStrm.buffer.buf, testStrm.buffer.bufContent);
-	*strmSize += testStrm.buffer.bufContent;
+#define E_ELEM_COUNT_BATCH 40
+#define OUTPUT_BUFFER_SIZE_BATCH 8000
+#define BATCH_TRACE_SIZE 60000
+#define BATCH_QNAMEID_EQUAL(a, b) ((a).uriId == (b).uriId && (a).lnId == (b).lnId)
 
-	// VI: Free the memory allocated by the EXI stream object
-	TRY_CATCH_ENCODE(serialize.closeEXIStream(&testStrm));
+/** The text of the events of a parsing, one line per event */
+struct batchTrace
+{
+	char buf[BATCH_TRACE_SIZE];
+	size_t len;
+};
+
+static void traceLine(struct batchTrace* trace, const char* kind, const String* str1, const String* str2)
+{
+	trace->len += snprintf(trace->buf + trace->len, BATCH_TRACE_SIZE - trace->len, "%s %.*s %.*s\n", kind,
+			str1 == NULL ? 0 : (int) str1->length, str1 == NULL ? "" : str1->str,
+			str2 == NULL ? 0 : (int) str2->length, str2 == NULL ? "" : str2->str);
+	if(trace->len > BATCH_TRACE_SIZE)
+		trace->len = BATCH_TRACE_SIZE;
+}
 
+static errorCode batch_endDocument(void* app_data)
+{
+	traceLine((struct batchTrace*) app_data, "ED", NULL, NULL);
 	return EXIP_OK;
 }
 
-#define BN_STR_SIZE  50
-#define ALL_STR_SIZE 20
+static errorCode batch_startElement(QName qname, void* app_data)
+{
+	traceLine((struct batchTrace*) app_data, "SE", qname.uri, qname.localName);
+	return EXIP_OK;
+}
 
-typedef struct
+static errorCode batch_endElement(void* app_data)
 {
-	char n[ALL_STR_SIZE];  // "" for N/A
-	char u[ALL_STR_SIZE];  // "" for N/A
-	Float v;     // Float.exponent == INT16_MAX for N/A
-	char sv[ALL_STR_SIZE]; // "" for N/A
-	unsigned char bv; // boolean: 0 False, 1 true, else N/A
-	Decimal s;   // Decimal.exponent == INT16_MAX for N/A
-	int t;       // INT_MAX for N/A
-	int ut;      // INT_MAX for N/A
-} senml_elem;
+	traceLine((struct batchTrace*) app_data, "EE", NULL, NULL);
+	return EXIP_OK;
+}
 
-typedef struct
+static errorCode batch_attribute(QName qname, void* app_data)
 {
-	char bn[BN_STR_SIZE]; // "" for N/A
-	long bt;     // LONG_MAX for N/A
-	int version; // -1 for N/A
-	char bu[ALL_STR_SIZE]; // "" for N/A
-	senml_elem* eArray;   // Statically assigned array
-	size_t eArrayCount; // The number of e elements in the array
-	size_t eArraySize; // The total number of elements allocated in the array
-} senml;
+	traceLine((struct batchTrace*) app_data, "AT", qname.uri, qname.localName);
+	return EXIP_OK;
+}
+
+static errorCode batch_intData(Integer int_val, void* app_data)
+{
+	char num[32];
+	String str = {num, 0};
 
+	str.length = sprintf(num, "%ld", (long) int_val);
+	traceLine((struct batchTrace*) app_data, "INT", &str, NULL);
+	return EXIP_OK;
+}
 
-/**
- * Given an input of senmlData, it encodes an EXI stream (using default EXI options)
- * in buf and returns the size of the resultion stream in size.
- */
-errorCode encodeSenML(EXIPSchema* schema, senml senmlData, char* buf, int buflen, size_t* size);
+static errorCode batch_booleanData(boolean bool_val, void* app_data)
+{
+	traceLine((struct batchTrace*) app_data, bool_val ? "TRUE" : "FALSE", NULL, NULL);
+	return EXIP_OK;
+}
+
+static errorCode batch_stringData(const String str_val, void* app_data)
+{
+	traceLine((struct batchTrace*) app_data, "STR", &str_val, NULL);
+	return EXIP_OK;
+}
+
+static errorCode batch_floatData(Float float_val, void* app_data)
+{
+	char num[48];
+	String str = {num, 0};
+
+	str.length = sprintf(num, "%lldE%d", (long long) float_val.mantissa, (int) float_val.exponent);
+	traceLine((struct batchTrace*) app_data, "FLOAT", &str, NULL);
+	return EXIP_OK;
+}
+
+static errorCode batch_decimalData(Decimal dec_val, void* app_data)
+{
+	char num[48];
+	String str = {num, 0};
+
+	str.length = sprintf(num, "%lldE%d", (long long) dec_val.mantissa, (int) dec_val.exponent);
+	traceLine((struct batchTrace*) app_data, "DECIMAL", &str, NULL);
+	return EXIP_OK;
+}
 
 /**
- * Given an input EXI stream of SenML data (using default EXI options),
- * it decodes the data from the stream into senmlData output argument.
+ * Parses the stream with parseNext() into trace
  */
-errorCode decodeSenML(EXIPSchema* schema, char* buf, int buflen, senml* senmlData);
+static errorCode traceParse(EXIPSchema* schema, SchemaRegistry* registry, char* buf, size_t size, struct batchTrace* trace);
 
-const String NS_SENML_STR = {"urn:ietf:params:xml:ns:senml", 28};
-const String NS_EMPTY_STR = {NULL, 0};
+static errorCode traceParseNext(EXIPSchema* schema, char* buf, size_t size, struct batchTrace* trace)
+{
+	return traceParse(schema, NULL, buf, size, trace);
+}
 
-const String ELEM_E_STR = {"e", 1};
-const String ELEM_SENML_STR = {"senml", 5};
+/**
+ * Parses the stream with parseNext() into trace. The schema is bound by
+ * parseHeader() when registry is not NULL
+ */
+static errorCode traceParse(EXIPSchema* schema, SchemaRegistry* registry, char* buf, size_t size, struct batchTrace* trace)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	Parser testParser;
+	BinaryBuffer buffer;
 
-const String ATTR_BN_STR = {"bn", 2};
-const String ATTR_BT_STR = {"bt", 2};
-const String ATTR_BU_STR = {"bu", 2};
-const String ATTR_VER_STR = {"ver", 3};
+	buffer.buf = buf;
+	buffer.bufLen = size;
+	buffer.bufContent = size;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+	trace->len = 0;
+
+	TRY(initParser(&testParser, buffer, trace));
+	testParser.handler.endDocument = batch_endDocument;
+	testParser.handler.startElement = batch_startElement;
+	testParser.handler.endElement = batch_endElement;
+	testParser.handler.attribute = batch_attribute;
+	testParser.handler.intData = batch_intData;
+	testParser.handler.booleanData = batch_booleanData;
+	testParser.handler.stringData = batch_stringData;
+	testParser.handler.floatData = batch_floatData;
+	testParser.handler.decimalData = batch_decimalData;
+	testParser.registry = registry;
 
-const String ATTR_N_STR = {"n", 1};
-const String ATTR_U_STR = {"u", 1};
-const String ATTR_V_STR = {"v", 1};
-const String ATTR_SV_STR = {"sv", 2};
-const String ATTR_BV_STR = {"bv", 2};
-const String ATTR_S_STR = {"s", 1};
-const String ATTR_T_STR = {"t", 1};
-const String ATTR_UT_STR = {"ut", 2};
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	if(tmp_err_code == EXIP_OK && registry == NULL)
+		tmp_err_code = setSchema(&testParser, schema);
+	while(tmp_err_code == EXIP_OK)
+		tmp_err_code = parseNext(&testParser);
+	destroyParser(&testParser);
 
-errorCode encodeSenML(EXIPSchema* schema, senml senmlData, char* buf, int buflen, size_t* size)
+	return tmp_err_code;
+}
+
+/**
+ * Parses the stream with parseNextBatch() into trace, batchSize events per call.
+ * The qnameId of the values are checked against their elements and attributes
+ */
+static errorCode traceParseNextBatch(EXIPSchema* schema, char* buf, size_t size, Index batchSize, struct batchTrace* trace)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	EXIStream testStrm;
+	Parser testParser;
+	BinaryBuffer buffer;
+	EXIEvent events[256];
+	QNameID elements[16];
+	unsigned int depth = 0;
+	QNameID attr = {URI_MAX, LN_MAX};
+	boolean afterAttr = FALSE;
+	QName qname;
 	String uri;
 	String ln;
-	QName qname = {&uri, &ln, NULL};
-	BinaryBuffer buffer;
-	EXITypeClass valueType;
-	size_t e;
-	String chVal;
+	Index count;
+	Index i;
 
 	buffer.buf = buf;
-	buffer.bufLen = buflen;
-	buffer.bufContent = buflen;
-
-	// Serialization steps:
-
-	// I: First initialize the header of the stream
-	serialize.initHeader(&testStrm);
-
-	// II: Set any options in the header (including schemaID and schemaIDMode), if different from the defaults.
-	testStrm.header.has_options = TRUE;
-
-	// III: Define an external stream for the output if any, otherwise set to NULL
+	buffer.bufLen = size;
+	buffer.bufContent = size;
 	buffer.ioStrm.readWriteToStream = NULL;
 	buffer.ioStrm.stream = NULL;
+	trace->len = 0;
 
-	// IV: Initialize the stream
-	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+	TRY(initParser(&testParser, buffer, NULL));
+	tmp_err_code = parseHeader(&testParser, FALSE);
+	if(tmp_err_code == EXIP_OK)
+		tmp_err_code = setSchema(&testParser, schema);
 
-	// V: Start building the stream step by step: header, document, element etc...
-	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+	while(tmp_err_code == EXIP_OK)
+	{
+		tmp_err_code = parseNextBatch(&testParser, events, batchSize, &count);
+		if(tmp_err_code != EXIP_OK && tmp_err_code != EXIP_PARSING_COMPLETE)
+			break;
+		if(count == 0 || count > batchSize || (tmp_err_code == EXIP_OK && count != batchSize))
+			tmp_err_code = EXIP_UNEXPECTED_ERROR;
 
-	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+		for(i = 0; i < count && tmp_err_code != EXIP_UNEXPECTED_ERROR; i++)
+		{
+			EXIEvent* ev = &events[i];
 
-	qname.uri = &NS_SENML_STR;
-	qname.localName = &ELEM_SENML_STR;
-	TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <senml>
+			// The names of the elements and attributes are given by their qnameId
+			qname.uri = &uri;
+			qname.localName = &ln;
+			qname.prefix = NULL;
+			if(ev->kind == EXI_EVENT_START_ELEMENT || ev->kind == EXI_EVENT_ATTRIBUTE)
+			{
+				if(getQNameStrings(&testParser, ev->qnameId, &uri, &ln) != EXIP_OK || ev->data.prefix.str != NULL)
+					tmp_err_code = EXIP_UNEXPECTED_ERROR;
+			}
 
-	if(senmlData.bn[0] != '\0')
-	{
-		qname.uri = &NS_EMPTY_STR;
-		qname.localName = &ATTR_BN_STR;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bn=""
+			switch(ev->kind)
+			{
+				case EXI_EVENT_END_DOCUMENT:
+					batch_endDocument(trace);
+				break;
+				case EXI_EVENT_START_ELEMENT:
+					batch_startElement(qname, trace);
+					if(depth < 16)
+						elements[depth] = ev->qnameId;
+					depth++;
+				break;
+				case EXI_EVENT_END_ELEMENT:
+					batch_endElement(trace);
+					depth--;
+					if(depth >= 16 || !BATCH_QNAMEID_EQUAL(elements[depth], ev->qnameId))
+						tmp_err_code = EXIP_UNEXPECTED_ERROR;
+				break;
+				case EXI_EVENT_ATTRIBUTE:
+					batch_attribute(qname, trace);
+					attr = ev->qnameId;
+				break;
+				case EXI_EVENT_INT:
+					batch_intData(ev->data.intVal, trace);
+				break;
+				case EXI_EVENT_BOOLEAN:
+					batch_booleanData(ev->data.boolVal, trace);
+				break;
+				case EXI_EVENT_STRING:
+					batch_stringData(ev->data.strVal, trace);
+				break;
+				case EXI_EVENT_FLOAT:
+					batch_floatData(ev->data.floatVal, trace);
+				break;
+				case EXI_EVENT_DECIMAL:
+					batch_decimalData(ev->data.decVal, trace);
+				break;
+				default:
+					tmp_err_code = EXIP_UNEXPECTED_ERROR;
+			}
 
-		TRY_CATCH_ENCODE(asciiToString(senmlData.bn, &chVal, &testStrm.memList, FALSE));
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+			// A value is the value of the attribute before it or of the current element
+			if(ev->kind >= EXI_EVENT_INT && (depth == 0 || depth > 16 ||
+					!BATCH_QNAMEID_EQUAL(ev->qnameId, afterAttr ? attr : elements[depth - 1])))
+				tmp_err_code = EXIP_UNEXPECTED_ERROR;
+			afterAttr = ev->kind == EXI_EVENT_ATTRIBUTE;
+		}
 	}
+	destroyParser(&testParser);
 
-	if(senmlData.bt != LONG_MAX)
-	{
-		qname.uri = &NS_EMPTY_STR;
-		qname.localName = &ATTR_BT_STR;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bt=""
+	return tmp_err_code;
+}
 
-		TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.bt));
-	}
+/**
+ * Decodes a SenML document with parseNextBatch() for several sizes of the event array
+ * and compares the events with the callbacks of parseNext(); also with bounded
+ * value partitions and with compression
+ */
+START_TEST (test_parse_next_batch)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	static char buf[OUTPUT_BUFFER_SIZE_BATCH];
+	static senml_elem eArr[E_ELEM_COUNT_BATCH];
+	static struct batchTrace expected;
+	static struct batchTrace trace;
+	const char* units[4] = {"count", "r/m", "Cel", "%"};
+	const Index batchSizes[4] = {1, 2, 7, 256};
+	char* schemafname[1] = {"exip/SenML-xsd.exi"};
+	EXIPSchema schema;
+	EXIOptions opts;
+	size_t exiSize = 0;
+	senml senML_instance;
+	unsigned int c;
+	unsigned int b;
+	int i;
 
-	if(senmlData.bu[0] != '\0')
-	{
-		qname.uri = &NS_EMPTY_STR;
-		qname.localName = &ATTR_BU_STR;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bu=""
-		TRY_CATCH_ENCODE(asciiToString(senmlData.bu, &chVal, &testStrm.memList, FALSE));
-		TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
-	}
+	parseSchema(schemafname, 1, &schema);
 
-	if(senmlData.version != -1)
+	strcpy(senML_instance.bn, "urn:dev:mac:0024befffe804ff1");
+	senML_instance.bt = 1415355691;
+	senML_instance.version = 1;
+	strcpy(senML_instance.bu, "Cel");
+	senML_instance.eArrayCount = E_ELEM_COUNT_BATCH;
+	senML_instance.eArraySize = E_ELEM_COUNT_BATCH;
+	senML_instance.eArray = eArr;
+
+	for(i = 0; i < E_ELEM_COUNT_BATCH; i++)
 	{
-		qname.uri = &NS_EMPTY_STR;
-		qname.localName = &ATTR_VER_STR;
-		TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // ver=""
-		TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.version));
+		sprintf(eArr[i].n, "sensor%d", i % 7);
+		strcpy(eArr[i].u, units[i % 4]);
+		eArr[i].v.mantissa = 37*i - 500;
+		eArr[i].v.exponent = i % 5 - 2;
+		eArr[i].bv = i % 3;
+		eArr[i].s.mantissa = 10*i + 7;
+		eArr[i].s.exponent = i % 2 == 0 ? -2 : INT16_MAX;
+		if(i % 10 == 0)
+			sprintf(eArr[i].sv, "state %d", i);
+		else
+			eArr[i].sv[0] = '\0';
+		eArr[i].t = i % 4 == 0 ? INT_MAX : -i;
+		eArr[i].ut = 60 + i % 2;
 	}
 
-	for(e = 0; e < senmlData.eArrayCount; e++)
+#if COMPRESSION_USE
+	for(c = 0; c < 3; c++)
+#else
+	for(c = 0; c < 2; c++)
+#endif
 	{
-		qname.uri = &NS_SENML_STR;
-		qname.localName = &ELEM_E_STR;
-		TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <e>
+		makeDefaultOpts(&opts);
+		if(c == 1)
+			opts.valuePartitionCapacity = 3; // The values are evicted (and freed) while their events are delivered
+		else if(c == 2)
+			SET_COMPRESSION(opts.enumOpt);
 
-		if(senmlData.eArray[e].bv == 0 || senmlData.eArray[e].bv == 1)
-		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_BV_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bv=""
-			TRY_CATCH_ENCODE(serialize.booleanData(&testStrm, (boolean) senmlData.eArray[e].bv));
-		}
+		tmp_err_code = encodeSenML(&schema, senML_instance, &opts, buf, OUTPUT_BUFFER_SIZE_BATCH, &exiSize);
+		fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of EXI SenML stream %u", c);
 
-		if(senmlData.eArray[e].n[0] != '\0')
-		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_N_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // n=""
-			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].n, &chVal, &testStrm.memList, FALSE));
-			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
-		}
+		tmp_err_code = traceParseNext(&schema, buf, exiSize, &expected);
+		fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNext() returns an error code %d", tmp_err_code);
+		fail_unless(expected.len > 0 && expected.len < BATCH_TRACE_SIZE, "The trace of parseNext() is %u characters", (unsigned int) expected.len);
 
-		if(senmlData.eArray[e].s.exponent != INT16_MAX)
+		for(b = 0; b < 4; b++)
 		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_S_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // s=""
-			TRY_CATCH_ENCODE(serialize.decimalData(&testStrm, senmlData.eArray[e].s));
+			tmp_err_code = traceParseNextBatch(&schema, buf, exiSize, batchSizes[b], &trace);
+			fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNextBatch() of %u events returns an error code %d in stream %u",
+					(unsigned int) batchSizes[b], tmp_err_code, c);
+			fail_unless(trace.len == expected.len && memcmp(trace.buf, expected.buf, trace.len) == 0,
+					"parseNextBatch() of %u events decodes other events in stream %u", (unsigned int) batchSizes[b], c);
 		}
+	}
 
-		if(senmlData.eArray[e].sv[0] != '\0')
-		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_SV_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // sv=""
-			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].sv, &chVal, &testStrm.memList, FALSE));
-			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
-		}
+	destroySchema(&schema);
+}
+END_TEST
 
-		if(senmlData.eArray[e].t != INT_MAX)
-		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_T_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // t=""
-			TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.eArray[e].t));
-		}
+/** The number of the combinations of the options that change the second and third level event codes */
+#define EVENT_CODE_OPTIONS 64
 
-		if(senmlData.eArray[e].u[0] != '\0')
-		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_U_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // u=""
-			TRY_CATCH_ENCODE(asciiToString(senmlData.eArray[e].u, &chVal, &testStrm.memList, FALSE));
-			TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
-		}
+/**
+ * Sets the options of combination c: preserve prefixes (bit 0), DTD (bit 1),
+ * comments (bit 2), PIs (bit 3), self-contained (bit 4) and strict (bit 5)
+ */
+static void setEventCodeOptions(EXIOptions* opts, unsigned int c)
+{
+	makeDefaultOpts(opts);
+	if(c & 1)
+		SET_PRESERVED(opts->preserve, PRESERVE_PREFIXES);
+	if(c & 2)
+		SET_PRESERVED(opts->preserve, PRESERVE_DTD);
+	if(c & 4)
+		SET_PRESERVED(opts->preserve, PRESERVE_COMMENTS);
+	if(c & 8)
+		SET_PRESERVED(opts->preserve, PRESERVE_PIS);
+	if(c & 16)
+		SET_SELF_CONTAINED(opts->enumOpt);
+	if(c & 32)
+		SET_STRICT(opts->enumOpt);
+}
 
-		if(senmlData.eArray[e].ut != INT_MAX)
+/**
+ * The codes of a layout number its events in order and take ceil(log2(count)) bits
+ */
+static void checkEventCodeLayout(const EventCodeLayout* layout, unsigned int c, const char* name)
+{
+	unsigned int bits = 0;
+	unsigned int i;
+	unsigned int count = 0;
+
+	while((1u << bits) < layout->count)
+		bits++;
+	fail_unless(layout->bits == bits, "%s with options %u: %u bits for %u productions", name, c, (unsigned int) layout->bits, (unsigned int) layout->count);
+
+	for(i = 0; i < EVENT_CODE_STATE_COUNT; i++)
+	{
+		if(layout->code[i] == EVENT_CODE_NONE)
+			continue;
+		fail_unless(layout->code[i] == count && layout->state[count] == i, "%s with options %u: event %u has code %u", name, c, i, (unsigned int) layout->code[i]);
+		count++;
+	}
+	fail_unless(count == layout->count, "%s with options %u: %u events for %u productions", name, c, count, (unsigned int) layout->count);
+}
+
+/**
+ * The layouts of the second and third level productions with every combination of the
+ * preserve (prefixes, DTD, comments, PIs), self-contained and strict options have
+ * the event codes of the EXI specification (sections 8.4.3, 8.5.4.4.1 and 8.5.4.4.2)
+ */
+START_TEST (test_event_code_tables)
+{
+	EXIStream strm;
+	const EventCodeLayout* layout;
+	unsigned int c, l;
+	unsigned int ns, dtd, cm, pi, sc, cmPi;
+	unsigned int firstRule, withAT, noEE;
+	unsigned int count;
+
+	for(c = 0; c < EVENT_CODE_OPTIONS; c++)
+	{
+		setEventCodeOptions(&strm.header.opts, c);
+		ns = (c & 1) != 0;
+		dtd = (c & 2) != 0;
+		cm = (c & 4) != 0;
+		pi = (c & 8) != 0;
+		sc = (c & 16) != 0;
+		cmPi = cm || pi;
+
+		setEventCodeTables(&strm);
+
+		// Built-in element grammars: EE, AT(*), NS, SC, SE(*), CH, ER, CM or PI
+		layout = &strm.eventCodes.builtIn[0];
+		checkEventCodeLayout(layout, c, "StartTagContent");
+		fail_unless(layout->count == 4 + ns + sc + dtd + cmPi, "StartTagContent with options %u has %u productions", c, (unsigned int) layout->count);
+		fail_unless(layout->code[0] == 0 && layout->code[1] == 1, "StartTagContent with options %u: EE or AT(*) code", c);
+		fail_unless(layout->code[2] == (ns ? 2 : EVENT_CODE_NONE), "StartTagContent with options %u: NS code", c);
+		fail_unless(layout->code[4] == 2 + ns + sc && layout->code[5] == 3 + ns + sc, "StartTagContent with options %u: SE(*) or CH code", c);
+
+		layout = &strm.eventCodes.builtIn[1];
+		checkEventCodeLayout(layout, c, "ElementContent");
+		fail_unless(layout->count == 2 + dtd + cmPi, "ElementContent with options %u has %u productions", c, (unsigned int) layout->count);
+		fail_unless(layout->code[0] == EVENT_CODE_NONE && layout->code[4] == 0 && layout->code[5] == 1, "ElementContent with options %u: EE, SE(*) or CH code", c);
+
+		// Schema-informed grammars, non-strict mode
+		for(l = 0; l < 8; l++)
 		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_UT_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // ut=""
-			TRY_CATCH_ENCODE(serialize.intData(&testStrm, (Integer) senmlData.eArray[e].ut));
+			layout = &strm.eventCodes.schema[l];
+			firstRule = (l & 4) != 0;
+			withAT = (l & 2) != 0;
+			noEE = (l & 1) != 0;
+			fail_unless(l == EVENT_CODE_SCHEMA_LAYOUT(firstRule, withAT, !noEE), "Schema layout %u", l);
+			checkEventCodeLayout(layout, c, "Schema-informed rule");
+
+			count = 2 + 2*withAT + noEE + firstRule*(2 + ns + sc) + dtd + cmPi;
+			fail_unless(layout->count == count, "Schema layout %u with options %u has %u productions instead of %u", l, c, (unsigned int) layout->count, count);
+			fail_unless(layout->code[0] == (noEE ? 0 : EVENT_CODE_NONE), "Schema layout %u with options %u: EE code", l, c);
+			fail_unless(layout->code[7] == count - 2 - dtd - cmPi && layout->code[8] == count - 1 - dtd - cmPi,
+					"Schema layout %u with options %u: SE(*) or CH code", l, c);
+			if(firstRule)
+			{
+				fail_unless(layout->code[1] == noEE && layout->code[2] == noEE + 1, "Schema layout %u with options %u: AT(xsi:type) or AT(xsi:nil) code", l, c);
+				fail_unless(layout->code[5] == (ns ? noEE + 2 + 2*withAT : EVENT_CODE_NONE), "Schema layout %u with options %u: NS code", l, c);
+			}
+			else
+				fail_unless(layout->code[1] == EVENT_CODE_NONE && layout->code[2] == EVENT_CODE_NONE && layout->code[5] == EVENT_CODE_NONE,
+						"Schema layout %u with options %u: AT(xsi:type), AT(xsi:nil) or NS out of the first rule", l, c);
 		}
 
-		if(senmlData.eArray[e].v.exponent != INT16_MAX)
+		// Schema-informed grammars, strict mode: AT(xsi:type), AT(xsi:nil)
+		for(l = 0; l < 4; l++)
 		{
-			qname.uri = &NS_EMPTY_STR;
-			qname.localName = &ATTR_V_STR;
-			TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // v=""
-			TRY_CATCH_ENCODE(serialize.floatData(&testStrm, senmlData.eArray[e].v));
+			layout = &strm.eventCodes.strict[l];
+			checkEventCodeLayout(layout, c, "Strict first rule");
+			fail_unless(layout->count == (l >> 1) + (l & 1), "Strict layout %u with options %u has %u productions", l, c, (unsigned int) layout->count);
+			fail_unless(layout->code[1] == ((l & 1) ? (l >> 1) : EVENT_CODE_NONE), "Strict layout %u with options %u: AT(xsi:nil) code", l, c);
 		}
 
-		TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </e>
+		// Document grammar: DT and CM or PI in DocContent, CM and PI in the other rules and the third level
+		layout = &strm.eventCodes.document[0];
+		checkEventCodeLayout(layout, c, "DocContent");
+		fail_unless(layout->count == dtd + cmPi, "DocContent with options %u has %u productions", c, (unsigned int) layout->count);
+		layout = &strm.eventCodes.document[1];
+		checkEventCodeLayout(layout, c, "DocEnd");
+		fail_unless(layout->count == cm + pi, "DocEnd with options %u has %u productions", c, (unsigned int) layout->count);
+		fail_unless(layout->code[2] == (pi ? cm : EVENT_CODE_NONE), "DocEnd with options %u: PI code", c);
 	}
-
-	TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </senml>
-
-	TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
-
-	// VI: Free the memory allocated by the EXI stream object
-	TRY_CATCH_ENCODE(serialize.closeEXIStream(&testStrm));
-
-	*size = testStrm.buffer.bufContent;
-
-	return tmp_err_code;
 }
+END_TEST
 
-typedef enum {
-	BN   = 0,
-	BT   = 1,
-	BU   = 2,
-	VER  = 3,
-	BV   = 4,
-	N    = 5,
-	S    = 6,
-	SV   = 7,
-	T    = 8,
-	U    = 9,
-	UT  = 10,
-	V   = 11,
-	NON = 12
-} Attr;
-
-typedef enum {
-	ELEM_SEN_ML = 0,
-	ELEM_E      = 1,
-	ELEM_NON    = 2
-} Elem;
-
-typedef struct
-{
-	senml* data;
-	Attr currAttr;
-	Elem currElem;
-	int eIndex;
-} AppData;
+/**
+ * <root xsi:nil="false" xmlns:p="urn:p"><root/><other xmlns:p="urn:p" at1="" at2="">value</other><other at1="">value</other><other/></root>
+ * with the qnames of HQ_LN_STR as start element (S), attribute (A), characters (C), end element (E),
+ * xsi:nil (X, schema-informed non-strict mode only) and namespace (N, preserved prefixes only) steps.
+ * Most of the events are second level events at their first occurrence.
+ */
+static const char EC_STEPS[] = "S0X0N0S0E0S2N0A1A3C2E2S2A1C2E2S2E2E0";
 
-static errorCode sample_startElement(QName qname, void* app_data);
-static errorCode sample_attribute(QName qname, void* app_data);
-static errorCode sample_stringData(const String value, void* app_data);
-static errorCode sample_floatData(Float fl_val, void* app_data);
-static errorCode sample_booleanData(boolean bool_val, void* app_data);
-static errorCode sample_decimalData(Decimal value, void* app_data);
-static errorCode sample_intData(Integer int_val, void* app_data);
+static const String EC_XSI_NS = {"http://www.w3.org/2001/XMLSchema-instance", 41};
+static const String EC_XSI_NIL = {"nil", 3};
+static const String EC_NS = {"urn:p", 5};
+static const String EC_PFX = {"p", 1};
 
-errorCode decodeSenML(EXIPSchema* schema, char* buf, int buflen, senml* senmlData)
+static errorCode encodeEventCodeDoc(EXIPSchema* schema, EXIOptions* opts, char* buf, int buflen, size_t* size, struct batchTrace* expected)
 {
-	Parser testParser;
-	BinaryBuffer buffer;
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	AppData parsingData;
+	EXIStream testStrm;
+	QName qname = {&NS_EMPTY_STR, NULL, NULL};
+	String chVal = {"value", 5};
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+	unsigned int i, q;
 
 	buffer.buf = buf;
 	buffer.bufLen = buflen;
-	buffer.bufContent = buflen;
-	// Parsing steps:
-
-	// I: First, define an external stream for the input to the parser if any, otherwise set to NULL
+	buffer.bufContent = 0;
 	buffer.ioStrm.readWriteToStream = NULL;
 	buffer.ioStrm.stream = NULL;
+	expected->len = 0;
 
-	parsingData.currElem = ELEM_NON;
-	parsingData.currAttr = NON;
-	parsingData.data = senmlData;
-	parsingData.eIndex = -1;
-	senmlData->eArrayCount = 0;
+	serialize.initHeader(&testStrm);
+	testStrm.header.has_options = TRUE;
+	testStrm.header.opts = *opts;
+	TRY_CATCH_ENCODE(serialize.initStream(&testStrm, buffer, schema));
+	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+
+	for(i = 0; EC_STEPS[i] != '\0'; i += 2)
+	{
+		q = EC_STEPS[i + 1] - '0';
+		qname.uri = &NS_EMPTY_STR;
+		qname.localName = &HQ_LN_STR[q];
+
+		switch(EC_STEPS[i])
+		{
+			case 'S':
+				TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType));
+				traceLine(expected, "SE", qname.uri, qname.localName);
+			break;
+			case 'A':
+				TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType));
+				TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+				traceLine(expected, "AT", qname.uri, qname.localName);
+				traceLine(expected, "STR", &chVal, NULL);
+			break;
+			case 'C':
+				TRY_CATCH_ENCODE(serialize.stringData(&testStrm, chVal));
+				traceLine(expected, "STR", &chVal, NULL);
+			break;
+			case 'X':
+				if(schema != NULL && !WITH_STRICT(opts->enumOpt))
+				{
+					qname.uri = &EC_XSI_NS;
+					qname.localName = &EC_XSI_NIL;
+					TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType));
+					TRY_CATCH_ENCODE(serialize.booleanData(&testStrm, FALSE));
+					traceLine(expected, "AT", qname.uri, qname.localName);
+					traceLine(expected, "FALSE", NULL, NULL);
+				}
+			break;
+			case 'N':
+				if(IS_PRESERVED(opts->preserve, PRESERVE_PREFIXES))
+					TRY_CATCH_ENCODE(serialize.namespaceDeclaration(&testStrm, EC_NS, EC_PFX, FALSE));
+			break;
+			default:
+				TRY_CATCH_ENCODE(serialize.endElement(&testStrm));
+				traceLine(expected, "EE", NULL, NULL);
+		}
+	}
+	TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
+	traceLine(expected, "ED", NULL, NULL);
 
-	// II: Second, initialize the parser object
-	TRY(initParser(&testParser, buffer, &parsingData));
+	*size = testStrm.context.bufferIndx + (testStrm.context.bitPointer != 0);
 
-	// III: Initialize the parsing data and hook the callback handlers to the parser object.
-	//      If out-of-band options are defined use testParser.strm.header.opts to set them
+	return serialize.closeEXIStream(&testStrm);
+}
 
-	testParser.handler.startElement = sample_startElement;
-	testParser.handler.attribute = sample_attribute;
-	testParser.handler.stringData = sample_stringData;
-	testParser.handler.floatData = sample_floatData;
-	testParser.handler.booleanData = sample_booleanData;
-	testParser.handler.decimalData = sample_decimalData;
-	testParser.handler.intData = sample_intData;
+/**
+ * Encodes and decodes a document with second level events (EC_STEPS) with every combination
+ * of the preserve (prefixes, DTD, comments, PIs) and self-contained options, in schema-less
+ * and schema mode, and in strict mode (that excludes the other options)
+ */
+START_TEST (test_event_code_options)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char buf[OUTPUT_BUFFER_SIZE];
+	char* schemafname[1] = {"Profile/input/localValTbl/indexed-schema-xsd.exi"};
+	static struct batchTrace expected;
+	static struct batchTrace trace;
+	EXIPSchema schema;
+	EXIPSchema* schemaPtr;
+	EXIOptions opts;
+	size_t size = 0;
+	unsigned int c, m;
 
-	// IV: Parse the header of the stream
+	parseSchema(schemafname, 1, &schema);
 
-	TRY(parseHeader(&testParser, FALSE));
+	for(m = 0; m < 2; m++)
+	{
+		schemaPtr = m == 0 ? NULL : &schema;
+		for(c = 0; c <= 32; c++)
+		{
+			setEventCodeOptions(&opts, c);
 
-	// IV.1: Set the schema to be used for parsing.
-	// The schemaID mode and schemaID field can be read at
-	// parser.strm.header.opts.schemaIDMode and
-	// parser.strm.header.opts.schemaID respectively
-	// If schemaless mode, use setSchema(&parser, NULL);
+			tmp_err_code = encodeEventCodeDoc(schemaPtr, &opts, buf, OUTPUT_BUFFER_SIZE, &size, &expected);
+			fail_unless(tmp_err_code == EXIP_OK, "Encoding with options %u (schema %u) returns an error code %d", c, m, tmp_err_code);
 
-	TRY(setSchema(&testParser, schema));
+			tmp_err_code = traceParseNext(schemaPtr, buf, size, &trace);
+			fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "Decoding with options %u (schema %u) returns an error code %d", c, m, tmp_err_code);
+			fail_unless(trace.len == expected.len && memcmp(trace.buf, expected.buf, trace.len) == 0,
+					"Decoding with options %u (schema %u) returns other events:\n%.*s", c, m, (int) trace.len, trace.buf);
+		}
+	}
 
-	// V: Parse the body of the EXI stream
+	destroySchema(&schema);
+}
+END_TEST
 
-	while(tmp_err_code == EXIP_OK)
+/**
+ * Checks that the tables of a schema loaded from its image are the ones of the schema
+ */
+/** Whether the productions are the same, whatever the padding of their structure */
+static boolean sameProductions(const Production* prod, const Production* other, ProdCount pCount)
+{
+	ProdCount p;
+
+	for(p = 0; p < pCount; p++)
 	{
-		tmp_err_code = parseNext(&testParser);
+		if(prod[p].content != other[p].content || GET_PROD_TYPE_ID(&prod[p]) != GET_PROD_TYPE_ID(&other[p]) ||
+				GET_PROD_URI_ID(&prod[p]) != GET_PROD_URI_ID(&other[p]) || GET_PROD_LN_ID(&prod[p]) != GET_PROD_LN_ID(&other[p]))
+			return FALSE;
 	}
 
-	// VI: Free the memory allocated by the parser
-
-	destroyParser(&testParser);
-
-	if(tmp_err_code == EXIP_PARSING_COMPLETE)
-		return EXIP_OK;
-	else
-		return tmp_err_code;
+	return TRUE;
 }
 
-static errorCode sample_startElement(QName qname, void* app_data)
+static void checkImageSchema(EXIPSchema* schema, EXIPSchema* loaded, const char* name)
 {
-	AppData* appD = (AppData*) app_data;
+	EXIGrammar* grammar;
+	EXIGrammar* loadedGrammar;
+	EnumDefinition* enumDef;
+	EnumDefinition* loadedEnumDef;
+	UriEntry* uriEntry;
+	UriEntry* loadedUriEntry;
+	Index g, i, j;
+
+	fail_unless(loaded->uriTable.count == schema->uriTable.count, "%s: %u URIs", name, (unsigned int) loaded->uriTable.count);
+	for(i = 0; i < schema->uriTable.count; i++)
+	{
+		uriEntry = &schema->uriTable.uri[i];
+		loadedUriEntry = &loaded->uriTable.uri[i];
+		fail_unless(stringEqual(loadedUriEntry->uriStr, uriEntry->uriStr), "%s: URI %u", name, (unsigned int) i);
+		fail_unless(loadedUriEntry->lnTable.count == uriEntry->lnTable.count && loadedUriEntry->pfxTable.count == uriEntry->pfxTable.count,
+				"%s: the local names or prefixes of URI %u", name, (unsigned int) i);
+		for(j = 0; j < uriEntry->lnTable.count; j++)
+		{
+			fail_unless(stringEqual(loadedUriEntry->lnTable.ln[j].lnStr, uriEntry->lnTable.ln[j].lnStr) &&
+					loadedUriEntry->lnTable.ln[j].elemGrammar == uriEntry->lnTable.ln[j].elemGrammar &&
+					loadedUriEntry->lnTable.ln[j].typeGrammar == uriEntry->lnTable.ln[j].typeGrammar,
+					"%s: local name %u of URI %u", name, (unsigned int) j, (unsigned int) i);
+		}
+		for(j = 0; j < uriEntry->pfxTable.count; j++)
+			fail_unless(stringEqual(loadedUriEntry->pfxTable.pfx[j], uriEntry->pfxTable.pfx[j]), "%s: prefix %u of URI %u", name, (unsigned int) j, (unsigned int) i);
+	}
 
-	if(appD->currElem == ELEM_NON)
+	fail_unless(loaded->grammarTable.count == schema->grammarTable.count && loaded->staticGrCount == schema->staticGrCount,
+			"%s: %u grammars", name, (unsigned int) loaded->grammarTable.count);
+	for(g = 0; g <= schema->grammarTable.count; g++)
 	{
-		// must senml
-		if(stringCompare(*qname.uri, NS_SENML_STR) == 0 && stringCompare(*qname.localName, ELEM_SENML_STR) == 0)
+		// The document grammar and then the ones of the grammarTable
+		grammar = g == 0 ? &schema->docGrammar : &schema->grammarTable.grammar[g - 1];
+		loadedGrammar = g == 0 ? &loaded->docGrammar : &loaded->grammarTable.grammar[g - 1];
+		fail_unless(loadedGrammar->count == grammar->count && loadedGrammar->props == grammar->props, "%s: grammar %u", name, (unsigned int) g);
+		for(i = 0; i < grammar->count; i++)
 		{
-			appD->currElem = ELEM_SEN_ML;
+			fail_unless(loadedGrammar->rule[i].pCount == grammar->rule[i].pCount && loadedGrammar->rule[i].meta == grammar->rule[i].meta &&
+					memcmp(loadedGrammar->rule[i].codeBits, grammar->rule[i].codeBits, 2) == 0 &&
+					sameProductions(loadedGrammar->rule[i].production, grammar->rule[i].production, grammar->rule[i].pCount),
+					"%s: rule %u of grammar %u", name, (unsigned int) i, (unsigned int) g);
 		}
-		else
-			return EXIP_HANDLER_STOP;
 	}
-	else if (appD->currElem == ELEM_SEN_ML)
+
+	fail_unless(loaded->simpleTypeTable.count == schema->simpleTypeTable.count &&
+			memcmp(loaded->simpleTypeTable.sType, schema->simpleTypeTable.sType, sizeof(SimpleType)*schema->simpleTypeTable.count) == 0,
+			"%s: the simple types", name);
+
+	fail_unless(loaded->enumTable.count == schema->enumTable.count, "%s: %u enumerations", name, (unsigned int) loaded->enumTable.count);
+	for(i = 0; i < schema->enumTable.count; i++)
 	{
-		// must e
-		if(stringCompare(*qname.uri, NS_SENML_STR) == 0 && stringCompare(*qname.localName, ELEM_E_STR) == 0)
+		enumDef = &schema->enumTable.enumDef[i];
+		loadedEnumDef = &loaded->enumTable.enumDef[i];
+		fail_unless(loadedEnumDef->typeId == enumDef->typeId && loadedEnumDef->count == enumDef->count, "%s: enumeration %u", name, (unsigned int) i);
+		for(j = 0; j < enumDef->count; j++)
 		{
-			appD->currElem = ELEM_E;
+			if(GET_EXI_TYPE(schema->simpleTypeTable.sType[enumDef->typeId].content) == VALUE_TYPE_STRING)
+				fail_unless(stringEqual(((String*) loadedEnumDef->values)[j], ((String*) enumDef->values)[j]), "%s: value %u of enumeration %u", name, (unsigned int) j, (unsigned int) i);
+			else
+				fail_unless(((UnsignedInteger*) loadedEnumDef->values)[j] == ((UnsignedInteger*) enumDef->values)[j], "%s: value %u of enumeration %u", name, (unsigned int) j, (unsigned int) i);
 		}
-		else
-			return EXIP_HANDLER_STOP;
+	}
+}
+
+#define E_ELEM_COUNT_IMAGE 20
+
+/**
+ * The schemas loaded from their images have the tables of the generated schemas. A SenML
+ * document encoded with the schema loaded from an image mapped read-only from a file is the
+ * same as with the generated schema and is decoded to the same events. The images of other
+ * versions or configurations and the truncated images are rejected
+ */
+START_TEST (test_schema_image)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	static char buf[OUTPUT_BUFFER_SIZE_BATCH];
+	static char bufImage[OUTPUT_BUFFER_SIZE_BATCH];
+	static senml_elem eArr[E_ELEM_COUNT_IMAGE];
+	static struct batchTrace expected;
+	static struct batchTrace trace;
+	char* schemafname[2][1] = {{"exip/SenML-xsd.exi"}, {"SchemaStrict/lkab-devices-xsd.exi"}};
+	EXIPSchema schema;
+	EXIPSchema loaded;
+	unsigned char* image;
+	unsigned char* other;
+	Production* prod;
+	size_t prodOffset;
+	uint32_t uriChars[2];
+	size_t strOffset;
+	Index length;
+	size_t size = 0;
+	size_t small;
+	size_t exiSize = 0;
+	size_t exiSizeImage = 0;
+	senml senML_instance;
+	unsigned int s;
+	int i;
 
+	for(s = 2; s > 0; s--)
+	{
+		parseSchema(schemafname[s - 1], 1, &schema);
+
+		tmp_err_code = writeSchemaImage(&schema, NULL, &size);
+		fail_unless(tmp_err_code == EXIP_OK && size > 0, "writeSchemaImage() returns an error code %d", tmp_err_code);
+		image = (unsigned char*) malloc(size);
+		fail_unless(image != NULL, "Memory allocation error");
+
+		small = size - 1;
+		tmp_err_code = writeSchemaImage(&schema, image, &small);
+		fail_unless(tmp_err_code == EXIP_OUT_OF_BOUND_BUFFER, "writeSchemaImage() to a small buffer returns an error code %d", tmp_err_code);
+		memset(image, 0xAA, size);
+		tmp_err_code = writeSchemaImage(&schema, image, &size);
+		fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+
+		// The padding of the records is zeroed: the images do not depend on the buffer
+		other = (unsigned char*) malloc(size);
+		fail_unless(other != NULL, "Memory allocation error");
+		memset(other, 0x55, size);
+		tmp_err_code = writeSchemaImage(&schema, other, &size);
+		fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+		fail_unless(memcmp(image, other, size) == 0, "%s: the images of the schema differ", schemafname[s - 1][0]);
+		free(other);
+
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_OK, "loadSchemaImage() returns an error code %d", tmp_err_code);
+		checkImageSchema(&schema, &loaded, schemafname[s - 1][0]);
+#if PRODUCTION_INDEX_USE
+		fail_unless(loaded.prodIndex.size == 0 || ((unsigned char*) loaded.prodIndex.slot >= image && (unsigned char*) loaded.prodIndex.slot < image + size),
+				"%s: the production index is not used in place", schemafname[s - 1][0]);
+#endif
+		// The first production of the last grammar and the offset and size of the
+		// characters of a URI, to corrupt them
+		prod = loaded.grammarTable.grammar[loaded.grammarTable.count - 1].rule[0].production;
+		prodOffset = (size_t) ((unsigned char*) prod - image);
+		uriChars[0] = (uint32_t) ((unsigned char*) loaded.uriTable.uri[1].uriStr.str - image);
+		uriChars[1] = (uint32_t) loaded.uriTable.uri[1].uriStr.length;
+		unloadSchemaImage(&loaded);
+
+		prod = (Production*) (image + prodOffset);
+		SET_PROD_NON_TERM(prod->content, schema.grammarTable.grammar[schema.grammarTable.count - 1].count);
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Loading an image with a non-terminal out of range returns an error code %d", tmp_err_code);
+		prod->content = schema.grammarTable.grammar[schema.grammarTable.count - 1].rule[0].production[0].content;
+		SET_PROD_EXI_EVENT(prod->content, EVENT_SE_QNAME);
+		SET_PROD_TYPE_ID(prod, schema.grammarTable.count);
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Loading an image with a grammar out of range returns an error code %d", tmp_err_code);
+		tmp_err_code = writeSchemaImage(&schema, image, &size);
+		fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+
+		// The string record of the URI: its offset and size are followed by its length
+		for(strOffset = sizeof(uint32_t); strOffset + sizeof(uriChars) + sizeof(Index) <= size &&
+				memcmp(image + strOffset, uriChars, sizeof(uriChars)) != 0; strOffset += sizeof(uint32_t));
+		fail_unless(strOffset + sizeof(uriChars) + sizeof(Index) <= size, "%s: the record of a URI is not found", schemafname[s - 1][0]);
+		memcpy(&length, image + strOffset + sizeof(uriChars), sizeof(Index));
+		fail_unless(length == uriChars[1], "%s: the record of a URI has a length %u", schemafname[s - 1][0], (unsigned int) length);
+		length = uriChars[1] + 1;
+		memcpy(image + strOffset + sizeof(uriChars), &length, sizeof(Index));
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Loading an image with a string longer than its characters returns an error code %d", tmp_err_code);
+		length = uriChars[1] - 1;
+		memcpy(image + strOffset + sizeof(uriChars), &length, sizeof(Index));
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Loading an image with a string shorter than its characters returns an error code %d", tmp_err_code);
+		length = uriChars[1];
+		memcpy(image + strOffset + sizeof(uriChars), &length, sizeof(Index));
+
+		tmp_err_code = loadSchemaImage(image, size - 1, &loaded);
+		fail_unless(tmp_err_code == EXIP_OUT_OF_BOUND_BUFFER, "Loading a truncated image returns an error code %d", tmp_err_code);
+		image[4] += 1;
+		tmp_err_code = loadSchemaImage(image, size, &loaded);
+		fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Loading an image of another version returns an error code %d", tmp_err_code);
+		image[4] -= 1;
+
+		if(s > 1)
+		{
+			free(image);
+			destroySchema(&schema);
+		}
 	}
 
-	if (appD->currElem == ELEM_E)
+	// SenML: the image is loaded from memory on the platforms without mmap()
+#ifndef _MSC_VER
 	{
-		appD->data->eArrayCount += 1;
-		if(appD->data->eArrayCount > appD->data->eArraySize)
-			return EXIP_HANDLER_STOP;
+		FILE* imageFile = tmpfile();
+		void* mapping;
+
+		fail_unless(imageFile != NULL && fwrite(image, 1, size, imageFile) == size && fflush(imageFile) == 0, "Unable to write the image file");
+		mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(imageFile), 0);
+		fail_unless(mapping != MAP_FAILED, "Unable to map the image file");
+		fclose(imageFile);
+		free(image);
+		image = (unsigned char*) mapping;
+	}
+#endif
+	tmp_err_code = loadSchemaImage(image, size, &loaded);
+	fail_unless(tmp_err_code == EXIP_OK, "loadSchemaImage() returns an error code %d", tmp_err_code);
 
-		appD->eIndex += 1;
+	strcpy(senML_instance.bn, "urn:dev:mac:0024befffe804ff1");
+	senML_instance.bt = 1415355691;
+	senML_instance.version = 1;
+	strcpy(senML_instance.bu, "Cel");
+	senML_instance.eArrayCount = E_ELEM_COUNT_IMAGE;
+	senML_instance.eArraySize = E_ELEM_COUNT_IMAGE;
+	senML_instance.eArray = eArr;
+
+	for(i = 0; i < E_ELEM_COUNT_IMAGE; i++)
+	{
+		sprintf(eArr[i].n, "sensor%d", i % 7);
+		strcpy(eArr[i].u, i % 2 == 0 ? "Cel" : "%");
+		eArr[i].v.mantissa = 37*i - 500;
+		eArr[i].v.exponent = i % 5 - 2;
+		eArr[i].bv = i % 3;
+		eArr[i].s.mantissa = 10*i + 7;
+		eArr[i].s.exponent = i % 2 == 0 ? -2 : INT16_MAX;
+		sprintf(eArr[i].sv, "state %d", i % 4);
+		eArr[i].t = i % 4 == 0 ? INT_MAX : -i;
+		eArr[i].ut = 60;
 	}
 
-	return EXIP_OK;
+	tmp_err_code = encodeSenML(&schema, senML_instance, NULL, buf, OUTPUT_BUFFER_SIZE_BATCH, &exiSize);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of EXI SenML stream");
+	tmp_err_code = encodeSenML(&loaded, senML_instance, NULL, bufImage, OUTPUT_BUFFER_SIZE_BATCH, &exiSizeImage);
+	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of EXI SenML stream with the schema image");
+	fail_unless(exiSize == exiSizeImage && memcmp(buf, bufImage, exiSize) == 0, "The SenML streams encoded with the schema image differ");
+
+	tmp_err_code = traceParseNext(&schema, buf, exiSize, &expected);
+	fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNext() returns an error code %d", tmp_err_code);
+	tmp_err_code = traceParseNext(&loaded, buf, exiSize, &trace);
+	fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNext() with the schema image returns an error code %d", tmp_err_code);
+	fail_unless(trace.len == expected.len && memcmp(trace.buf, expected.buf, trace.len) == 0, "The events decoded with the schema image differ");
+
+	unloadSchemaImage(&loaded);
+#ifndef _MSC_VER
+	munmap(image, size);
+#else
+	free(image);
+#endif
+	destroySchema(&schema);
 }
+END_TEST
 
-static errorCode sample_attribute(QName qname, void* app_data)
+#if STRING_TABLE_INDEX_USE
+/**
+ * The indexes of the string tables are built with the schema and shared by its streams
+ * until a stream adds an entry to its copy of a table
+ */
+START_TEST (test_schema_name_indexes)
 {
-	AppData* appD = (AppData*) app_data;
-
-	// must have empty namespace
-	if(stringCompare(*qname.uri, NS_EMPTY_STR) != 0)
-		return EXIP_HANDLER_STOP;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char* schemafname[1] = {"SchemaStrict/lkab-devices-xsd.exi"};
+	char buf[2][OUTPUT_BUFFER_SIZE];
+	EXIPSchema schema;
+	EXIStream strm[2];
+	BinaryBuffer buffer;
+	LnTable* lnTable;
+	NameIndex* schemaIndex;
+	String newLn = {"notInTheSchema", 14};
+	SmallIndex u;
+	Index lnId;
+	int s;
 
-	if(appD->currElem == ELEM_SEN_ML)
+	parseSchema(schemafname, 1, &schema);
+	for(u = 0; u < schema.uriTable.count; u++)
 	{
-		if(stringCompare(*qname.localName, ATTR_BN_STR) == 0)
-			appD->currAttr = BN;
-		else if(stringCompare(*qname.localName, ATTR_BT_STR) == 0)
-			appD->currAttr = BT;
-		else if(stringCompare(*qname.localName, ATTR_BU_STR) == 0)
-			appD->currAttr = BU;
-		else if(stringCompare(*qname.localName, ATTR_VER_STR) == 0)
-			appD->currAttr = VER;
+		if(schema.uriTable.uri[u].lnTable.count >= STRING_TABLE_INDEX_THRESHOLD)
+			break;
 	}
-	else if(appD->currElem == ELEM_E)
+	fail_unless(u < schema.uriTable.count, "The schema has no local-name table to index");
+	schemaIndex = schema.uriTable.uri[u].lnTable.index;
+	fail_unless(schemaIndex != NULL && schemaIndex->shared && schemaIndex->count == schema.uriTable.uri[u].lnTable.count,
+			"The index of the local names of the schema is not built");
+
+	for(s = 0; s < 2; s++)
 	{
-		if(stringCompare(*qname.localName, ATTR_N_STR) == 0)
-			appD->currAttr = N;
-		else if(stringCompare(*qname.localName, ATTR_U_STR) == 0)
-			appD->currAttr = U;
-		else if(stringCompare(*qname.localName, ATTR_V_STR) == 0)
-			appD->currAttr = V;
-		else if(stringCompare(*qname.localName, ATTR_SV_STR) == 0)
-			appD->currAttr = SV;
-		else if(stringCompare(*qname.localName, ATTR_BV_STR) == 0)
-			appD->currAttr = BV;
-		else if(stringCompare(*qname.localName, ATTR_S_STR) == 0)
-			appD->currAttr = S;
-		else if(stringCompare(*qname.localName, ATTR_T_STR) == 0)
-			appD->currAttr = T;
-		else if(stringCompare(*qname.localName, ATTR_UT_STR) == 0)
-			appD->currAttr = UT;
+		buffer.buf = buf[s];
+		buffer.bufLen = OUTPUT_BUFFER_SIZE;
+		buffer.bufContent = 0;
+		buffer.ioStrm.readWriteToStream = NULL;
+		buffer.ioStrm.stream = NULL;
+		serialize.initHeader(&strm[s]);
+		tmp_err_code = serialize.initStream(&strm[s], buffer, &schema);
+		fail_unless(tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
+
+		lnTable = &strm[s].uriTable.uri[u].lnTable;
+		fail_unless(lookupLn(lnTable, schema.uriTable.uri[u].lnTable.ln[lnTable->count - 1].lnStr, &lnId) && lnId == lnTable->count - 1,
+				"The local name is not found");
+		fail_unless(lnTable->index == schemaIndex, "The stream does not use the index of the schema");
 	}
-	else
-		return EXIP_HANDLER_STOP;
 
-	return EXIP_OK;
+	// The stream with its own copy of the local names indexes them itself
+	tmp_err_code = ownLnTable(&strm[0], u);
+	tmp_err_code += addLnEntry(&strm[0].uriTable.uri[u].lnTable, newLn, &lnId);
+	fail_unless(tmp_err_code == EXIP_OK, "Adding a local name returns an error code %d", tmp_err_code);
+	fail_unless(lookupLn(&strm[0].uriTable.uri[u].lnTable, newLn, &lnId) && strm[0].uriTable.uri[u].lnTable.index != schemaIndex,
+			"The local name added by the stream is not indexed");
+	fail_if(lookupLn(&strm[1].uriTable.uri[u].lnTable, newLn, &lnId), "The local name added by a stream is found by another one");
+	fail_unless(schemaIndex->count == schema.uriTable.uri[u].lnTable.count, "The index of the schema is changed by a stream");
+
+	for(s = 0; s < 2; s++)
+		serialize.closeEXIStream(&strm[s]);
+	destroySchema(&schema);
 }
+END_TEST
+#endif
 
-static errorCode sample_stringData(const String value, void* app_data)
+#define OUTPUT_BUFFER_SIZE_REGISTRY 200
+
+static const String REG_SENML_ID = {"urn:ietf:params:xml:ns:senml", 28};
+static const String REG_LKAB_ID[3] = {{"lkab:1", 6}, {"lkab:2", 6}, {"lkab:3", 6}};
+static const String REG_DEV_STR = {"urn:dev:registry", 16};
+static const String REG_SENSOR_STR = {"temperature", 11};
+
+/** A schema image that counts its loads and unloads by a registry */
+struct countedImage
 {
-	AppData* appD = (AppData*) app_data;
+	const void* image;
+	size_t size;
+	unsigned int loads;
+	unsigned int unloads;
+};
 
-	switch(appD->currAttr)
+static errorCode countedLoad(void* data, EXIPSchema* schema)
+{
+	struct countedImage* img = (struct countedImage*) data;
+
+	img->loads++;
+	return loadSchemaImage(img->image, img->size, schema);
+}
+
+static void countedUnload(void* data, EXIPSchema* schema)
+{
+	struct countedImage* img = (struct countedImage*) data;
+
+	img->unloads++;
+	unloadSchemaImage(schema);
+}
+
+static errorCode registerCountedImage(SchemaRegistry* registry, const String* schemaId, struct countedImage* img)
+{
+	SchemaSource source;
+
+	source.load = countedLoad;
+	source.unload = countedUnload;
+	source.destroy = NULL;
+	source.data = img;
+	img->loads = 0;
+	img->unloads = 0;
+
+	return registerSchemaSource(registry, schemaId, source);
+}
+
+/**
+ * Encodes <senml bn="urn:dev:registry" bt="1415355691"><e n="temperature"/></senml>
+ * with the schema of schemaId in registry or, when registry is NULL,
+ * with schema and the schemaId option set to schemaId
+ */
+static errorCode encodeRegistryDoc(SchemaRegistry* registry, EXIPSchema* schema, const String* schemaId, char* buf, int buflen, size_t* size)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	EXIStream testStrm;
+	QName qname;
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+
+	buffer.buf = buf;
+	buffer.bufLen = buflen;
+	buffer.bufContent = buflen;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	serialize.initHeader(&testStrm);
+	if(registry != NULL)
 	{
-		case BN:
-			if(value.length < BN_STR_SIZE)
-			{
-				memcpy(appD->data->bn, value.str, value.length);
-				appD->data->bn[value.length] = '\0';
-			}
-			else
-				return EXIP_HANDLER_STOP;
-		break;
-		case BU:
-			if(value.length < ALL_STR_SIZE)
-			{
-				memcpy(appD->data->bu, value.str, value.length);
-				appD->data->bu[value.length] = '\0';
-			}
-			else
-				return EXIP_HANDLER_STOP;
-		break;
-		case N:
-			if(value.length < ALL_STR_SIZE)
-			{
-				memcpy(appD->data->eArray[appD->eIndex].n, value.str, value.length);
-				appD->data->eArray[appD->eIndex].n[value.length] = '\0';
-			}
-			else
-				return EXIP_HANDLER_STOP;
-		break;
-		case U:
-			if(value.length < ALL_STR_SIZE)
-			{
-				memcpy(appD->data->eArray[appD->eIndex].u, value.str, value.length);
-				appD->data->eArray[appD->eIndex].u[value.length] = '\0';
-			}
-			else
-				return EXIP_HANDLER_STOP;
-		break;
-		case SV:
-			if(value.length < ALL_STR_SIZE)
-			{
-				memcpy(appD->data->eArray[appD->eIndex].sv, value.str, value.length);
-				appD->data->eArray[appD->eIndex].sv[value.length] = '\0';
-			}
-			else
-				return EXIP_HANDLER_STOP;
-		break;
-		default:
-			return EXIP_HANDLER_STOP;
+		TRY(serialize.initStreamSchemaId(&testStrm, buffer, registry, schemaId));
+	}
+	else
+	{
+		testStrm.header.has_options = TRUE;
+		testStrm.header.opts.schemaIDMode = SCHEMA_ID_SET;
+		testStrm.header.opts.schemaID = *schemaId;
+		TRY(serialize.initStream(&testStrm, buffer, schema));
+	}
+
+	TRY_CATCH_ENCODE(serialize.exiHeader(&testStrm));
+	TRY_CATCH_ENCODE(serialize.startDocument(&testStrm));
+	qname.uri = &NS_SENML_STR;
+	qname.localName = &ELEM_SENML_STR;
+	qname.prefix = NULL;
+	TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <senml>
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_BN_STR;
+	TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bn=""
+	TRY_CATCH_ENCODE(serialize.stringData(&testStrm, REG_DEV_STR));
+	qname.localName = &ATTR_BT_STR;
+	TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // bt=""
+	TRY_CATCH_ENCODE(serialize.intData(&testStrm, 1415355691));
+	qname.uri = &NS_SENML_STR;
+	qname.localName = &ELEM_E_STR;
+	TRY_CATCH_ENCODE(serialize.startElement(&testStrm, qname, &valueType)); // <e>
+	qname.uri = &NS_EMPTY_STR;
+	qname.localName = &ATTR_N_STR;
+	TRY_CATCH_ENCODE(serialize.attribute(&testStrm, qname, TRUE, &valueType)); // n=""
+	TRY_CATCH_ENCODE(serialize.stringData(&testStrm, REG_SENSOR_STR));
+	TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </e>
+	TRY_CATCH_ENCODE(serialize.endElement(&testStrm)); // </senml>
+	TRY_CATCH_ENCODE(serialize.endDocument(&testStrm));
+	TRY_CATCH_ENCODE(serialize.closeEXIStream(&testStrm));
+
+	*size = testStrm.buffer.bufContent;
+
+	return tmp_err_code;
+}
+
+/**
+ * Binds the schemas of the schemaId in the header through a registry: the SenML schema
+ * generated from its definitions and the lkab-devices one loaded from an image.
+ * Checks the sharing, the reference counting by the streams and the LRU unloading
+ */
+START_TEST (test_schema_registry)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char buf[OUTPUT_BUFFER_SIZE_REGISTRY];
+	char bufRegistry[OUTPUT_BUFFER_SIZE_REGISTRY];
+	static struct batchTrace expected;
+	static struct batchTrace trace;
+	char* senmlfname[1] = {"exip/SenML-xsd.exi"};
+	char* lkabfname[1] = {"SchemaStrict/lkab-devices-xsd.exi"};
+	struct countedImage lkab[3];
+	EXIPSchema senml;
+	EXIPSchema lkabSchema;
+	EXIPSchema* acquired;
+	EXIPSchema* acquiredAgain;
+	SchemaRegistry* registry;
+	BinaryBuffer xsd;
+	FILE* xsdFile;
+	char xsdPath[MAX_PATH_LEN];
+	void* image;
+	size_t imageSize = 0;
+	size_t exiSize = 0;
+	size_t exiSizeRegistry = 0;
+	size_t lkabMem;
+	unsigned int i;
+
+	parseSchema(senmlfname, 1, &senml);
+	parseSchema(lkabfname, 1, &lkabSchema);
+	tmp_err_code = writeSchemaImage(&lkabSchema, NULL, &imageSize);
+	fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+	image = malloc(imageSize);
+	fail_unless(image != NULL, "Memory allocation error");
+	tmp_err_code = writeSchemaImage(&lkabSchema, image, &imageSize);
+	fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+	destroySchema(&lkabSchema);
+
+	snprintf(xsdPath, MAX_PATH_LEN, "%s/%s", dataDir, senmlfname[0]);
+	xsdFile = fopen(xsdPath, "rb");
+	fail_unless(xsdFile != NULL, "Unable to open file %s", xsdPath);
+	fseek(xsdFile, 0, SEEK_END);
+	xsd.bufLen = ftell(xsdFile);
+	fseek(xsdFile, 0, SEEK_SET);
+	xsd.buf = (char*) malloc(xsd.bufLen);
+	fail_unless(xsd.buf != NULL && fread(xsd.buf, 1, xsd.bufLen, xsdFile) == xsd.bufLen, "Unable to read file %s", xsdPath);
+	fclose(xsdFile);
+	xsd.bufContent = xsd.bufLen;
+	xsd.ioStrm.readWriteToStream = NULL;
+	xsd.ioStrm.stream = NULL;
+
+	tmp_err_code = createSchemaRegistry((size_t) -1, &registry);
+	fail_unless(tmp_err_code == EXIP_OK, "createSchemaRegistry() returns an error code %d", tmp_err_code);
+	tmp_err_code = registerSchemaDefinitions(registry, &REG_SENML_ID, &xsd, 1, SCHEMA_FORMAT_XSD_EXI, NULL, NULL);
+	fail_unless(tmp_err_code == EXIP_OK, "registerSchemaDefinitions() returns an error code %d", tmp_err_code);
+	// The definitions are copied
+	free(xsd.buf);
+	for(i = 0; i < 3; i++)
+		lkab[i].image = image;
+	lkab[0].size = imageSize;
+	tmp_err_code = registerCountedImage(registry, &REG_LKAB_ID[0], &lkab[0]);
+	fail_unless(tmp_err_code == EXIP_OK, "registerSchemaSource() returns an error code %d", tmp_err_code);
+	tmp_err_code = registerSchemaImage(registry, &REG_LKAB_ID[0], image, imageSize);
+	fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Registering a schemaId twice returns an error code %d", tmp_err_code);
+
+	// The stream of the registry is the one encoded with the schema and the schemaId option
+	tmp_err_code = encodeRegistryDoc(NULL, &senml, &REG_SENML_ID, buf, OUTPUT_BUFFER_SIZE_REGISTRY, &exiSize);
+	fail_unless(tmp_err_code == EXIP_OK, "The encoding with the schemaId option returns an error code %d", tmp_err_code);
+	tmp_err_code = encodeRegistryDoc(registry, NULL, &REG_SENML_ID, bufRegistry, OUTPUT_BUFFER_SIZE_REGISTRY, &exiSizeRegistry);
+	fail_unless(tmp_err_code == EXIP_OK, "initStreamSchemaId() encoding returns an error code %d", tmp_err_code);
+	fail_unless(exiSize == exiSizeRegistry && memcmp(buf, bufRegistry, exiSize) == 0, "The stream encoded with initStreamSchemaId() differs");
+	tmp_err_code = encodeRegistryDoc(registry, NULL, &REG_LKAB_ID[1], bufRegistry, OUTPUT_BUFFER_SIZE_REGISTRY, &exiSizeRegistry);
+	fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "initStreamSchemaId() of an unknown schemaId returns an error code %d", tmp_err_code);
+
+	tmp_err_code = traceParseNext(&senml, buf, exiSize, &expected);
+	fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNext() returns an error code %d", tmp_err_code);
+	tmp_err_code = traceParse(NULL, registry, buf, exiSize, &trace);
+	fail_unless(tmp_err_code == EXIP_PARSING_COMPLETE, "parseNext() with the schema of the registry returns an error code %d", tmp_err_code);
+	fail_unless(trace.len == expected.len && memcmp(trace.buf, expected.buf, trace.len) == 0, "The events decoded with the schema of the registry differ");
+
+	// A schema is generated once and shared
+	tmp_err_code = acquireSchema(registry, &REG_SENML_ID, &acquired);
+	fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() returns an error code %d", tmp_err_code);
+	tmp_err_code = acquireSchema(registry, &REG_SENML_ID, &acquiredAgain);
+	fail_unless(tmp_err_code == EXIP_OK && acquired == acquiredAgain, "acquireSchema() returns another schema");
+	releaseSchema(registry, acquired);
+	releaseSchema(registry, acquiredAgain);
+
+	// Within the budget the released schemas stay loaded
+	lkabMem = getSchemaRegistryMemory(registry);
+	for(i = 0; i < 2; i++)
+	{
+		tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[0], &acquired);
+		fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() of an image returns an error code %d", tmp_err_code);
+		releaseSchema(registry, acquired);
 	}
-
-	return EXIP_OK;
+	fail_unless(lkab[0].loads == 1 && lkab[0].unloads == 0, "The image is loaded %u times", lkab[0].loads);
+	lkabMem = getSchemaRegistryMemory(registry) - lkabMem;
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_OK, "destroySchemaRegistry() returns an error code %d", tmp_err_code);
+	fail_unless(lkab[0].unloads == 1, "The image is not unloaded by destroySchemaRegistry()");
+
+	// The parser of a stream of an unknown schemaId
+	tmp_err_code = createSchemaRegistry(0, &registry);
+	fail_unless(tmp_err_code == EXIP_OK, "createSchemaRegistry() returns an error code %d", tmp_err_code);
+	tmp_err_code = traceParse(NULL, registry, buf, exiSize, &trace);
+	fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "Parsing a stream of an unknown schemaId returns an error code %d", tmp_err_code);
+
+	// Without budget the schemas are unloaded when the last stream is closed
+	tmp_err_code = registerCountedImage(registry, &REG_LKAB_ID[0], &lkab[0]);
+	fail_unless(tmp_err_code == EXIP_OK, "registerSchemaSource() returns an error code %d", tmp_err_code);
+	tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[0], &acquired);
+	fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() of an image returns an error code %d", tmp_err_code);
+	tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[0], &acquiredAgain);
+	fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() of an image returns an error code %d", tmp_err_code);
+	releaseSchema(registry, acquired);
+	fail_unless(lkab[0].unloads == 0, "A schema in use is unloaded");
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION && lkab[0].unloads == 0,
+			"destroySchemaRegistry() with an acquired schema returns an error code %d", tmp_err_code);
+	releaseSchema(registry, acquiredAgain);
+	fail_unless(lkab[0].loads == 1 && lkab[0].unloads == 1 && getSchemaRegistryMemory(registry) == 0, "The released schema is not unloaded");
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_OK, "destroySchemaRegistry() returns an error code %d", tmp_err_code);
+
+	// A budget of one lkab schema: the least recently released one is unloaded
+	tmp_err_code = createSchemaRegistry(lkabMem, &registry);
+	fail_unless(tmp_err_code == EXIP_OK, "createSchemaRegistry() returns an error code %d", tmp_err_code);
+	for(i = 0; i < 3; i++)
+	{
+		lkab[i].size = imageSize;
+		tmp_err_code = registerCountedImage(registry, &REG_LKAB_ID[i], &lkab[i]);
+		fail_unless(tmp_err_code == EXIP_OK, "registerSchemaSource() returns an error code %d", tmp_err_code);
+	}
+	for(i = 0; i < 3; i++)
+	{
+		tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[i % 2], &acquired);
+		fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() of an image returns an error code %d", tmp_err_code);
+		releaseSchema(registry, acquired);
+	}
+	// lkab:1, lkab:2 (unloads lkab:1) and lkab:1 again (unloads lkab:2)
+	fail_unless(lkab[0].loads == 2 && lkab[0].unloads == 1 && lkab[1].loads == 1 && lkab[1].unloads == 1 && lkab[2].loads == 0,
+			"Unexpected loads %u, %u and unloads %u, %u", lkab[0].loads, lkab[1].loads, lkab[0].unloads, lkab[1].unloads);
+	fail_unless(getSchemaRegistryMemory(registry) == lkabMem, "The memory of the registry is %u", (unsigned int) getSchemaRegistryMemory(registry));
+
+	// A corrupted image is reported by acquireSchema()
+	lkab[2].size = imageSize - 1;
+	tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[2], &acquired);
+	fail_unless(tmp_err_code == EXIP_OUT_OF_BOUND_BUFFER, "acquireSchema() of a truncated image returns an error code %d", tmp_err_code);
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_OK, "destroySchemaRegistry() returns an error code %d", tmp_err_code);
+	fail_unless(lkab[0].unloads == 2, "The image is not unloaded by destroySchemaRegistry()");
+
+	free(image);
+	destroySchema(&senml);
 }
+END_TEST
 
-static errorCode sample_floatData(Float fl_val, void* app_data)
+#if SCHEMA_REGISTRY_THREAD_USE && !defined(_MSC_VER)
+
+/** A counted schema image whose load waits until the test lets it proceed */
+struct slowImage
 {
-	AppData* appD = (AppData*) app_data;
+	struct countedImage img;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	boolean started;
+	boolean proceed;
+};
+
+/** The acquireSchema() of a thread */
+struct registryAcquirer
+{
+	SchemaRegistry* registry;
+	const String* schemaId;
+	EXIPSchema* schema;
+	errorCode err;
+};
 
-	if(appD->currAttr == V)
-	{
-		appD->data->eArray[appD->eIndex].v = fl_val;
-	}
-	else
-		return EXIP_HANDLER_STOP;
+static errorCode slowLoad(void* data, EXIPSchema* schema)
+{
+	struct slowImage* slow = (struct slowImage*) data;
+	struct timespec until;
+	int waitErr = 0;
+
+	pthread_mutex_lock(&slow->lock);
+	slow->started = TRUE;
+	pthread_cond_broadcast(&slow->cond);
+	// Bounded, so that a registry blocked by the load fails the test instead of hanging it
+	clock_gettime(CLOCK_REALTIME, &until);
+	until.tv_sec += 10;
+	while(!slow->proceed && waitErr == 0)
+		waitErr = pthread_cond_timedwait(&slow->cond, &slow->lock, &until);
+	pthread_mutex_unlock(&slow->lock);
+
+	if(!slow->proceed)
+		return EXIP_UNEXPECTED_ERROR;
 
-	return EXIP_OK;
+	return countedLoad(&slow->img, schema);
 }
 
-static errorCode sample_booleanData(boolean bool_val, void* app_data)
+static void* acquireConcurrently(void* arg)
 {
-	AppData* appD = (AppData*) app_data;
+	struct registryAcquirer* acq = (struct registryAcquirer*) arg;
 
-	if(appD->currAttr == BV)
-	{
-		appD->data->eArray[appD->eIndex].bv = bool_val;
-	}
-	else
-		return EXIP_HANDLER_STOP;
-
-	return EXIP_OK;
+	acq->err = acquireSchema(acq->registry, acq->schemaId, &acq->schema);
+	return NULL;
 }
 
-static errorCode sample_decimalData(Decimal value, void* app_data)
+/**
+ * While a schema is loaded by one thread, the other schemas of the registry are acquired
+ * and released without waiting, and a second acquirer of the same schemaId gets the
+ * schema of that load
+ */
+START_TEST (test_schema_registry_threads)
 {
-	AppData* appD = (AppData*) app_data;
-
-	if(appD->currAttr == S)
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char* lkabfname[1] = {"SchemaStrict/lkab-devices-xsd.exi"};
+	static struct slowImage slow;
+	struct countedImage lkab;
+	struct registryAcquirer acq[2];
+	pthread_t thread[2];
+	SchemaSource source;
+	SchemaRegistry* registry;
+	EXIPSchema lkabSchema;
+	EXIPSchema* acquired;
+	void* image;
+	size_t imageSize = 0;
+	unsigned int i;
+
+	parseSchema(lkabfname, 1, &lkabSchema);
+	tmp_err_code = writeSchemaImage(&lkabSchema, NULL, &imageSize);
+	fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+	image = malloc(imageSize);
+	fail_unless(image != NULL, "Memory allocation error");
+	tmp_err_code = writeSchemaImage(&lkabSchema, image, &imageSize);
+	fail_unless(tmp_err_code == EXIP_OK, "writeSchemaImage() returns an error code %d", tmp_err_code);
+	destroySchema(&lkabSchema);
+
+	tmp_err_code = createSchemaRegistry((size_t) -1, &registry);
+	fail_unless(tmp_err_code == EXIP_OK, "createSchemaRegistry() returns an error code %d", tmp_err_code);
+	lkab.image = image;
+	lkab.size = imageSize;
+	tmp_err_code = registerCountedImage(registry, &REG_LKAB_ID[0], &lkab);
+	fail_unless(tmp_err_code == EXIP_OK, "registerSchemaSource() returns an error code %d", tmp_err_code);
+
+	slow.img.image = image;
+	slow.img.size = imageSize;
+	slow.img.loads = 0;
+	slow.img.unloads = 0;
+	slow.started = FALSE;
+	slow.proceed = FALSE;
+	fail_unless(pthread_mutex_init(&slow.lock, NULL) == 0 && pthread_cond_init(&slow.cond, NULL) == 0, "Unable to create the lock");
+	source.load = slowLoad;
+	source.unload = countedUnload;
+	source.destroy = NULL;
+	source.data = &slow;
+	tmp_err_code = registerSchemaSource(registry, &REG_LKAB_ID[1], source);
+	fail_unless(tmp_err_code == EXIP_OK, "registerSchemaSource() returns an error code %d", tmp_err_code);
+
+	tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[0], &acquired);
+	fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() returns an error code %d", tmp_err_code);
+	releaseSchema(registry, acquired);
+
+	for(i = 0; i < 2; i++)
 	{
-		appD->data->eArray[appD->eIndex].s = value;
+		acq[i].registry = registry;
+		acq[i].schemaId = &REG_LKAB_ID[1];
+		acq[i].schema = NULL;
+		fail_unless(pthread_create(&thread[i], NULL, acquireConcurrently, &acq[i]) == 0, "Unable to create a thread");
 	}
-	else
-		return EXIP_HANDLER_STOP;
 
-	return EXIP_OK;
+	pthread_mutex_lock(&slow.lock);
+	while(!slow.started)
+		pthread_cond_wait(&slow.cond, &slow.lock);
+	pthread_mutex_unlock(&slow.lock);
+
+	// The load of lkab:2 is in progress
+	tmp_err_code = acquireSchema(registry, &REG_LKAB_ID[0], &acquired);
+	fail_unless(tmp_err_code == EXIP_OK, "acquireSchema() during the load of another schema returns an error code %d", tmp_err_code);
+	releaseSchema(registry, acquired);
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_INVALID_EXIP_CONFIGURATION, "destroySchemaRegistry() during a load returns an error code %d", tmp_err_code);
+
+	pthread_mutex_lock(&slow.lock);
+	slow.proceed = TRUE;
+	pthread_cond_broadcast(&slow.cond);
+	pthread_mutex_unlock(&slow.lock);
+
+	for(i = 0; i < 2; i++)
+		pthread_join(thread[i], NULL);
+
+	fail_unless(acq[0].err == EXIP_OK && acq[1].err == EXIP_OK, "The concurrent acquireSchema() return the error codes %d and %d", acq[0].err, acq[1].err);
+	fail_unless(acq[0].schema == acq[1].schema && slow.img.loads == 1, "The schema is loaded %u times", slow.img.loads);
+	releaseSchema(registry, acq[0].schema);
+	releaseSchema(registry, acq[1].schema);
+
+	tmp_err_code = destroySchemaRegistry(registry);
+	fail_unless(tmp_err_code == EXIP_OK, "destroySchemaRegistry() returns an error code %d", tmp_err_code);
+	fail_unless(slow.img.unloads == 1 && lkab.unloads == 1, "The images are not unloaded by destroySchemaRegistry()");
+	pthread_cond_destroy(&slow.cond);
+	pthread_mutex_destroy(&slow.lock);
+	free(image);
 }
+END_TEST
 
-static errorCode sample_intData(Integer int_val, void* app_data)
-{
-	AppData* appD = (AppData*) app_data;
+#endif
 
-	switch(appD->currAttr)
-	{
-		case BT:
-			appD->data->bt = int_val;
-		break;
-		case VER:
-			appD->data->version = int_val;
-		break;
-		case T:
-			appD->data->eArray[appD->eIndex].t = int_val;
-		break;
-		case UT:
-			appD->data->eArray[appD->eIndex].ut = int_val;
-		break;
-		default:
-			return EXIP_HANDLER_STOP;
-	}
-	return EXIP_OK;
-}
+#if COMPRESSION_USE
 
-#define E_ELEM_COUNT   7  // The number of e elems in the senML to be encoded is 7
+#define E_ELEM_COUNT_COMPRESSION 300
+#define OUTPUT_BUFFER_SIZE_COMPRESSION 30000
 
-START_TEST (test_various_senml)
+/**
+ * Encodes a SenML document with typed values of all the SenML attributes with the
+ * compression and pre-compression alignments and checks the decoded values
+ */
+START_TEST (test_various_senml_compression)
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
-	char buf[OUTPUT_BUFFER_SIZE];
+	static char buf[OUTPUT_BUFFER_SIZE_COMPRESSION];
+	static senml_elem eArr[E_ELEM_COUNT_COMPRESSION];
+	static senml_elem eArrParsed[E_ELEM_COUNT_COMPRESSION];
+	const char* units[4] = {"count", "r/m", "Cel", "%"};
+	const unsigned char alignments[3] = {COMPRESSION, COMPRESSION, PRE_COMPRESSION};
+	const uint32_t blockSizes[3] = {1000000, 50, 50};
 	char* schemafname[1] = {"exip/SenML-xsd.exi"};
 	EXIPSchema schema;
+	EXIOptions opts;
 	size_t exiSize = 0;
-	senml_elem eArr[E_ELEM_COUNT];
 	senml senML_instance;
-	senml_elem eArrParsed[E_ELEM_COUNT];
 	senml senMLParsed;
+	unsigned int c;
 	int i;
 
 	parseSchema(schemafname, 1, &schema);
@@ -2519,106 +5208,297 @@ START_TEST (test_various_senml)
 	strcpy(senML_instance.bn, "urn:dev:mac:0024befffe804ff1");
 	senML_instance.bt = 1415355691;
 	senML_instance.version = 1;
-	senML_instance.bu[0] = '\0';
-	senML_instance.eArrayCount = E_ELEM_COUNT;
-	senML_instance.eArraySize = E_ELEM_COUNT;
+	strcpy(senML_instance.bu, "Cel");
+	senML_instance.eArrayCount = E_ELEM_COUNT_COMPRESSION;
+	senML_instance.eArraySize = E_ELEM_COUNT_COMPRESSION;
 	senML_instance.eArray = eArr;
 
-	// E elem 0
-	strcpy(eArr[0].n, "pktid");
-	strcpy(eArr[0].u, "count");
-	eArr[0].v.mantissa = 1;
-	eArr[0].v.exponent = 0;
+	for(i = 0; i < E_ELEM_COUNT_COMPRESSION; i++)
+	{
+		sprintf(eArr[i].n, "sensor%d", i % 7);
+		strcpy(eArr[i].u, units[i % 4]);
+		eArr[i].v.mantissa = 37*i - 500;
+		eArr[i].v.exponent = i % 5 - 2;
+		eArr[i].bv = i % 3; // N/A for every third
+		eArr[i].s.mantissa = 10*i + 7;
+		eArr[i].s.exponent = i % 2 == 0 ? -2 : INT16_MAX;
+		if(i % 10 == 0)
+			sprintf(eArr[i].sv, "state %d", i);
+		else
+			eArr[i].sv[0] = '\0';
+		eArr[i].t = i % 4 == 0 ? INT_MAX : -i;
+		eArr[i].ut = 60 + i % 2;
+	}
 
-	// E elem 1
-	strcpy(eArr[1].n, "rpm");
-	strcpy(eArr[1].u, "r/m");
-	eArr[1].v.mantissa = 352;
-	eArr[1].v.exponent = 0;
+	for(c = 0; c < 3; c++)
+	{
+		makeDefaultOpts(&opts);
+		if(alignments[c] == COMPRESSION)
+			SET_COMPRESSION(opts.enumOpt);
+		else
+			SET_ALIGNMENT(opts.enumOpt, alignments[c]);
+		opts.blockSize = blockSizes[c];
+
+		tmp_err_code = encodeSenML(&schema, senML_instance, &opts, buf, OUTPUT_BUFFER_SIZE_COMPRESSION, &exiSize);
+		fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of EXI SenML stream %u", c);
+		fail_unless(exiSize > 0, "Encoding SenML produces empty streams.");
+
+		senMLParsed.bn[0] = '\0';
+		senMLParsed.bt = LONG_MAX;
+		senMLParsed.version = -1;
+		senMLParsed.bu[0] = '\0';
+		senMLParsed.eArrayCount = 0;
+		senMLParsed.eArraySize = E_ELEM_COUNT_COMPRESSION;
+		senMLParsed.eArray = eArrParsed;
+
+		for(i = 0; i < E_ELEM_COUNT_COMPRESSION; i++)
+		{
+			eArrParsed[i].n[0] = '\0';
+			eArrParsed[i].u[0] = '\0';
+			eArrParsed[i].v.exponent = INT16_MAX;
+			eArrParsed[i].bv = 5;
+			eArrParsed[i].s.exponent = INT16_MAX;
+			eArrParsed[i].sv[0] = '\0';
+			eArrParsed[i].t = INT_MAX;
+			eArrParsed[i].ut = INT_MAX;
+		}
 
-	// E elem 2
-	strcpy(eArr[2].n, "rpm_av");
-	strcpy(eArr[2].u, "r/m");
-	eArr[2].v.mantissa = 352;
-	eArr[2].v.exponent = 0;
+		tmp_err_code = decodeSenML(&schema, buf, OUTPUT_BUFFER_SIZE_COMPRESSION, &senMLParsed);
+		fail_unless(tmp_err_code == EXIP_OK, "There is an error in the decoding of EXI SenML stream %u: %d", c, tmp_err_code);
+		fail_unless(!strcmp(senMLParsed.bn, senML_instance.bn), "SenML BN value error");
+		fail_unless(senMLParsed.bt == senML_instance.bt, "SenML BT value error");
+		fail_unless(senMLParsed.version == senML_instance.version, "SenML version value error");
+		fail_unless(!strcmp(senMLParsed.bu, senML_instance.bu), "SenML BU value error");
+		fail_unless(senMLParsed.eArrayCount == E_ELEM_COUNT_COMPRESSION, "%u e elements decoded", (unsigned int) senMLParsed.eArrayCount);
 
-	// E elem 3
-	strcpy(eArr[3].n, "totrounds");
-	strcpy(eArr[3].u, "count");
-	eArr[3].v.mantissa = 461;
-	eArr[3].v.exponent = 3;   // 461000
+		for(i = 0; i < E_ELEM_COUNT_COMPRESSION; i++)
+		{
+			fail_unless(!strcmp(eArrParsed[i].n, eArr[i].n), "SenML N value error in e %d", i);
+			fail_unless(!strcmp(eArrParsed[i].u, eArr[i].u), "SenML U value error in e %d", i);
+			fail_unless(eArrParsed[i].v.mantissa == eArr[i].v.mantissa && eArrParsed[i].v.exponent == eArr[i].v.exponent, "SenML V value error in e %d", i);
+			fail_unless(eArrParsed[i].bv == (eArr[i].bv < 2 ? eArr[i].bv : 5), "SenML BV value error in e %d", i);
+			fail_unless(eArrParsed[i].s.exponent == eArr[i].s.exponent, "SenML S value error in e %d", i);
+			fail_unless(eArr[i].s.exponent == INT16_MAX || eArrParsed[i].s.mantissa == eArr[i].s.mantissa, "SenML S value error in e %d", i);
+			fail_unless(!strcmp(eArrParsed[i].sv, eArr[i].sv), "SenML SV value error in e %d", i);
+			fail_unless(eArrParsed[i].t == eArr[i].t, "SenML T value error in e %d", i);
+			fail_unless(eArrParsed[i].ut == eArr[i].ut, "SenML UT value error in e %d", i);
+		}
+	}
 
-	// E elem 4
-	strcpy(eArr[4].n, "totrounds_r");
-	strcpy(eArr[4].u, "count");
-	eArr[4].v.mantissa = 0;
-	eArr[4].v.exponent = 0;
+	destroySchema(&schema);
+}
+END_TEST
 
-	// E elem 5
-	strcpy(eArr[5].n, "bearingtemp");
-	strcpy(eArr[5].u, "Cel");
-	eArr[5].v.mantissa = 454;
-	eArr[5].v.exponent = -1; // 45.4
+#endif /* COMPRESSION_USE */
 
-	// E elem 6
-	strcpy(eArr[6].n, "rssi");
-	strcpy(eArr[6].u, "%");
-	eArr[6].v.mantissa = 9;
-	eArr[6].v.exponent = 1; // 90
+#ifndef _MSC_VER
 
-	// All the other fileds are set to N/A
-	for(i = 0; i < E_ELEM_COUNT; i++)
+#define CONCURRENT_THREAD_COUNT 4
+#define CONCURRENT_PARSE_COUNT 25
+#define CONCURRENT_READING_COUNT 20
+
+/** A parser thread of test_concurrent_decoding */
+struct concurrentDecoding
+{
+	EXIPSchema* schema;
+	char* buf;
+	Index bufContent;
+	/** The events counted by the handler in the last parsing */
+	unsigned int elements;
+	unsigned int attributes;
+	unsigned int chars;
+	/** FALSE if a parsing returned an error or counted other events than the first one */
+	boolean consistent;
+};
+
+static errorCode concurrent_startElement(QName qname, void* app_data)
+{
+	((struct concurrentDecoding*) app_data)->elements++;
+	return EXIP_OK;
+}
+
+static errorCode concurrent_attribute(QName qname, void* app_data)
+{
+	((struct concurrentDecoding*) app_data)->attributes++;
+	return EXIP_OK;
+}
+
+static errorCode concurrent_stringData(const String value, void* app_data)
+{
+	((struct concurrentDecoding*) app_data)->chars += value.length;
+	return EXIP_OK;
+}
+
+/**
+ * Parses the document of test_concurrent_decoding CONCURRENT_PARSE_COUNT times
+ */
+static void* decodeConcurrently(void* arg)
+{
+	struct concurrentDecoding* dec = (struct concurrentDecoding*) arg;
+	unsigned int elements = 0, attributes = 0, chars = 0;
+	errorCode tmp_err_code;
+	Parser testParser;
+	BinaryBuffer buffer;
+	int i;
+
+	dec->consistent = TRUE;
+	for(i = 0; i < CONCURRENT_PARSE_COUNT; i++)
 	{
-		eArr[i].bv = 5;
-		eArr[i].s.exponent = INT16_MAX;
-		eArr[i].sv[0] = '\0';
-		eArr[i].t = INT_MAX;
-		eArr[i].ut = INT_MAX;
+		buffer.buf = dec->buf;
+		buffer.bufLen = dec->bufContent;
+		buffer.bufContent = dec->bufContent;
+		buffer.ioStrm.readWriteToStream = NULL;
+		buffer.ioStrm.stream = NULL;
+
+		dec->elements = 0;
+		dec->attributes = 0;
+		dec->chars = 0;
+
+		tmp_err_code = initParser(&testParser, buffer, dec);
+		if(tmp_err_code != EXIP_OK)
+		{
+			dec->consistent = FALSE;
+			break;
+		}
+
+		testParser.handler.startElement = concurrent_startElement;
+		testParser.handler.attribute = concurrent_attribute;
+		testParser.handler.stringData = concurrent_stringData;
+
+		tmp_err_code = parseHeader(&testParser, FALSE);
+		if(tmp_err_code == EXIP_OK)
+			tmp_err_code = setSchema(&testParser, dec->schema);
+		while(tmp_err_code == EXIP_OK)
+			tmp_err_code = parseNext(&testParser);
+		destroyParser(&testParser);
+
+		if(tmp_err_code != EXIP_PARSING_COMPLETE ||
+				(i > 0 && (dec->elements != elements || dec->attributes != attributes || dec->chars != chars)))
+		{
+			dec->consistent = FALSE;
+			break;
+		}
+
+		elements = dec->elements;
+		attributes = dec->attributes;
+		chars = dec->chars;
 	}
 
-	tmp_err_code = encodeSenML(&schema, senML_instance, buf, OUTPUT_BUFFER_SIZE, &exiSize);
-	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the encoding of an EXI SenML stream");
-	fail_unless(exiSize > 0, "Encoding SenML produces empty streams.");
+	return NULL;
+}
 
-	senMLParsed.eArray = eArrParsed;
-	senMLParsed.bn[0] = '\0';
-	senMLParsed.bt = LONG_MAX;
-	senMLParsed.version = -1;
-	senMLParsed.bu[0] = '\0';
-	senMLParsed.eArrayCount = 0;
-	senMLParsed.eArraySize = E_ELEM_COUNT;
-	senMLParsed.eArray = eArr;
+/**
+ * Decodes a document with CONCURRENT_THREAD_COUNT threads against one EXIPSchema.
+ * The document is not described by the schema, so that every stream adds URIs, local names,
+ * value cross tables and built-in element grammars to its own string tables
+ */
+START_TEST (test_concurrent_decoding)
+{
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	char* schemafname[1] = {"exip/schema_demo.exi"};
+	EXIPSchema schema;
+	EXIStream testStrm;
+	String uri;
+	String ln;
+	QName qname = {&uri, &ln, NULL};
+	String chVal;
+	char buf[OUTPUT_BUFFER_SIZE];
+	char strbuffer[32];
+	BinaryBuffer buffer;
+	EXITypeClass valueType;
+	struct concurrentDecoding dec[CONCURRENT_THREAD_COUNT];
+	pthread_t thread[CONCURRENT_THREAD_COUNT];
+	SmallIndex uriCount;
+	Index lnCount;
+	LnEntry* lnEntries;
+	int i;
 
-	for(i = 0; i < E_ELEM_COUNT; i++)
+	buffer.buf = buf;
+	buffer.bufLen = OUTPUT_BUFFER_SIZE;
+	buffer.bufContent = 0;
+	buffer.ioStrm.readWriteToStream = NULL;
+	buffer.ioStrm.stream = NULL;
+
+	parseSchema(schemafname, 1, &schema);
+	uriCount = schema.uriTable.count;
+	lnCount = schema.uriTable.uri[0].lnTable.count;
+	lnEntries = schema.uriTable.uri[0].lnTable.ln;
+
+	serialize.initHeader(&testStrm);
+	testStrm.header.has_options = TRUE;
+
+	tmp_err_code = serialize.initStream(&testStrm, buffer, &schema);
+	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
+	tmp_err_code += serialize.exiHeader(&testStrm);
+	tmp_err_code += serialize.startDocument(&testStrm);
+
+	tmp_err_code += asciiToString("urn:exip:concurrency", &uri, &testStrm.memList, FALSE);
+	tmp_err_code += asciiToString("sensor", &ln, &testStrm.memList, FALSE);
+	tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+	fail_unless (tmp_err_code == EXIP_OK, "serialize.startElement returns an error code %d", tmp_err_code);
+
+	for(i = 0; i < CONCURRENT_READING_COUNT; i++)
 	{
-		eArrParsed[i].n[0] = '\0';
-		eArrParsed[i].u[0] = '\0';
-		eArrParsed[i].v.exponent = INT16_MAX;
-		eArrParsed[i].bv = 5;
-		eArrParsed[i].s.exponent = INT16_MAX;
-		eArrParsed[i].sv[0] = '\0';
-		eArrParsed[i].t = INT_MAX;
-		eArrParsed[i].ut = INT_MAX;
+		tmp_err_code += asciiToString("urn:exip:concurrency", &uri, &testStrm.memList, FALSE);
+		tmp_err_code += asciiToString("reading", &ln, &testStrm.memList, FALSE);
+		tmp_err_code += serialize.startElement(&testStrm, qname, &valueType);
+
+		// "id" is a local name of the schema
+		tmp_err_code += asciiToString("", &uri, &testStrm.memList, FALSE);
+		tmp_err_code += asciiToString("id", &ln, &testStrm.memList, FALSE);
+		tmp_err_code += serialize.attribute(&testStrm, qname, TRUE, &valueType);
+		sprintf(strbuffer, "r%d", i % 5);
+		tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.stringData(&testStrm, chVal);
+
+		sprintf(strbuffer, "%d.5", 20 + i);
+		tmp_err_code += asciiToString(strbuffer, &chVal, &testStrm.memList, TRUE);
+		tmp_err_code += serialize.stringData(&testStrm, chVal);
+		tmp_err_code += serialize.endElement(&testStrm);
+		fail_unless (tmp_err_code == EXIP_OK, "serialization of a reading returns an error code %d", tmp_err_code);
 	}
 
-	tmp_err_code = decodeSenML(&schema, buf, OUTPUT_BUFFER_SIZE, &senMLParsed);
-	destroySchema(&schema);
-	fail_unless(tmp_err_code == EXIP_OK, "There is an error in the decoding of an EXI SenML stream");
-	fail_unless(!strcmp(senMLParsed.bn, senML_instance.bn), "SenML BN value error");
-	fail_unless(senMLParsed.bt == senML_instance.bt, "SenML BT value error");
-	fail_unless(senMLParsed.version == senML_instance.version, "SenML version value error");
+	tmp_err_code += serialize.endElement(&testStrm);
+	tmp_err_code += serialize.endDocument(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialization ended with error code %d", tmp_err_code);
+	buffer.bufContent = testStrm.context.bufferIndx + 1;
 
-	for(i = 0; i < senMLParsed.eArrayCount; i++)
+	tmp_err_code = serialize.closeEXIStream(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "serialize.closeEXIStream ended with error code %d", tmp_err_code);
+
+	for(i = 0; i < CONCURRENT_THREAD_COUNT; i++)
 	{
-		fail_unless(!strcmp(senMLParsed.eArray[i].n, senML_instance.eArray[i].n), "SenML N value error");
-		fail_unless(!strcmp(senMLParsed.eArray[i].u, senML_instance.eArray[i].u), "SenML U value error");
-		fail_unless(senMLParsed.eArray[i].v.mantissa == senML_instance.eArray[i].v.mantissa, "SenML V value error");
-		fail_unless(senMLParsed.eArray[i].v.exponent == senML_instance.eArray[i].v.exponent, "SenML V value error");
+		dec[i].schema = &schema;
+		dec[i].buf = buf;
+		dec[i].bufContent = buffer.bufContent;
+		fail_unless (pthread_create(&thread[i], NULL, decodeConcurrently, &dec[i]) == 0, "Unable to create a thread");
+	}
+
+	for(i = 0; i < CONCURRENT_THREAD_COUNT; i++)
+		pthread_join(thread[i], NULL);
+
+	for(i = 0; i < CONCURRENT_THREAD_COUNT; i++)
+	{
+		fail_unless (dec[i].consistent, "Inconsistent concurrent decoding in thread %d", i);
+		fail_unless (dec[i].elements == 1 + CONCURRENT_READING_COUNT, "Decoded %u elements", dec[i].elements);
+		fail_unless (dec[i].attributes == CONCURRENT_READING_COUNT, "Decoded %u attributes", dec[i].attributes);
+		fail_unless (dec[i].chars == dec[0].chars, "Decoded %u characters", dec[i].chars);
 	}
 
+	fail_unless (schema.uriTable.count == uriCount, "The URIs of the stream are added to the schema");
+	fail_unless (schema.uriTable.uri[0].lnTable.count == lnCount &&
+			schema.uriTable.uri[0].lnTable.ln == lnEntries, "The local names of the schema are modified");
+#if VALUE_CROSSTABLE_USE
+	for(i = 0; i < (int) lnCount; i++)
+		fail_unless (lnEntries[i].vxTable == NULL, "The values of the stream are added to the schema");
+#endif
+
+	destroySchema(&schema);
 }
 END_TEST
 
+#endif /* _MSC_VER */
+
 /* END: Schema-mode tests */
 
 /* Helper functions */
@@ -2705,6 +5585,17 @@ Suite* exip_suite(void)
 		tcase_add_test (tc_SchLess, test_value_part_zero);
 		tcase_add_test (tc_SchLess, test_recursive_defs);
 		tcase_add_test (tc_SchLess, test_built_in_dynamic_types);
+		tcase_add_test (tc_SchLess, test_parser_reuse);
+		tcase_add_test (tc_SchLess, test_chunked_values);
+#if COMPRESSION_USE
+		tcase_add_test (tc_SchLess, test_compression);
+		tcase_add_test (tc_SchLess, test_compression_abandon);
+		tcase_add_test (tc_SchLess, test_compression_non_blocking);
+		tcase_add_test (tc_SchLess, test_compression_document_end);
+#if COMPRESSION_THREAD_USE && !defined(_MSC_VER)
+		tcase_add_test (tc_SchLess, test_compression_blocked_read);
+#endif
+#endif
 		suite_add_tcase (s, tc_SchLess);
 	}
 	{
@@ -2715,6 +5606,24 @@ Suite* exip_suite(void)
 		tcase_add_test (tc_Schema, test_non_blocking_streaming);
 		tcase_add_test (tc_Schema, test_non_blocking_streaming_bytealigned);
 		tcase_add_test (tc_Schema, test_various_senml);
+		tcase_add_test (tc_Schema, test_qname_handles);
+		tcase_add_test (tc_Schema, test_parse_next_batch);
+		tcase_add_test (tc_Schema, test_event_code_tables);
+		tcase_add_test (tc_Schema, test_event_code_options);
+		tcase_add_test (tc_Schema, test_schema_image);
+#if STRING_TABLE_INDEX_USE
+		tcase_add_test (tc_Schema, test_schema_name_indexes);
+#endif
+		tcase_add_test (tc_Schema, test_schema_registry);
+#if SCHEMA_REGISTRY_THREAD_USE && !defined(_MSC_VER)
+		tcase_add_test (tc_Schema, test_schema_registry_threads);
+#endif
+#if COMPRESSION_USE
+		tcase_add_test (tc_Schema, test_various_senml_compression);
+#endif
+#ifndef _MSC_VER
+		tcase_add_test (tc_Schema, test_concurrent_decoding);
+#endif
 		suite_add_tcase (s, tc_Schema);
 	}
 
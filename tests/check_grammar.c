@@ -20,6 +20,7 @@
 #include "grammars.h"
 #include "bodyDecode.h"
 #include "memManagement.h"
+#include "ioUtil.h"
 
 /* BEGIN: grammars tests */
 
@@ -64,18 +65,20 @@ START_TEST (test_processNextProduction)
 
 	initAllocList(&strm.memList);
 	initAllocList(&schema.memList);
+	initGrammarStack(&strm);
 
 	err = createDocGrammar(&schema, NULL, 0);
 	fail_unless (err == EXIP_OK, "createDocGrammar returns an error code %d", err);
 
-	err = pushGrammar(&strm.gStack, emptyQnameID, &schema.docGrammar);
+	err = pushGrammar(&strm, emptyQnameID, &schema.docGrammar);
 	fail_unless (err == EXIP_OK, "pushGrammar returns an error code %d", err);
 
 	strm.gStack->currNonTermID = 4;
 	err = processNextProduction(&strm, &nonTermID_out, &handler, NULL);
 	fail_unless (err == EXIP_INCONSISTENT_PROC_STATE, "processNextProduction does not return the correct error code");
 
-	popGrammar(&strm.gStack);
+	popGrammar(&strm);
+	destroyGrammarStack(&strm);
 	freeAllocList(&strm.memList);
 	freeAllocList(&schema.memList);
 }
@@ -84,7 +87,6 @@ END_TEST
 START_TEST (test_pushGrammar)
 {
 	errorCode err = EXIP_UNEXPECTED_ERROR;
-	EXIGrammarStack* testGrStack = NULL;
 	EXIStream strm;
 	EXIGrammar testElementGrammar;
 	EXIGrammar testElementGrammar1;
@@ -92,6 +94,7 @@ START_TEST (test_pushGrammar)
 
 	makeDefaultOpts(&strm.header.opts);
 	initAllocList(&strm.memList);
+	initGrammarStack(&strm);
 
 #if BUILD_IN_GRAMMARS_USE
 	err = createBuiltInElementGrammar(&testElementGrammar1, &strm);
@@ -101,25 +104,28 @@ START_TEST (test_pushGrammar)
 	fail_if(err != EXIP_OK);
 #endif
 
-	err = pushGrammar(&testGrStack, emptyQnameID, &testElementGrammar1);
+	err = pushGrammar(&strm, emptyQnameID, &testElementGrammar1);
 	fail_unless (err == EXIP_OK, "pushGrammar returns error code %d", err);
-	fail_if(testGrStack->nextInStack != NULL);
+	fail_if(strm.grammarStack.depth != 1);
+	fail_if(strm.gStack == NULL || strm.gStack->grammar != &testElementGrammar1);
 
-	err = pushGrammar(&testGrStack, emptyQnameID, &testElementGrammar);
+	err = pushGrammar(&strm, emptyQnameID, &testElementGrammar);
 	fail_unless (err == EXIP_OK, "pushGrammar returns error code %d", err);
-	fail_if(testGrStack->nextInStack == NULL);
-	fail_if(testGrStack->nextInStack->grammar != &testElementGrammar1);
+	fail_if(strm.grammarStack.depth != 2);
+	fail_if(strm.gStack->grammar != &testElementGrammar);
+	fail_if(strm.gStack->currNonTermID != GR_START_TAG_CONTENT);
+	fail_if(strm.grammarStack.node[0].grammar != &testElementGrammar1);
 
 	freeAllocList(&strm.memList);
-	popGrammar(&testGrStack);
-	popGrammar(&testGrStack);
+	popGrammar(&strm);
+	popGrammar(&strm);
+	destroyGrammarStack(&strm);
 }
 END_TEST
 
 START_TEST (test_popGrammar)
 {
 	errorCode err = EXIP_UNEXPECTED_ERROR;
-	EXIGrammarStack* testGrStack = NULL;
 	EXIGrammar testElementGrammar1;
 	EXIStream strm;
 	EXIGrammar testElementGrammar;
@@ -127,6 +133,7 @@ START_TEST (test_popGrammar)
 
 	makeDefaultOpts(&strm.header.opts);
 	initAllocList(&strm.memList);
+	initGrammarStack(&strm);
 
 #if BUILD_IN_GRAMMARS_USE
 	err = createBuiltInElementGrammar(&testElementGrammar1, &strm);
@@ -136,17 +143,62 @@ START_TEST (test_popGrammar)
 	fail_if(err != EXIP_OK);
 #endif
 
-	err = pushGrammar(&testGrStack, emptyQnameID, &testElementGrammar1);
+	err = pushGrammar(&strm, emptyQnameID, &testElementGrammar1);
 	fail_unless (err == EXIP_OK, "pushGrammar returns error code %d", err);
 
-	err = pushGrammar(&testGrStack, emptyQnameID, &testElementGrammar);
+	err = pushGrammar(&strm, emptyQnameID, &testElementGrammar);
 	fail_unless (err == EXIP_OK, "pushGrammar returns error code %d", err);
-	fail_if(testGrStack->nextInStack == NULL);
+	fail_if(strm.grammarStack.depth != 2);
 
 	freeAllocList(&strm.memList);
-	popGrammar(&testGrStack);
-	fail_if(testGrStack->nextInStack != NULL);
-	popGrammar(&testGrStack);
+	popGrammar(&strm);
+	fail_if(strm.grammarStack.depth != 1);
+	fail_if(strm.gStack == NULL || strm.gStack->grammar != &testElementGrammar1);
+	popGrammar(&strm);
+	fail_if(strm.gStack != NULL);
+	popGrammar(&strm);
+	fail_if(strm.grammarStack.depth != 0);
+	destroyGrammarStack(&strm);
+}
+END_TEST
+
+/* A nesting deeper than the initial allocation (or up to GRAMMAR_STACK_MAX_DEPTH) */
+START_TEST (test_deepGrammarStack)
+{
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+	EXIGrammar testElementGrammar;
+	QNameID qnameID = {URI_MAX, LN_MAX};
+	Index i;
+#if GRAMMAR_STACK_MAX_DEPTH
+	Index depth = GRAMMAR_STACK_MAX_DEPTH;
+#else
+	Index depth = 1000;
+#endif
+
+	initGrammarStack(&strm);
+
+	for(i = 0; i < depth; i++)
+	{
+		qnameID.lnId = (Index) i;
+		err = pushGrammar(&strm, qnameID, &testElementGrammar);
+		fail_unless (err == EXIP_OK, "pushGrammar returns error code %d at depth %d", err, (int) i);
+	}
+
+#if GRAMMAR_STACK_MAX_DEPTH
+	err = pushGrammar(&strm, qnameID, &testElementGrammar);
+	fail_unless (err == EXIP_OUT_OF_BOUND_BUFFER, "pushGrammar beyond GRAMMAR_STACK_MAX_DEPTH returns %d", err);
+#endif
+
+	for(i = depth; i > 0; i--)
+	{
+		fail_if(strm.gStack == NULL);
+		fail_unless(strm.gStack->currQNameID.lnId == i - 1, "The grammar stack is out of order at depth %d", (int) i);
+		popGrammar(&strm);
+	}
+	fail_if(strm.gStack != NULL);
+
+	destroyGrammarStack(&strm);
 }
 END_TEST
 
@@ -192,9 +244,119 @@ START_TEST (test_insertZeroProduction)
 	tmp_err_code = insertZeroProduction(&rule, EVENT_CH, 5, &qname, FALSE);
 	fail_unless (tmp_err_code == EXIP_OK, "insertZeroProduction returns an error code %d", tmp_err_code);
 	fail_unless (rule.pCount == 1);
+	/* The rules of the built-in element grammars always have a second level */
+	fail_unless (rule.codeBits[0] == 1 + getBitsNumber(1) && rule.codeBits[1] == 1 + getBitsNumber(1));
+
+#if PACKED_GRAMMAR_USE
+	/* A learned qname that does not fit a compact production */
+	qname.lnId = PROD_LN_ID_MAX;
+	tmp_err_code = insertZeroProduction(&rule, EVENT_SE_QNAME, 5, &qname, FALSE);
+	fail_unless (tmp_err_code == EXIP_OUT_OF_BOUND_BUFFER, "insertZeroProduction returns %d for a qname that does not fit", tmp_err_code);
+	fail_unless (rule.pCount == 1);
+#endif
 }
 END_TEST
 #endif
+START_TEST (test_productionIds)
+{
+	Production prod;
+	QNameID qname = {URI_MAX, LN_MAX};
+	QNameID prodQname = {0, 0};
+
+	/* The void indices are kept through the compact layout */
+	SET_PROD_TYPE_ID(&prod, INDEX_MAX);
+	SET_PROD_QNAME_ID(&prod, qname);
+	fail_unless (GET_PROD_TYPE_ID(&prod) == INDEX_MAX);
+	fail_unless (GET_PROD_URI_ID(&prod) == URI_MAX && GET_PROD_LN_ID(&prod) == LN_MAX);
+	fail_unless (PROD_IDS_FIT(INDEX_MAX, qname));
+
+	qname.uriId = 4;
+	qname.lnId = 1000;
+	SET_PROD_TYPE_ID(&prod, 300);
+	SET_PROD_QNAME_ID(&prod, qname);
+	GET_PROD_QNAME_ID(&prod, prodQname);
+	fail_unless (GET_PROD_TYPE_ID(&prod) == 300);
+	fail_unless (prodQname.uriId == 4 && prodQname.lnId == 1000);
+	fail_unless (PROD_IDS_FIT(300, qname));
+
+#if PACKED_GRAMMAR_USE
+	/* The all-ones compact values are reserved for the void indices */
+	qname.lnId = PROD_LN_ID_MAX;
+	fail_unless (!PROD_IDS_FIT(300, qname));
+	qname.lnId = 1000;
+	fail_unless (!PROD_IDS_FIT(PROD_TYPE_ID_MAX, qname));
+	fail_unless (PROD_IDS_FIT(PROD_TYPE_ID_MAX - 1, qname));
+#endif
+}
+END_TEST
+
+START_TEST (test_ruleCodeBits)
+{
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+	EXIStream strm;
+	EXIGrammar grammar;
+	GrammarRule rule[9];
+	QNameID emptyQnameID = {URI_MAX, LN_MAX};
+	unsigned int props[5];
+	unsigned char preserve[4] = {0, PRESERVE_COMMENTS, PRESERVE_DTD, PRESERVE_PIS};
+	unsigned int p, o, r;
+
+	props[0] = 0;
+	SET_DOCUMENT_GR(props[0]);
+	props[1] = 0;
+	SET_FRAGMENT_GR(props[1]);
+	props[2] = 0;
+	SET_SCHEMA_GR(props[2]);
+	props[3] = props[2];
+	SET_NILLABLE_GR(props[3]);
+	props[4] = props[2];
+	SET_NAMED_SUB_TYPE_OR_UNION(props[4]);
+
+	for(r = 0; r < 9; r++)
+	{
+		rule[r].production = NULL;
+		rule[r].pCount = (r + 1) % 9;
+		rule[r].meta = 0;
+		setRuleCodeBits(&rule[r]);
+	}
+
+	grammar.rule = rule;
+	grammar.count = 9;
+
+	initAllocList(&strm.memList);
+	initGrammarStack(&strm);
+	strm.context.isNilType = FALSE;
+
+	for(p = 0; p < 5; p++)
+	{
+		grammar.props = props[p];
+		SET_CONTENT_INDEX(grammar.props, 1);
+		for(o = 0; o < 8; o++)
+		{
+			makeDefaultOpts(&strm.header.opts);
+			SET_PRESERVED(strm.header.opts.preserve, preserve[o % 4]);
+			if(o >= 4)
+				SET_STRICT(strm.header.opts.enumOpt);
+
+			err = pushGrammar(&strm, emptyQnameID, &grammar);
+			fail_unless (err == EXIP_OK, "pushGrammar returns error code %d", err);
+
+			for(r = 0; r < 9; r++)
+			{
+				fail_unless(GET_BITS_FIRST_PART_CODE(&strm, &rule[r], r) == getBitsFirstPartCode(&strm, rule[r].pCount, r),
+						"props %u, options %u: rule %u has %u bits instead of %u", p, o, r,
+						GET_BITS_FIRST_PART_CODE(&strm, &rule[r], r), getBitsFirstPartCode(&strm, rule[r].pCount, r));
+			}
+
+			popGrammar(&strm);
+		}
+	}
+
+	destroyGrammarStack(&strm);
+	freeAllocList(&strm.memList);
+}
+END_TEST
+
 /* END: rules tests */
 
 
@@ -209,6 +371,7 @@ Suite * grammar_suite (void)
 	  tcase_add_test (tc_gGrammars, test_processNextProduction);
 	  tcase_add_test (tc_gGrammars, test_pushGrammar);
 	  tcase_add_test (tc_gGrammars, test_popGrammar);
+	  tcase_add_test (tc_gGrammars, test_deepGrammarStack);
 #if BUILD_IN_GRAMMARS_USE
 	  tcase_add_test (tc_gGrammars, test_createBuiltInElementGrammar);
 #endif
@@ -227,6 +390,8 @@ Suite * grammar_suite (void)
 #if BUILD_IN_GRAMMARS_USE
 	  tcase_add_test (tc_gRules, test_insertZeroProduction);
 #endif
+	  tcase_add_test (tc_gRules, test_ruleCodeBits);
+	  tcase_add_test (tc_gRules, test_productionIds);
 	  suite_add_tcase (s, tc_gRules);
   }
 
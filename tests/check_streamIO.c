@@ -17,6 +17,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <check.h>
 #include "streamRead.h"
 #include "streamWrite.h"
@@ -238,6 +239,64 @@ START_TEST (test_writeNBits)
 }
 END_TEST
 
+START_TEST (test_writeReadNBitsRoundTrip)
+{
+  EXIStream testStream;
+  char buf[32];
+  const unsigned char widths[] = {1, 7, 13, 8, 3, 32, 17, 2, 25, 5, 9, 6, 30, 4, 11, 1, 19, 8, 23, 10};
+  const unsigned long values[] = {1, 100, 8000, 255, 5, 3000000000UL, 65537, 2, 33554431, 0, 257, 42, 123456789, 15, 1025, 0, 400000, 128, 8388607, 513};
+  unsigned long bits_val;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  unsigned int i;
+  unsigned int pos;
+
+  memset(buf, 0xFF, sizeof(buf));
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = sizeof(buf);
+  testStream.buffer.bufContent = sizeof(buf);
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  testStream.context.bufferIndx = 0;
+  testStream.context.bitPointer = 0;
+  initAllocList(&testStream.memList);
+
+  // The fields cover both the word window and the byte-wise writing at the buffer end
+  for(i = 0; i < sizeof(widths); i++)
+  {
+    err = writeNBits(&testStream, widths[i], values[i]);
+    fail_unless (err == EXIP_OK, "writeNBits returns error code %d", err);
+  }
+
+  fail_unless (testStream.context.bufferIndx == 29 && testStream.context.bitPointer == 2,
+               "The writeNBits function did not move the bit Pointer of the stream correctly");
+  fail_unless (buf[30] == (char) 0xFF, "writeNBits modified the bytes after the last written one");
+
+  testStream.context.bufferIndx = 0;
+  testStream.context.bitPointer = 0;
+
+  for(i = 0; i < sizeof(widths); i++)
+  {
+    err = readBits(&testStream, widths[i], &bits_val);
+    fail_unless (err == EXIP_OK, "readBits returns error code %d", err);
+    fail_unless (bits_val == values[i], "The value %lu is read as %lu", values[i], bits_val);
+  }
+
+  // Ending the buffer content right after each field forces the byte-wise reading
+  // also when STREAM_WORD_IO_USE is ON
+  for(i = 0, pos = 0; i < sizeof(widths); pos += widths[i], i++)
+  {
+    testStream.context.bufferIndx = pos / 8;
+    testStream.context.bitPointer = pos % 8;
+    testStream.buffer.bufContent = (pos + widths[i] + 7) / 8;
+    err = readBits(&testStream, widths[i], &bits_val);
+    fail_unless (err == EXIP_OK, "readBits returns error code %d", err);
+    fail_unless (bits_val == values[i], "The value %lu is read byte-wise as %lu", values[i], bits_val);
+  }
+
+  freeAllocList(&testStream.memList);
+}
+END_TEST
+
 /* END: streamWrite tests */
 
 /* BEGIN: streamDecode tests */
@@ -275,6 +334,51 @@ START_TEST (test_decodeNBitUnsignedInteger)
 }
 END_TEST
 
+/**
+ * In byte-aligned mode the octets >= 0x80 are not sign-extended
+ */
+START_TEST (test_decodeNBitUnsignedIntegerByteAligned)
+{
+  EXIStream testStream;
+
+  char buf[3];
+  unsigned long bit_val = 0;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+
+  testStream.context.bitPointer = 0;
+  makeDefaultOpts(&testStream.header.opts);
+  SET_ALIGNMENT(testStream.header.opts.enumOpt, BYTE_ALIGNMENT);
+
+  buf[0] = (char) 0xC8;
+  buf[1] = (char) 0xD4;
+  buf[2] = (char) 0x81;
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = 3;
+  testStream.buffer.bufContent = 3;
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  testStream.context.bufferIndx = 0;
+  initAllocList(&testStream.memList);
+
+  err = decodeNBitUnsignedInteger(&testStream, 8, &bit_val);
+
+  fail_unless (err == EXIP_OK,
+	       "decodeNBitUnsignedInteger returns error code %d", err);
+  fail_unless (bit_val == 0xC8,
+	       "The octet 0xC8 is read as %lu", bit_val);
+
+  err = decodeNBitUnsignedInteger(&testStream, 16, &bit_val);
+
+  fail_unless (err == EXIP_OK,
+	       "decodeNBitUnsignedInteger returns error code %d", err);
+  fail_unless (bit_val == 0x81D4,
+	       "The octets 0xD4 0x81 are read as %lu", bit_val);
+  fail_unless (testStream.context.bitPointer == 0 && testStream.context.bufferIndx == 3,
+    	       "The decodeNBitUnsignedInteger function did not move the byte Pointer of the stream correctly");
+  freeAllocList(&testStream.memList);
+}
+END_TEST
+
 START_TEST (test_decodeBoolean)
 {
   EXIStream testStream;
@@ -343,6 +447,55 @@ START_TEST (test_decodeUnsignedInteger)
 END_TEST
 
 
+START_TEST (test_decodeUnsignedIntegerSequence)
+{
+  EXIStream testStream;
+  char buf[48];
+  UnsignedInteger values[8] = {0, 127, 128, 12372, 2097151, 34359738373ULL, 1, 18446744073709551615ULL};
+  UnsignedInteger bit_val = 0;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  unsigned char startBit;
+  unsigned int i;
+
+  makeDefaultOpts(&testStream.header.opts);
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = 48;
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  initAllocList(&testStream.memList);
+
+  // Both the byte-aligned and the unaligned positions, including the last
+  // few octets of the buffer where the word-at-a-time path does not apply
+  for(startBit = 0; startBit < 8; startBit += 5)
+  {
+	  memset(buf, 0, 48);
+	  testStream.context.bitPointer = startBit;
+	  testStream.context.bufferIndx = 0;
+
+	  for(i = 0; i < 8; i++)
+	  {
+		  err = encodeUnsignedInteger(&testStream, values[i]);
+		  fail_unless (err == EXIP_OK, "encodeUnsignedInteger returns error code %d", err);
+	  }
+
+	  testStream.buffer.bufContent = testStream.context.bufferIndx + (testStream.context.bitPointer != 0);
+	  testStream.context.bitPointer = startBit;
+	  testStream.context.bufferIndx = 0;
+
+	  for(i = 0; i < 8; i++)
+	  {
+		  err = decodeUnsignedInteger(&testStream, &bit_val);
+		  fail_unless (err == EXIP_OK, "decodeUnsignedInteger returns error code %d", err);
+		  fail_unless (bit_val == values[i],
+				  "The UnsignedInteger number %d at bit offset %d is read incorrectly", i, startBit);
+	  }
+
+	  fail_unless (testStream.context.bitPointer == startBit,
+			  "The decodeUnsignedInteger function did not move the bit Pointer of the stream correctly");
+  }
+}
+END_TEST
+
 START_TEST (test_decodeString)
 {
   EXIStream testStream;
@@ -384,6 +537,133 @@ START_TEST (test_decodeString)
 }
 END_TEST
 
+START_TEST (test_decodeStringOnlyRuns)
+{
+  EXIStream testStream;
+  char buf[64];
+  CharType chars[160];
+  CharType expChars[160];
+  String str_val;
+  String exp_val;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  UnsignedInteger code_point;
+  Index writerPosition = 0;
+  unsigned char startBit;
+  unsigned int i;
+
+  // Space for 40 characters in any string representation
+  exp_val.str = expChars;
+  exp_val.length = 40;
+  for(i = 0; i < 40; i++)
+	  writeCharToString(&exp_val, i == 17 ? 200 : 'A' + i, &writerPosition);
+
+  makeDefaultOpts(&testStream.header.opts);
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = 64;
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  initAllocList(&testStream.memList);
+
+  // ASCII runs interrupted by a two-octet code point, byte-aligned and bit-packed
+  for(startBit = 0; startBit < 8; startBit += 3)
+  {
+	  memset(buf, 0, 64);
+	  testStream.context.bitPointer = startBit;
+	  testStream.context.bufferIndx = 0;
+
+	  for(i = 0; i < 40; i++)
+	  {
+		  code_point = i == 17 ? 200 : 'A' + i;
+		  err = encodeUnsignedInteger(&testStream, code_point);
+		  fail_unless (err == EXIP_OK, "encodeUnsignedInteger returns error code %d", err);
+	  }
+
+	  testStream.buffer.bufContent = testStream.context.bufferIndx + (testStream.context.bitPointer != 0);
+	  testStream.context.bitPointer = startBit;
+	  testStream.context.bufferIndx = 0;
+
+	  str_val.str = chars;
+	  str_val.length = 40;
+	  err = decodeStringOnly(&testStream, 40, &str_val);
+	  fail_unless (err == EXIP_OK, "decodeStringOnly returns error code %d", err);
+	  fail_unless (str_val.length == 40, "decodeStringOnly returns wrong string length %d", str_val.length);
+
+	  fail_unless (stringEqual(str_val, exp_val), "The string at bit offset %d is read incorrectly", startBit);
+
+	  fail_unless (testStream.context.bufferIndx == 41 && testStream.context.bitPointer == startBit,
+			  "The decodeStringOnly function did not move the stream position correctly");
+  }
+}
+END_TEST
+
+#if STRING_UTF8_USE
+START_TEST (test_encodeDecodeUTF8String)
+{
+  EXIStream testStream;
+  char buf[64];
+  uint32_t code_points[8] = {'a', 0xE9, ' ', 0x44F, 0x4E2D, 'z', 0x1F600, '!'};
+  String str_val;
+  String dec_val;
+  Index writerPosition = 0;
+  Index readerPosition = 0;
+  UnsignedInteger len;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  unsigned int i;
+
+  makeDefaultOpts(&testStream.header.opts);
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = 64;
+  testStream.buffer.bufContent = 64;
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  testStream.context.bitPointer = 5;
+  testStream.context.bufferIndx = 0;
+  initAllocList(&testStream.memList);
+
+  // Characters of 1, 2, 3 and 4 UTF-8 octets
+  err = allocateStringMemoryManaged(&str_val.str, 8, &testStream.memList);
+  fail_unless (err == EXIP_OK, "allocateStringMemoryManaged returns error code %d", err);
+  str_val.length = 8;
+  for(i = 0; i < 8; i++)
+  {
+	  err = writeCharToString(&str_val, code_points[i], &writerPosition);
+	  fail_unless (err == EXIP_OK, "writeCharToString returns error code %d", err);
+  }
+  fail_unless (writerPosition == 15, "writeCharToString writes %d UTF-8 octets instead of 15", writerPosition);
+
+  err = encodeString(&testStream, &str_val);
+  fail_unless (err == EXIP_OK, "encodeString returns error code %d", err);
+
+  testStream.context.bitPointer = 5;
+  testStream.context.bufferIndx = 0;
+  err = decodeString(&testStream, &dec_val);
+  fail_unless (err == EXIP_OK, "decodeString returns error code %d", err);
+  fail_unless (dec_val.length == 8, "decodeString returns %d characters instead of 8", dec_val.length);
+  fail_unless (stringEqual(str_val, dec_val), "The decoded string is not equal to the encoded one");
+
+  for(i = 0; i < 8; i++)
+  {
+	  fail_unless (readCharFromString(&dec_val, &readerPosition) == code_points[i],
+			  "The character %d is decoded incorrectly", i);
+  }
+
+  // The same number of characters but a different (shorter) UTF-8 encoding
+  len = dec_val.length;
+  dec_val.str[3] = 'x';
+  dec_val.str[4] = 'x';
+  dec_val.str[5] = 'x';
+  dec_val.str[6] = 'x';
+  dec_val.str[7] = 'x';
+  dec_val.str[8] = 'x';
+  fail_unless (dec_val.length == len && !stringEqual(str_val, dec_val),
+		  "stringEqual does not compare the UTF-8 octets");
+  fail_unless (stringCompare(str_val, dec_val) < 0, "stringCompare does not follow the code point order");
+
+  freeAllocList(&testStream.memList);
+}
+END_TEST
+#endif
+
 START_TEST (test_decodeBinary)
 {
   EXIStream testStream;
@@ -420,6 +700,10 @@ START_TEST (test_decodeBinary)
   testStream.buffer.ioStrm.readWriteToStream = NULL;
   testStream.buffer.ioStrm.stream = NULL;
   initAllocList(&testStream.memList);
+#if BINARY_ZERO_COPY_USE
+  testStream.binaryScratch = NULL;
+  testStream.binaryScratchSize = 0;
+#endif
   for(i=0;i<20;i++) testbuf[i]=buf[i];
 
   testStream.context.bufferIndx = 0;
@@ -446,6 +730,10 @@ START_TEST (test_decodeBinary)
     	       "The decodeBinary function did not move the bit Pointer of the stream correctly");
   fail_unless (testStream.context.bufferIndx == 6,
       	       "The decodeBinary function did not move the byte Pointer of the stream correctly");
+#if BINARY_ZERO_COPY_USE
+  fail_unless (res == buf + 1,
+	       "The byte-aligned binary content is not delivered from the input buffer");
+#endif
 
 //Test2:
   bytes=0;
@@ -474,6 +762,122 @@ START_TEST (test_decodeBinary)
   fail_unless (testStream.context.bufferIndx == 15,
       	       "The decodeBinary function did not move the byte Pointer of the stream correctly");
 
+  freeAllocList(&testStream.memList);
+}
+END_TEST
+
+#define BINARY_TEST_LENGTH 40
+#define BINARY_TEST_WINDOW 16
+
+struct memorySource
+{
+	const char* data;
+	size_t length;
+	size_t position;
+};
+
+/* Feeds the stream at most 8 bytes at a time */
+static size_t readMemorySource(void* buf, size_t readSize, void* stream)
+{
+	struct memorySource* src = (struct memorySource*) stream;
+	size_t count = src->length - src->position;
+
+	if(count > readSize)
+		count = readSize;
+	if(count > 8)
+		count = 8;
+
+	memcpy(buf, src->data + src->position, count);
+	src->position += count;
+	return count;
+}
+
+START_TEST (test_decodeBinaryUnaligned)
+{
+  EXIStream encStream;
+  EXIStream testStream;
+  char encBuf[64];
+  char buf[BINARY_TEST_WINDOW];
+  char data[BINARY_TEST_LENGTH];
+  char* res;
+  Index bytes = 0;
+  struct memorySource src;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  int i;
+
+  for(i = 0; i < BINARY_TEST_LENGTH; i++)
+	  data[i] = (char) ((i*37 + 11) & 0x7F);
+
+  memset(encBuf, 0, sizeof(encBuf));
+  makeDefaultOpts(&encStream.header.opts);
+  encStream.buffer.buf = encBuf;
+  encStream.buffer.bufLen = sizeof(encBuf);
+  encStream.buffer.bufContent = 0;
+  encStream.buffer.ioStrm.readWriteToStream = NULL;
+  encStream.buffer.ioStrm.stream = NULL;
+  encStream.context.bufferIndx = 0;
+  encStream.context.bitPointer = 3;
+  initAllocList(&encStream.memList);
+
+  err = encodeBinary(&encStream, data, BINARY_TEST_LENGTH);
+  fail_unless (err == EXIP_OK, "encodeBinary returns error code %d", err);
+
+  // Test1: the whole value is within the input buffer
+  makeDefaultOpts(&testStream.header.opts);
+  testStream.buffer.buf = encBuf;
+  testStream.buffer.bufLen = sizeof(encBuf);
+  testStream.buffer.bufContent = sizeof(encBuf);
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  testStream.context.bufferIndx = 0;
+  testStream.context.bitPointer = 3;
+  initAllocList(&testStream.memList);
+#if BINARY_ZERO_COPY_USE
+  testStream.binaryScratch = NULL;
+  testStream.binaryScratchSize = 0;
+#endif
+
+  err = decodeBinary(&testStream, &res, &bytes);
+
+  fail_unless (err == EXIP_OK, "decodeBinary returns error code %d", err);
+  fail_unless (bytes == BINARY_TEST_LENGTH, "The length of the binary content is read as %d", bytes);
+  fail_unless (memcmp(res, data, BINARY_TEST_LENGTH) == 0, "The unaligned binary content is read wrongly");
+  fail_unless (testStream.context.bufferIndx == 41 && testStream.context.bitPointer == 3,
+		  "The decodeBinary function did not move the stream position correctly");
+#if BINARY_ZERO_COPY_USE
+  fail_unless (res == testStream.binaryScratch, "The unaligned binary content is not in the stream buffer");
+#else
+  EXIP_MFREE(res);
+#endif
+
+  // Test2: the value continues past the content of the input buffer
+  src.data = encBuf;
+  src.length = sizeof(encBuf);
+  src.position = BINARY_TEST_WINDOW;
+  memcpy(buf, encBuf, BINARY_TEST_WINDOW);
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = BINARY_TEST_WINDOW;
+  testStream.buffer.bufContent = BINARY_TEST_WINDOW;
+  testStream.buffer.ioStrm.readWriteToStream = readMemorySource;
+  testStream.buffer.ioStrm.stream = &src;
+  testStream.context.bufferIndx = 0;
+  testStream.context.bitPointer = 3;
+
+  err = decodeBinary(&testStream, &res, &bytes);
+
+  fail_unless (err == EXIP_OK, "decodeBinary returns error code %d", err);
+  fail_unless (bytes == BINARY_TEST_LENGTH, "The length of the binary content is read as %d", bytes);
+  fail_unless (memcmp(res, data, BINARY_TEST_LENGTH) == 0, "The binary content across the buffer end is read wrongly");
+  fail_unless (testStream.context.bitPointer == 3,
+		  "The decodeBinary function did not move the bit Pointer of the stream correctly");
+#if BINARY_ZERO_COPY_USE
+  EXIP_MFREE(testStream.binaryScratch);
+#else
+  EXIP_MFREE(res);
+#endif
+
+  freeAllocList(&encStream.memList);
+  freeAllocList(&testStream.memList);
 }
 END_TEST
 
@@ -806,6 +1210,60 @@ START_TEST (test_encodeString)
 }
 END_TEST
 
+START_TEST (test_encodeStringOnlyRuns)
+{
+  EXIStream testStream;
+  EXIStream refStream;
+  char buf[64];
+  char refBuf[64];
+  CharType chars[160];
+  String str_val;
+  errorCode err = EXIP_UNEXPECTED_ERROR;
+  Index position = 0;
+  unsigned char startBit;
+  unsigned int i;
+
+  // Space for 40 characters in any string representation
+  str_val.str = chars;
+  str_val.length = 40;
+  for(i = 0; i < 40; i++)
+	  writeCharToString(&str_val, i == 17 ? 200 : 'A' + i, &position);
+
+  makeDefaultOpts(&testStream.header.opts);
+  testStream.buffer.buf = buf;
+  testStream.buffer.bufLen = 64;
+  testStream.buffer.ioStrm.readWriteToStream = NULL;
+  testStream.buffer.ioStrm.stream = NULL;
+  initAllocList(&testStream.memList);
+  refStream = testStream;
+  refStream.buffer.buf = refBuf;
+
+  // ASCII runs interrupted by a non-ASCII character must produce the same
+  // octets as encoding the code points one by one
+  for(startBit = 0; startBit < 8; startBit += 3)
+  {
+	  memset(buf, 0xFF, 64);
+	  memset(refBuf, 0xFF, 64);
+	  testStream.context.bitPointer = startBit;
+	  testStream.context.bufferIndx = 0;
+	  refStream.context = testStream.context;
+
+	  err = encodeStringOnly(&testStream, &str_val);
+	  fail_unless (err == EXIP_OK, "encodeStringOnly returns error code %d", err);
+
+	  position = 0;
+	  for(i = 0; i < 40; i++)
+		  encodeUnsignedInteger(&refStream, (UnsignedInteger) readCharFromString(&str_val, &position));
+
+	  fail_unless (testStream.context.bufferIndx == refStream.context.bufferIndx &&
+			  testStream.context.bitPointer == refStream.context.bitPointer,
+			  "The encodeStringOnly function did not move the stream position correctly");
+	  fail_unless (memcmp(buf, refBuf, testStream.context.bufferIndx + 1) == 0,
+			  "encodeStringOnly at bit offset %d writes incorrect octets", startBit);
+  }
+}
+END_TEST
+
 START_TEST (test_encodeBinary)
 {
 	EXIStream testStream;
@@ -932,6 +1390,51 @@ START_TEST (test_encodeIntegerValue)
 }
 END_TEST
 
+/**
+ * The sign of an Integer is a Boolean: a whole octet when not in bit-packed mode
+ */
+START_TEST (test_encodeIntegerValueByteAligned)
+{
+	EXIStream testStream;
+	char buf[5];
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+	Integer test_dec = 0;
+
+	makeDefaultOpts(&testStream.header.opts);
+	SET_ALIGNMENT(testStream.header.opts.enumOpt, BYTE_ALIGNMENT);
+
+	testStream.buffer.buf = buf;
+	testStream.buffer.bufLen = 5;
+	testStream.buffer.bufContent = 5;
+	testStream.buffer.ioStrm.readWriteToStream = NULL;
+	testStream.buffer.ioStrm.stream = NULL;
+	testStream.context.bufferIndx = 0;
+	testStream.context.bitPointer = 0;
+	initAllocList(&testStream.memList);
+
+	err = encodeIntegerValue(&testStream, -913);
+
+	fail_unless (err == EXIP_OK,
+		   "encodeIntegerValue returns error code %d", err);
+	fail_unless (testStream.context.bitPointer == 0,
+			   "The encodeIntegerValue function did not move the bit Pointer of the stream correctly");
+	fail_unless (testStream.context.bufferIndx == 3,
+			   "The encodeIntegerValue function did not move the byte Pointer of the stream correctly");
+	fail_unless (buf[0] == 1 && buf[1] == (char) 0x90 && buf[2] == 0x07,
+			   "The sign is not encoded in its own octet");
+
+	testStream.context.bufferIndx = 0;
+
+	err = decodeIntegerValue(&testStream, &test_dec);
+
+	fail_unless (err == EXIP_OK,
+		   "decodeIntegerValue returns error code %d", err);
+	fail_unless (test_dec == -913,
+			   "The encodeIntegerValue encodes correctly");
+	freeAllocList(&testStream.memList);
+}
+END_TEST
+
 START_TEST (test_encodeDecimalValue)
 {
 	EXIStream testStream;
@@ -977,6 +1480,142 @@ START_TEST (test_encodeDecimalValue)
 }
 END_TEST
 
+#define BYTE_GRANULAR_BUFFER_SIZE 16
+#define BYTE_GRANULAR_STREAM_SIZE 200
+#define BYTE_GRANULAR_BINARY_SIZE 40
+
+struct octetStream
+{
+	char data[BYTE_GRANULAR_STREAM_SIZE];
+	size_t length;
+	size_t position;
+};
+
+static size_t writeOctetStream(void* buf, size_t size, void* stream)
+{
+	struct octetStream* os = (struct octetStream*) stream;
+
+	if(size > BYTE_GRANULAR_STREAM_SIZE - os->length)
+		return 0;
+	memcpy(os->data + os->length, buf, size);
+	os->length += size;
+	return size;
+}
+
+static size_t readOctetStream(void* buf, size_t size, void* stream)
+{
+	struct octetStream* os = (struct octetStream*) stream;
+
+	if(size > os->length - os->position)
+		size = os->length - os->position;
+	memcpy(buf, os->data + os->position, size);
+	os->position += size;
+	return size;
+}
+
+/**
+ * Encodes and decodes n-bit unsigned integers, unsigned integers, a string and a binary
+ * value with byte alignment through a buffer much smaller than the stream, so that
+ * the byte-granular paths flush and refill the buffer in the middle of the values
+ */
+START_TEST (test_byteAlignedRoundTrip)
+{
+	EXIStream testStream;
+	char buf[BYTE_GRANULAR_BUFFER_SIZE];
+	static struct octetStream octets;
+	const unsigned char widths[6] = {1, 3, 8, 9, 16, 17};
+	const unsigned long nbitValues[6] = {1, 5, 200, 300, 40000, 100000};
+	const UnsignedInteger uintValues[4] = {0, 127, 128, 2097151};
+	char bin[BYTE_GRANULAR_BINARY_SIZE];
+	char* binOut;
+	Index nbytes;
+	String str;
+	String strOut;
+	unsigned long nbitOut;
+	UnsignedInteger uintOut;
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+	int i;
+
+	makeDefaultOpts(&testStream.header.opts);
+	SET_ALIGNMENT(testStream.header.opts.enumOpt, BYTE_ALIGNMENT);
+	initAllocList(&testStream.memList);
+#if BINARY_ZERO_COPY_USE
+	testStream.binaryScratch = NULL;
+	testStream.binaryScratchSize = 0;
+#endif
+	asciiToString("a byte-aligned string value", &str, &testStream.memList, FALSE);
+	for(i = 0; i < BYTE_GRANULAR_BINARY_SIZE; i++)
+		bin[i] = (char) (i*37 + 11);
+
+	octets.length = 0;
+	octets.position = 0;
+	testStream.buffer.buf = buf;
+	testStream.buffer.bufLen = BYTE_GRANULAR_BUFFER_SIZE;
+	testStream.buffer.bufContent = 0;
+	testStream.buffer.ioStrm.readWriteToStream = writeOctetStream;
+	testStream.buffer.ioStrm.stream = &octets;
+	testStream.context.bufferIndx = 0;
+	testStream.context.bitPointer = 0;
+
+	for(i = 0; i < 6; i++)
+	{
+		err = encodeNBitUnsignedInteger(&testStream, widths[i], nbitValues[i]);
+		fail_unless (err == EXIP_OK, "encodeNBitUnsignedInteger returns error code %d", err);
+	}
+	for(i = 0; i < 4; i++)
+	{
+		err = encodeUnsignedInteger(&testStream, uintValues[i]);
+		fail_unless (err == EXIP_OK, "encodeUnsignedInteger returns error code %d", err);
+	}
+	err = encodeString(&testStream, &str);
+	fail_unless (err == EXIP_OK, "encodeString returns error code %d", err);
+	err = encodeBinary(&testStream, bin, BYTE_GRANULAR_BINARY_SIZE);
+	fail_unless (err == EXIP_OK, "encodeBinary returns error code %d", err);
+	fail_unless (testStream.context.bitPointer == 0, "The bit pointer moves in byte-aligned mode");
+
+	err = writeEncodedEXIChunk(&testStream);
+	fail_unless (err == EXIP_OK, "writeEncodedEXIChunk returns error code %d", err);
+
+	// n-bit: 1+1+1+2+2+3 octets, unsigned: 1+1+2+3 octets, string and binary with one octet length
+	fail_unless (octets.length == 10 + 7 + 1 + str.length + 1 + BYTE_GRANULAR_BINARY_SIZE,
+			"The byte-aligned stream has %u octets", (unsigned int) octets.length);
+	fail_unless (octets.data[3] == 0x2C && octets.data[4] == 0x01, "The 9-bit value is not encoded least significant octet first");
+	fail_unless (octets.data[7] == (char) 0xA0 && octets.data[8] == (char) 0x86 && octets.data[9] == 0x01,
+			"The 17-bit value is not encoded in 3 octets");
+
+	testStream.buffer.ioStrm.readWriteToStream = readOctetStream;
+	testStream.buffer.bufContent = 0;
+	testStream.context.bufferIndx = 0;
+
+	for(i = 0; i < 6; i++)
+	{
+		err = decodeNBitUnsignedInteger(&testStream, widths[i], &nbitOut);
+		fail_unless (err == EXIP_OK, "decodeNBitUnsignedInteger returns error code %d", err);
+		fail_unless (nbitOut == nbitValues[i], "The %u-bit value %lu is read as %lu", widths[i], nbitValues[i], nbitOut);
+	}
+	for(i = 0; i < 4; i++)
+	{
+		err = decodeUnsignedInteger(&testStream, &uintOut);
+		fail_unless (err == EXIP_OK, "decodeUnsignedInteger returns error code %d", err);
+		fail_unless (uintOut == uintValues[i], "The UnsignedInteger number %d is read incorrectly", i);
+	}
+	err = decodeString(&testStream, &strOut);
+	fail_unless (err == EXIP_OK, "decodeString returns error code %d", err);
+	fail_unless (stringEqual(str, strOut), "The string value is read incorrectly");
+	err = decodeBinary(&testStream, &binOut, &nbytes);
+	fail_unless (err == EXIP_OK, "decodeBinary returns error code %d", err);
+	fail_unless (nbytes == BYTE_GRANULAR_BINARY_SIZE && memcmp(bin, binOut, nbytes) == 0, "The binary value is read incorrectly");
+	fail_unless (testStream.context.bitPointer == 0, "The bit pointer moves in byte-aligned mode");
+
+#if BINARY_ZERO_COPY_USE
+	EXIP_MFREE(testStream.binaryScratch);
+#else
+	EXIP_MFREE(binOut);
+#endif
+	freeAllocList(&testStream.memList);
+}
+END_TEST
+
 /* END: streamEncode tests */
 
 
@@ -1048,6 +1687,7 @@ Suite * streamIO_suite (void)
 	  TCase *tc_sWrite = tcase_create ("StreamWrite");
 	  tcase_add_test (tc_sWrite, test_writeNextBit);
 	  tcase_add_test (tc_sWrite, test_writeNBits);
+	  tcase_add_test (tc_sWrite, test_writeReadNBitsRoundTrip);
 	  suite_add_tcase (s, tc_sWrite);
   }
 
@@ -1055,10 +1695,17 @@ Suite * streamIO_suite (void)
 	  /* StreamDecode test case */
 	  TCase *tc_sDecode = tcase_create ("StreamDecode");
 	  tcase_add_test (tc_sDecode, test_decodeNBitUnsignedInteger);
+	  tcase_add_test (tc_sDecode, test_decodeNBitUnsignedIntegerByteAligned);
 	  tcase_add_test (tc_sDecode, test_decodeBoolean);
 	  tcase_add_test (tc_sDecode, test_decodeUnsignedInteger);
+	  tcase_add_test (tc_sDecode, test_decodeUnsignedIntegerSequence);
 	  tcase_add_test (tc_sDecode, test_decodeString);
+	  tcase_add_test (tc_sDecode, test_decodeStringOnlyRuns);
+#if STRING_UTF8_USE
+	  tcase_add_test (tc_sDecode, test_encodeDecodeUTF8String);
+#endif
 	  tcase_add_test (tc_sDecode, test_decodeBinary);
+	  tcase_add_test (tc_sDecode, test_decodeBinaryUnaligned);
 	  tcase_add_test (tc_sDecode, test_decodeFloat);
 	  tcase_add_test (tc_sDecode, test_decodeIntegerValue);
 	  tcase_add_test (tc_sDecode, test_decodeDecimalValue);
@@ -1072,10 +1719,13 @@ Suite * streamIO_suite (void)
 	  tcase_add_test (tc_sEncode, test_encodeBoolean);
 	  tcase_add_test (tc_sEncode, test_encodeUnsignedInteger);
 	  tcase_add_test (tc_sEncode, test_encodeString);
+	  tcase_add_test (tc_sEncode, test_encodeStringOnlyRuns);
 	  tcase_add_test (tc_sEncode, test_encodeBinary);
 	  tcase_add_test (tc_sEncode, test_encodeFloatValue);
 	  tcase_add_test (tc_sEncode, test_encodeIntegerValue);
+	  tcase_add_test (tc_sEncode, test_encodeIntegerValueByteAligned);
 	  tcase_add_test (tc_sEncode, test_encodeDecimalValue);
+	  tcase_add_test (tc_sEncode, test_byteAlignedRoundTrip);
 	  suite_add_tcase (s, tc_sEncode);
   }
 
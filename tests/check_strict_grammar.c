@@ -24,6 +24,7 @@
 #include "stringManipulate.h"
 #include "grammarGenerator.h"
 #include "memManagement.h"
+#include "grammars.h"
 
 #define INPUT_BUFFER_SIZE 200
 #define OUTPUT_BUFFER_SIZE 200
@@ -1494,6 +1495,109 @@ END_TEST
 /**********************************************************************/
 /* END THE LKAB DEMO SUIT*/
 
+#if PRODUCTION_INDEX_USE
+
+/* The first production of a rule matching an event, by a linear scan */
+static Index scanProduction(GrammarRule* rule, EventTypeClass eventClass, QNameID qnameID)
+{
+	Production* tmpProd;
+	Index j;
+
+	for(j = 0; j < rule->pCount; j++)
+	{
+		tmpProd = &rule->production[rule->pCount - 1 - j];
+		if(GET_EVENT_CLASS(GET_PROD_EXI_EVENT(tmpProd->content)) != eventClass)
+			continue;
+		if(eventClass != EVENT_AT_CLASS && eventClass != EVENT_SE_CLASS)
+			break;
+		if(GET_PROD_URI_ID(tmpProd) == URI_MAX || (GET_PROD_URI_ID(tmpProd) == qnameID.uriId &&
+				(GET_PROD_LN_ID(tmpProd) == LN_MAX || GET_PROD_LN_ID(tmpProd) == qnameID.lnId)))
+			break;
+	}
+
+	return j;
+}
+
+/* Every event of a rule is looked up in the index and by a linear scan */
+static void checkIndexedRule(EXIPSchema* schema, GrammarRule* rule)
+{
+	EventTypeClass eventClass;
+	QNameID qnameID;
+	Index code;
+	Index j;
+
+	for(j = 0; j < rule->pCount; j++)
+	{
+		eventClass = GET_EVENT_CLASS(GET_PROD_EXI_EVENT(rule->production[j].content));
+		qnameID.uriId = URI_MAX;
+		qnameID.lnId = LN_MAX;
+		if(eventClass == EVENT_AT_CLASS || eventClass == EVENT_SE_CLASS)
+		{
+			GET_PROD_QNAME_ID(&rule->production[j], qnameID);
+			// A qname of the namespace that is not in the rule
+			if(qnameID.uriId != URI_MAX && qnameID.lnId == LN_MAX)
+				qnameID.lnId = schema->uriTable.uri[qnameID.uriId].lnTable.count;
+			else if(qnameID.uriId == URI_MAX)
+			{
+				qnameID.uriId = (SmallIndex) schema->uriTable.count;
+				qnameID.lnId = 0;
+			}
+		}
+
+		fail_unless(findIndexedProduction(&schema->prodIndex, rule, eventClass, qnameID, &code), "The rule is not indexed");
+		fail_unless(code == scanProduction(rule, eventClass, qnameID),
+					"Production index code %u, expected %u", (unsigned int) code, (unsigned int) scanProduction(rule, eventClass, qnameID));
+	}
+
+	// Events without a production in the rule
+	qnameID.uriId = (SmallIndex) schema->uriTable.count;
+	qnameID.lnId = 0;
+	fail_unless(findIndexedProduction(&schema->prodIndex, rule, EVENT_SE_CLASS, qnameID, &code), "The rule is not indexed");
+	fail_unless(code == scanProduction(rule, EVENT_SE_CLASS, qnameID), "Production index code %u for an unknown qname", (unsigned int) code);
+	fail_unless(findIndexedProduction(&schema->prodIndex, rule, EVENT_NS_CLASS, qnameID, &code), "The rule is not indexed");
+	fail_unless(code == scanProduction(rule, EVENT_NS_CLASS, qnameID), "Production index code %u for NS", (unsigned int) code);
+}
+
+START_TEST (test_productionIndex)
+{
+	const char *schemafname[2] = {"exip/SenML-xsd.exi", "SchemaStrict/lkab-devices-xsd.exi"};
+	EXIPSchema schema;
+	QNameID qnameID = {URI_MAX, LN_MAX};
+	Index indexedCount;
+	Index code;
+	Index i, g, r;
+
+	for(i = 0; i < 2; i++)
+	{
+		parseSchema(schemafname[i], &schema);
+		indexedCount = 0;
+
+		for(g = 0; g < schema.grammarTable.count; g++)
+		{
+			for(r = 0; r < schema.grammarTable.grammar[g].count; r++)
+			{
+				GrammarRule* rule = &schema.grammarTable.grammar[g].rule[r];
+
+				if(rule->pCount < PRODUCTION_INDEX_THRESHOLD)
+				{
+					fail_if(findIndexedProduction(&schema.prodIndex, rule, EVENT_EE_CLASS, qnameID, &code), "A small rule is indexed");
+					continue;
+				}
+
+				checkIndexedRule(&schema, rule);
+				indexedCount++;
+			}
+		}
+
+		fail_unless(indexedCount == 0 || schema.prodIndex.count > indexedCount, "The production index of %s is empty", schemafname[i]);
+
+		destroySchema(&schema);
+	}
+}
+END_TEST
+
+#endif /* PRODUCTION_INDEX_USE */
+
 /* Test suite */
 
 Suite* exip_suite(void)
@@ -1506,6 +1610,9 @@ Suite* exip_suite(void)
 	  tcase_add_test (tc_builtin, test_acceptance_for_A_01_exip1);
 	  tcase_add_test (tc_builtin, test_acceptance_for_A_01b);
 	  tcase_add_test (tc_builtin, test_lkab_demo_suit);
+#if PRODUCTION_INDEX_USE
+	  tcase_add_test (tc_builtin, test_productionIndex);
+#endif
 	  suite_add_tcase (s, tc_builtin);
 	}
 
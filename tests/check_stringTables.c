@@ -15,12 +15,14 @@
  * @par[Revision] $Id$
  */
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <check.h>
 #include "sTables.h"
 #include "stringManipulate.h"
 #include "memManagement.h"
 #include "dynamicArray.h"
+#include "hashtable.h"
 
 /* BEGIN: table tests */
 
@@ -52,6 +54,9 @@ START_TEST (test_addUriEntry)
 	// Create the URI table
 	err = createDynArray(&uriTable.dynArray, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER);
 	fail_if(err != EXIP_OK);
+#if STRING_TABLE_INDEX_USE
+	uriTable.index = NULL;
+#endif
 
 	err = addUriEntry(&uriTable, test_uri, &entryId);
 
@@ -96,6 +101,9 @@ START_TEST (test_addLnEntry)
 
 	err = createDynArray(&lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER);
 	fail_if(err != EXIP_OK);
+#if STRING_TABLE_INDEX_USE
+	lnTable.index = NULL;
+#endif
 
 	err = addLnEntry(&lnTable, test_ln, &entryId);
 
@@ -143,7 +151,6 @@ START_TEST (test_addValueEntry)
 	// IV: Initialize the stream
 	{
 		tmp_err_code = initAllocList(&(testStrm.memList));
-		gStack.nextInStack = NULL;
 		gStack.grammar = NULL;
 		testStrm.gStack = &gStack;
 		testStrm.context.bitPointer = 0;
@@ -154,7 +161,11 @@ START_TEST (test_addValueEntry)
 		fail_unless (testStrm.schema != NULL, "Memory alloc error");
 		/* Create and initialize initial string table entries */
 		tmp_err_code += createDynArray(&testStrm.schema->uriTable.dynArray, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER);
+#if STRING_TABLE_INDEX_USE
+		testStrm.schema->uriTable.index = NULL;
+#endif
 		tmp_err_code += createUriTableEntries(&testStrm.schema->uriTable, FALSE);
+		tmp_err_code += createStreamUriTable(&testStrm);
 	}
 	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
 
@@ -165,16 +176,199 @@ START_TEST (test_addValueEntry)
 
 	fail_unless (tmp_err_code == EXIP_OK, "addValueEntry returns an error code %d", tmp_err_code);
 #if VALUE_CROSSTABLE_USE
-	fail_unless (testStrm.schema->uriTable.uri[testStrm.gStack->currQNameID.uriId].lnTable.ln[testStrm.gStack->currQNameID.lnId].vxTable != NULL, "addValueEntry does not create vxTable");
-	fail_unless (testStrm.schema->uriTable.uri[testStrm.gStack->currQNameID.uriId].lnTable.ln[testStrm.gStack->currQNameID.lnId].vxTable->count == 1, "addValueEntry does not create correct vxTable");
+	fail_unless (testStrm.uriTable.uri[testStrm.gStack->currQNameID.uriId].lnTable.ln[testStrm.gStack->currQNameID.lnId].vxTable != NULL, "addValueEntry does not create vxTable");
+	fail_unless (testStrm.uriTable.uri[testStrm.gStack->currQNameID.uriId].lnTable.ln[testStrm.gStack->currQNameID.lnId].vxTable->count == 1, "addValueEntry does not create correct vxTable");
+	fail_unless (testStrm.schema->uriTable.uri[testStrm.gStack->currQNameID.uriId].lnTable.ln[testStrm.gStack->currQNameID.lnId].vxTable == NULL, "addValueEntry modifies the string tables of the schema");
 #endif
 	fail_unless (testStrm.valueTable.count == 1, "addValueEntry does not create global value entry");
 
 	destroyDynArray(&testStrm.valueTable.dynArray);
+	destroyStreamUriTable(&testStrm);
+	destroyDynArray(&testStrm.schema->uriTable.dynArray);
+	freeAllocList(&testStrm.memList);
+}
+END_TEST
+
+START_TEST (test_lookupLn)
+{
+	errorCode err = EXIP_UNEXPECTED_ERROR;
+	LnTable lnTable;
+	Index entryId;
+	Index i;
+	char names[100][8];
+	char newNames[10][8];
+	String name;
+
+	err = createDynArray(&lnTable.dynArray, sizeof(LnEntry), DEFAULT_LN_ENTRIES_NUMBER);
+	fail_if(err != EXIP_OK);
+#if STRING_TABLE_INDEX_USE
+	lnTable.index = NULL;
+#endif
+
+	// Enough names for the lookups to go through the index when enabled
+	for(i = 0; i < 100; i++)
+	{
+		sprintf(names[i], "ln%u", (unsigned int) i);
+		asciiToString(names[i], &name, NULL, FALSE);
+		err = addLnEntry(&lnTable, name, &entryId);
+		fail_unless (err == EXIP_OK, "addLnEntry returns error code %d", err);
+	}
+
+	for(i = 0; i < 100; i++)
+	{
+		asciiToString(names[i], &name, NULL, FALSE);
+		fail_unless (lookupLn(&lnTable, name, &entryId) == TRUE && entryId == i,
+					"lookupLn does not find the local name %s", names[i]);
+	}
+
+	asciiToString("ln100", &name, NULL, FALSE);
+	fail_unless (lookupLn(&lnTable, name, &entryId) == FALSE, "lookupLn finds a missing local name");
+
+	// The entries added during a stream are removed at its end and others added
+	lnTable.count = 50;
+	for(i = 0; i < 10; i++)
+	{
+		sprintf(newNames[i], "new%u", (unsigned int) i);
+		asciiToString(newNames[i], &name, NULL, FALSE);
+		err = addLnEntry(&lnTable, name, &entryId);
+		fail_unless (err == EXIP_OK, "addLnEntry returns error code %d", err);
+	}
+
+	asciiToString(names[55], &name, NULL, FALSE);
+	fail_unless (lookupLn(&lnTable, name, &entryId) == FALSE, "lookupLn finds a removed local name");
+	asciiToString(names[49], &name, NULL, FALSE);
+	fail_unless (lookupLn(&lnTable, name, &entryId) == TRUE && entryId == 49, "lookupLn does not find a kept local name");
+	asciiToString(newNames[7], &name, NULL, FALSE);
+	fail_unless (lookupLn(&lnTable, name, &entryId) == TRUE && entryId == 57, "lookupLn does not find a new local name");
+
+#if STRING_TABLE_INDEX_USE
+	fail_if (lnTable.index == NULL, "The index of the local-name table is not built");
+	destroyNameIndex(&lnTable.index);
+#endif
+	destroyDynArray(&lnTable.dynArray);
+}
+END_TEST
+
+#if VALUE_CROSSTABLE_USE
+START_TEST (test_lookupVx)
+{
+	EXIStream testStrm;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	QNameID qnameID;
+	VxTable* vxTable;
+	Index vxEntryId;
+	Index i;
+	char values[50][8];
+	String value;
+	String clonedValue;
+
+	tmp_err_code = initAllocList(&(testStrm.memList));
+	tmp_err_code += createValueTable(&testStrm.valueTable);
+	testStrm.header.opts.valuePartitionCapacity = 40;
+	testStrm.schema = memManagedAllocate(&testStrm.memList, sizeof(EXIPSchema));
+	fail_unless (testStrm.schema != NULL, "Memory alloc error");
+	tmp_err_code += createDynArray(&testStrm.schema->uriTable.dynArray, sizeof(UriEntry), DEFAULT_URI_ENTRIES_NUMBER);
+#if STRING_TABLE_INDEX_USE
+	testStrm.schema->uriTable.index = NULL;
+#endif
+	tmp_err_code += createUriTableEntries(&testStrm.schema->uriTable, FALSE);
+	tmp_err_code += createStreamUriTable(&testStrm);
+	fail_unless (tmp_err_code == EXIP_OK, "initStream returns an error code %d", tmp_err_code);
+
+	qnameID.uriId = 1; // http://www.w3.org/XML/1998/namespace
+	qnameID.lnId = 2; // lang
+
+	// 50 values in a value table with capacity 40: the first 10 values are evicted
+	for(i = 0; i < 50; i++)
+	{
+		sprintf(values[i], "v%u", (unsigned int) i);
+		asciiToString(values[i], &value, NULL, FALSE);
+		tmp_err_code = cloneString(&value, &clonedValue);
+		tmp_err_code += addValueEntry(&testStrm, clonedValue, qnameID);
+		fail_unless (tmp_err_code == EXIP_OK, "addValueEntry returns an error code %d", tmp_err_code);
+
+		vxTable = GET_LN_URI_QNAME(testStrm.uriTable, qnameID).vxTable;
+		fail_unless (lookupVx(&testStrm.valueTable, vxTable, value, &vxEntryId) == TRUE && vxEntryId == i,
+					"lookupVx does not find the value %s", values[i]);
+	}
+
+	for(i = 0; i < 50; i++)
+	{
+		asciiToString(values[i], &value, NULL, FALSE);
+		if(i < 10)
+			fail_unless (lookupVx(&testStrm.valueTable, vxTable, value, &vxEntryId) == FALSE,
+						"lookupVx finds the evicted value %s", values[i]);
+		else
+			fail_unless (lookupVx(&testStrm.valueTable, vxTable, value, &vxEntryId) == TRUE && vxEntryId == i,
+						"lookupVx does not find the value %s", values[i]);
+	}
+
+#if STRING_TABLE_INDEX_USE
+	fail_if (vxTable->index == NULL, "The index of the value cross table is not built");
+#endif
+	for(i = 0; i < testStrm.valueTable.count; i++)
+		EXIP_MFREE(testStrm.valueTable.value[i].valueStr.str);
+	destroyDynArray(&testStrm.valueTable.dynArray);
+	destroyStreamUriTable(&testStrm);
 	destroyDynArray(&testStrm.schema->uriTable.dynArray);
 	freeAllocList(&testStrm.memList);
 }
 END_TEST
+#endif
+
+START_TEST (test_hashtable)
+{
+	struct hashtable* h;
+	char keys[2000][8];
+	String key;
+	Index i;
+
+	h = create_hashtable(16, wordHash, stringEqual);
+	fail_if (h == NULL, "create_hashtable returns NULL");
+
+	for(i = 0; i < 2000; i++)
+	{
+		sprintf(keys[i], "key%u", (unsigned int) i);
+		asciiToString(keys[i], &key, NULL, FALSE);
+		fail_unless (hashtable_insert(h, key, i) == EXIP_OK, "hashtable_insert fails for %s", keys[i]);
+	}
+	fail_unless (hashtable_count(h) == 2000, "hashtable_count returns %u", hashtable_count(h));
+
+	// Remove every other key as the value partition does on wrap-around
+	for(i = 0; i < 2000; i += 2)
+	{
+		asciiToString(keys[i], &key, NULL, FALSE);
+		fail_unless (hashtable_remove(h, key) == i, "hashtable_remove does not return the value of %s", keys[i]);
+	}
+
+	for(i = 0; i < 2000; i++)
+	{
+		asciiToString(keys[i], &key, NULL, FALSE);
+		if(i % 2 == 0)
+			fail_unless (hashtable_search(h, key) == INDEX_MAX, "hashtable_search finds the removed key %s", keys[i]);
+		else
+			fail_unless (hashtable_search(h, key) == i, "hashtable_search does not find %s", keys[i]);
+	}
+
+	// Remove nearly all keys so that the table is compacted
+	for(i = 1; i < 1990; i += 2)
+	{
+		asciiToString(keys[i], &key, NULL, FALSE);
+		fail_unless (hashtable_remove(h, key) == i, "hashtable_remove does not return the value of %s", keys[i]);
+	}
+	fail_unless (hashtable_count(h) == 5, "hashtable_count returns %u", hashtable_count(h));
+
+	for(i = 1991; i < 2000; i += 2)
+	{
+		asciiToString(keys[i], &key, NULL, FALSE);
+		fail_unless (hashtable_search(h, key) == i, "hashtable_search does not find %s", keys[i]);
+	}
+	asciiToString(keys[1], &key, NULL, FALSE);
+	fail_unless (hashtable_remove(h, key) == INDEX_MAX, "hashtable_remove removes a missing key");
+
+	hashtable_destroy(h);
+}
+END_TEST
 
 /* END: table tests */
 
@@ -189,6 +383,11 @@ Suite * tables_suite (void)
 	  tcase_add_test (tc_tables, test_addUriEntry);
 	  tcase_add_test (tc_tables, test_addLnEntry);
 	  tcase_add_test (tc_tables, test_addValueEntry);
+	  tcase_add_test (tc_tables, test_lookupLn);
+	  tcase_add_test (tc_tables, test_hashtable);
+#if VALUE_CROSSTABLE_USE
+	  tcase_add_test (tc_tables, test_lookupVx);
+#endif
 	  suite_add_tcase (s, tc_tables);
   }
 
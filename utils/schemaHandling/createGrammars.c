@@ -19,6 +19,7 @@
 #include "schemaOutputUtils.h"
 #include "grammars.h"
 #include "sTables.h"
+#include "schemaImage.h"
 #include <stdio.h>
 #include <time.h>
 #include "createGrammars.h"
@@ -210,5 +211,22 @@ errorCode toDynSrc(EXIPSchema* schemaPtr, FILE *outfile)
 
 errorCode toEXIP(EXIPSchema* schemaPtr, FILE *outfile)
 {
-	return EXIP_NOT_IMPLEMENTED_YET;
+	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
+	void* image;
+	size_t size = 0;
+
+	TRY(writeSchemaImage(schemaPtr, NULL, &size));
+
+	image = EXIP_MALLOC(size);
+	if(image == NULL)
+		return EXIP_MEMORY_ALLOCATION_ERROR;
+
+	TRY_CATCH(writeSchemaImage(schemaPtr, image, &size), EXIP_MFREE(image));
+
+	if(fwrite(image, 1, size, outfile) != size)
+		tmp_err_code = EXIP_UNEXPECTED_ERROR;
+
+	EXIP_MFREE(image);
+
+	return tmp_err_code;
 }
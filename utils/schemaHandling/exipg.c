@@ -224,7 +224,8 @@ static void printfHelp()
     printf("  Usage:   exipg [options] -schema=<xsd_in> [grammar_out] \n\n");
     printf("           Options: [-help | [[-exip | -text | -dynamic | -static[=<deviations>]] [-pfx=<prefix>] [-ops=<ops_mask>]] ] \n");
     printf("           -help        :   Prints this help message\n");
-    printf("           -exip        :   Format the output schema definitions in EXIP-specific format (Default)\n");
+    printf("           -exip        :   Format the output schema definitions in EXIP-specific format (Default): a binary schema image\n");
+    printf("                            for loadSchemaImage(), bound to the configuration of this build of EXIP\n");
     printf("           -text        :   Format the output schema definitions in human readable text format\n");
     printf("           -dynamic     :   Create C code for the grammars defined. The output is a C function that dynamically generates the grammars\n");
     printf("           -static      :   Create C code for the grammars defined. The output is C structures describing the grammars\n");
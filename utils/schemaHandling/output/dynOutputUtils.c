@@ -36,7 +36,7 @@ errorCode dynExipSchemaOutput(EXIPSchema* schema, char* prefix, unsigned char ma
 	unsigned int tgCount = 0;
 	QNameID typeGrammars[MAX_GRAMMARS_COUNT];
 
-	typeGrammarsHash = create_hashtable(1000, djbHash, stringEqual);
+	typeGrammarsHash = create_hashtable(1000, wordHash, stringEqual);
 
 	// TODO: needs to be fixed
 
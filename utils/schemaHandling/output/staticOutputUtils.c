@@ -20,33 +20,33 @@
 
 static void setProdStrings(IndexStrings *indexStrings, Production *prod)
 {
-	char *indexMaxStr = "INDEX_MAX";
-	char *uriMaxStr = "URI_MAX";
-	char *lnMaxStr = "LN_MAX";
+	char *indexMaxStr = "PROD_TYPE_ID_MAX";
+	char *uriMaxStr = "PROD_URI_ID_MAX";
+	char *lnMaxStr = "PROD_LN_ID_MAX";
 
-	if (prod->typeId == INDEX_MAX)
+	if (GET_PROD_TYPE_ID(prod) == INDEX_MAX)
 	{
 		strcpy(indexStrings->typeIdStr, indexMaxStr);
 	}
 	else
 	{
-		sprintf(indexStrings->typeIdStr, "%u", (unsigned int) prod->typeId);
+		sprintf(indexStrings->typeIdStr, "%u", (unsigned int) GET_PROD_TYPE_ID(prod));
 	}
-	if (prod->qnameId.uriId == URI_MAX)
+	if (GET_PROD_URI_ID(prod) == URI_MAX)
 	{
 		strcpy(indexStrings->uriIdStr, uriMaxStr);
 	}
 	else
 	{
-		sprintf(indexStrings->uriIdStr, "%u", (unsigned int) prod->qnameId.uriId);
+		sprintf(indexStrings->uriIdStr, "%u", (unsigned int) GET_PROD_URI_ID(prod));
 	}
-	if (prod->qnameId.lnId == LN_MAX)
+	if (GET_PROD_LN_ID(prod) == LN_MAX)
 	{
 		strcpy(indexStrings->lnIdStr, lnMaxStr);
 	}
 	else
 	{
-		sprintf(indexStrings->lnIdStr, "%u", (unsigned int) prod->qnameId.lnId);
+		sprintf(indexStrings->lnIdStr, "%u", (unsigned int) GET_PROD_LN_ID(prod));
 	}
 }
 
@@ -158,7 +158,8 @@ void staticRulesOutput(EXIGrammar* gr, char* prefix, Index grId, FILE* out)
 			fprintf(out, "NULL, ");
 
 		fprintf(out, "%u, ", (unsigned int) gr->rule[ruleIter].pCount);
-		fprintf(out, "%u", (unsigned int) gr->rule[ruleIter].meta);
+		fprintf(out, "%u, ", (unsigned int) gr->rule[ruleIter].meta);
+		fprintf(out, "{%u, %u}", (unsigned int) gr->rule[ruleIter].codeBits[0], (unsigned int) gr->rule[ruleIter].codeBits[1]);
 		fprintf(out, "}%s", ruleIter != (gr->count-1)?",":"");
 
 	}
@@ -198,12 +199,14 @@ void staticDocGrammarOutput(EXIGrammar* docGr, char* prefix, FILE* out)
 	/* Build the document grammar, DocEnd productions */
 
 	fprintf(out, "static CONST Production %s[%u] =\n{\n", varNameEnd, 1);
-	fprintf(out,"    {\n        0xAFFFFFF, INDEX_MAX,\n        {URI_MAX, LN_MAX}}\n};\n\n");
+	fprintf(out,"    {\n        0xAFFFFFF, PROD_TYPE_ID_MAX,\n        {PROD_URI_ID_MAX, PROD_LN_ID_MAX}}\n};\n\n");
 
 	/* Build the document grammar rules */
 	fprintf(out, "static CONST GrammarRule %sdocGrammarRule[2] =\n{\n", prefix);
-	fprintf(out, "    {%s, %u, 0},\n\
-    {%s, 1, 0}\n};\n\n", varNameContent, (unsigned int) docGr->rule[GR_DOC_CONTENT].pCount, varNameEnd);
+	fprintf(out, "    {%s, %u, 0, {%u, %u}},\n\
+    {%s, 1, 0, {%u, %u}}\n};\n\n", varNameContent, (unsigned int) docGr->rule[GR_DOC_CONTENT].pCount,
+			(unsigned int) docGr->rule[GR_DOC_CONTENT].codeBits[0], (unsigned int) docGr->rule[GR_DOC_CONTENT].codeBits[1],
+			varNameEnd, (unsigned int) docGr->rule[GR_DOC_END].codeBits[0], (unsigned int) docGr->rule[GR_DOC_END].codeBits[1]);
 }
 
 void staticPrefixOutput(PfxTable* pfxTbl, char* prefix, Index uriId, Deviations dvis, FILE* out)
@@ -23,6 +23,7 @@ errorCode textGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar* gr, EXIP
 {
 	Index ruleIter, prodIter;
 	Production* tmpProd;
+	QNameID prodQnameId;
 	EXIType exiType = VALUE_TYPE_NONE;
 
 	fprintf(out, "Grammar %d [%d:%d] ", (int) grIndex, (int) qnameid.uriId, (int) qnameid.lnId);
@@ -38,8 +39,8 @@ errorCode textGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar* gr, EXIP
 		for(prodIter = 0; prodIter < gr->rule[ruleIter].pCount; prodIter++)
 		{
 			tmpProd = &gr->rule[ruleIter].production[gr->rule[ruleIter].pCount - 1 - prodIter];
-			if(GET_PROD_EXI_EVENT(tmpProd->content) != EVENT_SE_QNAME && tmpProd->typeId != INDEX_MAX)
-				exiType = GET_EXI_TYPE(schema->simpleTypeTable.sType[tmpProd->typeId].content);
+			if(GET_PROD_EXI_EVENT(tmpProd->content) != EVENT_SE_QNAME && GET_PROD_TYPE_ID(tmpProd) != INDEX_MAX)
+				exiType = GET_EXI_TYPE(schema->simpleTypeTable.sType[GET_PROD_TYPE_ID(tmpProd)].content);
 			else
 				exiType = VALUE_TYPE_NONE;
 			switch(GET_PROD_EXI_EVENT(tmpProd->content))
@@ -51,10 +52,11 @@ errorCode textGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar* gr, EXIP
 					fprintf(out, "\tED ");
 					break;
 				case EVENT_SE_QNAME:
-					fprintf(out, "\tSE ([%d:%d]", (int) tmpProd->qnameId.uriId, (int) tmpProd->qnameId.lnId);
-					fwrite(schema->uriTable.uri[tmpProd->qnameId.uriId].uriStr.str, sizeof(CharType), schema->uriTable.uri[tmpProd->qnameId.uriId].uriStr.length, out);
+					GET_PROD_QNAME_ID(tmpProd, prodQnameId);
+					fprintf(out, "\tSE ([%d:%d]", (int) prodQnameId.uriId, (int) prodQnameId.lnId);
+					fwrite(schema->uriTable.uri[prodQnameId.uriId].uriStr.str, sizeof(CharType), schema->uriTable.uri[prodQnameId.uriId].uriStr.length, out);
 					fprintf(out, ":");
-					fwrite(GET_LN_URI_QNAME(schema->uriTable, tmpProd->qnameId).lnStr.str, sizeof(CharType), GET_LN_URI_QNAME(schema->uriTable, tmpProd->qnameId).lnStr.length, out);
+					fwrite(GET_LN_URI_QNAME(schema->uriTable, prodQnameId).lnStr.str, sizeof(CharType), GET_LN_URI_QNAME(schema->uriTable, prodQnameId).lnStr.length, out);
 					fprintf(out, ") ");
 					break;
 				case EVENT_SE_URI:
@@ -67,10 +69,11 @@ errorCode textGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar* gr, EXIP
 					fprintf(out, "\tEE ");
 					break;
 				case EVENT_AT_QNAME:
-					fprintf(out, "\tAT ([%d:%d]", (int) tmpProd->qnameId.uriId, (int) tmpProd->qnameId.lnId);
-					fwrite(schema->uriTable.uri[tmpProd->qnameId.uriId].uriStr.str, sizeof(CharType), schema->uriTable.uri[tmpProd->qnameId.uriId].uriStr.length, out);
+					GET_PROD_QNAME_ID(tmpProd, prodQnameId);
+					fprintf(out, "\tAT ([%d:%d]", (int) prodQnameId.uriId, (int) prodQnameId.lnId);
+					fwrite(schema->uriTable.uri[prodQnameId.uriId].uriStr.str, sizeof(CharType), schema->uriTable.uri[prodQnameId.uriId].uriStr.length, out);
 					fprintf(out, ":");
-					fwrite(GET_LN_URI_QNAME(schema->uriTable, tmpProd->qnameId).lnStr.str, sizeof(CharType), GET_LN_URI_QNAME(schema->uriTable, tmpProd->qnameId).lnStr.length, out);
+					fwrite(GET_LN_URI_QNAME(schema->uriTable, prodQnameId).lnStr.str, sizeof(CharType), GET_LN_URI_QNAME(schema->uriTable, prodQnameId).lnStr.length, out);
 					fprintf(out, ") ");
 					writeValueTypeString(out, exiType);
 					break;
@@ -175,6 +178,7 @@ errorCode recursiveTextGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar*
 {
 	errorCode tmp_err_code = EXIP_UNEXPECTED_ERROR;
 	Index r, p;
+	QNameID prodQnameId;
 
 	tmp_err_code = textGrammarOutput(qnameid, grIndex, gr, schema, out);
 	if(tmp_err_code != EXIP_OK)
@@ -185,9 +189,10 @@ errorCode recursiveTextGrammarOutput(QNameID qnameid, Index grIndex, EXIGrammar*
 		for(p = 0; p < gr->rule[r].pCount; p++)
 		{
 			if(GET_PROD_EXI_EVENT(gr->rule[r].production[p].content) == EVENT_SE_QNAME &&
-					gr->rule[r].production[p].typeId != INDEX_MAX)
+					GET_PROD_TYPE_ID(&gr->rule[r].production[p]) != INDEX_MAX)
 			{
-				tmp_err_code = recursiveTextGrammarOutput(gr->rule[r].production[p].qnameId, gr->rule[r].production[p].typeId, &schema->grammarTable.grammar[gr->rule[r].production[p].typeId], schema, out);
+				GET_PROD_QNAME_ID(&gr->rule[r].production[p], prodQnameId);
+				tmp_err_code = recursiveTextGrammarOutput(prodQnameId, GET_PROD_TYPE_ID(&gr->rule[r].production[p]), &schema->grammarTable.grammar[GET_PROD_TYPE_ID(&gr->rule[r].production[p])], schema, out);
 				if(tmp_err_code != EXIP_OK)
 					return tmp_err_code;
 			}